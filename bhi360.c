@@ -39,6 +39,7 @@
 #include "bhi360.h"
 #include "bhi360_hif.h"
 #include "bhi360_defs.h"
+#include "bhi360_fw.h"
 #include "bhi360_system_param.h"
 #include "bhi360_virtual_sensor_info_param.h"
 
@@ -62,16 +63,44 @@ typedef enum
  */
 static const uint8_t bhi360_sysid_event_size[11] = { 2, 3, 6, 4, 0, 18, 2, 3, 6, 4, 1 };
 
+static int8_t get_and_process_fifo(uint8_t *work_buffer, uint32_t buffer_size, struct bhi360_dev *dev);
 static int8_t parse_fifo(enum bhi360_fifo_type source, struct bhi360_fifo_buffer *fifo_p, struct bhi360_dev *dev);
 static int8_t get_buffer_status(const struct bhi360_fifo_buffer *fifo_p, uint8_t event_size, buffer_status_t *status);
 static int8_t get_time_stamp(enum bhi360_fifo_type source, uint64_t **time_stamp, struct bhi360_dev *dev);
 static int8_t get_callback_info(uint8_t sensor_id, struct bhi360_fifo_parse_callback_table *info,
                                 struct bhi360_dev *dev);
 static int8_t parse_status_fifo(struct bhi360_fifo_buffer *fifo_p, struct bhi360_dev *dev);
+static void count_fifo_frame(enum bhi360_fifo_type source,
+                             uint8_t sensor_id,
+                             uint32_t size,
+                             uint8_t callback_called,
+                             struct bhi360_fifo_stats *stats);
+static uint16_t latency_bucket(uint32_t latency_us);
+static uint32_t latency_bucket_value(uint16_t bucket);
+static void record_latency(uint8_t sensor_id, uint64_t time_stamp, struct bhi360_dev *dev);
+static void profile_bsx(enum bhi360_bsx_profile_type type,
+                        const uint8_t *log,
+                        uint64_t time_stamp,
+                        struct bhi360_bsx_profile *profile);
+static void profile_bsx_meta_event(uint8_t sensor_id,
+                                   const uint8_t *payload,
+                                   uint64_t time_stamp,
+                                   struct bhi360_dev *dev);
+static void call_callback(const struct bhi360_fifo_parse_callback_table *info,
+                          const struct bhi360_fifo_parse_data_info *data_info,
+                          struct bhi360_dev *dev);
+static uint8_t process_event(enum bhi360_fifo_type source,
+                             uint8_t *event,
+                             uint64_t *time_stamp,
+                             const struct bhi360_fifo_parse_callback_table *info,
+                             struct bhi360_dev *dev);
 static int8_t process_status_fifo(int8_t rslt,
                                   uint16_t int_status,
                                   struct bhi360_fifo_buffer *fifo_p,
                                   struct bhi360_dev *dev);
+static void begin_wakeup(uint8_t int_status, struct bhi360_wakeup_stats *stats);
+static void count_wakeup_bytes(enum bhi360_fifo_type source, uint32_t bytes, struct bhi360_wakeup_stats *stats);
+static void end_wakeup(struct bhi360_wakeup_stats *stats);
 
 /*function to check the return values in parse_fifo function*/
 static inline int8_t check_return_value(int8_t result)
@@ -148,6 +177,10 @@ static int8_t bhi360_get_and_process_fifo_support(uint8_t *int_status,
             }
 
             fifo_temp->read_length += bytes_read;
+            if (dev->wakeup_stats != NULL)
+            {
+                count_wakeup_bytes(BHI360_FIFO_TYPE_WAKEUP, bytes_read, dev->wakeup_stats);
+            }
         }
 
         *rslt = parse_fifo(BHI360_FIFO_TYPE_WAKEUP, fifo_temp, dev);
@@ -159,6 +192,30 @@ static int8_t bhi360_get_and_process_fifo_support(uint8_t *int_status,
 }
 
 int8_t bhi360_get_and_process_fifo(uint8_t *work_buffer, uint32_t buffer_size, struct bhi360_dev *dev)
+{
+    int8_t rslt;
+    uint64_t start_us;
+
+    if (dev != NULL)
+    {
+        start_us = bhi360_hif_trace_begin(&dev->hif);
+        rslt = get_and_process_fifo(work_buffer, buffer_size, dev);
+        if (dev->wakeup_stats != NULL)
+        {
+            end_wakeup(dev->wakeup_stats);
+        }
+
+        bhi360_hif_trace_end(BHI360_TRACE_SERVICE, 0, start_us, 0, &dev->hif);
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+static int8_t get_and_process_fifo(uint8_t *work_buffer, uint32_t buffer_size, struct bhi360_dev *dev)
 {
     uint16_t int_status;
     uint8_t int_status_bak;
@@ -188,6 +245,11 @@ int8_t bhi360_get_and_process_fifo(uint8_t *work_buffer, uint32_t buffer_size, s
         return rslt;
     }
 
+    if (dev->wakeup_stats != NULL)
+    {
+        begin_wakeup(int_status_bak, dev->wakeup_stats);
+    }
+
     /* Get and process the Wake up FIFO */
     fifos.read_length = 0;
     int_status = int_status_bak;
@@ -223,6 +285,10 @@ int8_t bhi360_get_and_process_fifo(uint8_t *work_buffer, uint32_t buffer_size, s
             }
 
             fifos.read_length += bytes_read;
+            if (dev->wakeup_stats != NULL)
+            {
+                count_wakeup_bytes(BHI360_FIFO_TYPE_NON_WAKEUP, bytes_read, dev->wakeup_stats);
+            }
         }
 
         rslt = parse_fifo(BHI360_FIFO_TYPE_NON_WAKEUP, &fifos, dev);
@@ -406,6 +472,7 @@ int8_t bhi360_get_feature_status(uint8_t *feat_status, struct bhi360_dev *dev)
 int8_t bhi360_upload_firmware_to_ram(const uint8_t *firmware, uint32_t length, struct bhi360_dev *dev)
 {
     int8_t rslt = BHI360_OK;
+    uint16_t rom_version = 0;
 
     if ((dev == NULL) || (firmware == NULL))
     {
@@ -413,7 +480,23 @@ int8_t bhi360_upload_firmware_to_ram(const uint8_t *firmware, uint32_t length, s
     }
     else
     {
-        rslt = bhi360_hif_upload_firmware_to_ram(firmware, length, &dev->hif);
+        /* The ROM version never changes, so it is read on the first upload only */
+        if (dev->rom_version == 0)
+        {
+            rslt = bhi360_hif_get_rom_version(&rom_version, &dev->hif);
+            dev->rom_version = (rslt == BHI360_OK) ? rom_version : 0;
+        }
+
+        /* Reject a truncated or corrupt image before uploading it, instead of after the device verified it */
+        if (rslt == BHI360_OK)
+        {
+            rslt = bhi360_fw_verify(firmware, length, dev->rom_version, NULL);
+        }
+
+        if (rslt == BHI360_OK)
+        {
+            rslt = bhi360_hif_upload_firmware_to_ram(firmware, length, &dev->hif);
+        }
     }
 
     return rslt;
@@ -455,6 +538,112 @@ int8_t bhi360_boot_from_ram(struct bhi360_dev *dev)
     return rslt;
 }
 
+int8_t bhi360_set_time_source(bhi360_get_time_us_fptr_t get_time_us, struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev == NULL)
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bhi360_hif_set_time_source(get_time_us, &dev->hif);
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_get_boot_time(struct bhi360_boot_time *boot_time, const struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if ((dev == NULL) || (boot_time == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bhi360_hif_get_boot_time(boot_time, &dev->hif);
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_set_trace(bhi360_trace_fptr_t trace, void *trace_ref, uint32_t min_callback_us, struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev == NULL)
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bhi360_hif_set_trace(trace, trace_ref, min_callback_us, &dev->hif);
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_set_bus_stats(struct bhi360_bus_stats *bus_stats, struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev == NULL)
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bhi360_hif_set_bus_stats(bus_stats, &dev->hif);
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_reset_bus_stats(struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev == NULL)
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bhi360_hif_reset_bus_stats(&dev->hif);
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_check_fw_running(const uint8_t *firmware, uint32_t length, uint8_t *running, struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+    struct bhi360_fw_info info;
+
+    if ((dev == NULL) || (firmware == NULL) || (running == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        *running = 0;
+        rslt = bhi360_fw_parse(firmware, length, &info);
+        if (rslt == BHI360_OK)
+        {
+            rslt = bhi360_hif_check_fw_running(bhi360_fw_crc32(BHI360_FW_CRC_INIT, firmware, length),
+                                               info.section[0].version,
+                                               (info.n_sections > 1) ? info.section[info.n_sections - 1].version : 0,
+                                               running,
+                                               &dev->hif);
+        }
+    }
+
+    return rslt;
+}
+
 int8_t bhi360_set_host_interrupt_ctrl(uint8_t hintr_ctrl, struct bhi360_dev *dev)
 {
     int8_t rslt = BHI360_OK;
@@ -843,6 +1032,239 @@ int8_t bhi360_init(enum bhi360_intf intf,
     return rslt;
 }
 
+int8_t bhi360_set_fifo_stats(struct bhi360_fifo_stats *fifo_stats, struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev != NULL)
+    {
+        dev->fifo_stats = fifo_stats;
+        rslt = bhi360_reset_fifo_stats(dev);
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_reset_fifo_stats(struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev != NULL)
+    {
+        if (dev->fifo_stats != NULL)
+        {
+            memset(dev->fifo_stats, 0, sizeof(struct bhi360_fifo_stats));
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_set_latency_stats(const uint8_t *sensor_ids,
+                                uint8_t n_sensors,
+                                struct bhi360_latency_stats *latency_stats,
+                                struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if ((dev == NULL) || ((latency_stats != NULL) && (sensor_ids == NULL)))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else if (n_sensors > BHI360_LATENCY_MAX_SENSORS)
+    {
+        rslt = BHI360_E_INVALID_PARAM;
+    }
+    else
+    {
+        dev->latency_stats = latency_stats;
+        if (latency_stats != NULL)
+        {
+            memset(latency_stats, 0, sizeof(struct bhi360_latency_stats));
+            latency_stats->n_sensors = n_sensors;
+            for (uint8_t i = 0; i < n_sensors; i++)
+            {
+                latency_stats->hist[i].sensor_id = sensor_ids[i];
+            }
+        }
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_sync_latency_clock(struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+    uint64_t before_us, after_us, ts_ticks = 0;
+
+    if ((dev == NULL) || (dev->latency_stats == NULL) || (dev->hif.get_time_us == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        /* The device time is taken between the two host times */
+        before_us = dev->hif.get_time_us(dev->hif.intf_ptr);
+        rslt = bhi360_hif_req_and_get_hw_timestamp(&ts_ticks, &dev->hif);
+        after_us = dev->hif.get_time_us(dev->hif.intf_ptr);
+        if (rslt == BHI360_OK)
+        {
+            dev->latency_stats->offset_us = (int64_t)(before_us + ((after_us - before_us) / 2)) -
+                                            (int64_t)((ts_ticks * UINT64_C(15625)) / UINT64_C(1000));
+            dev->latency_stats->synced = 1;
+        }
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_get_latency_percentile(uint8_t sensor_id, float percentile, uint32_t *latency_us, struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_E_INVALID_PARAM;
+    const struct bhi360_latency_hist *hist;
+    uint64_t rank, seen = 0;
+    uint32_t hundredths;
+
+    if ((dev == NULL) || (dev->latency_stats == NULL) || (latency_us == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else if ((percentile >= 0.0f) && (percentile <= 100.0f))
+    {
+        for (uint8_t i = 0; i < dev->latency_stats->n_sensors; i++)
+        {
+            hist = &dev->latency_stats->hist[i];
+            if ((hist->sensor_id == sensor_id) && (hist->count != 0))
+            {
+                /* Nearest rank, the smallest latency with at least the percentile of the samples at or
+                 * below it. The percentile is taken in hundredths so the rank is exact in 64 bit */
+                hundredths = (uint32_t)((percentile * 100.0f) + 0.5f);
+                rank = (((uint64_t)hist->count * hundredths) + 9999U) / 10000U;
+                rank = (rank == 0) ? 1 : rank;
+                for (uint16_t j = 0; j < BHI360_LATENCY_N_BUCKETS; j++)
+                {
+                    seen += hist->bucket[j];
+                    if (seen >= rank)
+                    {
+                        *latency_us = latency_bucket_value(j);
+                        break;
+                    }
+                }
+
+                if (*latency_us > hist->max_us)
+                {
+                    *latency_us = hist->max_us;
+                }
+
+                rslt = BHI360_OK;
+                break;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_set_bsx_profile(struct bhi360_bsx_profile *bsx_profile,
+                               bhi360_bsx_profile_fptr_t callback,
+                               void *callback_ref,
+                               struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev != NULL)
+    {
+        dev->bsx_profile = bsx_profile;
+        if (bsx_profile != NULL)
+        {
+            memset(bsx_profile, 0, sizeof(struct bhi360_bsx_profile));
+            bsx_profile->callback = callback;
+            bsx_profile->callback_ref = callback_ref;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_set_callback_stats(struct bhi360_callback_stats *callback_stats,
+                                 uint32_t budget_us,
+                                 bhi360_callback_budget_fptr_t over_budget,
+                                 void *budget_ref,
+                                 struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev != NULL)
+    {
+        dev->callback_stats = callback_stats;
+        if (callback_stats != NULL)
+        {
+            memset(callback_stats, 0, sizeof(struct bhi360_callback_stats));
+            callback_stats->budget_us = budget_us;
+            callback_stats->over_budget = over_budget;
+            callback_stats->budget_ref = budget_ref;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_set_wakeup_stats(struct bhi360_wakeup_stats *wakeup_stats, struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev != NULL)
+    {
+        dev->wakeup_stats = wakeup_stats;
+        if (wakeup_stats != NULL)
+        {
+            memset(wakeup_stats, 0, sizeof(struct bhi360_wakeup_stats));
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_get_bytes_per_wakeup(float *bytes_per_wakeup, const struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if ((dev == NULL) || (dev->wakeup_stats == NULL) || (bytes_per_wakeup == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else if (dev->wakeup_stats->wakeups == 0)
+    {
+        rslt = BHI360_E_INVALID_PARAM;
+    }
+    else
+    {
+        *bytes_per_wakeup = (float)dev->wakeup_stats->bytes / (float)dev->wakeup_stats->wakeups;
+    }
+
+    return rslt;
+}
+
 int8_t bhi360_register_fifo_parse_callback(uint8_t sensor_id,
                                            bhi360_fifo_parse_callback_t callback,
                                            void *callback_ref,
@@ -1011,6 +1433,22 @@ int8_t bhi360_get_parameter(uint16_t param,
     return rslt;
 }
 
+int8_t bhi360_get_reg_snapshot(struct bhi360_reg_snapshot *snapshot, struct bhi360_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if ((dev == NULL) || (snapshot == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bhi360_hif_get_reg_snapshot(snapshot, &dev->hif);
+    }
+
+    return rslt;
+}
+
 int8_t bhi360_get_error_value(uint8_t *error_value, struct bhi360_dev *dev)
 {
     int8_t rslt = BHI360_OK;
@@ -1233,6 +1671,189 @@ static int8_t get_time_stamp(enum bhi360_fifo_type source, uint64_t **time_stamp
     return rslt;
 }
 
+static void count_fifo_frame(enum bhi360_fifo_type source,
+                             uint8_t sensor_id,
+                             uint32_t size,
+                             uint8_t callback_called,
+                             struct bhi360_fifo_stats *stats)
+{
+    struct bhi360_fifo_sensor_stats *sensor;
+
+    if ((stats != NULL) && (size != 0))
+    {
+        sensor = &stats->sensor[sensor_id];
+        sensor->events++;
+        sensor->bytes += size;
+        stats->bytes[source] += size;
+        switch (sensor_id)
+        {
+            case BHI360_SYS_ID_FILLER:
+            case BHI360_SYS_ID_PADDING:
+                stats->padding_bytes[source] += size;
+                break;
+            case BHI360_SYS_ID_TS_SMALL_DELTA_WU:
+            case BHI360_SYS_ID_TS_SMALL_DELTA:
+            case BHI360_SYS_ID_TS_LARGE_DELTA:
+            case BHI360_SYS_ID_TS_LARGE_DELTA_WU:
+            case BHI360_SYS_ID_TS_FULL:
+            case BHI360_SYS_ID_TS_FULL_WU:
+                stats->timestamp_bytes[source] += size;
+                break;
+            case BHI360_SYS_ID_BHI360_LOG_DOSTEP:
+                break;
+            default:
+                stats->events[source]++;
+                if (callback_called)
+                {
+                    sensor->callbacks++;
+                }
+                else
+                {
+                    sensor->dropped++;
+                }
+
+                break;
+        }
+    }
+}
+
+static uint16_t latency_bucket(uint32_t latency_us)
+{
+    uint16_t bucket = (uint16_t)latency_us;
+    uint8_t shift = 0;
+
+    if (latency_us >= (UINT32_C(1) << BHI360_LATENCY_MAX_BITS))
+    {
+        latency_us = (UINT32_C(1) << BHI360_LATENCY_MAX_BITS) - 1;
+    }
+
+    if (latency_us >= (UINT32_C(1) << BHI360_LATENCY_SUB_BUCKET_BITS))
+    {
+        while ((latency_us >> (shift + BHI360_LATENCY_SUB_BUCKET_BITS + 1)) != 0)
+        {
+            shift++;
+        }
+
+        bucket = (uint16_t)(((shift + 1) << BHI360_LATENCY_SUB_BUCKET_BITS) +
+                            ((latency_us >> shift) - (UINT32_C(1) << BHI360_LATENCY_SUB_BUCKET_BITS)));
+    }
+
+    return bucket;
+}
+
+static uint32_t latency_bucket_value(uint16_t bucket)
+{
+    uint32_t value = bucket;
+    uint8_t shift;
+    uint32_t sub;
+
+    /* Middle of the bucket */
+    if (bucket >= (1 << BHI360_LATENCY_SUB_BUCKET_BITS))
+    {
+        shift = (uint8_t)((bucket >> BHI360_LATENCY_SUB_BUCKET_BITS) - 1);
+        sub = bucket & ((1 << BHI360_LATENCY_SUB_BUCKET_BITS) - 1);
+        value = ((sub + (UINT32_C(1) << BHI360_LATENCY_SUB_BUCKET_BITS)) << shift) + ((UINT32_C(1) << shift) >> 1);
+    }
+
+    return value;
+}
+
+static void record_latency(uint8_t sensor_id, uint64_t time_stamp, struct bhi360_dev *dev)
+{
+    struct bhi360_latency_stats *stats = dev->latency_stats;
+    struct bhi360_latency_hist *hist;
+    int64_t latency_us;
+
+    for (uint8_t i = 0; (i < stats->n_sensors) && stats->synced && (dev->hif.get_time_us != NULL); i++)
+    {
+        hist = &stats->hist[i];
+        if (hist->sensor_id == sensor_id)
+        {
+            /* Timestamps are in 15.625 us ticks. A negative latency is clock drift, counted as 0 */
+            latency_us = (int64_t)dev->hif.get_time_us(dev->hif.intf_ptr) -
+                         ((int64_t)((time_stamp * UINT64_C(15625)) / UINT64_C(1000)) + stats->offset_us);
+            if (latency_us < 0)
+            {
+                latency_us = 0;
+            }
+            else if (latency_us > (int64_t)UINT32_MAX)
+            {
+                latency_us = (int64_t)UINT32_MAX;
+            }
+
+            hist->bucket[latency_bucket((uint32_t)latency_us)]++;
+            hist->count++;
+            if ((uint32_t)latency_us > hist->max_us)
+            {
+                hist->max_us = (uint32_t)latency_us;
+            }
+
+            break;
+        }
+    }
+}
+
+static void profile_bsx(enum bhi360_bsx_profile_type type,
+                        const uint8_t *log,
+                        uint64_t time_stamp,
+                        struct bhi360_bsx_profile *profile)
+{
+    struct bhi360_bsx_profile_event event;
+
+    event.time_stamp = time_stamp;
+    event.duration_us = 0;
+    event.type = type;
+    event.log = (type == BHI360_BSX_PROFILE_LOG_DOSTEP) ? log : NULL;
+
+    profile->count[type]++;
+    if ((type == BHI360_BSX_PROFILE_DO_STEPS_MAIN) || (type == BHI360_BSX_PROFILE_DO_STEPS_CALIB))
+    {
+        profile->last_step = time_stamp;
+        profile->step_pending = 1;
+    }
+    else if ((type == BHI360_BSX_PROFILE_GET_OUTPUT_SIGNAL) && profile->step_pending)
+    {
+        /* Ticks of 15.625 us */
+        event.duration_us = (uint32_t)(((time_stamp - profile->last_step) * UINT64_C(15625)) / UINT64_C(1000));
+        profile->step_pending = 0;
+        profile->n_durations++;
+        profile->total_duration_us += event.duration_us;
+        if (event.duration_us > profile->max_duration_us)
+        {
+            profile->max_duration_us = event.duration_us;
+        }
+    }
+
+    if (profile->callback != NULL)
+    {
+        profile->callback(&event, profile->callback_ref);
+    }
+}
+
+static void profile_bsx_meta_event(uint8_t sensor_id,
+                                   const uint8_t *payload,
+                                   uint64_t time_stamp,
+                                   struct bhi360_dev *dev)
+{
+    if ((sensor_id == BHI360_SYS_ID_META_EVENT) || (sensor_id == BHI360_SYS_ID_META_EVENT_WU))
+    {
+        switch (payload[0])
+        {
+            case BHI360_META_EVENT_BSX_DO_STEPS_MAIN:
+                profile_bsx(BHI360_BSX_PROFILE_DO_STEPS_MAIN, NULL, time_stamp, dev->bsx_profile);
+                break;
+            case BHI360_META_EVENT_BSX_DO_STEPS_CALIB:
+                profile_bsx(BHI360_BSX_PROFILE_DO_STEPS_CALIB, NULL, time_stamp, dev->bsx_profile);
+                break;
+            case BHI360_META_EVENT_BSX_GET_OUTPUT_SIGNAL:
+                profile_bsx(BHI360_BSX_PROFILE_GET_OUTPUT_SIGNAL, NULL, time_stamp, dev->bsx_profile);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 static int8_t parse_fifo_support(struct bhi360_fifo_buffer *fifo_buf)
 {
     uint8_t i;
@@ -1257,20 +1878,110 @@ static int8_t parse_fifo_support(struct bhi360_fifo_buffer *fifo_buf)
     return BHI360_OK;
 }
 
+static void call_callback(const struct bhi360_fifo_parse_callback_table *info,
+                          const struct bhi360_fifo_parse_data_info *data_info,
+                          struct bhi360_dev *dev)
+{
+    struct bhi360_callback_stats *stats = dev->callback_stats;
+    struct bhi360_callback_time *sensor;
+    uint64_t trace_start_us = bhi360_hif_trace_begin(&dev->hif);
+    uint64_t start_us = 0;
+    uint32_t duration_us;
+
+    if ((stats != NULL) && (dev->hif.get_time_us != NULL))
+    {
+        start_us = dev->hif.get_time_us(dev->hif.intf_ptr);
+    }
+
+    info->callback(data_info, info->callback_ref);
+
+    if ((stats != NULL) && (dev->hif.get_time_us != NULL))
+    {
+        duration_us = (uint32_t)(dev->hif.get_time_us(dev->hif.intf_ptr) - start_us);
+        sensor = &stats->sensor[data_info->sensor_id];
+        sensor->calls++;
+        sensor->total_us += duration_us;
+        if (duration_us > sensor->max_us)
+        {
+            sensor->max_us = duration_us;
+        }
+
+        if ((stats->budget_us != 0) && (duration_us > stats->budget_us))
+        {
+            sensor->over_budget++;
+            if (stats->over_budget != NULL)
+            {
+                stats->over_budget(data_info->sensor_id, duration_us, stats->budget_ref);
+            }
+        }
+    }
+
+    bhi360_hif_trace_end(BHI360_TRACE_CALLBACK,
+                         (uint8_t)data_info->fifo_type,
+                         trace_start_us,
+                         data_info->sensor_id,
+                         &dev->hif);
+}
+
+static uint8_t process_event(enum bhi360_fifo_type source,
+                             uint8_t *event,
+                             uint64_t *time_stamp,
+                             const struct bhi360_fifo_parse_callback_table *info,
+                             struct bhi360_dev *dev)
+{
+    struct bhi360_fifo_parse_data_info data_info;
+    uint8_t sensor_id = event[0];
+    uint8_t callback_called = 0;
+
+    if (dev->bsx_profile != NULL)
+    {
+        profile_bsx_meta_event(sensor_id, &event[1], *time_stamp, dev);
+    }
+
+    if ((dev->wakeup_stats != NULL) &&
+        ((sensor_id == BHI360_SYS_ID_META_EVENT) || (sensor_id == BHI360_SYS_ID_META_EVENT_WU)) &&
+        (event[1] == BHI360_META_TRANSFER_CAUSE))
+    {
+        dev->wakeup_stats->cause_sensor[event[2]]++;
+    }
+
+    if (info->callback != NULL)
+    {
+        /* The payload starts after the sensor id */
+        data_info.data_ptr = &event[1];
+        data_info.fifo_type = source;
+        data_info.time_stamp = time_stamp;
+        data_info.sensor_id = sensor_id;
+        data_info.data_size = dev->event_size[sensor_id];
+        if (dev->latency_stats != NULL)
+        {
+            record_latency(sensor_id, *time_stamp, dev);
+        }
+
+        call_callback(info, &data_info, dev);
+        callback_called = 1;
+    }
+
+    return callback_called;
+}
+
 static int8_t parse_fifo(enum bhi360_fifo_type source, struct bhi360_fifo_buffer *fifo_p, struct bhi360_dev *dev)
 {
     uint8_t tmp_sensor_id = 0;
     int8_t rslt = BHI360_OK;
     uint32_t tmp_read_pos;
-    struct bhi360_fifo_parse_data_info data_info;
     uint64_t *time_stamp;
     struct bhi360_fifo_parse_callback_table info = { 0 };
     buffer_status_t status = BHI360_BUFFER_STATUS_OK;
+    uint8_t callback_called;
+    uint64_t start_us = bhi360_hif_trace_begin(&dev->hif);
+    uint32_t start_pos = fifo_p->read_pos;
 
     for (; (fifo_p->read_pos < fifo_p->read_length) && (status == BHI360_BUFFER_STATUS_OK);)
     {
         tmp_read_pos = fifo_p->read_pos;
         tmp_sensor_id = fifo_p->buffer[tmp_read_pos];
+        callback_called = 0;
 
         rslt = get_time_stamp(source, &time_stamp, dev);
         rslt = check_return_value(rslt);
@@ -1314,6 +2025,14 @@ static int8_t parse_fifo(enum bhi360_fifo_type source, struct bhi360_fifo_buffer
                     break;
                 }
 
+                if (dev->bsx_profile != NULL)
+                {
+                    profile_bsx(BHI360_BSX_PROFILE_LOG_DOSTEP,
+                                &fifo_p->buffer[tmp_read_pos + 1],
+                                *time_stamp,
+                                dev->bsx_profile);
+                }
+
                 fifo_p->read_pos += 23;
 
                 break;
@@ -1343,20 +2062,18 @@ static int8_t parse_fifo(enum bhi360_fifo_type source, struct bhi360_fifo_buffer
                     break;
                 }
 
-                if (info.callback != NULL)
-                {
-                    /* Read position is incremented by 1 to exclude sensor id */
-                    data_info.data_ptr = &fifo_p->buffer[tmp_read_pos + 1];
-                    data_info.fifo_type = source;
-                    data_info.time_stamp = time_stamp;
-                    data_info.sensor_id = tmp_sensor_id;
-                    data_info.data_size = dev->event_size[tmp_sensor_id];
-                    info.callback(&data_info, info.callback_ref);
-                }
+                callback_called = process_event(source, &fifo_p->buffer[tmp_read_pos], time_stamp, &info, dev);
 
                 fifo_p->read_pos += dev->event_size[tmp_sensor_id];
                 break;
         }
+
+        count_fifo_frame(source, tmp_sensor_id, fifo_p->read_pos - tmp_read_pos, callback_called, dev->fifo_stats);
+    }
+
+    if (fifo_p->read_pos != start_pos)
+    {
+        bhi360_hif_trace_end(BHI360_TRACE_PARSE, source, start_us, fifo_p->read_pos - start_pos, &dev->hif);
     }
 
     rslt = parse_fifo_support(fifo_p);
@@ -1413,15 +2130,18 @@ static int8_t parse_status_fifo(struct bhi360_fifo_buffer *fifo_p, struct bhi360
     uint8_t tmp_sensor_id = 0;
     int8_t rslt = BHI360_OK;
     uint32_t tmp_read_pos;
-    struct bhi360_fifo_parse_data_info data_info;
     uint64_t *time_stamp;
     struct bhi360_fifo_parse_callback_table info = { 0 };
     buffer_status_t status = BHI360_BUFFER_STATUS_OK;
+    uint8_t callback_called;
+    uint64_t start_us = bhi360_hif_trace_begin(&dev->hif);
+    uint32_t start_pos = fifo_p->read_pos;
 
     for (; (fifo_p->read_pos < fifo_p->read_length) && (status == BHI360_BUFFER_STATUS_OK);)
     {
         tmp_read_pos = fifo_p->read_pos;
         tmp_sensor_id = fifo_p->buffer[tmp_read_pos];
+        callback_called = 0;
 
         rslt = get_time_stamp(BHI360_FIFO_TYPE_STATUS, &time_stamp, dev);
         rslt = check_return_value(rslt);
@@ -1465,6 +2185,14 @@ static int8_t parse_status_fifo(struct bhi360_fifo_buffer *fifo_p, struct bhi360
                     break;
                 }
 
+                if (dev->bsx_profile != NULL)
+                {
+                    profile_bsx(BHI360_BSX_PROFILE_LOG_DOSTEP,
+                                &fifo_p->buffer[tmp_read_pos + 1],
+                                *time_stamp,
+                                dev->bsx_profile);
+                }
+
                 fifo_p->read_pos += BHI360_LOG_DOSTEP_RD_FIFO_SIZE;
 
                 break;
@@ -1493,20 +2221,30 @@ static int8_t parse_status_fifo(struct bhi360_fifo_buffer *fifo_p, struct bhi360
                     break;
                 }
 
-                if (info.callback != NULL)
-                {
-                    /* Read position is incremented by 1 to exclude sensor id */
-                    data_info.data_ptr = &fifo_p->buffer[tmp_read_pos + 1];
-                    data_info.fifo_type = BHI360_FIFO_TYPE_STATUS;
-                    data_info.time_stamp = time_stamp;
-                    data_info.sensor_id = tmp_sensor_id;
-                    data_info.data_size = dev->event_size[tmp_sensor_id];
-                    info.callback(&data_info, info.callback_ref);
-                }
+                callback_called = process_event(BHI360_FIFO_TYPE_STATUS,
+                                                &fifo_p->buffer[tmp_read_pos],
+                                                time_stamp,
+                                                &info,
+                                                dev);
 
                 fifo_p->read_pos += dev->event_size[tmp_sensor_id];
                 break;
         }
+
+        count_fifo_frame(BHI360_FIFO_TYPE_STATUS,
+                         tmp_sensor_id,
+                         fifo_p->read_pos - tmp_read_pos,
+                         callback_called,
+                         dev->fifo_stats);
+    }
+
+    if (fifo_p->read_pos != start_pos)
+    {
+        bhi360_hif_trace_end(BHI360_TRACE_PARSE,
+                             BHI360_FIFO_TYPE_STATUS,
+                             start_us,
+                             fifo_p->read_pos - start_pos,
+                             &dev->hif);
     }
 
     rslt = parse_fifo_support(fifo_p);
@@ -1540,6 +2278,10 @@ static int8_t process_status_fifo(int8_t rslt,
             }
 
             fifo_p->read_length += bytes_read;
+            if (dev->wakeup_stats != NULL)
+            {
+                count_wakeup_bytes(BHI360_FIFO_TYPE_STATUS, bytes_read, dev->wakeup_stats);
+            }
         }
         else if ((BHI360_IS_INT_STATUS(int_status_back)) == BHI360_IST_MASK_STATUS)
         {
@@ -1553,6 +2295,10 @@ static int8_t process_status_fifo(int8_t rslt,
             }
 
             fifo_p->read_length += bytes_read;
+            if (dev->wakeup_stats != NULL)
+            {
+                count_wakeup_bytes(BHI360_FIFO_TYPE_STATUS, bytes_read, dev->wakeup_stats);
+            }
         }
 
         ret_val = parse_status_fifo(fifo_p, dev);
@@ -1561,3 +2307,54 @@ static int8_t process_status_fifo(int8_t rslt,
 
     return ret_val;
 }
+
+static void begin_wakeup(uint8_t int_status, struct bhi360_wakeup_stats *stats)
+{
+    stats->cycle_bytes = 0;
+    stats->cycle_pending = (int_status != 0);
+    if (stats->cycle_pending)
+    {
+        stats->wakeups++;
+
+        /* The data ready, latency and watermark codes of the FIFO bits follow enum bhi360_transfer_cause */
+        stats->cause[BHI360_FIFO_TYPE_WAKEUP][BHI360_IS_INT_FIFO_W(int_status) >> 1]++;
+        stats->cause[BHI360_FIFO_TYPE_NON_WAKEUP][BHI360_IS_INT_FIFO_NW(int_status) >> 3]++;
+        if (BHI360_IS_INT_STATUS(int_status) || BHI360_IS_INT_ASYNC_STATUS(int_status))
+        {
+            stats->cause[BHI360_FIFO_TYPE_STATUS][BHI360_TRANSFER_CAUSE_DATA_READY]++;
+        }
+        else
+        {
+            stats->cause[BHI360_FIFO_TYPE_STATUS][BHI360_TRANSFER_CAUSE_NONE]++;
+        }
+    }
+    else
+    {
+        stats->idle_calls++;
+    }
+}
+
+static void count_wakeup_bytes(enum bhi360_fifo_type source, uint32_t bytes, struct bhi360_wakeup_stats *stats)
+{
+    stats->bytes += bytes;
+    stats->fifo_bytes[source] += bytes;
+    stats->cycle_bytes += bytes;
+}
+
+static void end_wakeup(struct bhi360_wakeup_stats *stats)
+{
+    if (stats->cycle_pending)
+    {
+        if (stats->cycle_bytes == 0)
+        {
+            stats->empty_wakeups++;
+        }
+
+        if (stats->cycle_bytes > stats->max_bytes)
+        {
+            stats->max_bytes = stats->cycle_bytes;
+        }
+
+        stats->cycle_pending = 0;
+    }
+}
@@ -211,7 +211,8 @@ int8_t bhi360_flush_fifo(uint8_t sensor_id, struct bhi360_dev *dev);
 int8_t bhi360_set_fifo_format_ctrl(uint8_t param, struct bhi360_dev *dev);
 
 /**
- * @brief Function to upload firmware to RAM
+ * @brief Function to upload firmware to RAM. A truncated or corrupt image, or one built for
+ *        another ROM version, is rejected before the upload starts
  * @param[in] firmware  : Reference to the data buffer containing the firmware
  * @param[in] length    : Size of the firmware
  * @param[in] dev       : Device reference
@@ -241,6 +242,67 @@ int8_t bhi360_upload_firmware_to_ram_partly(const uint8_t *firmware,
  */
 int8_t bhi360_boot_from_ram(struct bhi360_dev *dev);
 
+/**
+ * @brief Function to set the host time source used for the boot time measurement
+ * @param[in] get_time_us : Function returning a monotonic time in microseconds. NULL to disable
+ * @param[in] dev         : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_set_time_source(bhi360_get_time_us_fptr_t get_time_us, struct bhi360_dev *dev);
+
+/**
+ * @brief Function to get the time spent in the last upload, verification and boot.
+ *        Without a time source, the upload time is not measured and the verification
+ *        and boot times are the accumulated polling delays
+ * @param[out] boot_time : Reference to the boot time breakdown
+ * @param[in] dev        : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_get_boot_time(struct bhi360_boot_time *boot_time, const struct bhi360_dev *dev);
+
+/**
+ * @brief Function to set a callback receiving the driver activity as timed spans: the FIFO
+ *        service, FIFO reads, parsing, slow callbacks and waits for the status FIFO and boot.
+ *        Span times need a time source, see bhi360_set_time_source
+ * @param[in] trace           : Trace callback, NULL to stop tracing
+ * @param[in] trace_ref       : Reference passed to the callback
+ * @param[in] min_callback_us : Callbacks faster than this are not reported
+ * @param[in] dev             : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_set_trace(bhi360_trace_fptr_t trace, void *trace_ref, uint32_t min_callback_us, struct bhi360_dev *dev);
+
+/**
+ * @brief Function to collect statistics of every register read and write: counts and bytes
+ *        per register, counts, bytes and latency histograms per register class (FIFO, status,
+ *        command and other, see enum bhi360_bus_class) and optionally a trace of the last transfers.
+ *        Latencies need a time source, see bhi360_set_time_source. The statistics are reset
+ * @param[in] bus_stats : Reference to the statistics, NULL to stop collecting them.
+ *                        Set trace and trace_len before to keep a trace
+ * @param[in] dev       : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_set_bus_stats(struct bhi360_bus_stats *bus_stats, struct bhi360_dev *dev);
+
+/**
+ * @brief Function to reset the bus statistics, keeping the trace buffer
+ * @param[in] dev : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_reset_bus_stats(struct bhi360_dev *dev);
+
+/**
+ * @brief Function to check if a firmware image is already running from RAM, for example after
+ *        a restart of only the host. If it is, bhi360_upload_firmware_to_ram and
+ *        bhi360_boot_from_ram can be skipped
+ * @param[in] firmware : Reference to the firmware image
+ * @param[in] length   : Length of the firmware image
+ * @param[out] running : 1 if the image is running, 0 if it has to be uploaded
+ * @param[in] dev      : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_check_fw_running(const uint8_t *firmware, uint32_t length, uint8_t *running, struct bhi360_dev *dev);
+
 /**
  * @brief Function to set the host interrupt control register
  * @param[in] hintr_ctrl    : Host interrupt control configuration
@@ -364,6 +426,106 @@ int8_t bhi360_get_post_mortem_data(uint8_t *post_mortem,
                                    uint32_t *actual_len,
                                    struct bhi360_dev *dev);
 
+/**
+ * @brief Function to collect FIFO parser statistics: events, bytes, callbacks and events without
+ *        a callback per sensor ID, and event, byte, timestamp and padding totals per FIFO.
+ *        The statistics are reset
+ * @param[in] fifo_stats : Reference to the statistics, NULL to stop collecting them
+ * @param[in] dev        : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_set_fifo_stats(struct bhi360_fifo_stats *fifo_stats, struct bhi360_dev *dev);
+
+/**
+ * @brief Function to reset the FIFO parser statistics
+ * @param[in] dev : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_reset_fifo_stats(struct bhi360_dev *dev);
+
+/**
+ * @brief Function to measure the latency from the device timestamp of a sample to the call of its
+ *        callback, for up to BHI360_LATENCY_MAX_SENSORS sensors. Needs a time source, see
+ *        bhi360_set_time_source, and bhi360_sync_latency_clock. The statistics are reset
+ * @param[in] sensor_ids    : Sensor IDs to measure
+ * @param[in] n_sensors     : Number of sensor IDs
+ * @param[in] latency_stats : Reference to the statistics, NULL to stop measuring
+ * @param[in] dev           : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_set_latency_stats(const uint8_t *sensor_ids,
+                                uint8_t n_sensors,
+                                struct bhi360_latency_stats *latency_stats,
+                                struct bhi360_dev *dev);
+
+/**
+ * @brief Function to relate the device time to the host time through the hardware timestamp.
+ *        Call it before measuring latencies and periodically after, as the clocks drift
+ * @param[in] dev : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_sync_latency_clock(struct bhi360_dev *dev);
+
+/**
+ * @brief Function to get a percentile of the latency of a sensor, for example 50, 99 or 99.9
+ * @param[in] sensor_id   : Sensor ID
+ * @param[in] percentile  : Percentile, from 0 to 100 in steps of 0.01
+ * @param[out] latency_us : Latency in microseconds, within the width of its histogram bucket
+ * @param[in] dev         : Device reference
+ * @return API error codes, BHI360_E_INVALID_PARAM if the sensor is not measured or has no samples
+ */
+int8_t bhi360_get_latency_percentile(uint8_t sensor_id, float percentile, uint32_t *latency_us, struct bhi360_dev *dev);
+
+/**
+ * @brief Function to profile the BSX fusion on the device. The do-step and output signal meta events
+ *        and the do-step log frames are counted, timed and passed to the callback. The meta events
+ *        must be enabled, they still reach a callback registered for the meta event IDs
+ * @param[in] bsx_profile  : Reference to the profile, reset here. NULL to stop profiling
+ * @param[in] callback     : Callback for each profiled event, can be NULL
+ * @param[in] callback_ref : Reference passed to the callback
+ * @param[in] dev          : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_set_bsx_profile(struct bhi360_bsx_profile *bsx_profile,
+                               bhi360_bsx_profile_fptr_t callback,
+                               void *callback_ref,
+                               struct bhi360_dev *dev);
+
+/**
+ * @brief Function to time the FIFO parse callbacks with the time source. Calls, total and maximum
+ *        time are kept per sensor ID. A callback that takes longer than the budget is reported to
+ *        over_budget, called from within the FIFO parsing after the callback returned
+ * @param[in] callback_stats : Reference to the statistics, reset here. NULL to stop timing
+ * @param[in] budget_us      : Time budget of a callback in microseconds, 0 for no budget
+ * @param[in] over_budget    : Function called for a callback over budget, can be NULL
+ * @param[in] budget_ref     : Reference passed to over_budget
+ * @param[in] dev            : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_set_callback_stats(struct bhi360_callback_stats *callback_stats,
+                                 uint32_t budget_us,
+                                 bhi360_callback_budget_fptr_t over_budget,
+                                 void *budget_ref,
+                                 struct bhi360_dev *dev);
+
+/**
+ * @brief Function to count the host wake-ups, the bytes drained by each and their transfer causes
+ *        from the interrupt status and the transfer cause meta events
+ * @param[in] wakeup_stats : Reference to the statistics, reset here. NULL to stop counting
+ * @param[in] dev          : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_set_wakeup_stats(struct bhi360_wakeup_stats *wakeup_stats, struct bhi360_dev *dev);
+
+/**
+ * @brief Function to get the mean number of bytes drained per host wake-up. A larger FIFO
+ *        watermark or latency drains more bytes in fewer wake-ups
+ * @param[out] bytes_per_wakeup : Mean bytes per wake-up
+ * @param[in] dev               : Device reference
+ * @return API error codes, BHI360_E_INVALID_PARAM if there was no wake-up yet
+ */
+int8_t bhi360_get_bytes_per_wakeup(float *bytes_per_wakeup, const struct bhi360_dev *dev);
+
 /**
  * @brief Function to link a callback and relevant reference when the sensor event is available in the FIFO
  * @param[in] sensor_id     : Sensor ID of the virtual sensor
@@ -436,6 +598,16 @@ int8_t bhi360_get_parameter(uint16_t param,
  */
 int8_t bhi360_get_error_value(uint8_t *error_value, struct bhi360_dev *dev);
 
+/**
+ * @brief Function to get the product, revision and chip IDs, the ROM, kernel and user versions,
+ *        the feature, boot and interrupt status and the error registers in one transfer,
+ *        instead of one per register
+ * @param[out] snapshot : Reference to the decoded registers
+ * @param[in] dev       : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_get_reg_snapshot(struct bhi360_reg_snapshot *snapshot, struct bhi360_dev *dev);
+
 /**
  * @brief Function to directly communicate with the sensor
  * @param[in] conf          : The configuration of the transfer
@@ -110,6 +110,19 @@ const SensorAPIEntry bhi360_sensor_api_entry[] = {
     { "bhy_logbin_add_meta", (void *)bhi360_logbin_add_meta },
     { "bhy_logbin_end_meta", (void *)bhi360_logbin_end_meta },
     { "bhy_logbin_add_data", (void *)bhi360_logbin_add_data },
+    { "bhy_logbin_set_buffer", (void *)bhi360_logbin_set_buffer },
+    { "bhy_logbin_flush", (void *)bhi360_logbin_flush },
+    { "bhy_logbin_set_flush_callback", (void *)bhi360_logbin_set_flush_callback },
+    { "bhy_logbin_start_async", (void *)bhi360_logbin_start_async },
+    { "bhy_logbin_stop_async", (void *)bhi360_logbin_stop_async },
+    { "bhy_logbin_set_format", (void *)bhi360_logbin_set_format },
+    { "bhy_logbin_end_data", (void *)bhi360_logbin_end_data },
+    { "bhy_logbin_release", (void *)bhi360_logbin_release },
+    { "bhy_logbin_set_codec", (void *)bhi360_logbin_set_codec },
+    { "bhy_logbin_set_rotation", (void *)bhi360_logbin_set_rotation },
+    { "bhy_logbin_set_ring", (void *)bhi360_logbin_set_ring },
+    { "bhy_logbin_set_sync", (void *)bhi360_logbin_set_sync },
+    { "bhy_logbin_set_summary", (void *)bhi360_logbin_set_summary },
     { "bhy_multi_tap_param_set_config", (void *)bhi360_multi_tap_param_set_config },
     { "bhy_multi_tap_param_get_config", (void *)bhi360_multi_tap_param_get_config },
     { "bhy_multi_tap_param_detector_set_config", (void *)bhi360_multi_tap_param_detector_set_config },
@@ -235,9 +248,10 @@ const SensorAPIEntry bhi360_sensor_api_entry[] = {
     { "bhy_parse_wrist_gesture_detect", (void *)bhi360_parse_wrist_gesture_detect },
     { "bhy_parse_air_quality", (void *)bhi360_parse_air_quality }, { "bhy_parse_hmc", (void *)bhi360_parse_hmc },
     { "bhy_parse_oc", (void *)bhi360_parse_oc }, { "bhy_parse_ec", (void *)bhi360_parse_ec },
-    { "bhy_set_downsampling_flag", (void *)bhi360_set_downsampling_flag },
-    { "bhy_get_downsampling_flag", (void *)bhi360_get_downsampling_flag },
-    { "bhy_set_downsampling_odr", (void *)bhi360_set_downsampling_odr },
+    { "bhy_parse_set_downsampling_flag", (void *)bhi360_parse_set_downsampling_flag },
+    { "bhy_parse_get_downsampling_flag", (void *)bhi360_parse_get_downsampling_flag },
+    { "bhy_parse_set_downsampling_odr", (void *)bhi360_parse_set_downsampling_odr },
+    { "bhy_parse_flush", (void *)bhi360_parse_flush },
     { "bhy_parse_temperature_celsius", (void *)bhi360_parse_temperature_celsius },
     { "bhy_parse_humidity", (void *)bhi360_parse_humidity }, { "bhy_parse_pressure", (void *)bhi360_parse_pressure },
     { "bhy_parse_altitude", (void *)bhi360_parse_altitude }, { "end of list", NULL }
@@ -0,0 +1,395 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_binstream.c
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#include <string.h>
+
+#include "bhi360_binstream.h"
+
+/* CRC-8 with the polynomial 0x07, 4 bits at a time */
+static const uint8_t crc8_table[16] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+
+/* CRC-16/CCITT, 4 bits at a time */
+static const uint16_t crc16_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/**
+* @brief Function to compute the CRC-8 of an event frame
+* @param[in] data   : Data
+* @param[in] length : Length of the data
+* @return CRC
+*/
+static uint8_t crc8(const uint8_t *data, uint16_t length)
+{
+    uint8_t crc = BINSTREAM_CRC8_INIT;
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        crc = (uint8_t)((crc << 4) ^ crc8_table[((crc >> 4) ^ (data[i] >> 4)) & 0x0F]);
+        crc = (uint8_t)((crc << 4) ^ crc8_table[((crc >> 4) ^ data[i]) & 0x0F]);
+    }
+
+    return crc;
+}
+
+/**
+* @brief Function to compute the CRC-16/CCITT of a sync frame
+* @param[in] data   : Data
+* @param[in] length : Length of the data
+* @return CRC
+*/
+static uint16_t crc16(const uint8_t *data, uint16_t length)
+{
+    uint16_t crc = BINSTREAM_CRC16_INIT;
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        crc = (uint16_t)((crc << 4) ^ crc16_table[((crc >> 12) ^ (data[i] >> 4)) & 0x0F]);
+        crc = (uint16_t)((crc << 4) ^ crc16_table[((crc >> 12) ^ data[i]) & 0x0F]);
+    }
+
+    return crc;
+}
+
+/**
+* @brief Function to write a sync frame
+* @param[in] time_stamp : Timestamp, base of the following deltas
+* @param[in] enc        : Encoder instance
+*/
+static void write_sync(uint64_t time_stamp, struct bhi360_binstream_enc *enc)
+{
+    uint8_t frame[BINSTREAM_SYNC_SIZE];
+    uint16_t crc;
+
+    frame[0] = BINSTREAM_SYNC_ID;
+    frame[1] = BINSTREAM_SYNC_MAGIC_0;
+    frame[2] = BINSTREAM_SYNC_MAGIC_1;
+    for (uint8_t i = 0; i < BINSTREAM_TIME_SIZE; i++)
+    {
+        frame[3 + i] = (uint8_t)(time_stamp >> (8 * i));
+    }
+
+    frame[3 + BINSTREAM_TIME_SIZE] = (uint8_t)(enc->frames & 0xFF);
+    frame[4 + BINSTREAM_TIME_SIZE] = (uint8_t)(enc->frames >> 8);
+    crc = crc16(&frame[3], BINSTREAM_TIME_SIZE + 2);
+    frame[5 + BINSTREAM_TIME_SIZE] = (uint8_t)(crc & 0xFF);
+    frame[6 + BINSTREAM_TIME_SIZE] = (uint8_t)(crc >> 8);
+
+    enc->write(frame, BINSTREAM_SYNC_SIZE, enc->write_ref);
+
+    enc->last_time_stamp = time_stamp;
+    enc->frames = 0;
+    enc->sync_due = 0;
+}
+
+/**
+* @brief Function to initialize a binary stream encoder
+* @param[in] write     : Function called with each encoded frame
+* @param[in] write_ref : Reference passed to write
+* @param[in] enc       : Encoder instance
+*/
+void bhi360_binstream_init(bhi360_binstream_write_fptr_t write, void *write_ref, struct bhi360_binstream_enc *enc)
+{
+    if (enc)
+    {
+        memset(enc, 0, sizeof(struct bhi360_binstream_enc));
+        enc->write = write;
+        enc->write_ref = write_ref;
+        enc->sync_due = 1;
+    }
+}
+
+/**
+* @brief Function to encode an event, preceded by a sync frame when one is due
+* @param[in] sensor_id    : Sensor ID
+* @param[in] time_stamp   : Timestamp in ticks of 15.625 us
+* @param[in] payload_size : Payload size
+* @param[in] payload      : Event payload
+* @param[in] enc          : Encoder instance
+*/
+void bhi360_binstream_add_event(uint8_t sensor_id,
+                                uint64_t time_stamp,
+                                uint8_t payload_size,
+                                const uint8_t *payload,
+                                struct bhi360_binstream_enc *enc)
+{
+    uint8_t frame[BINSTREAM_MAX_FRAME_SIZE];
+    uint16_t size = 2;
+    uint64_t delta;
+
+    if (enc && enc->write && (payload || (payload_size == 0)))
+    {
+        /* Deltas are unsigned, a timestamp going back starts a new base */
+        if (enc->sync_due || (enc->frames >= BINSTREAM_SYNC_INTERVAL) || (time_stamp < enc->last_time_stamp))
+        {
+            write_sync(time_stamp, enc);
+        }
+
+        delta = time_stamp - enc->last_time_stamp;
+        frame[1] = sensor_id;
+        do
+        {
+            frame[size] = (uint8_t)(delta & 0x7F);
+            delta >>= 7;
+            if (delta != 0)
+            {
+                frame[size] |= 0x80;
+            }
+
+            size++;
+        } while (delta != 0);
+
+        if ((size + payload_size + 1) <= BINSTREAM_MAX_FRAME_SIZE)
+        {
+            memcpy(&frame[size], payload, payload_size);
+            size += payload_size;
+            frame[0] = (uint8_t)size;
+            frame[size] = crc8(frame, size);
+            size++;
+
+            enc->write(frame, size, enc->write_ref);
+
+            enc->frames++;
+            enc->last_time_stamp = time_stamp;
+        }
+    }
+}
+
+/**
+* @brief Function to encode a text frame, such as an error message
+* @param[in] text   : Text, not null terminated
+* @param[in] length : Length of the text, cut to BINSTREAM_MAX_TEXT_SIZE
+* @param[in] enc    : Encoder instance
+*/
+void bhi360_binstream_add_text(const char *text, uint16_t length, struct bhi360_binstream_enc *enc)
+{
+    if (enc && text)
+    {
+        /* A delta of 0 keeps the frame at the time of the last event */
+        bhi360_binstream_add_event(BINSTREAM_TEXT_ID,
+                                   enc->last_time_stamp,
+                                   (uint8_t)((length < BINSTREAM_MAX_TEXT_SIZE) ? length : BINSTREAM_MAX_TEXT_SIZE),
+                                   (const uint8_t *)text,
+                                   enc);
+    }
+}
+
+/**
+* @brief Function to send a sync frame before the next event
+* @param[in] enc : Encoder instance
+*/
+void bhi360_binstream_sync(struct bhi360_binstream_enc *enc)
+{
+    if (enc)
+    {
+        enc->sync_due = 1;
+    }
+}
+
+/**
+* @brief Function to initialize a binary stream decoder. Decoding starts at the first sync frame
+* @param[in] event     : Function called with each decoded event
+* @param[in] event_ref : Reference passed to event
+* @param[in] dec       : Decoder instance
+*/
+void bhi360_binstream_dec_init(bhi360_binstream_event_fptr_t event, void *event_ref, struct bhi360_binstream_dec *dec)
+{
+    if (dec)
+    {
+        memset(dec, 0, sizeof(struct bhi360_binstream_dec));
+        dec->event = event;
+        dec->event_ref = event_ref;
+    }
+}
+
+/**
+* @brief Function to handle a complete sync frame
+* @param[in] dec : Decoder instance
+* @return 1 if the frame is valid, 0 otherwise
+*/
+static uint8_t decode_sync(struct bhi360_binstream_dec *dec)
+{
+    uint16_t frames = (uint16_t)(dec->frame[3 + BINSTREAM_TIME_SIZE] | (dec->frame[4 + BINSTREAM_TIME_SIZE] << 8));
+    uint16_t crc = (uint16_t)(dec->frame[5 + BINSTREAM_TIME_SIZE] | (dec->frame[6 + BINSTREAM_TIME_SIZE] << 8));
+
+    if (crc16(&dec->frame[3], BINSTREAM_TIME_SIZE + 2) != crc)
+    {
+        dec->crc_errors++;
+
+        return 0;
+    }
+
+    /* Without the frames before the first sync, its count cannot be checked */
+    if (dec->synced && (frames != dec->frames))
+    {
+        dec->count_errors++;
+    }
+
+    dec->last_time_stamp = 0;
+    for (uint8_t i = 0; i < BINSTREAM_TIME_SIZE; i++)
+    {
+        dec->last_time_stamp |= (uint64_t)dec->frame[3 + i] << (8 * i);
+    }
+
+    dec->synced = 1;
+    dec->frames = 0;
+    dec->syncs++;
+
+    return 1;
+}
+
+/**
+* @brief Function to handle a complete event frame. The event is delivered only once the CRC of
+*        the frame matches
+* @param[in] dec : Decoder instance
+* @return 1 if the frame is valid, 0 otherwise
+*/
+static uint8_t decode_event(struct bhi360_binstream_dec *dec)
+{
+    uint64_t delta = 0;
+    uint16_t end = (uint16_t)(dec->size - 1);
+    uint16_t pos = 2;
+    uint8_t shift = 0;
+    uint8_t valid = 0;
+
+    if (crc8(dec->frame, end) != dec->frame[end])
+    {
+        dec->crc_errors++;
+
+        return 0;
+    }
+
+    while ((pos < end) && (shift < 64))
+    {
+        delta |= (uint64_t)(dec->frame[pos] & 0x7F) << shift;
+        shift += 7;
+        if ((dec->frame[pos++] & 0x80) == 0)
+        {
+            valid = 1;
+            break;
+        }
+    }
+
+    if (valid)
+    {
+        dec->last_time_stamp += delta;
+        dec->frames++;
+        dec->events++;
+        if (dec->event)
+        {
+            dec->event(dec->frame[1], dec->last_time_stamp, &dec->frame[pos], (uint8_t)(end - pos), dec->event_ref);
+        }
+    }
+
+    return valid;
+}
+
+/**
+* @brief Function to decode a part of a binary stream. The data can be split anywhere
+* @param[in] data   : Stream data
+* @param[in] length : Length of the data
+* @param[in] dec    : Decoder instance
+*/
+void bhi360_binstream_decode(const uint8_t *data, size_t length, struct bhi360_binstream_dec *dec)
+{
+    static const uint8_t sync_start[3] = { BINSTREAM_SYNC_ID, BINSTREAM_SYNC_MAGIC_0, BINSTREAM_SYNC_MAGIC_1 };
+    uint8_t byte;
+    uint8_t valid;
+
+    if (!dec || !data)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        byte = data[i];
+
+        if ((dec->pos != 0) && (dec->frame[0] == BINSTREAM_SYNC_ID) && (dec->pos < sizeof(sync_start)) &&
+            (byte != sync_start[dec->pos]))
+        {
+            /* Not a sync frame, search again from this byte */
+            dec->skipped_bytes += dec->pos;
+            dec->synced = 0;
+            dec->pos = 0;
+        }
+
+        if (dec->pos == 0)
+        {
+            if (byte == BINSTREAM_SYNC_ID)
+            {
+                dec->size = BINSTREAM_SYNC_SIZE;
+            }
+            else if (dec->synced && (byte >= BINSTREAM_MIN_EVENT_LENGTH))
+            {
+                dec->size = (uint16_t)(byte + 1);
+            }
+            else
+            {
+                /* While not synced, only a sync frame is accepted */
+                dec->skipped_bytes++;
+                dec->synced = 0;
+                continue;
+            }
+        }
+
+        dec->frame[dec->pos++] = byte;
+        if (dec->pos == dec->size)
+        {
+            dec->pos = 0;
+            if (dec->frame[0] == BINSTREAM_SYNC_ID)
+            {
+                valid = decode_sync(dec);
+            }
+            else
+            {
+                valid = decode_event(dec);
+            }
+
+            if (!valid)
+            {
+                /* Nothing after a broken frame can be trusted until the next sync */
+                dec->skipped_bytes += dec->size;
+                dec->synced = 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,177 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_binstream.h
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#ifndef _BHI360_BINSTREAM_H_
+#define _BHI360_BINSTREAM_H_
+
+/* Start of CPP Guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Binary event stream, a compact alternative to the hex text stream.
+ *
+ * Event frame : length (1), sensor ID (1), timestamp delta (varint), payload, CRC (1)
+ *               The length counts the bytes after it and is at least 3. The delta is in device
+ *               ticks of 15.625 us from the previous frame, 7 bits per byte, least significant first.
+ *               The CRC-8 (polynomial 0x07) covers the frame up to the CRC, and an event is only
+ *               delivered by the decoder once it matches
+ * Sync frame  : 0x00, 0xA5, 0x5A, timestamp (8), frames (2), CRC (2)
+ *               Sent before the first event and every BINSTREAM_SYNC_INTERVAL events. The
+ *               timestamp is the full 64-bit base of the following deltas, frames is the number of
+ *               event frames since the previous sync, and the CRC-16/CCITT covers the timestamp and
+ *               frames fields. Multi-byte fields are little endian
+ * Text frame  : Event frame with sensor ID BINSTREAM_TEXT_ID, which the FIFO uses for padding
+ *               only, and a delta of 0. The payload is a message such as an error
+ *
+ * Meta events are sent as event frames like any other sensor ID, and other text output is turned
+ * off while the stream is active so it cannot break the framing.
+ */
+#define BINSTREAM_SYNC_ID           UINT8_C(0x00)
+#define BINSTREAM_SYNC_MAGIC_0      UINT8_C(0xA5)
+#define BINSTREAM_SYNC_MAGIC_1      UINT8_C(0x5A)
+#define BINSTREAM_SYNC_SIZE         UINT8_C(15)
+#define BINSTREAM_TIME_SIZE         UINT8_C(8)
+#define BINSTREAM_MIN_EVENT_LENGTH  UINT8_C(3)
+#define BINSTREAM_CRC8_INIT         UINT8_C(0x00)
+#define BINSTREAM_CRC16_INIT        UINT16_C(0xFFFF)
+#define BINSTREAM_MAX_FRAME_SIZE    UINT16_C(256)
+#define BINSTREAM_TEXT_ID           UINT8_C(0x00)
+#define BINSTREAM_MAX_TEXT_SIZE     UINT16_C(BINSTREAM_MAX_FRAME_SIZE - 4)
+
+#ifndef BINSTREAM_SYNC_INTERVAL
+#define BINSTREAM_SYNC_INTERVAL     UINT16_C(64)
+#endif
+
+typedef void (*bhi360_binstream_write_fptr_t)(const uint8_t *data, uint16_t length, void *write_ref);
+
+typedef void (*bhi360_binstream_event_fptr_t)(uint8_t sensor_id,
+                                              uint64_t time_stamp,
+                                              const uint8_t *payload,
+                                              uint8_t payload_size,
+                                              void *event_ref);
+
+struct bhi360_binstream_enc
+{
+    bhi360_binstream_write_fptr_t write;
+    void *write_ref;
+    uint64_t last_time_stamp;
+    uint16_t frames;
+    uint8_t sync_due;
+};
+
+struct bhi360_binstream_dec
+{
+    bhi360_binstream_event_fptr_t event;
+    void *event_ref;
+    uint8_t frame[BINSTREAM_MAX_FRAME_SIZE];
+    uint16_t pos;
+    uint16_t size;
+    uint8_t synced;
+    uint64_t last_time_stamp;
+    uint16_t frames;
+
+    uint32_t events;
+    uint32_t syncs;
+    uint32_t crc_errors; /**< Frames dropped because their CRC did not match */
+    uint32_t count_errors; /**< Sync frames whose frame count did not match the frames before */
+    uint32_t skipped_bytes; /**< Bytes dropped while searching for a sync frame */
+};
+
+/**
+* @brief Function to initialize a binary stream encoder
+* @param[in] write     : Function called with each encoded frame
+* @param[in] write_ref : Reference passed to write
+* @param[in] enc       : Encoder instance
+*/
+void bhi360_binstream_init(bhi360_binstream_write_fptr_t write, void *write_ref, struct bhi360_binstream_enc *enc);
+
+/**
+* @brief Function to encode an event, preceded by a sync frame when one is due
+* @param[in] sensor_id    : Sensor ID
+* @param[in] time_stamp   : Timestamp in ticks of 15.625 us
+* @param[in] payload_size : Payload size
+* @param[in] payload      : Event payload
+* @param[in] enc          : Encoder instance
+*/
+void bhi360_binstream_add_event(uint8_t sensor_id,
+                                uint64_t time_stamp,
+                                uint8_t payload_size,
+                                const uint8_t *payload,
+                                struct bhi360_binstream_enc *enc);
+
+/**
+* @brief Function to encode a text frame, such as an error message
+* @param[in] text   : Text, not null terminated
+* @param[in] length : Length of the text, cut to BINSTREAM_MAX_TEXT_SIZE
+* @param[in] enc    : Encoder instance
+*/
+void bhi360_binstream_add_text(const char *text, uint16_t length, struct bhi360_binstream_enc *enc);
+
+/**
+* @brief Function to send a sync frame before the next event
+* @param[in] enc : Encoder instance
+*/
+void bhi360_binstream_sync(struct bhi360_binstream_enc *enc);
+
+/**
+* @brief Function to initialize a binary stream decoder. Decoding starts at the first sync frame
+* @param[in] event     : Function called with each decoded event
+* @param[in] event_ref : Reference passed to event
+* @param[in] dec       : Decoder instance
+*/
+void bhi360_binstream_dec_init(bhi360_binstream_event_fptr_t event, void *event_ref, struct bhi360_binstream_dec *dec);
+
+/**
+* @brief Function to decode a part of a binary stream. The data can be split anywhere
+* @param[in] data   : Stream data
+* @param[in] length : Length of the data
+* @param[in] dec    : Decoder instance
+*/
+void bhi360_binstream_decode(const uint8_t *data, size_t length, struct bhi360_binstream_dec *dec);
+
+/* End of CPP Guard */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* _BHI360_BINSTREAM_H_ */
@@ -212,6 +212,9 @@ extern "C" {
 #define BHI360_E_INVALID_EVENT_SIZE                                    INT8_C(-8)
 #define BHI360_E_PARAM_NOT_SET                                         INT8_C(-9)
 #define BHI360_E_INSUFFICIENT_MAX_SIMUL_SENSORS                        INT8_C(-10)
+#define BHI360_E_FW_FORMAT                                             INT8_C(-11)
+#define BHI360_E_CRC                                                   INT8_C(-12)
+#define BHI360_E_FW_VERSION                                            INT8_C(-13)
 
 #ifndef BHI360_COMMAND_PACKET_LEN
 #define BHI360_COMMAND_PACKET_LEN                                      UINT16_C(256)
@@ -258,6 +261,9 @@ extern "C" {
 #define BHI360_REG_GP_6                                                UINT8_C(0x36)
 #define BHI360_REG_GP_7                                                UINT8_C(0x3A)
 
+/*! Identity and status registers read by bhi360_get_reg_snapshot */
+#define BHI360_REG_SNAPSHOT_LEN                                        (BHI360_REG_ERROR_AUX - BHI360_REG_PRODUCT_ID + 1)
+
 /*! Command packets */
 #define BHI360_CMD_REQ_POST_MORTEM_DATA                                UINT16_C(0x0001)
 #define BHI360_CMD_UPLOAD_TO_PROGRAM_RAM                               UINT16_C(0x0002)
@@ -323,6 +329,17 @@ extern "C" {
 #define BHI360_BST_HOST_FW_IDLE                                        UINT8_C(0x80)
 #define BHI360_BST_CHECK_RETRY                                         UINT8_C(100)
 
+/*! Boot status polling. The interval starts short and doubles up to the maximum, within the total timeout */
+#define BHI360_BST_CHECK_TIMEOUT_US                                    UINT32_C(5000000)
+
+#ifndef BHI360_BST_CHECK_INIT_DELAY_US
+#define BHI360_BST_CHECK_INIT_DELAY_US                                 UINT32_C(1000)
+#endif
+
+#ifndef BHI360_BST_CHECK_MAX_DELAY_US
+#define BHI360_BST_CHECK_MAX_DELAY_US                                  UINT32_C(50000)
+#endif
+
 /*! Host status */
 #define BHI360_HST_POWER_STATE                                         UINT8_C(0x01)
 #define BHI360_HST_HOST_PROTOCOL                                       UINT8_C(0x02)
@@ -763,22 +780,142 @@ typedef BHI360_INTF_RET_TYPE (*bhi360_read_fptr_t)(uint8_t reg_addr, uint8_t *re
 typedef BHI360_INTF_RET_TYPE (*bhi360_write_fptr_t)(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length,
                                                     void *intf_ptr);
 typedef void (*bhi360_delay_us_fptr_t)(uint32_t period_us, void *intf_ptr);
+typedef uint64_t (*bhi360_get_time_us_fptr_t)(void *intf_ptr);
 
 enum bhi360_intf {
     BHI360_SPI_INTERFACE = 1,
     BHI360_I2C_INTERFACE
 };
 
+/* Time spent in the last firmware upload and boot, in microseconds */
+struct bhi360_boot_time
+{
+    uint32_t upload_us; /**< Transfer of the image to program RAM. 0 without a time source */
+    uint32_t verify_us; /**< Waiting for the image verification */
+    uint32_t boot_us; /**< Boot command until the host interface is ready */
+    uint16_t verify_polls; /**< Boot status reads during verification */
+    uint16_t boot_polls; /**< Boot status reads during boot */
+};
+
+/*! Registers with their own bus statistics, from address 0 */
+#ifndef BHI360_BUS_STATS_N_REGS
+#define BHI360_BUS_STATS_N_REGS                                        UINT8_C(64)
+#endif
+
+/*! Latency histogram bins. Bin n counts transfers of 2^(n-1) to 2^n - 1 us, the last bin all longer ones */
+#ifndef BHI360_BUS_STATS_N_BINS
+#define BHI360_BUS_STATS_N_BINS                                        UINT8_C(16)
+#endif
+
+struct bhi360_bus_reg_stats
+{
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t read_bytes;
+    uint32_t write_bytes;
+};
+
+/* Registers grouped by use, each with its own counts and latencies */
+enum bhi360_bus_class {
+    BHI360_BUS_CLASS_FIFO, /**< Wake-up, non-wake-up and status FIFO channels */
+    BHI360_BUS_CLASS_STATUS, /**< Host status, identity, boot, interrupt, error and debug registers */
+    BHI360_BUS_CLASS_COMMAND, /**< Command channel, for commands, parameters and uploads */
+    BHI360_BUS_CLASS_OTHER, /**< Control and general purpose registers */
+    BHI360_BUS_CLASS_MAX
+};
+
+struct bhi360_bus_class_stats
+{
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t read_bytes;
+    uint32_t write_bytes;
+    uint64_t read_us;
+    uint64_t write_us;
+    uint32_t read_hist[BHI360_BUS_STATS_N_BINS];
+    uint32_t write_hist[BHI360_BUS_STATS_N_BINS];
+};
+
+struct bhi360_bus_trace_entry
+{
+    uint64_t time_us; /**< Start of the transfer */
+    uint32_t length;
+    uint32_t duration_us;
+    uint8_t reg;
+    uint8_t write; /**< 1 for a write, 0 for a read */
+    int8_t rslt;
+};
+
+/* Statistics of the transport calls, with an optional trace of the last transfers.
+ * Latencies need a time source and are 0 without one */
+struct bhi360_bus_stats
+{
+    struct bhi360_bus_reg_stats reg[BHI360_BUS_STATS_N_REGS];
+    struct bhi360_bus_class_stats reg_class[BHI360_BUS_CLASS_MAX]; /**< Indexed by enum bhi360_bus_class */
+    uint32_t errors;
+
+    /*! Ring buffer of trace_len entries, can be NULL. trace_count is the number of transfers traced */
+    struct bhi360_bus_trace_entry *trace;
+    uint16_t trace_len;
+    uint16_t trace_pos;
+    uint32_t trace_count;
+};
+
+/* Driver activity reported to the trace callback */
+enum bhi360_trace_type {
+    BHI360_TRACE_SERVICE, /**< bhi360_get_and_process_fifo */
+    BHI360_TRACE_FIFO_READ, /**< Read of a FIFO, arg is the number of bytes */
+    BHI360_TRACE_PARSE, /**< Parsing of a FIFO, arg is the number of bytes */
+    BHI360_TRACE_CALLBACK, /**< Callback slower than the threshold, arg is the sensor ID */
+    BHI360_TRACE_WAIT_STATUS, /**< Waiting for the status FIFO, arg is the number of polls */
+    BHI360_TRACE_BOOT_POLL, /**< Waiting for the verification or boot, arg is the number of polls */
+    BHI360_TRACE_TYPE_MAX
+};
+
+struct bhi360_trace_event
+{
+    uint64_t start_us;
+    uint32_t duration_us;
+    uint32_t arg;
+    enum bhi360_trace_type type;
+    uint8_t fifo_type; /**< enum bhi360_fifo_type of FIFO reads, parses and callbacks */
+};
+
+typedef void (*bhi360_trace_fptr_t)(const struct bhi360_trace_event *event, void *trace_ref);
+
+/* Identity and status registers, read in one transfer */
+struct bhi360_reg_snapshot
+{
+    uint64_t host_intr_time; /**< Timestamp of the last host interrupt, in ticks */
+    uint16_t rom_version;
+    uint16_t kernel_version; /**< 0 until a firmware is running */
+    uint16_t user_version;
+    uint8_t product_id;
+    uint8_t revision_id;
+    uint8_t feature_status;
+    uint8_t boot_status;
+    uint8_t chip_id;
+    uint8_t int_status;
+    uint8_t error_value;
+    uint8_t error_aux;
+};
+
 /* HIF device structure */
 struct bhi360_hif_dev
 {
     bhi360_read_fptr_t read;
     bhi360_write_fptr_t write;
     bhi360_delay_us_fptr_t delay_us;
+    bhi360_get_time_us_fptr_t get_time_us;
     enum bhi360_intf intf;
     void *intf_ptr;
     BHI360_INTF_RET_TYPE intf_rslt;
     uint32_t read_write_len;
+    struct bhi360_boot_time boot_time;
+    struct bhi360_bus_stats *bus_stats;
+    bhi360_trace_fptr_t trace;
+    void *trace_ref;
+    uint32_t trace_min_callback_us;
 };
 
 enum bhi360_fifo_type {
@@ -807,6 +944,140 @@ struct BHI360_PACKED bhi360_fifo_parse_callback_table
     void *callback_ref;
 };
 
+struct bhi360_fifo_sensor_stats
+{
+    uint32_t events;
+    uint32_t bytes; /**< Including the sensor ID */
+    uint32_t callbacks;
+    uint32_t dropped; /**< Events without a registered callback */
+};
+
+/* FIFO parser statistics, indexed by sensor ID. Timestamp, padding and other
+ * system frames are counted under their system IDs as well */
+struct bhi360_fifo_stats
+{
+    struct bhi360_fifo_sensor_stats sensor[BHI360_N_VIRTUAL_SENSOR_MAX];
+    uint32_t events[BHI360_FIFO_TYPE_MAX];
+    uint32_t bytes[BHI360_FIFO_TYPE_MAX];
+    uint32_t timestamp_bytes[BHI360_FIFO_TYPE_MAX];
+    uint32_t padding_bytes[BHI360_FIFO_TYPE_MAX];
+};
+
+/*! Sensors with a latency histogram */
+#ifndef BHI360_LATENCY_MAX_SENSORS
+#define BHI360_LATENCY_MAX_SENSORS                                     UINT8_C(4)
+#endif
+
+/*
+ * Latency histograms are log bucketed as in HdrHistogram. Latencies below
+ * 2^BHI360_LATENCY_SUB_BUCKET_BITS us have a bucket each, every further power of 2
+ * is split in 2^BHI360_LATENCY_SUB_BUCKET_BITS buckets, up to 2^BHI360_LATENCY_MAX_BITS us.
+ * With 3 bits, a bucket is at most 12.5 % wide
+ */
+#define BHI360_LATENCY_SUB_BUCKET_BITS                                 UINT8_C(3)
+#define BHI360_LATENCY_MAX_BITS                                        UINT8_C(24)
+#define BHI360_LATENCY_N_BUCKETS \
+    ((BHI360_LATENCY_MAX_BITS - BHI360_LATENCY_SUB_BUCKET_BITS + 1) << BHI360_LATENCY_SUB_BUCKET_BITS)
+
+struct bhi360_latency_hist
+{
+    uint8_t sensor_id;
+    uint32_t count;
+    uint32_t max_us;
+    uint32_t bucket[BHI360_LATENCY_N_BUCKETS];
+};
+
+/* Delay from the device timestamp of a sample to its callback, per sensor */
+struct bhi360_latency_stats
+{
+    int64_t offset_us; /**< Host time minus device time, set by bhi360_sync_latency_clock */
+    uint8_t synced;
+    uint8_t n_sensors;
+    struct bhi360_latency_hist hist[BHI360_LATENCY_MAX_SENSORS];
+};
+
+/* On-chip BSX activity, decoded from the do-step meta events and log frames */
+enum bhi360_bsx_profile_type {
+    BHI360_BSX_PROFILE_DO_STEPS_MAIN,
+    BHI360_BSX_PROFILE_DO_STEPS_CALIB,
+    BHI360_BSX_PROFILE_GET_OUTPUT_SIGNAL,
+    BHI360_BSX_PROFILE_LOG_DOSTEP,
+    BHI360_BSX_PROFILE_TYPE_MAX
+};
+
+struct bhi360_bsx_profile_event
+{
+    uint64_t time_stamp; /**< Device time in ticks of 15.625 us */
+    uint32_t duration_us; /**< For output signals, time since the last do-step, 0 otherwise */
+    enum bhi360_bsx_profile_type type;
+    const uint8_t *log; /**< Payload of log frames, BHI360_LOG_DOSTEP_RD_FIFO_SIZE - 1 bytes */
+};
+
+typedef void (*bhi360_bsx_profile_fptr_t)(const struct bhi360_bsx_profile_event *event, void *callback_ref);
+
+struct bhi360_bsx_profile
+{
+    uint32_t count[BHI360_BSX_PROFILE_TYPE_MAX];
+    uint64_t last_step;
+    uint8_t step_pending;
+
+    /*! Do-step durations, from a do-step to the following output signal */
+    uint32_t n_durations;
+    uint32_t max_duration_us;
+    uint64_t total_duration_us;
+
+    bhi360_bsx_profile_fptr_t callback;
+    void *callback_ref;
+};
+
+struct bhi360_callback_time
+{
+    uint32_t calls;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t over_budget; /**< Calls that took longer than the budget */
+};
+
+typedef void (*bhi360_callback_budget_fptr_t)(uint8_t sensor_id, uint32_t duration_us, void *budget_ref);
+
+/* Time spent in the FIFO parse callbacks, indexed by sensor ID */
+struct bhi360_callback_stats
+{
+    struct bhi360_callback_time sensor[BHI360_N_VIRTUAL_SENSOR_MAX];
+    uint32_t budget_us; /**< 0 for no budget */
+    bhi360_callback_budget_fptr_t over_budget;
+    void *budget_ref;
+};
+
+/* Cause of a FIFO transfer, as in the FIFO bits of the interrupt status */
+enum bhi360_transfer_cause {
+    BHI360_TRANSFER_CAUSE_NONE,
+    BHI360_TRANSFER_CAUSE_DATA_READY,
+    BHI360_TRANSFER_CAUSE_LATENCY,
+    BHI360_TRANSFER_CAUSE_WATERMARK,
+    BHI360_TRANSFER_CAUSE_MAX
+};
+
+/* Host wake-ups, one per call to bhi360_get_and_process_fifo with an interrupt pending */
+struct bhi360_wakeup_stats
+{
+    uint32_t wakeups;
+    uint32_t idle_calls; /**< Calls without an interrupt pending */
+    uint32_t empty_wakeups; /**< Wake-ups that drained no bytes */
+    uint32_t max_bytes; /**< Most bytes drained in one wake-up */
+    uint64_t bytes; /**< Bytes drained from all FIFOs */
+    uint64_t fifo_bytes[BHI360_FIFO_TYPE_MAX];
+
+    /*! Wake-ups by the cause of each FIFO. The status FIFO counts as data ready */
+    uint32_t cause[BHI360_FIFO_TYPE_MAX][BHI360_TRANSFER_CAUSE_MAX];
+
+    /*! Transfer cause meta events, by the ID of the sensor that caused the transfer */
+    uint32_t cause_sensor[BHI360_N_VIRTUAL_SENSOR_MAX];
+
+    uint32_t cycle_bytes;
+    uint8_t cycle_pending;
+};
+
 /* Device structure */
 struct bhi360_dev
 {
@@ -816,6 +1087,12 @@ struct bhi360_dev
     uint64_t last_time_stamp[BHI360_FIFO_TYPE_MAX];
     uint8_t present_buff[32];
     uint8_t phy_present_buff[8];
+    struct bhi360_fifo_stats *fifo_stats;
+    struct bhi360_latency_stats *latency_stats;
+    struct bhi360_bsx_profile *bsx_profile;
+    struct bhi360_callback_stats *callback_stats;
+    struct bhi360_wakeup_stats *wakeup_stats;
+    uint16_t rom_version; /**< Read on the first firmware upload, 0 until then */
 };
 
 struct bhi360_fifo_buffer
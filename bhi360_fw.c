@@ -0,0 +1,220 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_fw.c
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#include "bhi360_fw.h"
+
+/*! CRC-32/MPEG-2 lookup table, polynomial 0x04C11DB7 */
+static const uint32_t bhi360_fw_crc_table[256] = {
+    UINT32_C(0x00000000), UINT32_C(0x04C11DB7), UINT32_C(0x09823B6E), UINT32_C(0x0D4326D9), UINT32_C(0x130476DC),
+    UINT32_C(0x17C56B6B), UINT32_C(0x1A864DB2), UINT32_C(0x1E475005), UINT32_C(0x2608EDB8), UINT32_C(0x22C9F00F),
+    UINT32_C(0x2F8AD6D6), UINT32_C(0x2B4BCB61), UINT32_C(0x350C9B64), UINT32_C(0x31CD86D3), UINT32_C(0x3C8EA00A),
+    UINT32_C(0x384FBDBD), UINT32_C(0x4C11DB70), UINT32_C(0x48D0C6C7), UINT32_C(0x4593E01E), UINT32_C(0x4152FDA9),
+    UINT32_C(0x5F15ADAC), UINT32_C(0x5BD4B01B), UINT32_C(0x569796C2), UINT32_C(0x52568B75), UINT32_C(0x6A1936C8),
+    UINT32_C(0x6ED82B7F), UINT32_C(0x639B0DA6), UINT32_C(0x675A1011), UINT32_C(0x791D4014), UINT32_C(0x7DDC5DA3),
+    UINT32_C(0x709F7B7A), UINT32_C(0x745E66CD), UINT32_C(0x9823B6E0), UINT32_C(0x9CE2AB57), UINT32_C(0x91A18D8E),
+    UINT32_C(0x95609039), UINT32_C(0x8B27C03C), UINT32_C(0x8FE6DD8B), UINT32_C(0x82A5FB52), UINT32_C(0x8664E6E5),
+    UINT32_C(0xBE2B5B58), UINT32_C(0xBAEA46EF), UINT32_C(0xB7A96036), UINT32_C(0xB3687D81), UINT32_C(0xAD2F2D84),
+    UINT32_C(0xA9EE3033), UINT32_C(0xA4AD16EA), UINT32_C(0xA06C0B5D), UINT32_C(0xD4326D90), UINT32_C(0xD0F37027),
+    UINT32_C(0xDDB056FE), UINT32_C(0xD9714B49), UINT32_C(0xC7361B4C), UINT32_C(0xC3F706FB), UINT32_C(0xCEB42022),
+    UINT32_C(0xCA753D95), UINT32_C(0xF23A8028), UINT32_C(0xF6FB9D9F), UINT32_C(0xFBB8BB46), UINT32_C(0xFF79A6F1),
+    UINT32_C(0xE13EF6F4), UINT32_C(0xE5FFEB43), UINT32_C(0xE8BCCD9A), UINT32_C(0xEC7DD02D), UINT32_C(0x34867077),
+    UINT32_C(0x30476DC0), UINT32_C(0x3D044B19), UINT32_C(0x39C556AE), UINT32_C(0x278206AB), UINT32_C(0x23431B1C),
+    UINT32_C(0x2E003DC5), UINT32_C(0x2AC12072), UINT32_C(0x128E9DCF), UINT32_C(0x164F8078), UINT32_C(0x1B0CA6A1),
+    UINT32_C(0x1FCDBB16), UINT32_C(0x018AEB13), UINT32_C(0x054BF6A4), UINT32_C(0x0808D07D), UINT32_C(0x0CC9CDCA),
+    UINT32_C(0x7897AB07), UINT32_C(0x7C56B6B0), UINT32_C(0x71159069), UINT32_C(0x75D48DDE), UINT32_C(0x6B93DDDB),
+    UINT32_C(0x6F52C06C), UINT32_C(0x6211E6B5), UINT32_C(0x66D0FB02), UINT32_C(0x5E9F46BF), UINT32_C(0x5A5E5B08),
+    UINT32_C(0x571D7DD1), UINT32_C(0x53DC6066), UINT32_C(0x4D9B3063), UINT32_C(0x495A2DD4), UINT32_C(0x44190B0D),
+    UINT32_C(0x40D816BA), UINT32_C(0xACA5C697), UINT32_C(0xA864DB20), UINT32_C(0xA527FDF9), UINT32_C(0xA1E6E04E),
+    UINT32_C(0xBFA1B04B), UINT32_C(0xBB60ADFC), UINT32_C(0xB6238B25), UINT32_C(0xB2E29692), UINT32_C(0x8AAD2B2F),
+    UINT32_C(0x8E6C3698), UINT32_C(0x832F1041), UINT32_C(0x87EE0DF6), UINT32_C(0x99A95DF3), UINT32_C(0x9D684044),
+    UINT32_C(0x902B669D), UINT32_C(0x94EA7B2A), UINT32_C(0xE0B41DE7), UINT32_C(0xE4750050), UINT32_C(0xE9362689),
+    UINT32_C(0xEDF73B3E), UINT32_C(0xF3B06B3B), UINT32_C(0xF771768C), UINT32_C(0xFA325055), UINT32_C(0xFEF34DE2),
+    UINT32_C(0xC6BCF05F), UINT32_C(0xC27DEDE8), UINT32_C(0xCF3ECB31), UINT32_C(0xCBFFD686), UINT32_C(0xD5B88683),
+    UINT32_C(0xD1799B34), UINT32_C(0xDC3ABDED), UINT32_C(0xD8FBA05A), UINT32_C(0x690CE0EE), UINT32_C(0x6DCDFD59),
+    UINT32_C(0x608EDB80), UINT32_C(0x644FC637), UINT32_C(0x7A089632), UINT32_C(0x7EC98B85), UINT32_C(0x738AAD5C),
+    UINT32_C(0x774BB0EB), UINT32_C(0x4F040D56), UINT32_C(0x4BC510E1), UINT32_C(0x46863638), UINT32_C(0x42472B8F),
+    UINT32_C(0x5C007B8A), UINT32_C(0x58C1663D), UINT32_C(0x558240E4), UINT32_C(0x51435D53), UINT32_C(0x251D3B9E),
+    UINT32_C(0x21DC2629), UINT32_C(0x2C9F00F0), UINT32_C(0x285E1D47), UINT32_C(0x36194D42), UINT32_C(0x32D850F5),
+    UINT32_C(0x3F9B762C), UINT32_C(0x3B5A6B9B), UINT32_C(0x0315D626), UINT32_C(0x07D4CB91), UINT32_C(0x0A97ED48),
+    UINT32_C(0x0E56F0FF), UINT32_C(0x1011A0FA), UINT32_C(0x14D0BD4D), UINT32_C(0x19939B94), UINT32_C(0x1D528623),
+    UINT32_C(0xF12F560E), UINT32_C(0xF5EE4BB9), UINT32_C(0xF8AD6D60), UINT32_C(0xFC6C70D7), UINT32_C(0xE22B20D2),
+    UINT32_C(0xE6EA3D65), UINT32_C(0xEBA91BBC), UINT32_C(0xEF68060B), UINT32_C(0xD727BBB6), UINT32_C(0xD3E6A601),
+    UINT32_C(0xDEA580D8), UINT32_C(0xDA649D6F), UINT32_C(0xC423CD6A), UINT32_C(0xC0E2D0DD), UINT32_C(0xCDA1F604),
+    UINT32_C(0xC960EBB3), UINT32_C(0xBD3E8D7E), UINT32_C(0xB9FF90C9), UINT32_C(0xB4BCB610), UINT32_C(0xB07DABA7),
+    UINT32_C(0xAE3AFBA2), UINT32_C(0xAAFBE615), UINT32_C(0xA7B8C0CC), UINT32_C(0xA379DD7B), UINT32_C(0x9B3660C6),
+    UINT32_C(0x9FF77D71), UINT32_C(0x92B45BA8), UINT32_C(0x9675461F), UINT32_C(0x8832161A), UINT32_C(0x8CF30BAD),
+    UINT32_C(0x81B02D74), UINT32_C(0x857130C3), UINT32_C(0x5D8A9099), UINT32_C(0x594B8D2E), UINT32_C(0x5408ABF7),
+    UINT32_C(0x50C9B640), UINT32_C(0x4E8EE645), UINT32_C(0x4A4FFBF2), UINT32_C(0x470CDD2B), UINT32_C(0x43CDC09C),
+    UINT32_C(0x7B827D21), UINT32_C(0x7F436096), UINT32_C(0x7200464F), UINT32_C(0x76C15BF8), UINT32_C(0x68860BFD),
+    UINT32_C(0x6C47164A), UINT32_C(0x61043093), UINT32_C(0x65C52D24), UINT32_C(0x119B4BE9), UINT32_C(0x155A565E),
+    UINT32_C(0x18197087), UINT32_C(0x1CD86D30), UINT32_C(0x029F3D35), UINT32_C(0x065E2082), UINT32_C(0x0B1D065B),
+    UINT32_C(0x0FDC1BEC), UINT32_C(0x3793A651), UINT32_C(0x3352BBE6), UINT32_C(0x3E119D3F), UINT32_C(0x3AD08088),
+    UINT32_C(0x2497D08D), UINT32_C(0x2056CD3A), UINT32_C(0x2D15EBE3), UINT32_C(0x29D4F654), UINT32_C(0xC5A92679),
+    UINT32_C(0xC1683BCE), UINT32_C(0xCC2B1D17), UINT32_C(0xC8EA00A0), UINT32_C(0xD6AD50A5), UINT32_C(0xD26C4D12),
+    UINT32_C(0xDF2F6BCB), UINT32_C(0xDBEE767C), UINT32_C(0xE3A1CBC1), UINT32_C(0xE760D676), UINT32_C(0xEA23F0AF),
+    UINT32_C(0xEEE2ED18), UINT32_C(0xF0A5BD1D), UINT32_C(0xF464A0AA), UINT32_C(0xF9278673), UINT32_C(0xFDE69BC4),
+    UINT32_C(0x89B8FD09), UINT32_C(0x8D79E0BE), UINT32_C(0x803AC667), UINT32_C(0x84FBDBD0), UINT32_C(0x9ABC8BD5),
+    UINT32_C(0x9E7D9662), UINT32_C(0x933EB0BB), UINT32_C(0x97FFAD0C), UINT32_C(0xAFB010B1), UINT32_C(0xAB710D06),
+    UINT32_C(0xA6322BDF), UINT32_C(0xA2F33668), UINT32_C(0xBCB4666D), UINT32_C(0xB8757BDA), UINT32_C(0xB5365D03),
+    UINT32_C(0xB1F740B4)
+};
+
+uint32_t bhi360_fw_crc32(uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    uint32_t i;
+    int8_t j;
+
+    if (data != NULL)
+    {
+        /* Each word is processed most significant byte first */
+        for (i = 0; (i + 4) <= length; i += 4)
+        {
+            for (j = 3; j >= 0; j--)
+            {
+                crc = (crc << 8) ^ bhi360_fw_crc_table[((crc >> 24) ^ data[i + (uint32_t)j]) & 0xFF];
+            }
+        }
+    }
+
+    return crc;
+}
+
+int8_t bhi360_fw_parse(const uint8_t *image, uint32_t length, struct bhi360_fw_info *info)
+{
+    int8_t rslt = BHI360_OK;
+    uint32_t offset = 0;
+    const uint8_t *header;
+    struct bhi360_fw_section *section;
+
+    if ((image != NULL) && (info != NULL))
+    {
+        info->n_sections = 0;
+        while ((offset < length) && (rslt == BHI360_OK))
+        {
+            header = &image[offset];
+            if ((length - offset) < BHI360_FW_HEADER_LEN)
+            {
+                rslt = BHI360_E_FW_FORMAT;
+            }
+            else if (BHI360_LE2U16(header) != BHI360_FW_MAGIC)
+            {
+                rslt = BHI360_E_MAGIC;
+            }
+            else if (info->n_sections == BHI360_FW_MAX_SECTIONS)
+            {
+                rslt = BHI360_E_FW_FORMAT;
+            }
+            else
+            {
+                section = &info->section[info->n_sections];
+                section->offset = offset;
+                section->flags = BHI360_LE2U16(&header[BHI360_FW_HEADER_FLAGS_POS]);
+                section->version = BHI360_LE2U16(&header[BHI360_FW_HEADER_VERSION_POS]);
+                section->payload_len = BHI360_LE2U32(&header[BHI360_FW_HEADER_PAYLOAD_LEN_POS]);
+                section->payload_crc = BHI360_LE2U32(&header[BHI360_FW_HEADER_PAYLOAD_CRC_POS]);
+                section->expected_version = BHI360_LE2U16(&header[BHI360_FW_HEADER_EXPECTED_VERSION_POS]);
+                section->header_crc = BHI360_LE2U32(&header[BHI360_FW_HEADER_CRC_POS]);
+                info->n_sections++;
+
+                /* A truncated image ends within the payload */
+                if (section->payload_len > (length - offset - BHI360_FW_HEADER_LEN))
+                {
+                    rslt = BHI360_E_FW_FORMAT;
+                }
+                else
+                {
+                    offset += BHI360_FW_HEADER_LEN + section->payload_len;
+                }
+            }
+        }
+
+        if ((rslt == BHI360_OK) && (info->n_sections == 0))
+        {
+            rslt = BHI360_E_FW_FORMAT;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_verify(const uint8_t *image, uint32_t length, uint16_t rom_version, struct bhi360_fw_info *info)
+{
+    int8_t rslt;
+    struct bhi360_fw_info parsed;
+    const struct bhi360_fw_section *section;
+    const uint8_t *header;
+
+    if (info == NULL)
+    {
+        info = &parsed;
+    }
+
+    /* The parse leaves the sections unset on a NULL image */
+    info->n_sections = 0;
+
+    rslt = bhi360_fw_parse(image, length, info);
+    for (uint8_t i = 0; (i < info->n_sections) && (rslt == BHI360_OK); i++)
+    {
+        section = &info->section[i];
+        header = &image[section->offset];
+        if ((section->payload_len % 4) != 0)
+        {
+            rslt = BHI360_E_FW_FORMAT;
+        }
+        else if ((bhi360_fw_crc32(BHI360_FW_CRC_INIT, header, BHI360_FW_HEADER_CRC_POS) != section->header_crc) ||
+                 (bhi360_fw_crc32(BHI360_FW_CRC_INIT, &header[BHI360_FW_HEADER_LEN],
+                                  section->payload_len) != section->payload_crc))
+        {
+            rslt = BHI360_E_CRC;
+        }
+        else if ((i > 0) && (section->expected_version != info->section[i - 1].version))
+        {
+            rslt = BHI360_E_FW_VERSION;
+        }
+        else if ((i == 0) && (rom_version != 0) && (section->expected_version != rom_version))
+        {
+            rslt = BHI360_E_FW_VERSION;
+        }
+    }
+
+    return rslt;
+}
@@ -0,0 +1,127 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_fw.h
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#ifndef __BHI360_FW_H__
+#define __BHI360_FW_H__
+
+/* Start of CPP Guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bhi360_defs.h"
+
+/*! Initial value of the firmware CRC */
+#define BHI360_FW_CRC_INIT                                             UINT32_C(0xFFFFFFFF)
+
+/*
+ * A firmware image is a sequence of sections, the kernel followed by the user image.
+ * Each section is a BHI360_FW_HEADER_LEN byte header followed by its payload. Header
+ * fields are little endian, at the offsets below. The expected version is the ROM
+ * version for the kernel and the kernel version for the user image. The header CRC
+ * covers all header bytes before it.
+ */
+#define BHI360_FW_HEADER_LEN                                           UINT8_C(0x7C)
+#define BHI360_FW_HEADER_FLAGS_POS                                     UINT8_C(0x02)
+#define BHI360_FW_HEADER_VERSION_POS                                   UINT8_C(0x06)
+#define BHI360_FW_HEADER_PAYLOAD_LEN_POS                               UINT8_C(0x58)
+#define BHI360_FW_HEADER_PAYLOAD_CRC_POS                               UINT8_C(0x5C)
+#define BHI360_FW_HEADER_EXPECTED_VERSION_POS                          UINT8_C(0x64)
+#define BHI360_FW_HEADER_CRC_POS                                       UINT8_C(0x78)
+
+#ifndef BHI360_FW_MAX_SECTIONS
+#define BHI360_FW_MAX_SECTIONS                                         UINT8_C(4)
+#endif
+
+struct bhi360_fw_section
+{
+    uint32_t offset; /**< Offset of the section header in the image */
+    uint32_t payload_len;
+    uint32_t payload_crc;
+    uint32_t header_crc;
+    uint16_t flags;
+    uint16_t version;
+    uint16_t expected_version; /**< ROM version for the kernel, kernel version for the user image */
+};
+
+struct bhi360_fw_info
+{
+    uint8_t n_sections;
+    struct bhi360_fw_section section[BHI360_FW_MAX_SECTIONS];
+};
+
+/**
+ * @brief Function to update the firmware CRC. This is the CRC-32/MPEG-2 computed over
+ *        little endian 32 bit words, as used in the firmware headers
+ * @param[in] crc    : Current CRC, BHI360_FW_CRC_INIT for the first call
+ * @param[in] data   : Reference to the data
+ * @param[in] length : Length of the data, a multiple of 4
+ * @return Updated CRC
+ */
+uint32_t bhi360_fw_crc32(uint32_t crc, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Function to parse the section headers of a firmware image. The CRCs are not checked
+ * @param[in] image  : Reference to the firmware image
+ * @param[in] length : Length of the firmware image
+ * @param[out] info  : Reference to the parsed sections
+ * @return API error codes
+ */
+int8_t bhi360_fw_parse(const uint8_t *image, uint32_t length, struct bhi360_fw_info *info);
+
+/**
+ * @brief Function to verify a firmware image on the host before it is uploaded. Checks
+ *        the section lengths, the header and payload CRCs, that each section is built for
+ *        the one before it and that the kernel is built for the ROM version
+ * @param[in] image       : Reference to the firmware image
+ * @param[in] length      : Length of the firmware image
+ * @param[in] rom_version : ROM version of the device, 0 to skip this check
+ * @param[out] info       : Reference to the parsed sections, can be NULL
+ * @return API error codes
+ */
+int8_t bhi360_fw_verify(const uint8_t *image, uint32_t length, uint16_t rom_version, struct bhi360_fw_info *info);
+
+/* End of CPP Guard */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* __BHI360_FW_H__ */
@@ -0,0 +1,484 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_fw_catalog.c
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#include "bhi360.h"
+#include "bhi360_fw.h"
+#include "bhi360_fw_catalog.h"
+
+/**
+* @brief Function to get the reference to a catalog entry
+* @param[in] index : Index of the image
+* @param[in] cat   : Catalog instance
+* @return Reference to the entry
+*/
+static const uint8_t *bhi360_fw_catalog_entry(uint8_t index, const struct bhi360_fw_catalog_dev *cat)
+{
+    return &cat->catalog[BHI360_FW_CATALOG_HEADER_LEN + ((uint32_t)index * BHI360_FW_CATALOG_ENTRY_LEN)];
+}
+
+/**
+* @brief Function to read a length extension, added while the byte read is 255
+* @param[in] cat     : Catalog instance
+* @param[in,out] len : Length to extend
+* @return API error codes
+*/
+static int8_t bhi360_fw_catalog_read_len_ext(struct bhi360_fw_catalog_dev *cat, uint32_t *len)
+{
+    int8_t rslt = BHI360_E_FW_FORMAT;
+    uint8_t ext;
+
+    while (cat->delta_pos < cat->delta_len)
+    {
+        ext = cat->delta[cat->delta_pos++];
+        *len += ext;
+        if (ext != 255)
+        {
+            rslt = BHI360_OK;
+            break;
+        }
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to decode the token and the literal length of the next block
+* @param[in] cat : Catalog instance
+* @return API error codes
+*/
+static int8_t bhi360_fw_catalog_next_block(struct bhi360_fw_catalog_dev *cat)
+{
+    int8_t rslt = BHI360_OK;
+
+    cat->token = cat->delta[cat->delta_pos++];
+    cat->literal_remain = cat->token >> 4;
+    if (cat->literal_remain == 15)
+    {
+        rslt = bhi360_fw_catalog_read_len_ext(cat, &cat->literal_remain);
+    }
+
+    if ((rslt == BHI360_OK) && (cat->literal_remain > (cat->delta_len - cat->delta_pos)))
+    {
+        rslt = BHI360_E_FW_FORMAT;
+    }
+
+    cat->copy_pending = 1;
+
+    return rslt;
+}
+
+/**
+* @brief Function to decode the base offset and the length of the pending copy
+* @param[in] cat : Catalog instance
+* @return API error codes
+*/
+static int8_t bhi360_fw_catalog_next_copy(struct bhi360_fw_catalog_dev *cat)
+{
+    int8_t rslt = BHI360_OK;
+
+    cat->copy_pending = 0;
+    if ((cat->delta_len - cat->delta_pos) < 3)
+    {
+        rslt = BHI360_E_FW_FORMAT;
+    }
+    else
+    {
+        cat->copy_pos = BHI360_LE2U24(&cat->delta[cat->delta_pos]);
+        cat->delta_pos += 3;
+        cat->copy_remain = (cat->token & 0x0F);
+        if (cat->copy_remain == 15)
+        {
+            rslt = bhi360_fw_catalog_read_len_ext(cat, &cat->copy_remain);
+        }
+
+        cat->copy_remain += BHI360_FW_CATALOG_MIN_COPY;
+
+        if ((cat->copy_pos > cat->base_len) || (cat->copy_remain > (cat->base_len - cat->copy_pos)))
+        {
+            rslt = BHI360_E_FW_FORMAT;
+        }
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_catalog_init(const uint8_t *catalog,
+                              uint32_t length,
+                              uint8_t *n_images,
+                              struct bhi360_fw_catalog_dev *cat)
+{
+    int8_t rslt = BHI360_OK;
+    uint32_t base_offset;
+    uint32_t delta_offset, delta_len;
+    const uint8_t *entry;
+    uint8_t i;
+
+    if ((catalog != NULL) && (n_images != NULL) && (cat != NULL))
+    {
+        if ((length < BHI360_FW_CATALOG_HEADER_LEN) || (BHI360_LE2U16(catalog) != BHI360_FW_CATALOG_MAGIC) ||
+            (catalog[2] != BHI360_FW_CATALOG_VERSION))
+        {
+            rslt = BHI360_E_MAGIC;
+        }
+        else
+        {
+            cat->catalog = catalog;
+            cat->n_images = catalog[3];
+            base_offset = BHI360_LE2U32(&catalog[4]);
+            cat->base_len = BHI360_LE2U32(&catalog[8]);
+            cat->base = NULL;
+            cat->raw_len = 0;
+            cat->raw_pos = 0;
+
+            /* Everything referenced must lie within the catalog */
+            if ((BHI360_FW_CATALOG_HEADER_LEN + ((uint32_t)cat->n_images * BHI360_FW_CATALOG_ENTRY_LEN) > length) ||
+                (base_offset > length) || (cat->base_len > (length - base_offset)))
+            {
+                rslt = BHI360_E_FW_FORMAT;
+            }
+            else
+            {
+                cat->base = &catalog[base_offset];
+            }
+
+            for (i = 0; (i < cat->n_images) && (rslt == BHI360_OK); i++)
+            {
+                entry = bhi360_fw_catalog_entry(i, cat);
+                delta_offset = BHI360_LE2U32(&entry[12]);
+                delta_len = BHI360_LE2U32(&entry[16]);
+                if ((delta_offset > length) || (delta_len > (length - delta_offset)))
+                {
+                    rslt = BHI360_E_FW_FORMAT;
+                }
+            }
+
+            *n_images = (rslt == BHI360_OK) ? cat->n_images : 0;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_catalog_get_info(uint8_t index,
+                                  struct bhi360_fw_catalog_info *info,
+                                  const struct bhi360_fw_catalog_dev *cat)
+{
+    int8_t rslt = BHI360_OK;
+    const uint8_t *entry;
+
+    if ((info != NULL) && (cat != NULL) && (cat->catalog != NULL))
+    {
+        if (index < cat->n_images)
+        {
+            entry = bhi360_fw_catalog_entry(index, cat);
+            info->variant_id = BHI360_LE2U32(&entry[0]);
+            info->length = BHI360_LE2U32(&entry[4]);
+            info->crc = BHI360_LE2U32(&entry[8]);
+            info->delta_len = BHI360_LE2U32(&entry[16]);
+            info->flags = BHI360_LE2U16(&entry[20]);
+            memcpy(info->sensor_present, &entry[24], sizeof(info->sensor_present));
+        }
+        else
+        {
+            rslt = BHI360_E_INVALID_PARAM;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_catalog_find_variant(uint32_t variant_id, uint8_t *index, const struct bhi360_fw_catalog_dev *cat)
+{
+    int8_t rslt = BHI360_E_INVALID_PARAM;
+    uint8_t i;
+
+    if ((index != NULL) && (cat != NULL) && (cat->catalog != NULL))
+    {
+        for (i = 0; i < cat->n_images; i++)
+        {
+            if (BHI360_LE2U32(bhi360_fw_catalog_entry(i, cat)) == variant_id)
+            {
+                *index = i;
+                rslt = BHI360_OK;
+                break;
+            }
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_catalog_find_sensors(const uint8_t *sensor_ids,
+                                      uint8_t n_sensors,
+                                      uint16_t flags,
+                                      uint8_t *index,
+                                      const struct bhi360_fw_catalog_dev *cat)
+{
+    int8_t rslt = BHI360_E_INVALID_PARAM;
+    uint32_t best_len = UINT32_MAX;
+    const uint8_t *entry;
+    uint8_t i, j, match;
+
+    if (((sensor_ids != NULL) || (n_sensors == 0)) && (index != NULL) && (cat != NULL) && (cat->catalog != NULL))
+    {
+        for (i = 0; i < cat->n_images; i++)
+        {
+            entry = bhi360_fw_catalog_entry(i, cat);
+            match = ((BHI360_LE2U16(&entry[20]) & flags) == flags);
+            for (j = 0; (j < n_sensors) && match; j++)
+            {
+                match = BHI360_CHK_BIT(entry[24 + (sensor_ids[j] / 8)], (sensor_ids[j] % 8));
+            }
+
+            if (match && (BHI360_LE2U32(&entry[4]) < best_len))
+            {
+                best_len = BHI360_LE2U32(&entry[4]);
+                *index = i;
+                rslt = BHI360_OK;
+            }
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_catalog_open(uint8_t index, struct bhi360_fw_catalog_dev *cat)
+{
+    int8_t rslt = BHI360_OK;
+    const uint8_t *entry;
+
+    if ((cat != NULL) && (cat->catalog != NULL))
+    {
+        if (index < cat->n_images)
+        {
+            entry = bhi360_fw_catalog_entry(index, cat);
+            cat->raw_len = BHI360_LE2U32(&entry[4]);
+            cat->delta = &cat->catalog[BHI360_LE2U32(&entry[12])];
+            cat->delta_len = BHI360_LE2U32(&entry[16]);
+            cat->delta_pos = 0;
+            cat->raw_pos = 0;
+            cat->literal_remain = 0;
+            cat->copy_pending = 0;
+
+            /* An empty delta stands for the base image */
+            if (cat->delta_len == 0)
+            {
+                cat->copy_pos = 0;
+                cat->copy_remain = cat->base_len;
+            }
+            else
+            {
+                cat->copy_remain = 0;
+            }
+        }
+        else
+        {
+            rslt = BHI360_E_INVALID_PARAM;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_catalog_read(uint8_t *buffer,
+                              uint32_t buffer_len,
+                              uint32_t *actual_len,
+                              struct bhi360_fw_catalog_dev *cat)
+{
+    int8_t rslt = BHI360_OK;
+    uint32_t len = 0;
+    uint32_t copy_len;
+
+    if ((buffer != NULL) && (actual_len != NULL) && (cat != NULL))
+    {
+        while ((len < buffer_len) && (cat->raw_pos < cat->raw_len) && (rslt == BHI360_OK))
+        {
+            if (cat->copy_remain != 0)
+            {
+                copy_len = buffer_len - len;
+                if (copy_len > cat->copy_remain)
+                {
+                    copy_len = cat->copy_remain;
+                }
+
+                memcpy(&buffer[len], &cat->base[cat->copy_pos], copy_len);
+                cat->copy_pos += copy_len;
+                cat->copy_remain -= copy_len;
+            }
+            else if (cat->literal_remain != 0)
+            {
+                copy_len = buffer_len - len;
+                if (copy_len > cat->literal_remain)
+                {
+                    copy_len = cat->literal_remain;
+                }
+
+                memcpy(&buffer[len], &cat->delta[cat->delta_pos], copy_len);
+                cat->delta_pos += copy_len;
+                cat->literal_remain -= copy_len;
+            }
+            else
+            {
+                if (cat->copy_pending)
+                {
+                    rslt = bhi360_fw_catalog_next_copy(cat);
+                }
+                else if (cat->delta_pos < cat->delta_len)
+                {
+                    rslt = bhi360_fw_catalog_next_block(cat);
+                }
+                else
+                {
+                    /* Delta ended before the image was complete */
+                    rslt = BHI360_E_FW_FORMAT;
+                }
+
+                continue;
+            }
+
+            /* Never hand out more than the image length */
+            if (copy_len > (cat->raw_len - cat->raw_pos))
+            {
+                rslt = BHI360_E_FW_FORMAT;
+                copy_len = cat->raw_len - cat->raw_pos;
+            }
+
+            len += copy_len;
+            cat->raw_pos += copy_len;
+        }
+
+        *actual_len = len;
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to reconstruct an image and check its CRC, uploading it when a device is given
+* @param[in] index : Index of the image
+* @param[in] cat   : Catalog instance
+* @param[in] dev   : Device reference, NULL to only check the CRC
+* @return API error codes
+*/
+static int8_t bhi360_fw_catalog_stream(uint8_t index, struct bhi360_fw_catalog_dev *cat, struct bhi360_dev *dev)
+{
+    int8_t rslt;
+    uint8_t chunk[BHI360_FW_CATALOG_CHUNK_SIZE];
+    struct bhi360_fw_catalog_info info;
+    uint32_t chunk_len = 0;
+    uint32_t pos = 0;
+    uint32_t crc = BHI360_FW_CRC_INIT;
+
+    rslt = bhi360_fw_catalog_get_info(index, &info, cat);
+    if (rslt == BHI360_OK)
+    {
+        rslt = bhi360_fw_catalog_open(index, cat);
+    }
+
+    while ((rslt == BHI360_OK) && (pos < info.length))
+    {
+        rslt = bhi360_fw_catalog_read(chunk, sizeof(chunk), &chunk_len, cat);
+        if ((rslt == BHI360_OK) && (chunk_len == 0))
+        {
+            rslt = BHI360_E_FW_FORMAT;
+        }
+
+        if (rslt == BHI360_OK)
+        {
+            crc = bhi360_fw_crc32(crc, chunk, chunk_len);
+            if (dev != NULL)
+            {
+                rslt = bhi360_upload_firmware_to_ram_partly(chunk, info.length, pos, chunk_len, dev);
+            }
+
+            pos += chunk_len;
+        }
+    }
+
+    if ((rslt == BHI360_OK) && (crc != info.crc))
+    {
+        rslt = BHI360_E_CRC;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_catalog_verify(uint8_t index, struct bhi360_fw_catalog_dev *cat)
+{
+    return bhi360_fw_catalog_stream(index, cat, NULL);
+}
+
+int8_t bhi360_fw_catalog_upload_to_ram(uint8_t index, struct bhi360_fw_catalog_dev *cat, struct bhi360_dev *dev)
+{
+    int8_t rslt;
+
+    if (dev == NULL)
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bhi360_fw_catalog_stream(index, cat, dev);
+    }
+
+    return rslt;
+}
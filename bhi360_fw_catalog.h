@@ -0,0 +1,211 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_fw_catalog.h
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#ifndef __BHI360_FW_CATALOG_H__
+#define __BHI360_FW_CATALOG_H__
+
+/* Start of CPP Guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bhi360_defs.h"
+
+/*
+ * Firmware catalog, as emitted by the fw_catalog tool
+ *
+ * |--------|---------|----------|-------------|-------------|----------|---------------|-------|--------|
+ * | magic  | version | n_images | base offset | base length | reserved | entries       | base  | deltas |
+ * | 2 byte |  1 byte |  1 byte  | 4 byte (LE) | 4 byte (LE) |  4 byte  | n_images * 56 |       |        |
+ * |--------|---------|----------|-------------|-------------|----------|---------------|-------|--------|
+ *
+ * Each entry holds the variant ID, length, CRC (see bhi360_fw_crc32), delta offset and
+ * delta length (LE, 4 byte each), the flags (2 byte), 2 reserved bytes and a 32 byte
+ * bitmap of the virtual sensors present, sensor ID n in bit (n % 8) of byte (n / 8).
+ *
+ * A delta is a sequence of blocks. Each block starts with a token, the upper nibble
+ * is the literal length and the lower nibble the copy length minus
+ * BHI360_FW_CATALOG_MIN_COPY. A nibble of 15 is followed by extension bytes that are
+ * added until one is less than 255. The literals follow, then the 3 byte offset (LE)
+ * in the base image to copy from. The last block has literals only. An image with an
+ * empty delta is the base image itself.
+ */
+#define BHI360_FW_CATALOG_MAGIC                                        UINT16_C(0x4743)
+#define BHI360_FW_CATALOG_VERSION                                      UINT8_C(1)
+#define BHI360_FW_CATALOG_HEADER_LEN                                   UINT8_C(16)
+#define BHI360_FW_CATALOG_ENTRY_LEN                                    UINT8_C(56)
+#define BHI360_FW_CATALOG_MIN_COPY                                     UINT8_C(4)
+
+/*! Image flags */
+#define BHI360_FW_CATALOG_FLAG_TURBO                                   UINT16_C(0x0001)
+#define BHI360_FW_CATALOG_FLAG_POLL                                    UINT16_C(0x0002)
+
+/*! Size of the chunks handed to bhi360_upload_firmware_to_ram_partly */
+#ifndef BHI360_FW_CATALOG_CHUNK_SIZE
+#define BHI360_FW_CATALOG_CHUNK_SIZE                                   UINT16_C(256)
+#endif
+
+struct bhi360_fw_catalog_info
+{
+    uint32_t variant_id;
+    uint32_t length;
+    uint32_t crc;
+    uint32_t delta_len;
+    uint16_t flags;
+    uint8_t sensor_present[32];
+};
+
+struct bhi360_fw_catalog_dev
+{
+    const uint8_t *catalog;
+    const uint8_t *base;
+    uint32_t base_len;
+    uint8_t n_images;
+
+    /* Reconstruction of the open image */
+    const uint8_t *delta;
+    uint32_t delta_len;
+    uint32_t delta_pos;
+    uint32_t raw_len;
+    uint32_t raw_pos;
+    uint32_t literal_remain;
+    uint32_t copy_remain;
+    uint32_t copy_pos;
+    uint8_t token;
+    uint8_t copy_pending;
+};
+
+/**
+ * @brief Function to check a firmware catalog and prepare it for use
+ * @param[in] catalog  : Reference to the catalog
+ * @param[in] length   : Length of the catalog
+ * @param[out] n_images: Number of images in the catalog
+ * @param[in] cat      : Catalog instance
+ * @return API error codes
+ */
+int8_t bhi360_fw_catalog_init(const uint8_t *catalog,
+                              uint32_t length,
+                              uint8_t *n_images,
+                              struct bhi360_fw_catalog_dev *cat);
+
+/**
+ * @brief Function to get the metadata of an image in the catalog
+ * @param[in] index : Index of the image
+ * @param[out] info : Reference to the image metadata
+ * @param[in] cat   : Catalog instance
+ * @return API error codes
+ */
+int8_t bhi360_fw_catalog_get_info(uint8_t index,
+                                  struct bhi360_fw_catalog_info *info,
+                                  const struct bhi360_fw_catalog_dev *cat);
+
+/**
+ * @brief Function to find the image of a variant
+ * @param[in] variant_id : Variant ID, as reported by bhi360_get_variant_id
+ * @param[out] index     : Index of the image
+ * @param[in] cat        : Catalog instance
+ * @return API error codes
+ */
+int8_t bhi360_fw_catalog_find_variant(uint32_t variant_id, uint8_t *index, const struct bhi360_fw_catalog_dev *cat);
+
+/**
+ * @brief Function to find the smallest image providing a set of sensors
+ * @param[in] sensor_ids : Reference to the virtual sensor IDs required
+ * @param[in] n_sensors  : Number of sensor IDs
+ * @param[in] flags      : Image flags required
+ * @param[out] index     : Index of the image
+ * @param[in] cat        : Catalog instance
+ * @return API error codes
+ */
+int8_t bhi360_fw_catalog_find_sensors(const uint8_t *sensor_ids,
+                                      uint8_t n_sensors,
+                                      uint16_t flags,
+                                      uint8_t *index,
+                                      const struct bhi360_fw_catalog_dev *cat);
+
+/**
+ * @brief Function to start reconstructing an image
+ * @param[in] index : Index of the image
+ * @param[in] cat   : Catalog instance
+ * @return API error codes
+ */
+int8_t bhi360_fw_catalog_open(uint8_t index, struct bhi360_fw_catalog_dev *cat);
+
+/**
+ * @brief Function to reconstruct the next part of the open image
+ * @param[out] buffer     : Reference to the output buffer
+ * @param[in] buffer_len  : Length of the output buffer
+ * @param[out] actual_len : Number of bytes written, less than buffer_len only at the end of the image
+ * @param[in] cat         : Catalog instance
+ * @return API error codes
+ */
+int8_t bhi360_fw_catalog_read(uint8_t *buffer,
+                              uint32_t buffer_len,
+                              uint32_t *actual_len,
+                              struct bhi360_fw_catalog_dev *cat);
+
+/**
+ * @brief Function to reconstruct an image and check its CRC against the catalog, without
+ *        uploading it
+ * @param[in] index : Index of the image
+ * @param[in] cat   : Catalog instance
+ * @return API error codes, BHI360_E_CRC if the reconstructed image does not match
+ */
+int8_t bhi360_fw_catalog_verify(uint8_t index, struct bhi360_fw_catalog_dev *cat);
+
+/**
+ * @brief Function to reconstruct an image and upload it to RAM.
+ *        The CRC of the reconstructed image is checked against the catalog as it is uploaded,
+ *        so BHI360_E_CRC is returned after the image was written. The device must then not be
+ *        booted from RAM. Call bhi360_fw_catalog_verify before to reject the image up front
+ * @param[in] index : Index of the image
+ * @param[in] cat   : Catalog instance
+ * @param[in] dev   : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_fw_catalog_upload_to_ram(uint8_t index, struct bhi360_fw_catalog_dev *cat, struct bhi360_dev *dev);
+
+/* End of CPP Guard */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* __BHI360_FW_CATALOG_H__ */
@@ -0,0 +1,347 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_fw_lz.c
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#include "bhi360.h"
+#include "bhi360_hif.h"
+#include "bhi360_fw.h"
+#include "bhi360_fw_lz.h"
+
+/**
+* @brief Function to read a length extension, added while the byte read is 255
+* @param[in] lz      : Decompressor instance
+* @param[in,out] len : Length to extend
+* @return API error codes
+*/
+static int8_t bhi360_fw_lz_read_len_ext(struct bhi360_fw_lz_dev *lz, uint32_t *len)
+{
+    int8_t rslt = BHI360_E_FW_FORMAT;
+    uint8_t ext;
+
+    while (lz->payload_pos < lz->payload_len)
+    {
+        ext = lz->payload[lz->payload_pos++];
+        *len += ext;
+        if (ext != 255)
+        {
+            rslt = BHI360_OK;
+            break;
+        }
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to decode the token and the literal length of the next block
+* @param[in] lz : Decompressor instance
+* @return API error codes
+*/
+static int8_t bhi360_fw_lz_next_block(struct bhi360_fw_lz_dev *lz)
+{
+    int8_t rslt = BHI360_OK;
+
+    lz->token = lz->payload[lz->payload_pos++];
+    lz->literal_remain = lz->token >> 4;
+    if (lz->literal_remain == 15)
+    {
+        rslt = bhi360_fw_lz_read_len_ext(lz, &lz->literal_remain);
+    }
+
+    if ((rslt == BHI360_OK) && (lz->literal_remain > (lz->payload_len - lz->payload_pos)))
+    {
+        rslt = BHI360_E_FW_FORMAT;
+    }
+
+    lz->match_pending = 1;
+
+    return rslt;
+}
+
+/**
+* @brief Function to decode the offset and the length of the pending match
+* @param[in] lz : Decompressor instance
+* @return API error codes
+*/
+static int8_t bhi360_fw_lz_next_match(struct bhi360_fw_lz_dev *lz)
+{
+    int8_t rslt = BHI360_OK;
+
+    lz->match_pending = 0;
+    if ((lz->payload_len - lz->payload_pos) < 2)
+    {
+        rslt = BHI360_E_FW_FORMAT;
+    }
+    else
+    {
+        lz->match_offset = BHI360_LE2U16(&lz->payload[lz->payload_pos]);
+        lz->payload_pos += 2;
+        lz->match_remain = (lz->token & 0x0F);
+        if (lz->match_remain == 15)
+        {
+            rslt = bhi360_fw_lz_read_len_ext(lz, &lz->match_remain);
+        }
+
+        lz->match_remain += BHI360_FW_LZ_MIN_MATCH;
+
+        if ((lz->match_offset == 0) || (lz->match_offset > lz->raw_pos) ||
+            (lz->match_offset > ((uint32_t)lz->window_mask + 1)))
+        {
+            rslt = BHI360_E_FW_FORMAT;
+        }
+    }
+
+    return rslt;
+}
+
+uint8_t bhi360_fw_lz_is_compressed(const uint8_t *image, uint32_t length)
+{
+    uint8_t compressed = 0;
+
+    if ((image != NULL) && (length >= BHI360_FW_LZ_HEADER_LEN) && (BHI360_LE2U16(image) == BHI360_FW_LZ_MAGIC))
+    {
+        compressed = 1;
+    }
+
+    return compressed;
+}
+
+int8_t bhi360_fw_lz_init(const uint8_t *image, uint32_t length, uint32_t *raw_len, struct bhi360_fw_lz_dev *lz)
+{
+    int8_t rslt = BHI360_OK;
+    uint32_t window_size;
+
+    if ((image != NULL) && (raw_len != NULL) && (lz != NULL))
+    {
+        if (!bhi360_fw_lz_is_compressed(image, length) || (image[2] != BHI360_FW_LZ_VERSION))
+        {
+            rslt = BHI360_E_MAGIC;
+        }
+        else
+        {
+            window_size = UINT32_C(1) << (image[3] & 0x1F);
+            lz->payload = &image[BHI360_FW_LZ_HEADER_LEN];
+            lz->raw_len = BHI360_LE2U32(&image[4]);
+            lz->payload_len = BHI360_LE2U32(&image[8]);
+            lz->payload_pos = 0;
+            lz->raw_pos = 0;
+            lz->literal_remain = 0;
+            lz->match_remain = 0;
+            lz->match_offset = 0;
+            lz->match_pending = 0;
+            lz->window_pos = 0;
+            lz->window_mask = (uint16_t)(BHI360_FW_LZ_WINDOW_SIZE - 1);
+
+            /* The image must not reference more history than the window holds */
+            if ((window_size > BHI360_FW_LZ_WINDOW_SIZE) ||
+                (lz->payload_len > (length - BHI360_FW_LZ_HEADER_LEN)))
+            {
+                rslt = BHI360_E_FW_FORMAT;
+            }
+
+            *raw_len = lz->raw_len;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_lz_read(uint8_t *buffer, uint32_t buffer_len, uint32_t *actual_len, struct bhi360_fw_lz_dev *lz)
+{
+    int8_t rslt = BHI360_OK;
+    uint32_t len = 0;
+    uint8_t byte;
+
+    if ((buffer != NULL) && (actual_len != NULL) && (lz != NULL))
+    {
+        while ((len < buffer_len) && (lz->raw_pos < lz->raw_len) && (rslt == BHI360_OK))
+        {
+            if (lz->match_remain != 0)
+            {
+                byte = lz->window[(lz->window_pos - lz->match_offset) & lz->window_mask];
+                lz->match_remain--;
+            }
+            else if (lz->literal_remain != 0)
+            {
+                byte = lz->payload[lz->payload_pos++];
+                lz->literal_remain--;
+            }
+            else
+            {
+                if (lz->match_pending)
+                {
+                    rslt = bhi360_fw_lz_next_match(lz);
+                }
+                else if (lz->payload_pos < lz->payload_len)
+                {
+                    rslt = bhi360_fw_lz_next_block(lz);
+                }
+                else
+                {
+                    /* Payload ended before the firmware was complete */
+                    rslt = BHI360_E_FW_FORMAT;
+                }
+
+                continue;
+            }
+
+            buffer[len++] = byte;
+            lz->window[lz->window_pos] = byte;
+            lz->window_pos = (lz->window_pos + 1) & lz->window_mask;
+            lz->raw_pos++;
+        }
+
+        *actual_len = len;
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_lz_upload_to_ram(const uint8_t *image,
+                                  uint32_t length,
+                                  struct bhi360_fw_lz_dev *lz,
+                                  struct bhi360_dev *dev)
+{
+    int8_t rslt;
+    uint8_t chunk[BHI360_FW_LZ_CHUNK_SIZE];
+    uint32_t raw_len = 0;
+    uint32_t chunk_len = 0;
+    uint32_t pos = 0;
+
+    if (dev == NULL)
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bhi360_fw_lz_init(image, length, &raw_len, lz);
+    }
+
+    while ((rslt == BHI360_OK) && (pos < raw_len))
+    {
+        rslt = bhi360_fw_lz_read(chunk, sizeof(chunk), &chunk_len, lz);
+        if ((rslt == BHI360_OK) && (chunk_len == 0))
+        {
+            rslt = BHI360_E_FW_FORMAT;
+        }
+
+        if (rslt == BHI360_OK)
+        {
+            rslt = bhi360_upload_firmware_to_ram_partly(chunk, raw_len, pos, chunk_len, dev);
+            pos += chunk_len;
+        }
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_fw_lz_check_fw_running(const uint8_t *image,
+                                     uint32_t length,
+                                     uint8_t *running,
+                                     struct bhi360_fw_lz_dev *lz,
+                                     struct bhi360_dev *dev)
+{
+    int8_t rslt;
+    uint8_t chunk[BHI360_FW_LZ_CHUNK_SIZE];
+    uint8_t header[BHI360_FW_HEADER_LEN];
+    uint16_t version[2] = { 0, 0 };
+    uint32_t crc = BHI360_FW_CRC_INIT;
+    uint32_t raw_len = 0;
+    uint32_t chunk_len = 0;
+    uint32_t section_pos = 0;
+    uint32_t pos = 0;
+    uint8_t n_sections = 0;
+
+    if ((dev == NULL) || (running == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else
+    {
+        *running = 0;
+        rslt = bhi360_fw_lz_init(image, length, &raw_len, lz);
+    }
+
+    /* The CRC and the section headers are taken on the fly, the firmware is never held in full */
+    while ((rslt == BHI360_OK) && (pos < raw_len))
+    {
+        rslt = bhi360_fw_lz_read(chunk, sizeof(chunk), &chunk_len, lz);
+        if ((rslt == BHI360_OK) && (chunk_len == 0))
+        {
+            rslt = BHI360_E_FW_FORMAT;
+        }
+
+        if (rslt == BHI360_OK)
+        {
+            crc = bhi360_fw_crc32(crc, chunk, chunk_len);
+            for (uint32_t i = 0; i < chunk_len; i++, pos++)
+            {
+                if ((pos >= section_pos) && ((pos - section_pos) < BHI360_FW_HEADER_LEN))
+                {
+                    header[pos - section_pos] = chunk[i];
+                    if ((pos - section_pos) == (BHI360_FW_HEADER_LEN - 1))
+                    {
+                        /* The kernel comes first, the user image last */
+                        version[(n_sections == 0) ? 0 : 1] = BHI360_LE2U16(&header[BHI360_FW_HEADER_VERSION_POS]);
+                        section_pos += BHI360_FW_HEADER_LEN + BHI360_LE2U32(&header[BHI360_FW_HEADER_PAYLOAD_LEN_POS]);
+                        n_sections++;
+                    }
+                }
+            }
+        }
+    }
+
+    if ((rslt == BHI360_OK) && (n_sections == 0))
+    {
+        rslt = BHI360_E_FW_FORMAT;
+    }
+
+    if (rslt == BHI360_OK)
+    {
+        rslt = bhi360_hif_check_fw_running(crc, version[0], version[1], running, &dev->hif);
+    }
+
+    return rslt;
+}
@@ -0,0 +1,162 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_fw_lz.h
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#ifndef __BHI360_FW_LZ_H__
+#define __BHI360_FW_LZ_H__
+
+/* Start of CPP Guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bhi360_defs.h"
+
+/*
+ * Compressed firmware image, as emitted by fw2h -c
+ *
+ * |--------|---------|-------------|-------------|------------------|
+ * | magic  | version | window bits |  raw length | payload length   |
+ * | 2 byte |  1 byte |    1 byte   | 4 byte (LE) |   4 byte (LE)    |
+ * |--------|---------|-------------|-------------|------------------|
+ *
+ * The payload is a sequence of LZ4 style blocks. Each block starts with a token,
+ * the upper nibble is the literal length and the lower nibble the match length
+ * minus BHI360_FW_LZ_MIN_MATCH. A nibble of 15 is followed by extension bytes that
+ * are added until one is less than 255. The literals follow, then the 2 byte match
+ * offset (LE). The last block has literals only. Match offsets never exceed the
+ * window, so the image can be decompressed with a window sized history buffer.
+ */
+#define BHI360_FW_LZ_MAGIC                                             UINT16_C(0x5A4C)
+#define BHI360_FW_LZ_VERSION                                           UINT8_C(1)
+#define BHI360_FW_LZ_HEADER_LEN                                        UINT8_C(12)
+#define BHI360_FW_LZ_MIN_MATCH                                         UINT8_C(4)
+
+/*! History buffer size of the decompressor, must be a power of 2 */
+#ifndef BHI360_FW_LZ_WINDOW_SIZE
+#define BHI360_FW_LZ_WINDOW_SIZE                                       UINT16_C(2048)
+#endif
+
+/*! Size of the chunks handed to bhi360_upload_firmware_to_ram_partly */
+#ifndef BHI360_FW_LZ_CHUNK_SIZE
+#define BHI360_FW_LZ_CHUNK_SIZE                                        UINT16_C(256)
+#endif
+
+struct bhi360_fw_lz_dev
+{
+    const uint8_t *payload;
+    uint32_t payload_len;
+    uint32_t payload_pos;
+    uint32_t raw_len;
+    uint32_t raw_pos;
+    uint32_t literal_remain;
+    uint32_t match_remain;
+    uint16_t match_offset;
+    uint16_t window_pos;
+    uint16_t window_mask;
+    uint8_t token;
+    uint8_t match_pending;
+    uint8_t window[BHI360_FW_LZ_WINDOW_SIZE];
+};
+
+/**
+ * @brief Function to check if an image is a compressed firmware image
+ * @param[in] image  : Reference to the image
+ * @param[in] length : Length of the image
+ * @return 1 if compressed, 0 otherwise
+ */
+uint8_t bhi360_fw_lz_is_compressed(const uint8_t *image, uint32_t length);
+
+/**
+ * @brief Function to start decompressing a compressed firmware image
+ * @param[in] image    : Reference to the compressed image
+ * @param[in] length   : Length of the compressed image
+ * @param[out] raw_len : Length of the decompressed firmware
+ * @param[in] lz       : Decompressor instance
+ * @return API error codes
+ */
+int8_t bhi360_fw_lz_init(const uint8_t *image, uint32_t length, uint32_t *raw_len, struct bhi360_fw_lz_dev *lz);
+
+/**
+ * @brief Function to decompress the next part of the firmware
+ * @param[out] buffer     : Reference to the output buffer
+ * @param[in] buffer_len  : Length of the output buffer
+ * @param[out] actual_len : Number of bytes written, less than buffer_len only at the end of the image
+ * @param[in] lz          : Decompressor instance
+ * @return API error codes
+ */
+int8_t bhi360_fw_lz_read(uint8_t *buffer, uint32_t buffer_len, uint32_t *actual_len, struct bhi360_fw_lz_dev *lz);
+
+/**
+ * @brief Function to upload a compressed firmware image to RAM.
+ *        The image is decompressed on the fly and uploaded in chunks of BHI360_FW_LZ_CHUNK_SIZE
+ * @param[in] image  : Reference to the compressed image
+ * @param[in] length : Length of the compressed image
+ * @param[in] lz     : Decompressor instance, used as work area
+ * @param[in] dev    : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_fw_lz_upload_to_ram(const uint8_t *image,
+                                  uint32_t length,
+                                  struct bhi360_fw_lz_dev *lz,
+                                  struct bhi360_dev *dev);
+
+/**
+ * @brief Function to check if a compressed firmware image is already running from RAM, see
+ *        bhi360_check_fw_running. The image is decompressed on the fly to take its CRC and versions
+ * @param[in] image    : Reference to the compressed image
+ * @param[in] length   : Length of the compressed image
+ * @param[out] running : 1 if the image is running, 0 if it has to be uploaded
+ * @param[in] lz       : Decompressor instance, used as work area
+ * @param[in] dev      : Device reference
+ * @return API error codes
+ */
+int8_t bhi360_fw_lz_check_fw_running(const uint8_t *image,
+                                     uint32_t length,
+                                     uint8_t *running,
+                                     struct bhi360_fw_lz_dev *lz,
+                                     struct bhi360_dev *dev);
+
+/* End of CPP Guard */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* __BHI360_FW_LZ_H__ */
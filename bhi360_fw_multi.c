@@ -0,0 +1,247 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_fw_multi.c
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#include <stdlib.h>
+
+#include "bhi360.h"
+#include "bhi360_fw.h"
+#include "bhi360_fw_multi.h"
+
+#ifdef BHI360_USE_THREAD
+#include <pthread.h>
+#endif
+
+struct bhi360_fw_multi_job
+{
+    const uint8_t *firmware;
+    uint32_t length;
+    uint16_t expected_version; /* ROM version the image is built for */
+    int8_t rslt; /* Result of the image verification */
+    uint32_t uploaded; /* Bytes uploaded to all devices */
+    uint32_t total;
+    bhi360_fw_multi_progress_fptr_t progress;
+    void *private_data;
+#ifdef BHI360_USE_THREAD
+    pthread_mutex_t lock;
+#endif
+};
+
+#ifdef BHI360_USE_THREAD
+struct bhi360_fw_multi_worker
+{
+    pthread_t thread;
+    struct bhi360_fw_multi_job *job;
+    struct bhi360_fw_multi_dev *md;
+    uint8_t started;
+};
+#endif
+
+/**
+* @brief Function to add uploaded bytes to the progress of all devices
+* @param[in] job        : Upload shared by the devices
+* @param[in] packet_len : Bytes uploaded
+*/
+static void bhi360_fw_multi_report(struct bhi360_fw_multi_job *job, uint32_t packet_len)
+{
+#ifdef BHI360_USE_THREAD
+    pthread_mutex_lock(&job->lock);
+#endif
+
+    job->uploaded += packet_len;
+    if (job->progress != NULL)
+    {
+        job->progress(job->uploaded, job->total, job->private_data);
+    }
+
+#ifdef BHI360_USE_THREAD
+    pthread_mutex_unlock(&job->lock);
+#endif
+}
+
+/**
+* @brief Function to upload the image to one device and boot it, as for a single device
+* @param[in] job : Upload shared by the devices
+* @param[in] md  : Device to upload to
+*/
+static void bhi360_fw_multi_upload_one(struct bhi360_fw_multi_job *job, struct bhi360_fw_multi_dev *md)
+{
+    uint16_t rom_version = 0;
+    uint32_t packet_len;
+
+    md->pos = 0;
+    md->rslt = (md->dev == NULL) ? BHI360_E_NULL_PTR : job->rslt;
+    if (md->rslt == BHI360_OK)
+    {
+        md->rslt = bhi360_get_rom_version(&rom_version, md->dev);
+    }
+
+    if ((md->rslt == BHI360_OK) && (rom_version != job->expected_version))
+    {
+        md->rslt = BHI360_E_FW_VERSION;
+    }
+
+    while ((md->rslt == BHI360_OK) && (md->pos < job->length))
+    {
+        packet_len = job->length - md->pos;
+        if (packet_len > BHI360_FW_MULTI_PACKET_LEN)
+        {
+            packet_len = BHI360_FW_MULTI_PACKET_LEN;
+        }
+
+        md->rslt = bhi360_upload_firmware_to_ram_partly(&job->firmware[md->pos],
+                                                        job->length,
+                                                        md->pos,
+                                                        packet_len,
+                                                        md->dev);
+        md->pos += packet_len;
+        bhi360_fw_multi_report(job, packet_len);
+    }
+
+    if (md->rslt == BHI360_OK)
+    {
+        md->rslt = bhi360_boot_from_ram(md->dev);
+    }
+}
+
+#ifdef BHI360_USE_THREAD
+
+/**
+* @brief Function of the worker thread of one device
+* @param[in] arg : Worker
+* @return NULL
+*/
+static void *bhi360_fw_multi_worker_thread(void *arg)
+{
+    struct bhi360_fw_multi_worker *worker = (struct bhi360_fw_multi_worker *)arg;
+
+    bhi360_fw_multi_upload_one(worker->job, worker->md);
+
+    return NULL;
+}
+
+/**
+* @brief Function to bring up the devices in parallel, one worker thread each. Devices whose
+*        thread cannot be started are brought up by the calling thread
+* @param[in] job    : Upload shared by the devices
+* @param[in] devs   : Devices to upload to
+* @param[in] n_devs : Number of devices
+*/
+static void bhi360_fw_multi_run(struct bhi360_fw_multi_job *job, struct bhi360_fw_multi_dev *devs, uint8_t n_devs)
+{
+    struct bhi360_fw_multi_worker *workers;
+
+    workers = (struct bhi360_fw_multi_worker *)calloc(n_devs, sizeof(struct bhi360_fw_multi_worker));
+    pthread_mutex_init(&job->lock, NULL);
+    for (uint8_t i = 0; (i < n_devs) && (workers != NULL); i++)
+    {
+        workers[i].job = job;
+        workers[i].md = &devs[i];
+        workers[i].started =
+            (pthread_create(&workers[i].thread, NULL, bhi360_fw_multi_worker_thread, &workers[i]) == 0);
+    }
+
+    for (uint8_t i = 0; i < n_devs; i++)
+    {
+        if ((workers != NULL) && workers[i].started)
+        {
+            pthread_join(workers[i].thread, NULL);
+        }
+        else
+        {
+            bhi360_fw_multi_upload_one(job, &devs[i]);
+        }
+    }
+
+    pthread_mutex_destroy(&job->lock);
+    free(workers);
+}
+#else
+
+/**
+* @brief Function to bring up the devices one after the other
+* @param[in] job    : Upload shared by the devices
+* @param[in] devs   : Devices to upload to
+* @param[in] n_devs : Number of devices
+*/
+static void bhi360_fw_multi_run(struct bhi360_fw_multi_job *job, struct bhi360_fw_multi_dev *devs, uint8_t n_devs)
+{
+    for (uint8_t i = 0; i < n_devs; i++)
+    {
+        bhi360_fw_multi_upload_one(job, &devs[i]);
+    }
+}
+#endif
+
+int8_t bhi360_fw_multi_upload_and_boot(const uint8_t *firmware,
+                                       uint32_t length,
+                                       struct bhi360_fw_multi_dev *devs,
+                                       uint8_t n_devs,
+                                       bhi360_fw_multi_progress_fptr_t progress,
+                                       void *private_data)
+{
+    int8_t rslt;
+    struct bhi360_fw_info info;
+    struct bhi360_fw_multi_job job;
+
+    if ((firmware != NULL) && (devs != NULL))
+    {
+        /* The image is checked once, only the ROM version per device */
+        job.rslt = bhi360_fw_verify(firmware, length, 0, &info);
+        job.firmware = firmware;
+        job.length = length;
+        job.expected_version = (job.rslt == BHI360_OK) ? info.section[0].expected_version : 0;
+        job.uploaded = 0;
+        job.total = length * n_devs;
+        job.progress = progress;
+        job.private_data = private_data;
+
+        bhi360_fw_multi_run(&job, devs, n_devs);
+
+        rslt = BHI360_OK;
+        for (uint8_t i = 0; (i < n_devs) && (rslt == BHI360_OK); i++)
+        {
+            rslt = devs[i].rslt;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
@@ -0,0 +1,108 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_fw_multi.h
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#ifndef __BHI360_FW_MULTI_H__
+#define __BHI360_FW_MULTI_H__
+
+/* Start of CPP Guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bhi360_defs.h"
+
+/*
+ * Upload of one firmware image to several devices. With BHI360_USE_THREAD each
+ * device is uploaded and booted by its own worker thread, so that devices on separate
+ * transports are brought up in parallel. The bus callbacks of different devices are then
+ * called concurrently. Without it, the devices are brought up one after the other.
+ */
+
+/*! Size of the packets uploaded to each device */
+#ifndef BHI360_FW_MULTI_PACKET_LEN
+#define BHI360_FW_MULTI_PACKET_LEN                                     UINT16_C(256)
+#endif
+
+struct bhi360_fw_multi_dev
+{
+    struct bhi360_dev *dev;
+
+    /*! Result of the upload and boot of this device */
+    int8_t rslt;
+
+    /*! Bytes uploaded */
+    uint32_t pos;
+};
+
+/**
+ * @brief Callback to report the progress of a multi device upload. With worker threads it is
+ *        called from the workers, one call at a time
+ * @param[in] uploaded     : Bytes uploaded to all devices
+ * @param[in] total        : Bytes to upload to all devices
+ * @param[in] private_data : Reference passed to bhi360_fw_multi_upload_and_boot
+ */
+typedef void (*bhi360_fw_multi_progress_fptr_t)(uint32_t uploaded, uint32_t total, void *private_data);
+
+/**
+ * @brief Function to upload a firmware image to several devices and boot them.
+ *        The image is verified once, and on each device against its ROM version. The upload
+ *        and boot times of each device are available from bhi360_get_boot_time
+ * @param[in] firmware      : Reference to the firmware image
+ * @param[in] length        : Length of the firmware image
+ * @param[in,out] devs      : Devices to upload to. The result of each is in rslt
+ * @param[in] n_devs        : Number of devices
+ * @param[in] progress      : Progress callback, can be NULL
+ * @param[in] private_data  : Reference passed to the callback
+ * @return API error codes, the first device error if any device failed
+ */
+int8_t bhi360_fw_multi_upload_and_boot(const uint8_t *firmware,
+                                       uint32_t length,
+                                       struct bhi360_fw_multi_dev *devs,
+                                       uint8_t n_devs,
+                                       bhi360_fw_multi_progress_fptr_t progress,
+                                       void *private_data);
+
+/* End of CPP Guard */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* __BHI360_FW_MULTI_H__ */
@@ -215,71 +215,238 @@ int8_t bhi360_hif_wait_status_ready(struct bhi360_hif_dev *hif)
 {
     uint16_t retry;
     uint8_t int_status;
-    int8_t rslt;
+    int8_t rslt = BHI360_E_NULL_PTR;
+    uint64_t start_us;
 
-    /* Wait status ready */
-    for (retry = 0; retry < BHI360_QUERY_PARAM_STATUS_READY_MAX_RETRY; ++retry)
+    if (hif != NULL)
     {
-        rslt = bhi360_hif_get_interrupt_status(&int_status, hif);
-        if (rslt == BHI360_OK)
+        start_us = bhi360_hif_trace_begin(hif);
+
+        /* Wait status ready */
+        for (retry = 0; retry < BHI360_QUERY_PARAM_STATUS_READY_MAX_RETRY; ++retry)
         {
-            if (int_status & BHI360_IST_MASK_STATUS)
+            rslt = bhi360_hif_get_interrupt_status(&int_status, hif);
+            if (rslt == BHI360_OK)
+            {
+                if (int_status & BHI360_IST_MASK_STATUS)
+                {
+                    rslt = BHI360_OK;
+                    break;
+                }
+
+                /* 10ms */
+                rslt = bhi360_hif_delay_us(10000, hif);
+                if (rslt != BHI360_OK)
+                {
+                    break;
+                }
+            }
+            else
             {
-                rslt = BHI360_OK;
                 break;
             }
+        }
 
-            /* 10ms */
-            rslt = bhi360_hif_delay_us(10000, hif);
-            if (rslt != BHI360_OK)
+        bhi360_hif_trace_end(BHI360_TRACE_WAIT_STATUS,
+                             0,
+                             start_us,
+                             (retry < BHI360_QUERY_PARAM_STATUS_READY_MAX_RETRY) ? (uint32_t)retry + 1 : retry,
+                             hif);
+    }
+
+    return rslt;
+}
+
+static uint64_t bhi360_hif_get_time_us(const struct bhi360_hif_dev *hif)
+{
+    uint64_t time_us = 0;
+
+    if (hif->get_time_us != NULL)
+    {
+        time_us = hif->get_time_us(hif->intf_ptr);
+    }
+
+    return time_us;
+}
+
+/**
+* @brief Function to get the class of a register in the bus statistics
+* @param[in] reg_addr : Register address, without the SPI read bit
+* @return enum bhi360_bus_class
+*/
+static uint8_t bhi360_hif_get_bus_class(uint8_t reg_addr)
+{
+    uint8_t reg_class;
+
+    switch (reg_addr)
+    {
+        case BHI360_REG_CHAN_FIFO_W:
+        case BHI360_REG_CHAN_FIFO_NW:
+        case BHI360_REG_CHAN_STATUS:
+            reg_class = BHI360_BUS_CLASS_FIFO;
+            break;
+        case BHI360_REG_CHAN_CMD:
+            reg_class = BHI360_BUS_CLASS_COMMAND;
+            break;
+        case BHI360_REG_HOST_STATUS:
+            reg_class = BHI360_BUS_CLASS_STATUS;
+            break;
+        default:
+            if ((reg_addr >= BHI360_REG_PRODUCT_ID) && (reg_addr <= BHI360_REG_DEBUG_STATE))
             {
-                return rslt;
+                reg_class = BHI360_BUS_CLASS_STATUS;
             }
+            else
+            {
+                reg_class = BHI360_BUS_CLASS_OTHER;
+            }
+
+            break;
+    }
+
+    return reg_class;
+}
+
+/**
+* @brief Function to record a transport call in the bus statistics
+* @param[in] reg_addr : Register address, without the SPI read bit
+* @param[in] write    : 1 for a write, 0 for a read
+* @param[in] length   : Length of the transfer
+* @param[in] start_us : Start of the transfer
+* @param[in] rslt     : Result of the transfer
+* @param[in] hif      : HIF device reference
+*/
+static void bhi360_hif_record_bus(uint8_t reg_addr,
+                                  uint8_t write,
+                                  uint32_t length,
+                                  uint64_t start_us,
+                                  int8_t rslt,
+                                  struct bhi360_hif_dev *hif)
+{
+    struct bhi360_bus_stats *stats = hif->bus_stats;
+    struct bhi360_bus_class_stats *reg_class = &stats->reg_class[bhi360_hif_get_bus_class(reg_addr)];
+    struct bhi360_bus_trace_entry *entry;
+    uint32_t duration_us = (uint32_t)(bhi360_hif_get_time_us(hif) - start_us);
+    uint8_t bin = 0;
+
+    while ((bin < (BHI360_BUS_STATS_N_BINS - 1)) && ((duration_us >> bin) != 0))
+    {
+        bin++;
+    }
+
+    if (write)
+    {
+        reg_class->writes++;
+        reg_class->write_bytes += length;
+        reg_class->write_hist[bin]++;
+        reg_class->write_us += duration_us;
+    }
+    else
+    {
+        reg_class->reads++;
+        reg_class->read_bytes += length;
+        reg_class->read_hist[bin]++;
+        reg_class->read_us += duration_us;
+    }
+
+    if (reg_addr < BHI360_BUS_STATS_N_REGS)
+    {
+        if (write)
+        {
+            stats->reg[reg_addr].writes++;
+            stats->reg[reg_addr].write_bytes += length;
         }
         else
         {
-            return rslt; /*break; */
+            stats->reg[reg_addr].reads++;
+            stats->reg[reg_addr].read_bytes += length;
         }
     }
 
-    return rslt;
+    if (rslt != BHI360_OK)
+    {
+        stats->errors++;
+    }
+
+    if ((stats->trace != NULL) && (stats->trace_len != 0))
+    {
+        entry = &stats->trace[stats->trace_pos];
+        entry->time_us = start_us;
+        entry->length = length;
+        entry->duration_us = duration_us;
+        entry->reg = reg_addr;
+        entry->write = write;
+        entry->rslt = rslt;
+        stats->trace_pos = (uint16_t)((stats->trace_pos + 1) % stats->trace_len);
+        stats->trace_count++;
+    }
 }
 
-static int8_t bhi360_hif_check_boot_status_ram(struct bhi360_hif_dev *hif)
+static int8_t bhi360_hif_check_boot_status_ram(uint32_t *elapsed_us, uint16_t *polls, struct bhi360_hif_dev *hif)
 {
-    int8_t rslt;
-    uint16_t i;
+    int8_t rslt = BHI360_E_TIMEOUT;
+    int8_t temp_rslt;
+    uint32_t period_us = BHI360_BST_CHECK_INIT_DELAY_US;
+    uint32_t waited_us = 0;
+    uint64_t start_us;
     uint8_t boot_status;
+    uint64_t trace_start_us = bhi360_hif_trace_begin(hif);
+
+    start_us = bhi360_hif_get_time_us(hif);
+    *polls = 0;
 
-    /* total 5s */
-    for (i = 0; i < BHI360_BST_CHECK_RETRY; ++i)
+    /* Poll with a growing interval, total 5s */
+    while (waited_us < BHI360_BST_CHECK_TIMEOUT_US)
     {
-        /* 50ms */
-        rslt = bhi360_hif_delay_us(50000, hif);
-        if (rslt < 0)
+        temp_rslt = bhi360_hif_delay_us(period_us, hif);
+        if (temp_rslt < 0)
         {
-            return rslt;
+            rslt = temp_rslt;
+            break;
         }
 
-        rslt = bhi360_hif_get_regs(BHI360_REG_BOOT_STATUS, &boot_status, sizeof(boot_status), hif);
-        if (rslt < 0)
+        waited_us += period_us;
+        (*polls)++;
+
+        temp_rslt = bhi360_hif_get_regs(BHI360_REG_BOOT_STATUS, &boot_status, sizeof(boot_status), hif);
+        if (temp_rslt < 0)
         {
-            return rslt;
+            rslt = temp_rslt;
+            break;
         }
 
         if ((boot_status & BHI360_BST_HOST_INTERFACE_READY) && (boot_status & BHI360_BST_HOST_FW_VERIFY_DONE) &&
             (!(boot_status & BHI360_BST_HOST_FW_VERIFY_ERROR)))
         {
+            rslt = BHI360_OK;
             break;
         }
+
+        period_us *= 2;
+        if (period_us > BHI360_BST_CHECK_MAX_DELAY_US)
+        {
+            period_us = BHI360_BST_CHECK_MAX_DELAY_US;
+        }
+
+        if (period_us > (BHI360_BST_CHECK_TIMEOUT_US - waited_us))
+        {
+            period_us = BHI360_BST_CHECK_TIMEOUT_US - waited_us;
+        }
     }
 
-    if (i == BHI360_BST_CHECK_RETRY)
+    /* Without a time source, only the time spent waiting is known */
+    if (hif->get_time_us != NULL)
+    {
+        *elapsed_us = (uint32_t)(bhi360_hif_get_time_us(hif) - start_us);
+    }
+    else
     {
-        return BHI360_E_TIMEOUT;
+        *elapsed_us = waited_us;
     }
 
-    return BHI360_OK;
+    bhi360_hif_trace_end(BHI360_TRACE_BOOT_POLL, 0, trace_start_us, *polls, hif);
+
+    return rslt;
 }
 
 static int8_t bhi360_hif_get_fifo(uint8_t reg,
@@ -294,9 +461,12 @@ static int8_t bhi360_hif_get_fifo(uint8_t reg,
     uint32_t read_len;
     uint32_t read_write_len;
     uint32_t offset;
+    uint64_t start_us;
+    uint8_t fifo_type;
 
     if ((hif != NULL) && (fifo != NULL) && (bytes_read != NULL) && (bytes_remain != NULL))
     {
+        start_us = bhi360_hif_trace_begin(hif);
         read_write_len = hif->read_write_len;
 
         if (*bytes_remain == 0)
@@ -337,6 +507,13 @@ static int8_t bhi360_hif_get_fifo(uint8_t reg,
 
             *bytes_remain -= *bytes_read;
         }
+
+        if (hif->trace != NULL)
+        {
+            fifo_type = (reg == BHI360_REG_CHAN_FIFO_W) ? BHI360_FIFO_TYPE_WAKEUP :
+                        (reg == BHI360_REG_CHAN_FIFO_NW) ? BHI360_FIFO_TYPE_NON_WAKEUP : BHI360_FIFO_TYPE_STATUS;
+            bhi360_hif_trace_end(BHI360_TRACE_FIFO_READ, fifo_type, start_us, *bytes_read, hif);
+        }
     }
     else
     {
@@ -361,8 +538,14 @@ int8_t bhi360_hif_init(enum bhi360_intf intf,
         hif->read = read;
         hif->write = write;
         hif->delay_us = delay_us;
+        hif->get_time_us = NULL;
         hif->intf_ptr = intf_ptr;
         hif->intf = intf;
+        memset(&hif->boot_time, 0, sizeof(hif->boot_time));
+        hif->bus_stats = NULL;
+        hif->trace = NULL;
+        hif->trace_ref = NULL;
+        hif->trace_min_callback_us = 0;
         if (read_write_len % 4)
         {
 
@@ -384,6 +567,8 @@ int8_t bhi360_hif_init(enum bhi360_intf intf,
 int8_t bhi360_hif_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t length, struct bhi360_hif_dev *hif)
 {
     int8_t rslt = BHI360_OK;
+    uint8_t reg = reg_addr;
+    uint64_t start_us = 0;
 
     if ((hif != NULL) && (hif->read != NULL) && (reg_data != NULL))
     {
@@ -392,11 +577,21 @@ int8_t bhi360_hif_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t length,
             reg_addr |= BHI360_SPI_RD_MASK;
         }
 
+        if (hif->bus_stats != NULL)
+        {
+            start_us = bhi360_hif_get_time_us(hif);
+        }
+
         hif->intf_rslt = hif->read(reg_addr, reg_data, length, hif->intf_ptr);
         if (hif->intf_rslt != BHI360_INTF_RET_SUCCESS)
         {
             rslt = BHI360_E_IO;
         }
+
+        if (hif->bus_stats != NULL)
+        {
+            bhi360_hif_record_bus(reg & (uint8_t)~BHI360_SPI_RD_MASK, 0, length, start_us, rslt, hif);
+        }
     }
     else
     {
@@ -409,6 +604,8 @@ int8_t bhi360_hif_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t length,
 int8_t bhi360_hif_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length, struct bhi360_hif_dev *hif)
 {
     int8_t rslt = BHI360_OK;
+    uint8_t reg = reg_addr;
+    uint64_t start_us = 0;
 
     if ((hif != NULL) && (hif->write != NULL) && (reg_data != NULL))
     {
@@ -417,11 +614,21 @@ int8_t bhi360_hif_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t l
             reg_addr &= BHI360_SPI_WR_MASK;
         }
 
+        if (hif->bus_stats != NULL)
+        {
+            start_us = bhi360_hif_get_time_us(hif);
+        }
+
         hif->intf_rslt = hif->write(reg_addr, reg_data, length, hif->intf_ptr);
         if (hif->intf_rslt != BHI360_INTF_RET_SUCCESS)
         {
             rslt = BHI360_E_IO;
         }
+
+        if (hif->bus_stats != NULL)
+        {
+            bhi360_hif_record_bus(reg & (uint8_t)~BHI360_SPI_RD_MASK, 1, length, start_us, rslt, hif);
+        }
     }
     else
     {
@@ -653,22 +860,19 @@ int8_t bhi360_hif_reset(struct bhi360_hif_dev *hif)
 int8_t bhi360_hif_upload_firmware_to_ram(const uint8_t *firmware, uint32_t length, struct bhi360_hif_dev *hif)
 {
     int8_t rslt = BHI360_OK;
-    uint16_t magic;
+    uint64_t start_us;
 
     if ((hif != NULL) && (firmware != NULL))
     {
-        magic = BHI360_LE2U16(firmware);
-        if (magic != BHI360_FW_MAGIC)
-        {
-            rslt = BHI360_E_MAGIC;
-        }
-        else
+        hif->boot_time.verify_us = 0;
+        hif->boot_time.verify_polls = 0;
+
+        start_us = bhi360_hif_get_time_us(hif);
+        rslt = bhi360_hif_exec_cmd(BHI360_CMD_UPLOAD_TO_PROGRAM_RAM, firmware, length, hif);
+        hif->boot_time.upload_us = (uint32_t)(bhi360_hif_get_time_us(hif) - start_us);
+        if (rslt == BHI360_OK)
         {
-            rslt = bhi360_hif_exec_cmd(BHI360_CMD_UPLOAD_TO_PROGRAM_RAM, firmware, length, hif);
-            if (rslt == BHI360_OK)
-            {
-                rslt = bhi360_hif_check_boot_status_ram(hif);
-            }
+            rslt = bhi360_hif_check_boot_status_ram(&hif->boot_time.verify_us, &hif->boot_time.verify_polls, hif);
         }
     }
     else
@@ -687,11 +891,18 @@ int8_t bhi360_hif_upload_firmware_to_ram_partly(const uint8_t *firmware,
 {
     int8_t rslt = BHI360_OK;
     uint16_t magic;
+    uint64_t start_us;
 
     if ((hif != NULL) && (firmware != NULL))
     {
+        start_us = bhi360_hif_get_time_us(hif);
+
         if (cur_pos == 0)
         {
+            hif->boot_time.upload_us = 0;
+            hif->boot_time.verify_us = 0;
+            hif->boot_time.verify_polls = 0;
+
             magic = BHI360_LE2U16(firmware);
             if (magic != BHI360_FW_MAGIC)
             {
@@ -713,6 +924,8 @@ int8_t bhi360_hif_upload_firmware_to_ram_partly(const uint8_t *firmware,
         {
             rslt = bhi360_hif_set_regs(BHI360_REG_CHAN_CMD, firmware, packet_len, hif);
         }
+
+        hif->boot_time.upload_us += (uint32_t)(bhi360_hif_get_time_us(hif) - start_us);
     }
     else
     {
@@ -725,11 +938,232 @@ int8_t bhi360_hif_upload_firmware_to_ram_partly(const uint8_t *firmware,
 int8_t bhi360_hif_boot_program_ram(struct bhi360_hif_dev *hif)
 {
     int8_t rslt;
+    uint64_t start_us;
 
-    rslt = bhi360_hif_exec_cmd(BHI360_CMD_BOOT_PROGRAM_RAM, NULL, 0, hif);
-    if (rslt == BHI360_OK)
+    if (hif != NULL)
     {
-        rslt = bhi360_hif_check_boot_status_ram(hif);
+        start_us = bhi360_hif_get_time_us(hif);
+        hif->boot_time.boot_us = 0;
+        hif->boot_time.boot_polls = 0;
+
+        rslt = bhi360_hif_exec_cmd(BHI360_CMD_BOOT_PROGRAM_RAM, NULL, 0, hif);
+        if (rslt == BHI360_OK)
+        {
+            rslt = bhi360_hif_check_boot_status_ram(&hif->boot_time.boot_us, &hif->boot_time.boot_polls, hif);
+
+            /* Include the boot command itself when it can be timed */
+            if (hif->get_time_us != NULL)
+            {
+                hif->boot_time.boot_us = (uint32_t)(bhi360_hif_get_time_us(hif) - start_us);
+            }
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_hif_set_time_source(bhi360_get_time_us_fptr_t get_time_us, struct bhi360_hif_dev *hif)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (hif != NULL)
+    {
+        hif->get_time_us = get_time_us;
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_hif_set_bus_stats(struct bhi360_bus_stats *bus_stats, struct bhi360_hif_dev *hif)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (hif != NULL)
+    {
+        hif->bus_stats = bus_stats;
+        rslt = bhi360_hif_reset_bus_stats(hif);
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_hif_reset_bus_stats(struct bhi360_hif_dev *hif)
+{
+    int8_t rslt = BHI360_OK;
+    struct bhi360_bus_trace_entry *trace;
+    uint16_t trace_len;
+
+    if (hif != NULL)
+    {
+        /* The trace buffer stays attached */
+        if (hif->bus_stats != NULL)
+        {
+            trace = hif->bus_stats->trace;
+            trace_len = hif->bus_stats->trace_len;
+            memset(hif->bus_stats, 0, sizeof(struct bhi360_bus_stats));
+            hif->bus_stats->trace = trace;
+            hif->bus_stats->trace_len = trace_len;
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_hif_set_trace(bhi360_trace_fptr_t trace,
+                            void *trace_ref,
+                            uint32_t min_callback_us,
+                            struct bhi360_hif_dev *hif)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (hif != NULL)
+    {
+        hif->trace = trace;
+        hif->trace_ref = trace_ref;
+        hif->trace_min_callback_us = min_callback_us;
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+uint64_t bhi360_hif_trace_begin(const struct bhi360_hif_dev *hif)
+{
+    uint64_t start_us = 0;
+
+    if ((hif != NULL) && (hif->trace != NULL))
+    {
+        start_us = bhi360_hif_get_time_us(hif);
+    }
+
+    return start_us;
+}
+
+void bhi360_hif_trace_end(enum bhi360_trace_type type,
+                          uint8_t fifo_type,
+                          uint64_t start_us,
+                          uint32_t arg,
+                          const struct bhi360_hif_dev *hif)
+{
+    struct bhi360_trace_event event;
+
+    if ((hif != NULL) && (hif->trace != NULL))
+    {
+        event.start_us = start_us;
+        event.duration_us = (uint32_t)(bhi360_hif_get_time_us(hif) - start_us);
+        event.arg = arg;
+        event.type = type;
+        event.fifo_type = fifo_type;
+
+        /* Only slow callbacks are reported */
+        if ((type != BHI360_TRACE_CALLBACK) || (event.duration_us >= hif->trace_min_callback_us))
+        {
+            hif->trace(&event, hif->trace_ref);
+        }
+    }
+}
+
+int8_t bhi360_hif_get_boot_time(struct bhi360_boot_time *boot_time, const struct bhi360_hif_dev *hif)
+{
+    int8_t rslt = BHI360_OK;
+
+    if ((hif != NULL) && (boot_time != NULL))
+    {
+        *boot_time = hif->boot_time;
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_hif_get_reg_snapshot(struct bhi360_reg_snapshot *snapshot, struct bhi360_hif_dev *hif)
+{
+    int8_t rslt;
+    uint8_t regs[BHI360_REG_SNAPSHOT_LEN];
+
+    if (snapshot != NULL)
+    {
+        rslt = bhi360_hif_get_regs(BHI360_REG_PRODUCT_ID, regs, sizeof(regs), hif);
+        if (rslt == BHI360_OK)
+        {
+            snapshot->product_id = regs[BHI360_REG_PRODUCT_ID - BHI360_REG_PRODUCT_ID];
+            snapshot->revision_id = regs[BHI360_REG_REVISION_ID - BHI360_REG_PRODUCT_ID];
+            snapshot->rom_version = BHI360_LE2U16(&regs[BHI360_REG_ROM_VERSION_0 - BHI360_REG_PRODUCT_ID]);
+            snapshot->kernel_version = BHI360_LE2U16(&regs[BHI360_REG_KERNEL_VERSION_0 - BHI360_REG_PRODUCT_ID]);
+            snapshot->user_version = BHI360_LE2U16(&regs[BHI360_REG_USER_VERSION_0 - BHI360_REG_PRODUCT_ID]);
+            snapshot->feature_status = regs[BHI360_REG_FEATURE_STATUS - BHI360_REG_PRODUCT_ID];
+            snapshot->boot_status = regs[BHI360_REG_BOOT_STATUS - BHI360_REG_PRODUCT_ID];
+            snapshot->host_intr_time = BHI360_LE2U40(&regs[BHI360_REG_HOST_INTR_TIME_0 - BHI360_REG_PRODUCT_ID]);
+            snapshot->chip_id = regs[BHI360_REG_CHIP_ID - BHI360_REG_PRODUCT_ID];
+            snapshot->int_status = regs[BHI360_REG_INT_STATUS - BHI360_REG_PRODUCT_ID];
+            snapshot->error_value = regs[BHI360_REG_ERROR_VALUE - BHI360_REG_PRODUCT_ID];
+            snapshot->error_aux = regs[BHI360_REG_ERROR_AUX - BHI360_REG_PRODUCT_ID];
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+int8_t bhi360_hif_check_fw_running(uint32_t crc,
+                                   uint16_t kernel_version,
+                                   uint16_t user_version,
+                                   uint8_t *running,
+                                   struct bhi360_hif_dev *hif)
+{
+    int8_t rslt;
+    uint8_t regs[BHI360_REG_BOOT_STATUS - BHI360_REG_CRC_0 + 1];
+    uint8_t boot_status;
+
+    if ((hif != NULL) && (running != NULL))
+    {
+        *running = 0;
+
+        /* CRC, versions and boot status in one read */
+        rslt = bhi360_hif_get_regs(BHI360_REG_CRC_0, regs, sizeof(regs), hif);
+        if (rslt == BHI360_OK)
+        {
+            boot_status = regs[BHI360_REG_BOOT_STATUS - BHI360_REG_CRC_0];
+
+            /* The kernel version reads 0 until a firmware booted, so a fresh device never matches */
+            if ((boot_status & BHI360_BST_HOST_INTERFACE_READY) && !(boot_status & BHI360_BST_HOST_FW_VERIFY_ERROR) &&
+                (BHI360_LE2U16(&regs[BHI360_REG_KERNEL_VERSION_0 - BHI360_REG_CRC_0]) == kernel_version) &&
+                ((user_version == 0) ||
+                 (BHI360_LE2U16(&regs[BHI360_REG_USER_VERSION_0 - BHI360_REG_CRC_0]) == user_version)) &&
+                (BHI360_LE2U32(regs) == crc))
+            {
+                *running = 1;
+            }
+        }
+    }
+    else
+    {
+        rslt = BHI360_E_NULL_PTR;
     }
 
     return rslt;
@@ -267,6 +267,98 @@ int8_t bhi360_hif_upload_firmware_to_ram_partly(const uint8_t *firmware,
  */
 int8_t bhi360_hif_boot_program_ram(struct bhi360_hif_dev *hif);
 
+/**
+ * @brief Function to set the host time source used for the boot time measurement
+ * @param[in] get_time_us : Function returning a monotonic time in microseconds. NULL to disable
+ * @param[in] hif         : HIF device reference
+ * @return API error codes
+ */
+int8_t bhi360_hif_set_time_source(bhi360_get_time_us_fptr_t get_time_us, struct bhi360_hif_dev *hif);
+
+/**
+ * @brief Function to get the time spent in the last upload, verification and boot
+ * @param[out] boot_time : Reference to the boot time breakdown
+ * @param[in] hif        : HIF device reference
+ * @return API error codes
+ */
+int8_t bhi360_hif_get_boot_time(struct bhi360_boot_time *boot_time, const struct bhi360_hif_dev *hif);
+
+/**
+ * @brief Function to set the callback receiving the driver activity as trace events
+ * @param[in] trace           : Trace callback, NULL to stop tracing
+ * @param[in] trace_ref       : Reference passed to the callback
+ * @param[in] min_callback_us : Callbacks faster than this are not reported
+ * @param[in] hif             : HIF device reference
+ * @return API error codes
+ */
+int8_t bhi360_hif_set_trace(bhi360_trace_fptr_t trace,
+                            void *trace_ref,
+                            uint32_t min_callback_us,
+                            struct bhi360_hif_dev *hif);
+
+/**
+ * @brief Function to get the start time of a traced span
+ * @param[in] hif : HIF device reference
+ * @return Time from the time source, 0 when not tracing
+ */
+uint64_t bhi360_hif_trace_begin(const struct bhi360_hif_dev *hif);
+
+/**
+ * @brief Function to report a span to the trace callback, if one is set
+ * @param[in] type      : Type of activity
+ * @param[in] fifo_type : FIFO concerned, if any
+ * @param[in] start_us  : Start time from bhi360_hif_trace_begin
+ * @param[in] arg       : Argument of the activity, see enum bhi360_trace_type
+ * @param[in] hif       : HIF device reference
+ */
+void bhi360_hif_trace_end(enum bhi360_trace_type type,
+                          uint8_t fifo_type,
+                          uint64_t start_us,
+                          uint32_t arg,
+                          const struct bhi360_hif_dev *hif);
+
+/**
+ * @brief Function to attach the statistics updated by every register read and write.
+ *        The statistics are reset, a trace buffer set in them before is kept
+ * @param[in] bus_stats : Reference to the statistics, NULL to stop collecting them
+ * @param[in] hif       : HIF device reference
+ * @return API error codes
+ */
+int8_t bhi360_hif_set_bus_stats(struct bhi360_bus_stats *bus_stats, struct bhi360_hif_dev *hif);
+
+/**
+ * @brief Function to reset the attached bus statistics, keeping the trace buffer
+ * @param[in] hif : HIF device reference
+ * @return API error codes
+ */
+int8_t bhi360_hif_reset_bus_stats(struct bhi360_hif_dev *hif);
+
+/**
+ * @brief Function to read the identity and status registers from the product ID to the
+ *        error aux register in one transfer
+ * @param[out] snapshot : Reference to the decoded registers
+ * @param[in] hif       : HIF device reference
+ * @return API error codes
+ */
+int8_t bhi360_hif_get_reg_snapshot(struct bhi360_reg_snapshot *snapshot, struct bhi360_hif_dev *hif);
+
+/**
+ * @brief Function to check if a firmware image is already running from RAM. The boot status,
+ *        the kernel and user versions and the CRC of the uploaded data are compared with those
+ *        of the image
+ * @param[in] crc            : CRC of the firmware image
+ * @param[in] kernel_version : Kernel version of the image
+ * @param[in] user_version   : User version of the image, 0 if it has no user section
+ * @param[out] running       : 1 if the image is running, 0 if it has to be uploaded
+ * @param[in] hif            : HIF device reference
+ * @return API error codes
+ */
+int8_t bhi360_hif_check_fw_running(uint32_t crc,
+                                   uint16_t kernel_version,
+                                   uint16_t user_version,
+                                   uint8_t *running,
+                                   struct bhi360_hif_dev *hif);
+
 /**
  * @brief Function to get data from the Wake-up FIFO
  * @param[out] fifo         : Reference to the data buffer to store data from the FIFO
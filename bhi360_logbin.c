@@ -36,8 +36,514 @@
 *
 */
 
+/* ftello, with 64-bit file offsets on 32-bit targets */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE    200112L
+#endif
+
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS  64
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bhi360_defs.h"
 #include "bhi360_logbin.h"
 
+#ifdef PC
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#endif
+
+/**
+* @brief Function to get the position of a file, with a 64-bit offset for files over 2 GiB
+* @param[in] file   : File
+* @return Position
+*/
+static uint64_t tell_file(FILE *file)
+{
+#ifdef _WIN32
+    return (uint64_t)_ftelli64(file);
+#else
+    return (uint64_t)ftello(file);
+#endif
+}
+
+/**
+* @brief Function to commit the data written to a file to the storage
+* @param[in] file   : File
+*/
+static void sync_file(FILE *file)
+{
+    fflush(file);
+#ifdef PC
+#ifdef _WIN32
+    (void)_commit(_fileno(file));
+#else
+    (void)fsync(fileno(file));
+#endif
+#endif
+}
+
+#ifdef BHI360_USE_THREAD
+#include <pthread.h>
+
+struct logbin_async
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    FILE *logfile;
+    const uint8_t *data; /* Half handed to the thread, NULL once written */
+    uint32_t length;
+    bool quit;
+    uint8_t sync;
+};
+
+/**
+* @brief Function of the writer thread, writing each half it is handed
+* @param[in] arg    : Writer thread instance
+* @return NULL
+*/
+static void *write_thread(void *arg)
+{
+    struct logbin_async *async = (struct logbin_async *)arg;
+    const uint8_t *data;
+
+    pthread_mutex_lock(&async->lock);
+    while (!async->quit || async->data)
+    {
+        if (async->data)
+        {
+            data = async->data;
+            pthread_mutex_unlock(&async->lock);
+            fwrite(data, 1, async->length, async->logfile);
+            if (async->sync)
+            {
+                sync_file(async->logfile);
+            }
+
+            pthread_mutex_lock(&async->lock);
+            async->data = NULL;
+            pthread_cond_broadcast(&async->cond);
+        }
+        else
+        {
+            pthread_cond_wait(&async->cond, &async->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&async->lock);
+
+    return NULL;
+}
+
+/**
+* @brief Function to wait until the writer thread has written the half it was handed
+* @param[in] async  : Writer thread instance
+*/
+static void wait_write_done(struct logbin_async *async)
+{
+    pthread_mutex_lock(&async->lock);
+    while (async->data)
+    {
+        pthread_cond_wait(&async->cond, &async->lock);
+    }
+
+    pthread_mutex_unlock(&async->lock);
+}
+#endif
+
+/**
+* @brief Function to write out the half of the staging buffer being filled
+* @param[in] dev    : Device instance for binary log
+*/
+static void write_buffer(struct bhi360_logbin_dev *dev)
+{
+    const uint8_t *data = &dev->buffer[dev->active * dev->buffer_size];
+
+    if (dev->buffer_len != 0)
+    {
+#ifdef BHI360_USE_THREAD
+        struct logbin_async *async = (struct logbin_async *)dev->async;
+
+        if (async)
+        {
+            /* Hand the half over and fill the other one */
+            pthread_mutex_lock(&async->lock);
+            while (async->data)
+            {
+                pthread_cond_wait(&async->cond, &async->lock);
+            }
+
+            async->logfile = dev->logfile;
+            async->sync = dev->sync;
+            async->data = data;
+            async->length = dev->buffer_len;
+            pthread_cond_broadcast(&async->cond);
+            pthread_mutex_unlock(&async->lock);
+            dev->active ^= 1;
+        }
+        else
+#endif
+        {
+            fwrite(data, 1, dev->buffer_len, dev->logfile);
+            if (dev->sync)
+            {
+                sync_file(dev->logfile);
+            }
+        }
+
+        dev->buffer_len = 0;
+    }
+}
+
+/**
+* @brief Function to write out all staged events, so that the log file can be written directly
+* @param[in] dev    : Device instance for binary log
+*/
+static void drain_buffer(struct bhi360_logbin_dev *dev)
+{
+    if (dev->buffer)
+    {
+        write_buffer(dev);
+#ifdef BHI360_USE_THREAD
+        if (dev->async)
+        {
+            wait_write_done((struct logbin_async *)dev->async);
+        }
+#endif
+    }
+}
+
+/**
+* @brief Function to write data through the staging buffer, if any
+* @param[in] data   : Data
+* @param[in] length : Length of the data
+* @param[in] dev    : Device instance for binary log
+*/
+static void write_out(const uint8_t *data, uint32_t length, struct bhi360_logbin_dev *dev)
+{
+    uint32_t part;
+
+    if (dev->buffer)
+    {
+        while (length != 0)
+        {
+            if (dev->buffer_len == dev->buffer_size)
+            {
+                write_buffer(dev);
+            }
+
+            part = dev->buffer_size - dev->buffer_len;
+            if (part > length)
+            {
+                part = length;
+            }
+
+            memcpy(&dev->buffer[(dev->active * dev->buffer_size) + dev->buffer_len], data, part);
+            dev->buffer_len += part;
+            data += part;
+            length -= part;
+        }
+    }
+    else
+    {
+        fwrite(data, 1, length, dev->logfile);
+    }
+}
+
+/**
+* @brief Function to store a value in little endian
+* @param[out] dst   : Destination
+* @param[in] value  : Value
+* @param[in] size   : Size of the value in bytes
+*/
+static void put_le(uint8_t *dst, uint64_t value, uint8_t size)
+{
+    for (uint8_t i = 0; i < size; i++)
+    {
+        dst[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/**
+* @brief Function to store a chunk header, without the marker
+* @param[out] dst   : Destination
+* @param[in] chunk  : Chunk
+* @return Bytes stored
+*/
+static uint8_t put_chunk_info(uint8_t *dst, const struct bhi360_logbin_chunk *chunk)
+{
+    dst[0] = chunk->sensor_id;
+    dst[1] = chunk->event_size;
+    dst[2] = chunk->codec;
+    put_le(&dst[3], chunk->count, 4);
+    put_le(&dst[7], chunk->start_time_ns, 8);
+    put_le(&dst[15], chunk->end_time_ns, 8);
+    put_le(&dst[23], chunk->size, 4);
+
+    return LOGBIN_CHUNK_HEADER_SIZE - 1;
+}
+
+/**
+* @brief Function to write the chunk of a column and add it to the index
+* @param[in] column : Column
+* @param[in] dev    : Device instance for binary log
+*/
+static void write_chunk(struct bhi360_logbin_column *column, struct bhi360_logbin_dev *dev)
+{
+    struct bhi360_logbin_v2 *v2 = dev->v2;
+    struct bhi360_logbin_chunk *chunk = &column->chunk;
+    struct bhi360_logbin_chunk *index;
+    uint8_t header[LOGBIN_CHUNK_HEADER_SIZE];
+    uint32_t raw_size = chunk->count * (LOGBIN_TIME_NS_SIZE + chunk->event_size);
+
+    chunk->codec = v2->codec[chunk->sensor_id];
+    chunk->size = 0;
+    chunk->offset = v2->offset;
+    if (chunk->codec != LOGBIN_CODEC_RAW)
+    {
+        chunk->size = bhi360_logbin_encode(chunk->codec,
+                                           chunk->start_time_ns,
+                                           column->time_ns,
+                                           column->payload,
+                                           chunk->event_size,
+                                           chunk->count,
+                                           v2->encoded,
+                                           raw_size);
+    }
+
+    if (chunk->size == 0)
+    {
+        chunk->codec = LOGBIN_CODEC_RAW;
+        chunk->size = raw_size;
+        for (uint32_t i = 0; i < chunk->count; i++)
+        {
+            put_le(&v2->encoded[i * LOGBIN_TIME_NS_SIZE], column->time_ns[i], LOGBIN_TIME_NS_SIZE);
+        }
+
+        memcpy(&v2->encoded[chunk->count * LOGBIN_TIME_NS_SIZE],
+               column->payload,
+               chunk->count * chunk->event_size);
+    }
+
+    header[0] = LOGBIN_CHUNK_MARKER;
+    (void)put_chunk_info(&header[1], chunk);
+    write_out(header, LOGBIN_CHUNK_HEADER_SIZE, dev);
+    write_out(v2->encoded, chunk->size, dev);
+    v2->offset += LOGBIN_CHUNK_HEADER_SIZE + chunk->size;
+    if (dev->rotation)
+    {
+        dev->rotation->bytes += LOGBIN_CHUNK_HEADER_SIZE + chunk->size;
+    }
+
+    if (v2->index_len == v2->index_size)
+    {
+        index = (struct bhi360_logbin_chunk *)realloc(v2->index,
+                                                      (v2->index_size + 256) * sizeof(struct bhi360_logbin_chunk));
+        if (index)
+        {
+            v2->index = index;
+            v2->index_size += 256;
+        }
+    }
+
+    /* Without memory the chunk is left out of the index, it can still be found by scanning */
+    if (v2->index_len < v2->index_size)
+    {
+        v2->index[v2->index_len++] = *chunk;
+    }
+
+    chunk->count = 0;
+}
+
+/**
+* @brief Function to get the column of a sensor, starting a chunk if needed
+* @param[in] sensor_id  : Sensor ID
+* @param[in] event_size : Event size
+* @param[in] dev        : Device instance for binary log
+* @return Column with room for one more event
+*/
+static struct bhi360_logbin_column *get_column(uint8_t sensor_id, uint8_t event_size, struct bhi360_logbin_dev *dev)
+{
+    struct bhi360_logbin_v2 *v2 = dev->v2;
+    struct bhi360_logbin_column *column = NULL;
+    struct bhi360_logbin_column *free_column = NULL;
+    struct bhi360_logbin_column *oldest = &v2->column[0];
+
+    for (uint8_t i = 0; (i < LOGBIN_OPEN_CHUNKS) && !column; i++)
+    {
+        if (v2->column[i].chunk.count == 0)
+        {
+            free_column = free_column ? free_column : &v2->column[i];
+        }
+        else if (v2->column[i].chunk.sensor_id == sensor_id)
+        {
+            column = &v2->column[i];
+        }
+        else if (v2->column[i].last_use < oldest->last_use)
+        {
+            oldest = &v2->column[i];
+        }
+    }
+
+    if (column && ((column->chunk.event_size != event_size) || (column->chunk.count == LOGBIN_CHUNK_EVENTS) ||
+                   (((column->chunk.count + 1) * event_size) > LOGBIN_CHUNK_PAYLOAD_SIZE)))
+    {
+        write_chunk(column, dev);
+    }
+
+    if (!column)
+    {
+        /* All columns busy, make room with the least recently used one */
+        column = free_column;
+        if (!column)
+        {
+            column = oldest;
+            write_chunk(column, dev);
+        }
+    }
+
+    if (column->chunk.count == 0)
+    {
+        column->chunk.sensor_id = sensor_id;
+        column->chunk.event_size = event_size;
+    }
+
+    column->last_use = ++v2->use;
+
+    return column;
+}
+
+/**
+* @brief Function to add an event to the chunk of its sensor
+* @param[in] sensor_id     : Sensor ID
+* @param[in] time_ns       : Timestamp (ns)
+* @param[in] event_size    : Event size
+* @param[in] event_payload : Event payload
+* @param[in] dev           : Device instance for binary log
+*/
+static void add_data_v2(uint8_t sensor_id,
+                        uint64_t time_ns,
+                        uint8_t event_size,
+                        const uint8_t *event_payload,
+                        struct bhi360_logbin_dev *dev)
+{
+    struct bhi360_logbin_column *column = get_column(sensor_id, event_size, dev);
+    struct bhi360_logbin_chunk *chunk = &column->chunk;
+
+    if (chunk->count == 0)
+    {
+        chunk->start_time_ns = time_ns;
+        chunk->end_time_ns = time_ns;
+    }
+    else if (time_ns < chunk->start_time_ns)
+    {
+        chunk->start_time_ns = time_ns;
+    }
+    else if (time_ns > chunk->end_time_ns)
+    {
+        chunk->end_time_ns = time_ns;
+    }
+
+    column->time_ns[chunk->count] = time_ns;
+    memcpy(&column->payload[chunk->count * event_size], event_payload, event_size);
+    chunk->count++;
+}
+
+/**
+* @brief Function to open the current file of the ring
+* @param[in] dev    : Device instance for binary log
+*/
+static void open_ring_file(struct bhi360_logbin_dev *dev)
+{
+    struct bhi360_logbin_rotation *rotation = dev->rotation;
+
+    snprintf(dev->logfilename, sizeof(dev->logfilename), "%s.%u", rotation->base_name, rotation->file);
+    dev->logfile = fopen(dev->logfilename, "wb");
+    rotation->rslt = dev->logfile ? BHI360_OK : BHI360_E_IO;
+    rotation->bytes = 0;
+    rotation->started = 0;
+}
+
+/**
+* @brief Function to start a ring of files, ending and closing the log file that is open
+* @param[in] rotation        : Rotation state
+* @param[in] base_name       : Base name of the files
+* @param[in] n_files         : Number of files
+* @param[in] max_bytes       : Size of the event data of a file, 0 for no limit
+* @param[in] max_duration_ns : Time of the events of a file in nanoseconds, 0 for no limit
+* @param[in] dev             : Device instance for binary log
+* @return API error codes
+*/
+static int8_t start_rotation(struct bhi360_logbin_rotation *rotation,
+                             const char *base_name,
+                             uint8_t n_files,
+                             uint32_t max_bytes,
+                             uint64_t max_duration_ns,
+                             struct bhi360_logbin_dev *dev)
+{
+    if (dev->logfile)
+    {
+        bhi360_logbin_end_data(dev);
+        fclose(dev->logfile);
+        dev->logfile = NULL;
+    }
+
+    memset(rotation, 0, sizeof(struct bhi360_logbin_rotation));
+    snprintf(rotation->base_name, sizeof(rotation->base_name), "%s", base_name);
+    rotation->n_files = n_files;
+    rotation->max_bytes = max_bytes;
+    rotation->max_duration_ns = max_duration_ns;
+    dev->rotation = rotation;
+    open_ring_file(dev);
+
+    return rotation->rslt;
+}
+
+/**
+* @brief Function to move to the next file of the ring when the current one is full
+* @param[in] time_ns : Timestamp of the next event
+* @param[in] dev     : Device instance for binary log
+*/
+static void check_rotation(uint64_t time_ns, struct bhi360_logbin_dev *dev)
+{
+    struct bhi360_logbin_rotation *rotation = dev->rotation;
+
+    if (!rotation->started)
+    {
+        rotation->start_time_ns = time_ns;
+        rotation->started = 1;
+    }
+    else if ((rotation->max_bytes && (rotation->bytes >= rotation->max_bytes)) ||
+             (rotation->max_duration_ns && (time_ns > rotation->start_time_ns) &&
+              ((time_ns - rotation->start_time_ns) >= rotation->max_duration_ns)))
+    {
+        bhi360_logbin_end_data(dev);
+        sync_file(dev->logfile);
+        fclose(dev->logfile);
+
+        rotation->file = (uint8_t)((rotation->file + 1) % rotation->n_files);
+        rotation->rotations++;
+        open_ring_file(dev);
+
+        if (dev->logfile)
+        {
+            bhi360_logbin_start_meta(dev);
+            fwrite(rotation->meta, 1, rotation->meta_len, dev->logfile);
+            bhi360_logbin_end_meta(dev);
+            rotation->start_time_ns = time_ns;
+            rotation->started = 1;
+        }
+    }
+}
+
 /**
 * @brief Function to start logging meta data
 * @param[in] dev    : Device instance for binary log
@@ -46,7 +552,8 @@ void bhi360_logbin_start_meta(struct bhi360_logbin_dev *dev)
 {
     if (dev && dev->logfile)
     {
-        fprintf(dev->logfile, "%s\n", LOGBIN_VERSION);
+        drain_buffer(dev);
+        fprintf(dev->logfile, "%s\n", dev->v2 ? LOGBIN_VERSION_2 : LOGBIN_VERSION);
         dev->last_time_ns = 0;
     }
 }
@@ -69,10 +576,41 @@ void bhi360_logbin_add_meta(uint8_t sensor_id,
                             float scaling,
                             const struct bhi360_logbin_dev *dev)
 {
+    struct bhi360_logbin_rotation *rotation;
+    int len;
+
     if (dev && dev->logfile)
     {
         fprintf(dev->logfile, "%u: %s: %u: %s: %s: %f\n", sensor_id, name, event_size, parse_format, axis_names,
                 scaling);
+
+        /* Kept for the next files of the ring */
+        rotation = dev->rotation;
+        if (rotation && (rotation->meta_len < sizeof(rotation->meta)))
+        {
+            len = snprintf(&rotation->meta[rotation->meta_len],
+                           sizeof(rotation->meta) - rotation->meta_len,
+                           "%u: %s: %u: %s: %s: %f\n",
+                           sensor_id,
+                           name,
+                           event_size,
+                           parse_format,
+                           axis_names,
+                           scaling);
+            if ((len > 0) && ((rotation->meta_len + len) < (int)sizeof(rotation->meta)))
+            {
+                rotation->meta_len += (uint16_t)len;
+            }
+            else
+            {
+                rotation->meta[rotation->meta_len] = '\0';
+            }
+        }
+    }
+
+    if (dev && dev->summary)
+    {
+        (void)bhi360_logbin_summary_add_sensor(sensor_id, parse_format, scaling, dev->summary);
     }
 }
 
@@ -84,8 +622,13 @@ void bhi360_logbin_end_meta(struct bhi360_logbin_dev *dev)
 {
     if (dev && dev->logfile)
     {
+        drain_buffer(dev);
         fprintf(dev->logfile, "\n");
         dev->last_time_ns = 0;
+        if (dev->v2)
+        {
+            dev->v2->offset = tell_file(dev->logfile);
+        }
     }
 }
 
@@ -103,18 +646,598 @@ void bhi360_logbin_add_data(uint8_t sensor_id,
                             const uint8_t *event_payload,
                             struct bhi360_logbin_dev *dev)
 {
-    const uint8_t time_ns_id = LOGBIN_META_ID_TIME_NS;
+    uint8_t direct[LOGBIN_MAX_RECORD_SIZE];
+    uint8_t *record = direct;
+    uint16_t length = 1 + event_size;
 
-    if (dev && dev->logfile)
+    if (dev && dev->summary)
+    {
+        bhi360_logbin_summary_add(sensor_id, time_ns, event_size, event_payload, dev->summary);
+    }
+
+    if (dev && dev->logfile && dev->rotation)
+    {
+        check_rotation(time_ns, dev);
+    }
+
+    if (dev && dev->logfile && dev->v2)
+    {
+        add_data_v2(sensor_id, time_ns, event_size, event_payload, dev);
+    }
+    else if (dev && dev->logfile)
     {
         if (time_ns > dev->last_time_ns)
         {
-            fwrite(&time_ns_id, 1, 1, dev->logfile);
-            fwrite(&time_ns, 1, LOGBIN_TIME_NS_SIZE, dev->logfile);
+            length += 1 + LOGBIN_TIME_NS_SIZE;
+        }
+
+        if (dev->buffer)
+        {
+            if ((dev->buffer_len + length) > dev->buffer_size)
+            {
+                write_buffer(dev);
+            }
+
+            record = &dev->buffer[(dev->active * dev->buffer_size) + dev->buffer_len];
+        }
+
+        /* Build the whole record, to copy or write it at once */
+        if (time_ns > dev->last_time_ns)
+        {
+            *record++ = LOGBIN_META_ID_TIME_NS;
+            memcpy(record, &time_ns, LOGBIN_TIME_NS_SIZE);
+            record += LOGBIN_TIME_NS_SIZE;
             dev->last_time_ns = time_ns;
         }
 
-        fwrite(&sensor_id, 1, 1, dev->logfile);
-        fwrite(event_payload, 1, event_size, dev->logfile);
+        *record++ = sensor_id;
+        memcpy(record, event_payload, event_size);
+
+        if (dev->rotation)
+        {
+            dev->rotation->bytes += length;
+        }
+
+        if (dev->buffer)
+        {
+            dev->buffer_len += length;
+        }
+        else
+        {
+            fwrite(direct, 1, length, dev->logfile);
+        }
+    }
+}
+
+/**
+* @brief Function to set the format of the next log file, before bhi360_logbin_start_meta.
+*        Version 2.0 needs bhi360_logbin_end_data once the last event is added
+* @param[in] format : LOGBIN_FORMAT_V1 or LOGBIN_FORMAT_V2
+* @param[in] dev    : Device instance for binary log
+* @return API error codes. BHI360_E_BUFFER if there is no memory for version 2.0, the log then stays
+*         at version 1.0
+*/
+int8_t bhi360_logbin_set_format(uint8_t format, struct bhi360_logbin_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev == NULL)
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else if ((format != LOGBIN_FORMAT_V1) && (format != LOGBIN_FORMAT_V2))
+    {
+        rslt = BHI360_E_INVALID_PARAM;
+    }
+    else if ((format == LOGBIN_FORMAT_V2) && !dev->v2)
+    {
+        dev->v2 = (struct bhi360_logbin_v2 *)calloc(1, sizeof(struct bhi360_logbin_v2));
+        if (!dev->v2)
+        {
+            /* Without memory for the chunks, the log stays at version 1.0 */
+            rslt = BHI360_E_BUFFER;
+        }
+    }
+    else if (format == LOGBIN_FORMAT_V1)
+    {
+        bhi360_logbin_release(dev);
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to release the chunks and the index of version 2.0, after the last
+*        bhi360_logbin_end_data. Later log files are version 1.0 until bhi360_logbin_set_format
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_release(struct bhi360_logbin_dev *dev)
+{
+    if (dev && dev->v2)
+    {
+        free(dev->v2->index);
+        free(dev->v2);
+        dev->v2 = NULL;
+    }
+}
+
+/**
+* @brief Function to set the codec of the chunks of a sensor, after bhi360_logbin_set_format.
+*        Chunks the codec does not apply to or does not make smaller are stored raw
+* @param[in] sensor_id : Sensor ID
+* @param[in] codec     : LOGBIN_CODEC_RAW, LOGBIN_CODEC_S16 or LOGBIN_CODEC_QUAT
+* @param[in] dev       : Device instance for binary log
+*/
+void bhi360_logbin_set_codec(uint8_t sensor_id, uint8_t codec, struct bhi360_logbin_dev *dev)
+{
+    if (dev && dev->v2)
+    {
+        dev->v2->codec[sensor_id] = codec;
+    }
+}
+
+/**
+* @brief Function to end the data of a log file. For version 2.0 it writes the remaining
+*        chunks and the index. Call it before closing the log file
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_end_data(struct bhi360_logbin_dev *dev)
+{
+    struct bhi360_logbin_v2 *v2;
+    struct bhi360_logbin_column *first;
+    uint8_t entry[LOGBIN_INDEX_ENTRY_SIZE];
+    uint8_t trailer[LOGBIN_TRAILER_SIZE];
+
+    if (dev && dev->logfile && dev->v2)
+    {
+        v2 = dev->v2;
+
+        /* Remaining chunks in order of time */
+        do
+        {
+            first = NULL;
+            for (uint8_t i = 0; i < LOGBIN_OPEN_CHUNKS; i++)
+            {
+                if ((v2->column[i].chunk.count != 0) &&
+                    (!first || (v2->column[i].chunk.start_time_ns < first->chunk.start_time_ns)))
+                {
+                    first = &v2->column[i];
+                }
+            }
+
+            if (first)
+            {
+                write_chunk(first, dev);
+            }
+        } while (first);
+
+        for (uint32_t i = 0; i < v2->index_len; i++)
+        {
+            put_le(&entry[put_chunk_info(entry, &v2->index[i])], v2->index[i].offset, 8);
+            write_out(entry, LOGBIN_INDEX_ENTRY_SIZE, dev);
+        }
+
+        put_le(trailer, v2->offset, 8);
+        put_le(&trailer[8], v2->index_len, 4);
+        memcpy(&trailer[12], LOGBIN_V2_MAGIC, 4);
+        write_out(trailer, LOGBIN_TRAILER_SIZE, dev);
+
+        v2->index_len = 0;
+        v2->offset = 0;
+        v2->use = 0;
+    }
+
+    bhi360_logbin_flush(dev);
+}
+
+/**
+* @brief Function to commit each batch of the staging buffer and each flush to the storage,
+*        so that a power loss loses at most the data of one batch
+* @param[in] enable : 1 to commit, 0 to leave it to the operating system
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_set_sync(uint8_t enable, struct bhi360_logbin_dev *dev)
+{
+    if (dev)
+    {
+        if (dev->logfile)
+        {
+            drain_buffer(dev);
+        }
+
+        dev->sync = enable;
+    }
+}
+
+/**
+* @brief Function to log to a ring of files named <base name>.0 to <base name>.<n_files - 1>.
+*        The first file is opened here. Once a file reaches the size or the duration, it is
+*        ended and closed, and the next one is overwritten, starting with the meta data again
+*        so that each file can be read alone. Call it before bhi360_logbin_start_meta
+* @param[in] rotation       : Rotation state, NULL to stop rotating
+* @param[in] base_name      : Base name of the files
+* @param[in] n_files        : Number of files
+* @param[in] max_bytes      : Size of the event data of a file, 0 for no limit
+* @param[in] max_duration_s : Time of the events of a file in seconds, 0 for no limit
+* @param[in] dev            : Device instance for binary log
+* @return API error codes. BHI360_E_IO if the first file cannot be opened
+*/
+int8_t bhi360_logbin_set_rotation(struct bhi360_logbin_rotation *rotation,
+                                  const char *base_name,
+                                  uint8_t n_files,
+                                  uint32_t max_bytes,
+                                  uint32_t max_duration_s,
+                                  struct bhi360_logbin_dev *dev)
+{
+    int8_t rslt = BHI360_OK;
+
+    if (dev == NULL)
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else if (rotation == NULL)
+    {
+        dev->rotation = NULL;
+    }
+    else if ((base_name == NULL) || (n_files == 0))
+    {
+        rslt = BHI360_E_INVALID_PARAM;
+    }
+    else
+    {
+        rslt = start_rotation(rotation,
+                              base_name,
+                              n_files,
+                              max_bytes,
+                              (uint64_t)max_duration_s * UINT64_C(1000000000),
+                              dev);
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to keep at least the last minutes of events in a ring of files, by rotating
+*        them every minutes / (n_files - 1). The disk usage is bounded by the data of
+*        minutes * n_files / (n_files - 1)
+* @param[in] rotation  : Rotation state
+* @param[in] base_name : Base name of the files
+* @param[in] minutes   : Minutes to keep, at least 1
+* @param[in] n_files   : Number of files, at least 2
+* @param[in] dev       : Device instance for binary log
+* @return API error codes. BHI360_E_IO if the first file cannot be opened
+*/
+int8_t bhi360_logbin_set_ring(struct bhi360_logbin_rotation *rotation,
+                              const char *base_name,
+                              uint32_t minutes,
+                              uint8_t n_files,
+                              struct bhi360_logbin_dev *dev)
+{
+    int8_t rslt;
+
+    if ((dev == NULL) || (rotation == NULL) || (base_name == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else if ((minutes == 0) || (n_files < 2))
+    {
+        rslt = BHI360_E_INVALID_PARAM;
+    }
+    else
+    {
+        /* In nanoseconds, so that short rings of many files do not round down to no limit */
+        rslt = start_rotation(rotation,
+                              base_name,
+                              n_files,
+                              0,
+                              ((uint64_t)minutes * UINT64_C(60000000000)) / (n_files - 1),
+                              dev);
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to set a staging buffer. Events are collected in it and written to the
+*        log file in one batch when it is full or on bhi360_logbin_flush
+* @param[in] buffer : Staging buffer, NULL to write each event directly
+* @param[in] size   : Size of the buffer, at least 2 * LOGBIN_MAX_RECORD_SIZE
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_set_buffer(uint8_t *buffer, uint32_t size, struct bhi360_logbin_dev *dev)
+{
+    if (dev)
+    {
+        if (dev->logfile)
+        {
+            drain_buffer(dev);
+        }
+
+        /* A running writer thread splits the buffer, stop it first */
+        bhi360_logbin_stop_async(dev);
+
+        if (buffer && (size >= (2 * LOGBIN_MAX_RECORD_SIZE)))
+        {
+            /* Rounded down to even, so that the two halves of the writer thread add up to it */
+            dev->buffer = buffer;
+            dev->buffer_size = size & ~UINT32_C(1);
+        }
+        else
+        {
+            dev->buffer = NULL;
+            dev->buffer_size = 0;
+        }
+
+        dev->buffer_len = 0;
+        dev->active = 0;
+    }
+}
+
+/**
+* @brief Function to write the staged events to the log file
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_flush(struct bhi360_logbin_dev *dev)
+{
+    if (dev && dev->logfile)
+    {
+        drain_buffer(dev);
+        if (dev->sync)
+        {
+            sync_file(dev->logfile);
+        }
+        else
+        {
+            fflush(dev->logfile);
+        }
+    }
+
+    if (dev && dev->flush_cb)
+    {
+        dev->flush_cb(dev->flush_ref);
+    }
+}
+
+/**
+* @brief Function to set a function called at the end of each bhi360_logbin_flush, including the
+*        one of bhi360_logbin_end_data, e.g. to show that the logged events are written
+* @param[in] flush_cb  : Function called after the flush, NULL for none
+* @param[in] flush_ref : Reference passed to flush_cb
+* @param[in] dev       : Device instance for binary log
+*/
+void bhi360_logbin_set_flush_callback(bhi360_logbin_flush_fptr_t flush_cb,
+                                      void *flush_ref,
+                                      struct bhi360_logbin_dev *dev)
+{
+    if (dev)
+    {
+        dev->flush_cb = flush_cb;
+        dev->flush_ref = flush_ref;
     }
 }
+
+/**
+* @brief Function to start a thread writing the staged events, so that the caller only copies
+*        them. The buffer is split in two halves, one is filled while the other is written.
+*        Needs BHI360_USE_THREAD and a staging buffer, writes stay synchronous otherwise
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_start_async(struct bhi360_logbin_dev *dev)
+{
+#ifdef BHI360_USE_THREAD
+    struct logbin_async *async;
+
+    if (dev && dev->logfile && dev->buffer && !dev->async)
+    {
+        async = (struct logbin_async *)calloc(1, sizeof(struct logbin_async));
+        if (async)
+        {
+            drain_buffer(dev);
+            pthread_mutex_init(&async->lock, NULL);
+            pthread_cond_init(&async->cond, NULL);
+            if (pthread_create(&async->thread, NULL, write_thread, async) == 0)
+            {
+                dev->async = async;
+                dev->buffer_size /= 2;
+                dev->active = 0;
+            }
+            else
+            {
+                pthread_cond_destroy(&async->cond);
+                pthread_mutex_destroy(&async->lock);
+                free(async);
+            }
+        }
+    }
+
+#else
+    (void)dev;
+#endif
+}
+
+/**
+* @brief Function to write the staged events and stop the writer thread. Call it before closing the log file
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_stop_async(struct bhi360_logbin_dev *dev)
+{
+#ifdef BHI360_USE_THREAD
+    struct logbin_async *async;
+
+    if (dev && dev->async)
+    {
+        async = (struct logbin_async *)dev->async;
+        drain_buffer(dev);
+
+        pthread_mutex_lock(&async->lock);
+        async->quit = true;
+        pthread_cond_broadcast(&async->cond);
+        pthread_mutex_unlock(&async->lock);
+        pthread_join(async->thread, NULL);
+
+        pthread_cond_destroy(&async->cond);
+        pthread_mutex_destroy(&async->lock);
+        free(async);
+        dev->async = NULL;
+        dev->buffer_size *= 2;
+        dev->active = 0;
+    }
+
+#endif
+
+    bhi360_logbin_flush(dev);
+}
+
+/**
+* @brief Function to feed a summary file from the meta data and the events of the log, see
+*        bhi360_logbin_summary.h. Call it before bhi360_logbin_start_meta. The summary keeps
+*        running across the files of a ring and is written with bhi360_logbin_summary_end
+* @param[in] summary : Summary instance started with bhi360_logbin_summary_init, NULL to stop
+* @param[in] dev     : Device instance for binary log
+*/
+void bhi360_logbin_set_summary(struct bhi360_logbin_summary *summary, struct bhi360_logbin_dev *dev)
+{
+    if (dev)
+    {
+        dev->summary = summary;
+    }
+}
+
+/**
+* @brief Function to parse the next field of a parse format
+* @param[in,out] format : Parse format, moved past the field
+* @param[out] size      : Size of the field in bytes
+* @return 's' signed, 'u' unsigned, 'f' floating point, or 0 at the end or for an unknown field
+*/
+static char next_field(const char **format, uint8_t *size)
+{
+    const char *field = *format;
+    char type = 0;
+    size_t len;
+
+    while ((*field == ' ') || (*field == ','))
+    {
+        field++;
+    }
+
+    /* Letters may also follow each other without separators, as in "hhh" */
+    len = ((field[0] != '\0') && strchr("bBhHiIf", field[0]) && ((field[1] < '0') || (field[1] > '9'))) ? 1 :
+          strcspn(field, ", ");
+    if (len == 1)
+    {
+        switch (*field)
+        {
+            case 'b':
+                type = 's';
+                *size = 1;
+                break;
+            case 'B':
+                type = 'u';
+                *size = 1;
+                break;
+            case 'h':
+                type = 's';
+                *size = 2;
+                break;
+            case 'H':
+                type = 'u';
+                *size = 2;
+                break;
+            case 'i':
+                type = 's';
+                *size = 4;
+                break;
+            case 'I':
+                type = 'u';
+                *size = 4;
+                break;
+            case 'f':
+                type = 'f';
+                *size = 4;
+                break;
+            default:
+                break;
+        }
+    }
+    else if ((len >= 2) && (len <= 3) && ((*field == 's') || (*field == 'u') || (*field == 'f')))
+    {
+        *size = (uint8_t)(strtoul(&field[1], NULL, 10) / 8);
+        type = ((*size == 1) || (*size == 2) || (*size == 3) || (*size == 4)) ? *field : 0;
+        type = ((type == 'f') && (*size != 4)) ? 0 : type;
+    }
+
+    /* An unknown field is left in place, so that the format does not end after it */
+    *format = type ? &field[len] : field;
+
+    return type;
+}
+
+/**
+* @brief Function to decode the payload of an event into scaled values. The parse format is a comma
+*        separated list of s8, u8, s16, u16, s24, u24, s32, u32 and f32, or of the letters b, B, h,
+*        H, i, I and f that may also follow each other without commas
+* @param[in] parse_format : Sensor parse format
+* @param[in] payload      : Event payload, values past its end are 0
+* @param[in] payload_size : Size of the payload
+* @param[in] scaling      : Sensor scaling factor
+* @param[out] values      : Values, NULL to only count them
+* @param[in] max_values   : Size of values
+* @return Number of values, 0 if the format is not known or has more than max_values fields
+*/
+uint8_t bhi360_logbin_parse_values(const char *parse_format,
+                                   const uint8_t *payload,
+                                   uint8_t payload_size,
+                                   float scaling,
+                                   float *values,
+                                   uint8_t max_values)
+{
+    const char *format = parse_format;
+    uint8_t count = 0, size = 0, pos = 0;
+    uint32_t raw;
+    float value;
+    char type;
+
+    type = format ? next_field(&format, &size) : 0;
+    while (type != 0)
+    {
+        if (count == max_values)
+        {
+            format = NULL;
+            break;
+        }
+
+        value = 0.0f;
+        if (payload && ((pos + size) <= payload_size))
+        {
+            raw = 0;
+            for (uint8_t i = size; i > 0; i--)
+            {
+                raw = (raw << 8) | payload[pos + i - 1];
+            }
+
+            if (type == 'f')
+            {
+                memcpy(&value, &raw, sizeof(value));
+            }
+            else if ((type == 's') && (size < 4) && (raw & (UINT32_C(1) << ((8 * size) - 1))))
+            {
+                value = (float)((int32_t)raw - (int32_t)(UINT32_C(1) << (8 * size)));
+            }
+            else
+            {
+                value = (type == 's') ? (float)(int32_t)raw : (float)raw;
+            }
+        }
+
+        if (values)
+        {
+            values[count] = value * scaling;
+        }
+
+        pos += size;
+        count++;
+        type = next_field(&format, &size);
+    }
+
+    return (format && (*format == '\0')) ? count : 0;
+}
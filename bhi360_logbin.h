@@ -48,20 +48,144 @@ extern "C" {
 #include <stddef.h>
 #include <stdio.h>
 
+#include "bhi360_logbin_codec.h"
+#include "bhi360_logbin_summary.h"
+
 #define LOGBIN_VERSION          "1.0"
 
 #define LOGBIN_TIME_NS_SIZE     UINT8_C(8)
 #define LOGBIN_LABEL_SIZE       UINT8_C(16)
+#define LOGBIN_MAX_RECORD_SIZE  (1 + LOGBIN_TIME_NS_SIZE + 1 + 255) /* Timestamp, sensor ID and largest event */
 
 #define LOGBIN_META_ID_START    UINT8_C(0xF0)
 #define LOGBIN_META_ID_TIME_NS  (LOGBIN_META_ID_START + UINT8_C(1)) /* Unsigned 64bit timestamp in nanoseconds */
 #define LOGBIN_META_ID_LABEL    (LOGBIN_META_ID_START + UINT8_C(8)) /* String of 16 characters */
 
+/*
+ * Version 2.0 keeps the text header and stores the events in chunks of one sensor each.
+ *
+ * Chunk   : marker (1), sensor ID (1), event size (1), codec (1), count (4), start time (8),
+ *           end time (8), data size (4), then the data. Start and end are the lowest and highest
+ *           timestamps. With LOGBIN_CODEC_RAW the data is the timestamps in nanoseconds (8 each)
+ *           followed by the payloads, other codecs are described in bhi360_logbin_codec.h
+ * Index   : one entry per chunk, the chunk header without the marker followed by the file
+ *           offset of the chunk (8)
+ * Trailer : offset of the index (8), number of entries (4), LOGBIN_V2_MAGIC (4)
+ *
+ * A reader seeks to the trailer at the end of the file and only reads the chunks of the
+ * sensors and times it needs. Multi-byte fields are little endian
+ */
+#define LOGBIN_VERSION_2            "2.0"
+
+#define LOGBIN_FORMAT_V1            UINT8_C(1)
+#define LOGBIN_FORMAT_V2            UINT8_C(2)
+
+#define LOGBIN_CHUNK_MARKER         UINT8_C(0xC2)
+#define LOGBIN_CHUNK_HEADER_SIZE    UINT8_C(28)
+#define LOGBIN_INDEX_ENTRY_SIZE     UINT8_C(35)
+#define LOGBIN_TRAILER_SIZE         UINT8_C(16)
+#define LOGBIN_V2_MAGIC             "LBI2"
+
+#define LOGBIN_CODEC_RAW            UINT8_C(0)
+
+/* Events per chunk and sensors with a chunk being filled at a time */
+#ifndef LOGBIN_CHUNK_EVENTS
+#define LOGBIN_CHUNK_EVENTS         UINT16_C(256)
+#endif
+
+#ifndef LOGBIN_CHUNK_PAYLOAD_SIZE
+#define LOGBIN_CHUNK_PAYLOAD_SIZE   UINT16_C(4096)
+#endif
+
+#ifndef LOGBIN_OPEN_CHUNKS
+#define LOGBIN_OPEN_CHUNKS          UINT8_C(16)
+#endif
+
+struct bhi360_logbin_chunk
+{
+    uint8_t sensor_id;
+    uint8_t event_size;
+    uint8_t codec;
+    uint32_t count;
+    uint64_t start_time_ns;
+    uint64_t end_time_ns;
+    uint32_t size; /* Bytes of data after the header */
+    uint64_t offset; /* File offset of the header */
+};
+
+struct bhi360_logbin_column
+{
+    struct bhi360_logbin_chunk chunk;
+    uint32_t last_use;
+    uint64_t time_ns[LOGBIN_CHUNK_EVENTS];
+    uint8_t payload[LOGBIN_CHUNK_PAYLOAD_SIZE];
+};
+
+struct bhi360_logbin_v2
+{
+    struct bhi360_logbin_column column[LOGBIN_OPEN_CHUNKS];
+    struct bhi360_logbin_chunk *index;
+    uint32_t index_len;
+    uint32_t index_size;
+    uint64_t offset; /* File offset of the next chunk */
+    uint32_t use;
+    uint8_t codec[256]; /* Codec of each sensor ID, set with bhi360_logbin_set_codec */
+    uint8_t encoded[(LOGBIN_CHUNK_EVENTS * LOGBIN_TIME_NS_SIZE) + LOGBIN_CHUNK_PAYLOAD_SIZE];
+};
+
+#ifndef LOGBIN_META_BUFFER_SIZE
+#define LOGBIN_META_BUFFER_SIZE     UINT16_C(4096)
+
+/* Called at the end of each bhi360_logbin_flush, once the staged events are written */
+typedef void (*bhi360_logbin_flush_fptr_t)(void *flush_ref);
+#endif
+
+struct bhi360_logbin_rotation
+{
+    char base_name[80];
+    uint8_t n_files;
+    uint8_t file; /* Index of the current file */
+    uint32_t max_bytes; /* 0 for no size limit */
+    uint64_t max_duration_ns; /* 0 for no duration limit */
+    uint64_t bytes; /* Event bytes in the current file */
+    uint64_t start_time_ns; /* First event of the current file */
+    uint8_t started;
+    uint32_t rotations;
+    int8_t rslt; /* BHI360_E_IO once a file of the ring cannot be opened, logging stops then */
+    char meta[LOGBIN_META_BUFFER_SIZE]; /* Meta data lines, repeated in each file */
+    uint16_t meta_len;
+};
+
 struct bhi360_logbin_dev
 {
     char logfilename[100];
     FILE *logfile;
     uint64_t last_time_ns;
+
+    /* Chunks of version 2.0, set up with bhi360_logbin_set_format. NULL for version 1.0 */
+    struct bhi360_logbin_v2 *v2;
+
+    /* Staging buffer set with bhi360_logbin_set_buffer, NULL to write each event directly */
+    uint8_t *buffer;
+    uint32_t buffer_size; /* Size of each half when the writer thread runs */
+    uint32_t buffer_len;
+    uint8_t active; /* Half being filled */
+
+    /* Writer thread started with bhi360_logbin_start_async, NULL if writes are synchronous */
+    void *async;
+
+    /* Set with bhi360_logbin_set_sync to commit each batch to the storage */
+    uint8_t sync;
+
+    /* Set with bhi360_logbin_set_rotation, NULL for a single log file */
+    struct bhi360_logbin_rotation *rotation;
+
+    /* Set with bhi360_logbin_set_summary, NULL without a summary file */
+    struct bhi360_logbin_summary *summary;
+
+    /* Set with bhi360_logbin_set_flush_callback, NULL for none */
+    bhi360_logbin_flush_fptr_t flush_cb;
+    void *flush_ref;
 };
 
 /**
@@ -108,6 +232,156 @@ void bhi360_logbin_add_data(uint8_t sensor_id,
                             const uint8_t *event_payload,
                             struct bhi360_logbin_dev *dev);
 
+/**
+* @brief Function to set the format of the next log file, before bhi360_logbin_start_meta.
+*        Version 2.0 needs bhi360_logbin_end_data once the last event is added, and
+*        bhi360_logbin_release once logging is done
+* @param[in] format : LOGBIN_FORMAT_V1 or LOGBIN_FORMAT_V2
+* @param[in] dev    : Device instance for binary log
+* @return API error codes. BHI360_E_BUFFER if there is no memory for version 2.0, the log then stays
+*         at version 1.0
+*/
+int8_t bhi360_logbin_set_format(uint8_t format, struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to set the codec of the chunks of a sensor, after bhi360_logbin_set_format.
+*        Chunks the codec does not apply to or does not make smaller are stored raw
+* @param[in] sensor_id : Sensor ID
+* @param[in] codec     : LOGBIN_CODEC_RAW, LOGBIN_CODEC_S16 or LOGBIN_CODEC_QUAT
+* @param[in] dev       : Device instance for binary log
+*/
+void bhi360_logbin_set_codec(uint8_t sensor_id, uint8_t codec, struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to end the data of a log file. For version 2.0 it writes the remaining
+*        chunks and the index. Call it before closing the log file
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_end_data(struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to release the chunks and the index of version 2.0, after the last
+*        bhi360_logbin_end_data. Later log files are version 1.0 until bhi360_logbin_set_format
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_release(struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to set a staging buffer. Events are collected in it and written to the
+*        log file in one batch when it is full or on bhi360_logbin_flush
+* @param[in] buffer : Staging buffer, NULL to write each event directly
+* @param[in] size   : Size of the buffer, at least 2 * LOGBIN_MAX_RECORD_SIZE
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_set_buffer(uint8_t *buffer, uint32_t size, struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to write the staged events to the log file
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_flush(struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to set a function called at the end of each bhi360_logbin_flush, including the
+*        one of bhi360_logbin_end_data, e.g. to show that the logged events are written
+* @param[in] flush_cb  : Function called after the flush, NULL for none
+* @param[in] flush_ref : Reference passed to flush_cb
+* @param[in] dev       : Device instance for binary log
+*/
+void bhi360_logbin_set_flush_callback(bhi360_logbin_flush_fptr_t flush_cb,
+                                      void *flush_ref,
+                                      struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to start a thread writing the staged events, so that the caller only copies
+*        them. The buffer is split in two halves, one is filled while the other is written.
+*        Needs BHI360_USE_THREAD and a staging buffer, writes stay synchronous otherwise
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_start_async(struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to write the staged events and stop the writer thread. Call it before closing the log file
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_stop_async(struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to commit each batch of the staging buffer and each flush to the storage,
+*        so that a power loss loses at most the data of one batch
+* @param[in] enable : 1 to commit, 0 to leave it to the operating system
+* @param[in] dev    : Device instance for binary log
+*/
+void bhi360_logbin_set_sync(uint8_t enable, struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to log to a ring of files named <base name>.0 to <base name>.<n_files - 1>.
+*        The first file is opened here. Once a file reaches the size or the duration, it is
+*        ended and closed, and the next one is overwritten, starting with the meta data again
+*        so that each file can be read alone. A log file that is open is ended and closed first.
+*        Call it before bhi360_logbin_start_meta
+* @param[in] rotation       : Rotation state, NULL to stop rotating
+* @param[in] base_name      : Base name of the files
+* @param[in] n_files        : Number of files
+* @param[in] max_bytes      : Size of the event data of a file, 0 for no limit
+* @param[in] max_duration_s : Time of the events of a file in seconds, 0 for no limit
+* @param[in] dev            : Device instance for binary log
+* @return API error codes. BHI360_E_IO if the first file cannot be opened, the failure to open a
+*         later file is reported in rotation->rslt
+*/
+int8_t bhi360_logbin_set_rotation(struct bhi360_logbin_rotation *rotation,
+                                  const char *base_name,
+                                  uint8_t n_files,
+                                  uint32_t max_bytes,
+                                  uint32_t max_duration_s,
+                                  struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to keep at least the last minutes of events in a ring of files, by rotating
+*        them every minutes / (n_files - 1). The disk usage is bounded by the data of
+*        minutes * n_files / (n_files - 1)
+* @param[in] rotation  : Rotation state
+* @param[in] base_name : Base name of the files
+* @param[in] minutes   : Minutes to keep, at least 1
+* @param[in] n_files   : Number of files, at least 2
+* @param[in] dev       : Device instance for binary log
+* @return API error codes. BHI360_E_IO if the first file cannot be opened, the failure to open a
+*         later file is reported in rotation->rslt
+*/
+int8_t bhi360_logbin_set_ring(struct bhi360_logbin_rotation *rotation,
+                              const char *base_name,
+                              uint32_t minutes,
+                              uint8_t n_files,
+                              struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to feed a summary file from the meta data and the events of the log, see
+*        bhi360_logbin_summary.h. Call it before bhi360_logbin_start_meta. The summary keeps
+*        running across the files of a ring and is written with bhi360_logbin_summary_end
+* @param[in] summary : Summary instance started with bhi360_logbin_summary_init, NULL to stop
+* @param[in] dev     : Device instance for binary log
+*/
+void bhi360_logbin_set_summary(struct bhi360_logbin_summary *summary, struct bhi360_logbin_dev *dev);
+
+/**
+* @brief Function to decode the payload of an event into scaled values. The parse format is a comma
+*        separated list of s8, u8, s16, u16, s24, u24, s32, u32 and f32, or of the letters b, B, h,
+*        H, i, I and f that may also follow each other without commas
+* @param[in] parse_format : Sensor parse format
+* @param[in] payload      : Event payload, values past its end are 0
+* @param[in] payload_size : Size of the payload
+* @param[in] scaling      : Sensor scaling factor
+* @param[out] values      : Values, NULL to only count them
+* @param[in] max_values   : Size of values
+* @return Number of values, 0 if the format is not known or has more than max_values fields
+*/
+uint8_t bhi360_logbin_parse_values(const char *parse_format,
+                                   const uint8_t *payload,
+                                   uint8_t payload_size,
+                                   float scaling,
+                                   float *values,
+                                   uint8_t max_values);
+
 /* End of CPP Guard */
 #ifdef __cplusplus
 }
@@ -0,0 +1,619 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_logbin_codec.c
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#include "bhi360_logbin_codec.h"
+
+struct bit_stream
+{
+    uint8_t *data; /* NULL when reading */
+    const uint8_t *in;
+    uint32_t size;
+    uint32_t pos;
+    uint64_t acc;
+    uint8_t bits;
+    uint8_t error;
+};
+
+/**
+* @brief Function to zigzag code a signed value, so that small magnitudes give small codes
+* @param[in] value : Value
+* @return Zigzag code
+*/
+static uint64_t zigzag(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+/**
+* @brief Function to decode a zigzag code
+* @param[in] code : Zigzag code
+* @return Value
+*/
+static int64_t unzigzag(uint64_t code)
+{
+    return (int64_t)(code >> 1) ^ -(int64_t)(code & 1);
+}
+
+/**
+* @brief Function to get the number of bits needed for a value
+* @param[in] value : Value
+* @return Number of bits
+*/
+static uint8_t bit_width(uint32_t value)
+{
+    uint8_t width = 0;
+
+    while (value != 0)
+    {
+        width++;
+        value >>= 1;
+    }
+
+    return width;
+}
+
+/**
+* @brief Function to get a signed 16 bit value of an event
+* @param[in] payload : Payloads
+* @param[in] pos     : Byte position
+* @return Value
+*/
+static int32_t get_s16(const uint8_t *payload, uint32_t pos)
+{
+    return (int16_t)(uint16_t)(payload[pos] | (payload[pos + 1] << 8));
+}
+
+/**
+* @brief Function to set a signed 16 bit value of an event
+* @param[out] payload : Payloads
+* @param[in] pos      : Byte position
+* @param[in] value    : Value, truncated to 16 bits
+*/
+static void set_s16(uint8_t *payload, uint32_t pos, int32_t value)
+{
+    payload[pos] = (uint8_t)((uint32_t)value & 0xFF);
+    payload[pos + 1] = (uint8_t)(((uint32_t)value >> 8) & 0xFF);
+}
+
+/**
+* @brief Function to append bits
+* @param[in] stream : Stream
+* @param[in] value  : Value
+* @param[in] width  : Number of bits, up to 32
+*/
+static void put_bits(struct bit_stream *stream, uint32_t value, uint8_t width)
+{
+    stream->acc |= (uint64_t)value << stream->bits;
+    stream->bits += width;
+    while (stream->bits >= 8)
+    {
+        if (stream->pos < stream->size)
+        {
+            stream->data[stream->pos++] = (uint8_t)(stream->acc & 0xFF);
+        }
+        else
+        {
+            stream->error = 1;
+        }
+
+        stream->acc >>= 8;
+        stream->bits -= 8;
+    }
+}
+
+/**
+* @brief Function to pad the bits written to a byte
+* @param[in] stream : Stream
+*/
+static void put_align(struct bit_stream *stream)
+{
+    if (stream->bits != 0)
+    {
+        put_bits(stream, 0, (uint8_t)(8 - stream->bits));
+    }
+}
+
+/**
+* @brief Function to append a value in a varint of 7 bits per byte
+* @param[in] stream : Stream, aligned
+* @param[in] value  : Value
+*/
+static void put_varint(struct bit_stream *stream, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        put_bits(stream, (uint32_t)(value & 0x7F) | 0x80, 8);
+        value >>= 7;
+    }
+
+    put_bits(stream, (uint32_t)value, 8);
+}
+
+/**
+* @brief Function to read bits
+* @param[in] stream : Stream
+* @param[in] width  : Number of bits, up to 32
+* @return Value
+*/
+static uint32_t get_bits(struct bit_stream *stream, uint8_t width)
+{
+    uint32_t value;
+
+    while (stream->bits < width)
+    {
+        if (stream->pos < stream->size)
+        {
+            stream->acc |= (uint64_t)stream->in[stream->pos++] << stream->bits;
+        }
+        else
+        {
+            stream->error = 1;
+        }
+
+        stream->bits += 8;
+    }
+
+    value = (uint32_t)(stream->acc & ((UINT64_C(1) << width) - 1));
+    stream->acc >>= width;
+    stream->bits -= width;
+
+    return value;
+}
+
+/**
+* @brief Function to skip the padding to the next byte
+* @param[in] stream : Stream
+*/
+static void get_align(struct bit_stream *stream)
+{
+    stream->acc = 0;
+    stream->bits = 0;
+}
+
+/**
+* @brief Function to read a varint
+* @param[in] stream : Stream, aligned
+* @return Value
+*/
+static uint64_t get_varint(struct bit_stream *stream)
+{
+    uint64_t value = 0;
+    uint32_t byte;
+    uint8_t shift = 0;
+
+    do
+    {
+        byte = get_bits(stream, 8);
+        if (shift < 64)
+        {
+            value |= (uint64_t)(byte & 0x7F) << shift;
+        }
+
+        shift += 7;
+    } while ((byte & 0x80) && !stream->error);
+
+    return value;
+}
+
+/**
+* @brief Function to get the component of largest magnitude of a quaternion and its sign
+* @param[in] payload : Payloads
+* @param[in] pos     : Byte position of the event
+* @return Component in bits 0 and 1, sign in bit 2
+*/
+static uint8_t quat_largest(const uint8_t *payload, uint32_t pos)
+{
+    uint8_t largest = 0;
+    int32_t value, max = 0;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        value = get_s16(payload, pos + (2 * i));
+        value = (value < 0) ? -value : value;
+        if (value > max)
+        {
+            max = value;
+            largest = i;
+        }
+    }
+
+    return (uint8_t)(largest | ((get_s16(payload, pos + (2 * largest)) < 0) ? 0x04 : 0x00));
+}
+
+/**
+* @brief Function to predict the magnitude of the largest component of a quaternion from the others
+* @param[in] payload : Payloads
+* @param[in] pos     : Byte position of the event
+* @param[in] largest : Largest component
+* @return Rounded square root of the unit norm minus the sum of the squares of the others
+*/
+static int32_t quat_predict(const uint8_t *payload, uint32_t pos, uint8_t largest)
+{
+    int64_t rest = (int64_t)LOGBIN_CODEC_QUAT_UNIT * LOGBIN_CODEC_QUAT_UNIT;
+    uint32_t root = 0;
+    int32_t value;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        if (i != largest)
+        {
+            value = get_s16(payload, pos + (2 * i));
+            rest -= (int64_t)value * value;
+        }
+    }
+
+    if (rest > 0)
+    {
+        for (uint32_t bit = UINT32_C(1) << 15; bit != 0; bit >>= 1)
+        {
+            if ((int64_t)(root | bit) * (root | bit) <= rest)
+            {
+                root |= bit;
+            }
+        }
+
+        if ((rest - ((int64_t)root * root)) > root)
+        {
+            root++;
+        }
+    }
+
+    return (int32_t)root;
+}
+
+/**
+* @brief Function to get the error of the predicted magnitude of the largest component of a quaternion
+* @param[in] payload : Payloads
+* @param[in] pos     : Byte position of the event
+* @return Error
+*/
+static int32_t quat_error(const uint8_t *payload, uint32_t pos)
+{
+    uint8_t largest = quat_largest(payload, pos);
+    int32_t value = get_s16(payload, pos + (2 * (largest & 0x03)));
+
+    return ((largest & 0x04) ? -value : value) - quat_predict(payload, pos, largest & 0x03);
+}
+
+/**
+* @brief Function to encode the timestamps
+* @param[in] stream        : Stream
+* @param[in] start_time_ns : Start time of the chunk
+* @param[in] time_ns       : Timestamps
+* @param[in] count         : Number of events
+*/
+static void put_times(struct bit_stream *stream, uint64_t start_time_ns, const uint64_t *time_ns, uint32_t count)
+{
+    uint64_t unit = LOGBIN_CODEC_TICK_NS;
+    uint64_t last;
+    int64_t delta, last_delta = 0;
+
+    for (uint32_t i = 0; (i < count) && (unit != 1); i++)
+    {
+        unit = (time_ns[i] % LOGBIN_CODEC_TICK_NS) ? 1 : unit;
+    }
+
+    unit = (start_time_ns % LOGBIN_CODEC_TICK_NS) ? 1 : unit;
+    put_bits(stream, (unit != 1) ? LOGBIN_CODEC_FLAG_TICKS : 0, 8);
+
+    last = start_time_ns / unit;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        delta = (int64_t)((time_ns[i] / unit) - last);
+        put_varint(stream, zigzag(delta - last_delta));
+        last_delta = delta;
+        last = time_ns[i] / unit;
+    }
+}
+
+/**
+* @brief Function to decode the timestamps
+* @param[in] stream        : Stream
+* @param[in] start_time_ns : Start time of the chunk
+* @param[out] time_ns      : Timestamps
+* @param[in] count         : Number of events
+*/
+static void get_times(struct bit_stream *stream, uint64_t start_time_ns, uint64_t *time_ns, uint32_t count)
+{
+    uint64_t unit = (get_bits(stream, 8) & LOGBIN_CODEC_FLAG_TICKS) ? LOGBIN_CODEC_TICK_NS : 1;
+    uint64_t last = start_time_ns / unit;
+    int64_t delta = 0;
+
+    for (uint32_t i = 0; (i < count) && !stream->error; i++)
+    {
+        delta += unzigzag(get_varint(stream));
+        last += (uint64_t)delta;
+        time_ns[i] = last * unit;
+    }
+}
+
+/**
+* @brief Function to encode a packed stream of the changes of a 16 bit value
+* @param[in] stream     : Stream
+* @param[in] payload    : Payloads
+* @param[in] event_size : Event size
+* @param[in] count      : Number of events
+* @param[in] pos        : Byte position of the value in the event
+* @param[in] quat       : Component of a quaternion, skipped where it is largest. 0xFF for none
+*/
+static void put_deltas(struct bit_stream *stream,
+                       const uint8_t *payload,
+                       uint8_t event_size,
+                       uint32_t count,
+                       uint8_t pos,
+                       uint8_t quat)
+{
+    uint32_t max = 0;
+    uint8_t width = 0;
+    int32_t value, last;
+
+    for (uint8_t pass = 0; pass < 2; pass++)
+    {
+        if (pass == 1)
+        {
+            width = bit_width(max);
+            put_bits(stream, width, 8);
+        }
+
+        last = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if ((quat == 0xFF) || ((quat_largest(payload, i * event_size) & 0x03) != quat))
+            {
+                value = get_s16(payload, (i * event_size) + pos);
+                if (pass == 0)
+                {
+                    max |= (uint32_t)zigzag(value - last);
+                }
+                else
+                {
+                    put_bits(stream, (uint32_t)zigzag(value - last), width);
+                }
+
+                last = value;
+            }
+        }
+    }
+
+    put_align(stream);
+}
+
+/**
+* @brief Function to decode a packed stream of the changes of a 16 bit value
+* @param[in] stream     : Stream
+* @param[out] payload   : Payloads
+* @param[in] event_size : Event size
+* @param[in] count      : Number of events
+* @param[in] pos        : Byte position of the value in the event
+* @param[in] quat       : Component of a quaternion, skipped where it is largest. 0xFF for none
+* @param[in] largest    : Stream of the largest components, when decoding a quaternion
+*/
+static void get_deltas(struct bit_stream *stream,
+                       uint8_t *payload,
+                       uint8_t event_size,
+                       uint32_t count,
+                       uint8_t pos,
+                       uint8_t quat,
+                       struct bit_stream *largest)
+{
+    uint8_t width = (uint8_t)get_bits(stream, 8);
+    uint32_t last = 0;
+
+    if (width > 32)
+    {
+        stream->error = 1;
+    }
+
+    for (uint32_t i = 0; (i < count) && !stream->error; i++)
+    {
+        if ((quat == 0xFF) || ((get_bits(largest, 3) & 0x03) != quat))
+        {
+            /* Unsigned, so a corrupted stream wraps instead of overflowing */
+            last += (uint32_t)unzigzag(get_bits(stream, width));
+            set_s16(payload, (i * event_size) + pos, (int32_t)(last & 0xFFFF));
+        }
+    }
+
+    get_align(stream);
+}
+
+/**
+* @brief Function to encode the events of a chunk
+* @param[in] codec         : Codec
+* @param[in] start_time_ns : Start time of the chunk
+* @param[in] time_ns       : Timestamps of the events
+* @param[in] payload       : Payloads of the events
+* @param[in] event_size    : Event size
+* @param[in] count         : Number of events
+* @param[out] data         : Encoded data
+* @param[in] data_size     : Size of the data buffer
+* @return Size of the encoded data, or 0 if the codec does not apply or the data does not fit
+*/
+uint32_t bhi360_logbin_encode(uint8_t codec,
+                              uint64_t start_time_ns,
+                              const uint64_t *time_ns,
+                              const uint8_t *payload,
+                              uint8_t event_size,
+                              uint32_t count,
+                              uint8_t *data,
+                              uint32_t data_size)
+{
+    struct bit_stream stream = { 0 };
+    uint32_t max = 0;
+    uint8_t width;
+
+    stream.data = data;
+    stream.size = data_size;
+
+    if (!time_ns || !payload || !data)
+    {
+        stream.error = 1;
+    }
+    else if ((codec == LOGBIN_CODEC_S16) && ((event_size % 2) == 0))
+    {
+        put_times(&stream, start_time_ns, time_ns, count);
+        for (uint8_t pos = 0; pos < event_size; pos += 2)
+        {
+            put_deltas(&stream, payload, event_size, count, pos, 0xFF);
+        }
+    }
+    else if ((codec == LOGBIN_CODEC_QUAT) && (event_size == LOGBIN_CODEC_QUAT_EVENT_SIZE))
+    {
+        put_times(&stream, start_time_ns, time_ns, count);
+
+        put_bits(&stream, 3, 8);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            put_bits(&stream, quat_largest(payload, i * event_size), 3);
+        }
+
+        put_align(&stream);
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            put_deltas(&stream, payload, event_size, count, (uint8_t)(2 * i), i);
+        }
+
+        /* Error of the predicted magnitude of the largest component */
+        for (uint32_t i = 0; i < count; i++)
+        {
+            max |= (uint32_t)zigzag(quat_error(payload, i * event_size));
+        }
+
+        width = bit_width(max);
+        put_bits(&stream, width, 8);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            put_bits(&stream, (uint32_t)zigzag(quat_error(payload, i * event_size)), width);
+        }
+
+        put_align(&stream);
+        put_deltas(&stream, payload, event_size, count, 8, 0xFF);
+    }
+    else
+    {
+        stream.error = 1;
+    }
+
+    return stream.error ? 0 : stream.pos;
+}
+
+/**
+* @brief Function to decode the events of a chunk
+* @param[in] codec         : Codec
+* @param[in] start_time_ns : Start time of the chunk
+* @param[in] data          : Encoded data
+* @param[in] data_size     : Size of the encoded data
+* @param[in] event_size    : Event size
+* @param[in] count         : Number of events
+* @param[out] time_ns      : Timestamps of the events
+* @param[out] payload      : Payloads of the events, count * event_size bytes
+* @return 1 on success, 0 if the data is invalid
+*/
+uint8_t bhi360_logbin_decode(uint8_t codec,
+                             uint64_t start_time_ns,
+                             const uint8_t *data,
+                             uint32_t data_size,
+                             uint8_t event_size,
+                             uint32_t count,
+                             uint64_t *time_ns,
+                             uint8_t *payload)
+{
+    struct bit_stream stream = { 0 };
+    struct bit_stream largest_stream;
+    uint8_t largest, width;
+    uint32_t code;
+
+    stream.in = data;
+    stream.size = data_size;
+
+    if (!data || !time_ns || !payload)
+    {
+        stream.error = 1;
+    }
+    else if ((codec == LOGBIN_CODEC_S16) && ((event_size % 2) == 0))
+    {
+        get_times(&stream, start_time_ns, time_ns, count);
+        for (uint8_t pos = 0; pos < event_size; pos += 2)
+        {
+            get_deltas(&stream, payload, event_size, count, pos, 0xFF, NULL);
+        }
+    }
+    else if ((codec == LOGBIN_CODEC_QUAT) && (event_size == LOGBIN_CODEC_QUAT_EVENT_SIZE))
+    {
+        get_times(&stream, start_time_ns, time_ns, count);
+        if (get_bits(&stream, 8) != 3)
+        {
+            stream.error = 1;
+        }
+
+        /* The stream of the largest components is read again for each component */
+        largest_stream = stream;
+        stream.pos += ((count * 3) + 7) / 8;
+        for (uint8_t i = 0; (i < 4) && !stream.error; i++)
+        {
+            struct bit_stream components = largest_stream;
+
+            get_deltas(&stream, payload, event_size, count, (uint8_t)(2 * i), i, &components);
+            stream.error |= components.error;
+        }
+
+        width = (uint8_t)get_bits(&stream, 8);
+        stream.error |= (width > 32);
+        for (uint32_t i = 0; (i < count) && !stream.error; i++)
+        {
+            largest = (uint8_t)get_bits(&largest_stream, 3);
+            code = (uint32_t)quat_predict(payload, i * event_size, largest & 0x03) +
+                   (uint32_t)unzigzag(get_bits(&stream, width));
+            if (largest & 0x04)
+            {
+                code = 0 - code;
+            }
+
+            set_s16(payload, (i * event_size) + (2 * (largest & 0x03)), (int32_t)(code & 0xFFFF));
+        }
+
+        get_align(&stream);
+        get_deltas(&stream, payload, event_size, count, 8, 0xFF, NULL);
+    }
+    else
+    {
+        stream.error = 1;
+    }
+
+    return (!stream.error && (stream.pos == data_size)) ? 1 : 0;
+}
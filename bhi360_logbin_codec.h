@@ -0,0 +1,125 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_logbin_codec.h
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#ifndef _BHI360_LOGBIN_CODEC_H_
+#define _BHI360_LOGBIN_CODEC_H_
+
+/* Start of CPP Guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Lossless codecs of the data of a logbin version 2.0 chunk, selected per sensor
+ *
+ * All codecs start with a flags byte and the timestamps. Bit 0 of the flags is set when
+ * all timestamps are whole device ticks of 15.625 us, which are then the unit. Each
+ * timestamp is stored as the change of its delta to the previous one (the first one to
+ * the start time of the chunk), zigzag coded in a varint of 7 bits per byte.
+ *
+ * Packed streams are a width byte followed by one value of that many bits per event,
+ * least significant bit first, padded to a byte
+ *
+ * LOGBIN_CODEC_S16  : Payloads of signed 16 bit values, such as 3-axis data. One packed
+ *                     stream per value of the zigzag coded change from the previous event
+ * LOGBIN_CODEC_QUAT : Quaternion payloads, x, y, z and w followed by the accuracy. A packed
+ *                     stream of 3 bits per event holds the component of largest magnitude
+ *                     and its sign. The other three are coded as with LOGBIN_CODEC_S16 in
+ *                     one stream per component, skipping the events where it is largest.
+ *                     The largest is predicted from the unit norm of 2^14 and only the
+ *                     zigzag coded error is stored, followed by the accuracy stream
+ */
+#define LOGBIN_CODEC_S16                UINT8_C(1)
+#define LOGBIN_CODEC_QUAT               UINT8_C(2)
+
+#define LOGBIN_CODEC_FLAG_TICKS         UINT8_C(0x01)
+#define LOGBIN_CODEC_TICK_NS            UINT16_C(15625)
+#define LOGBIN_CODEC_QUAT_EVENT_SIZE    UINT8_C(10)
+#define LOGBIN_CODEC_QUAT_UNIT          INT32_C(16384)
+
+/**
+* @brief Function to encode the events of a chunk
+* @param[in] codec         : Codec
+* @param[in] start_time_ns : Start time of the chunk
+* @param[in] time_ns       : Timestamps of the events
+* @param[in] payload       : Payloads of the events
+* @param[in] event_size    : Event size
+* @param[in] count         : Number of events
+* @param[out] data         : Encoded data
+* @param[in] data_size     : Size of the data buffer
+* @return Size of the encoded data, or 0 if the codec does not apply or the data does not fit
+*/
+uint32_t bhi360_logbin_encode(uint8_t codec,
+                              uint64_t start_time_ns,
+                              const uint64_t *time_ns,
+                              const uint8_t *payload,
+                              uint8_t event_size,
+                              uint32_t count,
+                              uint8_t *data,
+                              uint32_t data_size);
+
+/**
+* @brief Function to decode the events of a chunk
+* @param[in] codec         : Codec
+* @param[in] start_time_ns : Start time of the chunk
+* @param[in] data          : Encoded data
+* @param[in] data_size     : Size of the encoded data
+* @param[in] event_size    : Event size
+* @param[in] count         : Number of events
+* @param[out] time_ns      : Timestamps of the events
+* @param[out] payload      : Payloads of the events, count * event_size bytes
+* @return 1 on success, 0 if the data is invalid
+*/
+uint8_t bhi360_logbin_decode(uint8_t codec,
+                             uint64_t start_time_ns,
+                             const uint8_t *data,
+                             uint32_t data_size,
+                             uint8_t event_size,
+                             uint32_t count,
+                             uint64_t *time_ns,
+                             uint8_t *payload);
+
+/* End of CPP Guard */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* _BHI360_LOGBIN_CODEC_H_ */
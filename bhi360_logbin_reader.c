@@ -0,0 +1,794 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_logbin_reader.c
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+/* fseeko, with 64-bit file offsets on 32-bit targets */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE    200112L
+#endif
+
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS  64
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "bhi360_logbin_reader.h"
+
+/**
+* @brief Function to get a little endian value
+* @param[in] src  : Source
+* @param[in] size : Size of the value in bytes
+* @return Value
+*/
+static uint64_t get_le(const uint8_t *src, uint8_t size)
+{
+    uint64_t value = 0;
+
+    for (uint8_t i = size; i > 0; i--)
+    {
+        value = (value << 8) | src[i - 1];
+    }
+
+    return value;
+}
+
+/**
+* @brief Function to get a little endian float
+* @param[in] src    : Source
+* @param[out] value : Value
+*/
+static void get_float(const uint8_t *src, float *value)
+{
+    uint32_t raw = (uint32_t)get_le(src, 4);
+
+    memcpy(value, &raw, sizeof(*value));
+}
+
+/**
+* @brief Function to get a chunk header, without the marker
+* @param[in] src    : Source
+* @param[out] chunk : Chunk
+*/
+static void get_chunk_info(const uint8_t *src, struct bhi360_logbin_chunk *chunk)
+{
+    chunk->sensor_id = src[0];
+    chunk->event_size = src[1];
+    chunk->codec = src[2];
+    chunk->count = (uint32_t)get_le(&src[3], 4);
+    chunk->start_time_ns = get_le(&src[7], 8);
+    chunk->end_time_ns = get_le(&src[15], 8);
+    chunk->size = (uint32_t)get_le(&src[23], 4);
+}
+
+/**
+* @brief Function to map a file
+* @param[in] path    : Path of the file
+* @param[out] reader : Reader instance
+* @return 1 on success, 0 otherwise
+*/
+static uint8_t map_file(const char *path, struct bhi360_logbin_reader *reader)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER size;
+
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        if (GetFileSizeEx(file, &size) && (size.QuadPart > 0))
+        {
+            reader->handle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (reader->handle)
+            {
+                reader->data = (const uint8_t *)MapViewOfFile(reader->handle, FILE_MAP_READ, 0, 0, 0);
+                reader->size = (size_t)size.QuadPart;
+                if (!reader->data)
+                {
+                    CloseHandle(reader->handle);
+                    reader->handle = NULL;
+                }
+            }
+        }
+
+        CloseHandle(file);
+    }
+
+#else
+    int file = open(path, O_RDONLY);
+    struct stat info;
+    void *data;
+
+    if (file >= 0)
+    {
+        if ((fstat(file, &info) == 0) && (info.st_size > 0))
+        {
+            data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (data != MAP_FAILED)
+            {
+                reader->data = (const uint8_t *)data;
+                reader->size = (size_t)info.st_size;
+            }
+        }
+
+        close(file);
+    }
+
+#endif
+
+    return reader->data ? 1 : 0;
+}
+
+/**
+* @brief Function to copy a field of a meta data line
+* @param[out] dst : Destination
+* @param[in] src  : Field
+* @param[in] len  : Length of the field
+*/
+static void copy_field(char *dst, const char *src, size_t len)
+{
+    if (len >= LOGBIN_META_TEXT_SIZE)
+    {
+        len = LOGBIN_META_TEXT_SIZE - 1;
+    }
+
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+/**
+* @brief Function to parse a meta data line, "id: name: event size: parse format: axis names: scaling"
+* @param[in] line    : Line
+* @param[in] len     : Length of the line, without the new line
+* @param[in] reader  : Reader instance
+*/
+static void parse_meta(const char *line, size_t len, struct bhi360_logbin_reader *reader)
+{
+    const char *field[6];
+    size_t field_len[6];
+    uint8_t n = 0;
+    char number[LOGBIN_META_TEXT_SIZE];
+    struct bhi360_logbin_meta *meta;
+    size_t end = len;
+
+    /* The ID from the left and the last four fields from the right, the name may contain ": " */
+    for (size_t i = len; (i > 1) && (n < 4); i--)
+    {
+        if ((line[i - 2] == ':') && (line[i - 1] == ' '))
+        {
+            n++;
+            field[6 - n] = &line[i];
+            field_len[6 - n] = end - i;
+            end = i - 2;
+        }
+    }
+
+    for (size_t i = 0; (i + 1 < end) && (n == 4); i++)
+    {
+        if ((line[i] == ':') && (line[i + 1] == ' '))
+        {
+            field[0] = line;
+            field_len[0] = i;
+            field[1] = &line[i + 2];
+            field_len[1] = end - i - 2;
+            n = 6;
+        }
+    }
+
+    if (n == 6)
+    {
+        copy_field(number, field[0], field_len[0]);
+        meta = &reader->meta[strtoul(number, NULL, 10) & 0xFF];
+        copy_field(meta->name, field[1], field_len[1]);
+        copy_field(number, field[2], field_len[2]);
+        meta->event_size = (uint8_t)strtoul(number, NULL, 10);
+        copy_field(meta->parse_format, field[3], field_len[3]);
+        copy_field(meta->axis_names, field[4], field_len[4]);
+        copy_field(number, field[5], field_len[5]);
+        meta->scaling = strtof(number, NULL);
+        meta->valid = 1;
+    }
+}
+
+/**
+* @brief Function to read the text header and, for version 2.0, the trailer
+* @param[in] reader : Reader instance
+* @return 1 on success, 0 if the file is not a log file
+*/
+static uint8_t read_header(struct bhi360_logbin_reader *reader)
+{
+    const char *text = (const char *)reader->data;
+    size_t pos = 0, end;
+    uint8_t found = 0;
+    const uint8_t *trailer;
+
+    /* Version line, then meta data lines up to an empty line */
+    for (uint32_t line = 0; (pos < reader->size) && !found; line++)
+    {
+        end = pos;
+        while ((end < reader->size) && (text[end] != '\n'))
+        {
+            end++;
+        }
+
+        if (end == reader->size)
+        {
+            break;
+        }
+
+        if (line == 0)
+        {
+            if (((end - pos) == 3) && (memcmp(text, LOGBIN_VERSION, 3) == 0))
+            {
+                reader->format = LOGBIN_FORMAT_V1;
+            }
+            else if (((end - pos) == 3) && (memcmp(text, LOGBIN_VERSION_2, 3) == 0))
+            {
+                reader->format = LOGBIN_FORMAT_V2;
+            }
+            else
+            {
+                break;
+            }
+        }
+        else if (end == pos)
+        {
+            found = 1;
+        }
+        else
+        {
+            parse_meta(&text[pos], end - pos, reader);
+        }
+
+        pos = end + 1;
+    }
+
+    reader->data_start = pos;
+    reader->data_end = reader->size;
+    if (found && (reader->format == LOGBIN_FORMAT_V2) && ((reader->size - pos) >= LOGBIN_TRAILER_SIZE))
+    {
+        trailer = &reader->data[reader->size - LOGBIN_TRAILER_SIZE];
+        if (memcmp(&trailer[12], LOGBIN_V2_MAGIC, 4) == 0)
+        {
+            reader->index_start = (size_t)get_le(trailer, 8);
+            reader->index_len = (uint32_t)get_le(&trailer[8], 4);
+            if ((reader->index_start < pos) ||
+                (reader->index_start > (reader->size - LOGBIN_TRAILER_SIZE)) ||
+                (((reader->size - LOGBIN_TRAILER_SIZE - reader->index_start) / LOGBIN_INDEX_ENTRY_SIZE) <
+                 reader->index_len))
+            {
+                reader->index_len = 0;
+            }
+            else
+            {
+                reader->data_end = reader->index_start;
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+* @brief Function to open a log file and read its meta data
+* @param[in] path    : Path of the log file
+* @param[out] reader : Reader instance
+* @return 1 on success, 0 if the file cannot be mapped or is not a log file
+*/
+uint8_t bhi360_logbin_open(const char *path, struct bhi360_logbin_reader *reader)
+{
+    uint8_t rslt = 0;
+
+    if (path && reader)
+    {
+        memset(reader, 0, sizeof(struct bhi360_logbin_reader));
+        if (map_file(path, reader))
+        {
+            rslt = read_header(reader);
+            if (!rslt)
+            {
+                bhi360_logbin_close(reader);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to close a log file
+* @param[in] reader : Reader instance
+*/
+void bhi360_logbin_close(struct bhi360_logbin_reader *reader)
+{
+    if (reader && reader->data)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(reader->data);
+        CloseHandle(reader->handle);
+#else
+        munmap((void *)reader->data, reader->size);
+#endif
+        reader->data = NULL;
+        reader->handle = NULL;
+        reader->size = 0;
+    }
+}
+
+/**
+* @brief Function to start iterating over the events of a log file. Events are returned in file
+*        order, which for version 2.0 is chunk by chunk and not merged by time across sensors
+* @param[in] sensor_id     : Sensor ID, or LOGBIN_ALL_SENSORS
+* @param[in] start_time_ns : Lowest timestamp
+* @param[in] end_time_ns   : Highest timestamp
+* @param[in] reader        : Reader instance
+* @param[out] iter         : Iterator
+*/
+void bhi360_logbin_iter_init(uint16_t sensor_id,
+                             uint64_t start_time_ns,
+                             uint64_t end_time_ns,
+                             const struct bhi360_logbin_reader *reader,
+                             struct bhi360_logbin_iter *iter)
+{
+    if (iter)
+    {
+        iter->reader = reader;
+        iter->sensor_id = sensor_id;
+        iter->start_time_ns = start_time_ns;
+        iter->end_time_ns = end_time_ns;
+        iter->pos = reader ? reader->data_start : 0;
+        iter->time_ns = 0;
+        iter->entry = 0;
+        iter->event = 0;
+        iter->chunk.count = 0;
+    }
+}
+
+/**
+* @brief Function to get the next event of a version 1.0 log
+* @param[in] iter   : Iterator
+* @param[out] event : Event
+* @return 1 if an event is returned, 0 at the end
+*/
+static uint8_t next_event_v1(struct bhi360_logbin_iter *iter, struct bhi360_logbin_event *event)
+{
+    const struct bhi360_logbin_reader *reader = iter->reader;
+    const uint8_t *data = reader->data;
+    const struct bhi360_logbin_meta *meta;
+    uint8_t id, size;
+
+    while (iter->pos < reader->data_end)
+    {
+        id = data[iter->pos];
+        meta = &reader->meta[id];
+        if (id == LOGBIN_META_ID_TIME_NS)
+        {
+            size = LOGBIN_TIME_NS_SIZE;
+        }
+        else if (id == LOGBIN_META_ID_LABEL)
+        {
+            size = LOGBIN_LABEL_SIZE;
+        }
+        else if (meta->valid && (meta->event_size != 0))
+        {
+            size = meta->event_size - 1;
+        }
+        else
+        {
+            /* Without the event size the rest cannot be read */
+            break;
+        }
+
+        if ((reader->data_end - iter->pos - 1) < size)
+        {
+            break;
+        }
+
+        iter->pos += 1 + size;
+        if (id == LOGBIN_META_ID_TIME_NS)
+        {
+            iter->time_ns = get_le(&data[iter->pos - size], LOGBIN_TIME_NS_SIZE);
+        }
+        else if ((id != LOGBIN_META_ID_LABEL) &&
+                 ((iter->sensor_id == LOGBIN_ALL_SENSORS) || (iter->sensor_id == id)) &&
+                 (iter->time_ns >= iter->start_time_ns) && (iter->time_ns <= iter->end_time_ns))
+        {
+            event->sensor_id = id;
+            event->payload_size = size;
+            event->time_ns = iter->time_ns;
+            event->payload = &data[iter->pos - size];
+
+            return 1;
+        }
+    }
+
+    iter->pos = reader->data_end;
+
+    return 0;
+}
+
+/**
+* @brief Function to move to the next chunk of a version 2.0 log matching the filter
+* @param[in] iter : Iterator
+* @return 1 if a chunk is found, 0 at the end
+*/
+static uint8_t next_chunk(struct bhi360_logbin_iter *iter)
+{
+    const struct bhi360_logbin_reader *reader = iter->reader;
+    const uint8_t *header;
+    struct bhi360_logbin_chunk *chunk = &iter->chunk;
+    uint8_t found = 0;
+
+    while (!found)
+    {
+        if (reader->index_len != 0)
+        {
+            if (iter->entry == reader->index_len)
+            {
+                break;
+            }
+
+            header = &reader->data[reader->index_start + (iter->entry++ * LOGBIN_INDEX_ENTRY_SIZE)];
+            get_chunk_info(header, chunk);
+            chunk->offset = get_le(&header[LOGBIN_CHUNK_HEADER_SIZE - 1], 8);
+        }
+        else
+        {
+            /* No index, scan the chunk headers */
+            if (((reader->data_end - iter->pos) < LOGBIN_CHUNK_HEADER_SIZE) ||
+                (reader->data[iter->pos] != LOGBIN_CHUNK_MARKER))
+            {
+                break;
+            }
+
+            get_chunk_info(&reader->data[iter->pos + 1], chunk);
+            chunk->offset = iter->pos;
+            iter->pos += LOGBIN_CHUNK_HEADER_SIZE;
+            if ((reader->data_end - iter->pos) < chunk->size)
+            {
+                break;
+            }
+
+            iter->pos += chunk->size;
+        }
+
+        if ((chunk->offset < reader->data_start) || (chunk->offset > reader->data_end) ||
+            ((reader->data_end - chunk->offset) < LOGBIN_CHUNK_HEADER_SIZE) ||
+            ((reader->data_end - chunk->offset - LOGBIN_CHUNK_HEADER_SIZE) < chunk->size))
+        {
+            break;
+        }
+
+        if (((iter->sensor_id != LOGBIN_ALL_SENSORS) && (iter->sensor_id != chunk->sensor_id)) ||
+            (chunk->end_time_ns < iter->start_time_ns) || (chunk->start_time_ns > iter->end_time_ns))
+        {
+            continue;
+        }
+
+        header = &reader->data[chunk->offset + LOGBIN_CHUNK_HEADER_SIZE];
+        if ((chunk->codec == LOGBIN_CODEC_RAW) &&
+            ((uint64_t)chunk->count * (LOGBIN_TIME_NS_SIZE + chunk->event_size) == chunk->size))
+        {
+            iter->times = header;
+            iter->payloads = &header[chunk->count * LOGBIN_TIME_NS_SIZE];
+            found = 1;
+        }
+        else if ((chunk->codec != LOGBIN_CODEC_RAW) && (chunk->count <= LOGBIN_CHUNK_EVENTS) &&
+                 ((chunk->count * chunk->event_size) <= LOGBIN_CHUNK_PAYLOAD_SIZE) &&
+                 bhi360_logbin_decode(chunk->codec, chunk->start_time_ns, header, chunk->size, chunk->event_size,
+                                      chunk->count, iter->decoded_time_ns, iter->decoded_payload))
+        {
+            iter->times = NULL;
+            iter->payloads = iter->decoded_payload;
+            found = 1;
+        }
+
+        /* Chunks that cannot be read are skipped */
+    }
+
+    iter->event = 0;
+    if (!found)
+    {
+        chunk->count = 0;
+        iter->entry = reader->index_len;
+        iter->pos = reader->data_end;
+    }
+
+    return found;
+}
+
+/**
+* @brief Function to get the next event. The payload stays valid until the next call
+* @param[in] iter   : Iterator
+* @param[out] event : Event
+* @return 1 if an event is returned, 0 at the end
+*/
+uint8_t bhi360_logbin_iter_next(struct bhi360_logbin_iter *iter, struct bhi360_logbin_event *event)
+{
+    struct bhi360_logbin_chunk *chunk;
+    uint64_t time_ns;
+    uint8_t rslt = 0;
+
+    if (!iter || !event || !iter->reader || !iter->reader->data)
+    {
+        return 0;
+    }
+
+    if (iter->reader->format == LOGBIN_FORMAT_V1)
+    {
+        return next_event_v1(iter, event);
+    }
+
+    chunk = &iter->chunk;
+    while (!rslt && ((iter->event < chunk->count) || next_chunk(iter)))
+    {
+        time_ns = iter->times ? get_le(&iter->times[iter->event * LOGBIN_TIME_NS_SIZE], LOGBIN_TIME_NS_SIZE)
+                  : iter->decoded_time_ns[iter->event];
+        if ((time_ns >= iter->start_time_ns) && (time_ns <= iter->end_time_ns))
+        {
+            event->sensor_id = chunk->sensor_id;
+            event->payload_size = chunk->event_size;
+            event->time_ns = time_ns;
+            event->payload = &iter->payloads[iter->event * chunk->event_size];
+            rslt = 1;
+        }
+
+        iter->event++;
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to get the number of values of a sensor from its parse format, a comma separated
+*        list of s8, u8, s16, u16, s24, u24, s32, u32 and f32, or of the letters b, B, h, H, i, I and f
+*        that may also follow each other without commas
+* @param[in] sensor_id : Sensor ID
+* @param[in] reader    : Reader instance
+* @return Number of values, 0 if the format is not known
+*/
+uint8_t bhi360_logbin_get_value_count(uint8_t sensor_id, const struct bhi360_logbin_reader *reader)
+{
+    uint8_t count = 0;
+
+    if (reader && reader->meta[sensor_id].valid)
+    {
+        count = bhi360_logbin_parse_values(reader->meta[sensor_id].parse_format,
+                                           NULL,
+                                           0,
+                                           1.0f,
+                                           NULL,
+                                           LOGBIN_MAX_VALUES);
+    }
+
+    return count;
+}
+
+/**
+* @brief Function to decode an event into scaled values, using the parse format and scaling of
+*        the meta data of its sensor
+* @param[in] event   : Event
+* @param[out] values : Values, bhi360_logbin_get_value_count of the sensor
+* @param[in] reader  : Reader instance
+* @return Number of values
+*/
+uint8_t bhi360_logbin_get_values(const struct bhi360_logbin_event *event,
+                                 float *values,
+                                 const struct bhi360_logbin_reader *reader)
+{
+    uint8_t count = 0;
+
+    if (event && values && reader && reader->meta[event->sensor_id].valid)
+    {
+        count = bhi360_logbin_parse_values(reader->meta[event->sensor_id].parse_format,
+                                           event->payload,
+                                           event->payload_size,
+                                           reader->meta[event->sensor_id].scaling,
+                                           values,
+                                           LOGBIN_MAX_VALUES);
+    }
+
+    return count;
+}
+
+/**
+* @brief Function to decode the events of a sensor into scaled values, using the parse format
+*        and scaling of its meta data
+* @param[in] sensor_id     : Sensor ID
+* @param[in] start_time_ns : Lowest timestamp
+* @param[in] end_time_ns   : Highest timestamp
+* @param[in] max_events    : Size of the arrays in events
+* @param[out] time_ns      : Timestamps, NULL if not needed
+* @param[out] values       : Values, bhi360_logbin_get_value_count per event
+* @param[in] reader        : Reader instance
+* @return Number of events decoded
+*/
+uint32_t bhi360_logbin_read_values(uint8_t sensor_id,
+                                   uint64_t start_time_ns,
+                                   uint64_t end_time_ns,
+                                   uint32_t max_events,
+                                   uint64_t *time_ns,
+                                   float *values,
+                                   const struct bhi360_logbin_reader *reader)
+{
+    struct bhi360_logbin_iter iter;
+    struct bhi360_logbin_event event;
+    uint8_t count = bhi360_logbin_get_value_count(sensor_id, reader);
+    uint32_t n = 0;
+
+    if (values && (count != 0))
+    {
+        bhi360_logbin_iter_init(sensor_id, start_time_ns, end_time_ns, reader, &iter);
+        while ((n < max_events) && bhi360_logbin_iter_next(&iter, &event))
+        {
+            (void)bhi360_logbin_get_values(&event, &values[n * count], reader);
+            if (time_ns)
+            {
+                time_ns[n] = event.time_ns;
+            }
+
+            n++;
+        }
+    }
+
+    return n;
+}
+
+/**
+* @brief Function to set the position of a file, with a 64-bit offset for files over 2 GiB
+* @param[in] file   : File
+* @param[in] offset : Offset
+* @param[in] origin : SEEK_SET or SEEK_END
+* @return 0 on success
+*/
+static int seek_file(FILE *file, int64_t offset, int origin)
+{
+#ifdef _WIN32
+    return _fseeki64(file, offset, origin);
+#else
+    return fseeko(file, (off_t)offset, origin);
+#endif
+}
+
+/**
+* @brief Function to read the buckets of a level of a summary file, see bhi360_logbin_summary.h.
+*        Only the index and the blocks of the level overlapping the time range are read
+* @param[in] path          : Path of the summary file
+* @param[in] level         : Level, such as from bhi360_logbin_summary_level
+* @param[in] sensor_id     : Sensor ID, or LOGBIN_ALL_SENSORS
+* @param[in] start_time_ns : Lowest timestamp
+* @param[in] end_time_ns   : Highest timestamp
+* @param[in] max_buckets   : Size of buckets
+* @param[out] buckets      : Buckets, in order of time for each sensor
+* @return Number of buckets read, 0 if the file cannot be read or is not a summary file
+*/
+uint32_t bhi360_logbin_read_summary(const char *path,
+                                    uint8_t level,
+                                    uint16_t sensor_id,
+                                    uint64_t start_time_ns,
+                                    uint64_t end_time_ns,
+                                    uint32_t max_buckets,
+                                    struct bhi360_logbin_bucket *buckets)
+{
+    FILE *file;
+    uint8_t trailer[LOGBIN_SUMMARY_TRAILER_SIZE];
+    uint8_t block[LOGBIN_SUMMARY_BLOCK_SIZE];
+    uint8_t *index = NULL;
+    const uint8_t *entry, *src;
+    struct bhi360_logbin_bucket *bucket;
+    uint64_t span = 0, time_ns;
+    uint32_t n_entries = 0, size, count = 0;
+    uint16_t n_buckets;
+    uint8_t n_axes;
+
+    file = (path && buckets) ? fopen(path, "rb") : NULL;
+    if (file && (seek_file(file, -(int64_t)LOGBIN_SUMMARY_TRAILER_SIZE, SEEK_END) == 0) &&
+        (fread(trailer, 1, LOGBIN_SUMMARY_TRAILER_SIZE, file) == LOGBIN_SUMMARY_TRAILER_SIZE) &&
+        (memcmp(&trailer[16], LOGBIN_SUMMARY_MAGIC, 4) == 0) && (level < trailer[13]))
+    {
+        span = UINT64_C(1) << (trailer[12] + level);
+        n_entries = (uint32_t)get_le(&trailer[8], 4);
+        index = (uint8_t *)malloc((size_t)n_entries * LOGBIN_SUMMARY_INDEX_ENTRY_SIZE + 1);
+        if (!index || (seek_file(file, (int64_t)get_le(trailer, 8), SEEK_SET) != 0) ||
+            (fread(index, LOGBIN_SUMMARY_INDEX_ENTRY_SIZE, n_entries, file) != n_entries))
+        {
+            n_entries = 0;
+        }
+    }
+
+    for (uint32_t i = 0; i < n_entries; i++)
+    {
+        /* Level (1), number of buckets (2), start time (8), end time (8), data size (4), offset (8) */
+        entry = &index[i * LOGBIN_SUMMARY_INDEX_ENTRY_SIZE];
+        size = (uint32_t)get_le(&entry[19], 4);
+        if ((entry[0] != level) || (get_le(&entry[3], 8) > end_time_ns) ||
+            ((get_le(&entry[11], 8) + span) <= start_time_ns) || (size > sizeof(block)) ||
+            (seek_file(file, (int64_t)(get_le(&entry[23], 8) + LOGBIN_SUMMARY_BLOCK_HEADER_SIZE), SEEK_SET) != 0) ||
+            (fread(block, 1, size, file) != size))
+        {
+            continue;
+        }
+
+        src = block;
+        n_buckets = (uint16_t)get_le(&entry[1], 2);
+        for (uint16_t j = 0; (j < n_buckets) && (count < max_buckets); j++)
+        {
+            n_axes = src[1];
+            if ((n_axes > LOGBIN_SUMMARY_AXES) || ((src + LOGBIN_SUMMARY_BUCKET_SIZE(n_axes)) > &block[size]))
+            {
+                break;
+            }
+
+            time_ns = get_le(&src[6], 8);
+            if (((sensor_id == LOGBIN_ALL_SENSORS) || (sensor_id == src[0])) && (time_ns <= end_time_ns) &&
+                ((time_ns + span) > start_time_ns))
+            {
+                bucket = &buckets[count++];
+                bucket->sensor_id = src[0];
+                bucket->n_axes = n_axes;
+                bucket->level = level;
+                bucket->count = (uint32_t)get_le(&src[2], 4);
+                bucket->start_time_ns = time_ns;
+                for (uint8_t k = 0; k < n_axes; k++)
+                {
+                    get_float(&src[LOGBIN_SUMMARY_BUCKET_HEADER_SIZE + (12 * k)], &bucket->min[k]);
+                    get_float(&src[LOGBIN_SUMMARY_BUCKET_HEADER_SIZE + (12 * k) + 4], &bucket->max[k]);
+                    get_float(&src[LOGBIN_SUMMARY_BUCKET_HEADER_SIZE + (12 * k) + 8], &bucket->mean[k]);
+                }
+            }
+
+            src += LOGBIN_SUMMARY_BUCKET_SIZE(n_axes);
+        }
+    }
+
+    free(index);
+    if (file)
+    {
+        fclose(file);
+    }
+
+    return count;
+}
@@ -0,0 +1,213 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_logbin_reader.h
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#ifndef _BHI360_LOGBIN_READER_H_
+#define _BHI360_LOGBIN_READER_H_
+
+/* Start of CPP Guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bhi360_logbin.h"
+
+/*
+ * Reader of version 1.0 and 2.0 log files, for the host. The file is memory mapped and the
+ * events point into the mapping, except those of chunks stored with a codec, which are
+ * decoded into the iterator
+ */
+#define LOGBIN_ALL_SENSORS      UINT16_C(0x100)
+#define LOGBIN_META_TEXT_SIZE   UINT8_C(48)
+#define LOGBIN_MAX_VALUES       UINT8_C(32)
+
+struct bhi360_logbin_meta
+{
+    uint8_t valid;
+    uint8_t event_size; /* As logged, including the sensor ID */
+    char name[LOGBIN_META_TEXT_SIZE];
+    char parse_format[LOGBIN_META_TEXT_SIZE];
+    char axis_names[LOGBIN_META_TEXT_SIZE];
+    float scaling;
+};
+
+struct bhi360_logbin_reader
+{
+    const uint8_t *data;
+    size_t size;
+    void *handle; /* Mapping handle, Windows only */
+    uint8_t format; /* LOGBIN_FORMAT_V1 or LOGBIN_FORMAT_V2 */
+    size_t data_start; /* Offset of the first event or chunk */
+    size_t data_end;
+    size_t index_start;
+    uint32_t index_len; /* Entries of the index of version 2.0, 0 to scan the chunks */
+    struct bhi360_logbin_meta meta[256];
+};
+
+struct bhi360_logbin_event
+{
+    uint8_t sensor_id;
+    uint8_t payload_size;
+    uint64_t time_ns;
+    const uint8_t *payload;
+};
+
+struct bhi360_logbin_iter
+{
+    const struct bhi360_logbin_reader *reader;
+    uint16_t sensor_id;
+    uint64_t start_time_ns;
+    uint64_t end_time_ns;
+    size_t pos; /* Next event of version 1.0, next chunk when scanning version 2.0 */
+    uint64_t time_ns;
+    uint32_t entry; /* Next index entry */
+    struct bhi360_logbin_chunk chunk;
+    uint32_t event; /* Next event of the chunk */
+    const uint8_t *times; /* Timestamps of a raw chunk, NULL when decoded */
+    const uint8_t *payloads;
+    uint64_t decoded_time_ns[LOGBIN_CHUNK_EVENTS];
+    uint8_t decoded_payload[LOGBIN_CHUNK_PAYLOAD_SIZE];
+};
+
+/**
+* @brief Function to open a log file and read its meta data
+* @param[in] path    : Path of the log file
+* @param[out] reader : Reader instance
+* @return 1 on success, 0 if the file cannot be mapped or is not a log file
+*/
+uint8_t bhi360_logbin_open(const char *path, struct bhi360_logbin_reader *reader);
+
+/**
+* @brief Function to close a log file
+* @param[in] reader : Reader instance
+*/
+void bhi360_logbin_close(struct bhi360_logbin_reader *reader);
+
+/**
+* @brief Function to start iterating over the events of a log file. Events are returned in file
+*        order, which for version 2.0 is chunk by chunk and not merged by time across sensors
+* @param[in] sensor_id     : Sensor ID, or LOGBIN_ALL_SENSORS
+* @param[in] start_time_ns : Lowest timestamp
+* @param[in] end_time_ns   : Highest timestamp
+* @param[in] reader        : Reader instance
+* @param[out] iter         : Iterator
+*/
+void bhi360_logbin_iter_init(uint16_t sensor_id,
+                             uint64_t start_time_ns,
+                             uint64_t end_time_ns,
+                             const struct bhi360_logbin_reader *reader,
+                             struct bhi360_logbin_iter *iter);
+
+/**
+* @brief Function to get the next event. The payload stays valid until the next call
+* @param[in] iter   : Iterator
+* @param[out] event : Event
+* @return 1 if an event is returned, 0 at the end
+*/
+uint8_t bhi360_logbin_iter_next(struct bhi360_logbin_iter *iter, struct bhi360_logbin_event *event);
+
+/**
+* @brief Function to get the number of values of a sensor from its parse format, a comma separated
+*        list of s8, u8, s16, u16, s24, u24, s32, u32 and f32, or of the letters b, B, h, H, i, I and f
+*        that may also follow each other without commas
+* @param[in] sensor_id : Sensor ID
+* @param[in] reader    : Reader instance
+* @return Number of values, 0 if the format is not known
+*/
+uint8_t bhi360_logbin_get_value_count(uint8_t sensor_id, const struct bhi360_logbin_reader *reader);
+
+/**
+* @brief Function to decode an event into scaled values, using the parse format and scaling of
+*        the meta data of its sensor
+* @param[in] event   : Event
+* @param[out] values : Values, bhi360_logbin_get_value_count of the sensor
+* @param[in] reader  : Reader instance
+* @return Number of values
+*/
+uint8_t bhi360_logbin_get_values(const struct bhi360_logbin_event *event,
+                                 float *values,
+                                 const struct bhi360_logbin_reader *reader);
+
+/**
+* @brief Function to decode the events of a sensor into scaled values, using the parse format
+*        and scaling of its meta data
+* @param[in] sensor_id     : Sensor ID
+* @param[in] start_time_ns : Lowest timestamp
+* @param[in] end_time_ns   : Highest timestamp
+* @param[in] max_events    : Size of the arrays in events
+* @param[out] time_ns      : Timestamps, NULL if not needed
+* @param[out] values       : Values, bhi360_logbin_get_value_count per event
+* @param[in] reader        : Reader instance
+* @return Number of events decoded
+*/
+uint32_t bhi360_logbin_read_values(uint8_t sensor_id,
+                                   uint64_t start_time_ns,
+                                   uint64_t end_time_ns,
+                                   uint32_t max_events,
+                                   uint64_t *time_ns,
+                                   float *values,
+                                   const struct bhi360_logbin_reader *reader);
+
+/**
+* @brief Function to read the buckets of a level of a summary file, see bhi360_logbin_summary.h.
+*        Only the index and the blocks of the level overlapping the time range are read
+* @param[in] path          : Path of the summary file
+* @param[in] level         : Level, such as from bhi360_logbin_summary_level
+* @param[in] sensor_id     : Sensor ID, or LOGBIN_ALL_SENSORS
+* @param[in] start_time_ns : Lowest timestamp
+* @param[in] end_time_ns   : Highest timestamp
+* @param[in] max_buckets   : Size of buckets
+* @param[out] buckets      : Buckets, in order of time for each sensor
+* @return Number of buckets read, 0 if the file cannot be read or is not a summary file
+*/
+uint32_t bhi360_logbin_read_summary(const char *path,
+                                    uint8_t level,
+                                    uint16_t sensor_id,
+                                    uint64_t start_time_ns,
+                                    uint64_t end_time_ns,
+                                    uint32_t max_buckets,
+                                    struct bhi360_logbin_bucket *buckets);
+
+/* End of CPP Guard */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* _BHI360_LOGBIN_READER_H_ */
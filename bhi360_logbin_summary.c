@@ -0,0 +1,432 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_logbin_summary.c
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bhi360_logbin.h"
+#include "bhi360_logbin_summary.h"
+
+/**
+* @brief Function to store a value in little endian
+* @param[out] dst   : Destination
+* @param[in] value  : Value
+* @param[in] size   : Size of the value in bytes
+*/
+static void put_le(uint8_t *dst, uint64_t value, uint8_t size)
+{
+    for (uint8_t i = 0; i < size; i++)
+    {
+        dst[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/**
+* @brief Function to store a float in little endian
+* @param[out] dst   : Destination
+* @param[in] value  : Value
+*/
+static void put_float(uint8_t *dst, float value)
+{
+    uint32_t raw;
+
+    memcpy(&raw, &value, sizeof(raw));
+    put_le(dst, raw, 4);
+}
+
+/**
+* @brief Function to write the block of a level and add it to the index
+* @param[in] level   : Level
+* @param[in] summary : Summary instance
+*/
+static void write_block(uint8_t level, struct bhi360_logbin_summary *summary)
+{
+    struct bhi360_logbin_summary_block *block = &summary->block[level];
+    struct bhi360_logbin_summary_entry *index;
+    uint8_t header[LOGBIN_SUMMARY_BLOCK_HEADER_SIZE];
+
+    header[0] = LOGBIN_SUMMARY_BLOCK_MARKER;
+    header[1] = level;
+    put_le(&header[2], block->count, 2);
+    put_le(&header[4], block->start_time_ns, 8);
+    put_le(&header[12], block->end_time_ns, 8);
+    put_le(&header[20], block->len, 4);
+    fwrite(header, 1, LOGBIN_SUMMARY_BLOCK_HEADER_SIZE, summary->file);
+    fwrite(block->data, 1, block->len, summary->file);
+
+    if (summary->index_len == summary->index_size)
+    {
+        index = (struct bhi360_logbin_summary_entry *)realloc(summary->index,
+                                                              (summary->index_size + 64) *
+                                                              sizeof(struct bhi360_logbin_summary_entry));
+        if (index)
+        {
+            summary->index = index;
+            summary->index_size += 64;
+        }
+    }
+
+    /* Without memory the block is left out of the index */
+    if (summary->index_len < summary->index_size)
+    {
+        index = &summary->index[summary->index_len++];
+        index->level = level;
+        index->count = block->count;
+        index->start_time_ns = block->start_time_ns;
+        index->end_time_ns = block->end_time_ns;
+        index->size = block->len;
+        index->offset = summary->offset;
+    }
+
+    summary->offset += LOGBIN_SUMMARY_BLOCK_HEADER_SIZE + block->len;
+    block->count = 0;
+    block->len = 0;
+}
+
+/**
+* @brief Function to add a finished bucket to the block of its level
+* @param[in] sensor  : Sensor of the bucket
+* @param[in] level   : Level of the bucket
+* @param[in] summary : Summary instance
+*/
+static void add_bucket(const struct bhi360_logbin_summary_sensor *sensor,
+                       uint8_t level,
+                       struct bhi360_logbin_summary *summary)
+{
+    const struct bhi360_logbin_summary_acc *acc = &sensor->level[level];
+    struct bhi360_logbin_summary_block *block = &summary->block[level];
+    uint16_t size = LOGBIN_SUMMARY_BUCKET_SIZE(sensor->n_axes);
+    uint64_t start_time_ns = acc->bucket << (LOGBIN_SUMMARY_SHIFT + level);
+    uint8_t *dst;
+
+    if ((block->len + size) > LOGBIN_SUMMARY_BLOCK_SIZE)
+    {
+        write_block(level, summary);
+    }
+
+    if ((block->count == 0) || (start_time_ns < block->start_time_ns))
+    {
+        block->start_time_ns = start_time_ns;
+    }
+
+    if ((block->count == 0) || (start_time_ns > block->end_time_ns))
+    {
+        block->end_time_ns = start_time_ns;
+    }
+
+    dst = &block->data[block->len];
+    dst[0] = sensor->sensor_id;
+    dst[1] = sensor->n_axes;
+    put_le(&dst[2], acc->count, 4);
+    put_le(&dst[6], start_time_ns, 8);
+    dst += LOGBIN_SUMMARY_BUCKET_HEADER_SIZE;
+    for (uint8_t i = 0; i < sensor->n_axes; i++)
+    {
+        put_float(&dst[0], acc->min[i]);
+        put_float(&dst[4], acc->max[i]);
+        put_float(&dst[8], (float)(acc->sum[i] / acc->count));
+        dst += 12;
+    }
+
+    block->len += size;
+    block->count++;
+}
+
+/**
+* @brief Function to merge the bucket of a level into the bucket of the level above
+* @param[in] sensor : Sensor
+* @param[in] level  : Level of the merged bucket, below the top level
+*/
+static void merge_bucket(struct bhi360_logbin_summary_sensor *sensor, uint8_t level)
+{
+    const struct bhi360_logbin_summary_acc *child = &sensor->level[level];
+    struct bhi360_logbin_summary_acc *parent = &sensor->level[level + 1];
+
+    if (parent->count == 0)
+    {
+        *parent = *child;
+        parent->bucket = child->bucket >> 1;
+    }
+    else
+    {
+        for (uint8_t i = 0; i < sensor->n_axes; i++)
+        {
+            parent->min[i] = (child->min[i] < parent->min[i]) ? child->min[i] : parent->min[i];
+            parent->max[i] = (child->max[i] > parent->max[i]) ? child->max[i] : parent->max[i];
+            parent->sum[i] += child->sum[i];
+        }
+
+        parent->count += child->count;
+    }
+}
+
+/**
+* @brief Function to finish the buckets that do not contain a timestamp. The open buckets of all
+*        levels hold the same latest event, so each finished bucket goes into the open bucket above
+* @param[in] sensor  : Sensor
+* @param[in] time_ns : Timestamp (ns)
+* @param[in] all     : 1 to finish all buckets
+* @param[in] summary : Summary instance
+*/
+static void finish_buckets(struct bhi360_logbin_summary_sensor *sensor,
+                           uint64_t time_ns,
+                           uint8_t all,
+                           struct bhi360_logbin_summary *summary)
+{
+    struct bhi360_logbin_summary_acc *acc;
+
+    for (uint8_t level = 0; level < LOGBIN_SUMMARY_LEVELS; level++)
+    {
+        acc = &sensor->level[level];
+        if (acc->count == 0)
+        {
+            continue;
+        }
+
+        /* Buckets above one containing the timestamp contain it too */
+        if (!all && (acc->bucket == (time_ns >> (LOGBIN_SUMMARY_SHIFT + level))))
+        {
+            break;
+        }
+
+        add_bucket(sensor, level, summary);
+        if ((level + 1) < LOGBIN_SUMMARY_LEVELS)
+        {
+            merge_bucket(sensor, level);
+        }
+
+        acc->count = 0;
+    }
+}
+
+/**
+* @brief Function to start a summary file
+* @param[in] file     : Summary file, opened for writing in binary mode
+* @param[out] summary : Summary instance
+*/
+void bhi360_logbin_summary_init(FILE *file, struct bhi360_logbin_summary *summary)
+{
+    if (summary)
+    {
+        memset(summary, 0, sizeof(struct bhi360_logbin_summary));
+        summary->file = file;
+    }
+}
+
+/**
+* @brief Function to add a sensor to the summary. Called by bhi360_logbin_add_meta for the
+*        summary set with bhi360_logbin_set_summary
+* @param[in] sensor_id    : Sensor ID
+* @param[in] parse_format : Sensor parse format, as for bhi360_logbin_parse_values
+* @param[in] scaling      : Sensor scaling factor
+* @param[in] summary      : Summary instance
+* @return API error codes. BHI360_E_INSUFFICIENT_MAX_SIMUL_SENSORS if the summary has no room
+*         for the sensor
+*/
+int8_t bhi360_logbin_summary_add_sensor(uint8_t sensor_id,
+                                        const char *parse_format,
+                                        float scaling,
+                                        struct bhi360_logbin_summary *summary)
+{
+    struct bhi360_logbin_summary_sensor *sensor;
+    uint8_t n_axes;
+    int8_t rslt = BHI360_OK;
+
+    if ((summary == NULL) || (parse_format == NULL))
+    {
+        rslt = BHI360_E_NULL_PTR;
+    }
+    else if (summary->slot[sensor_id] == 0)
+    {
+        /* Sensors without values to summarize, such as events without payload, are left out */
+        n_axes = bhi360_logbin_parse_values(parse_format, NULL, 0, 1.0f, NULL, LOGBIN_SUMMARY_AXES);
+        if ((n_axes != 0) && (summary->n_sensors >= LOGBIN_SUMMARY_SENSORS))
+        {
+            rslt = BHI360_E_INSUFFICIENT_MAX_SIMUL_SENSORS;
+        }
+        else if (n_axes != 0)
+        {
+            sensor = &summary->sensor[summary->n_sensors++];
+            memset(sensor, 0, sizeof(struct bhi360_logbin_summary_sensor));
+            sensor->sensor_id = sensor_id;
+            sensor->n_axes = n_axes;
+            snprintf(sensor->parse_format, sizeof(sensor->parse_format), "%s", parse_format);
+            sensor->scaling = scaling;
+            summary->slot[sensor_id] = summary->n_sensors;
+        }
+    }
+
+    return rslt;
+}
+
+/**
+* @brief Function to add an event to the summary. Called by bhi360_logbin_add_data for the
+*        summary set with bhi360_logbin_set_summary. Events of sensors not added are ignored
+* @param[in] sensor_id     : Sensor ID
+* @param[in] time_ns       : Timestamp (ns)
+* @param[in] event_size    : Event size
+* @param[in] event_payload : Event payload
+* @param[in] summary       : Summary instance
+*/
+void bhi360_logbin_summary_add(uint8_t sensor_id,
+                               uint64_t time_ns,
+                               uint8_t event_size,
+                               const uint8_t *event_payload,
+                               struct bhi360_logbin_summary *summary)
+{
+    struct bhi360_logbin_summary_sensor *sensor = NULL;
+    struct bhi360_logbin_summary_acc *acc;
+    float values[LOGBIN_SUMMARY_AXES];
+
+    if (summary && summary->file && event_payload && (summary->slot[sensor_id] != 0))
+    {
+        sensor = &summary->sensor[summary->slot[sensor_id] - 1];
+    }
+
+    if (sensor)
+    {
+        acc = &sensor->level[0];
+
+        /* Finish everything when the time goes back, so that each bucket only spans its own time */
+        finish_buckets(sensor,
+                       time_ns,
+                       (acc->count != 0) && ((time_ns >> LOGBIN_SUMMARY_SHIFT) < acc->bucket),
+                       summary);
+
+        (void)bhi360_logbin_parse_values(sensor->parse_format,
+                                         event_payload,
+                                         event_size,
+                                         sensor->scaling,
+                                         values,
+                                         LOGBIN_SUMMARY_AXES);
+        if (acc->count == 0)
+        {
+            acc->bucket = time_ns >> LOGBIN_SUMMARY_SHIFT;
+            for (uint8_t i = 0; i < sensor->n_axes; i++)
+            {
+                acc->min[i] = values[i];
+                acc->max[i] = values[i];
+                acc->sum[i] = 0.0;
+            }
+        }
+
+        for (uint8_t i = 0; i < sensor->n_axes; i++)
+        {
+            acc->min[i] = (values[i] < acc->min[i]) ? values[i] : acc->min[i];
+            acc->max[i] = (values[i] > acc->max[i]) ? values[i] : acc->max[i];
+            acc->sum[i] += values[i];
+        }
+
+        acc->count++;
+    }
+}
+
+/**
+* @brief Function to write the open buckets, the remaining blocks and the index. Call it
+*        before closing the summary file
+* @param[in] summary : Summary instance
+*/
+void bhi360_logbin_summary_end(struct bhi360_logbin_summary *summary)
+{
+    struct bhi360_logbin_summary_entry *index;
+    uint8_t entry[LOGBIN_SUMMARY_INDEX_ENTRY_SIZE];
+    uint8_t trailer[LOGBIN_SUMMARY_TRAILER_SIZE];
+
+    if (summary && summary->file)
+    {
+        for (uint8_t i = 0; i < summary->n_sensors; i++)
+        {
+            finish_buckets(&summary->sensor[i], 0, 1, summary);
+        }
+
+        for (uint8_t level = 0; level < LOGBIN_SUMMARY_LEVELS; level++)
+        {
+            if (summary->block[level].count != 0)
+            {
+                write_block(level, summary);
+            }
+        }
+
+        for (uint32_t i = 0; i < summary->index_len; i++)
+        {
+            index = &summary->index[i];
+            entry[0] = index->level;
+            put_le(&entry[1], index->count, 2);
+            put_le(&entry[3], index->start_time_ns, 8);
+            put_le(&entry[11], index->end_time_ns, 8);
+            put_le(&entry[19], index->size, 4);
+            put_le(&entry[23], index->offset, 8);
+            fwrite(entry, 1, LOGBIN_SUMMARY_INDEX_ENTRY_SIZE, summary->file);
+        }
+
+        put_le(trailer, summary->offset, 8);
+        put_le(&trailer[8], summary->index_len, 4);
+        trailer[12] = LOGBIN_SUMMARY_SHIFT;
+        trailer[13] = LOGBIN_SUMMARY_LEVELS;
+        trailer[14] = 0;
+        trailer[15] = 0;
+        memcpy(&trailer[16], LOGBIN_SUMMARY_MAGIC, 4);
+        fwrite(trailer, 1, LOGBIN_SUMMARY_TRAILER_SIZE, summary->file);
+        fflush(summary->file);
+
+        free(summary->index);
+        summary->index = NULL;
+        summary->index_len = 0;
+        summary->index_size = 0;
+    }
+}
+
+/**
+* @brief Function to get the lowest level with at most max_buckets buckets over a duration
+* @param[in] duration_ns : Duration to show
+* @param[in] max_buckets : Number of buckets, such as the width of the view in pixels
+* @return Level
+*/
+uint8_t bhi360_logbin_summary_level(uint64_t duration_ns, uint32_t max_buckets)
+{
+    uint8_t level = 0;
+
+    max_buckets = (max_buckets != 0) ? max_buckets : 1;
+    while (((level + 1) < LOGBIN_SUMMARY_LEVELS) &&
+           ((duration_ns >> (LOGBIN_SUMMARY_SHIFT + level)) >= max_buckets))
+    {
+        level++;
+    }
+
+    return level;
+}
@@ -0,0 +1,222 @@
+/**
+* Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bhi360_logbin_summary.h
+* @date       2025-03-28
+* @version    v2.2.0
+*
+*/
+
+#ifndef _BHI360_LOGBIN_SUMMARY_H_
+#define _BHI360_LOGBIN_SUMMARY_H_
+
+/* Start of CPP Guard */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "bhi360_defs.h"
+
+/*
+ * Summary file written next to a log, with the minimum, maximum and mean of each axis of each
+ * sensor over time buckets. Buckets of level 0 span 2^LOGBIN_SUMMARY_SHIFT ns, each level
+ * doubles the span, so a viewer picks the level matching its zoom and reads a few kilobytes
+ * instead of the events.
+ *
+ * Bucket  : sensor ID (1), number of axes (1), number of events (4), start time (8), then the
+ *           minimum, maximum and mean of each axis as float (4 each), after scaling
+ * Block   : marker (1), level (1), number of buckets (2), start time (8), end time (8),
+ *           data size (4), then the buckets of one level. Start and end are the lowest and
+ *           highest bucket start times
+ * Index   : one entry per block, the block header without the marker followed by the file
+ *           offset of the block (8)
+ * Trailer : offset of the index (8), number of entries (4), LOGBIN_SUMMARY_SHIFT (1),
+ *           number of levels (1), reserved (2), LOGBIN_SUMMARY_MAGIC (4)
+ *
+ * Multi-byte fields are little endian
+ */
+#define LOGBIN_SUMMARY_BLOCK_MARKER        UINT8_C(0xD5)
+#define LOGBIN_SUMMARY_BLOCK_HEADER_SIZE   UINT8_C(24)
+#define LOGBIN_SUMMARY_INDEX_ENTRY_SIZE    UINT8_C(31)
+#define LOGBIN_SUMMARY_TRAILER_SIZE        UINT8_C(20)
+#define LOGBIN_SUMMARY_BUCKET_HEADER_SIZE  UINT8_C(14)
+#define LOGBIN_SUMMARY_MAGIC               "LBS1"
+
+/* Span of the buckets of level 0, 2^27 ns is about 134 ms. Finer views read the events */
+#ifndef LOGBIN_SUMMARY_SHIFT
+#define LOGBIN_SUMMARY_SHIFT               UINT8_C(27)
+#endif
+
+/* The buckets of the top level of 16 span about 73 minutes */
+#ifndef LOGBIN_SUMMARY_LEVELS
+#define LOGBIN_SUMMARY_LEVELS              UINT8_C(16)
+#endif
+
+/* As many sensors as can be enabled at once, about 2.4 kB each */
+#ifndef LOGBIN_SUMMARY_SENSORS
+#define LOGBIN_SUMMARY_SENSORS             BHI360_MAX_SIMUL_SENSORS
+#endif
+
+#ifndef LOGBIN_SUMMARY_AXES
+#define LOGBIN_SUMMARY_AXES                UINT8_C(8)
+#endif
+
+#ifndef LOGBIN_SUMMARY_BLOCK_SIZE
+#define LOGBIN_SUMMARY_BLOCK_SIZE          UINT16_C(1024)
+#endif
+
+#define LOGBIN_SUMMARY_BUCKET_SIZE(axes)   (LOGBIN_SUMMARY_BUCKET_HEADER_SIZE + (12 * (axes)))
+
+struct bhi360_logbin_bucket
+{
+    uint8_t sensor_id;
+    uint8_t n_axes;
+    uint8_t level;
+    uint32_t count;
+    uint64_t start_time_ns;
+    float min[LOGBIN_SUMMARY_AXES];
+    float max[LOGBIN_SUMMARY_AXES];
+    float mean[LOGBIN_SUMMARY_AXES];
+};
+
+struct bhi360_logbin_summary_acc
+{
+    uint64_t bucket; /* Start time >> (LOGBIN_SUMMARY_SHIFT + level) */
+    uint32_t count;
+    float min[LOGBIN_SUMMARY_AXES];
+    float max[LOGBIN_SUMMARY_AXES];
+    double sum[LOGBIN_SUMMARY_AXES];
+};
+
+struct bhi360_logbin_summary_sensor
+{
+    uint8_t sensor_id;
+    uint8_t n_axes;
+    char parse_format[48];
+    float scaling;
+    struct bhi360_logbin_summary_acc level[LOGBIN_SUMMARY_LEVELS];
+};
+
+struct bhi360_logbin_summary_block
+{
+    uint16_t count;
+    uint16_t len;
+    uint64_t start_time_ns;
+    uint64_t end_time_ns;
+    uint8_t data[LOGBIN_SUMMARY_BLOCK_SIZE];
+};
+
+struct bhi360_logbin_summary_entry
+{
+    uint8_t level;
+    uint16_t count;
+    uint64_t start_time_ns;
+    uint64_t end_time_ns;
+    uint32_t size;
+    uint64_t offset;
+};
+
+struct bhi360_logbin_summary
+{
+    FILE *file;
+    uint64_t offset; /* File offset of the next block */
+    uint8_t n_sensors;
+    uint8_t slot[BHI360_N_VIRTUAL_SENSOR_MAX]; /* Index of each sensor ID in sensor plus 1, 0 if none */
+    struct bhi360_logbin_summary_sensor sensor[LOGBIN_SUMMARY_SENSORS];
+    struct bhi360_logbin_summary_block block[LOGBIN_SUMMARY_LEVELS];
+    struct bhi360_logbin_summary_entry *index;
+    uint32_t index_len;
+    uint32_t index_size;
+};
+
+/**
+* @brief Function to start a summary file
+* @param[in] file     : Summary file, opened for writing in binary mode
+* @param[out] summary : Summary instance
+*/
+void bhi360_logbin_summary_init(FILE *file, struct bhi360_logbin_summary *summary);
+
+/**
+* @brief Function to add a sensor to the summary. Called by bhi360_logbin_add_meta for the
+*        summary set with bhi360_logbin_set_summary
+* @param[in] sensor_id    : Sensor ID
+* @param[in] parse_format : Sensor parse format, as for bhi360_logbin_parse_values
+* @param[in] scaling      : Sensor scaling factor
+* @param[in] summary      : Summary instance
+* @return API error codes. BHI360_E_INSUFFICIENT_MAX_SIMUL_SENSORS if the summary has no room
+*         for the sensor
+*/
+int8_t bhi360_logbin_summary_add_sensor(uint8_t sensor_id,
+                                        const char *parse_format,
+                                        float scaling,
+                                        struct bhi360_logbin_summary *summary);
+
+/**
+* @brief Function to add an event to the summary. Called by bhi360_logbin_add_data for the
+*        summary set with bhi360_logbin_set_summary. Events of sensors not added are ignored
+* @param[in] sensor_id     : Sensor ID
+* @param[in] time_ns       : Timestamp (ns)
+* @param[in] event_size    : Event size
+* @param[in] event_payload : Event payload
+* @param[in] summary       : Summary instance
+*/
+void bhi360_logbin_summary_add(uint8_t sensor_id,
+                               uint64_t time_ns,
+                               uint8_t event_size,
+                               const uint8_t *event_payload,
+                               struct bhi360_logbin_summary *summary);
+
+/**
+* @brief Function to write the open buckets, the remaining blocks and the index. Call it
+*        before closing the summary file
+* @param[in] summary : Summary instance
+*/
+void bhi360_logbin_summary_end(struct bhi360_logbin_summary *summary);
+
+/**
+* @brief Function to get the lowest level with at most max_buckets buckets over a duration
+* @param[in] duration_ns : Duration to show
+* @param[in] max_buckets : Number of buckets, such as the width of the view in pixels
+* @return Level
+*/
+uint8_t bhi360_logbin_summary_level(uint64_t duration_ns, uint32_t max_buckets);
+
+/* End of CPP Guard */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus */
+
+#endif /* _BHI360_LOGBIN_SUMMARY_H_ */
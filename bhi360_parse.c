@@ -46,11 +46,45 @@
 #define SCALE_IAQ_TEMP               256.0
 #define SCALE_IAQ_HUMI               500.0
 
-#define MAXIMUM_VIRTUAL_SENSOR_LIST  UINT16_C(256)
+#if (!defined(PC) && defined(MCU_APP30)) || defined(MCU_APP31)
 
-static uint16_t count[MAXIMUM_VIRTUAL_SENSOR_LIST] = { 0 };
-static bool enable_ds[MAXIMUM_VIRTUAL_SENSOR_LIST] = { false };
-static int16_t odr_ds[MAXIMUM_VIRTUAL_SENSOR_LIST] = { 0 };
+/* The logging LED is on while a FIFO pass logs events, and off once they are flushed, from
+ * bhi360_parse_flush or from any bhi360_logbin_flush */
+static bool log_led_on = false;
+
+/**
+* @brief Function to switch the logging LED
+* @param[in] on : true to switch the LED on
+*/
+static void set_log_led(bool on)
+{
+#if !defined(PC) && defined(MCU_APP30)
+    coines_set_pin_config(COINES_APP30_LED_G,
+                          COINES_PIN_DIRECTION_OUT,
+                          on ? COINES_PIN_VALUE_LOW : COINES_PIN_VALUE_HIGH);
+#endif
+
+#if defined(MCU_APP31)
+    coines_set_pin_config(COINES_APP31_LED_G,
+                          COINES_PIN_DIRECTION_OUT,
+                          on ? COINES_PIN_VALUE_HIGH : COINES_PIN_VALUE_LOW);
+#endif
+    log_led_on = on;
+}
+
+/**
+* @brief Function to switch the logging LED off once the log is flushed
+* @param[in] flush_ref : Reference, unused
+*/
+static void log_led_off(void *flush_ref)
+{
+    (void)flush_ref;
+    if (log_led_on)
+    {
+        set_log_led(false);
+    }
+}
+#endif
 
 /**
 * @brief Function to convert time in tick to seconds and nanoseconds
@@ -66,6 +100,23 @@ static void time_to_s_ns(uint64_t time_ticks, uint32_t *s, uint32_t *ns, uint64_
     *ns = (uint32_t)(*tns - ((*s) * UINT64_C(1000000000)));
 }
 
+/**
+* @brief Function to start a data line with the sensor ID and time, as "[D]SID: %u; T: %lu.%09lu;"
+* @param[in] sid : Sensor ID
+* @param[in] s   : Second part of time
+* @param[in] ns  : Nanosecond part of time
+*/
+static void print_data_time(uint8_t sid, uint32_t s, uint32_t ns)
+{
+    verbose_data_str("[D]SID: ");
+    verbose_data_uint(sid, 0);
+    verbose_data_str("; T: ");
+    verbose_data_uint(s, 0);
+    verbose_data_str(".");
+    verbose_data_uint(ns, 9);
+    verbose_data_str(";");
+}
+
 /**
 * @brief Function to parse sensor status meta event
 * @param[in] event_text    : Event text
@@ -191,23 +242,17 @@ static void log_data(uint8_t sid,
 {
     if (logdev && logdev->logfile)
     {
-#if !defined(PC) && defined(MCU_APP30)
-        coines_set_pin_config(COINES_APP30_LED_G, COINES_PIN_DIRECTION_OUT, COINES_PIN_VALUE_LOW);
-#endif
+#if (!defined(PC) && defined(MCU_APP30)) || defined(MCU_APP31)
 
-#if defined(MCU_APP31)
-        coines_set_pin_config(COINES_APP31_LED_G, COINES_PIN_DIRECTION_OUT, COINES_PIN_VALUE_HIGH);
+        /* One pin access per FIFO pass rather than two per event */
+        if (!log_led_on)
+        {
+            set_log_led(true);
+            bhi360_logbin_set_flush_callback(log_led_off, NULL, logdev);
+        }
 #endif
 
         bhi360_logbin_add_data(sid, tns, event_size, event_payload, logdev);
-
-#if !defined(PC) && defined(MCU_APP30)
-        coines_set_pin_config(COINES_APP30_LED_G, COINES_PIN_DIRECTION_OUT, COINES_PIN_VALUE_HIGH);
-#endif
-
-#if defined(MCU_APP31)
-        coines_set_pin_config(COINES_APP31_LED_G, COINES_PIN_DIRECTION_OUT, COINES_PIN_VALUE_LOW);
-#endif
     }
 }
 
@@ -233,6 +278,127 @@ static void stream_hex_data(uint8_t sid, uint32_t ts, uint32_t tns, uint8_t even
     PRINT_D("\r\n");
 }
 
+/**
+* @brief Function to write binary stream frames to the data buffer
+* @param[in] data      : Frame data
+* @param[in] length    : Length of the frame
+* @param[in] write_ref : Reference, unused
+*/
+static void write_binstream(const uint8_t *data, uint16_t length, void *write_ref)
+{
+    (void)write_ref;
+    verbose_data_write(data, length);
+}
+
+/**
+* @brief Function to write errors as text frames of the binary stream
+* @param[in] text      : Error message
+* @param[in] length    : Length of the message
+* @param[in] error_ref : Reference to the parse table
+*/
+static void write_binstream_error(const char *text, uint16_t length, void *error_ref)
+{
+    struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)error_ref;
+
+    bhi360_binstream_add_text(text, length, &parse_table->binstream);
+}
+
+/**
+* @brief Function to set up the binary stream encoder while a sensor streams with PARSE_FLAG_BINSTREAM,
+*        and to release it once none does. Text output is turned off while the encoder is in use as
+*        it would break the framing, and errors are sent as text frames instead
+* @param[in] parse_table : Pointer to parse table
+*/
+static void update_binstream(struct bhi360_parse_ref *parse_table)
+{
+    uint8_t i;
+
+    for (i = 0; i < BHI360_MAX_SIMUL_SENSORS; i++)
+    {
+        if ((parse_table->sensor[i].id != 0) && (parse_table->sensor[i].parse_flag & PARSE_FLAG_BINSTREAM))
+        {
+            parse_table->binstream_slot = i;
+            if (parse_table->binstream.write == NULL)
+            {
+                bhi360_binstream_init(write_binstream, NULL, &parse_table->binstream);
+                verbose_set_binary(1);
+                verbose_set_error_output(write_binstream_error, parse_table);
+            }
+
+            return;
+        }
+    }
+
+    if (parse_table->binstream.write != NULL)
+    {
+        memset(&parse_table->binstream, 0, sizeof(parse_table->binstream));
+        verbose_set_binary(0);
+    }
+}
+
+/**
+* @brief Function to check that the sensor holding the binary stream encoder still streams with
+*        PARSE_FLAG_BINSTREAM, and to update the encoder when it does not
+* @param[in] parse_table : Pointer to parse table
+*/
+static void check_binstream(struct bhi360_parse_ref *parse_table)
+{
+    const struct bhi360_parse_sensor_details *holder = &parse_table->sensor[parse_table->binstream_slot];
+
+    if ((parse_table->binstream.write != NULL) &&
+        ((holder->id == 0) || !(holder->parse_flag & PARSE_FLAG_BINSTREAM)))
+    {
+        update_binstream(parse_table);
+    }
+}
+
+/**
+* @brief Function to get the binary stream encoder
+* @param[in] parse_table : Pointer to parse table
+* @return Encoder, or NULL when no sensor streams binary frames
+*/
+static struct bhi360_binstream_enc *get_binstream(struct bhi360_parse_ref *parse_table)
+{
+    if (parse_table->binstream.write == NULL)
+    {
+        update_binstream(parse_table);
+    }
+    else
+    {
+        check_binstream(parse_table);
+    }
+
+    return (parse_table->binstream.write != NULL) ? &parse_table->binstream : NULL;
+}
+
+/**
+* @brief Function to stream raw data, as binary frames or as hex text
+* @param[in] callback_info : Pointer to callback information
+* @param[in] s             : Second part of time
+* @param[in] ns            : Nanosecond part of time
+* @param[in] parse_flag    : Parse flag
+* @param[in] parse_table   : Pointer to parse table
+*/
+static void stream_raw_data(const struct bhi360_fifo_parse_data_info *callback_info,
+                            uint32_t s,
+                            uint32_t ns,
+                            uint8_t parse_flag,
+                            struct bhi360_parse_ref *parse_table)
+{
+    if (parse_flag & PARSE_FLAG_BINSTREAM)
+    {
+        bhi360_binstream_add_event(callback_info->sensor_id,
+                                   *callback_info->time_stamp,
+                                   callback_info->data_size - 1,
+                                   callback_info->data_ptr,
+                                   get_binstream(parse_table));
+    }
+    else
+    {
+        stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+    }
+}
+
 /**
 * @brief Function to print activity in string
 * @param[in] activity : Activity value
@@ -241,67 +407,70 @@ static void print_activity(uint16_t activity)
 {
     if (activity & BHI360_STILL_ACTIVITY_ENDED)
     {
-        PRINT_D(" Still activity ended,");
+        verbose_data_str(" Still activity ended,");
     }
 
     if (activity & BHI360_WALKING_ACTIVITY_ENDED)
     {
-        PRINT_D(" Walking activity ended,");
+        verbose_data_str(" Walking activity ended,");
     }
 
     if (activity & BHI360_RUNNING_ACTIVITY_ENDED)
     {
-        PRINT_D(" Running activity ended,");
+        verbose_data_str(" Running activity ended,");
     }
 
     if (activity & BHI360_ON_BICYCLE_ACTIVITY_ENDED)
     {
-        PRINT_D(" On bicycle activity ended,");
+        verbose_data_str(" On bicycle activity ended,");
     }
 
     if (activity & BHI360_IN_VEHICLE_ACTIVITY_ENDED)
     {
-        PRINT_D(" In vehicle ended,");
+        verbose_data_str(" In vehicle ended,");
     }
 
     if (activity & BHI360_TILTING_ACTIVITY_ENDED)
     {
-        PRINT_D(" Tilting activity ended,");
+        verbose_data_str(" Tilting activity ended,");
     }
 
     if (activity & BHI360_STILL_ACTIVITY_STARTED)
     {
-        PRINT_D(" Still activity started,");
+        verbose_data_str(" Still activity started,");
     }
 
     if (activity & BHI360_WALKING_ACTIVITY_STARTED)
     {
-        PRINT_D(" Walking activity started,");
+        verbose_data_str(" Walking activity started,");
     }
 
     if (activity & BHI360_RUNNING_ACTIVITY_STARTED)
     {
-        PRINT_D(" Running activity started,");
+        verbose_data_str(" Running activity started,");
     }
 
     if (activity & BHI360_ON_BICYCLE_ACTIVITY_STARTED)
     {
-        PRINT_D(" On bicycle activity started,");
+        verbose_data_str(" On bicycle activity started,");
     }
 
     if (activity & BHI360_IN_VEHICLE_ACTIVITY_STARTED)
     {
-        PRINT_D(" In vehicle activity started,");
+        verbose_data_str(" In vehicle activity started,");
     }
 
     if (activity & BHI360_TILTING_ACTIVITY_STARTED)
     {
-        PRINT_D(" Tilting activity started,");
+        verbose_data_str(" Tilting activity started,");
     }
 }
 
 /**
-* @brief Function to get sensor details
+* @brief Function to get sensor details, looked up by ID in the slots added with
+*        bhi360_parse_add_sensor_details. Sensors filled in directly in the table are found by
+*        a search and their slot is set for the next lookup. Text output is turned back on here
+*        once no sensor streams binary frames any more
 * @param[in] id  : Sensor ID
 * @param[in] ref : Parse reference
 * @return Sensor details on success, or NULL on failure
@@ -309,11 +478,21 @@ static void print_activity(uint16_t activity)
 struct bhi360_parse_sensor_details *bhi360_parse_get_sensor_details(uint8_t id, struct bhi360_parse_ref *ref)
 {
     uint8_t i;
+    uint8_t slot = ref->slot[id];
+
+    check_binstream(ref);
+
+    if ((slot != 0) && (slot <= BHI360_MAX_SIMUL_SENSORS) && (ref->sensor[slot - 1].id == id))
+    {
+        return &ref->sensor[slot - 1];
+    }
 
     for (i = 0; i < BHI360_MAX_SIMUL_SENSORS; i++)
     {
         if (ref->sensor[i].id == id)
         {
+            ref->slot[id] = i + 1;
+
             return &ref->sensor[i];
         }
     }
@@ -349,6 +528,7 @@ struct bhi360_parse_sensor_details *bhi360_parse_add_sensor_details(uint8_t id,
             {
                 INFO("Using slot %u for SID %u\r\n", i, id);
                 ref->sensor[i].id = id;
+                ref->slot[id] = i + 1;
 
                 return &ref->sensor[i];
             }
@@ -359,19 +539,36 @@ struct bhi360_parse_sensor_details *bhi360_parse_add_sensor_details(uint8_t id,
 }
 
 /**
-* @brief Function to check stream log flags
-* @param[in] callback_info  : Pointer to callback information
-* @param[in] parse_flag     : Stream log flags
+* @brief Function to decide if a sample is streamed when down sampling. Samples are streamed
+*        once per output period of the event time, so the output rate follows the timestamps
+*        and not the sample count
+* @param[in] sensor_details : Pointer to sensor details
+* @param[in] tns            : Total time in nanoseconds
+* @return true to stream the sample
 */
-static void check_stream_log_flags(const struct bhi360_fifo_parse_data_info *callback_info, uint8_t parse_flag)
+static bool downsample(struct bhi360_parse_sensor_details *sensor_details, uint64_t tns)
 {
-    if ((parse_flag & PARSE_FLAG_STREAM) && (count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
+    bool stream = true;
+    uint64_t period_ns = sensor_details->ds_period_ns;
+
+    if (sensor_details->downsampling && (period_ns != 0))
     {
-        if (count[callback_info->sensor_id] == odr_ds[callback_info->sensor_id])
+        /* Start over on the first sample, after a gap and when the time goes back */
+        if ((tns >= (sensor_details->ds_next_ns + period_ns)) || ((tns + period_ns) < sensor_details->ds_next_ns))
+        {
+            sensor_details->ds_next_ns = tns + period_ns;
+        }
+        else if (tns >= sensor_details->ds_next_ns)
         {
-            count[callback_info->sensor_id] = 0;
+            sensor_details->ds_next_ns += period_ns;
+        }
+        else
+        {
+            stream = false;
         }
     }
+
+    return stream;
 }
 
 /**
@@ -390,19 +587,21 @@ static void print_log_3axis_s16(const struct bhi360_fifo_parse_data_info *callba
                                 uint32_t ns,
                                 const struct bhi360_parse_sensor_details *sensor_details)
 {
-    DATA("SID: %u; T: %lu.%09lu; x: %f, y: %f, z: %f; acc: %u\r\n",
-         callback_info->sensor_id,
-         s,
-         ns,
-         data.x * scaling_factor,
-         data.y * scaling_factor,
-         data.z * scaling_factor,
-         sensor_details->accuracy);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" x: ");
+    verbose_data_float(data.x * scaling_factor, 6);
+    verbose_data_str(", y: ");
+    verbose_data_float(data.y * scaling_factor, 6);
+    verbose_data_str(", z: ");
+    verbose_data_float(data.z * scaling_factor, 6);
+    verbose_data_str("; acc: ");
+    verbose_data_uint(sensor_details->accuracy, 0);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for 3-axis format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data to stream and log
 * @param[in] s              : Second part of time
@@ -413,7 +612,7 @@ static void print_log_3axis_s16(const struct bhi360_fifo_parse_data_info *callba
 * @param[in] sensor_details : Pointer to sensor details
 * @param[in] scaling_factor : Scaling factor
 */
-static void stream_and_log_3axis_s16(bool flag,
+static void stream_and_log_3axis_s16(bool stream,
                                      const struct bhi360_fifo_parse_data_info *callback_info,
                                      struct bhi360_event_data_xyz data,
                                      uint32_t s,
@@ -424,27 +623,14 @@ static void stream_and_log_3axis_s16(bool flag,
                                      const struct bhi360_parse_sensor_details *sensor_details,
                                      float scaling_factor)
 {
-    if (parse_flag & PARSE_FLAG_STREAM)
+    if ((parse_flag & PARSE_FLAG_STREAM) && stream)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_3axis_s16(callback_info, data, scaling_factor, s, ns, sensor_details);
-            }
-        }
-        else
-        {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_3axis_s16(callback_info, data, scaling_factor, s, ns, sensor_details);
-            }
-        }
+        print_log_3axis_s16(callback_info, data, scaling_factor, s, ns, sensor_details);
     }
 
-    if (parse_flag & PARSE_FLAG_HEXSTREAM)
+    if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
     {
-        stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+        stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
     }
 
     if (parse_flag & PARSE_FLAG_LOG)
@@ -473,19 +659,21 @@ static void print_log_euler(const struct bhi360_fifo_parse_data_info *callback_i
                             uint32_t ns,
                             const struct bhi360_parse_sensor_details *sensor_details)
 {
-    DATA("SID: %u; T: %lu.%09lu; h: %f, p: %f, r: %f; acc: %u\r\n",
-         callback_info->sensor_id,
-         s,
-         ns,
-         data.heading * scaling_factor,
-         data.pitch * scaling_factor,
-         data.roll * scaling_factor,
-         sensor_details->accuracy);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" h: ");
+    verbose_data_float(data.heading * scaling_factor, 6);
+    verbose_data_str(", p: ");
+    verbose_data_float(data.pitch * scaling_factor, 6);
+    verbose_data_str(", r: ");
+    verbose_data_float(data.roll * scaling_factor, 6);
+    verbose_data_str("; acc: ");
+    verbose_data_uint(sensor_details->accuracy, 0);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for euler format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data to stream and log
 * @param[in] s              : Second part of time
@@ -496,7 +684,7 @@ static void print_log_euler(const struct bhi360_fifo_parse_data_info *callback_i
 * @param[in] sensor_details : Pointer to sensor details
 * @param[in] scaling_factor : Scaling factor
 */
-static void stream_and_log_euler(bool flag,
+static void stream_and_log_euler(bool stream,
                                  const struct bhi360_fifo_parse_data_info *callback_info,
                                  struct bhi360_event_data_orientation data,
                                  uint32_t s,
@@ -509,26 +697,16 @@ static void stream_and_log_euler(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_euler(callback_info, data, scaling_factor, s, ns, sensor_details);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_euler(callback_info, data, scaling_factor, s, ns, sensor_details);
-            }
+            print_log_euler(callback_info, data, scaling_factor, s, ns, sensor_details);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -554,20 +732,23 @@ static void print_log_quaternion(const struct bhi360_fifo_parse_data_info *callb
                                  uint32_t s,
                                  uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; x: %f, y: %f, z: %f, w: %f; acc: %f\r\n",
-         callback_info->sensor_id,
-         s,
-         ns,
-         data.x / 16384.0f,
-         data.y / 16384.0f,
-         data.z / 16384.0f,
-         data.w / 16384.0f,
-         ((data.accuracy * 180.0f) / 16384.0f) / 3.141592653589793f);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" x: ");
+    verbose_data_float(data.x / 16384.0f, 6);
+    verbose_data_str(", y: ");
+    verbose_data_float(data.y / 16384.0f, 6);
+    verbose_data_str(", z: ");
+    verbose_data_float(data.z / 16384.0f, 6);
+    verbose_data_str(", w: ");
+    verbose_data_float(data.w / 16384.0f, 6);
+    verbose_data_str("; acc: ");
+    verbose_data_float(((data.accuracy * 180.0f) / 16384.0f) / 3.141592653589793f, 6);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for quaternion format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data to stream and log
 * @param[in] s              : Second part of time
@@ -576,7 +757,7 @@ static void print_log_quaternion(const struct bhi360_fifo_parse_data_info *callb
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_quaternion(bool flag,
+static void stream_and_log_quaternion(bool stream,
                                       const struct bhi360_fifo_parse_data_info *callback_info,
                                       struct bhi360_event_data_quaternion data,
                                       uint32_t s,
@@ -587,26 +768,16 @@ static void stream_and_log_quaternion(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_quaternion(callback_info, data, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_quaternion(callback_info, data, s, ns);
-            }
+            print_log_quaternion(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -634,12 +805,15 @@ static void print_log_s16_as_float(const struct bhi360_fifo_parse_data_info *cal
                                    uint32_t s,
                                    uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; %f\r\n", callback_info->sensor_id, s, ns, data * scaling_factor);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" ");
+    verbose_data_float(data * scaling_factor, 6);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for 16-bit signed format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data to stream and log
 * @param[in] s              : Second part of time
@@ -649,7 +823,7 @@ static void print_log_s16_as_float(const struct bhi360_fifo_parse_data_info *cal
 * @param[in] parse_flag     : Parse flag
 * @param[in] scaling_factor : Scaling factor
 */
-static void stream_and_log_s16_as_float(bool flag,
+static void stream_and_log_s16_as_float(bool stream,
                                         const struct bhi360_fifo_parse_data_info *callback_info,
                                         int16_t data,
                                         uint32_t s,
@@ -661,26 +835,16 @@ static void stream_and_log_s16_as_float(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_s16_as_float(callback_info, data, scaling_factor, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_s16_as_float(callback_info, data, scaling_factor, s, ns);
-            }
+            print_log_s16_as_float(callback_info, data, scaling_factor, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -706,12 +870,15 @@ static void print_log_scalar_u32(const struct bhi360_fifo_parse_data_info *callb
                                  uint32_t s,
                                  uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; %lu\r\n", callback_info->sensor_id, s, ns, data);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" ");
+    verbose_data_uint(data, 0);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for 32-bit scalar format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data to stream and log
 * @param[in] s              : Second part of time
@@ -720,7 +887,7 @@ static void print_log_scalar_u32(const struct bhi360_fifo_parse_data_info *callb
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_scalar_u32(bool flag,
+static void stream_and_log_scalar_u32(bool stream,
                                       const struct bhi360_fifo_parse_data_info *callback_info,
                                       uint32_t data,
                                       uint32_t s,
@@ -731,26 +898,16 @@ static void stream_and_log_scalar_u32(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
+        if (stream)
         {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_scalar_u32(callback_info, data, s, ns);
-            }
-        }
-        else
-        {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_scalar_u32(callback_info, data, s, ns);
-            }
+            print_log_scalar_u32(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -772,12 +929,13 @@ static void stream_and_log_scalar_u32(bool flag,
 */
 static void print_log_scalar_event(const struct bhi360_fifo_parse_data_info *callback_info, uint32_t s, uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu;\r\n", callback_info->sensor_id, s, ns);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for scalar event format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] s              : Second part of time
 * @param[in] ns             : Nanosecond part of time
@@ -785,7 +943,7 @@ static void print_log_scalar_event(const struct bhi360_fifo_parse_data_info *cal
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_scalar_event(bool flag,
+static void stream_and_log_scalar_event(bool stream,
                                         const struct bhi360_fifo_parse_data_info *callback_info,
                                         uint32_t s,
                                         uint32_t ns,
@@ -795,26 +953,16 @@ static void stream_and_log_scalar_event(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_scalar_event(callback_info, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_scalar_event(callback_info, s, ns);
-            }
+            print_log_scalar_event(callback_info, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -840,16 +988,17 @@ static void print_log_activity(const struct bhi360_fifo_parse_data_info *callbac
                                uint32_t s,
                                uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; ", callback_info->sensor_id, s, ns);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" ");
 
     print_activity(activity);
 
-    PRINT_D("\r\n");
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for activity format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] activity       : Activity value
 * @param[in] s              : Second part of time
@@ -858,7 +1007,7 @@ static void print_log_activity(const struct bhi360_fifo_parse_data_info *callbac
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_activity(bool flag,
+static void stream_and_log_activity(bool stream,
                                     const struct bhi360_fifo_parse_data_info *callback_info,
                                     uint16_t activity,
                                     uint32_t s,
@@ -869,26 +1018,16 @@ static void stream_and_log_activity(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_activity(callback_info, activity, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_activity(callback_info, activity, s, ns);
-            }
+            print_log_activity(callback_info, activity, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -916,12 +1055,15 @@ static void print_log_u24_as_float(const struct bhi360_fifo_parse_data_info *cal
                                    uint32_t s,
                                    uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; %f\r\n", callback_info->sensor_id, s, ns, (float)data * scaling_factor);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" ");
+    verbose_data_float((float)data * scaling_factor, 6);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for 24-bit unsigned format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data to stream and log
 * @param[in] s              : Second part of time
@@ -931,7 +1073,7 @@ static void print_log_u24_as_float(const struct bhi360_fifo_parse_data_info *cal
 * @param[in] parse_flag     : Parse flag
 * @param[in] scaling_factor : Scaling factor
 */
-static void stream_and_log_u24_as_float(bool flag,
+static void stream_and_log_u24_as_float(bool stream,
                                         const struct bhi360_fifo_parse_data_info *callback_info,
                                         uint32_t data,
                                         uint32_t s,
@@ -943,26 +1085,16 @@ static void stream_and_log_u24_as_float(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_u24_as_float(callback_info, data, scaling_factor, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_u24_as_float(callback_info, data, scaling_factor, s, ns);
-            }
+            print_log_u24_as_float(callback_info, data, scaling_factor, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -988,12 +1120,15 @@ static void print_log_scalar_u8(const struct bhi360_fifo_parse_data_info *callba
                                 uint32_t s,
                                 uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; %u\r\n", callback_info->sensor_id, s, ns, data);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" ");
+    verbose_data_uint(data, 0);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for 8-bit unsigned scalar format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data to stream and log
 * @param[in] s              : Second part of time
@@ -1002,7 +1137,7 @@ static void print_log_scalar_u8(const struct bhi360_fifo_parse_data_info *callba
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_scalar_u8(bool flag,
+static void stream_and_scalar_u8(bool stream,
                                  const struct bhi360_fifo_parse_data_info *callback_info,
                                  uint8_t data,
                                  uint32_t s,
@@ -1013,26 +1148,16 @@ static void stream_and_scalar_u8(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_scalar_u8(callback_info, data, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_scalar_u8(callback_info, data, s, ns);
-            }
+            print_log_scalar_u8(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -1054,19 +1179,20 @@ static void stream_and_scalar_u8(bool flag,
 */
 static void print_log_generic(const struct bhi360_fifo_parse_data_info *callback_info, uint32_t s, uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; D: ", callback_info->sensor_id, s, ns);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" D: ");
 
     for (uint8_t i = 0; i < (callback_info->data_size - 1); i++)
     {
-        PRINT_D("%02X", callback_info->data_ptr[i]);
+        verbose_data_hex(callback_info->data_ptr[i]);
     }
 
-    PRINT_D("\r\n");
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for generic format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] s              : Second part of time
 * @param[in] ns             : Nanosecond part of time
@@ -1074,7 +1200,7 @@ static void print_log_generic(const struct bhi360_fifo_parse_data_info *callback
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_generic(bool flag,
+static void stream_and_log_generic(bool stream,
                                    const struct bhi360_fifo_parse_data_info *callback_info,
                                    uint32_t s,
                                    uint32_t ns,
@@ -1084,26 +1210,16 @@ static void stream_and_log_generic(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_generic(callback_info, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_generic(callback_info, s, ns);
-            }
+            print_log_generic(callback_info, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -1129,12 +1245,15 @@ static void print_log_device_ori(const struct bhi360_fifo_parse_data_info *callb
                                  uint32_t s,
                                  uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; %s\r\n", callback_info->sensor_id, s, ns, ori);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" ");
+    verbose_data_str(ori);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for device orientation format
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] ori            : Pointer to device orientation
 * @param[in] s              : Second part of time
@@ -1143,7 +1262,7 @@ static void print_log_device_ori(const struct bhi360_fifo_parse_data_info *callb
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_device_ori(bool flag,
+static void stream_and_log_device_ori(bool stream,
                                       const struct bhi360_fifo_parse_data_info *callback_info,
                                       char *ori,
                                       uint32_t s,
@@ -1154,26 +1273,16 @@ static void stream_and_log_device_ori(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
+        if (stream)
         {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_device_ori(callback_info, ori, s, ns);
-            }
-        }
-        else
-        {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_device_ori(callback_info, ori, s, ns);
-            }
+            print_log_device_ori(callback_info, ori, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -1219,6 +1328,16 @@ void bhi360_parse_meta_event(const struct bhi360_fifo_parse_data_info *callback_
         return;
     }
 
+    /* Meta events go into the binary stream as they are, their text lines are not output */
+    if (parse_table && get_binstream(parse_table))
+    {
+        bhi360_binstream_add_event(callback_info->sensor_id,
+                                   *callback_info->time_stamp,
+                                   callback_info->data_size - 1,
+                                   callback_info->data_ptr,
+                                   &parse_table->binstream);
+    }
+
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
     parse_meta_event_type(callback_info, event_text, s, ns, parse_table);
@@ -1238,7 +1357,7 @@ void bhi360_parse_3axis_s16(const struct bhi360_fifo_parse_data_info *callback_i
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     float scaling_factor;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1262,41 +1381,18 @@ void bhi360_parse_3axis_s16(const struct bhi360_fifo_parse_data_info *callback_i
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-
-        stream_and_log_3axis_s16(flag,
-                                 callback_info,
-                                 data,
-                                 s,
-                                 ns,
-                                 tns,
-                                 parse_table,
-                                 parse_flag,
-                                 sensor_details,
-                                 scaling_factor);
-
-        check_stream_log_flags(callback_info, parse_flag);
-
-    }
-    else
-    {
-        flag = false;
+    stream = downsample(sensor_details, tns);
 
-        stream_and_log_3axis_s16(flag,
-                                 callback_info,
-                                 data,
-                                 s,
-                                 ns,
-                                 tns,
-                                 parse_table,
-                                 parse_flag,
-                                 sensor_details,
-                                 scaling_factor);
-    }
-
-    count[callback_info->sensor_id]++;
+    stream_and_log_3axis_s16(stream,
+                             callback_info,
+                             data,
+                             s,
+                             ns,
+                             tns,
+                             parse_table,
+                             parse_flag,
+                             sensor_details,
+                             scaling_factor);
 }
 
 /**
@@ -1313,7 +1409,7 @@ void bhi360_parse_euler(const struct bhi360_fifo_parse_data_info *callback_info,
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     float scaling_factor;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1337,38 +1433,18 @@ void bhi360_parse_euler(const struct bhi360_fifo_parse_data_info *callback_info,
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_euler(flag,
-                             callback_info,
-                             data,
-                             s,
-                             ns,
-                             tns,
-                             parse_table,
-                             parse_flag,
-                             sensor_details,
-                             scaling_factor);
-
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_euler(flag,
-                             callback_info,
-                             data,
-                             s,
-                             ns,
-                             tns,
-                             parse_table,
-                             parse_flag,
-                             sensor_details,
-                             scaling_factor);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_euler(stream,
+                         callback_info,
+                         data,
+                         s,
+                         ns,
+                         tns,
+                         parse_table,
+                         parse_flag,
+                         sensor_details,
+                         scaling_factor);
 }
 
 /**
@@ -1384,7 +1460,7 @@ void bhi360_parse_quaternion(const struct bhi360_fifo_parse_data_info *callback_
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1407,19 +1483,9 @@ void bhi360_parse_quaternion(const struct bhi360_fifo_parse_data_info *callback_
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_quaternion(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_quaternion(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_quaternion(stream, callback_info, data, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -1436,7 +1502,7 @@ void bhi360_parse_s16_as_float(const struct bhi360_fifo_parse_data_info *callbac
     float scaling_factor;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1460,19 +1526,9 @@ void bhi360_parse_s16_as_float(const struct bhi360_fifo_parse_data_info *callbac
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_s16_as_float(flag, callback_info, data, s, ns, tns, parse_table, parse_flag, scaling_factor);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_s16_as_float(flag, callback_info, data, s, ns, tns, parse_table, parse_flag, scaling_factor);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_s16_as_float(stream, callback_info, data, s, ns, tns, parse_table, parse_flag, scaling_factor);
 }
 
 /**
@@ -1488,7 +1544,7 @@ void bhi360_parse_scalar_u32(const struct bhi360_fifo_parse_data_info *callback_
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1511,19 +1567,9 @@ void bhi360_parse_scalar_u32(const struct bhi360_fifo_parse_data_info *callback_
 
     parse_flag = sensor_details->parse_flag;
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_scalar_u32(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_scalar_u32(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_scalar_u32(stream, callback_info, data, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -1538,7 +1584,7 @@ void bhi360_parse_scalar_event(const struct bhi360_fifo_parse_data_info *callbac
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1559,19 +1605,9 @@ void bhi360_parse_scalar_event(const struct bhi360_fifo_parse_data_info *callbac
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_scalar_event(flag, callback_info, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_scalar_event(flag, callback_info, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_scalar_event(stream, callback_info, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -1587,7 +1623,7 @@ void bhi360_parse_activity(const struct bhi360_fifo_parse_data_info *callback_in
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1610,19 +1646,9 @@ void bhi360_parse_activity(const struct bhi360_fifo_parse_data_info *callback_in
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_activity(flag, callback_info, activity, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_activity(flag, callback_info, activity, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_activity(stream, callback_info, activity, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -1639,7 +1665,7 @@ void bhi360_parse_u24_as_float(const struct bhi360_fifo_parse_data_info *callbac
     float scaling_factor;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1663,19 +1689,9 @@ void bhi360_parse_u24_as_float(const struct bhi360_fifo_parse_data_info *callbac
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_u24_as_float(flag, callback_info, data, s, ns, tns, parse_table, parse_flag, scaling_factor);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_u24_as_float(flag, callback_info, data, s, ns, tns, parse_table, parse_flag, scaling_factor);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_u24_as_float(stream, callback_info, data, s, ns, tns, parse_table, parse_flag, scaling_factor);
 }
 
 /**
@@ -1691,7 +1707,7 @@ void bhi360_parse_scalar_u8(const struct bhi360_fifo_parse_data_info *callback_i
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1713,19 +1729,9 @@ void bhi360_parse_scalar_u8(const struct bhi360_fifo_parse_data_info *callback_i
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_scalar_u8(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_scalar_u8(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_scalar_u8(stream, callback_info, data, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -1740,7 +1746,7 @@ void bhi360_parse_generic(const struct bhi360_fifo_parse_data_info *callback_inf
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1761,19 +1767,9 @@ void bhi360_parse_generic(const struct bhi360_fifo_parse_data_info *callback_inf
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_generic(flag, callback_info, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_generic(flag, callback_info, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_generic(stream, callback_info, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -1789,7 +1785,7 @@ void bhi360_parse_device_ori(const struct bhi360_fifo_parse_data_info *callback_
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1829,19 +1825,9 @@ void bhi360_parse_device_ori(const struct bhi360_fifo_parse_data_info *callback_
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_device_ori(flag, callback_info, ori, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_device_ori(flag, callback_info, ori, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_device_ori(stream, callback_info, ori, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -1887,24 +1873,29 @@ static void print_log_air_quality(const struct bhi360_fifo_parse_data_info *call
                                   uint32_t s,
                                   uint32_t ns)
 {
-    DATA(
-        "SID: %u; T: %lu.%09lu; IAQ: %u, SIAQ: %u, VOC: %.2f ppm, CO2: %u ppm,  ACCU: %u, TEMP: %.3f C, HUMI: %.3f%%, GAS: %u Ohm\r\n",
-        callback_info->sensor_id,
-        s,
-        ns,
-        data.iaq,
-        data.siaq,
-        data.voc / SCALE_IAQ_VOC,
-        data.co2,
-        data.iaq_accuracy,
-        data.comp_temperature / SCALE_IAQ_TEMP,
-        data.comp_humidity / SCALE_IAQ_HUMI,
-        data.raw_gas);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" IAQ: ");
+    verbose_data_uint(data.iaq, 0);
+    verbose_data_str(", SIAQ: ");
+    verbose_data_uint(data.siaq, 0);
+    verbose_data_str(", VOC: ");
+    verbose_data_float(data.voc / SCALE_IAQ_VOC, 2);
+    verbose_data_str(" ppm, CO2: ");
+    verbose_data_uint(data.co2, 0);
+    verbose_data_str(" ppm,  ACCU: ");
+    verbose_data_uint(data.iaq_accuracy, 0);
+    verbose_data_str(", TEMP: ");
+    verbose_data_float(data.comp_temperature / SCALE_IAQ_TEMP, 3);
+    verbose_data_str(" C, HUMI: ");
+    verbose_data_float(data.comp_humidity / SCALE_IAQ_HUMI, 3);
+    verbose_data_str("%, GAS: ");
+    verbose_data_uint(data.raw_gas, 0);
+    verbose_data_str(" Ohm\r\n");
 }
 
 /**
 * @brief Function to stream and log for Air quality
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data for Air quality
 * @param[in] s              : Second part of time
@@ -1913,7 +1904,7 @@ static void print_log_air_quality(const struct bhi360_fifo_parse_data_info *call
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_air_quality(bool flag,
+static void stream_and_log_air_quality(bool stream,
                                        const struct bhi360_fifo_parse_data_info *callback_info,
                                        bhi360_event_data_iaq_output_t data,
                                        uint32_t s,
@@ -1924,26 +1915,16 @@ static void stream_and_log_air_quality(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
+        if (stream)
         {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_air_quality(callback_info, data, s, ns);
-            }
-        }
-        else
-        {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_air_quality(callback_info, data, s, ns);
-            }
+            print_log_air_quality(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -1970,7 +1951,7 @@ void bhi360_parse_air_quality(const struct bhi360_fifo_parse_data_info *callback
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     struct bhi360_parse_sensor_details *sensor_details;
     bhi360_event_data_iaq_output_t air_quality = { 0 };
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -1992,23 +1973,9 @@ void bhi360_parse_air_quality(const struct bhi360_fifo_parse_data_info *callback
 
     bhi360_event_data_parse_air_quality(callback_info->data_ptr, &air_quality);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-
-        stream_and_log_air_quality(flag, callback_info, air_quality, s, ns, tns, parse_table, parse_flag);
-
-        check_stream_log_flags(callback_info, parse_flag);
-
-    }
-    else
-    {
-        flag = false;
-
-        stream_and_log_air_quality(flag, callback_info, air_quality, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_air_quality(stream, callback_info, air_quality, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -2023,16 +1990,15 @@ static void print_log_multitap(const struct bhi360_fifo_parse_data_info *callbac
                                uint32_t s,
                                uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; %s; \r\n",
-         callback_info->sensor_id,
-         s,
-         ns,
-         bhi360_event_data_multi_tap_string_out[data]);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" ");
+    verbose_data_str(bhi360_event_data_multi_tap_string_out[data]);
+    verbose_data_str("; \r\n");
 }
 
 /**
 * @brief Function to stream and log for Multi-tap
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data for Multi-tap
 * @param[in] s              : Second part of time
@@ -2041,7 +2007,7 @@ static void print_log_multitap(const struct bhi360_fifo_parse_data_info *callbac
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_multitap(bool flag,
+static void stream_and_log_multitap(bool stream,
                                     const struct bhi360_fifo_parse_data_info *callback_info,
                                     bhi360_event_data_multi_tap data,
                                     uint32_t s,
@@ -2052,26 +2018,16 @@ static void stream_and_log_multitap(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
+        if (stream)
         {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_multitap(callback_info, data, s, ns);
-            }
-        }
-        else
-        {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_multitap(callback_info, data, s, ns);
-            }
+            print_log_multitap(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -2099,7 +2055,7 @@ void bhi360_parse_multitap(const struct bhi360_fifo_parse_data_info *callback_in
     struct bhi360_parse_sensor_details *sensor_details;
 
     bhi360_event_data_multi_tap multitap_data = BHI360_NO_TAP;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -2121,23 +2077,9 @@ void bhi360_parse_multitap(const struct bhi360_fifo_parse_data_info *callback_in
 
     (void)bhi360_event_data_multi_tap_parsing(callback_info->data_ptr, (uint8_t *)&multitap_data);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-
-        stream_and_log_multitap(flag, callback_info, multitap_data, s, ns, tns, parse_table, parse_flag);
-
-        check_stream_log_flags(callback_info, parse_flag);
-
-    }
-    else
-    {
-        flag = false;
-
-        stream_and_log_multitap(flag, callback_info, multitap_data, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_multitap(stream, callback_info, multitap_data, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -2152,16 +2094,15 @@ static void print_log_wrist_gesture_detect(const struct bhi360_fifo_parse_data_i
                                            uint32_t s,
                                            uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; wrist_gesture: %s; \r\n",
-         callback_info->sensor_id,
-         s,
-         ns,
-         bhi360_event_data_wrist_gesture_detect_output[data.wrist_gesture]);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" wrist_gesture: ");
+    verbose_data_str(bhi360_event_data_wrist_gesture_detect_output[data.wrist_gesture]);
+    verbose_data_str("; \r\n");
 }
 
 /**
 * @brief Function to stream and log for Wrist Gesture Detector
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data for Wrist Gesture Detector
 * @param[in] s              : Second part of time
@@ -2170,7 +2111,7 @@ static void print_log_wrist_gesture_detect(const struct bhi360_fifo_parse_data_i
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_wrist_gesture_detect(bool flag,
+static void stream_and_log_wrist_gesture_detect(bool stream,
                                                 const struct bhi360_fifo_parse_data_info *callback_info,
                                                 bhi360_event_data_wrist_gesture_detect_t data,
                                                 uint32_t s,
@@ -2181,26 +2122,16 @@ static void stream_and_log_wrist_gesture_detect(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_wrist_gesture_detect(callback_info, data, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_wrist_gesture_detect(callback_info, data, s, ns);
-            }
+            print_log_wrist_gesture_detect(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -2228,7 +2159,7 @@ void bhi360_parse_wrist_gesture_detect(const struct bhi360_fifo_parse_data_info
     struct bhi360_parse_sensor_details *sensor_details;
 
     bhi360_event_data_wrist_gesture_detect_t wrist_gesture_detect_data;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -2250,37 +2181,16 @@ void bhi360_parse_wrist_gesture_detect(const struct bhi360_fifo_parse_data_info
 
     (void)bhi360_event_data_wrist_gesture_detect_parsing(callback_info->data_ptr, &wrist_gesture_detect_data);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-
-        stream_and_log_wrist_gesture_detect(flag,
-                                            callback_info,
-                                            wrist_gesture_detect_data,
-                                            s,
-                                            ns,
-                                            tns,
-                                            parse_table,
-                                            parse_flag);
-
-        check_stream_log_flags(callback_info, parse_flag);
-
-    }
-    else
-    {
-        flag = false;
-
-        stream_and_log_wrist_gesture_detect(flag,
-                                            callback_info,
-                                            wrist_gesture_detect_data,
-                                            s,
-                                            ns,
-                                            tns,
-                                            parse_table,
-                                            parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_wrist_gesture_detect(stream,
+                                        callback_info,
+                                        wrist_gesture_detect_data,
+                                        s,
+                                        ns,
+                                        tns,
+                                        parse_table,
+                                        parse_flag);
 }
 
 /**
@@ -2295,19 +2205,21 @@ static void print_log_hmc(const struct bhi360_fifo_parse_data_info *callback_inf
                           uint32_t s,
                           uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; x: %f, y: %f, z: %f, w: %f\r\n",
-         callback_info->sensor_id,
-         s,
-         ns,
-         data.x / 16384.0f,
-         data.y / 16384.0f,
-         data.z / 16384.0f,
-         data.w / 16384.0f);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" x: ");
+    verbose_data_float(data.x / 16384.0f, 6);
+    verbose_data_str(", y: ");
+    verbose_data_float(data.y / 16384.0f, 6);
+    verbose_data_str(", z: ");
+    verbose_data_float(data.z / 16384.0f, 6);
+    verbose_data_str(", w: ");
+    verbose_data_float(data.w / 16384.0f, 6);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for hmc
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data head orientation hmc
 * @param[in] s              : Second part of time
@@ -2316,7 +2228,7 @@ static void print_log_hmc(const struct bhi360_fifo_parse_data_info *callback_inf
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_hmc(bool flag,
+static void stream_and_log_hmc(bool stream,
                                const struct bhi360_fifo_parse_data_info *callback_info,
                                bhi360_event_data_head_orientation_quat data,
                                uint32_t s,
@@ -2327,26 +2239,16 @@ static void stream_and_log_hmc(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_hmc(callback_info, data, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_hmc(callback_info, data, s, ns);
-            }
+            print_log_hmc(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -2373,7 +2275,7 @@ void bhi360_parse_hmc(const struct bhi360_fifo_parse_data_info *callback_info, v
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -2396,19 +2298,9 @@ void bhi360_parse_hmc(const struct bhi360_fifo_parse_data_info *callback_info, v
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_hmc(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_hmc(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_hmc(stream, callback_info, data, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -2423,19 +2315,21 @@ static void print_log_oc(const struct bhi360_fifo_parse_data_info *callback_info
                          uint32_t s,
                          uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; x: %f, y: %f, z: %f, w: %f\r\n",
-         callback_info->sensor_id,
-         s,
-         ns,
-         data.x / 16384.0f,
-         data.y / 16384.0f,
-         data.z / 16384.0f,
-         data.w / 16384.0f);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" x: ");
+    verbose_data_float(data.x / 16384.0f, 6);
+    verbose_data_str(", y: ");
+    verbose_data_float(data.y / 16384.0f, 6);
+    verbose_data_str(", z: ");
+    verbose_data_float(data.z / 16384.0f, 6);
+    verbose_data_str(", w: ");
+    verbose_data_float(data.w / 16384.0f, 6);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for oc
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data head orientation quaternion
 * @param[in] s              : Second part of time
@@ -2444,7 +2338,7 @@ static void print_log_oc(const struct bhi360_fifo_parse_data_info *callback_info
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_oc(bool flag,
+static void stream_and_log_oc(bool stream,
                               const struct bhi360_fifo_parse_data_info *callback_info,
                               bhi360_event_data_head_orientation_quat data,
                               uint32_t s,
@@ -2455,26 +2349,16 @@ static void stream_and_log_oc(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_oc(callback_info, data, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_oc(callback_info, data, s, ns);
-            }
+            print_log_oc(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -2501,7 +2385,7 @@ void bhi360_parse_oc(const struct bhi360_fifo_parse_data_info *callback_info, vo
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -2524,19 +2408,9 @@ void bhi360_parse_oc(const struct bhi360_fifo_parse_data_info *callback_info, vo
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_oc(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_oc(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_oc(stream, callback_info, data, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
@@ -2551,18 +2425,19 @@ static void print_log_ec(const struct bhi360_fifo_parse_data_info *callback_info
                          uint32_t s,
                          uint32_t ns)
 {
-    DATA("SID: %u; T: %lu.%09lu; h: %f, p: %f, r: %f\r\n",
-         callback_info->sensor_id,
-         s,
-         ns,
-         (data.heading * 360.0f) / 32768.0f,
-         (data.pitch * 360.0f) / 32768.0f,
-         (data.roll * 360.0f) / 32768.0f);
+    print_data_time(callback_info->sensor_id, s, ns);
+    verbose_data_str(" h: ");
+    verbose_data_float((data.heading * 360.0f) / 32768.0f, 6);
+    verbose_data_str(", p: ");
+    verbose_data_float((data.pitch * 360.0f) / 32768.0f, 6);
+    verbose_data_str(", r: ");
+    verbose_data_float((data.roll * 360.0f) / 32768.0f, 6);
+    verbose_data_str("\r\n");
 }
 
 /**
 * @brief Function to stream and log for ec
-* @param[in] flag           : Flag for enabling/disabling downsampling check
+* @param[in] stream         : Stream the sample, false if it is downsampled
 * @param[in] callback_info  : Pointer to callback information
 * @param[in] data           : Data head orientation euler
 * @param[in] s              : Second part of time
@@ -2571,7 +2446,7 @@ static void print_log_ec(const struct bhi360_fifo_parse_data_info *callback_info
 * @param[in] parse_table    : Pointer to parse table
 * @param[in] parse_flag     : Parse flag
 */
-static void stream_and_log_ec(bool flag,
+static void stream_and_log_ec(bool stream,
                               const struct bhi360_fifo_parse_data_info *callback_info,
                               bhi360_event_data_head_orientation_eul data,
                               uint32_t s,
@@ -2582,26 +2457,16 @@ static void stream_and_log_ec(bool flag,
 {
     if (parse_flag & PARSE_FLAG_STREAM)
     {
-        if (flag)
-        {
-            if ((count[callback_info->sensor_id] % odr_ds[callback_info->sensor_id] == 0))
-            {
-                print_log_ec(callback_info, data, s, ns);
-            }
-        }
-        else
+        if (stream)
         {
-            if (odr_ds[callback_info->sensor_id] != 0)
-            {
-                print_log_ec(callback_info, data, s, ns);
-            }
+            print_log_ec(callback_info, data, s, ns);
         }
     }
     else
     {
-        if (parse_flag & PARSE_FLAG_HEXSTREAM)
+        if (parse_flag & (PARSE_FLAG_HEXSTREAM | PARSE_FLAG_BINSTREAM))
         {
-            stream_hex_data(callback_info->sensor_id, s, ns, callback_info->data_size - 1, callback_info->data_ptr);
+            stream_raw_data(callback_info, s, ns, parse_flag, parse_table);
         }
     }
 
@@ -2628,7 +2493,7 @@ void bhi360_parse_ec(const struct bhi360_fifo_parse_data_info *callback_info, vo
     struct bhi360_parse_ref *parse_table = (struct bhi360_parse_ref *)callback_ref;
     uint8_t parse_flag;
     struct bhi360_parse_sensor_details *sensor_details;
-    bool flag;
+    bool stream;
 
     if (!parse_table || !callback_info)
     {
@@ -2651,49 +2516,68 @@ void bhi360_parse_ec(const struct bhi360_fifo_parse_data_info *callback_info, vo
 
     time_to_s_ns(*callback_info->time_stamp, &s, &ns, &tns);
 
-    if (enable_ds[callback_info->sensor_id] == true)
-    {
-        flag = true;
-        stream_and_log_ec(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-        check_stream_log_flags(callback_info, parse_flag);
-    }
-    else
-    {
-        flag = false;
-        stream_and_log_ec(flag, callback_info, data, s, ns, tns, parse_table, parse_flag);
-    }
+    stream = downsample(sensor_details, tns);
 
-    count[callback_info->sensor_id]++;
+    stream_and_log_ec(stream, callback_info, data, s, ns, tns, parse_table, parse_flag);
 }
 
 /**
 * @brief Function to set down sampling flag
 * @param[in] sen_id : Virtual sensor ID
 * @param[in] enable : Down sampling value
+* @param[in] ref    : Parse reference
 */
-void bhi360_set_downsampling_flag(uint8_t sen_id, bool enable)
+void bhi360_parse_set_downsampling_flag(uint8_t sen_id, bool enable, struct bhi360_parse_ref *ref)
 {
-    enable_ds[sen_id] = enable;
+    struct bhi360_parse_sensor_details *sensor_details = bhi360_parse_add_sensor_details(sen_id, ref);
+
+    if (sensor_details)
+    {
+        sensor_details->downsampling = enable;
+        sensor_details->ds_next_ns = 0;
+    }
 }
 
 /**
 * @brief Function to get down sampling flag
 * @param[in] sen_id  : Virtual sensor ID
+* @param[in] ref     : Parse reference
 * @return Down sampling value
 */
-bool bhi360_get_downsampling_flag(uint8_t sen_id)
+bool bhi360_parse_get_downsampling_flag(uint8_t sen_id, struct bhi360_parse_ref *ref)
 {
-    return enable_ds[sen_id];
+    const struct bhi360_parse_sensor_details *sensor_details = bhi360_parse_get_sensor_details(sen_id, ref);
+
+    return (sensor_details != NULL) && sensor_details->downsampling;
 }
 
 /**
-* @brief Function to set down sampling ratio
+* @brief Function to set down sampling output data rate
 * @param[in] sen_id : Virtual sensor ID
-* @param[in] enable : Down sampling ratio
+* @param[in] odr    : Output data rate in Hz, 0 to stream every sample
+* @param[in] ref    : Parse reference
+*/
+void bhi360_parse_set_downsampling_odr(uint8_t sen_id, float odr, struct bhi360_parse_ref *ref)
+{
+    struct bhi360_parse_sensor_details *sensor_details = bhi360_parse_add_sensor_details(sen_id, ref);
+
+    if (sensor_details)
+    {
+        sensor_details->ds_period_ns = (odr > 0.0f) ? (uint64_t)(1000000000.0 / (double)odr) : 0;
+        sensor_details->ds_next_ns = 0;
+    }
+}
+
+/**
+* @brief Function to write out the buffered data lines, and to switch the logging LED off
 */
-void bhi360_set_downsampling_odr(uint8_t sen_id, int16_t odr)
+void bhi360_parse_flush(void)
 {
-    odr_ds[sen_id] = odr;
+    verbose_flush();
+
+#if (!defined(PC) && defined(MCU_APP30)) || defined(MCU_APP31)
+    log_led_off(NULL);
+#endif
 }
 
 /**
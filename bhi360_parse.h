@@ -47,12 +47,14 @@ extern "C" {
 
 #include "bhi360.h"
 
+#include "bhi360_binstream.h"
 #include "bhi360_logbin.h"
 
 #define PARSE_FLAG_NONE              UINT8_C(0x00)
 #define PARSE_FLAG_STREAM            UINT8_C(0x01)
 #define PARSE_FLAG_LOG               UINT8_C(0x02)
 #define PARSE_FLAG_HEXSTREAM         UINT8_C(0x04)
+#define PARSE_FLAG_BINSTREAM         UINT8_C(0x08)
 
 #define PARSE_SET_FLAG(var, flag)    (var | flag)
 #define PARSE_CLEAR_FLAG(var, flag)  (var & ~flag)
@@ -63,17 +65,25 @@ struct bhi360_parse_sensor_details
     uint8_t accuracy;
     float scaling_factor;
     uint8_t parse_flag;
+    bool downsampling;
+    uint64_t ds_period_ns; /* Output period when down sampling, 0 to stream every sample */
+    uint64_t ds_next_ns; /* Event time of the next sample to stream */
 };
 
 struct bhi360_parse_ref
 {
     struct bhi360_parse_sensor_details sensor[BHI360_MAX_SIMUL_SENSORS];
+    uint8_t slot[BHI360_N_VIRTUAL_SENSOR_MAX]; /* Slot of each sensor ID plus 1, 0 if none */
     struct bhi360_dev *bhy;
     struct bhi360_logbin_dev logdev;
+    struct bhi360_binstream_enc binstream; /* Encoder of PARSE_FLAG_BINSTREAM, set up on the first event */
+                                           /* Text output is turned off while it is in use */
+    uint8_t binstream_slot; /* Slot of a sensor with PARSE_FLAG_BINSTREAM while the encoder is in use */
 };
 
 /**
-* @brief Function to get sensor details
+* @brief Function to get sensor details, looked up by ID in the slots added with
+*        bhi360_parse_add_sensor_details
 * @param[in] id  : Sensor ID
 * @param[in] ref : Parse reference
 * @return Sensor details on success, or NULL on failure
@@ -225,22 +235,33 @@ void bhi360_parse_ec(const struct bhi360_fifo_parse_data_info *callback_info, vo
 * @brief Function to set down sampling flag
 * @param[in] sen_id : Virtual sensor ID
 * @param[in] enable : Down sampling value
+* @param[in] ref    : Parse reference
 */
-void bhi360_set_downsampling_flag(uint8_t sen_id, bool enable);
+void bhi360_parse_set_downsampling_flag(uint8_t sen_id, bool enable, struct bhi360_parse_ref *ref);
 
 /**
 * @brief Function to get down sampling flag
 * @param[in] sen_id  : Virtual sensor ID
+* @param[in] ref     : Parse reference
 * @return Down sampling value
 */
-bool bhi360_get_downsampling_flag(uint8_t sen_id);
+bool bhi360_parse_get_downsampling_flag(uint8_t sen_id, struct bhi360_parse_ref *ref);
 
 /**
-* @brief Function to set down sampling ratio
+* @brief Function to set down sampling output data rate. Samples are streamed by their timestamps
+*        at this rate while down sampling is enabled
 * @param[in] sen_id : Virtual sensor ID
-* @param[in] enable : Down sampling ratio
+* @param[in] odr    : Output data rate in Hz, 0 to stream every sample
+* @param[in] ref    : Parse reference
 */
-void bhi360_set_downsampling_odr(uint8_t sen_id, int16_t odr);
+void bhi360_parse_set_downsampling_odr(uint8_t sen_id, float odr, struct bhi360_parse_ref *ref);
+
+/**
+* @brief Function to write out the buffered data lines. The parse callbacks format their lines into
+*        a buffer that is written out when full, call this after bhi360_get_and_process_fifo.
+*        On APP3.0/3.1 it also switches off the LED that is on while events are logged
+*/
+void bhi360_parse_flush(void);
 
 /**
  * @brief Function to parse FIFO frame data into temperature
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file    binstream_decode.c
+ * @brief   Decoder of the binary event stream of the BHI360
+ *
+ */
+
+/*
+ * Decodes a capture of the binary stream (PARSE_FLAG_BINSTREAM, see bhi360_binstream.h)
+ * into the lines of the hex stream:
+ *
+ *   [H]<sensor ID><seconds><nanoseconds><payload>
+ *
+ * Text frames, such as error messages, are written out as they are.
+ *
+ * Data before the first sync frame and after a frame with a wrong CRC is skipped.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "bhi360_binstream.h"
+
+static void print_event(uint8_t sensor_id,
+                        uint64_t time_stamp,
+                        const uint8_t *payload,
+                        uint8_t payload_size,
+                        void *event_ref)
+{
+    FILE *output_file = (FILE *)event_ref;
+    uint64_t time_ns = time_stamp * UINT64_C(15625); /* Timestamp is now in nanoseconds */
+
+    if (sensor_id == BINSTREAM_TEXT_ID)
+    {
+        fprintf(output_file, "%.*s", payload_size, (const char *)payload);
+
+        return;
+    }
+
+    fprintf(output_file,
+            "[H]%02x%08lx%08lx",
+            sensor_id,
+            (unsigned long)(time_ns / UINT64_C(1000000000)),
+            (unsigned long)(time_ns % UINT64_C(1000000000)));
+    for (uint16_t i = 0; i < payload_size; i++)
+    {
+        fprintf(output_file, "%02x", payload[i]);
+    }
+
+    fprintf(output_file, "\r\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static struct bhi360_binstream_dec dec;
+    static uint8_t buffer[4096];
+    FILE *input_file, *output_file = stdout;
+    size_t length;
+
+    if ((argc != 2) && (argc != 3))
+    {
+        printf("Usage: %s <capture> [<output>]. Exiting\n", argv[0]);
+        exit(-1);
+    }
+
+    input_file = fopen(argv[1], "rb");
+    if (!input_file)
+    {
+        printf("Could not open %s. Exiting\n", argv[1]);
+        exit(-1);
+    }
+
+    if (argc == 3)
+    {
+        output_file = fopen(argv[2], "w");
+        if (!output_file)
+        {
+            printf("Could not open %s. Exiting\n", argv[2]);
+            fclose(input_file);
+            exit(-1);
+        }
+    }
+
+    bhi360_binstream_dec_init(print_event, output_file, &dec);
+    while ((length = fread(buffer, 1, sizeof(buffer), input_file)) != 0)
+    {
+        bhi360_binstream_decode(buffer, length, &dec);
+    }
+
+    fclose(input_file);
+    if (output_file != stdout)
+    {
+        fclose(output_file);
+    }
+
+    fprintf(stderr,
+            "%lu events, %lu sync frames, %lu CRC errors, %lu frame count errors, %lu bytes skipped\n",
+            (unsigned long)dec.events,
+            (unsigned long)dec.syncs,
+            (unsigned long)dec.crc_errors,
+            (unsigned long)dec.count_errors,
+            (unsigned long)dec.skipped_bytes);
+
+    return (dec.crc_errors || dec.count_errors || dec.skipped_bytes) ? 1 : 0;
+}
@@ -251,7 +251,7 @@ static void print_api_error(int8_t rslt, struct bhi360_dev *dev)
 static int8_t upload_firmware(struct bhi360_dev *dev)
 {
     uint32_t incr = 256; /* Max command packet size */
-    uint32_t len = sizeof(bhi360_firmware_image);
+    uint32_t len = BHI360_FIRMWARE_IMAGE_LEN;
     int8_t rslt = BHI360_OK;
 
     if ((incr % 4) != 0) /* Round off to higher 4 bytes */
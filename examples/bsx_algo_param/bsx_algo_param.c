@@ -264,7 +264,7 @@ static void upload_firmware(uint8_t boot_stat, struct bhi360_dev *dev)
     int8_t rslt = BHI360_OK;
 
     printf("Loading firmware into RAM.\r\n");
-    rslt = bhi360_upload_firmware_to_ram(bhi360_firmware_image, sizeof(bhi360_firmware_image), dev);
+    rslt = bhi360_upload_firmware_to_ram(bhi360_firmware_image, BHI360_FIRMWARE_IMAGE_LEN, dev);
 
     temp_rslt = bhi360_get_error_value(&sensor_error, dev);
     if (sensor_error)
@@ -379,6 +379,7 @@ int main(int argc, char *argv[])
 
         /* process fifo */
         rslt = bhi360_get_and_process_fifo(work_buffer, WORK_BUFFER_SIZE, &bhy);
+        bhi360_parse_flush();
         print_api_error(rslt, &bhy);
 
         /* Update the callback table to enable parsing of sensor data */
@@ -405,6 +406,7 @@ int main(int argc, char *argv[])
             {
                 /* Data from the FIFO is read and the relevant callbacks if registered are called */
                 rslt = bhi360_get_and_process_fifo(work_buffer, WORK_BUFFER_SIZE, &bhy);
+                bhi360_parse_flush();
                 loop++;
                 print_api_error(rslt, &bhy);
             }
@@ -744,7 +746,7 @@ static void print_api_error(int8_t rslt, struct bhi360_dev *dev)
 static int8_t upload_firmware(struct bhi360_dev *dev)
 {
     uint32_t incr = 256; /* Max command packet size */
-    uint32_t len = sizeof(bhi360_firmware_image);
+    uint32_t len = BHI360_FIRMWARE_IMAGE_LEN;
     int8_t rslt = BHI360_OK;
 
     if ((incr % 4) != 0) /* Round off to higher 4 bytes */
@@ -199,6 +199,15 @@ char *get_api_error(int8_t error_code)
         case BHI360_E_PARAM_NOT_SET:
             ret = "[API Error] Parameter not set";
             break;
+        case BHI360_E_FW_FORMAT:
+            ret = "[API Error] Invalid firmware image format";
+            break;
+        case BHI360_E_CRC:
+            ret = "[API Error] CRC mismatch";
+            break;
+        case BHI360_E_FW_VERSION:
+            ret = "[API Error] Firmware not built for this device";
+            break;
         default:
             ret = "[API Error] Unknown API error code";
     }
@@ -481,6 +490,57 @@ void bhi360_delay_us(uint32_t us, void *private_data)
     coines_delay_usec(us);
 }
 
+uint64_t bhi360_get_time_us(void *private_data)
+{
+    (void)private_data;
+
+    return coines_get_micro_sec();
+}
+
+static bool trace_json_first = true;
+
+/* Chrome trace event format, loads in chrome://tracing and ui.perfetto.dev */
+void trace_json_open(FILE *file)
+{
+    trace_json_first = true;
+    fprintf(file, "{\"traceEvents\":[\n");
+}
+
+/* Trace callback for bhi360_set_trace, with the FILE as trace_ref */
+void trace_json_event(const struct bhi360_trace_event *event, void *trace_ref)
+{
+    static const char *const names[BHI360_TRACE_TYPE_MAX] = {
+        "service", "fifo read", "parse", "callback", "wait status", "boot poll"
+    };
+    static const char *const args[BHI360_TRACE_TYPE_MAX] = { "", "bytes", "bytes", "sensor_id", "polls", "polls" };
+    FILE *file = (FILE *)trace_ref;
+
+    if ((file != NULL) && (event->type < BHI360_TRACE_TYPE_MAX))
+    {
+        /* One track per FIFO for reads, parses and callbacks, the service and waits on track 0 */
+        fprintf(file,
+                "%s{\"name\":\"%s\",\"cat\":\"bhi360\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%lu,\"pid\":1,\"tid\":%u",
+                trace_json_first ? "" : ",\n",
+                names[event->type],
+                (unsigned long long)event->start_us,
+                (unsigned long)event->duration_us,
+                ((event->type == BHI360_TRACE_FIFO_READ) || (event->type == BHI360_TRACE_PARSE) ||
+                 (event->type == BHI360_TRACE_CALLBACK)) ? event->fifo_type + 1 : 0);
+        if (args[event->type][0] != '\0')
+        {
+            fprintf(file, ",\"args\":{\"%s\":%lu}", args[event->type], (unsigned long)event->arg);
+        }
+
+        fprintf(file, "}");
+        trace_json_first = false;
+    }
+}
+
+void trace_json_close(FILE *file)
+{
+    fprintf(file, "\n]}\n");
+}
+
 char *get_sensor_error_text(uint8_t sensor_error)
 {
     char *ret;
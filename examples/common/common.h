@@ -39,6 +39,7 @@
 #define _COMMON_H_
 
 #include <stdbool.h>
+#include <stdio.h>
 
 #include "bhi360.h"
 #include "bhi360_defs.h"
@@ -70,6 +71,11 @@
 #define BHI360_RD_WR_LEN        256      /* MCU maximum read write length */
 #endif
 
+/* Length of the firmware image, set by headers written with fw2h -a */
+#ifndef BHI360_FIRMWARE_IMAGE_LEN
+#define BHI360_FIRMWARE_IMAGE_LEN  sizeof(bhi360_firmware_image)
+#endif
+
 char *get_coines_error(int16_t rslt);
 char *get_api_error(int8_t error_code);
 char *get_sensor_error_text(uint8_t sensor_error);
@@ -89,6 +95,10 @@ int8_t bhi360_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t leng
 int8_t bhi360_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t length, void *intf_ptr);
 int8_t bhi360_i2c_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length, void *intf_ptr);
 void bhi360_delay_us(uint32_t us, void *private_data);
+uint64_t bhi360_get_time_us(void *private_data);
+void trace_json_open(FILE *file);
+void trace_json_event(const struct bhi360_trace_event *event, void *trace_ref);
+void trace_json_close(FILE *file);
 bool get_interrupt_status(void);
 
 #endif /* _COMMON_H_ */
@@ -34,6 +34,7 @@
  *
  */
 
+#include <math.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -45,6 +46,26 @@ static uint8_t verb_lvl = 0;
 #ifndef PC
 static uint8_t verb_buff[VERBOSE_BUFFER_SIZE] = { 0 };
 #endif
+static char data_buff[VERBOSE_DATA_BUFFER_SIZE];
+static uint16_t data_len = 0;
+static uint8_t binary_out = 0; /* Number of users of binary output */
+static verbose_error_fptr_t error_out = NULL;
+static void *error_out_ref = NULL;
+
+/**
+* @brief Function to make room in the data buffer
+* @param[in] length : Number of characters to append, up to VERBOSE_DATA_BUFFER_SIZE
+* @return Position to append at
+*/
+static char *data_reserve(uint16_t length)
+{
+    if ((data_len + length) > VERBOSE_DATA_BUFFER_SIZE)
+    {
+        verbose_flush();
+    }
+
+    return &data_buff[data_len];
+}
 
 /**
 * @brief Function to verbose out all information
@@ -54,8 +75,10 @@ static uint8_t verb_buff[VERBOSE_BUFFER_SIZE] = { 0 };
 */
 static void verb_out(uint8_t verb_ref, const char * restrict format, va_list args)
 {
-    if (verb_lvl >= verb_ref)
+    if ((verb_lvl >= verb_ref) && !binary_out)
     {
+        /* Keep the order with the buffered data lines */
+        verbose_flush();
 #ifdef PC
         vfprintf(stdout, format, args);
 #else
@@ -87,9 +110,30 @@ void verbose(const char * restrict format, ...)
 void verbose_error(const char * restrict format, ...)
 {
     va_list args = { 0 };
+    char text[VERBOSE_BUFFER_SIZE];
+    int len;
 
     va_start(args, format);
-    verb_out(0, format, args);
+    if (!binary_out)
+    {
+        verb_out(0, format, args);
+    }
+    else if (error_out)
+    {
+        /* Errors are passed on whole, so they can be framed in the binary output */
+        len = vsnprintf(text, sizeof(text), format, args);
+        if (len > 0)
+        {
+            error_out(text, (uint16_t)((len < (int)sizeof(text)) ? len : (int)(sizeof(text) - 1)), error_out_ref);
+        }
+    }
+    else
+    {
+#ifdef PC
+        vfprintf(stderr, format, args);
+#endif
+    }
+
     va_end(args);
 }
 
@@ -118,3 +162,239 @@ void verbose_info(const char * restrict format, ...)
     verb_out(2, format, args);
     va_end(args);
 }
+
+/**
+* @brief Function to append a string to the data buffer
+* @param[in] str : Null terminated string
+*/
+void verbose_data_str(const char *str)
+{
+    if (binary_out)
+    {
+        return;
+    }
+
+    while (*str != '\0')
+    {
+        if (data_len == VERBOSE_DATA_BUFFER_SIZE)
+        {
+            verbose_flush();
+        }
+
+        data_buff[data_len++] = *str++;
+    }
+}
+
+/**
+* @brief Function to append an unsigned integer to the data buffer, as %u or %0<width>u
+* @param[in] value : Value
+* @param[in] width : Minimum number of digits, padded with zeros. 0 for no padding
+*/
+void verbose_data_uint(uint32_t value, uint8_t width)
+{
+    char digits[10];
+    uint8_t n = 0;
+    char *out;
+
+    if (binary_out)
+    {
+        return;
+    }
+
+    do
+    {
+        digits[n++] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    width = (width > n) ? width : n;
+    out = data_reserve(width);
+    data_len += width;
+    while (width > n)
+    {
+        *out++ = '0';
+        width--;
+    }
+
+    while (n > 0)
+    {
+        *out++ = digits[--n];
+    }
+}
+
+/**
+* @brief Function to append a byte in hexadecimal to the data buffer, as %02X
+* @param[in] value : Value
+*/
+void verbose_data_hex(uint8_t value)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    char *out;
+
+    if (binary_out)
+    {
+        return;
+    }
+
+    out = data_reserve(2);
+    out[0] = hex[value >> 4];
+    out[1] = hex[value & 0x0F];
+    data_len += 2;
+}
+
+/**
+* @brief Function to append a floating point value to the data buffer, as %.<decimals>f
+* @param[in] value    : Value
+* @param[in] decimals : Digits after the decimal point, up to VERBOSE_FLOAT_MAX_DECIMALS
+*/
+void verbose_data_float(double value, uint8_t decimals)
+{
+    static const uint32_t pow10[VERBOSE_FLOAT_MAX_DECIMALS + 1] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+    double scaled;
+    uint64_t whole;
+    double rest;
+    char digits[20];
+    uint8_t n = 0;
+    char *out;
+    int len;
+
+    if (binary_out)
+    {
+        return;
+    }
+
+    if (decimals > VERBOSE_FLOAT_MAX_DECIMALS)
+    {
+        decimals = VERBOSE_FLOAT_MAX_DECIMALS;
+    }
+
+    scaled = ((value < 0) ? -value : value) * pow10[decimals];
+
+    /* A float scaled by up to 10^6 is exact in a double, so the rounding below matches printf */
+    if (isnan(value) || isinf(value) || (scaled >= 9.2e18))
+    {
+        out = data_reserve(VERBOSE_FLOAT_MAX_LEN);
+        len = snprintf(out, VERBOSE_FLOAT_MAX_LEN, "%.*f", decimals, value);
+        data_len += (uint16_t)((len < VERBOSE_FLOAT_MAX_LEN) ? len : (VERBOSE_FLOAT_MAX_LEN - 1));
+    }
+    else
+    {
+        whole = (uint64_t)scaled;
+        rest = scaled - (double)whole;
+        if ((rest > 0.5) || ((rest == 0.5) && (whole & 1)))
+        {
+            whole++;
+        }
+
+        do
+        {
+            digits[n++] = (char)('0' + (whole % 10));
+            whole /= 10;
+        } while ((whole != 0) || (n <= decimals));
+
+        out = data_reserve((uint16_t)(n + 2));
+        if (signbit(value))
+        {
+            *out++ = '-';
+            data_len++;
+        }
+
+        data_len += n;
+        while (n > decimals)
+        {
+            *out++ = digits[--n];
+        }
+
+        if (decimals != 0)
+        {
+            *out++ = '.';
+            data_len++;
+            while (n > 0)
+            {
+                *out++ = digits[--n];
+            }
+        }
+    }
+}
+
+/**
+* @brief Function to append binary data to the data buffer
+* @param[in] data   : Data
+* @param[in] length : Length of the data
+*/
+void verbose_data_write(const uint8_t *data, uint16_t length)
+{
+    uint16_t part;
+
+    while (length != 0)
+    {
+        if (data_len == VERBOSE_DATA_BUFFER_SIZE)
+        {
+            verbose_flush();
+        }
+
+        part = (uint16_t)(VERBOSE_DATA_BUFFER_SIZE - data_len);
+        if (part > length)
+        {
+            part = length;
+        }
+
+        memcpy(&data_buff[data_len], data, part);
+        data_len += part;
+        data += part;
+        length -= part;
+    }
+}
+
+/**
+* @brief Function to write out the data buffer
+*/
+void verbose_flush(void)
+{
+    if (data_len != 0)
+    {
+#ifdef PC
+        (void)fwrite(data_buff, 1, data_len, stdout);
+#else
+        verbose_write((uint8_t *)data_buff, data_len);
+#endif
+        data_len = 0;
+    }
+}
+
+/**
+* @brief Function to turn binary output on or off. While it is on only verbose_data_write reaches the
+*        output, the text functions are dropped so they cannot break a binary stream. Errors go to
+*        the function set with verbose_set_error_output, or to stderr on PC
+* @param[in] enable : 1 to start a use of binary output, 0 to end one. Text output is back once
+*                     every use has ended
+*/
+void verbose_set_binary(uint8_t enable)
+{
+    verbose_flush();
+    if (enable)
+    {
+        binary_out++;
+    }
+    else if (binary_out > 0)
+    {
+        binary_out--;
+        if (binary_out == 0)
+        {
+            error_out = NULL;
+            error_out_ref = NULL;
+        }
+    }
+}
+
+/**
+* @brief Function to set where errors go while binary output is on. It is cleared when binary
+*        output ends
+* @param[in] error     : Function called with each error message, NULL for the default
+* @param[in] error_ref : Reference passed to error
+*/
+void verbose_set_error_output(verbose_error_fptr_t error, void *error_ref)
+{
+    error_out = error;
+    error_out_ref = error_ref;
+}
@@ -46,6 +46,22 @@ extern "C" {
 
 #define VERBOSE_BUFFER_SIZE  256
 
+/* Data lines are formatted into this buffer and written out when it is full or flushed */
+#ifndef VERBOSE_DATA_BUFFER_SIZE
+#define VERBOSE_DATA_BUFFER_SIZE  2048
+#endif
+
+/* Most digits after the decimal point and longest text written by verbose_data_float */
+#define VERBOSE_FLOAT_MAX_DECIMALS  6
+#define VERBOSE_FLOAT_MAX_LEN       64
+
+#if VERBOSE_DATA_BUFFER_SIZE < VERBOSE_FLOAT_MAX_LEN
+#error "VERBOSE_DATA_BUFFER_SIZE must hold at least VERBOSE_FLOAT_MAX_LEN characters"
+#endif
+
+/* Called with an error message while binary output is on. The text is not null terminated */
+typedef void (*verbose_error_fptr_t)(const char *text, uint16_t length, void *error_ref);
+
 /**
 * @brief Function to verbose any information
 * @param[in] _Format : Format specifier
@@ -91,6 +107,61 @@ void verbose_info(const char * restrict _Format, ...);
 */
 void verbose_write(uint8_t *buffer, uint16_t length);
 
+/**
+* @brief Function to append a string to the data buffer
+* @param[in] str : Null terminated string
+*/
+void verbose_data_str(const char *str);
+
+/**
+* @brief Function to append an unsigned integer to the data buffer, as %u or %0<width>u
+* @param[in] value : Value
+* @param[in] width : Minimum number of digits, padded with zeros. 0 for no padding
+*/
+void verbose_data_uint(uint32_t value, uint8_t width);
+
+/**
+* @brief Function to append a byte in hexadecimal to the data buffer, as %02X
+* @param[in] value : Value
+*/
+void verbose_data_hex(uint8_t value);
+
+/**
+* @brief Function to append a floating point value to the data buffer, as %.<decimals>f
+* @param[in] value    : Value
+* @param[in] decimals : Digits after the decimal point, up to VERBOSE_FLOAT_MAX_DECIMALS
+*/
+void verbose_data_float(double value, uint8_t decimals);
+
+/**
+* @brief Function to append binary data to the data buffer
+* @param[in] data   : Data
+* @param[in] length : Length of the data
+*/
+void verbose_data_write(const uint8_t *data, uint16_t length);
+
+/**
+* @brief Function to write out the data buffer
+*/
+void verbose_flush(void);
+
+/**
+* @brief Function to turn binary output on or off. While it is on only verbose_data_write reaches the
+*        output, the text functions are dropped so they cannot break a binary stream. Errors go to
+*        the function set with verbose_set_error_output, or to stderr on PC
+* @param[in] enable : 1 to start a use of binary output, 0 to end one. Text output is back once
+*                     every use has ended
+*/
+void verbose_set_binary(uint8_t enable);
+
+/**
+* @brief Function to set where errors go while binary output is on. It is cleared when binary
+*        output ends
+* @param[in] error     : Function called with each error message, NULL for the default
+* @param[in] error_ref : Reference passed to error
+*/
+void verbose_set_error_output(verbose_error_fptr_t error, void *error_ref);
+
 /* End of CPP Guard */
 #ifdef __cplusplus
 }
@@ -181,6 +181,7 @@ int main(void)
         print_api_error(rslt, &bhy);
 
         rslt = bhi360_get_and_process_fifo(work_buffer, WORK_BUFFER_SIZE, &bhy);
+        bhi360_parse_flush();
         print_api_error(rslt, &bhy);
     }
     else
@@ -215,6 +216,7 @@ int main(void)
         {
             /* Data from the FIFO is read and the relevant callbacks if registered are called */
             rslt = bhi360_get_and_process_fifo(work_buffer, WORK_BUFFER_SIZE, &bhy);
+            bhi360_parse_flush();
             loop++;
             print_api_error(rslt, &bhy);
         }
@@ -357,7 +359,7 @@ static void upload_firmware(uint8_t boot_stat, struct bhi360_dev *dev)
     int8_t rslt = BHI360_OK;
 
     printf("Loading firmware into RAM.\r\n");
-    rslt = bhi360_upload_firmware_to_ram(bhi360_firmware_image, sizeof(bhi360_firmware_image), dev);
+    rslt = bhi360_upload_firmware_to_ram(bhi360_firmware_image, BHI360_FIRMWARE_IMAGE_LEN, dev);
     temp_rslt = bhi360_get_error_value(&sensor_error, dev);
     if (sensor_error)
     {
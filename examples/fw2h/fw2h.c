@@ -34,71 +34,543 @@
  * @brief   Firmware to Header example for the BHI360
  *
  */
+
+/*
+ * Usage: fw2h [-f array|string|incbin] [-s section] [-n name] [-a] [-c] <firmware file> ...
+ *
+ * For each firmware file, <file>.h is written with a named image, its length and CRC,
+ * and the versions from the section headers. Options apply to the files that follow.
+ *   -f string : String literal, compiles much faster than an array. Default
+ *   -f array  : Array initializer
+ *   -f incbin : <file>.c embeds the binary with the assembler .incbin directive, resolved
+ *               relative to the build directory. GCC and Clang only
+ *   -s        : Linker section to place the image in
+ *   -n        : Symbol name for the next file, derived from the file name otherwise
+ *   -a        : Also name the next image bhi360_firmware_image, with its length in
+ *               BHI360_FIRMWARE_IMAGE_LEN, as used by the examples
+ *   -c        : Compressed image in <file>.lz.h, named with an _lz suffix, see bhi360_fw_lz.h.
+ *               <NAME>_LEN is the compressed length and <NAME>_RAW_LEN that of the firmware.
+ *               With incbin, the compressed image is written to <file>.lz
+ */
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "bhi360_fw.h"
+
+#define N_ROWS            12
+#define N_STRING_ROWS     32
+
+/* Compressed image format, see bhi360_fw_lz.h */
+#define LZ_MAGIC          0x5A4C
+#define LZ_VERSION        1
+#define LZ_HEADER_LEN     12
+#define LZ_WINDOW_BITS    11
+#define LZ_WINDOW_SIZE    (1u << LZ_WINDOW_BITS)
+#define LZ_MIN_MATCH      4
+#define LZ_MAX_MATCH      0xFFFF
+
+static void put_le32(unsigned char *dst, uint32_t val)
+{
+    dst[0] = (unsigned char)(val & 0xFF);
+    dst[1] = (unsigned char)((val >> 8) & 0xFF);
+    dst[2] = (unsigned char)((val >> 16) & 0xFF);
+    dst[3] = (unsigned char)((val >> 24) & 0xFF);
+}
+
+static uint32_t put_len_ext(unsigned char *dst, uint32_t len)
+{
+    uint32_t n = 0;
+
+    while (len >= 255)
+    {
+        dst[n++] = 255;
+        len -= 255;
+    }
+
+    dst[n++] = (unsigned char)len;
+
+    return n;
+}
+
+static uint32_t put_block(unsigned char *dst,
+                          const unsigned char *literals,
+                          uint32_t literal_len,
+                          uint32_t match_offset,
+                          uint32_t match_len)
+{
+    uint32_t n = 1;
+    uint32_t match_code = (match_len != 0) ? (match_len - LZ_MIN_MATCH) : 0;
+
+    dst[0] = (unsigned char)(((literal_len < 15) ? literal_len : 15) << 4);
+    dst[0] |= (unsigned char)((match_code < 15) ? match_code : 15);
+    if (literal_len >= 15)
+    {
+        n += put_len_ext(&dst[n], literal_len - 15);
+    }
+
+    memcpy(&dst[n], literals, literal_len);
+    n += literal_len;
+
+    if (match_len != 0)
+    {
+        dst[n++] = (unsigned char)(match_offset & 0xFF);
+        dst[n++] = (unsigned char)((match_offset >> 8) & 0xFF);
+        if (match_code >= 15)
+        {
+            n += put_len_ext(&dst[n], match_code - 15);
+        }
+    }
+
+    return n;
+}
+
+/* Greedy LZ77 over a window that the decompressor on the MCU can hold */
+static uint32_t lz_compress(const unsigned char *src, uint32_t src_len, unsigned char *dst)
+{
+    uint32_t pos = 0, anchor = 0, out = LZ_HEADER_LEN;
+    uint32_t cand, len, best_len, best_off, start;
+
+    while (pos < src_len)
+    {
+        best_len = 0;
+        best_off = 0;
+        start = (pos > LZ_WINDOW_SIZE) ? (pos - LZ_WINDOW_SIZE) : 0;
+        for (cand = pos; cand-- > start;)
+        {
+            len = 0;
+            while (((pos + len) < src_len) && (len < LZ_MAX_MATCH) && (src[cand + len] == src[pos + len]))
+            {
+                len++;
+            }
+
+            if (len > best_len)
+            {
+                best_len = len;
+                best_off = pos - cand;
+            }
+        }
+
+        if (best_len >= LZ_MIN_MATCH)
+        {
+            out += put_block(&dst[out], &src[anchor], pos - anchor, best_off, best_len);
+            pos += best_len;
+            anchor = pos;
+        }
+        else
+        {
+            pos++;
+        }
+    }
+
+    out += put_block(&dst[out], &src[anchor], pos - anchor, 0, 0);
+
+    dst[0] = LZ_MAGIC & 0xFF;
+    dst[1] = (LZ_MAGIC >> 8) & 0xFF;
+    dst[2] = LZ_VERSION;
+    dst[3] = LZ_WINDOW_BITS;
+    put_le32(&dst[4], src_len);
+    put_le32(&dst[8], out - LZ_HEADER_LEN);
+
+    return out;
+}
+
+static void write_array(FILE *output_file, const char *name, const unsigned char *data, uint32_t len)
+{
+    uint32_t i, j;
+
+    fprintf(output_file, "const unsigned char %s[] = {\n", name);
+    for (i = 0; i < len; i += N_ROWS)
+    {
+        fprintf(output_file, "  ");
+        for (j = i; (j < len) && (j < (i + N_ROWS)); j++)
+        {
+            fprintf(output_file, "0x%02x, ", data[j]);
+        }
+
+        fprintf(output_file, "\n");
+    }
+
+    fprintf(output_file, "};\n");
+}
+
+static unsigned char *load_file(const char *path, uint32_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    unsigned char *data = NULL;
+    long len;
+
+    if (file)
+    {
+        fseek(file, 0, SEEK_END);
+        len = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        data = (len > 0) ? malloc((size_t)len) : NULL;
+        if (data && (fread(data, 1, (size_t)len, file) == (size_t)len))
+        {
+            *length = (uint32_t)len;
+        }
+        else
+        {
+            free(data);
+            data = NULL;
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+/* Returns the compressed image, freed by the caller */
+static unsigned char *compress_image(const char *input_name,
+                                     const unsigned char *raw,
+                                     uint32_t raw_len,
+                                     uint32_t *lz_len)
+{
+    unsigned char *lz;
+
+    /* Worst case is all literals plus the length extensions */
+    lz = malloc((size_t)raw_len + ((size_t)raw_len / 255) + LZ_HEADER_LEN + 16);
+    if (lz == NULL)
+    {
+        printf("Could not compress %s\n", input_name);
+    }
+    else
+    {
+        *lz_len = lz_compress(raw, raw_len, lz);
+        printf("Compressed %s from %lu to %lu bytes\n", input_name, (unsigned long)raw_len, (unsigned long)*lz_len);
+    }
+
+    return lz;
+}
+
+/* bhi360_fw_ followed by the file name without directory and extension, in lower case */
+static void make_name(const char *path, char *name, size_t name_size)
+{
+    const char *base = strrchr(path, '/');
+    const char *back = strrchr(path, '\\');
+    size_t n;
+
+    base = (back > base) ? back : base;
+    base = base ? (base + 1) : path;
+
+    n = (size_t)snprintf(name, name_size, "bhi360_fw_");
+    for (; (*base != '\0') && (*base != '.') && (n < (name_size - 1)); base++)
+    {
+        name[n++] = isalnum((unsigned char)*base) ? (char)tolower((unsigned char)*base) : '_';
+    }
+
+    name[n] = '\0';
+}
+
+static void make_upper(const char *name, char *upper, size_t upper_size)
+{
+    size_t n;
+
+    for (n = 0; (name[n] != '\0') && (n < (upper_size - 1)); n++)
+    {
+        upper[n] = (char)toupper((unsigned char)name[n]);
+    }
+
+    upper[n] = '\0';
+}
+
+static void write_summary(FILE *output_file,
+                          const char *input_name,
+                          const char *upper,
+                          const unsigned char *data,
+                          uint32_t len,
+                          uint32_t image_len,
+                          int compressed)
+{
+    struct bhi360_fw_info info;
+    int8_t rslt;
 
-#define N_ROWS  12
+    rslt = bhi360_fw_parse(data, len, &info);
+
+    fprintf(output_file, "/*\n * Generated by fw2h from %s\n *\n", input_name);
+    for (uint8_t i = 0; i < info.n_sections; i++)
+    {
+        fprintf(output_file,
+                " * Section %u: version %u, flags 0x%04x, %lu bytes, CRC 0x%08lx, expects version %u\n",
+                i,
+                info.section[i].version,
+                info.section[i].flags,
+                (unsigned long)info.section[i].payload_len,
+                (unsigned long)info.section[i].payload_crc,
+                info.section[i].expected_version);
+    }
+
+    if (rslt != 0)
+    {
+        fprintf(output_file, " * The section headers could not be parsed (%d)\n", rslt);
+        printf("Warning: the section headers of %s could not be parsed\n", input_name);
+    }
+
+    if (compressed)
+    {
+        fprintf(output_file, " *\n * Compressed, see bhi360_fw_lz.h. The CRC and versions are those of the firmware\n");
+    }
+
+    fprintf(output_file, " */\n\n");
+    fprintf(output_file, "#ifndef %s_H_\n#define %s_H_\n\n#include <stdint.h>\n\n", upper, upper);
+    fprintf(output_file, "#define %s_LEN UINT32_C(%lu)\n", upper, (unsigned long)image_len);
+    if (compressed)
+    {
+        fprintf(output_file, "#define %s_RAW_LEN UINT32_C(%lu)\n", upper, (unsigned long)len);
+    }
+
+    fprintf(output_file,
+            "#define %s_CRC UINT32_C(0x%08lx)\n",
+            upper,
+            (unsigned long)bhi360_fw_crc32(BHI360_FW_CRC_INIT, data, len));
+    if ((rslt == 0) && (info.n_sections > 0))
+    {
+        fprintf(output_file, "#define %s_ROM_VERSION UINT16_C(%u)\n", upper, info.section[0].expected_version);
+        fprintf(output_file, "#define %s_KERNEL_VERSION UINT16_C(%u)\n", upper, info.section[0].version);
+    }
+
+    if ((rslt == 0) && (info.n_sections > 1))
+    {
+        fprintf(output_file, "#define %s_USER_VERSION UINT16_C(%u)\n", upper, info.section[1].version);
+    }
+
+    fprintf(output_file, "\n");
+}
+
+static void write_string(FILE *output_file,
+                         const char *name,
+                         const char *upper,
+                         const char *attr,
+                         const unsigned char *data,
+                         uint32_t len)
+{
+    uint32_t i, j;
+
+    /* C++ requires room for the terminating null character */
+    fprintf(output_file, "#ifdef __cplusplus\n");
+    fprintf(output_file, "%sconst unsigned char %s[%s_LEN + 1] =\n", attr, name, upper);
+    fprintf(output_file, "#else\n");
+    fprintf(output_file, "%sconst unsigned char %s[%s_LEN] =\n", attr, name, upper);
+    fprintf(output_file, "#endif\n");
+    for (i = 0; i < len; i += N_STRING_ROWS)
+    {
+        fprintf(output_file, "    \"");
+        for (j = i; (j < len) && (j < (i + N_STRING_ROWS)); j++)
+        {
+            fprintf(output_file, "\\x%02x", data[j]);
+        }
+
+        fprintf(output_file, "\"\n");
+    }
+
+    fprintf(output_file, ";\n");
+}
+
+/* The image is the firmware itself, or its compressed form */
+static void convert_named(const char *input_name,
+                          const char *name,
+                          const char *format,
+                          const char *section,
+                          int alias,
+                          const unsigned char *data,
+                          uint32_t len,
+                          const unsigned char *image,
+                          uint32_t image_len)
+{
+    FILE *output_file;
+    char output_file_name[256]; /* Limit file name to 256 characters */
+    char base_name[252]; /* Leaves room for the extension */
+    char upper[256];
+    char attr[256] = "";
+    int compressed = (image != data);
+
+    make_upper(name, upper, sizeof(upper));
+    if (section != NULL)
+    {
+        snprintf(attr, sizeof(attr), "__attribute__((section(\"%s\"), aligned(4))) ", section);
+    }
+
+    snprintf(base_name, sizeof(base_name), "%s%s", input_name, compressed ? ".lz" : "");
+    snprintf(output_file_name, sizeof(output_file_name), "%s" ".h", base_name);
+    printf("Copying firmware to %s as %s\n", output_file_name, name);
+    output_file = fopen(output_file_name, "w");
+    if (output_file == NULL)
+    {
+        printf("Could not create %s\n", output_file_name);
+
+        return;
+    }
+
+    write_summary(output_file, input_name, upper, data, len, image_len, compressed);
+
+    if (strcmp(format, "incbin") == 0)
+    {
+        fprintf(output_file, "extern const unsigned char %s[%s_LEN];\n", name, upper);
+    }
+    else
+    {
+        if (strcmp(format, "array") == 0)
+        {
+            fprintf(output_file, "%s", attr);
+            write_array(output_file, name, image, image_len);
+        }
+        else
+        {
+            write_string(output_file, name, upper, attr, image, image_len);
+        }
+    }
+
+    /* The string has a terminating null character in C++, so the length is taken from the macro */
+    if (alias)
+    {
+        fprintf(output_file, "\n/* Name used by the examples */\n");
+        fprintf(output_file, "#define bhi360_firmware_image %s\n", name);
+        fprintf(output_file, "#undef BHI360_FIRMWARE_IMAGE_LEN\n");
+        fprintf(output_file, "#define BHI360_FIRMWARE_IMAGE_LEN %s_LEN\n", upper);
+    }
+
+    fprintf(output_file, "\n#endif /* %s_H_ */\n", upper);
+    fclose(output_file);
+
+    if ((strcmp(format, "incbin") == 0) && compressed)
+    {
+        /* The assembler embeds the compressed image from its own file */
+        output_file = fopen(base_name, "wb");
+        if ((output_file == NULL) || (fwrite(image, 1, image_len, output_file) != image_len))
+        {
+            printf("Could not write %s\n", base_name);
+        }
+
+        if (output_file != NULL)
+        {
+            fclose(output_file);
+        }
+    }
+
+    if (strcmp(format, "incbin") == 0)
+    {
+        snprintf(output_file_name, sizeof(output_file_name), "%s" ".c", base_name);
+        output_file = fopen(output_file_name, "w");
+        if (output_file == NULL)
+        {
+            printf("Could not create %s\n", output_file_name);
+
+            return;
+        }
+
+        fprintf(output_file, "/* Generated by fw2h from %s */\n\n", input_name);
+        fprintf(output_file, "__asm__(\"    .section %s, \\\"a\\\"\\n\"\n", section ? section : ".rodata");
+        fprintf(output_file, "        \"    .global %s\\n\"\n", name);
+        fprintf(output_file, "        \"    .balign 4\\n\"\n");
+        fprintf(output_file, "        \"%s:\\n\"\n", name);
+        fprintf(output_file, "        \"    .incbin \\\"%s\\\"\\n\"\n", base_name);
+        fprintf(output_file, "        \"    .previous\\n\");\n");
+        fclose(output_file);
+    }
+}
 
 /*lint -e818 suppressing parameter(argv) could be declared as pointer to constant info as the info is not addressed
  * after declaring the parameter as pointer to constant */
 int main(int argc, char *argv[])
 {
-    FILE *input_file, *output_file;
-    char output_file_name[256]; /* Limit file name to 256 characters */
-    unsigned char fw[N_ROWS];
+    unsigned char *data;
+    unsigned char *image;
+    uint32_t len = 0;
+    uint32_t image_len = 0;
+    int compress = 0;
+    int alias = 0;
+    const char *format = "string";
+    const char *section = NULL;
+    const char *forced_name = NULL;
+    char name[256];
 
     printf("Utility to convert binary files to .h\n");
     if (argc == 1)
     {
-        printf("Pass a firmware file as an argument. Exiting\n");
+        printf("Usage: fw2h [-f array|string|incbin] [-s section] [-n name] [-a] [-c] <firmware file> ... Exiting\n");
         exit(-1);
     }
     else
     {
         for (int i = 1; i < argc; i++)
         {
-            input_file = fopen(argv[i], "rb");
-            if (input_file)
+            if (strcmp(argv[i], "-c") == 0)
+            {
+                compress = 1;
+                continue;
+            }
+
+            if (strcmp(argv[i], "-a") == 0)
             {
-                sprintf(output_file_name, "%s" ".h", (char *)argv[i]);
-                printf("Copying firmware to %s\n", output_file_name);
-                output_file = fopen(output_file_name, "w");
-                if (output_file)
+                alias = 1;
+                continue;
+            }
+
+            if (((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "-s") == 0) || (strcmp(argv[i], "-n") == 0)) &&
+                ((i + 1) < argc))
+            {
+                if (argv[i][1] == 'f')
                 {
-                    fprintf(output_file, "const unsigned char bhi360_firmware_image[] = {\n");
-                    unsigned char bytes_read = 0;
-                    unsigned char j = 0;
-                    do
-                    {
-                        bytes_read = (uint8_t)fread(fw, 1, N_ROWS, input_file);
-                        if (bytes_read)
-                        {
-                            fprintf(output_file, "  ");
-                            for (j = 0; j < bytes_read; j++)
-                            {
-                                fprintf(output_file, "0x%02x, ", fw[j]);
-                            }
-
-                            fprintf(output_file, "\n");
-                        }
-                    } while (bytes_read != 0);
-                    fprintf(output_file, "};\n");
-                    fclose(output_file);
+                    format = argv[i + 1];
+                }
+                else if (argv[i][1] == 's')
+                {
+                    section = argv[i + 1];
                 }
                 else
                 {
-                    printf("Could not create %s\n", output_file_name);
+                    forced_name = argv[i + 1];
                 }
+
+                i++;
+                continue;
             }
-            else
+
+            data = load_file(argv[i], &len);
+            if (data == NULL)
             {
                 printf("Could not open %s.\n", argv[i]);
+                continue;
+            }
+
+            if (forced_name != NULL)
+            {
+                snprintf(name, sizeof(name), "%s", forced_name);
+                forced_name = NULL;
+            }
+            else
+            {
+                make_name(argv[i], name, sizeof(name) - 3);
+                strcat(name, compress ? "_lz" : "");
+            }
+
+            image = data;
+            image_len = len;
+            if (compress)
+            {
+                image = compress_image(argv[i], data, len, &image_len);
+            }
+
+            if (image != NULL)
+            {
+                convert_named(argv[i], name, format, section, alias, data, len, image, image_len);
+            }
+
+            alias = 0;
+            if (image != data)
+            {
+                free(image);
             }
 
-            fclose(input_file);
+            free(data);
         }
     }
+
+    return 0;
 }
 
 /*lint +e818*/
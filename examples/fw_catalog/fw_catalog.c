@@ -0,0 +1,425 @@
+/**
+ * Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file    fw_catalog.c
+ * @brief   Firmware catalog builder for the BHI360
+ *
+ */
+
+/*
+ * Builds a firmware catalog (see bhi360_fw_catalog.h) from a manifest. Each line of
+ * the manifest describes one image:
+ *
+ *   <firmware file> <variant ID> <flags> [<virtual sensor ID> ...]
+ *
+ * The flags are '-' or a comma separated list of 'turbo' and 'poll'. Lines starting
+ * with '#' are ignored. The largest image is stored in full, every other image as a
+ * delta against it.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bhi360_fw.h"
+#include "bhi360_fw_catalog.h"
+
+#define N_ROWS        12
+#define MAX_IMAGES    64
+#define HASH_BITS     16
+#define HASH_LEN      8
+#define MAX_CHAIN     64
+#define MIN_COPY      8
+
+struct image
+{
+    char path[256];
+    unsigned char *data;
+    uint32_t length;
+    uint32_t variant_id;
+    uint16_t flags;
+    uint8_t sensor_present[32];
+    unsigned char *delta;
+    uint32_t delta_len;
+};
+
+static struct image images[MAX_IMAGES];
+static int32_t hash_head[1 << HASH_BITS];
+static int32_t *hash_prev;
+
+static void put_le16(unsigned char *dst, uint16_t val)
+{
+    dst[0] = (unsigned char)(val & 0xFF);
+    dst[1] = (unsigned char)((val >> 8) & 0xFF);
+}
+
+static void put_le32(unsigned char *dst, uint32_t val)
+{
+    put_le16(dst, (uint16_t)(val & 0xFFFF));
+    put_le16(&dst[2], (uint16_t)(val >> 16));
+}
+
+static uint32_t hash(const unsigned char *p)
+{
+    uint32_t h = 2166136261u;
+
+    for (int i = 0; i < HASH_LEN; i++)
+    {
+        h = (h ^ p[i]) * 16777619u;
+    }
+
+    return h >> (32 - HASH_BITS);
+}
+
+static unsigned char *load_file(const char *path, uint32_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    unsigned char *data = NULL;
+    long len;
+
+    if (file)
+    {
+        fseek(file, 0, SEEK_END);
+        len = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        data = (len > 0) ? malloc((size_t)len) : NULL;
+        if (data && (fread(data, 1, (size_t)len, file) == (size_t)len))
+        {
+            *length = (uint32_t)len;
+        }
+        else
+        {
+            free(data);
+            data = NULL;
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+static int read_manifest(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char line[1024];
+    char *fields[260];
+    int n = 0, n_fields;
+    unsigned long id;
+
+    if (!file)
+    {
+        printf("Could not open %s\n", path);
+
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file) && (n < MAX_IMAGES))
+    {
+        n_fields = 0;
+        for (char *tok = strtok(line, " \t\r\n"); tok && (n_fields < 260); tok = strtok(NULL, " \t\r\n"))
+        {
+            fields[n_fields++] = tok;
+        }
+
+        if ((n_fields == 0) || (fields[0][0] == '#'))
+        {
+            continue;
+        }
+
+        memset(&images[n], 0, sizeof(images[n]));
+        snprintf(images[n].path, sizeof(images[n].path), "%s", fields[0]);
+        if (n_fields > 1)
+        {
+            images[n].variant_id = (uint32_t)strtoul(fields[1], NULL, 0);
+        }
+
+        if ((n_fields > 2) && strstr(fields[2], "turbo"))
+        {
+            images[n].flags |= BHI360_FW_CATALOG_FLAG_TURBO;
+        }
+
+        if ((n_fields > 2) && strstr(fields[2], "poll"))
+        {
+            images[n].flags |= BHI360_FW_CATALOG_FLAG_POLL;
+        }
+
+        for (int i = 3; i < n_fields; i++)
+        {
+            id = strtoul(fields[i], NULL, 0);
+            if (id < 256)
+            {
+                images[n].sensor_present[id / 8] |= (uint8_t)(1u << (id % 8));
+            }
+        }
+
+        images[n].data = load_file(images[n].path, &images[n].length);
+        if (images[n].data == NULL)
+        {
+            printf("Could not read %s\n", images[n].path);
+            fclose(file);
+
+            return -1;
+        }
+
+        n++;
+    }
+
+    fclose(file);
+
+    return n;
+}
+
+static uint32_t put_len_ext(unsigned char *dst, uint32_t len)
+{
+    uint32_t n = 0;
+
+    while (len >= 255)
+    {
+        dst[n++] = 255;
+        len -= 255;
+    }
+
+    dst[n++] = (unsigned char)len;
+
+    return n;
+}
+
+static uint32_t put_block(unsigned char *dst,
+                          const unsigned char *literals,
+                          uint32_t literal_len,
+                          uint32_t copy_pos,
+                          uint32_t copy_len)
+{
+    uint32_t n = 1;
+    uint32_t copy_code = (copy_len != 0) ? (copy_len - BHI360_FW_CATALOG_MIN_COPY) : 0;
+
+    dst[0] = (unsigned char)(((literal_len < 15) ? literal_len : 15) << 4);
+    dst[0] |= (unsigned char)((copy_code < 15) ? copy_code : 15);
+    if (literal_len >= 15)
+    {
+        n += put_len_ext(&dst[n], literal_len - 15);
+    }
+
+    memcpy(&dst[n], literals, literal_len);
+    n += literal_len;
+
+    if (copy_len != 0)
+    {
+        dst[n++] = (unsigned char)(copy_pos & 0xFF);
+        dst[n++] = (unsigned char)((copy_pos >> 8) & 0xFF);
+        dst[n++] = (unsigned char)((copy_pos >> 16) & 0xFF);
+        if (copy_code >= 15)
+        {
+            n += put_len_ext(&dst[n], copy_code - 15);
+        }
+    }
+
+    return n;
+}
+
+static void index_base(const struct image *base)
+{
+    uint32_t i, h;
+
+    memset(hash_head, 0xFF, sizeof(hash_head));
+    hash_prev = malloc(sizeof(int32_t) * base->length);
+    for (i = 0; (i + HASH_LEN) <= base->length; i++)
+    {
+        h = hash(&base->data[i]);
+        hash_prev[i] = hash_head[h];
+        hash_head[h] = (int32_t)i;
+    }
+}
+
+/* Greedy match against the base image, copies need at least MIN_COPY bytes to pay off */
+static void make_delta(const struct image *base, struct image *img)
+{
+    uint32_t pos = 0, anchor = 0, out = 0;
+    uint32_t len, best_len, best_pos;
+    int32_t cand;
+    int chain;
+
+    img->delta = malloc(img->length + (img->length / 255) + 16);
+    while (pos < img->length)
+    {
+        best_len = 0;
+        best_pos = 0;
+        if ((pos + HASH_LEN) <= img->length)
+        {
+            cand = hash_head[hash(&img->data[pos])];
+            for (chain = 0; (cand >= 0) && (chain < MAX_CHAIN); chain++, cand = hash_prev[cand])
+            {
+                len = 0;
+                while (((pos + len) < img->length) && (((uint32_t)cand + len) < base->length) &&
+                       (base->data[(uint32_t)cand + len] == img->data[pos + len]))
+                {
+                    len++;
+                }
+
+                if (len > best_len)
+                {
+                    best_len = len;
+                    best_pos = (uint32_t)cand;
+                }
+            }
+        }
+
+        if (best_len >= MIN_COPY)
+        {
+            out += put_block(&img->delta[out], &img->data[anchor], pos - anchor, best_pos, best_len);
+            pos += best_len;
+            anchor = pos;
+        }
+        else
+        {
+            pos++;
+        }
+    }
+
+    out += put_block(&img->delta[out], &img->data[anchor], pos - anchor, 0, 0);
+    img->delta_len = out;
+}
+
+static void write_array(FILE *output_file, const char *name, const unsigned char *data, uint32_t len)
+{
+    uint32_t i, j;
+
+    fprintf(output_file, "const unsigned char %s[] = {\n", name);
+    for (i = 0; i < len; i += N_ROWS)
+    {
+        fprintf(output_file, "  ");
+        for (j = i; (j < len) && (j < (i + N_ROWS)); j++)
+        {
+            fprintf(output_file, "0x%02x, ", data[j]);
+        }
+
+        fprintf(output_file, "\n");
+    }
+
+    fprintf(output_file, "};\n");
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *output_file;
+    unsigned char *catalog, *entry;
+    uint32_t catalog_len, base_offset, offset, raw_total = 0;
+    int n_images, base = 0;
+
+    printf("Utility to build a firmware catalog\n");
+    if (argc != 3)
+    {
+        printf("Usage: %s <manifest> <output .h>. Exiting\n", argv[0]);
+        exit(-1);
+    }
+
+    n_images = read_manifest(argv[1]);
+    if (n_images <= 0)
+    {
+        printf("No images in %s. Exiting\n", argv[1]);
+        exit(-1);
+    }
+
+    for (int i = 0; i < n_images; i++)
+    {
+        if (images[i].length > images[base].length)
+        {
+            base = i;
+        }
+    }
+
+    index_base(&images[base]);
+    base_offset = BHI360_FW_CATALOG_HEADER_LEN + ((uint32_t)n_images * BHI360_FW_CATALOG_ENTRY_LEN);
+    catalog_len = base_offset + images[base].length;
+    for (int i = 0; i < n_images; i++)
+    {
+        if (i != base)
+        {
+            make_delta(&images[base], &images[i]);
+            catalog_len += images[i].delta_len;
+        }
+
+        raw_total += images[i].length;
+    }
+
+    catalog = calloc(1, catalog_len);
+    put_le16(catalog, BHI360_FW_CATALOG_MAGIC);
+    catalog[2] = BHI360_FW_CATALOG_VERSION;
+    catalog[3] = (unsigned char)n_images;
+    put_le32(&catalog[4], base_offset);
+    put_le32(&catalog[8], images[base].length);
+    memcpy(&catalog[base_offset], images[base].data, images[base].length);
+
+    offset = base_offset + images[base].length;
+    for (int i = 0; i < n_images; i++)
+    {
+        entry = &catalog[BHI360_FW_CATALOG_HEADER_LEN + ((uint32_t)i * BHI360_FW_CATALOG_ENTRY_LEN)];
+        put_le32(&entry[0], images[i].variant_id);
+        put_le32(&entry[4], images[i].length);
+        put_le32(&entry[8], bhi360_fw_crc32(BHI360_FW_CRC_INIT, images[i].data, images[i].length));
+        put_le32(&entry[12], (i == base) ? 0 : offset);
+        put_le32(&entry[16], images[i].delta_len);
+        put_le16(&entry[20], images[i].flags);
+        memcpy(&entry[24], images[i].sensor_present, sizeof(images[i].sensor_present));
+        if (i != base)
+        {
+            memcpy(&catalog[offset], images[i].delta, images[i].delta_len);
+            offset += images[i].delta_len;
+        }
+
+        printf("%2d: %s, %lu bytes, %s %lu bytes\n",
+               i,
+               images[i].path,
+               (unsigned long)images[i].length,
+               (i == base) ? "base" : "delta",
+               (unsigned long)((i == base) ? images[i].length : images[i].delta_len));
+    }
+
+    output_file = fopen(argv[2], "w");
+    if (output_file)
+    {
+        write_array(output_file, "bhi360_firmware_catalog", catalog, catalog_len);
+        fclose(output_file);
+        printf("Wrote %s, %lu images of %lu bytes in %lu bytes\n",
+               argv[2],
+               (unsigned long)n_images,
+               (unsigned long)raw_total,
+               (unsigned long)catalog_len);
+    }
+    else
+    {
+        printf("Could not create %s\n", argv[2]);
+    }
+
+    return 0;
+}
@@ -40,10 +40,22 @@
 #include <stdbool.h>
 
 #include "bhi360.h"
+#include "bhi360_fw.h"
+#include "bhi360_fw_lz.h"
 #include "bhi360_parse.h"
 #include "common.h"
 
+/* Define BHI360_USE_COMPRESSED_FW to upload the image generated by fw2h -c -a */
+#ifdef BHI360_USE_COMPRESSED_FW
+#include "bhi360/Bosch_Shuttle3_BHI360_BMM350C_BMP580_BME688.fw.lz.h"
+
+/* Decompressor work area, shared by the running check and the upload */
+static struct bhi360_fw_lz_dev lz;
+#else
 #include "bhi360/Bosch_Shuttle3_BHI360_BMM350C_BMP580_BME688.fw.h"
+#endif
+
+/* Define BHI360_USE_WARM_START to keep the sensor powered and skip the upload if the image is already running */
 
 static void print_api_error(int8_t rslt, struct bhi360_dev *dev);
 static int8_t upload_firmware(struct bhi360_dev *dev);
@@ -56,8 +68,10 @@ int main(void)
     uint16_t version = 0;
     int8_t rslt;
     struct bhi360_dev bhy;
+    struct bhi360_boot_time boot_time;
 
     uint8_t hintr_ctrl, hif_ctrl, boot_status;
+    uint8_t running = 0;
 
 #ifdef BHI360_USE_I2C
     intf = BHI360_I2C_INTERFACE;
@@ -65,7 +79,11 @@ int main(void)
     intf = BHI360_SPI_INTERFACE;
 #endif
 
+#ifdef BHI360_USE_WARM_START
+    setup_interfaces(false, intf); /* Keep the firmware in RAM */
+#else
     setup_interfaces(true, intf); /* Perform a power on reset */
+#endif
 
 #ifdef BHI360_USE_I2C
     rslt = bhi360_init(BHI360_I2C_INTERFACE,
@@ -86,9 +104,24 @@ int main(void)
 #endif
     print_api_error(rslt, &bhy);
 
-    rslt = bhi360_soft_reset(&bhy);
+    rslt = bhi360_set_time_source(bhi360_get_time_us, &bhy);
     print_api_error(rslt, &bhy);
 
+#ifdef BHI360_USE_WARM_START
+#ifdef BHI360_USE_COMPRESSED_FW
+    rslt = bhi360_fw_lz_check_fw_running(bhi360_firmware_image, BHI360_FIRMWARE_IMAGE_LEN, &running, &lz, &bhy);
+#else
+    rslt = bhi360_check_fw_running(bhi360_firmware_image, BHI360_FIRMWARE_IMAGE_LEN, &running, &bhy);
+#endif
+    print_api_error(rslt, &bhy);
+#endif
+
+    if (!running)
+    {
+        rslt = bhi360_soft_reset(&bhy);
+        print_api_error(rslt, &bhy);
+    }
+
     rslt = bhi360_get_chip_id(&chip_id, &bhy);
     print_api_error(rslt, &bhy);
 
@@ -117,7 +150,13 @@ int main(void)
     rslt = bhi360_get_boot_status(&boot_status, &bhy);
     print_api_error(rslt, &bhy);
 
-    if (boot_status & BHI360_BST_HOST_INTERFACE_READY)
+    if (running)
+    {
+        rslt = bhi360_get_kernel_version(&version, &bhy);
+        print_api_error(rslt, &bhy);
+        printf("Firmware already running, upload skipped. Kernel version %u.\r\n", version);
+    }
+    else if (boot_status & BHI360_BST_HOST_INTERFACE_READY)
     {
         uint8_t sensor_error;
         int8_t temp_rslt;
@@ -151,6 +190,15 @@ int main(void)
         {
             printf("Boot successful. Kernel version %u.\r\n", version);
         }
+
+        rslt = bhi360_get_boot_time(&boot_time, &bhy);
+        print_api_error(rslt, &bhy);
+        printf("Upload %lu us, verify %lu us (%u polls), boot %lu us (%u polls)\r\n",
+               (unsigned long)boot_time.upload_us,
+               (unsigned long)boot_time.verify_us,
+               boot_time.verify_polls,
+               (unsigned long)boot_time.boot_us,
+               boot_time.boot_polls);
     }
     else
     {
@@ -181,17 +229,36 @@ static void print_api_error(int8_t rslt, struct bhi360_dev *dev)
     }
 }
 
+#ifdef BHI360_USE_COMPRESSED_FW
+static int8_t upload_firmware(struct bhi360_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = bhi360_fw_lz_upload_to_ram(bhi360_firmware_image, BHI360_FIRMWARE_IMAGE_LEN, &lz, dev);
+    printf("Uploaded compressed image of %lu bytes\r\n", (unsigned long)BHI360_FIRMWARE_IMAGE_LEN);
+
+    return rslt;
+}
+#else
 static int8_t upload_firmware(struct bhi360_dev *dev)
 {
     uint32_t incr = 256; /* Max command packet size */
-    uint32_t len = sizeof(bhi360_firmware_image);
-    int8_t rslt = BHI360_OK;
+    uint32_t len = BHI360_FIRMWARE_IMAGE_LEN;
+    int8_t rslt;
+    uint16_t rom_version = 0;
 
     if ((incr % 4) != 0) /* Round off to higher 4 bytes */
     {
         incr = ((incr >> 2) + 1) << 2;
     }
 
+    /* The upload in parts cannot check the whole image, so verify it before the first part */
+    rslt = bhi360_get_rom_version(&rom_version, dev);
+    if (rslt == BHI360_OK)
+    {
+        rslt = bhi360_fw_verify(bhi360_firmware_image, len, rom_version, NULL);
+    }
+
     for (uint32_t i = 0; (i < len) && (rslt == BHI360_OK); i += incr)
     {
         if (incr > (len - i)) /* If last payload */
@@ -212,3 +279,4 @@ static int8_t upload_firmware(struct bhi360_dev *dev)
 
     return rslt;
 }
+#endif
@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2025 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file    logbin_dump.c
+ * @brief   Dump of BHI360 binary logs
+ *
+ */
+
+/*
+ * Prints the meta data of a log and its events as comma separated values:
+ *
+ *   logbin_dump <log> [<sensor ID> [<start s> <end s>]]
+ *
+ * Events of sensors with a known parse format are printed as scaled values, others in hex.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "bhi360_logbin_reader.h"
+
+static struct bhi360_logbin_reader reader;
+static struct bhi360_logbin_iter iter;
+static float values[LOGBIN_MAX_VALUES];
+
+int main(int argc, char *argv[])
+{
+    struct bhi360_logbin_event event;
+    uint16_t sensor_id = LOGBIN_ALL_SENSORS;
+    uint64_t start_time_ns = 0, end_time_ns = UINT64_MAX;
+    uint8_t count;
+
+    if ((argc != 2) && (argc != 3) && (argc != 5))
+    {
+        printf("Usage: %s <log> [<sensor ID> [<start s> <end s>]]. Exiting\n", argv[0]);
+        exit(-1);
+    }
+
+    if (!bhi360_logbin_open(argv[1], &reader))
+    {
+        printf("Could not read %s. Exiting\n", argv[1]);
+        exit(-1);
+    }
+
+    if (argc >= 3)
+    {
+        sensor_id = (uint16_t)(strtoul(argv[2], NULL, 0) & 0xFF);
+    }
+
+    if (argc == 5)
+    {
+        start_time_ns = (uint64_t)(strtod(argv[3], NULL) * 1e9);
+        end_time_ns = (uint64_t)(strtod(argv[4], NULL) * 1e9);
+    }
+
+    printf("# Version %s, %u chunks in the index\n",
+           (reader.format == LOGBIN_FORMAT_V2) ? LOGBIN_VERSION_2 : LOGBIN_VERSION,
+           reader.index_len);
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        if (reader.meta[i].valid)
+        {
+            printf("# %u: %s: %u: %s: %s: %g\n",
+                   i,
+                   reader.meta[i].name,
+                   reader.meta[i].event_size,
+                   reader.meta[i].parse_format,
+                   reader.meta[i].axis_names,
+                   reader.meta[i].scaling);
+        }
+    }
+
+    bhi360_logbin_iter_init(sensor_id, start_time_ns, end_time_ns, &reader, &iter);
+    while (bhi360_logbin_iter_next(&iter, &event))
+    {
+        printf("%u,%lu.%09lu",
+               event.sensor_id,
+               (unsigned long)(event.time_ns / UINT64_C(1000000000)),
+               (unsigned long)(event.time_ns % UINT64_C(1000000000)));
+
+        count = bhi360_logbin_get_values(&event, values, &reader);
+        if (count != 0)
+        {
+            for (uint8_t i = 0; i < count; i++)
+            {
+                printf(",%g", values[i]);
+            }
+        }
+        else
+        {
+            printf(",");
+            for (uint8_t i = 0; i < event.payload_size; i++)
+            {
+                printf("%02x", event.payload[i]);
+            }
+        }
+
+        printf("\n");
+    }
+
+    bhi360_logbin_close(&reader);
+
+    return 0;
+}
@@ -501,7 +501,7 @@ static void upload_firmware(uint8_t boot_stat, struct bhi360_dev *dev)
     uint8_t sensor_error;
 
     printf("Loading firmware into RAM.\r\n");
-    BHI360_ASSERT(bhi360_upload_firmware_to_ram(bhi360_firmware_image, sizeof(bhi360_firmware_image), dev));
+    BHI360_ASSERT(bhi360_upload_firmware_to_ram(bhi360_firmware_image, BHI360_FIRMWARE_IMAGE_LEN, dev));
     print_api_error(assert_rslt, dev);
     BHI360_ASSERT(bhi360_get_error_value(&sensor_error, dev));
     print_api_error(assert_rslt, dev);
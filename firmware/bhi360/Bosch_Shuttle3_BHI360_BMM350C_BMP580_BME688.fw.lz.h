@@ -0,0 +1,10534 @@
+/*
+ * Generated by fw2h from Bosch_Shuttle3_BHI360_BMM350C_BMP580_BME688.fw
+ *
+ * Section 0: version 2380, flags 0x0000, 86000 bytes, CRC 0xaae90fef, expects version 5166
+ * Section 1: version 9794, flags 0x0002, 61888 bytes, CRC 0x22a51b48, expects version 2380
+ *
+ * Compressed, see bhi360_fw_lz.h. The CRC and versions are those of the firmware
+ */
+
+#ifndef BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_H_
+#define BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_H_
+
+#include <stdint.h>
+
+#define BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_LEN UINT32_C(126044)
+#define BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_RAW_LEN UINT32_C(148136)
+#define BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_CRC UINT32_C(0x6c584a70)
+#define BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_ROM_VERSION UINT16_C(5166)
+#define BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_KERNEL_VERSION UINT16_C(2380)
+#define BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_USER_VERSION UINT16_C(9794)
+
+const unsigned char bhi360_fw_bosch_shuttle3_bhi360_bmm350c_bmp580_bme688_lz[] = {
+  0x4c, 0x5a, 0x01, 0x0b, 0xa8, 0x42, 0x02, 0x00, 0x50, 0xec, 0x01, 0x00, 
+  0xf0, 0x19, 0x2b, 0x66, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x09, 0x96, 0xf6, 
+  0x4e, 0x81, 0x3b, 0xcb, 0xa0, 0x82, 0x18, 0xcc, 0x49, 0x98, 0xed, 0x9a, 
+  0x57, 0x6e, 0xf9, 0x36, 0x18, 0x4e, 0x8a, 0x15, 0x43, 0x5e, 0x09, 0x55, 
+  0x97, 0xdc, 0x14, 0x82, 0x9a, 0xaa, 0x26, 0x00, 0xf0, 0x05, 0x60, 0xda, 
+  0xcf, 0x72, 0x1c, 0x32, 0x5c, 0xc4, 0x21, 0x0a, 0xd7, 0xe0, 0x7f, 0x65, 
+  0xbf, 0xcd, 0x6e, 0x5b, 0xee, 0x8b, 0x18, 0x00, 0xf0, 0x13, 0x40, 0xa2, 
+  0xa0, 0xfd, 0x05, 0x17, 0xee, 0x91, 0x05, 0x60, 0xee, 0xc2, 0xac, 0x97, 
+  0x70, 0xb5, 0xe8, 0x93, 0xe3, 0xa9, 0xf0, 0x4f, 0x01, 0x00, 0xef, 0x0f, 
+  0xe9, 0xaa, 0xdc, 0x39, 0x01, 0x00, 0x2e, 0x14, 0x26, 0x00, 0x32, 0x00, 
+  0x00, 0xf0, 0x07, 0x00, 0x01, 0x01, 0x00, 0xbf, 0x70, 0xbb, 0x7c, 0x77, 
+  0xb8, 0x7a, 0x13, 0x00, 0xd0, 0x29, 0x10, 0x04, 0x00, 0x0a, 0x2e, 0xdc, 
+  0x9a, 0x14, 0x00, 0x31, 0x84, 0x46, 0x01, 0x08, 0x00, 0x62, 0x98, 0x5f, 
+  0x12, 0x00, 0x0c, 0xb1, 0x14, 0x00, 0x26, 0x68, 0xb3, 0x04, 0x00, 0x62, 
+  0x80, 0x4d, 0x12, 0x00, 0x7c, 0x6d, 0x04, 0x00, 0xf1, 0x00, 0x64, 0xb6, 
+  0x10, 0x00, 0xec, 0xb6, 0x10, 0x00, 0x34, 0xb8, 0x10, 0x00, 0x40, 0x6a, 
+  0x12, 0x2c, 0x00, 0xa6, 0x2c, 0x1a, 0x10, 0x00, 0xc8, 0xb5, 0x10, 0x00, 
+  0x10, 0x15, 0x54, 0x00, 0xb5, 0xb8, 0x18, 0x10, 0x00, 0x6c, 0x19, 0x10, 
+  0x00, 0x24, 0x6e, 0x12, 0x04, 0x00, 0xf0, 0xd6, 0x8c, 0xca, 0x12, 0x00, 
+  0xc1, 0x02, 0xcf, 0xf2, 0x5d, 0x07, 0x4f, 0xf6, 0xf5, 0x04, 0x00, 0x01, 
+  0x59, 0x06, 0x00, 0x01, 0x4d, 0x06, 0xcf, 0xf7, 0x69, 0x06, 0xcf, 0xf7, 
+  0x85, 0x06, 0xcf, 0xf7, 0xd9, 0x07, 0xcf, 0xf7, 0xe5, 0x05, 0xcf, 0xf9, 
+  0x35, 0x06, 0xcf, 0xf9, 0x11, 0x07, 0xcf, 0xf9, 0xa1, 0x01, 0x0f, 0xfa, 
+  0xa9, 0x01, 0x0f, 0xfa, 0x95, 0x02, 0x0f, 0xfa, 0x09, 0x06, 0x0f, 0xfa, 
+  0xb1, 0x00, 0xc0, 0x07, 0x19, 0x01, 0x4f, 0xfa, 0xb5, 0x04, 0x4f, 0xfa, 
+  0xf5, 0x04, 0x4f, 0xfa, 0x5d, 0x05, 0x4f, 0xfa, 0x2d, 0x04, 0xc0, 0x00, 
+  0x59, 0x06, 0x4f, 0xfa, 0x71, 0x06, 0x4f, 0xfa, 0x95, 0x00, 0xc0, 0x07, 
+  0xb5, 0x01, 0x8f, 0xfa, 0xd9, 0x01, 0x8f, 0xfa, 0x0d, 0x01, 0xc0, 0x07, 
+  0x41, 0x02, 0x8f, 0xfa, 0x65, 0x03, 0x8f, 0xfa, 0xbd, 0x03, 0x8f, 0xfa, 
+  0x15, 0x04, 0x8f, 0xfa, 0x61, 0x04, 0x8f, 0xfa, 0x79, 0x04, 0x8f, 0xfa, 
+  0x29, 0x01, 0xc0, 0x07, 0xf9, 0x04, 0x8f, 0xfa, 0xd9, 0x05, 0x40, 0x01, 
+  0x4d, 0x06, 0x8f, 0xfa, 0x81, 0x07, 0x8f, 0xfa, 0xa5, 0x01, 0xcf, 0xfa, 
+  0xa5, 0x02, 0xcf, 0xfa, 0x6d, 0x03, 0xcf, 0xfa, 0x79, 0x06, 0xcf, 0xfa, 
+  0xb5, 0x02, 0x40, 0x01, 0x35, 0x00, 0x0f, 0xfb, 0x75, 0x00, 0x0f, 0xfb, 
+  0xa9, 0x00, 0x0f, 0xfb, 0xd9, 0x00, 0x0f, 0xfb, 0xe1, 0x00, 0x0f, 0xfb, 
+  0xed, 0x00, 0x0f, 0xfb, 0xf5, 0x00, 0x0f, 0xfb, 0x05, 0x01, 0x0f, 0xfb, 
+  0x49, 0x02, 0x0f, 0xfb, 0x4d, 0x02, 0x0f, 0xfb, 0x55, 0x02, 0x0f, 0xfb, 
+  0x65, 0x02, 0x0f, 0xfb, 0x75, 0x02, 0x0f, 0xfb, 0x81, 0x08, 0x00, 0xf0, 
+  0x45, 0x03, 0x0f, 0xfb, 0xad, 0x04, 0x0f, 0xfb, 0xd5, 0x04, 0x0f, 0xfb, 
+  0xed, 0x04, 0x0f, 0xfb, 0xf5, 0x04, 0x0f, 0xfb, 0x19, 0x05, 0x0f, 0xfb, 
+  0xc9, 0x03, 0x40, 0x01, 0x21, 0x06, 0x0f, 0xfb, 0x8d, 0x03, 0xc0, 0x07, 
+  0xd9, 0x06, 0x0f, 0xfb, 0x29, 0x01, 0x4f, 0xfb, 0x31, 0x05, 0xc0, 0x00, 
+  0x15, 0x02, 0x4f, 0xfb, 0xf1, 0x02, 0x4f, 0xfb, 0xad, 0x00, 0x80, 0x00, 
+  0x65, 0x00, 0x80, 0x00, 0xf5, 0x07, 0x40, 0x00, 0x39, 0x00, 0x80, 0x00, 
+  0x11, 0x00, 0x80, 0x00, 0x79, 0x00, 0x80, 0x00, 0xd9, 0x00, 0x80, 0x00, 
+  0xb5, 0x18, 0x00, 0xf0, 0xfd, 0x05, 0x4f, 0xfb, 0xb9, 0x06, 0x4f, 0xfb, 
+  0xfd, 0x06, 0x4f, 0xfb, 0x69, 0x03, 0x40, 0x01, 0x51, 0x06, 0x8f, 0xfb, 
+  0x29, 0x02, 0xcf, 0xfb, 0xb5, 0x02, 0x0f, 0xfc, 0x35, 0x04, 0x0f, 0xfc, 
+  0x81, 0x04, 0x0f, 0xfc, 0x8d, 0x04, 0x0f, 0xfc, 0x61, 0x05, 0x0f, 0xfc, 
+  0x0d, 0x01, 0x8f, 0xfd, 0xa1, 0x01, 0x8f, 0xfd, 0xb1, 0x01, 0x8f, 0xfd, 
+  0xc1, 0x01, 0x8f, 0xfd, 0x29, 0x02, 0x40, 0x01, 0x91, 0x03, 0x8f, 0xfd, 
+  0x09, 0x05, 0x8f, 0xfd, 0x71, 0x04, 0xc0, 0x00, 0x99, 0x00, 0xcf, 0xfd, 
+  0x05, 0x04, 0xc0, 0x00, 0x51, 0x02, 0x0f, 0xef, 0xbd, 0x04, 0xcf, 0xfd, 
+  0x25, 0x05, 0xcf, 0xfd, 0x6d, 0x06, 0xcf, 0xfd, 0xa5, 0x06, 0xcf, 0xfd, 
+  0x5d, 0x07, 0xcf, 0xfd, 0xf5, 0x07, 0xcf, 0xfd, 0x29, 0x00, 0x0f, 0xfe, 
+  0xb9, 0x01, 0x40, 0x01, 0x11, 0x02, 0x0f, 0xfe, 0xa1, 0x02, 0x0f, 0xfe, 
+  0x39, 0x03, 0x0f, 0xfe, 0xc9, 0x03, 0x0f, 0xfe, 0xb1, 0x04, 0x0f, 0xfe, 
+  0x71, 0x07, 0x0f, 0xfe, 0xa5, 0x06, 0x80, 0x08, 0xfd, 0x07, 0x0f, 0xfe, 
+  0x0d, 0x00, 0x4f, 0xfe, 0x61, 0x00, 0x4f, 0xfe, 0xb5, 0x00, 0x4f, 0xfe, 
+  0xb9, 0x00, 0x4f, 0xfe, 0xcd, 0x00, 0x4f, 0xfe, 0xf5, 0x00, 0x4f, 0xfe, 
+  0x05, 0x02, 0x4f, 0xfe, 0xd9, 0x05, 0x8f, 0xfe, 0x65, 0x06, 0x8f, 0xfe, 
+  0x7d, 0x06, 0x8f, 0xfe, 0x75, 0x00, 0x40, 0x01, 0x35, 0x07, 0x8f, 0xfe, 
+  0x49, 0x07, 0x8f, 0xfe, 0x6d, 0x07, 0x8f, 0xfe, 0xe5, 0x07, 0x8f, 0xfe, 
+  0x15, 0x00, 0xcf, 0xfe, 0x9d, 0x00, 0xcf, 0xfe, 0xb5, 0x00, 0xcf, 0xfe, 
+  0xe5, 0x00, 0xcf, 0xfe, 0x59, 0x01, 0xcf, 0xfe, 0x05, 0x02, 0xcf, 0xfe, 
+  0x1d, 0x02, 0xcf, 0xfe, 0x51, 0x06, 0x80, 0x08, 0x5d, 0x06, 0x80, 0x08, 
+  0x69, 0x06, 0x80, 0x08, 0x35, 0x07, 0x80, 0x08, 0x4d, 0x02, 0xcf, 0xfe, 
+  0x9d, 0x02, 0xcf, 0xfe, 0xa5, 0x02, 0xcf, 0xfe, 0x7d, 0x10, 0x00, 0xf2, 
+  0x46, 0x03, 0xcf, 0xfe, 0xb5, 0x03, 0xcf, 0xfe, 0x19, 0x04, 0xcf, 0xfe, 
+  0x81, 0x04, 0xcf, 0xfe, 0xa9, 0x04, 0xcf, 0xfe, 0xc9, 0x07, 0x80, 0x08, 
+  0xf1, 0x07, 0x80, 0x08, 0xb1, 0x06, 0x00, 0x01, 0xd9, 0x06, 0xcf, 0xfe, 
+  0x99, 0x07, 0xcf, 0xfe, 0x95, 0x00, 0xc0, 0x08, 0xc9, 0x00, 0xc0, 0x08, 
+  0xf1, 0x00, 0xc0, 0x08, 0x7d, 0x00, 0x0f, 0xff, 0xbd, 0x00, 0x0f, 0xff, 
+  0x89, 0x05, 0x00, 0x01, 0x35, 0x02, 0xc0, 0x08, 0x81, 0x02, 0x0f, 0xff, 
+  0x85, 0x02, 0x0f, 0xff, 0xd5, 0x02, 0xc0, 0x00, 0xcd, 0x02, 0x0f, 0xff, 
+  0x19, 0x03, 0x04, 0x00, 0xf0, 0x36, 0x85, 0x05, 0x40, 0x00, 0x6d, 0x06, 
+  0x4f, 0xff, 0x35, 0x00, 0x8f, 0xff, 0x59, 0x02, 0xcf, 0xef, 0x0d, 0x03, 
+  0xcf, 0xef, 0xad, 0x03, 0xcf, 0xef, 0x01, 0x04, 0xcf, 0xef, 0x8d, 0x04, 
+  0xcf, 0xef, 0x9d, 0x04, 0xcf, 0xef, 0x11, 0x05, 0xcf, 0xef, 0x59, 0x05, 
+  0xcf, 0xef, 0x69, 0x05, 0xcf, 0xef, 0x1d, 0x01, 0x00, 0x02, 0x99, 0x01, 
+  0x00, 0x02, 0xad, 0x02, 0x00, 0x02, 0xad, 0x03, 0x00, 0x02, 0x75, 0x04, 
+  0x00, 0x02, 0xc5, 0x04, 0x00, 0xf3, 0x69, 0x05, 0x00, 0x02, 0x45, 0x06, 
+  0x00, 0x02, 0x7d, 0x03, 0x0f, 0xf0, 0x45, 0x07, 0x00, 0x02, 0x61, 0x00, 
+  0x40, 0x02, 0x91, 0x00, 0x40, 0x02, 0x65, 0x01, 0x40, 0x02, 0x49, 0x03, 
+  0x40, 0x02, 0x31, 0x00, 0x4f, 0xf0, 0x5d, 0x01, 0x4f, 0xf0, 0x09, 0x02, 
+  0x8f, 0xf0, 0x51, 0x07, 0x8f, 0xf0, 0x21, 0x00, 0xcf, 0xf0, 0x45, 0x00, 
+  0xcf, 0xf0, 0xb1, 0x01, 0xcf, 0xf0, 0xfd, 0x06, 0xcf, 0xf0, 0x05, 0x07, 
+  0xcf, 0xf0, 0xdd, 0x00, 0x0f, 0xf1, 0xe9, 0x00, 0x0f, 0xf1, 0xdd, 0x03, 
+  0x40, 0x02, 0x79, 0x05, 0x0f, 0xf1, 0x31, 0x06, 0x0f, 0xf1, 0x39, 0x06, 
+  0x0f, 0xf1, 0x49, 0x06, 0x0f, 0xf1, 0x2d, 0x00, 0x4f, 0xf1, 0x81, 0x00, 
+  0x4f, 0xf1, 0x6d, 0x04, 0x80, 0x02, 0xe1, 0x05, 0x80, 0x02, 0x51, 0x06, 
+  0x80, 0x02, 0xd9, 0x06, 0x80, 0x02, 0xf9, 0x04, 0x00, 0xf3, 0x1a, 0x6d, 
+  0x07, 0x80, 0x02, 0xb9, 0x07, 0x80, 0x02, 0x85, 0x04, 0x4f, 0xf1, 0x6d, 
+  0x07, 0x4f, 0xf1, 0x71, 0x07, 0x4f, 0xf1, 0x79, 0x07, 0x4f, 0xf1, 0x7d, 
+  0x07, 0x4f, 0xf1, 0x81, 0x07, 0x4f, 0xf1, 0x9d, 0x07, 0x4f, 0xf1, 0xad, 
+  0x07, 0x4f, 0xf1, 0xb1, 0x04, 0x00, 0xf0, 0x49, 0x49, 0x01, 0x8f, 0xf1, 
+  0xa1, 0x01, 0x8f, 0xf1, 0xdd, 0x01, 0x8f, 0xf1, 0x7d, 0x02, 0x8f, 0xf1, 
+  0x79, 0x03, 0x8f, 0xf1, 0x05, 0x04, 0x8f, 0xf1, 0x19, 0x00, 0xc0, 0x02, 
+  0xc9, 0x06, 0x8f, 0xf1, 0x61, 0x07, 0x8f, 0xf1, 0xf9, 0x07, 0x8f, 0xf1, 
+  0xd5, 0x00, 0xcf, 0xf1, 0x99, 0x02, 0xcf, 0xf1, 0xa1, 0x02, 0xcf, 0xf1, 
+  0xbd, 0x03, 0xcf, 0xf1, 0xf1, 0x01, 0xc0, 0x02, 0x61, 0x02, 0xc0, 0x02, 
+  0xd5, 0x02, 0xc0, 0x02, 0x8d, 0x04, 0xc0, 0x02, 0x39, 0x05, 0xc0, 0x02, 
+  0xfd, 0x05, 0xc0, 0x02, 0xb1, 0x06, 0xc0, 0x02, 0x49, 0x01, 0x00, 0x03, 
+  0x04, 0x00, 0xf2, 0x27, 0x95, 0x01, 0x00, 0x03, 0x31, 0x02, 0x00, 0x03, 
+  0xa5, 0x02, 0x00, 0x03, 0xe1, 0x02, 0x00, 0x03, 0x69, 0x03, 0x00, 0x03, 
+  0x8d, 0x03, 0x00, 0x03, 0xcd, 0x03, 0x00, 0x03, 0x05, 0x05, 0x00, 0x03, 
+  0x79, 0x05, 0x00, 0x03, 0xd1, 0x06, 0x00, 0x03, 0xf9, 0x07, 0x00, 0x03, 
+  0xed, 0x00, 0x40, 0x03, 0xdd, 0x01, 0x40, 0x03, 0x21, 0x07, 0x04, 0x00, 
+  0xf0, 0x69, 0x51, 0x07, 0x40, 0x03, 0x19, 0x00, 0x80, 0x03, 0x8d, 0x00, 
+  0x80, 0x03, 0xdd, 0x00, 0x80, 0x03, 0x09, 0x06, 0x8f, 0xf2, 0x21, 0x06, 
+  0x8f, 0xf2, 0xfd, 0x07, 0xcf, 0xf2, 0x49, 0x00, 0x0f, 0xf3, 0x4d, 0x01, 
+  0x0f, 0xf3, 0x71, 0x01, 0x0f, 0xf3, 0x81, 0x01, 0x0f, 0xf3, 0xb5, 0x01, 
+  0x0f, 0xf3, 0xb9, 0x01, 0x0f, 0xf3, 0xc5, 0x01, 0x0f, 0xf3, 0x11, 0x02, 
+  0x0f, 0xf3, 0x69, 0x03, 0x80, 0x03, 0x99, 0x03, 0x80, 0x03, 0x51, 0x04, 
+  0x80, 0x03, 0x89, 0x05, 0x80, 0x03, 0x0d, 0x06, 0x80, 0x03, 0x7d, 0x06, 
+  0x80, 0x03, 0xd5, 0x06, 0x80, 0x03, 0xf1, 0x06, 0x80, 0x03, 0x55, 0x07, 
+  0x80, 0x03, 0xf5, 0x01, 0xc0, 0x03, 0x25, 0x03, 0xc0, 0x03, 0xe5, 0x05, 
+  0xc0, 0x03, 0xb1, 0x06, 0xc0, 0x03, 0x29, 0x07, 0xc0, 0x03, 0x29, 0x00, 
+  0x00, 0x04, 0x04, 0x00, 0xf2, 0x5f, 0xc5, 0x02, 0x00, 0x04, 0xdd, 0x04, 
+  0x8f, 0xf3, 0x59, 0x05, 0x8f, 0xf3, 0x09, 0x06, 0x8f, 0xf3, 0x6d, 0x06, 
+  0x8f, 0xf3, 0x7d, 0x06, 0x8f, 0xf3, 0xfd, 0x06, 0x8f, 0xf3, 0x11, 0x07, 
+  0x8f, 0xf3, 0x85, 0x07, 0x8f, 0xf3, 0x35, 0x06, 0x00, 0x04, 0xfd, 0x06, 
+  0x00, 0x04, 0x45, 0x01, 0x40, 0x04, 0x05, 0x03, 0x40, 0x04, 0x9d, 0x03, 
+  0x40, 0x04, 0xf5, 0x04, 0x40, 0x04, 0x59, 0x05, 0x40, 0x04, 0xc1, 0x00, 
+  0x80, 0x04, 0x6d, 0x05, 0x80, 0x04, 0x09, 0x06, 0x80, 0x04, 0x41, 0x07, 
+  0x80, 0x04, 0xad, 0x01, 0xc0, 0x04, 0xe9, 0x01, 0xc0, 0x04, 0xf5, 0x03, 
+  0xc0, 0x04, 0xa9, 0x06, 0xc0, 0x04, 0x11, 0x07, 0xc0, 0x04, 0x6d, 0x00, 
+  0x00, 0x05, 0x35, 0x01, 0x00, 0x05, 0xb5, 0x02, 0x04, 0x00, 0xf1, 0x44, 
+  0x51, 0x03, 0x00, 0x05, 0x6d, 0x03, 0x00, 0x05, 0x45, 0x05, 0x00, 0x05, 
+  0x01, 0x00, 0x40, 0x05, 0xe5, 0x00, 0x40, 0x05, 0x21, 0x03, 0x40, 0x05, 
+  0x01, 0x01, 0x0f, 0xf5, 0x4d, 0x01, 0x0f, 0xf5, 0xe5, 0x02, 0x0f, 0xf5, 
+  0x09, 0x03, 0x0f, 0xf5, 0x19, 0x03, 0x0f, 0xf5, 0xcd, 0x03, 0x0f, 0xf5, 
+  0xd1, 0x03, 0x0f, 0xf5, 0xdd, 0x03, 0x0f, 0xf5, 0xb1, 0x04, 0x0f, 0xf5, 
+  0x3d, 0x05, 0x40, 0x05, 0xc5, 0x05, 0x40, 0x05, 0x61, 0x06, 0x40, 0x05, 
+  0xc5, 0x06, 0x40, 0x05, 0xf9, 0x07, 0x40, 0x05, 0x65, 0x00, 0x80, 0x04, 
+  0x00, 0xf0, 0xff, 0xf6, 0x75, 0x00, 0x80, 0x05, 0xf1, 0x00, 0x80, 0x05, 
+  0x49, 0x02, 0x80, 0x05, 0xcd, 0x00, 0xcf, 0xf5, 0xe1, 0x00, 0xcf, 0xf5, 
+  0x31, 0x01, 0xcf, 0xf5, 0xfd, 0x01, 0xcf, 0xf5, 0xed, 0x02, 0xcf, 0xf5, 
+  0x81, 0x03, 0xcf, 0xf5, 0xe9, 0x03, 0xcf, 0xf5, 0x45, 0x04, 0xcf, 0xf5, 
+  0x25, 0x05, 0xcf, 0xf5, 0xed, 0x01, 0x0f, 0xf6, 0x09, 0x02, 0x0f, 0xf6, 
+  0x85, 0x02, 0x0f, 0xf6, 0xc1, 0x02, 0x0f, 0xf6, 0xf9, 0x02, 0x0f, 0xf6, 
+  0x25, 0x07, 0x4f, 0xf6, 0x7d, 0x07, 0x4f, 0xf6, 0xc1, 0x07, 0x4f, 0xf6, 
+  0x55, 0x00, 0x8f, 0xf6, 0xc5, 0x01, 0x8f, 0xf6, 0x39, 0x02, 0x8f, 0xf6, 
+  0x49, 0x02, 0x8f, 0xf6, 0xe9, 0x02, 0x8f, 0xf6, 0xf1, 0x02, 0x8f, 0xf6, 
+  0xbd, 0x03, 0x8f, 0xf6, 0x71, 0x04, 0x8f, 0xf6, 0x1d, 0x05, 0x8f, 0xf6, 
+  0x05, 0x00, 0xcf, 0xf6, 0x85, 0x00, 0xcf, 0xf6, 0x95, 0x00, 0xcf, 0xf6, 
+  0x7d, 0x01, 0xcf, 0xf6, 0x85, 0x01, 0xcf, 0xf6, 0xa9, 0x02, 0xcf, 0xf6, 
+  0xd9, 0x02, 0xcf, 0xf6, 0xa5, 0x03, 0xcf, 0xf6, 0xcd, 0x05, 0xcf, 0xf6, 
+  0x61, 0x06, 0xcf, 0xf6, 0x71, 0x06, 0xcf, 0xf6, 0x29, 0x07, 0xcf, 0xf6, 
+  0x31, 0x07, 0xcf, 0xf6, 0x21, 0x00, 0x0f, 0xf7, 0xe1, 0x00, 0x0f, 0xf7, 
+  0x65, 0x01, 0x0f, 0xf7, 0x21, 0x03, 0x0f, 0xf7, 0x4d, 0x03, 0x0f, 0xf7, 
+  0xb1, 0x03, 0x0f, 0xf7, 0xc1, 0x03, 0x0f, 0xf7, 0x91, 0x04, 0x0f, 0xf7, 
+  0xad, 0x04, 0x0f, 0xf7, 0xb1, 0x05, 0x0f, 0xf7, 0x21, 0x06, 0x0f, 0xf7, 
+  0x81, 0x06, 0x0f, 0xf7, 0x91, 0x07, 0x0f, 0xf7, 0xe5, 0x07, 0x0f, 0xf7, 
+  0x05, 0x00, 0x4f, 0xf7, 0xa1, 0x00, 0x4f, 0xf7, 0xb1, 0x00, 0x4f, 0xf7, 
+  0x61, 0x01, 0x4f, 0xf7, 0x75, 0x01, 0x4f, 0xf7, 0xa1, 0x01, 0x4f, 0xf7, 
+  0xc5, 0x01, 0x4f, 0xf7, 0x19, 0x02, 0x4f, 0xf7, 0x89, 0x02, 0x4f, 0xf7, 
+  0xc1, 0x02, 0x4f, 0xf7, 0xf1, 0x02, 0x4f, 0xf7, 0x5d, 0x03, 0x4f, 0xf7, 
+  0xdd, 0x04, 0x4f, 0xf7, 0x35, 0x05, 0x4f, 0xf7, 0x45, 0x05, 0x4f, 0xf7, 
+  0x09, 0x06, 0x4f, 0xf7, 0x19, 0x06, 0x4f, 0xf7, 0xf5, 0x06, 0x4f, 0xf7, 
+  0x8d, 0x05, 0x8f, 0xf7, 0xa5, 0x05, 0x8f, 0xf7, 0x1d, 0x07, 0x8f, 0xf7, 
+  0x5d, 0x07, 0x8f, 0xf7, 0xdd, 0x00, 0xcf, 0xf7, 0x7d, 0x01, 0xcf, 0xf7, 
+  0xd9, 0x06, 0x80, 0x05, 0x8d, 0x07, 0x80, 0x05, 0x1d, 0x05, 0xcf, 0xf7, 
+  0xdd, 0x05, 0xcf, 0xf7, 0x35, 0x01, 0xc0, 0x05, 0xe9, 0x03, 0xc0, 0x05, 
+  0x51, 0x00, 0x0f, 0xf8, 0xa1, 0x00, 0x0f, 0xf8, 0x39, 0x01, 0x0f, 0xf8, 
+  0x11, 0x02, 0x0f, 0xf8, 0x79, 0x02, 0x0f, 0xf8, 0x81, 0x04, 0xc0, 0x05, 
+  0x15, 0x07, 0xc0, 0x05, 0x61, 0x07, 0xc0, 0x05, 0xfd, 0x07, 0xc0, 0x05, 
+  0x85, 0x00, 0x00, 0x06, 0xa9, 0x00, 0x00, 0x06, 0x3d, 0x00, 0x4f, 0xf8, 
+  0x45, 0x00, 0x4f, 0xf8, 0x59, 0x00, 0x4f, 0xf8, 0xbd, 0x01, 0x00, 0x06, 
+  0x51, 0x01, 0x4f, 0xf8, 0x85, 0x03, 0x00, 0x06, 0x69, 0x05, 0x00, 0x06, 
+  0x55, 0x02, 0x40, 0x06, 0x89, 0x00, 0x8f, 0xf8, 0x3d, 0x03, 0x40, 0x06, 
+  0x01, 0x01, 0x8f, 0xf8, 0x45, 0x01, 0x8f, 0xf8, 0xad, 0x01, 0x8f, 0xf8, 
+  0x21, 0x02, 0x8f, 0xf8, 0x71, 0x02, 0x8f, 0xf8, 0xc1, 0x02, 0x8f, 0xf8, 
+  0xdd, 0x02, 0x8f, 0xf8, 0xed, 0x02, 0x8f, 0xf8, 0x35, 0x03, 0x8f, 0xf8, 
+  0xe1, 0x03, 0x8f, 0xf8, 0xf1, 0x03, 0x8f, 0xf8, 0xf5, 0x03, 0x8f, 0xf8, 
+  0x21, 0x04, 0x8f, 0xf8, 0x3d, 0x04, 0x8f, 0xf8, 0x65, 0x04, 0x8f, 0xf8, 
+  0x79, 0x04, 0x8f, 0xf8, 0xe5, 0x04, 0xc0, 0x06, 0x91, 0x05, 0xc0, 0x06, 
+  0xfd, 0x00, 0x0f, 0xf9, 0xb5, 0x01, 0x0f, 0xf9, 0xb5, 0x05, 0xc0, 0x06, 
+  0x95, 0x02, 0x00, 0x07, 0x04, 0x00, 0xf2, 0x0b, 0xbd, 0x02, 0x00, 0x07, 
+  0x4d, 0x05, 0x00, 0x07, 0x19, 0x04, 0x8f, 0xf9, 0xb9, 0x04, 0x8f, 0xf9, 
+  0xc9, 0x04, 0x8f, 0xf9, 0xf9, 0x04, 0x8f, 0xf9, 0x09, 0x05, 0x04, 0x00, 
+  0xf1, 0x84, 0xcd, 0x06, 0x40, 0x07, 0xd1, 0x05, 0x8f, 0xf9, 0xed, 0x06, 
+  0x8f, 0xf9, 0x0d, 0x07, 0x40, 0x07, 0x55, 0x03, 0xcf, 0xf9, 0x45, 0x07, 
+  0x40, 0x07, 0x81, 0x03, 0xcf, 0xf9, 0xed, 0x03, 0xcf, 0xf9, 0x29, 0x04, 
+  0xcf, 0xf9, 0xcd, 0x07, 0x40, 0x07, 0xe5, 0x07, 0x40, 0x07, 0x69, 0x04, 
+  0xcf, 0xf9, 0xfd, 0x07, 0x40, 0x07, 0x1d, 0x00, 0x80, 0x07, 0xfd, 0x04, 
+  0xcf, 0xf9, 0x31, 0x00, 0x80, 0x07, 0x49, 0x00, 0x80, 0x07, 0x41, 0x05, 
+  0xcf, 0xf9, 0x5d, 0x00, 0x80, 0x07, 0x65, 0x05, 0xcf, 0xf9, 0x75, 0x05, 
+  0xcf, 0xf9, 0x89, 0x05, 0xcf, 0xf9, 0x9d, 0x05, 0xcf, 0xf9, 0xc1, 0x05, 
+  0xcf, 0xf9, 0xe1, 0x05, 0xcf, 0xf9, 0xb9, 0x06, 0xcf, 0xf9, 0x01, 0x07, 
+  0xcf, 0xf9, 0x19, 0x07, 0xcf, 0xf9, 0x4d, 0x07, 0xcf, 0xf9, 0x95, 0x07, 
+  0xcf, 0xf9, 0x71, 0x00, 0x80, 0x07, 0x89, 0x00, 0x80, 0x07, 0x3d, 0x06, 
+  0x0f, 0xfa, 0x89, 0x07, 0x0f, 0xfa, 0xe1, 0x07, 0x0f, 0xfa, 0xf9, 0x07, 
+  0x0f, 0xfa, 0x2d, 0x00, 0x4f, 0x04, 0x00, 0x51, 0xd5, 0x00, 0x80, 0x07, 
+  0xed, 0x68, 0x00, 0xf0, 0x00, 0x8f, 0xfa, 0x15, 0x05, 0x8f, 0xfa, 0x41, 
+  0x05, 0x8f, 0xfa, 0xb9, 0x01, 0x80, 0x07, 0xd5, 0x04, 0x00, 0xf0, 0x88, 
+  0x05, 0x8f, 0xfa, 0x51, 0x07, 0x8f, 0xfa, 0x69, 0x07, 0x8f, 0xfa, 0x9d, 
+  0x07, 0x8f, 0xfa, 0xc5, 0x03, 0x80, 0x07, 0x0d, 0x06, 0xcf, 0xfa, 0x25, 
+  0x06, 0xcf, 0xfa, 0x5d, 0x06, 0xcf, 0xfa, 0x4d, 0x01, 0x8f, 0xfb, 0x65, 
+  0x01, 0x8f, 0xfb, 0x89, 0x03, 0xcf, 0xfb, 0x91, 0x03, 0xcf, 0xfb, 0xc5, 
+  0x03, 0xcf, 0xfb, 0x59, 0x06, 0xcf, 0xfb, 0x71, 0x06, 0xcf, 0xfb, 0xa9, 
+  0x06, 0xcf, 0xfb, 0xc1, 0x06, 0xcf, 0xfb, 0xfd, 0x06, 0xcf, 0xfb, 0x15, 
+  0x07, 0xcf, 0xfb, 0x49, 0x07, 0xcf, 0xfb, 0x65, 0x07, 0xcf, 0xfb, 0x05, 
+  0x00, 0x0f, 0xfc, 0x6d, 0x00, 0x0f, 0xfc, 0x9d, 0x00, 0x0f, 0xfc, 0xed, 
+  0x00, 0x0f, 0xfc, 0xf9, 0x00, 0x0f, 0xfc, 0x4d, 0x01, 0x0f, 0xfc, 0xb1, 
+  0x01, 0x0f, 0xfc, 0x89, 0x01, 0xc0, 0x07, 0x29, 0x03, 0xc0, 0x07, 0x45, 
+  0x03, 0x0f, 0xfc, 0x81, 0x03, 0x0f, 0xfc, 0xcd, 0x03, 0x0f, 0xfc, 0x21, 
+  0x03, 0xc0, 0x07, 0x55, 0x03, 0xc0, 0x07, 0x21, 0x05, 0xc0, 0x07, 0xb9, 
+  0x06, 0x0f, 0xfc, 0xc9, 0x06, 0x0f, 0xfc, 0x0c, 0x00, 0xf0, 0x4a, 0x81, 
+  0x05, 0xc0, 0x07, 0x49, 0x07, 0x0f, 0xfc, 0x59, 0x07, 0x0f, 0xfc, 0x69, 
+  0x01, 0x4f, 0xfc, 0x71, 0x01, 0x4f, 0xfc, 0x81, 0x01, 0x4f, 0xfc, 0x9d, 
+  0x01, 0x4f, 0xfc, 0x95, 0x05, 0xc0, 0x07, 0xd5, 0x01, 0x4f, 0xfc, 0xd9, 
+  0x01, 0x4f, 0xfc, 0xe9, 0x01, 0x4f, 0xfc, 0x75, 0x02, 0x4f, 0xfc, 0xed, 
+  0x05, 0xc0, 0x07, 0xc9, 0x04, 0x4f, 0xfc, 0xe1, 0x04, 0x4f, 0xfc, 0x7d, 
+  0x05, 0x4f, 0xfc, 0x25, 0x06, 0x4f, 0xfc, 0x19, 0x07, 0x4f, 0xfc, 0xcd, 
+  0x07, 0xc0, 0x07, 0xe5, 0x00, 0x8f, 0xfc, 0xd5, 0x07, 0xc0, 0x07, 0xf5, 
+  0x00, 0x8f, 0xfc, 0xdd, 0x08, 0x00, 0xf0, 0x12, 0x01, 0x8f, 0xfc, 0x8d, 
+  0x00, 0x00, 0x08, 0xf1, 0x03, 0x8f, 0xfc, 0x91, 0x04, 0x8f, 0xfc, 0x75, 
+  0x02, 0x00, 0x08, 0x2d, 0x03, 0x00, 0x08, 0xdd, 0x05, 0x00, 0x08, 0xf1, 
+  0x05, 0x00, 0x08, 0x21, 0x07, 0x28, 0x00, 0xf0, 0x9d, 0x8f, 0xfc, 0xed, 
+  0x02, 0xcf, 0xfc, 0x61, 0x04, 0xcf, 0xfc, 0x65, 0x04, 0xcf, 0xfc, 0xb5, 
+  0x04, 0xcf, 0xfc, 0xbd, 0x04, 0xcf, 0xfc, 0xd9, 0x04, 0xcf, 0xfc, 0x15, 
+  0x05, 0xcf, 0xfc, 0x1d, 0x05, 0xcf, 0xfc, 0x85, 0x06, 0xcf, 0xfc, 0xd9, 
+  0x01, 0x40, 0x08, 0x6d, 0x00, 0x0f, 0xfd, 0xe5, 0x01, 0x40, 0x08, 0x19, 
+  0x02, 0x0f, 0xfd, 0x31, 0x02, 0x0f, 0xfd, 0x75, 0x02, 0x0f, 0xfd, 0x51, 
+  0x02, 0x40, 0x08, 0xed, 0x03, 0x0f, 0xfd, 0x05, 0x04, 0x0f, 0xfd, 0x31, 
+  0x04, 0x0f, 0xfd, 0xa9, 0x05, 0x0f, 0xfd, 0x55, 0x00, 0x4f, 0xfd, 0x6d, 
+  0x00, 0x4f, 0xfd, 0xe5, 0x00, 0x4f, 0xfd, 0x95, 0x01, 0x4f, 0xfd, 0x9d, 
+  0x01, 0x4f, 0xfd, 0xb1, 0x01, 0x4f, 0xfd, 0xc9, 0x01, 0x4f, 0xfd, 0xad, 
+  0x03, 0x4f, 0xfd, 0x49, 0x02, 0x8f, 0xfd, 0x61, 0x02, 0x8f, 0xfd, 0x2d, 
+  0x03, 0x40, 0x08, 0x01, 0x04, 0x8f, 0xfd, 0x19, 0x04, 0x8f, 0xfd, 0xc9, 
+  0x05, 0x8f, 0xfd, 0xd5, 0x04, 0xcf, 0xfd, 0xed, 0x04, 0xcf, 0xfd, 0xb5, 
+  0x02, 0x0f, 0xfe, 0x9d, 0x03, 0x8f, 0xfe, 0xb5, 0x03, 0x8f, 0xfe, 0x75, 
+  0x00, 0x0f, 0xff, 0x8d, 0x00, 0x0f, 0xff, 0x59, 0x02, 0x0f, 0xff, 0x71, 
+  0x02, 0x08, 0x00, 0xf0, 0x2e, 0x8f, 0xff, 0xb5, 0x02, 0x8f, 0xff, 0xd9, 
+  0x00, 0x00, 0x04, 0xf1, 0x06, 0x0f, 0xf6, 0xcd, 0x01, 0x00, 0x01, 0xfd, 
+  0x00, 0x4f, 0xf6, 0x31, 0x02, 0x00, 0x01, 0x15, 0x03, 0x80, 0x05, 0xdd, 
+  0x05, 0xcf, 0xf8, 0xed, 0x06, 0xcf, 0xf8, 0x41, 0x02, 0x4f, 0xf9, 0x4d, 
+  0x02, 0x4f, 0xf9, 0xad, 0x06, 0x00, 0x07, 0xed, 0x07, 0x80, 0x00, 0xb5, 
+  0x06, 0x8f, 0xf9, 0xfd, 0x06, 0x8f, 0x50, 0x02, 0xf0, 0x90, 0xfa, 0xf9, 
+  0x04, 0x00, 0x00, 0x11, 0x02, 0x00, 0x01, 0x29, 0x04, 0x80, 0x07, 0x79, 
+  0x01, 0x00, 0x01, 0xc5, 0x01, 0x00, 0x01, 0x91, 0x01, 0x00, 0x01, 0x45, 
+  0x04, 0x80, 0x07, 0xdd, 0x04, 0x80, 0x07, 0xa1, 0x00, 0x8f, 0xfb, 0x2d, 
+  0x06, 0x80, 0x07, 0xad, 0x02, 0x8f, 0xfb, 0xe9, 0x02, 0x0f, 0xfd, 0xf9, 
+  0x02, 0x0f, 0xfd, 0x99, 0x01, 0xc0, 0x09, 0x05, 0x03, 0x4f, 0xfd, 0x35, 
+  0x01, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0xfd, 0x03, 0x8f, 0xfd, 0x2d, 
+  0x02, 0xcf, 0xee, 0x65, 0x04, 0x8f, 0xfd, 0xf5, 0x04, 0x8f, 0xfd, 0xf9, 
+  0x06, 0xcf, 0xfd, 0x99, 0x05, 0x0f, 0xfe, 0x45, 0x07, 0x4f, 0xfe, 0xe1, 
+  0x05, 0x40, 0x08, 0x01, 0x06, 0x40, 0x08, 0x09, 0x00, 0x00, 0x00, 0x85, 
+  0x00, 0x00, 0x00, 0xe2, 0xc2, 0x08, 0x45, 0x01, 0x80, 0x68, 0x40, 0x84, 
+  0x20, 0x03, 0x0c, 0x19, 0x08, 0x31, 0x04, 0x48, 0x41, 0x0e, 0x8d, 0x00, 
+  0x15, 0x06, 0x10, 0x21, 0x42, 0x1d, 0x78, 0x4a, 0x0e, 0x6f, 0xfb, 0x01, 
+  0x43, 0xc2, 0xc6, 0x28, 0x4d, 0x4c, 0x70, 0x02, 0x08, 0xe0, 0x00, 0x08, 
+  0x43, 0x1a, 0x00, 0xa0, 0x00, 0x41, 0x61, 0x40, 0x21, 0x42, 0xfa, 0x0a, 
+  0x2f, 0xf6, 0x1c, 0x00, 0x0f, 0x40, 0x00, 0x09, 0x26, 0xee, 0x0d, 0x40, 
+  0x00, 0x39, 0xc2, 0x0f, 0xa0, 0x40, 0x00, 0x1f, 0xce, 0x40, 0x00, 0x0a, 
+  0x11, 0x07, 0x40, 0x00, 0x17, 0x1e, 0x80, 0x00, 0x13, 0x82, 0x40, 0x00, 
+  0x13, 0x07, 0x40, 0x00, 0x4f, 0x8a, 0x0a, 0xe0, 0x00, 0x40, 0x00, 0x0d, 
+  0x17, 0xa6, 0x80, 0x00, 0x1b, 0x42, 0x40, 0x00, 0x1f, 0x62, 0x40, 0x00, 
+  0x0a, 0x02, 0xc0, 0x00, 0x25, 0xe2, 0x0a, 0x40, 0x00, 0x2c, 0x71, 0x02, 
+  0xc0, 0x00, 0x1f, 0x09, 0xc0, 0x00, 0x0f, 0x17, 0xbe, 0x40, 0x00, 0x2a, 
+  0xc2, 0x0e, 0x80, 0x00, 0x22, 0xfa, 0x09, 0x80, 0x00, 0xfa, 0x11, 0xf1, 
+  0xc0, 0x81, 0x80, 0x84, 0x24, 0x03, 0x1c, 0x11, 0x0c, 0x31, 0x14, 0x00, 
+  0x10, 0x05, 0x00, 0x0e, 0x88, 0x1d, 0x78, 0x9e, 0x5a, 0x04, 0xf0, 0x10, 
+  0xe0, 0x8e, 0x5a, 0xd1, 0xc0, 0xe0, 0x7e, 0x20, 0x00, 0x11, 0x06, 0x20, 
+  0x00, 0x11, 0xa0, 0x20, 0x00, 0x1f, 0x8f, 0x20, 0x00, 0x06, 0x11, 0x9f, 
+  0x20, 0x00, 0x1f, 0x90, 0x20, 0x00, 0x06, 0x11, 0x9c, 0x20, 0x00, 0x11, 
+  0x8d, 0x20, 0x00, 0xf0, 0x4d, 0xfc, 0x1c, 0x88, 0xb7, 0xe1, 0xc0, 0xe1, 
+  0xc1, 0xe1, 0xc2, 0xe1, 0xc3, 0xfc, 0x1c, 0x08, 0xb1, 0xfc, 0x1c, 0x48, 
+  0xb1, 0xfc, 0x1c, 0x88, 0xb1, 0xfc, 0x1c, 0xc8, 0xb1, 0xfc, 0x1c, 0x08, 
+  0xb2, 0xfc, 0x1c, 0x48, 0xb2, 0xfc, 0x1c, 0x88, 0xb2, 0xfc, 0x1c, 0xc8, 
+  0xb2, 0xe1, 0xc4, 0xf1, 0xc0, 0xfc, 0x1c, 0x08, 0xbf, 0x6a, 0x20, 0x80, 
+  0x00, 0xe1, 0xc0, 0x6a, 0x20, 0xc0, 0x00, 0xe1, 0xc0, 0xc3, 0x40, 0xf0, 
+  0x00, 0x2d, 0x00, 0x00, 0x88, 0xc1, 0xb8, 0xf0, 0x26, 0x01, 0x70, 0xa0, 
+  0x00, 0xa4, 0x7e, 0x03, 0xe9, 0x40, 0x79, 0xc1, 0xc0, 0x6b, 0x20, 0xc0, 
+  0x00, 0x06, 0x00, 0xf0, 0x4d, 0x80, 0x00, 0xc1, 0xc0, 0x0a, 0x24, 0x00, 
+  0x70, 0xd1, 0xc0, 0xc1, 0xc4, 0x04, 0x14, 0x0b, 0x34, 0x04, 0x14, 0x0a, 
+  0x34, 0x04, 0x14, 0x09, 0x34, 0x04, 0x14, 0x08, 0x34, 0x04, 0x14, 0x07, 
+  0x34, 0x04, 0x14, 0x06, 0x34, 0x04, 0x14, 0x05, 0x34, 0x04, 0x14, 0x04, 
+  0x34, 0xc1, 0xc3, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1, 0xc0, 0x04, 0x14, 0x1e, 
+  0x34, 0x6f, 0x24, 0x3f, 0x00, 0xe4, 0xc2, 0x2f, 0x27, 0xbf, 0x03, 0x6f, 
+  0x23, 0x3f, 0x00, 0xcb, 0x45, 0xa0, 0x00, 0xa2, 0x42, 0x20, 0x8d, 0x06, 
+  0x21, 0x00, 0x00, 0x82, 0x0b, 0xaf, 0xee, 0x00, 0xad, 0x20, 0x8d, 0x14, 
+  0x70, 0x7c, 0x00, 0xf0, 0x35, 0x34, 0x00, 0x05, 0xf2, 0x7b, 0x00, 0x20, 
+  0x00, 0x33, 0xa8, 0xa0, 0xb9, 0x33, 0xa8, 0x20, 0xad, 0x00, 0x16, 0x80, 
+  0x70, 0xa0, 0x00, 0xa1, 0x42, 0x14, 0x70, 0x33, 0xf2, 0x00, 0x16, 0xc0, 
+  0x70, 0xa0, 0x00, 0xb0, 0x42, 0xcb, 0x44, 0xa0, 0x00, 0xa0, 0x42, 0x14, 
+  0x70, 0xc3, 0x43, 0xf0, 0x00, 0x40, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x40, 
+  0x8c, 0x6d, 0x71, 0xe5, 0xb8, 0x00, 0x2b, 0x80, 0x10, 0x2f, 0x27, 0xbf, 
+  0x00, 0x62, 0x00, 0xf1, 0x02, 0x12, 0xf4, 0x25, 0x83, 0x06, 0x79, 0x25, 
+  0xa3, 0x2f, 0x26, 0xbf, 0x00, 0x11, 0xf0, 0x2f, 0x27, 0x7f, 0x16, 0x00, 
+  0xf1, 0x04, 0x07, 0x83, 0x0f, 0x20, 0x80, 0x00, 0x07, 0xa3, 0x2f, 0x26, 
+  0x7f, 0x00, 0x0b, 0xf0, 0x25, 0x83, 0x25, 0x78, 0x05, 0x22, 0x00, 0x70, 
+  0x00, 0x8c, 0x00, 0x2b, 0x00, 0x10, 0x06, 0x0c, 0x00, 0xb0, 0x03, 0xc4, 
+  0xc6, 0xe6, 0xc1, 0xa3, 0xc1, 0x2f, 0x27, 0x3f, 0x02, 0x32, 0x00, 0xf1, 
+  0x48, 0x6f, 0x26, 0x3f, 0x04, 0x37, 0x88, 0x6d, 0x70, 0x34, 0x70, 0x0c, 
+  0xf2, 0x35, 0x88, 0x83, 0xe9, 0x36, 0x88, 0x44, 0x80, 0x05, 0xb9, 0x42, 
+  0x21, 0x01, 0x08, 0x3a, 0x62, 0x68, 0x8a, 0x74, 0x70, 0x8e, 0x00, 0x21, 
+  0x00, 0x80, 0xc4, 0xe7, 0x82, 0xc6, 0x82, 0xff, 0xd9, 0x5a, 0xdd, 0x18, 
+  0x1a, 0x80, 0x0f, 0x12, 0x00, 0xe8, 0xfb, 0x87, 0xa2, 0x40, 0xc6, 0x41, 
+  0xc7, 0x4f, 0x00, 0x20, 0x00, 0x42, 0xc1, 0xab, 0x25, 0x08, 0x1e, 0x00, 
+  0x16, 0x81, 0x70, 0xf0, 0x00, 0x35, 0x00, 0xc5, 0xb9, 0x34, 0x72, 0x10, 
+  0xf4, 0x6f, 0x27, 0x3f, 0x8e, 0x00, 0xf2, 0x05, 0xaa, 0x21, 0x5a, 0x00, 
+  0x4b, 0x21, 0x80, 0x83, 0x0b, 0xf2, 0x2f, 0x21, 0xbf, 0x0f, 0x00, 0x00, 
+  0x77, 0x00, 0x0b, 0xf0, 0x0a, 0x00, 0x35, 0xb7, 0x00, 0x05, 0x0a, 0x00, 
+  0x00, 0x82, 0x00, 0xf0, 0x03, 0x68, 0x8a, 0x02, 0xc1, 0x08, 0xeb, 0x8c, 
+  0x21, 0xc3, 0x8f, 0x04, 0xf4, 0x77, 0x88, 0x74, 0x70, 0xd7, 0xf5, 0x0c, 
+  0x00, 0xf1, 0x18, 0x6d, 0x71, 0x09, 0xf4, 0x27, 0x82, 0x0f, 0x09, 0x01, 
+  0x03, 0x01, 0xc1, 0x27, 0xa2, 0x00, 0xc1, 0x26, 0xa2, 0x2f, 0x26, 0x3f, 
+  0x02, 0x61, 0x40, 0xc6, 0xc5, 0xe0, 0x78, 0x14, 0x70, 0x7c, 0x00, 0x21, 
+  0x00, 0x00, 0x43, 0x2f, 0x27, 0x3f, 0x72, 0x01, 0x00, 0x46, 0x00, 0x40, 
+  0x22, 0xf0, 0x29, 0xf4, 0x50, 0x01, 0x01, 0x8a, 0x00, 0x46, 0xb8, 0x14, 
+  0x72, 0x0f, 0x8a, 0x00, 0x85, 0x20, 0x5a, 0x00, 0x4b, 0x20, 0x80, 0x83, 
+  0x0c, 0x8a, 0x00, 0x15, 0x0a, 0x80, 0x00, 0x19, 0x06, 0x8a, 0x00, 0xf0, 
+  0x03, 0x4c, 0x8b, 0x00, 0x81, 0x54, 0x70, 0xba, 0x07, 0xe2, 0xff, 0x8c, 
+  0x20, 0xc3, 0x8f, 0x2f, 0x26, 0x3f, 0x03, 0x08, 0x00, 0xf1, 0x05, 0x00, 
+  0x41, 0xca, 0x21, 0xe1, 0x08, 0x54, 0x70, 0xe0, 0x7f, 0xca, 0x20, 0x41, 
+  0x00, 0xe0, 0x7f, 0x23, 0xd8, 0xe8, 0xc3, 0x44, 0x01, 0x14, 0x04, 0x7c, 
+  0x00, 0x31, 0x2d, 0x90, 0xad, 0x44, 0x01, 0xf0, 0x06, 0x2b, 0x90, 0x83, 
+  0xe9, 0x2c, 0x90, 0x24, 0x77, 0x42, 0x80, 0x5a, 0x21, 0x01, 0x05, 0x3a, 
+  0x62, 0x2c, 0x8a, 0x34, 0x70, 0x94, 0x44, 0x01, 0xf0, 0x07, 0xc3, 0xc4, 
+  0x82, 0xa2, 0x82, 0xff, 0xdc, 0x08, 0x1a, 0x80, 0x0f, 0x13, 0x00, 0x34, 
+  0x3f, 0x64, 0xa2, 0x40, 0xc5, 0x41, 0xc6, 0x51, 0x42, 0x01, 0x58, 0xc4, 
+  0xab, 0x21, 0x08, 0x0e, 0x42, 0x01, 0x07, 0xb8, 0x00, 0x03, 0x42, 0x01, 
+  0x0f, 0xb8, 0x00, 0x0f, 0xf0, 0x07, 0x2c, 0x8a, 0x02, 0xc4, 0x09, 0xe9, 
+  0x8c, 0x24, 0xc3, 0x9f, 0x07, 0xf4, 0x2d, 0x90, 0x34, 0x70, 0xac, 0x07, 
+  0xe2, 0xff, 0x5a, 0xd9, 0x10, 0x00, 0xff, 0x0f, 0xad, 0x71, 0x0a, 0xf4, 
+  0x04, 0x82, 0x11, 0x08, 0xc1, 0x00, 0x01, 0xc0, 0x04, 0xa2, 0x00, 0xc0, 
+  0x02, 0xa2, 0x91, 0xd8, 0x67, 0x58, 0x2f, 0x26, 0x3f, 0x04, 0xa1, 0x40, 
+  0xc8, 0xc7, 0x30, 0x01, 0x15, 0x24, 0xe0, 0x7e, 0x6e, 0x00, 0x08, 0x0a, 
+  0x00, 0xf0, 0x07, 0xe0, 0x78, 0xf1, 0xc0, 0x02, 0x88, 0x17, 0x08, 0xbf, 
+  0x01, 0xf6, 0xd8, 0x02, 0x11, 0xc0, 0x00, 0x0d, 0x08, 0x32, 0x00, 0x0c, 
+  0x70, 0xa8, 0x03, 0xf0, 0x03, 0xf0, 0xd8, 0x92, 0x09, 0xaf, 0xf4, 0x2c, 
+  0x71, 0xe4, 0xc2, 0xc3, 0x42, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x43, 0x06, 
+  0x00, 0xfc, 0x07, 0x28, 0x45, 0xae, 0x0d, 0x6f, 0xf9, 0x08, 0x46, 0x4c, 
+  0x70, 0x6c, 0x70, 0xc1, 0x40, 0x32, 0x0b, 0x60, 0x08, 0xa1, 0x41, 0xc4, 
+  0xc6, 0x24, 0x00, 0x12, 0x8a, 0x24, 0x00, 0x10, 0x71, 0x24, 0x00, 0x1f, 
+  0x0e, 0x24, 0x00, 0x04, 0x12, 0x66, 0x24, 0x00, 0x10, 0x72, 0x24, 0x00, 
+  0x22, 0xea, 0x0a, 0x24, 0x00, 0x19, 0xe2, 0x24, 0x00, 0x10, 0x3e, 0x22, 
+  0x00, 0x60, 0x45, 0x4c, 0x73, 0x6c, 0x76, 0xca, 0x20, 0x00, 0x2d, 0x40, 
+  0xc2, 0x44, 0x00, 0x12, 0x22, 0x44, 0x00, 0x10, 0x74, 0x44, 0x00, 0x13, 
+  0xa6, 0x44, 0x00, 0x0c, 0x24, 0x00, 0x21, 0xfe, 0x0c, 0x24, 0x00, 0x10, 
+  0x75, 0x24, 0x00, 0x17, 0x82, 0x24, 0x00, 0xd2, 0x13, 0x00, 0xd4, 0x79, 
+  0xc3, 0x43, 0x13, 0x00, 0xd8, 0x79, 0x28, 0x45, 0xda, 0x24, 0x00, 0x10, 
+  0x76, 0x24, 0x00, 0x1f, 0x5e, 0x48, 0x00, 0x04, 0x11, 0xb6, 0x24, 0x00, 
+  0x20, 0x07, 0xda, 0x24, 0x00, 0x13, 0x3a, 0x24, 0x00, 0x28, 0xf1, 0xc0, 
+  0x24, 0x00, 0xc0, 0x86, 0x0c, 0x4f, 0xf9, 0x08, 0xda, 0x1e, 0x0a, 0x60, 
+  0x08, 0x6c, 0x74, 0x42, 0x01, 0x2c, 0xe0, 0x78, 0x44, 0x00, 0x11, 0x72, 
+  0x44, 0x00, 0x11, 0x09, 0x44, 0x00, 0x2f, 0xf6, 0x09, 0xf4, 0x00, 0x01, 
+  0x10, 0x4a, 0x22, 0x00, 0x60, 0x45, 0x0a, 0xda, 0x6c, 0x76, 0xd6, 0x20, 
+  0x00, 0xf8, 0x04, 0x40, 0xc2, 0xc6, 0xe2, 0xc3, 0xa1, 0xc1, 0x3a, 0x0c, 
+  0xef, 0xfa, 0x08, 0x45, 0x40, 0xc0, 0x40, 0x24, 0x05, 0x30, 0x2e, 0x00, 
+  0xf1, 0x02, 0x8c, 0x76, 0x72, 0x0b, 0xef, 0xfa, 0xa1, 0x40, 0x40, 0x24, 
+  0x04, 0x30, 0x0b, 0xda, 0x6c, 0x76, 0x92, 0x34, 0x00, 0x40, 0x00, 0xc0, 
+  0xc2, 0xc7, 0x7c, 0x00, 0xf0, 0x13, 0xad, 0x70, 0x0a, 0x26, 0x80, 0x1f, 
+  0x13, 0x00, 0x38, 0x7a, 0x00, 0x86, 0x21, 0x86, 0x02, 0x79, 0x0d, 0x09, 
+  0x72, 0x01, 0x22, 0xb9, 0x96, 0x0b, 0xcf, 0xfa, 0xa5, 0x71, 0xf1, 0x0d, 
+  0x34, 0x94, 0x08, 0xe6, 0x06, 0x01, 0x11, 0xd8, 0x06, 0x01, 0xa0, 0xdc, 
+  0x79, 0xc6, 0x0b, 0x4f, 0xf9, 0x0c, 0xda, 0x62, 0x09, 0xbe, 0x00, 0x20, 
+  0xc4, 0xc6, 0x18, 0x02, 0x08, 0x6a, 0x00, 0x71, 0xaa, 0x0b, 0x4f, 0xf9, 
+  0x0d, 0xda, 0x42, 0x1e, 0x00, 0x02, 0xdc, 0x00, 0x0a, 0x20, 0x00, 0x7f, 
+  0x8a, 0x0b, 0x4f, 0xf9, 0x0e, 0xda, 0x22, 0x20, 0x00, 0x06, 0x77, 0x6a, 
+  0x0b, 0x4f, 0xf9, 0x0f, 0xda, 0x02, 0x20, 0x00, 0xf1, 0x3e, 0xe0, 0x7f, 
+  0x0c, 0x70, 0xe8, 0xc2, 0x08, 0x45, 0x94, 0xe1, 0x42, 0x01, 0x25, 0x00, 
+  0xed, 0x70, 0x0e, 0x71, 0xcd, 0x70, 0xe1, 0xad, 0xe0, 0xad, 0xaa, 0x09, 
+  0xaf, 0xf5, 0xcf, 0x78, 0x61, 0x8d, 0x40, 0x8d, 0x2f, 0x21, 0x08, 0x04, 
+  0x08, 0xbb, 0x14, 0x70, 0xc5, 0x71, 0x65, 0x7a, 0xcf, 0x78, 0xc5, 0x22, 
+  0x42, 0x00, 0x2f, 0x20, 0x40, 0x20, 0x40, 0xad, 0x28, 0xba, 0xdd, 0x08, 
+  0x74, 0x82, 0x41, 0xad, 0x09, 0xde, 0x0e, 0x71, 0xe3, 0xad, 0x02, 0x1d, 
+  0xc2, 0x13, 0x76, 0x34, 0x00, 0x3f, 0x63, 0x8d, 0x42, 0x34, 0x00, 0x04, 
+  0x11, 0x42, 0x34, 0x00, 0xf0, 0x01, 0xb4, 0x84, 0x43, 0xad, 0xcd, 0x70, 
+  0x0e, 0x71, 0xe5, 0xad, 0x04, 0x1d, 0xc2, 0x13, 0x6a, 0x08, 0x34, 0x00, 
+  0x3f, 0x65, 0x8d, 0x44, 0x34, 0x00, 0x04, 0x13, 0x44, 0x68, 0x00, 0xf4, 
+  0xab, 0x45, 0xad, 0xe7, 0xad, 0xe6, 0xad, 0x09, 0xdf, 0x4a, 0x26, 0x40, 
+  0x10, 0x36, 0x08, 0xaf, 0xf5, 0xef, 0x78, 0x87, 0x8d, 0x46, 0x8d, 0x14, 
+  0x70, 0x40, 0x2c, 0x00, 0x12, 0xd0, 0x79, 0xe5, 0x71, 0x45, 0x78, 0xef, 
+  0x7b, 0xc5, 0x20, 0x42, 0x00, 0x3b, 0x7e, 0x06, 0xad, 0x28, 0xb8, 0xe1, 
+  0x0b, 0xb4, 0x84, 0x07, 0xad, 0x0e, 0x0f, 0x40, 0x00, 0x06, 0x0f, 0x60, 
+  0x00, 0x08, 0xad, 0xde, 0x0e, 0x60, 0x00, 0x09, 0xad, 0xba, 0x0e, 0x60, 
+  0x00, 0x0a, 0xad, 0x5a, 0x09, 0xaf, 0xf5, 0x0b, 0xad, 0xd6, 0x09, 0xaf, 
+  0xf5, 0x0c, 0xad, 0x86, 0x09, 0xaf, 0xf5, 0x0d, 0xad, 0x0e, 0xad, 0xc3, 
+  0x41, 0xf0, 0x00, 0x00, 0x01, 0x0d, 0x89, 0x14, 0xdf, 0xc2, 0xb8, 0x0f, 
+  0xad, 0x09, 0x89, 0xc6, 0xb8, 0x10, 0xad, 0x05, 0x91, 0xc6, 0xb8, 0x11, 
+  0xad, 0x0c, 0x89, 0xc1, 0xb8, 0x12, 0xad, 0x13, 0x8d, 0x2c, 0x89, 0x00, 
+  0x16, 0x02, 0x70, 0xf0, 0x00, 0x90, 0x01, 0x6c, 0x20, 0x43, 0x00, 0x24, 
+  0xb9, 0x5b, 0x78, 0x44, 0x21, 0x42, 0x00, 0x44, 0x20, 0x81, 0x00, 0x05, 
+  0x23, 0x80, 0x00, 0x25, 0x78, 0x13, 0xad, 0xe1, 0x40, 0xc8, 0xc6, 0xe0, 
+  0x78, 0xe8, 0xc2, 0xf0, 0x26, 0x4d, 0x70, 0xa0, 0x00, 0xf4, 0x4d, 0x48, 
+  0x47, 0x08, 0x46, 0xb5, 0x70, 0x66, 0xf2, 0xde, 0x04, 0xf0, 0x4b, 0x01, 
+  0x85, 0x00, 0xae, 0x60, 0x85, 0x42, 0x85, 0x28, 0xb8, 0x01, 0xae, 0x20, 
+  0x40, 0x62, 0xae, 0x66, 0x08, 0x6f, 0xf8, 0x43, 0xae, 0x82, 0x8e, 0x04, 
+  0xae, 0x55, 0x27, 0x80, 0x1f, 0x22, 0xb8, 0xc5, 0xb8, 0x40, 0x25, 0x03, 
+  0x15, 0x98, 0x4e, 0x4c, 0x70, 0x09, 0x24, 0x0b, 0x10, 0x1f, 0xf0, 0x60, 
+  0x83, 0x20, 0xeb, 0xd4, 0x8b, 0x80, 0x89, 0x44, 0x71, 0xc3, 0xbe, 0x6c, 
+  0x24, 0xc0, 0x10, 0xc5, 0x78, 0x00, 0xa9, 0x88, 0x8b, 0x84, 0x20, 0xc2, 
+  0x03, 0x04, 0xbc, 0x84, 0x24, 0x01, 0x1c, 0x85, 0x78, 0x00, 0xa9, 0x15, 
+  0x8b, 0xc5, 0x7c, 0x07, 0xb8, 0x0a, 0x00, 0xf0, 0x10, 0x0c, 0x93, 0x96, 
+  0x8b, 0x02, 0xa9, 0x28, 0xb8, 0x81, 0xa9, 0x03, 0xa9, 0x24, 0x74, 0x4f, 
+  0x78, 0xc3, 0x08, 0xc4, 0x82, 0x0c, 0xe5, 0x20, 0xf0, 0xa0, 0x85, 0x21, 
+  0xed, 0x94, 0x8d, 0x60, 0x46, 0x00, 0x50, 0xbc, 0x6c, 0x23, 0xc0, 0x00, 
+  0x2c, 0x00, 0x21, 0x68, 0x8d, 0x46, 0x00, 0x60, 0xbb, 0x84, 0x23, 0x01, 
+  0x0c, 0x65, 0x46, 0x00, 0x50, 0x8d, 0x85, 0x7b, 0x07, 0xb8, 0x0a, 0x00, 
+  0x40, 0x0c, 0x95, 0x76, 0x8d, 0x46, 0x00, 0x13, 0x61, 0x46, 0x00, 0x40, 
+  0xc5, 0x08, 0xc4, 0x82, 0xe2, 0x04, 0xa0, 0x08, 0xd9, 0x15, 0x79, 0x03, 
+  0xf0, 0x2c, 0x70, 0x30, 0x78, 0xe4, 0x00, 0x20, 0xe4, 0xc2, 0x5a, 0x07, 
+  0xf0, 0x0f, 0xc0, 0x7e, 0x80, 0x84, 0x60, 0x7c, 0x48, 0x45, 0xcd, 0x70, 
+  0x09, 0xe8, 0x00, 0x8d, 0xcd, 0x71, 0x07, 0xe8, 0x3d, 0x58, 0x24, 0x88, 
+  0x05, 0x88, 0x21, 0xad, 0x02, 0xad, 0xc1, 0x40, 0xbc, 0x02, 0xf1, 0x8a, 
+  0xea, 0xc2, 0x08, 0x45, 0x7c, 0xb8, 0x70, 0x41, 0x48, 0x46, 0x1d, 0x08, 
+  0xf5, 0x00, 0x30, 0x40, 0x55, 0x25, 0x40, 0x1e, 0x0f, 0x79, 0xc1, 0x40, 
+  0x02, 0x42, 0xb7, 0xff, 0x00, 0x19, 0x04, 0x20, 0x0c, 0x71, 0xca, 0xc6, 
+  0x0f, 0x0d, 0x74, 0x18, 0x1e, 0x4e, 0x2c, 0x70, 0x96, 0x09, 0xef, 0xfc, 
+  0x4c, 0x75, 0xcb, 0x47, 0xa0, 0x00, 0xb4, 0x7e, 0x82, 0x87, 0xa1, 0x40, 
+  0x02, 0x41, 0xc1, 0x42, 0x60, 0x7c, 0x22, 0x43, 0x07, 0xe8, 0x71, 0x0d, 
+  0xf0, 0x10, 0x0c, 0x71, 0x31, 0x0d, 0x10, 0x11, 0xe9, 0xf1, 0x25, 0x0d, 
+  0x32, 0x14, 0x0c, 0x70, 0x87, 0x0d, 0x30, 0x14, 0x02, 0x41, 0xf9, 0xe5, 
+  0x44, 0xf2, 0xfe, 0xe5, 0xdf, 0xf5, 0x20, 0x8f, 0x03, 0xae, 0x02, 0xae, 
+  0x01, 0xae, 0x0c, 0x74, 0x20, 0xae, 0x3f, 0xf0, 0x41, 0x0d, 0xd0, 0x10, 
+  0xab, 0x0d, 0x11, 0x91, 0xce, 0x0e, 0x00, 0x07, 0x08, 0x45, 0x02, 0x6e, 
+  0xc3, 0x41, 0x13, 0x00, 0xc1, 0x78, 0xf6, 0x0a, 0xef, 0xee, 0x4c, 0x76, 
+  0x18, 0x4e, 0xc3, 0x41, 0xa0, 0x00, 0xec, 0x7f, 0xe6, 0x0e, 0x00, 0xf0, 
+  0x4b, 0x09, 0xed, 0x80, 0x25, 0x04, 0x1f, 0x1e, 0x4e, 0x4c, 0x76, 0xd6, 
+  0x0a, 0xef, 0xee, 0xa1, 0x41, 0x00, 0x11, 0x00, 0x21, 0xb6, 0xf1, 0x0d, 
+  0x08, 0x35, 0x25, 0x0c, 0x70, 0x00, 0x19, 0x05, 0x20, 0xca, 0xc6, 0x0a, 
+  0x0f, 0xef, 0xf9, 0x0c, 0x72, 0x41, 0x28, 0x03, 0x06, 0x41, 0x28, 0x02, 
+  0x04, 0x41, 0x28, 0x01, 0x02, 0x10, 0xae, 0x14, 0xd8, 0x73, 0xae, 0x52, 
+  0xae, 0x31, 0xae, 0x09, 0xf0, 0x10, 0xd8, 0x6a, 0x0a, 0xa0, 0x00, 0xc1, 
+  0x42, 0x05, 0xf0, 0xc1, 0x40, 0x02, 0x41, 0x2f, 0xff, 0x31, 0x09, 0x11, 
+  0xa0, 0x98, 0xf1, 0xe8, 0xc2, 0xcb, 0x46, 0xc4, 0x00, 0xf0, 0xa3, 0x64, 
+  0x86, 0x48, 0x45, 0x30, 0x40, 0x60, 0x7b, 0x08, 0x47, 0xb6, 0xe8, 0xfe, 
+  0xe7, 0x0c, 0x70, 0x33, 0xf4, 0x0d, 0x08, 0x10, 0x20, 0x40, 0x8d, 0x40, 
+  0xae, 0x03, 0xf0, 0x40, 0x8e, 0xcb, 0x45, 0x13, 0x00, 0xc7, 0x78, 0x05, 
+  0xea, 0x8c, 0x22, 0xc3, 0x8f, 0x23, 0xf2, 0x06, 0xf0, 0xf2, 0x0c, 0x6f, 
+  0xee, 0xa1, 0x40, 0x40, 0x8e, 0x1a, 0xea, 0x21, 0x86, 0x01, 0x69, 0x01, 
+  0xa6, 0x3a, 0x0b, 0x6f, 0xee, 0x5a, 0x4d, 0x00, 0x8e, 0x25, 0x08, 0x94, 
+  0x00, 0x3b, 0x58, 0x00, 0x43, 0x20, 0x44, 0x1d, 0x4d, 0xe1, 0x41, 0x22, 
+  0x0b, 0x6f, 0xee, 0x02, 0x42, 0x00, 0x8e, 0x0d, 0x08, 0xf4, 0x00, 0x54, 
+  0x25, 0x40, 0x1a, 0x12, 0x0b, 0x4f, 0xee, 0x04, 0x8e, 0x0d, 0x08, 0x1e, 
+  0x00, 0x82, 0x0c, 0x6f, 0xee, 0x0a, 0xd8, 0x0c, 0x71, 0xc8, 0xc6, 0xe2, 
+  0xc2, 0x39, 0x0b, 0xb0, 0x00, 0x28, 0x43, 0x4b, 0x0b, 0x50, 0x00, 0xa3, 
+  0x0b, 0x11, 0x00, 0x80, 0x90, 0x5f, 0x0c, 0x13, 0x16, 0xab, 0x0c, 0xd0, 
+  0x11, 0xb7, 0x0c, 0x10, 0x12, 0x93, 0x0c, 0x91, 0x12, 0x21, 0x90, 0x04, 
+  0x69, 0x11, 0x09, 0x34, 0x02, 0x00, 0xa2, 0x53, 0x21, 0x7e, 0x80, 0x0c, 
+  0x71, 0x46, 0xf2, 0x0a, 0xd8, 0x68, 0xf0, 0x80, 0x90, 0x1c, 0x01, 0xf0, 
+  0x61, 0xd0, 0xd3, 0x4b, 0x0c, 0xd0, 0x11, 0x4d, 0x0c, 0x10, 0x12, 0x67, 
+  0x0c, 0x91, 0x12, 0xd6, 0x08, 0x00, 0x00, 0x51, 0xf0, 0x80, 0x90, 0xcb, 
+  0x45, 0xa0, 0x00, 0xc8, 0x7e, 0x3f, 0x0c, 0x90, 0x16, 0x49, 0x0c, 0x50, 
+  0x16, 0x4f, 0x0c, 0x11, 0x16, 0x82, 0x85, 0x23, 0xec, 0x40, 0x7c, 0x43, 
+  0xf0, 0x7b, 0x0c, 0x10, 0x16, 0x87, 0x0c, 0x50, 0x16, 0x3b, 0x0c, 0x91, 
+  0x16, 0x21, 0x90, 0x0c, 0x71, 0x64, 0x69, 0x3d, 0x09, 0x30, 0x01, 0x60, 
+  0xa2, 0x1a, 0xd8, 0x3e, 0xf0, 0xde, 0x0b, 0x00, 0x00, 0x33, 0xf0, 0x1e, 
+  0x0c, 0x00, 0x00, 0x2f, 0xf0, 0x20, 0x85, 0x0b, 0xe9, 0x43, 0x85, 0x25, 
+  0x88, 0x60, 0x7a, 0x04, 0x88, 0x29, 0xf0, 0x80, 0x85, 0x05, 0xec, 0x60, 
+  0x7c, 0x04, 0x88, 0x23, 0xf0, 0x48, 0x02, 0xc2, 0xcc, 0x7e, 0xa0, 0x84, 
+  0x2a, 0xed, 0x60, 0x7d, 0x61, 0x41, 0xc2, 0xc6, 0x44, 0x00, 0xf0, 0x09, 
+  0xf9, 0x09, 0x30, 0x81, 0x60, 0xa2, 0x07, 0xd8, 0x1c, 0xf0, 0x01, 0x90, 
+  0x2c, 0x68, 0x64, 0x68, 0xf8, 0xe1, 0x60, 0xa2, 0x05, 0xf7, 0x53, 0x20, 
+  0xae, 0x00, 0xf4, 0x05, 0xee, 0xf3, 0x08, 0xd8, 0x10, 0xf0, 0x01, 0x90, 
+  0x24, 0x68, 0x20, 0xa2, 0x03, 0xe8, 0x18, 0xd8, 0x0a, 0xf0, 0x0c, 0x71, 
+  0x38, 0x00, 0x11, 0xc1, 0x38, 0x00, 0xf2, 0x09, 0x19, 0xd8, 0x2c, 0x71, 
+  0x70, 0x58, 0x0c, 0x70, 0xc2, 0xc6, 0xf1, 0xc0, 0x79, 0x20, 0x00, 0x00, 
+  0x04, 0x71, 0x04, 0xa9, 0x0c, 0x71, 0x64, 0x58, 0xf0, 0x04, 0xf0, 0x17, 
+  0xf8, 0xc2, 0x08, 0x46, 0x04, 0x88, 0x0d, 0x08, 0x1f, 0x00, 0x01, 0x96, 
+  0xa1, 0x08, 0x11, 0x02, 0x0b, 0x16, 0x94, 0x10, 0xce, 0x08, 0x6f, 0xfa, 
+  0x0a, 0x16, 0x93, 0x10, 0x04, 0xe8, 0x2d, 0x10, 0x92, 0x00, 0x03, 0xf0, 
+  0x4e, 0x71, 0x88, 0x02, 0x20, 0xf4, 0xd4, 0xf8, 0x00, 0xf1, 0x29, 0xd4, 
+  0xd4, 0x0c, 0x70, 0x03, 0x1f, 0xc2, 0x14, 0x04, 0x1f, 0x02, 0x15, 0x1c, 
+  0xad, 0x18, 0x1d, 0x45, 0x11, 0x22, 0x96, 0x08, 0x16, 0x90, 0x10, 0x4b, 
+  0x21, 0x00, 0x86, 0x30, 0x41, 0x13, 0xf2, 0x41, 0x29, 0xcc, 0x20, 0x53, 
+  0x24, 0x41, 0x10, 0x5d, 0x09, 0xd0, 0x00, 0x6b, 0x09, 0x90, 0x00, 0x7d, 
+  0x09, 0x51, 0x00, 0x67, 0x0a, 0x5f, 0x20, 0x6a, 0x02, 0xf3, 0x55, 0x40, 
+  0x21, 0xd8, 0x4d, 0xf0, 0x2e, 0x58, 0x10, 0x45, 0x34, 0x58, 0x00, 0x41, 
+  0x02, 0x40, 0xa2, 0x42, 0x33, 0x58, 0x16, 0xe8, 0xbc, 0x48, 0x18, 0xda, 
+  0x66, 0x08, 0xef, 0xee, 0xa1, 0x40, 0x01, 0x85, 0xf0, 0xd9, 0x04, 0x79, 
+  0x63, 0x09, 0x30, 0x04, 0x91, 0xe0, 0xe5, 0x09, 0x31, 0x08, 0xa2, 0xe0, 
+  0xf7, 0xf2, 0xa1, 0xe0, 0xc6, 0x21, 0x21, 0x26, 0xcf, 0x21, 0xe1, 0x20, 
+  0xf5, 0xf0, 0x00, 0x96, 0x2c, 0x76, 0x70, 0x58, 0xd8, 0xc6, 0x08, 0x1d, 
+  0x81, 0x14, 0x04, 0x1d, 0x81, 0x14, 0x00, 0x1d, 0x80, 0x1f, 0xa0, 0x00, 
+  0x74, 0x40, 0x0d, 0xf0, 0x3f, 0x0a, 0x51, 0x20, 0x08, 0x1d, 0x41, 0x14, 
+  0x04, 0x1d, 0x41, 0x16, 0x00, 0xf0, 0x1b, 0x54, 0x40, 0x03, 0xf0, 0x01, 
+  0xa5, 0x49, 0x8e, 0x2e, 0x8d, 0x00, 0xaf, 0x5b, 0x7a, 0xc0, 0xb9, 0x1f, 
+  0xad, 0x19, 0x4e, 0x45, 0x79, 0x2e, 0xad, 0x44, 0xf0, 0x0a, 0x02, 0x21, 
+  0x00, 0x56, 0x71, 0x92, 0xe0, 0x0f, 0x02, 0x20, 0x00, 0xc5, 0x21, 0x21, 
+  0x26, 0x9a, 0x00, 0xf0, 0xa9, 0x08, 0x41, 0x22, 0xd8, 0x55, 0x8d, 0xc0, 
+  0xdb, 0x2f, 0x24, 0x02, 0x04, 0x09, 0x16, 0x88, 0x10, 0x06, 0x16, 0x0b, 
+  0x11, 0x44, 0x24, 0x07, 0x11, 0x41, 0x29, 0x0c, 0x23, 0x53, 0x20, 0x86, 
+  0x20, 0x02, 0xa5, 0x01, 0xa5, 0x20, 0xa5, 0x04, 0x21, 0xc1, 0x20, 0x44, 
+  0x24, 0x00, 0x02, 0x44, 0x24, 0x09, 0x12, 0x6c, 0x24, 0xcc, 0x00, 0x26, 
+  0xb9, 0x05, 0x20, 0x80, 0x01, 0x41, 0x29, 0x85, 0x23, 0x05, 0x21, 0xc1, 
+  0x01, 0x85, 0x78, 0x84, 0x22, 0x02, 0x00, 0x44, 0x25, 0x43, 0x00, 0x05, 
+  0x21, 0x41, 0x02, 0x45, 0x78, 0x73, 0xad, 0x34, 0xad, 0x15, 0xad, 0x03, 
+  0x96, 0x10, 0x1d, 0xc4, 0x12, 0x12, 0x1d, 0x02, 0x12, 0x1f, 0xad, 0x28, 
+  0xb8, 0x00, 0xaf, 0xa6, 0x09, 0x60, 0x00, 0xa1, 0x40, 0x19, 0x4e, 0x00, 
+  0x88, 0x02, 0xaf, 0x41, 0x29, 0x00, 0x22, 0x44, 0x21, 0x17, 0xa1, 0xd3, 
+  0x42, 0xa0, 0x00, 0xe0, 0x7e, 0x1d, 0x1d, 0x42, 0x14, 0x01, 0x1f, 0x02, 
+  0x14, 0x1e, 0xad, 0x12, 0xf2, 0xc5, 0xb8, 0xd3, 0x46, 0x4c, 0x3d, 0xcd, 
+  0xcc, 0x11, 0x08, 0x74, 0x01, 0x63, 0xb8, 0x48, 0x30, 0x80, 0x00, 0x00, 
+  0x30, 0x96, 0x05, 0x27, 0x09, 0x1f, 0x20, 0xd3, 0x40, 0x12, 0x00, 0x50, 
+  0x4b, 0x08, 0xf0, 0x23, 0x09, 0x3f, 0x20, 0xce, 0x70, 0x0e, 0x00, 0xf0, 
+  0x01, 0x4c, 0x4b, 0x40, 0x23, 0xc0, 0x24, 0x6c, 0x20, 0x40, 0x00, 0x00, 
+  0x1a, 0x00, 0x24, 0x10, 0xf0, 0x14, 0x00, 0x31, 0x7c, 0x4b, 0x04, 0x08, 
+  0x00, 0xc1, 0x78, 0x4b, 0x9c, 0x4e, 0x05, 0x6f, 0x62, 0x42, 0x06, 0x0f, 
+  0xaf, 0xee, 0x1e, 0x00, 0xf8, 0x20, 0xd8, 0x40, 0x27, 0x55, 0x11, 0xf6, 
+  0x70, 0xd3, 0x47, 0x12, 0x00, 0x64, 0x58, 0x0d, 0xb5, 0x0f, 0xf2, 0x40, 
+  0x25, 0x05, 0x16, 0xa1, 0x40, 0x82, 0x41, 0xa2, 0x42, 0x62, 0x43, 0x0a, 
+  0x24, 0xc0, 0x05, 0x23, 0x20, 0x00, 0x04, 0x0a, 0x26, 0x80, 0x05, 0xd8, 
+  0xc6, 0x15, 0x09, 0x7f, 0x20, 0x1e, 0x00, 0xf1, 0x11, 0x2c, 0xf0, 0x42, 
+  0x23, 0x51, 0x20, 0x2f, 0x26, 0x47, 0xf4, 0x1f, 0xf2, 0x40, 0x25, 0x18, 
+  0x16, 0x0a, 0x26, 0x40, 0x24, 0x8a, 0x46, 0xcf, 0x79, 0x6c, 0x71, 0x8c, 
+  0x70, 0xa1, 0x40, 0xa2, 0x42, 0x3a, 0x00, 0xf0, 0x18, 0x25, 0x00, 0x06, 
+  0x00, 0x12, 0x10, 0x20, 0xc6, 0x77, 0xa6, 0x71, 0x2f, 0x26, 0x87, 0xf5, 
+  0xc5, 0x71, 0xf0, 0xf5, 0x42, 0x23, 0x81, 0x20, 0x06, 0x6f, 0x2f, 0x7a, 
+  0x00, 0x24, 0x54, 0x24, 0x00, 0x22, 0x15, 0x00, 0x2f, 0x21, 0x07, 0x05, 
+  0x58, 0x00, 0x25, 0x6c, 0x71, 0x36, 0x00, 0xf0, 0x66, 0x24, 0xc0, 0x05, 
+  0xd8, 0xc6, 0x46, 0x21, 0x11, 0x26, 0x4f, 0x21, 0x11, 0x21, 0x08, 0x95, 
+  0x52, 0x8d, 0x95, 0x8d, 0x74, 0x8d, 0x13, 0x15, 0x89, 0x10, 0x8a, 0x23, 
+  0x01, 0x10, 0x1f, 0xad, 0x42, 0xaf, 0x41, 0x28, 0x02, 0x02, 0x9b, 0x78, 
+  0x36, 0x6b, 0x40, 0x2b, 0xc8, 0x00, 0x04, 0x21, 0x86, 0x2f, 0x00, 0x00, 
+  0x1f, 0x3f, 0xc2, 0xbc, 0x44, 0x21, 0x51, 0x10, 0x40, 0xaf, 0x6c, 0x20, 
+  0x09, 0x01, 0x44, 0x20, 0x02, 0x04, 0x04, 0x21, 0xc0, 0x02, 0x44, 0x20, 
+  0x0b, 0x18, 0x45, 0x7c, 0x05, 0x26, 0xc2, 0x02, 0x0c, 0xbb, 0x84, 0x21, 
+  0x02, 0x00, 0x45, 0x78, 0x04, 0x23, 0x83, 0x0f, 0x0f, 0x00, 0x00, 0x80, 
+  0x25, 0x78, 0x40, 0x29, 0x91, 0x23, 0x65, 0x78, 0x05, 0x24, 0x50, 0x12, 
+  0x05, 0x21, 0x11, 0x20, 0x42, 0xf1, 0x70, 0x00, 0xf0, 0x0b, 0xcf, 0x21, 
+  0x21, 0x21, 0xcf, 0x21, 0xe2, 0x20, 0x0e, 0x8d, 0x0e, 0x70, 0x00, 0x1f, 
+  0x02, 0x14, 0x1f, 0x1d, 0x02, 0x14, 0x1d, 0x78, 0x33, 0xf1, 0xe0, 0x78, 
+  0x16, 0x02, 0xf0, 0x1b, 0xf4, 0x7e, 0x40, 0x81, 0x00, 0x43, 0x07, 0xea, 
+  0x40, 0x40, 0x43, 0x82, 0xfe, 0xea, 0x63, 0xa0, 0x02, 0xf0, 0x60, 0xa1, 
+  0x0c, 0x70, 0xe0, 0x7f, 0x0c, 0x1b, 0x01, 0x00, 0xc3, 0x40, 0xa0, 0x00, 
+  0xe8, 0x7e, 0x21, 0x80, 0xe0, 0x7f, 0x00, 0x80, 0xe4, 0xc2, 0x1a, 0x03, 
+  0xf0, 0x15, 0xe8, 0x7e, 0xc4, 0x88, 0x08, 0x8d, 0x39, 0x0e, 0x00, 0x10, 
+  0x17, 0x0e, 0x91, 0x10, 0x96, 0x0a, 0x4f, 0xfa, 0x21, 0xa5, 0x00, 0xa5, 
+  0x3b, 0xd8, 0xc3, 0x41, 0x12, 0x00, 0xb0, 0x5b, 0x07, 0xf0, 0x1f, 0x08, 
+  0xb1, 0x00, 0x0e, 0x00, 0xf0, 0x01, 0x11, 0x00, 0x64, 0xa6, 0x9a, 0x0e, 
+  0x00, 0x00, 0x0c, 0x71, 0x6b, 0x20, 0x00, 0x04, 0xe0, 0x78, 0x02, 0x00, 
+  0x22, 0xc8, 0xad, 0x20, 0x06, 0x40, 0x21, 0x90, 0xa4, 0x68, 0x6c, 0x03, 
+  0xf0, 0xd3, 0xe8, 0x7e, 0x38, 0x60, 0x8a, 0x20, 0x83, 0x28, 0x40, 0x20, 
+  0x11, 0x01, 0x00, 0x8d, 0x8c, 0x20, 0x03, 0x8c, 0x48, 0x00, 0x25, 0x00, 
+  0xc1, 0x6d, 0x28, 0x8f, 0xb5, 0x09, 0xb1, 0x00, 0x00, 0x41, 0x80, 0x21, 
+  0xfc, 0x02, 0xa5, 0x09, 0x75, 0x02, 0x41, 0xda, 0x77, 0x0a, 0x6f, 0x00, 
+  0x82, 0xda, 0x7f, 0x0a, 0x6f, 0x00, 0x8a, 0x22, 0x04, 0x01, 0x91, 0x0a, 
+  0x4e, 0x00, 0x24, 0x8e, 0x21, 0xa7, 0x41, 0x8e, 0x63, 0x8e, 0x20, 0x8e, 
+  0x82, 0x8e, 0x08, 0xba, 0x08, 0xbb, 0x25, 0x7a, 0x05, 0x23, 0x01, 0x03, 
+  0x10, 0xb9, 0x45, 0x79, 0x20, 0xa7, 0x3c, 0xf0, 0x7d, 0x08, 0x30, 0x00, 
+  0xa5, 0x72, 0xa3, 0x87, 0x07, 0x00, 0x00, 0x00, 0xa3, 0x85, 0x77, 0x0d, 
+  0x10, 0x10, 0x20, 0x85, 0x24, 0x89, 0xf9, 0x09, 0x01, 0x80, 0x08, 0x8f, 
+  0x0b, 0x08, 0x51, 0x00, 0x3b, 0x58, 0x21, 0xa7, 0x00, 0xa7, 0x48, 0x8d, 
+  0x01, 0x85, 0xd2, 0x0c, 0xaf, 0xee, 0xc1, 0x41, 0x40, 0x85, 0xa8, 0x8d, 
+  0xb9, 0x12, 0xc0, 0x00, 0x45, 0x08, 0x33, 0x00, 0xdd, 0x65, 0x21, 0x87, 
+  0x00, 0x87, 0x72, 0x58, 0x1c, 0xf0, 0x40, 0x8e, 0x20, 0x87, 0x61, 0x87, 
+  0x00, 0x22, 0x42, 0x80, 0x09, 0xf0, 0x21, 0x8e, 0x40, 0x8e, 0x80, 0x87, 
+  0x08, 0xb9, 0x61, 0x87, 0x45, 0x79, 0x00, 0x24, 0x42, 0x90, 0x41, 0x23, 
+  0x01, 0x80, 0x21, 0xa7, 0x40, 0xa7, 0x06, 0xf0, 0x00, 0x1e, 0x02, 0x74, 
+  0xf0, 0x00, 0x48, 0x00, 0xfa, 0x0c, 0x2f, 0xfa, 0x2c, 0x70, 0x1d, 0x65, 
+  0x37, 0x0d, 0x44, 0x94, 0xca, 0xc6, 0xe2, 0xd8, 0x00, 0x1e, 0x02, 0x70, 
+  0x18, 0x00, 0xf2, 0x17, 0xca, 0xc6, 0xe0, 0x78, 0xf1, 0xc0, 0xa3, 0xc1, 
+  0xc3, 0x42, 0xa0, 0x00, 0xf0, 0x7e, 0x40, 0x8a, 0x0a, 0xea, 0x04, 0x88, 
+  0x41, 0xc1, 0x2c, 0x74, 0x93, 0xb9, 0x40, 0xc1, 0x62, 0xc0, 0x0c, 0x71, 
+  0x80, 0xc1, 0x64, 0x58, 0xa3, 0xc0, 0xa8, 0x04, 0xf1, 0x68, 0xe6, 0xc2, 
+  0x42, 0x23, 0x3c, 0x80, 0x15, 0xf2, 0xcd, 0x70, 0xad, 0x70, 0xa8, 0x20, 
+  0x40, 0x04, 0x97, 0x6d, 0x5c, 0x64, 0x2f, 0x27, 0xff, 0x02, 0x6f, 0x23, 
+  0x3f, 0x00, 0xf3, 0x8c, 0x06, 0xef, 0xd3, 0xac, 0x0e, 0x1c, 0x43, 0x10, 
+  0xd0, 0xa4, 0x2f, 0x26, 0xff, 0x02, 0xa5, 0x71, 0x5e, 0x09, 0x8f, 0xf9, 
+  0xc6, 0xc6, 0x00, 0x16, 0x1d, 0x70, 0xa0, 0x00, 0x04, 0x47, 0x09, 0x24, 
+  0x4c, 0x17, 0xf0, 0x26, 0x1d, 0x73, 0xa0, 0x00, 0x20, 0x6c, 0xab, 0x25, 
+  0x10, 0x30, 0xaa, 0x25, 0x90, 0x30, 0x35, 0x0d, 0xfe, 0x31, 0x50, 0x25, 
+  0xdd, 0x31, 0xab, 0x25, 0x90, 0x30, 0x67, 0x24, 0x40, 0x33, 0xfc, 0x1c, 
+  0xc8, 0xb7, 0xaa, 0x25, 0x09, 0x38, 0xa7, 0x25, 0x09, 0x39, 0xfc, 0x1c, 
+  0x48, 0xb7, 0xaa, 0x25, 0x49, 0x38, 0xa7, 0x25, 0x49, 0x0c, 0x00, 0xf2, 
+  0x11, 0x0a, 0x27, 0x80, 0x3f, 0x11, 0x00, 0x3c, 0xc8, 0x6f, 0x24, 0x3f, 
+  0x00, 0xaa, 0x27, 0x90, 0x30, 0x4f, 0x27, 0xdf, 0x31, 0xab, 0x27, 0x90, 
+  0x30, 0x04, 0x14, 0x1d, 0x34, 0xab, 0x25, 0x49, 0x39, 0x08, 0x00, 0x60, 
+  0x09, 0x39, 0x04, 0x14, 0x1f, 0x34, 0x4c, 0x00, 0x40, 0xab, 0x27, 0x10, 
+  0x30, 0x2c, 0x00, 0x00, 0xd8, 0x00, 0xe0, 0x00, 0x7f, 0x39, 0xa2, 0xe0, 
+  0x7f, 0x18, 0xa2, 0xf1, 0xc0, 0xfa, 0x09, 0x0f, 0xfd, 0x36, 0x02, 0xf0, 
+  0x05, 0x08, 0x47, 0x40, 0x20, 0x02, 0x0a, 0xcc, 0x48, 0x20, 0xe0, 0x00, 
+  0x1a, 0x80, 0x0f, 0x12, 0x00, 0xa8, 0x5d, 0x00, 0x19, 0x08, 0x00, 0x40, 
+  0x54, 0x5d, 0x00, 0x18, 0x08, 0x00, 0x20, 0x8e, 0x61, 0xf2, 0x00, 0xf0, 
+  0x13, 0x05, 0xeb, 0x15, 0x22, 0xcc, 0x00, 0xfc, 0x1c, 0xc0, 0x90, 0xcd, 
+  0x07, 0x0f, 0xfe, 0xe0, 0x78, 0x00, 0x42, 0x06, 0xe8, 0x10, 0x8a, 0xe7, 
+  0xb8, 0x0c, 0x77, 0xe0, 0x7d, 0xd9, 0x01, 0xef, 0xfe, 0x40, 0x40, 0x30, 
+  0x02, 0xf0, 0x29, 0x00, 0x10, 0x10, 0x00, 0x08, 0x45, 0x58, 0x20, 0x4e, 
+  0x01, 0x70, 0xb8, 0x70, 0x41, 0x7e, 0x0d, 0xef, 0xfc, 0x28, 0x47, 0xc3, 
+  0x41, 0x00, 0x80, 0x1e, 0x40, 0x36, 0x71, 0xd5, 0x21, 0x22, 0x08, 0xe4, 
+  0xa6, 0x04, 0x1d, 0x50, 0x10, 0x18, 0x25, 0x02, 0x14, 0x07, 0xf4, 0x2c, 
+  0x70, 0x04, 0x1e, 0x01, 0x10, 0xa3, 0xa6, 0x42, 0xa6, 0x0a, 0xf0, 0xde, 
+  0x02, 0xf0, 0x0d, 0x00, 0x7f, 0x98, 0x81, 0x79, 0x81, 0x40, 0x41, 0xa1, 
+  0xa6, 0x83, 0xa6, 0x62, 0xa6, 0x20, 0xa6, 0xca, 0xc6, 0x0c, 0x70, 0x54, 
+  0x70, 0xab, 0x20, 0x50, 0x02, 0xe0, 0x7c, 0xa8, 0x00, 0xa0, 0x58, 0x7f, 
+  0xe0, 0x7f, 0x40, 0xa0, 0xee, 0xc2, 0x4e, 0x70, 0xc2, 0x07, 0xf1, 0x9c, 
+  0x00, 0x7f, 0x8a, 0x21, 0x90, 0x28, 0x52, 0x40, 0xa4, 0x6e, 0xab, 0x22, 
+  0x50, 0x22, 0x00, 0x85, 0x40, 0x21, 0x53, 0x20, 0x0c, 0xe8, 0x20, 0x86, 
+  0xe1, 0x85, 0x80, 0xb9, 0x2b, 0x21, 0x40, 0x04, 0xfe, 0x0e, 0x0f, 0xfe, 
+  0xe5, 0x78, 0x2b, 0x20, 0xc0, 0x04, 0x06, 0xf0, 0x2b, 0x22, 0x40, 0x24, 
+  0x2b, 0x22, 0xc0, 0x24, 0x06, 0x71, 0x0c, 0xe6, 0x26, 0x72, 0xd7, 0x08, 
+  0x34, 0xa2, 0x0c, 0xe5, 0xce, 0xc6, 0xe0, 0x78, 0xee, 0xc2, 0xd9, 0x88, 
+  0x08, 0x45, 0x30, 0x43, 0xc1, 0xbe, 0x76, 0x08, 0x6f, 0xfb, 0xa1, 0x40, 
+  0x4e, 0x70, 0x0e, 0x71, 0x0a, 0xe8, 0x1f, 0x0e, 0xb5, 0x10, 0xa1, 0x40, 
+  0x35, 0x58, 0x13, 0x0b, 0x25, 0x20, 0x0c, 0x71, 0x2e, 0x70, 0x40, 0xf0, 
+  0x0c, 0x71, 0x10, 0x41, 0x3c, 0xf0, 0x0d, 0x8d, 0x03, 0xe8, 0xe0, 0x85, 
+  0x05, 0xf0, 0x0d, 0x1d, 0x43, 0x10, 0xa9, 0x47, 0x02, 0xf0, 0x1c, 0xef, 
+  0x3e, 0x08, 0x6f, 0xfb, 0xe1, 0x40, 0x11, 0xe8, 0xe1, 0x40, 0x35, 0x58, 
+  0x1b, 0x08, 0xc1, 0x04, 0x55, 0x87, 0x05, 0xea, 0x39, 0x87, 0x60, 0x7a, 
+  0xe1, 0x40, 0x19, 0x0f, 0x60, 0x13, 0xe1, 0x40, 0x32, 0x0b, 0x0f, 0xf9, 
+  0x06, 0xf0, 0x1a, 0x26, 0x00, 0xf0, 0x61, 0x02, 0xe8, 0x0e, 0x70, 0xe0, 
+  0x87, 0xe7, 0xf1, 0x16, 0x70, 0x15, 0xf2, 0x1a, 0x0b, 0x2f, 0xf9, 0xa1, 
+  0x40, 0x0b, 0x0e, 0x90, 0x10, 0x0d, 0x1d, 0x03, 0x10, 0x10, 0x8d, 0x14, 
+  0x70, 0x0b, 0xf2, 0x10, 0x1d, 0x03, 0x10, 0x9e, 0x78, 0x2c, 0x70, 0x4c, 
+  0x71, 0xa1, 0x40, 0x91, 0x58, 0xbe, 0x78, 0x4e, 0x71, 0x79, 0x20, 0x10, 
+  0x20, 0x0c, 0x70, 0x83, 0xe8, 0x56, 0x70, 0xb1, 0xf5, 0x14, 0x70, 0xca, 
+  0x20, 0x42, 0x24, 0x02, 0x40, 0xce, 0xc6, 0x00, 0x1e, 0x00, 0x70, 0xa0, 
+  0x00, 0xe0, 0x47, 0x6a, 0x20, 0x80, 0x02, 0xae, 0xb8, 0xbf, 0xb8, 0x29, 
+  0x20, 0x00, 0x80, 0xaa, 0x20, 0xc1, 0x00, 0x51, 0x20, 0xc0, 0x87, 0xbf, 
+  0xb8, 0xab, 0x20, 0xc1, 0x00, 0xe7, 0x24, 0x62, 0x33, 0xc7, 0x40, 0x24, 
+  0x00, 0xf1, 0x02, 0x64, 0x1c, 0x08, 0xb0, 0xaa, 0x20, 0x49, 0x09, 0x98, 
+  0x1c, 0x00, 0x30, 0xaa, 0x20, 0x09, 0x09, 0x94, 0x08, 0x00, 0x32, 0x49, 
+  0x08, 0x90, 0x10, 0x00, 0xf1, 0x03, 0x08, 0x8c, 0x1c, 0x00, 0x30, 0x0a, 
+  0x20, 0x00, 0x0f, 0x88, 0x1c, 0x00, 0x30, 0x6a, 0x20, 0x80, 0x00, 0x84, 
+  0x08, 0x00, 0xf0, 0x81, 0xc0, 0x00, 0x80, 0x1c, 0x00, 0x30, 0x7c, 0x1c, 
+  0xc0, 0x37, 0x78, 0x1c, 0x80, 0x37, 0x74, 0x1c, 0x40, 0x37, 0xaa, 0x20, 
+  0x50, 0x00, 0x5c, 0xc0, 0x6c, 0x1c, 0xc0, 0x36, 0x68, 0x1c, 0x80, 0x36, 
+  0x64, 0x1c, 0x40, 0x36, 0x60, 0x1c, 0x00, 0x36, 0x5c, 0x1c, 0xc0, 0x35, 
+  0x58, 0x1c, 0x80, 0x35, 0x54, 0x1c, 0x40, 0x35, 0x50, 0x1c, 0x00, 0x35, 
+  0x4c, 0x1c, 0xc0, 0x34, 0x48, 0x1c, 0x80, 0x34, 0x44, 0x1c, 0x40, 0x34, 
+  0x40, 0x1c, 0x00, 0x34, 0x4f, 0xc7, 0x4e, 0xc6, 0x4d, 0xc5, 0x4c, 0xc4, 
+  0x2c, 0x1c, 0xc0, 0x32, 0x28, 0x1c, 0x80, 0x32, 0x24, 0x1c, 0x40, 0x32, 
+  0x20, 0x1c, 0x00, 0x32, 0x1c, 0x1c, 0xc0, 0x31, 0x18, 0x1c, 0x80, 0x31, 
+  0x14, 0x1c, 0x40, 0x31, 0x10, 0x1c, 0x00, 0x31, 0x43, 0xc3, 0x42, 0xc2, 
+  0x41, 0xc1, 0xaa, 0x20, 0x48, 0x00, 0x42, 0x20, 0x00, 0x84, 0x1e, 0x00, 
+  0x01, 0x00, 0x6a, 0x21, 0x80, 0x08, 0x44, 0x21, 0xc1, 0x00, 0x6b, 0x21, 
+  0x80, 0x08, 0x22, 0x20, 0x84, 0x02, 0xf2, 0x09, 0xd0, 0x39, 0x14, 0x70, 
+  0x2a, 0x00, 0x01, 0x00, 0xab, 0x20, 0x48, 0x00, 0x00, 0x16, 0x0a, 0x70, 
+  0xa0, 0x00, 0xac, 0x46, 0x00, 0x1a, 0x00, 0x17, 0x1e, 0x00, 0x25, 0xec, 
+  0x2a, 0x14, 0x00, 0xc1, 0x12, 0x1c, 0x10, 0x98, 0x14, 0x1e, 0x30, 0xab, 
+  0x26, 0x49, 0x39, 0x94, 0x08, 0x00, 0x32, 0x09, 0x39, 0x90, 0x10, 0x00, 
+  0x22, 0x38, 0x8c, 0x10, 0x00, 0xf1, 0x03, 0x38, 0x88, 0x14, 0x1e, 0x30, 
+  0x0a, 0x24, 0x80, 0x77, 0x84, 0x14, 0x1e, 0x30, 0x6b, 0x26, 0x80, 0x30, 
+  0x80, 0x08, 0x00, 0xf0, 0x67, 0xc0, 0x30, 0x7c, 0x14, 0x1f, 0x30, 0x78, 
+  0x14, 0x1e, 0x30, 0x74, 0x14, 0x1d, 0x30, 0x6c, 0x14, 0x1b, 0x30, 0x68, 
+  0x14, 0x1a, 0x30, 0x64, 0x14, 0x19, 0x30, 0x60, 0x14, 0x18, 0x30, 0x5c, 
+  0x14, 0x17, 0x30, 0x58, 0x14, 0x16, 0x30, 0x54, 0x14, 0x15, 0x30, 0x50, 
+  0x14, 0x14, 0x30, 0x4c, 0x14, 0x13, 0x30, 0x48, 0x14, 0x12, 0x30, 0x44, 
+  0x14, 0x11, 0x30, 0x40, 0x14, 0x10, 0x30, 0x0f, 0xc7, 0x0e, 0xc6, 0x0d, 
+  0xc5, 0x0c, 0xc4, 0x2c, 0x14, 0x0b, 0x30, 0x28, 0x14, 0x0a, 0x30, 0x24, 
+  0x14, 0x09, 0x30, 0x20, 0x14, 0x08, 0x30, 0x1c, 0x14, 0x07, 0x30, 0x18, 
+  0x14, 0x06, 0x30, 0x14, 0x14, 0x05, 0x30, 0x10, 0x14, 0x04, 0x30, 0x03, 
+  0xc3, 0x02, 0xc2, 0x01, 0xc1, 0x1c, 0xc0, 0xab, 0x20, 0x50, 0x00, 0x9c, 
+  0x14, 0x00, 0x34, 0x2e, 0x04, 0x00, 0x9a, 0x03, 0x31, 0xe0, 0x78, 0xfc, 
+  0xac, 0x01, 0x80, 0x48, 0x00, 0x0b, 0x08, 0x10, 0x00, 0x0c, 0x70, 0xe8, 
+  0x00, 0x20, 0x10, 0xd8, 0x06, 0x00, 0xa0, 0x04, 0x14, 0x00, 0x34, 0xe0, 
+  0x7e, 0xe2, 0x08, 0x00, 0x00, 0xd8, 0x00, 0x4f, 0x6b, 0x26, 0x40, 0x33, 
+  0xe0, 0x00, 0x98, 0x61, 0x30, 0xab, 0x20, 0x10, 0x00, 0xa0, 0x08, 0x00, 
+  0x11, 0x90, 0xa2, 0x02, 0x13, 0xa4, 0xf4, 0x00, 0x40, 0x0a, 0x00, 0x01, 
+  0x00, 0x9a, 0x04, 0x02, 0xfc, 0x00, 0x08, 0xbe, 0x01, 0x61, 0xc3, 0x40, 
+  0x00, 0x40, 0x00, 0x00, 0xf6, 0x03, 0xf1, 0x23, 0x7e, 0xe2, 0xc0, 0xaa, 
+  0x24, 0x0a, 0x14, 0x15, 0x7c, 0x92, 0x49, 0x8a, 0x20, 0x9f, 0x0f, 0x44, 
+  0x78, 0x41, 0x2a, 0x43, 0x01, 0x35, 0xba, 0x4f, 0x20, 0x0d, 0x00, 0x04, 
+  0x23, 0x81, 0x0f, 0x00, 0x00, 0xc0, 0xff, 0x53, 0x22, 0xc0, 0x00, 0x25, 
+  0x78, 0xa0, 0xb4, 0x01, 0xb4, 0xc2, 0xc4, 0xe0, 0x78, 0xe8, 0xf8, 0x06, 
+  0x80, 0x8c, 0x7f, 0x48, 0x46, 0x28, 0x47, 0x10, 0x40, 0x34, 0x04, 0xc0, 
+  0x94, 0x40, 0x2a, 0xda, 0x9a, 0x0e, 0x6f, 0xee, 0xa1, 0x41, 0xdc, 0x4d, 
+  0x10, 0x00, 0xf0, 0x49, 0xc0, 0x40, 0x8a, 0x0e, 0x6f, 0xee, 0x2a, 0xda, 
+  0x02, 0x40, 0xe1, 0x41, 0xee, 0x0a, 0xaf, 0xfa, 0xc1, 0x42, 0xc8, 0xc6, 
+  0xe0, 0x78, 0xcb, 0x44, 0xf0, 0x00, 0x00, 0x01, 0x14, 0x8c, 0x17, 0x08, 
+  0x9f, 0x01, 0x14, 0x8c, 0x13, 0x08, 0x5f, 0x01, 0x0b, 0x94, 0x0b, 0x08, 
+  0x1f, 0x00, 0x14, 0x8c, 0xe4, 0xb8, 0xe0, 0x7c, 0x14, 0x8c, 0xc3, 0x41, 
+  0xf0, 0x00, 0x34, 0x00, 0x45, 0xda, 0x15, 0xa9, 0x76, 0x8c, 0x70, 0xd8, 
+  0x90, 0xb8, 0x76, 0xa9, 0x54, 0xa9, 0x05, 0xa4, 0x45, 0xd8, 0x95, 0x07, 
+  0xef, 0xf3, 0x2c, 0x70, 0xe0, 0x78, 0xc3, 0x40, 0x40, 0x00, 0xff, 0x07, 
+  0x2d, 0x88, 0x0c, 0x88, 0xc2, 0xb9, 0x24, 0xb8, 0xc0, 0xb8, 0x47, 0x20, 
+  0xc0, 0x01, 0x09, 0x20, 0x40, 0x00, 0xe0, 0x7f, 0x04, 0x71, 0x1c, 0x00, 
+  0x03, 0xf0, 0x1b, 0x41, 0x00, 0x22, 0x78, 0x04, 0x71, 0xe0, 0x7f, 0x0f, 
+  0x78, 0x41, 0x02, 0x0f, 0xf5, 0x29, 0x02, 0x0f, 0xf5, 0x4d, 0x02, 0x0f, 
+  0xf5, 0xf1, 0xc0, 0x5e, 0x09, 0x0f, 0xf5, 0x11, 0x08, 0x74, 0x02, 0x42, 
+  0x20, 0x41, 0x02, 0x09, 0x09, 0x54, 0x02, 0xff, 0xd8, 0x7c, 0x05, 0xf0, 
+  0x31, 0x55, 0x88, 0x74, 0x88, 0x78, 0xd9, 0x44, 0x79, 0x04, 0xba, 0xc3, 
+  0xbb, 0x84, 0x22, 0x01, 0x0c, 0x87, 0xb9, 0x65, 0x7a, 0x35, 0xa8, 0xe0, 
+  0x7f, 0x54, 0xa8, 0xe0, 0x78, 0xe2, 0xc0, 0x64, 0x88, 0x05, 0x88, 0x24, 
+  0xbb, 0x00, 0x29, 0xcc, 0x00, 0x6c, 0x71, 0x41, 0x28, 0xcd, 0x00, 0x41, 
+  0x28, 0x01, 0x01, 0x06, 0x23, 0x40, 0x03, 0xc2, 0xb9, 0x47, 0x78, 0x38, 
+  0x78, 0x05, 0x7c, 0x8f, 0x78, 0x1c, 0x01, 0xf0, 0x03, 0xee, 0xc3, 0xa1, 
+  0xc1, 0x08, 0x46, 0x14, 0x88, 0x24, 0x86, 0xf5, 0x68, 0x3f, 0x67, 0x28, 
+  0x8f, 0x03, 0x86, 0x4a, 0x04, 0xf0, 0x6b, 0xf0, 0x00, 0x2c, 0x01, 0x1c, 
+  0xe9, 0x40, 0x87, 0x69, 0x8f, 0x01, 0x86, 0x40, 0x27, 0x11, 0x14, 0x03, 
+  0x12, 0x8b, 0x00, 0x82, 0x8a, 0x44, 0x23, 0x12, 0x82, 0x0a, 0x20, 0x40, 
+  0x24, 0x03, 0xf4, 0x00, 0x11, 0x10, 0x20, 0x0d, 0x71, 0x29, 0x0b, 0x3f, 
+  0x00, 0xad, 0x71, 0x1d, 0x0a, 0x30, 0x20, 0x28, 0x45, 0x1d, 0x09, 0x54, 
+  0x01, 0xad, 0x74, 0x0c, 0xf0, 0x22, 0x86, 0x00, 0x1c, 0x01, 0x30, 0x00, 
+  0xc0, 0x00, 0xa1, 0xce, 0xc7, 0x09, 0x09, 0x34, 0x04, 0x28, 0x45, 0x10, 
+  0xdd, 0x21, 0x87, 0x42, 0x86, 0x40, 0xc1, 0x00, 0xc1, 0x11, 0x08, 0x31, 
+  0x20, 0x20, 0xa2, 0x2c, 0x70, 0x23, 0xa0, 0x22, 0xa0, 0x21, 0xa0, 0x20, 
+  0xa0, 0x44, 0x23, 0x13, 0x81, 0x04, 0xf2, 0x4a, 0x8f, 0x22, 0x86, 0x4c, 
+  0xa9, 0x00, 0x28, 0x02, 0x13, 0x2f, 0x27, 0x3f, 0x03, 0x06, 0x02, 0x00, 
+  0x58, 0x01, 0xf1, 0x08, 0x40, 0x02, 0x13, 0x0b, 0x51, 0x10, 0x65, 0x81, 
+  0x65, 0x7a, 0x45, 0xa1, 0x2f, 0x26, 0x3f, 0x03, 0x06, 0xf0, 0x65, 0x81, 
+  0x46, 0x7b, 0x65, 0x0c, 0x00, 0xff, 0x50, 0x0d, 0x08, 0x30, 0x20, 0x02, 
+  0x41, 0xda, 0x0c, 0x6f, 0xee, 0xa1, 0x42, 0x11, 0x0b, 0x31, 0x20, 0x53, 
+  0x25, 0x01, 0x11, 0x42, 0x86, 0x0c, 0x70, 0x90, 0xb8, 0x06, 0xf0, 0x42, 
+  0x86, 0xc3, 0x40, 0x01, 0x00, 0x00, 0x01, 0x40, 0xc0, 0x60, 0xc1, 0x00, 
+  0xc0, 0x2b, 0x08, 0x30, 0x20, 0x01, 0xa2, 0x08, 0x8f, 0x23, 0x0d, 0x05, 
+  0x10, 0x21, 0x0a, 0x10, 0x20, 0x1b, 0x0d, 0x35, 0x11, 0x4e, 0x25, 0x3c, 
+  0x11, 0xb2, 0x4f, 0xa8, 0x20, 0xc0, 0x01, 0xb8, 0x67, 0x30, 0x88, 0xb8, 
+  0x62, 0xa5, 0x71, 0x30, 0xa8, 0xce, 0xc7, 0x02, 0x75, 0x00, 0x19, 0x40, 
+  0x23, 0xce, 0xc7, 0xee, 0xc3, 0xa3, 0x10, 0x01, 0x04, 0x33, 0x18, 0xe9, 
+  0x49, 0x0e, 0x01, 0x60, 0x44, 0x22, 0x13, 0x82, 0x50, 0x42, 0x0a, 0x01, 
+  0x11, 0x04, 0x0a, 0x01, 0x8a, 0x29, 0x0a, 0x3f, 0x20, 0xad, 0x71, 0x1d, 
+  0x0b, 0x08, 0x01, 0x59, 0x08, 0x1c, 0x01, 0x30, 0x02, 0x08, 0x01, 0x02, 
+  0xb8, 0x00, 0x11, 0x22, 0xb8, 0x00, 0x31, 0x17, 0x0a, 0xbf, 0xb8, 0x00, 
+  0x00, 0xb6, 0x00, 0xa2, 0x42, 0x86, 0x41, 0xc0, 0x61, 0xc1, 0x01, 0xc0, 
+  0x08, 0xf0, 0xbc, 0x00, 0x2f, 0x42, 0x86, 0xbe, 0x00, 0x00, 0x16, 0x0b, 
+  0xbe, 0x00, 0x4f, 0x02, 0x27, 0x42, 0x13, 0xc0, 0x00, 0x05, 0xf5, 0x5d, 
+  0xf0, 0xc2, 0x08, 0x45, 0x14, 0x88, 0x24, 0x85, 0x10, 0xdf, 0xd5, 0x68, 
+  0x3e, 0x66, 0x09, 0x8e, 0x20, 0x85, 0x0c, 0x16, 0x11, 0x10, 0x08, 0x16, 
+  0x90, 0x10, 0x44, 0x20, 0x54, 0x80, 0xca, 0x27, 0x62, 0x10, 0x0f, 0x08, 
+  0xbe, 0x00, 0x10, 0x42, 0x50, 0x22, 0x80, 0x20, 0x09, 0xae, 0x13, 0x09, 
+  0x30, 0x20, 0x09, 0x27, 0x13, 0x14, 0x22, 0x40, 0x8a, 0x0b, 0x6f, 0xee, 
+  0x62, 0x42, 0x15, 0x0f, 0x25, 0x14, 0x02, 0x20, 0xc0, 0x24, 0xc3, 0x41, 
+  0x12, 0x00, 0xa8, 0x66, 0x08, 0xae, 0x27, 0xf0, 0x14, 0x8d, 0x40, 0x86, 
+  0x76, 0x8d, 0x04, 0x71, 0x0f, 0x79, 0x70, 0x71, 0x22, 0x8a, 0x8d, 0x71, 
+  0x63, 0x8a, 0xca, 0x20, 0x26, 0x00, 0x00, 0x2c, 0x42, 0x10, 0x14, 0xad, 
+  0xb0, 0x01, 0x10, 0x40, 0xb0, 0x01, 0x00, 0x34, 0x00, 0xc0, 0xb0, 0x66, 
+  0x11, 0x0b, 0x51, 0x00, 0x65, 0x80, 0x46, 0x7b, 0x65, 0xa0, 0xaa, 0x01, 
+  0x71, 0x07, 0xf0, 0x65, 0x80, 0x65, 0x7a, 0x45, 0x0c, 0x00, 0xf4, 0x2d, 
+  0x0d, 0x09, 0x30, 0x20, 0x00, 0x21, 0xc0, 0x24, 0x03, 0xa6, 0x51, 0x22, 
+  0x40, 0xa0, 0x2e, 0x70, 0x1f, 0xf2, 0x3d, 0x27, 0x02, 0x14, 0x79, 0x24, 
+  0x00, 0x20, 0x05, 0x20, 0xbe, 0x80, 0x17, 0xf2, 0x05, 0x86, 0x04, 0x30, 
+  0x40, 0x84, 0x26, 0x00, 0x2c, 0x00, 0xa1, 0x42, 0x32, 0x0c, 0x8f, 0xfd, 
+  0x14, 0x70, 0x1a, 0x00, 0x2b, 0x00, 0x4a, 0x21, 0xc0, 0x28, 0x03, 0x85, 
+  0x84, 0x01, 0xf3, 0x2a, 0x1f, 0x0f, 0x25, 0x14, 0x2e, 0x70, 0x10, 0xf0, 
+  0x0d, 0x0f, 0x25, 0x14, 0xa1, 0x40, 0x95, 0xff, 0xd0, 0xc6, 0xa1, 0x40, 
+  0x50, 0xff, 0x17, 0x8d, 0x04, 0x77, 0x17, 0xad, 0x46, 0x86, 0x04, 0xea, 
+  0x27, 0x86, 0x60, 0x7a, 0x22, 0x40, 0xd0, 0xc6, 0xe0, 0x78, 0x39, 0x06, 
+  0xef, 0xff, 0x20, 0x40, 0xe0, 0x78, 0xe2, 0xc2, 0x20, 0x40, 0x28, 0x45, 
+  0x47, 0x24, 0x00, 0xf0, 0x07, 0xc2, 0xc6, 0xf1, 0xc0, 0xc8, 0x44, 0x4a, 
+  0x26, 0xc0, 0x01, 0xf8, 0x1c, 0xc8, 0xb1, 0x0a, 0x0c, 0x6f, 0xf5, 0x81, 
+  0x47, 0xa2, 0xc0, 0x4c, 0x03, 0x03, 0x18, 0x00, 0x10, 0x03, 0x18, 0x00, 
+  0x2d, 0xf2, 0x0b, 0x18, 0x00, 0x02, 0x30, 0x00, 0x07, 0x18, 0x00, 0xf0, 
+  0x11, 0xf2, 0xc3, 0xa1, 0xc1, 0x00, 0x10, 0x15, 0x01, 0x08, 0x47, 0x0a, 
+  0x21, 0xc0, 0x21, 0x0a, 0x22, 0x80, 0x21, 0x0a, 0x23, 0x40, 0x21, 0x0a, 
+  0x20, 0x00, 0x21, 0x70, 0x44, 0x2f, 0x27, 0x3f, 0x00, 0x18, 0x01, 0xf0, 
+  0x5d, 0x0d, 0xc6, 0x16, 0x8e, 0x77, 0x8e, 0x04, 0x77, 0x1d, 0x0b, 0x03, 
+  0x00, 0x75, 0x8e, 0x04, 0x86, 0xb5, 0x6b, 0x1d, 0x65, 0x2a, 0xad, 0x19, 
+  0x09, 0xff, 0x20, 0xe0, 0xa5, 0x78, 0x22, 0x03, 0x00, 0x44, 0xa5, 0x0f, 
+  0xf0, 0x6f, 0x26, 0x3f, 0x00, 0x0c, 0x70, 0xd2, 0xc7, 0x20, 0xea, 0x49, 
+  0x20, 0x10, 0x21, 0x28, 0x4d, 0x40, 0x41, 0x02, 0x0a, 0x6f, 0xee, 0x02, 
+  0x42, 0x6c, 0x70, 0x0c, 0xc0, 0x08, 0x1d, 0x02, 0x14, 0x0c, 0x1d, 0x00, 
+  0x15, 0x18, 0x1d, 0xc0, 0x14, 0x1c, 0x1d, 0x80, 0x14, 0x09, 0x1d, 0x42, 
+  0x14, 0x05, 0xa5, 0x80, 0xc0, 0xe1, 0x41, 0x4a, 0x08, 0x6f, 0xf5, 0xa2, 
+  0x42, 0x00, 0xc0, 0x01, 0xa5, 0xc1, 0x40, 0x04, 0xf8, 0x0c, 0x71, 0xd2, 
+  0xc7, 0x48, 0x00, 0x20, 0xdc, 0xf1, 0xf0, 0x00, 0xf0, 0x01, 0x08, 0x45, 
+  0x17, 0x88, 0x84, 0xe8, 0xa1, 0x40, 0x0a, 0xff, 0xa6, 0x09, 0x6f, 0xf5, 
+  0xa1, 0x40, 0x1a, 0x00, 0xf1, 0x29, 0xc2, 0xc6, 0xf6, 0xc2, 0x30, 0x45, 
+  0x08, 0x45, 0x77, 0x58, 0x78, 0x20, 0x13, 0x00, 0x8c, 0xd8, 0x1f, 0x23, 
+  0x0f, 0x20, 0xcb, 0x46, 0xa0, 0x00, 0xcc, 0x49, 0xa1, 0x40, 0x56, 0x0e, 
+  0xef, 0xf9, 0xdf, 0x67, 0x2f, 0x87, 0x10, 0x47, 0x30, 0x41, 0x05, 0xe9, 
+  0x62, 0x40, 0x20, 0x58, 0x10, 0x42, 0xeb, 0x85, 0x2a, 0x85, 0x2f, 0x27, 
+  0xbf, 0x05, 0x88, 0x06, 0xf0, 0x28, 0x26, 0x3f, 0x04, 0x62, 0x40, 0xe1, 
+  0x42, 0x06, 0x0d, 0xef, 0xfc, 0x30, 0x40, 0x8e, 0x71, 0x0d, 0xe8, 0x38, 
+  0x8d, 0x6c, 0x70, 0xa2, 0x42, 0x62, 0x40, 0x0a, 0x24, 0x00, 0x04, 0xe1, 
+  0x45, 0xa1, 0x46, 0x26, 0x58, 0x83, 0xe8, 0x8e, 0x70, 0x4c, 0x71, 0xe2, 
+  0x41, 0x62, 0x40, 0x99, 0x58, 0x2f, 0x26, 0xbf, 0x05, 0x41, 0x09, 0x30, 
+  0x20, 0x4a, 0x00, 0xf0, 0x15, 0x39, 0x08, 0x64, 0x04, 0x62, 0x40, 0x9f, 
+  0x20, 0x02, 0x03, 0xc8, 0x4e, 0x1e, 0x66, 0x1d, 0x0a, 0x64, 0x24, 0x3a, 
+  0x60, 0x21, 0x82, 0x08, 0x86, 0x05, 0x20, 0x7e, 0x80, 0x0e, 0xf2, 0x07, 
+  0x20, 0x00, 0x04, 0xe7, 0x79, 0x0c, 0x00, 0xf0, 0x3d, 0x08, 0xf2, 0x40, 
+  0x23, 0x40, 0x22, 0x20, 0x1e, 0x00, 0x14, 0xe1, 0xa2, 0x8d, 0x58, 0x82, 
+  0x40, 0xd6, 0xc6, 0xea, 0xc2, 0xf2, 0x69, 0x50, 0x41, 0x30, 0x40, 0x5c, 
+  0xd9, 0xe1, 0x42, 0x68, 0x46, 0x32, 0x0f, 0x2f, 0xfc, 0x08, 0x45, 0x4a, 
+  0x24, 0x00, 0x72, 0xa2, 0xa6, 0xfd, 0x65, 0x0c, 0x6d, 0x2c, 0x70, 0xc1, 
+  0x42, 0x03, 0xa6, 0xa8, 0x20, 0xc0, 0x02, 0x01, 0x11, 0x80, 0x24, 0x14, 
+  0x70, 0xca, 0x21, 0x61, 0x00, 0x34, 0x70, 0xc0, 0x78, 0x01, 0x1a, 0x12, 
+  0x00, 0xd0, 0x05, 0xf2, 0x79, 0xe4, 0x7f, 0x20, 0x80, 0x10, 0x1e, 0x00, 
+  0x14, 0xc0, 0xa0, 0x25, 0xa6, 0xca, 0xc6, 0xea, 0xc2, 0x00, 0x16, 0x03, 
+  0x70, 0xa0, 0x00, 0x6c, 0x7f, 0x48, 0x47, 0x30, 0x40, 0xce, 0x6b, 0xc3, 
+  0x43, 0xa0, 0x00, 0xf0, 0xf3, 0x40, 0x23, 0x0d, 0x06, 0x10, 0x41, 0xc3, 
+  0x42, 0x13, 0x00, 0xa4, 0x79, 0xc1, 0x41, 0xa1, 0x40, 0xe4, 0xff, 0x00, 
+  0x19, 0x80, 0x2f, 0xa0, 0x00, 0xf8, 0x7f, 0xc0, 0xa7, 0x00, 0x18, 0x40, 
+  0x23, 0xca, 0xc6, 0xee, 0xc2, 0xc8, 0x47, 0x0a, 0x21, 0x00, 0x21, 0x70, 
+  0x42, 0x48, 0x45, 0x30, 0x40, 0x1d, 0x0d, 0x30, 0x00, 0x10, 0x43, 0x0a, 
+  0xef, 0x40, 0x25, 0x0e, 0x06, 0x66, 0xbd, 0x02, 0x42, 0xa0, 0x43, 0xc1, 
+  0x40, 0xa1, 0x41, 0xd6, 0xff, 0x03, 0xf0, 0xa8, 0x46, 0x62, 0x40, 0x02, 
+  0x41, 0xa1, 0x42, 0x42, 0x43, 0x0a, 0x24, 0x40, 0x04, 0xc1, 0x45, 0x16, 
+  0x0f, 0x6f, 0xfe, 0xe1, 0x46, 0xce, 0xc6, 0xee, 0xc2, 0x8c, 0x00, 0xf0, 
+  0x2e, 0xe0, 0x80, 0x50, 0x42, 0x30, 0x43, 0x6a, 0x20, 0x80, 0x02, 0xae, 
+  0xb8, 0x29, 0x20, 0x00, 0x80, 0x2e, 0x70, 0x32, 0xf0, 0x40, 0x20, 0x11, 
+  0x04, 0x63, 0x0b, 0x44, 0x24, 0x62, 0x87, 0x43, 0x87, 0x60, 0x41, 0x70, 
+  0x40, 0x13, 0x09, 0xa5, 0x00, 0x28, 0x46, 0x20, 0x86, 0xd3, 0x71, 0x5c, 
+  0x5c, 0x5c, 0x5c, 0x24, 0x6e, 0xf8, 0xf3, 0x00, 0x22, 0x0d, 0x20, 0x08, 
+  0xda, 0xa1, 0x92, 0x06, 0xf5, 0x8d, 0x0f, 0x2f, 0xee, 0xc3, 0xa7, 0x02, 
+  0x26, 0x00, 0x14, 0x41, 0x28, 0x02, 0x04, 0x41, 0x28, 0x01, 0x02, 0x0c, 
+  0xad, 0x4e, 0xad, 0x2d, 0xad, 0x24, 0x87, 0x38, 0xb8, 0x0f, 0xad, 0x41, 
+  0x29, 0x83, 0x03, 0x41, 0x29, 0x82, 0x01, 0x12, 0x69, 0x6a, 0xad, 0x49, 
+  0xad, 0x08, 0xad, 0xe5, 0x87, 0x36, 0xb9, 0x2b, 0xad, 0x2f, 0x20, 0x48, 
+  0x04, 0xce, 0xef, 0x6a, 0x21, 0x80, 0x02, 0x8e, 0xb9, 0x29, 0x20, 0x40, 
+  0x80, 0xce, 0xc6, 0xe0, 0x78, 0xea, 0xc2, 0x08, 0x47, 0xcd, 0x70, 0xad, 
+  0x70, 0x37, 0xf0, 0x00, 0x16, 0x01, 0x70, 0xa0, 0x00, 0x4c, 0x40, 0x5a, 
+  0x25, 0x00, 0x16, 0x1a, 0x61, 0x00, 0x12, 0x0b, 0x01, 0x59, 0x0b, 0x7e, 
+  0x10, 0x50, 0x40, 0x16, 0x40, 0x02, 0x20, 0xd1, 0x83, 0x43, 0x26, 0x01, 
+  0x90, 0x07, 0xd8, 0x3c, 0x20, 0x42, 0x04, 0x7f, 0x21, 0x00, 0x00, 0x34, 
+  0x70, 0xca, 0x20, 0x81, 0x00, 0x9a, 0xe8, 0x0e, 0x40, 0x40, 0x20, 0x4c, 
+  0x80, 0x41, 0x26, 0x03, 0x90, 0x00, 0x21, 0x11, 0xa3, 0x01, 0x21, 0xc1, 
+  0x80, 0x7c, 0x21, 0x02, 0x22, 0x7a, 0x22, 0x00, 0xf0, 0x71, 0xf6, 0xe8, 
+  0x4f, 0x23, 0x80, 0x10, 0x0d, 0x0b, 0xfe, 0x10, 0x00, 0x18, 0x04, 0x20, 
+  0x02, 0x40, 0x7e, 0x58, 0x08, 0x18, 0x40, 0x24, 0xa5, 0x71, 0x00, 0x16, 
+  0xc0, 0x70, 0xa0, 0x00, 0x50, 0x40, 0x8f, 0x0d, 0x02, 0x90, 0xca, 0xc6, 
+  0xe4, 0xc2, 0xe1, 0xc4, 0xfc, 0x1c, 0xc8, 0xb2, 0xfc, 0x1c, 0x88, 0xb2, 
+  0xfc, 0x1c, 0x48, 0xb2, 0xfc, 0x1c, 0x08, 0xb2, 0xfc, 0x1c, 0xc8, 0xb1, 
+  0xfc, 0x1c, 0x88, 0xb1, 0xfc, 0x1c, 0x48, 0xb1, 0xfc, 0x1c, 0x08, 0xb1, 
+  0xe1, 0xc3, 0xe1, 0xc2, 0xe1, 0xc1, 0xe1, 0xc0, 0xfc, 0x1c, 0x88, 0xb7, 
+  0x6a, 0x25, 0xc0, 0x10, 0xe1, 0xc5, 0x6a, 0x25, 0x80, 0x10, 0xe1, 0xc5, 
+  0xfc, 0x1c, 0x08, 0xbf, 0xcb, 0x45, 0xf0, 0x00, 0xa0, 0x01, 0x00, 0x85, 
+  0xa0, 0xb8, 0x00, 0xa5, 0x04, 0x15, 0x02, 0x10, 0x22, 0x85, 0x02, 0x85, 
+  0xe0, 0x78, 0xfd, 0x09, 0x01, 0x80, 0xd0, 0x02, 0xf0, 0x09, 0xe8, 0x7f, 
+  0x00, 0x8e, 0x59, 0x61, 0x38, 0x60, 0x9a, 0x58, 0x00, 0x1e, 0xc3, 0x11, 
+  0x00, 0x85, 0x81, 0xb8, 0x00, 0xa5, 0xa1, 0x58, 0x40, 0xd9, 0xa2, 0x04, 
+  0xf0, 0x0f, 0x2c, 0x01, 0x20, 0xa0, 0x2a, 0x09, 0x4f, 0xfc, 0x05, 0xe8, 
+  0x00, 0x85, 0x80, 0xb8, 0x00, 0xa5, 0x09, 0x58, 0xc1, 0xc5, 0x0a, 0x24, 
+  0x40, 0x73, 0xc1, 0xc5, 0x6b, 0x25, 0x80, 0x10, 0x06, 0x00, 0xf4, 0x39, 
+  0xc0, 0x10, 0x04, 0x14, 0x1e, 0x34, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc2, 
+  0xc1, 0xc3, 0x04, 0x14, 0x04, 0x34, 0x04, 0x14, 0x05, 0x34, 0x04, 0x14, 
+  0x06, 0x34, 0x04, 0x14, 0x07, 0x34, 0x04, 0x14, 0x08, 0x34, 0x04, 0x14, 
+  0x09, 0x34, 0x04, 0x14, 0x0a, 0x34, 0x04, 0x14, 0x0b, 0x34, 0xc1, 0xc4, 
+  0xc4, 0xc2, 0x6f, 0x24, 0x3f, 0x00, 0xe0, 0x78, 0xee, 0xc2, 0x81, 0x58, 
+  0x14, 0x70, 0xa0, 0x00, 0x21, 0x00, 0x08, 0x45, 0x2f, 0x27, 0xff, 0x04, 
+  0x36, 0x03, 0x81, 0x00, 0x8d, 0xe1, 0xb8, 0x42, 0xf4, 0xcb, 0x46, 0xb2, 
+  0x00, 0xb0, 0x86, 0xa0, 0xb8, 0x00, 0x1e, 0x00, 0x10, 0x22, 0x86, 0x02, 
+  0x86, 0xb0, 0x00, 0xe0, 0x21, 0x80, 0x30, 0x41, 0x9a, 0x08, 0x6f, 0xfc, 
+  0x04, 0x16, 0x12, 0x10, 0xd3, 0x40, 0xba, 0x00, 0xf0, 0x4f, 0xcb, 0x47, 
+  0xf0, 0x00, 0x20, 0x01, 0x14, 0xe8, 0x02, 0x85, 0x42, 0x20, 0xc0, 0x81, 
+  0xca, 0x20, 0x6e, 0x00, 0x02, 0xa5, 0x24, 0x87, 0x1f, 0x09, 0xbf, 0x01, 
+  0x42, 0x70, 0x40, 0x21, 0x80, 0x21, 0x9a, 0x58, 0x00, 0x10, 0x80, 0x20, 
+  0x04, 0x71, 0x00, 0x18, 0x02, 0x20, 0x06, 0xf0, 0x00, 0x18, 0xc3, 0x21, 
+  0x04, 0xf0, 0x02, 0xa5, 0xa1, 0x40, 0x7c, 0x58, 0x00, 0x95, 0x81, 0xb8, 
+  0x00, 0xb5, 0x40, 0xd8, 0x00, 0xa7, 0x06, 0xa7, 0x00, 0x86, 0x81, 0xb8, 
+  0x00, 0xa6, 0x04, 0x87, 0x0d, 0x08, 0x9f, 0x01, 0xa1, 0x58, 0x00, 0x86, 
+  0x80, 0xb8, 0x00, 0xa6, 0x2f, 0x26, 0xff, 0x04, 0x00, 0x02, 0xf0, 0x09, 
+  0x05, 0xe8, 0x00, 0x18, 0x84, 0x0f, 0x00, 0x00, 0xe8, 0x07, 0x06, 0xe9, 
+  0x00, 0x19, 0x82, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x05, 0xea, 0x00, 0x1a, 
+  0x0a, 0x00, 0x60, 0x1c, 0x00, 0x06, 0xeb, 0x00, 0x1b, 0x0a, 0x00, 0x80, 
+  0x0d, 0x00, 0x0d, 0x0c, 0x10, 0x00, 0x00, 0x1c, 0x0c, 0x00, 0x80, 0x1b, 
+  0x00, 0xb4, 0x70, 0xe0, 0x7c, 0x00, 0x1d, 0x0c, 0x00, 0xf0, 0x49, 0x19, 
+  0x00, 0xe0, 0x7e, 0xe0, 0x78, 0xa8, 0x10, 0x00, 0x01, 0x14, 0x70, 0xe0, 
+  0x7f, 0xca, 0x20, 0x61, 0x00, 0xe2, 0xc2, 0xe6, 0xe1, 0x17, 0xf4, 0x8d, 
+  0x76, 0x66, 0xdd, 0x93, 0xbc, 0xc3, 0x41, 0xa1, 0x00, 0xf0, 0x11, 0x00, 
+  0x1e, 0x42, 0x73, 0xf0, 0x00, 0x48, 0x00, 0x80, 0xa1, 0x05, 0x19, 0x83, 
+  0x02, 0x43, 0xb1, 0x18, 0x88, 0x64, 0xb1, 0x0a, 0x19, 0x04, 0x01, 0x04, 
+  0xa9, 0x0c, 0x71, 0x64, 0x58, 0xc2, 0xc6, 0x06, 0x0f, 0x8f, 0xfc, 0xc2, 
+  0xc6, 0xe4, 0xc3, 0xa7, 0xc1, 0x08, 0x46, 0x34, 0x58, 0x08, 0x45, 0x2e, 
+  0x58, 0x00, 0x42, 0x46, 0x03, 0xf0, 0x23, 0x33, 0x58, 0x08, 0x45, 0x0f, 
+  0xe8, 0x2f, 0x85, 0x60, 0x79, 0xa1, 0x40, 0x25, 0x08, 0xb5, 0x00, 0x10, 
+  0xd8, 0x4e, 0x85, 0x60, 0x7a, 0xa1, 0x41, 0x25, 0x08, 0x30, 0x04, 0x6f, 
+  0xd9, 0x09, 0xf0, 0x4c, 0x70, 0x80, 0xc0, 0x22, 0xd9, 0x6c, 0x70, 0x40, 
+  0x44, 0x66, 0xc6, 0x07, 0xf0, 0x66, 0xd9, 0x4c, 0x70, 0x0c, 0x00, 0xf0, 
+  0x09, 0xa1, 0x40, 0x6c, 0x58, 0xc4, 0xc7, 0xe0, 0x78, 0xf1, 0xc0, 0x08, 
+  0xb8, 0x0a, 0x27, 0x40, 0x01, 0x98, 0xb8, 0x4a, 0x25, 0x00, 0x02, 0x53, 
+  0x58, 0xa0, 0x05, 0x00, 0x10, 0x00, 0x40, 0xb5, 0x06, 0x2f, 0xf5, 0x12, 
+  0x00, 0xf2, 0x19, 0xf1, 0xc0, 0x00, 0x35, 0x8c, 0x0f, 0x80, 0x42, 0x00, 
+  0x00, 0x0a, 0x27, 0x80, 0x01, 0x48, 0x34, 0x46, 0x12, 0x08, 0xb8, 0x2f, 
+  0x24, 0x88, 0x11, 0x0f, 0x0c, 0x34, 0x11, 0x98, 0xb8, 0x00, 0x24, 0x86, 
+  0x1f, 0x00, 0x00, 0xfc, 0xff, 0xac, 0x72, 0x3a, 0x00, 0x00, 0x50, 0x00, 
+  0x0f, 0x30, 0x00, 0x11, 0x35, 0x4a, 0x25, 0x80, 0x6c, 0x00, 0x71, 0x80, 
+  0x01, 0x0a, 0x26, 0x40, 0x01, 0x45, 0x70, 0x00, 0x1f, 0xc0, 0x70, 0x00, 
+  0x06, 0x3f, 0x8f, 0xb8, 0x11, 0x72, 0x00, 0x02, 0x11, 0xf1, 0xea, 0x02, 
+  0x40, 0xaa, 0x08, 0x4f, 0xfa, 0x80, 0x02, 0x04, 0x84, 0x00, 0x00, 0x14, 
+  0x00, 0x46, 0x62, 0x0a, 0x8f, 0xed, 0x14, 0x00, 0x00, 0x12, 0x00, 0x80, 
+  0xe1, 0xc0, 0xe1, 0xc1, 0xe1, 0xc2, 0xe1, 0xc3, 0x28, 0x03, 0x02, 0x30, 
+  0x03, 0x00, 0x38, 0x03, 0x00, 0x40, 0x03, 0x00, 0x48, 0x03, 0x00, 0x50, 
+  0x03, 0x00, 0x58, 0x03, 0x40, 0xc8, 0xb2, 0xe1, 0xc4, 0x42, 0x00, 0xf0, 
+  0x0d, 0x08, 0xbf, 0x6a, 0x20, 0x80, 0x00, 0xe1, 0xc0, 0x6a, 0x20, 0xc0, 
+  0x00, 0xe1, 0xc0, 0xaa, 0x20, 0x90, 0x02, 0x77, 0xb8, 0x0f, 0x78, 0x0f, 
+  0x08, 0x50, 0x00, 0x8a, 0xe8, 0x9c, 0x04, 0x40, 0xec, 0x40, 0x04, 0xf0, 
+  0x08, 0x00, 0xc0, 0x08, 0x41, 0xca, 0x0f, 0x8f, 0xff, 0xc1, 0xc0, 0x6b, 
+  0x20, 0xc0, 0x00, 0x06, 0x00, 0xc0, 0x80, 0x00, 0xc1, 0xc0, 0x0a, 0x24, 
+  0x00, 0x70, 0xd1, 0xc0, 0xc1, 0xc4, 0xec, 0x02, 0x02, 0xf4, 0x02, 0x00, 
+  0xfc, 0x02, 0x00, 0x04, 0x03, 0x00, 0x0c, 0x03, 0x00, 0x14, 0x03, 0x00, 
+  0x1c, 0x03, 0xa0, 0x04, 0x34, 0xc1, 0xc3, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1, 
+  0xc0, 0xa8, 0x00, 0x02, 0x10, 0x03, 0x1f, 0xe8, 0xe4, 0x03, 0x2c, 0x00, 
+  0xa8, 0x00, 0xf0, 0x11, 0x42, 0x20, 0xc1, 0x08, 0x42, 0x20, 0x40, 0x09, 
+  0x2f, 0x7c, 0x4c, 0x73, 0x91, 0x40, 0x11, 0x0c, 0xb5, 0x11, 0x0f, 0x7b, 
+  0x48, 0x20, 0x82, 0x20, 0x80, 0x22, 0x83, 0x0f, 0xb3, 0x6a, 0xcd, 0x71, 
+  0xb6, 0x00, 0x62, 0x74, 0x49, 0x84, 0x25, 0x1f, 0x1e, 0x38, 0x03, 0x44, 
+  0x78, 0x7e, 0x1d, 0x65, 0x78, 0x07, 0xff, 0x0f, 0xc9, 0xa7, 0x41, 0x85, 
+  0x20, 0x85, 0x04, 0x1d, 0x01, 0x10, 0x00, 0x1d, 0x01, 0x10, 0x2f, 0x26, 
+  0x3f, 0x00, 0x02, 0x40, 0x45, 0x58, 0x0a, 0x87, 0xc4, 0x78, 0xd1, 0x70, 
+  0xee, 0xf3, 0xf6, 0x03, 0x2d, 0x11, 0xc8, 0xf6, 0x03, 0x40, 0xf0, 0xc2, 
+  0x08, 0x45, 0x48, 0x06, 0x20, 0xd3, 0x4d, 0xbe, 0x03, 0x20, 0xa0, 0x4d, 
+  0x90, 0x00, 0xf0, 0x1b, 0xe0, 0x4d, 0x8a, 0x21, 0x87, 0x0d, 0x76, 0xda, 
+  0x8e, 0x70, 0x00, 0x1b, 0x43, 0x00, 0x17, 0x18, 0x03, 0x20, 0x0f, 0x18, 
+  0x83, 0x00, 0x08, 0x18, 0x40, 0x20, 0x24, 0x18, 0x40, 0x20, 0x40, 0xa0, 
+  0x5d, 0x58, 0x1d, 0x08, 0x85, 0x0f, 0x00, 0x00, 0xf8, 0x13, 0x90, 0x04, 
+  0xf1, 0x9e, 0x34, 0x00, 0x28, 0xd9, 0x4c, 0x70, 0x34, 0xa8, 0x15, 0x18, 
+  0x03, 0x00, 0x6d, 0xf0, 0x89, 0x25, 0x01, 0x19, 0x64, 0xd8, 0x88, 0x25, 
+  0x3e, 0x17, 0xa2, 0x78, 0xc8, 0xd9, 0x0f, 0x7e, 0xd7, 0x49, 0xd1, 0x41, 
+  0xd1, 0x77, 0x0c, 0x72, 0x8a, 0x21, 0x0a, 0x0c, 0xb2, 0x0f, 0x2f, 0xf9, 
+  0xca, 0x21, 0xc5, 0x23, 0x10, 0x43, 0x5d, 0x58, 0x08, 0x45, 0x5b, 0x58, 
+  0x10, 0x42, 0x96, 0x08, 0xaf, 0xf7, 0x16, 0x40, 0x0c, 0x22, 0x00, 0xa0, 
+  0xc2, 0x25, 0x85, 0x14, 0x1a, 0x25, 0x51, 0x14, 0x3d, 0x27, 0x8d, 0x13, 
+  0x5f, 0x25, 0x00, 0x17, 0x85, 0x29, 0x03, 0x22, 0x02, 0x70, 0x02, 0x80, 
+  0x04, 0x21, 0x91, 0x2f, 0xff, 0x01, 0xfc, 0xff, 0x6a, 0x08, 0xaf, 0xf7, 
+  0x20, 0xe0, 0x14, 0x78, 0x20, 0xe0, 0x32, 0x70, 0xca, 0x21, 0x0d, 0x20, 
+  0xa1, 0x40, 0x66, 0x0f, 0x2f, 0xf9, 0x22, 0x41, 0x10, 0x41, 0x3c, 0x27, 
+  0x8f, 0x13, 0x5b, 0x58, 0x08, 0x45, 0x5c, 0x58, 0x17, 0x08, 0x35, 0x08, 
+  0x08, 0x46, 0x1f, 0xd8, 0xa0, 0xe5, 0x3c, 0x20, 0x54, 0x03, 0xca, 0x26, 
+  0x25, 0x10, 0xca, 0x25, 0x25, 0x10, 0x5f, 0x27, 0x00, 0x17, 0x04, 0x21, 
+  0xd1, 0x24, 0x00, 0x20, 0x10, 0x20, 0x26, 0x70, 0x00, 0xf0, 0x07, 0x15, 
+  0x0c, 0x30, 0x20, 0x42, 0x25, 0x01, 0x18, 0x09, 0x29, 0x01, 0x00, 0x09, 
+  0x2e, 0x02, 0x10, 0x48, 0x49, 0x09, 0xf0, 0x42, 0x26, 0x10, 0x00, 0xf0, 
+  0x37, 0x02, 0x00, 0x09, 0x2d, 0x00, 0x10, 0x20, 0xe2, 0xdd, 0x65, 0x10, 
+  0x4d, 0x51, 0x48, 0x02, 0x0f, 0x2f, 0xf9, 0xe1, 0x40, 0x04, 0x21, 0x02, 
+  0x20, 0x40, 0x40, 0xd0, 0xc6, 0xe0, 0x78, 0x50, 0x20, 0xc3, 0x07, 0x00, 
+  0x42, 0x41, 0x28, 0xc1, 0x07, 0x21, 0x0b, 0x84, 0x0f, 0xb1, 0x42, 0x18, 
+  0x72, 0xc3, 0x40, 0x13, 0x00, 0xac, 0x79, 0x3d, 0x0b, 0x84, 0x0f, 0x80, 
+  0x7f, 0x01, 0x00, 0x2c, 0x71, 0x19, 0x06, 0x20, 0x00, 0x6c, 0x70, 0x10, 
+  0x00, 0xc0, 0xb1, 0x3e, 0x19, 0x72, 0x89, 0x0b, 0x85, 0x0f, 0x85, 0x3f, 
+  0x92, 0x15, 0x26, 0x00, 0xf0, 0x41, 0xbc, 0x79, 0x15, 0x20, 0x43, 0x00, 
+  0x08, 0x13, 0x0b, 0x00, 0x23, 0x48, 0x52, 0x21, 0x00, 0x00, 0x99, 0x00, 
+  0x20, 0x00, 0x02, 0x20, 0x4c, 0x00, 0x3d, 0x0b, 0x81, 0x0f, 0x80, 0x7f, 
+  0x00, 0x00, 0x41, 0x0a, 0x13, 0x00, 0xe0, 0x7f, 0x0c, 0x70, 0x01, 0x32, 
+  0x80, 0x0f, 0x49, 0x71, 0xca, 0xf2, 0x7f, 0xd9, 0x17, 0xb9, 0x04, 0x30, 
+  0x40, 0x80, 0x14, 0x00, 0x2c, 0x00, 0x8d, 0x70, 0x11, 0x0b, 0x85, 0x0f, 
+  0x80, 0x31, 0x00, 0x00, 0xe0, 0x7f, 0x01, 0x32, 0x40, 0x00, 0x6d, 0x70, 
+  0x65, 0x00, 0x68, 0x00, 0xf4, 0x01, 0x04, 0x32, 0x80, 0x8f, 0xb1, 0x42, 
+  0x80, 0x71, 0x0c, 0x00, 0x0c, 0x00, 0x2c, 0x71, 0xa9, 0x04, 0x14, 0x00, 
+  0xf0, 0x4d, 0xcf, 0xc2, 0xb5, 0xf1, 0x0c, 0x00, 0x26, 0x00, 0x6c, 0x70, 
+  0x11, 0x05, 0x20, 0x00, 0x2c, 0x71, 0xf0, 0x26, 0x41, 0x70, 0x13, 0x00, 
+  0xb4, 0x79, 0x00, 0x32, 0x80, 0x0f, 0xb8, 0x3f, 0x3b, 0xaa, 0x01, 0x30, 
+  0x40, 0x00, 0x48, 0x30, 0xcc, 0x02, 0x48, 0x34, 0x80, 0x10, 0x00, 0x30, 
+  0x8b, 0x0f, 0x17, 0x37, 0xd1, 0xf7, 0x00, 0x30, 0x83, 0x0f, 0x31, 0x3f, 
+  0x80, 0x71, 0x02, 0x32, 0xc3, 0x00, 0x02, 0x33, 0xc2, 0x02, 0x00, 0x32, 
+  0x80, 0x00, 0x00, 0x30, 0x81, 0x0f, 0x31, 0x33, 0x4c, 0xbb, 0x01, 0x31, 
+  0x81, 0x0f, 0xdd, 0xb5, 0x0e, 0xea, 0x00, 0x30, 0x41, 0x00, 0x0c, 0x00, 
+  0x44, 0x8a, 0x38, 0x55, 0xb3, 0x0c, 0x00, 0x44, 0x36, 0xbb, 0x61, 0x0b, 
+  0x0c, 0x00, 0xf0, 0x36, 0x2a, 0x3e, 0xab, 0xaa, 0x00, 0x30, 0x40, 0x00, 
+  0x02, 0x32, 0x00, 0x00, 0x43, 0x0c, 0x30, 0x10, 0x00, 0x32, 0x01, 0x00, 
+  0x02, 0x36, 0x00, 0x70, 0x00, 0x40, 0x00, 0x00, 0x07, 0x31, 0x00, 0x00, 
+  0x40, 0x2c, 0xc1, 0x15, 0x8c, 0x24, 0xfe, 0x90, 0x02, 0x33, 0x00, 0x10, 
+  0x02, 0x33, 0x00, 0x00, 0x01, 0x30, 0x80, 0x0f, 0x80, 0x3f, 0x00, 0x00, 
+  0x38, 0x60, 0xe0, 0x20, 0xca, 0x07, 0xc3, 0x70, 0x00, 0x32, 0x00, 0x00, 
+  0x00, 0x14, 0x00, 0x50, 0x0d, 0x00, 0x00, 0xe0, 0x7e, 0x1e, 0x00, 0x22, 
+  0x00, 0xc0, 0x3a, 0x00, 0x00, 0x52, 0x00, 0x04, 0x2e, 0x00, 0xf0, 0x09, 
+  0xe0, 0x7e, 0xf8, 0x1c, 0x48, 0xb3, 0x04, 0x1c, 0xc0, 0x37, 0x00, 0x42, 
+  0xad, 0x08, 0x83, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x50, 0x22, 0xfe, 0x87, 
+  0x66, 0x01, 0xf1, 0x12, 0xcc, 0x79, 0xac, 0x00, 0x21, 0x00, 0x2c, 0x71, 
+  0x54, 0x70, 0x3c, 0x01, 0x2b, 0x00, 0x4a, 0x21, 0x40, 0x00, 0x00, 0x32, 
+  0x82, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x8a, 0x25, 0xff, 0x19, 0x89, 0x0a, 
+  0x83, 0x6c, 0x01, 0xf0, 0x37, 0x53, 0x22, 0x80, 0x05, 0x8d, 0x70, 0x97, 
+  0xbc, 0x00, 0x20, 0x83, 0x0f, 0x4a, 0x00, 0x20, 0xfb, 0x41, 0x2c, 0x0b, 
+  0x12, 0x42, 0x2a, 0xc1, 0x05, 0x64, 0x7c, 0x00, 0x23, 0x8b, 0x10, 0xb9, 
+  0x61, 0x37, 0xbb, 0x05, 0x7c, 0x7f, 0xda, 0x17, 0xba, 0x04, 0x23, 0x8d, 
+  0x1f, 0x7f, 0x00, 0x00, 0xc0, 0x79, 0x61, 0x47, 0x7c, 0x9f, 0xba, 0x80, 
+  0x21, 0x7e, 0x00, 0x01, 0x34, 0x82, 0x10, 0x5d, 0x0d, 0x85, 0x1f, 0x00, 
+  0x00, 0x00, 0xc0, 0x74, 0x00, 0xf2, 0x06, 0xf4, 0x00, 0x22, 0x00, 0x34, 
+  0x70, 0x6c, 0x01, 0x21, 0x00, 0x4a, 0x25, 0x00, 0x10, 0x48, 0x31, 0x81, 
+  0x00, 0x00, 0x31, 0x80, 0x50, 0x01, 0x21, 0x31, 0x81, 0x50, 0x01, 0x71, 
+  0x51, 0x01, 0x20, 0x00, 0x01, 0x31, 0x0d, 0x20, 0x00, 0x40, 0x89, 0x0a, 
+  0x82, 0x8f, 0x80, 0x00, 0x10, 0x3d, 0x14, 0x00, 0xf1, 0x08, 0x32, 0x8d, 
+  0x00, 0xf6, 0x0a, 0x20, 0x00, 0x4a, 0x23, 0x00, 0x00, 0x2d, 0x01, 0x20, 
+  0x00, 0x52, 0x20, 0xcd, 0x07, 0x01, 0x32, 0x83, 0x0f, 0x2c, 0x01, 0x00, 
+  0x84, 0x01, 0xf0, 0x1e, 0x26, 0x0c, 0x70, 0x35, 0x00, 0x88, 0xc2, 0xc3, 
+  0x70, 0xcf, 0xff, 0x30, 0x5c, 0x85, 0x78, 0x14, 0x70, 0x00, 0x33, 0xcc, 
+  0x00, 0x00, 0x34, 0x00, 0x13, 0x00, 0x30, 0x8d, 0x0f, 0x78, 0x3e, 0x26, 
+  0x9e, 0x01, 0x35, 0x8d, 0x1f, 0xcc, 0x3e, 0x13, 0xce, 0x00, 0x30, 0x4d, 
+  0x03, 0x36, 0x01, 0x40, 0x91, 0x3e, 0xee, 0xe9, 0x24, 0x01, 0x60, 0x2a, 
+  0x3f, 0xaa, 0xaa, 0x00, 0x34, 0x8e, 0x00, 0xa0, 0x8b, 0x00, 0x94, 0x00, 
+  0x2c, 0x00, 0x01, 0x30, 0x4c, 0x03, 0xfa, 0x01, 0xf0, 0x0b, 0x00, 0x3f, 
+  0x00, 0x00, 0x00, 0x32, 0x0d, 0x00, 0x01, 0x35, 0x00, 0x13, 0x34, 0x70, 
+  0xa8, 0x00, 0x21, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x33, 0x80, 0x1f, 
+  0xb0, 0x00, 0x00, 0x14, 0x02, 0x10, 0x81, 0x94, 0x02, 0x50, 0x35, 0x00, 
+  0x10, 0x52, 0x0b, 0x4a, 0x02, 0xf0, 0x05, 0x22, 0x0b, 0x2f, 0xf6, 0x08, 
+  0x45, 0x00, 0x80, 0x91, 0x08, 0x51, 0x08, 0xcb, 0x45, 0x80, 0xff, 0x00, 
+  0x00, 0x85, 0x00, 0x42, 0x00, 0x61, 0x80, 0x0f, 0xaa, 0xbe, 0xab, 0xaa, 
+  0x9e, 0x01, 0x01, 0x52, 0x00, 0xa2, 0x83, 0x00, 0x61, 0x09, 0x30, 0x00, 
+  0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x40, 0x83, 0x0f, 0x17, 0xb7, 0x50, 
+  0x00, 0x11, 0xc3, 0x0c, 0x01, 0x01, 0x54, 0x02, 0x40, 0x33, 0x81, 0x00, 
+  0x49, 0x5c, 0x00, 0x20, 0x30, 0x4d, 0xca, 0x01, 0x68, 0x03, 0x4c, 0x21, 
+  0x00, 0x80, 0x34, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0xe6, 0x01, 0x70, 
+  0x30, 0x80, 0x00, 0x00, 0x33, 0x81, 0x1f, 0x34, 0x00, 0x10, 0x19, 0x30, 
+  0x00, 0x80, 0x31, 0x0d, 0x00, 0x02, 0x35, 0x40, 0x10, 0x0d, 0x0c, 0x00, 
+  0xf7, 0x71, 0x32, 0x0d, 0x00, 0x02, 0x32, 0x4d, 0x00, 0xa1, 0x40, 0x04, 
+  0x14, 0x1f, 0x30, 0xe0, 0x7f, 0x08, 0x14, 0x0d, 0x34, 0xec, 0x1c, 0xc8, 
+  0xb6, 0x0a, 0x23, 0x00, 0x37, 0x41, 0xc5, 0x42, 0xc6, 0x43, 0xc7, 0x10, 
+  0x1c, 0xc0, 0x37, 0xe8, 0x46, 0xc8, 0x45, 0x42, 0x24, 0x1c, 0x38, 0x6c, 
+  0x24, 0x9c, 0x30, 0x8b, 0x47, 0x40, 0xc0, 0xe1, 0x40, 0x1c, 0x1c, 0xc0, 
+  0x31, 0x18, 0x1c, 0x80, 0x31, 0x14, 0x1c, 0x40, 0x31, 0x10, 0x1c, 0x00, 
+  0x31, 0x43, 0xc3, 0x42, 0xc2, 0xba, 0x0b, 0x20, 0x00, 0x41, 0xc1, 0x06, 
+  0xe8, 0xc7, 0x87, 0x15, 0x00, 0x20, 0x00, 0xa6, 0x87, 0x36, 0x0a, 0x2f, 
+  0xf6, 0x18, 0x13, 0x0f, 0x30, 0x00, 0x18, 0xc0, 0x03, 0xa1, 0x40, 0xc1, 
+  0x41, 0x0a, 0x24, 0xc0, 0x36, 0x10, 0x14, 0x1f, 0x30, 0x03, 0xc7, 0x02, 
+  0xc6, 0x01, 0xc5, 0xe0, 0x7f, 0x14, 0x14, 0x1b, 0x34, 0xf0, 0x6c, 0x00, 
+  0x45, 0x0c, 0x1c, 0xc0, 0x37, 0x66, 0x00, 0x40, 0x45, 0xcb, 0x46, 0xf0, 
+  0xc0, 0x03, 0x38, 0xc0, 0xa1, 0x40, 0x64, 0x00, 0x60, 0x47, 0xc6, 0x18, 
+  0x1c, 0x01, 0x30, 0x4a, 0x01, 0x80, 0x00, 0x1c, 0xc1, 0x30, 0x06, 0xe8, 
+  0xc7, 0x85, 0xd2, 0x00, 0x60, 0xa6, 0x85, 0xca, 0x09, 0x2f, 0xf6, 0x0c, 
+  0x02, 0x84, 0x00, 0x18, 0x80, 0x0f, 0x00, 0x00, 0x22, 0x00, 0x70, 0x00, 
+  0x42, 0x0c, 0x14, 0x1f, 0x30, 0x6e, 0x00, 0x75, 0x10, 0x14, 0x1b, 0x34, 
+  0xe0, 0x78, 0xf4, 0x70, 0x00, 0x19, 0x08, 0x6e, 0x00, 0x0c, 0x68, 0x00, 
+  0x40, 0x1c, 0x1c, 0x01, 0x30, 0x6a, 0x00, 0x20, 0xe6, 0x0a, 0x6a, 0x00, 
+  0x51, 0x01, 0x31, 0x06, 0xe8, 0x27, 0x6a, 0x00, 0xc6, 0x18, 0x15, 0x0d, 
+  0x10, 0x5e, 0x09, 0x2f, 0xf6, 0xad, 0x70, 0x2c, 0x70, 0x6c, 0x00, 0x00, 
+  0x6a, 0x00, 0x40, 0x08, 0x14, 0x1f, 0x30, 0x68, 0x00, 0x11, 0x0c, 0x68, 
+  0x00, 0x0f, 0xd8, 0x00, 0x09, 0x1f, 0xf8, 0xd8, 0x00, 0x06, 0x11, 0x7a, 
+  0x6e, 0x00, 0x17, 0x41, 0xd8, 0x00, 0x28, 0xf2, 0x08, 0xd8, 0x00, 0x1f, 
+  0x21, 0xd8, 0x00, 0x06, 0x0e, 0xb4, 0x01, 0x40, 0x08, 0x47, 0x60, 0x40, 
+  0xbe, 0x00, 0x15, 0x48, 0xba, 0x01, 0xf0, 0x07, 0x44, 0xc0, 0xa1, 0x40, 
+  0x8b, 0x46, 0xd2, 0x0a, 0x20, 0x00, 0x45, 0xc1, 0x42, 0xc0, 0xc1, 0x40, 
+  0x43, 0xc1, 0x1c, 0x1c, 0x80, 0x3f, 0x66, 0x01, 0x00, 0x7c, 0x00, 0x44, 
+  0x41, 0xc7, 0xfa, 0x09, 0x56, 0x01, 0xe4, 0x06, 0x86, 0x1a, 0x0b, 0x20, 
+  0x00, 0x27, 0x86, 0x0a, 0xf0, 0x72, 0x08, 0x0f, 0xf6, 0xe8, 0x00, 0x4f, 
+  0xff, 0xd8, 0x17, 0xb8, 0xc4, 0x01, 0x01, 0x0f, 0x7c, 0x00, 0x03, 0x1f, 
+  0x6a, 0x7c, 0x00, 0x00, 0x19, 0x56, 0x7c, 0x00, 0x02, 0x62, 0x01, 0x31, 
+  0x41, 0xc7, 0x82, 0x78, 0x00, 0x00, 0x64, 0x01, 0x42, 0x06, 0x86, 0xa2, 
+  0x0a, 0x78, 0x00, 0x44, 0xfa, 0x0f, 0xcf, 0xf5, 0x78, 0x00, 0x4f, 0x4a, 
+  0x20, 0x00, 0x00, 0x78, 0x00, 0x17, 0x2e, 0xf2, 0x09, 0x78, 0x00, 0x2a, 
+  0xde, 0x09, 0xf4, 0x00, 0x00, 0x82, 0x01, 0x02, 0x7c, 0x00, 0x11, 0x06, 
+  0x7c, 0x00, 0x00, 0x72, 0x01, 0x31, 0x06, 0x86, 0x26, 0x7c, 0x00, 0x35, 
+  0x0c, 0xf0, 0x7e, 0x7c, 0x00, 0x8f, 0x21, 0x00, 0x0a, 0x20, 0x80, 0x0f, 
+  0xc0, 0x7f, 0x80, 0x00, 0x03, 0xf1, 0x5e, 0xe8, 0x1c, 0x48, 0xb3, 0x41, 
+  0xc6, 0x42, 0xc7, 0x0c, 0x1c, 0x00, 0x34, 0x10, 0x1c, 0x40, 0x34, 0x14, 
+  0x1c, 0xc0, 0x37, 0x68, 0x46, 0x48, 0x47, 0x61, 0x82, 0x2d, 0x0e, 0xb2, 
+  0x10, 0x40, 0x82, 0x30, 0x40, 0x10, 0x41, 0x4a, 0x25, 0x40, 0x10, 0x22, 
+  0x40, 0x76, 0x0a, 0x20, 0x00, 0x02, 0x41, 0x08, 0x17, 0x02, 0x12, 0xd6, 
+  0x0e, 0x20, 0x00, 0x61, 0x87, 0xa5, 0x71, 0x00, 0x42, 0xed, 0x0d, 0xa2, 
+  0x93, 0x20, 0x43, 0x40, 0x40, 0x60, 0x41, 0x14, 0x14, 0x1f, 0x30, 0x10, 
+  0x14, 0x11, 0x30, 0x0c, 0x14, 0x10, 0x30, 0x02, 0xc7, 0x01, 0xc6, 0xe0, 
+  0x7f, 0x18, 0x14, 0x0d, 0x34, 0xe0, 0x78, 0x48, 0x43, 0x20, 0x42, 0x35, 
+  0x0b, 0x70, 0x10, 0x20, 0x81, 0x31, 0x09, 0x81, 0xa4, 0x05, 0xf0, 0x27, 
+  0x21, 0x82, 0x41, 0x0b, 0xf2, 0x10, 0x01, 0x31, 0x01, 0x00, 0x40, 0x22, 
+  0x0c, 0x02, 0x4a, 0x23, 0x80, 0x00, 0x04, 0x14, 0x02, 0x14, 0x64, 0x71, 
+  0x00, 0x31, 0x01, 0x00, 0xf9, 0x0b, 0xe2, 0x82, 0x01, 0x31, 0x81, 0x00, 
+  0x10, 0xf0, 0x1d, 0x0b, 0xb2, 0x10, 0x4a, 0x23, 0x40, 0x00, 0x04, 0x12, 
+  0x0c, 0x02, 0x40, 0x23, 0x43, 0x00, 0x1e, 0x00, 0x11, 0xf5, 0x1e, 0x00, 
+  0xf2, 0x07, 0x01, 0x03, 0xe0, 0x7f, 0x20, 0x40, 0xc3, 0x41, 0xa0, 0x00, 
+  0xf4, 0x7f, 0x40, 0x81, 0x00, 0xa1, 0xe0, 0x7f, 0x40, 0x40, 0xe0, 0x78, 
+  0x10, 0x00, 0x60, 0x20, 0x81, 0x02, 0xe9, 0x00, 0x79, 0x2c, 0x07, 0x00, 
+  0x04, 0x00, 0x40, 0x4a, 0x24, 0xc0, 0x02, 0xc6, 0x03, 0x31, 0x6f, 0x22, 
+  0x0a, 0x04, 0x00, 0xf0, 0x35, 0x2f, 0x22, 0x82, 0x00, 0x4a, 0x24, 0x80, 
+  0x02, 0x2f, 0x24, 0x40, 0x90, 0xc0, 0x22, 0x65, 0x00, 0x41, 0x2c, 0x43, 
+  0x15, 0x8c, 0x23, 0xdf, 0x8f, 0x6c, 0x00, 0x21, 0x00, 0x53, 0x21, 0x01, 
+  0x85, 0x8e, 0x23, 0xd0, 0x8c, 0x4e, 0x00, 0x21, 0x00, 0x94, 0xb9, 0xce, 
+  0x23, 0x24, 0x00, 0x32, 0x00, 0x24, 0x00, 0x4e, 0x23, 0x0c, 0x08, 0xb5, 
+  0xe3, 0xca, 0x21, 0x29, 0x00, 0xcc, 0x23, 0xec, 0x87, 0xca, 0x20, 0x49, 
+  0x00, 0x0c, 0x00, 0xf1, 0x0a, 0x2a, 0x00, 0x29, 0x00, 0x01, 0x28, 0xc0, 
+  0x00, 0x00, 0x29, 0x0c, 0x03, 0x01, 0x29, 0xc1, 0x00, 0x1b, 0x00, 0x20, 
+  0x00, 0x85, 0x78, 0x90, 0x73, 0x30, 0x18, 0x00, 0xf1, 0x5a, 0x0c, 0x03, 
+  0x00, 0x29, 0xc1, 0x00, 0x00, 0x28, 0xc0, 0x00, 0x85, 0x79, 0x51, 0x22, 
+  0x00, 0x80, 0xe0, 0x7d, 0x4e, 0x20, 0x00, 0x80, 0x32, 0x79, 0xe0, 0x7f, 
+  0xc0, 0x21, 0x66, 0x00, 0xcc, 0x20, 0x21, 0x80, 0xd1, 0x22, 0x22, 0x80, 
+  0xc0, 0x22, 0x62, 0x00, 0x40, 0x41, 0x3b, 0x78, 0xe0, 0x7f, 0x1c, 0x78, 
+  0x2f, 0x23, 0x00, 0x80, 0xca, 0x21, 0x01, 0x00, 0xe1, 0x20, 0xc1, 0x07, 
+  0xc2, 0x20, 0x01, 0x00, 0x41, 0x2b, 0xc2, 0x00, 0xc3, 0x72, 0x00, 0x70, 
+  0x00, 0x00, 0x2f, 0x21, 0x84, 0x00, 0x41, 0x2b, 0x0c, 0x06, 0x61, 0xbc, 
+  0x8c, 0x24, 0x83, 0x9f, 0xe1, 0x20, 0xc5, 0x07, 0x40, 0x2b, 0x00, 0x07, 
+  0xc5, 0x21, 0x81, 0x0f, 0x00, 0x7f, 0x00, 0x30, 0x00, 0xf0, 0x0c, 0x41, 
+  0x2a, 0x42, 0x05, 0x2f, 0x2c, 0xc1, 0x90, 0xc2, 0x24, 0x04, 0x13, 0xc0, 
+  0x24, 0x63, 0x10, 0x85, 0x71, 0x00, 0x2b, 0x03, 0x03, 0x69, 0xbc, 0x82, 
+  0x7a, 0x40, 0x1a, 0x00, 0x33, 0x21, 0x40, 0x80, 0x44, 0x00, 0xb0, 0x03, 
+  0x85, 0x79, 0xe0, 0x7f, 0x40, 0x2b, 0x00, 0x05, 0xe0, 0x78, 0x00, 0x01, 
+  0x40, 0x02, 0x24, 0x83, 0x1f, 0x62, 0x00, 0xf0, 0x49, 0x40, 0x2b, 0xc2, 
+  0x00, 0x2f, 0x22, 0x84, 0x00, 0x02, 0x23, 0x83, 0x0f, 0x20, 0x00, 0x00, 
+  0x00, 0xd3, 0x73, 0xc0, 0x1f, 0x00, 0x00, 0x40, 0x28, 0x03, 0x01, 0x20, 
+  0x00, 0x26, 0x00, 0x41, 0x28, 0x40, 0x87, 0x45, 0x78, 0x44, 0x20, 0x41, 
+  0x00, 0x05, 0x21, 0xc1, 0x80, 0xe0, 0x7f, 0xc1, 0x20, 0x22, 0x00, 0xe0, 
+  0x7f, 0x6c, 0x21, 0x80, 0x07, 0x2f, 0x23, 0xc4, 0x00, 0x45, 0x78, 0x41, 
+  0x2c, 0x4c, 0x15, 0x82, 0x24, 0x0d, 0x9a, 0xb7, 0xf6, 0x42, 0x24, 0x0c, 
+  0x96, 0x53, 0x20, 0x81, 0x05, 0x22, 0x00, 0x2c, 0x00, 0x2f, 0x20, 0x00, 
+  0x80, 0x30, 0x00, 0x40, 0x2f, 0x20, 0x84, 0x0f, 0x1c, 0x06, 0xf0, 0x19, 
+  0xd0, 0x20, 0xa1, 0x05, 0x8c, 0x24, 0xd1, 0x9f, 0xe0, 0x7f, 0xd0, 0x20, 
+  0xa2, 0x05, 0x4e, 0x24, 0x02, 0x10, 0x97, 0xb9, 0x01, 0x29, 0x80, 0x00, 
+  0x2f, 0x20, 0x04, 0x80, 0xe1, 0x20, 0xc6, 0x07, 0x4e, 0x22, 0xcc, 0x07, 
+  0x13, 0x21, 0x01, 0x03, 0x34, 0x00, 0xf1, 0x7c, 0xd1, 0x20, 0x21, 0x80, 
+  0xe0, 0x7f, 0xc0, 0x20, 0x62, 0x00, 0xe0, 0x78, 0xcb, 0x44, 0xe0, 0xff, 
+  0x00, 0x00, 0x14, 0x24, 0x44, 0x10, 0x14, 0x24, 0xc5, 0x10, 0xb5, 0xbc, 
+  0x0c, 0x24, 0x00, 0x83, 0xe0, 0x00, 0x06, 0x00, 0x0c, 0x25, 0x00, 0x83, 
+  0xd8, 0x00, 0x06, 0x00, 0x41, 0x2c, 0x44, 0x05, 0x41, 0x2d, 0x45, 0x05, 
+  0x00, 0x25, 0x05, 0x01, 0x82, 0x25, 0x8f, 0x0f, 0x8c, 0x25, 0xdf, 0x8e, 
+  0xc0, 0x00, 0x26, 0x00, 0x07, 0x21, 0xcc, 0x80, 0x40, 0x25, 0x47, 0x00, 
+  0x94, 0xb9, 0xd4, 0xb9, 0x94, 0xbb, 0xcf, 0x27, 0xe4, 0x02, 0x40, 0x2b, 
+  0xc3, 0x02, 0x41, 0x2a, 0x45, 0x05, 0x40, 0x2a, 0xc2, 0x82, 0x05, 0x23, 
+  0x43, 0x01, 0x1d, 0x20, 0x84, 0x00, 0x1c, 0x20, 0x8c, 0x00, 0x94, 0x70, 
+  0xcf, 0x27, 0xe2, 0x07, 0x1d, 0x20, 0xc4, 0x00, 0x1c, 0x20, 0xc5, 0x00, 
+  0x00, 0x24, 0x0c, 0x91, 0x41, 0x25, 0x00, 0x00, 0x1d, 0x21, 0x84, 0x00, 
+  0x1c, 0x21, 0x85, 0x10, 0x00, 0xf0, 0x01, 0x01, 0x20, 0x40, 0x81, 0x1d, 
+  0x21, 0xc4, 0x00, 0x1c, 0x21, 0xc5, 0x00, 0x41, 0x26, 0x01, 0x70, 0xe7, 
+  0x06, 0xf0, 0x0c, 0x00, 0x20, 0x00, 0x81, 0x01, 0x21, 0x41, 0x01, 0x19, 
+  0x09, 0x3f, 0x05, 0x00, 0x24, 0x0c, 0x93, 0x42, 0x27, 0x47, 0x00, 0x01, 
+  0x20, 0x00, 0x80, 0x01, 0x21, 0x41, 0x34, 0x00, 0xf0, 0x20, 0x93, 0x40, 
+  0x2f, 0x04, 0x05, 0x41, 0x2f, 0xc7, 0x07, 0x08, 0x00, 0x05, 0x00, 0xe0, 
+  0x7f, 0x80, 0x71, 0xc5, 0x24, 0xc1, 0x91, 0x44, 0x20, 0x45, 0x00, 0xc5, 
+  0x25, 0x62, 0x00, 0x00, 0x20, 0x40, 0x81, 0x41, 0x21, 0x01, 0x00, 0x15, 
+  0x09, 0x5e, 0x05, 0x00, 0x24, 0x84, 0x0f, 0x10, 0x00, 0xe6, 0x01, 0x51, 
+  0x42, 0x80, 0x2f, 0x20, 0x04, 0x2c, 0x00, 0x71, 0x2f, 0x25, 0xc0, 0x80, 
+  0x41, 0x26, 0x04, 0x68, 0x00, 0xf1, 0x00, 0xcc, 0x22, 0x21, 0x80, 0x3c, 
+  0x03, 0x21, 0x00, 0x2f, 0x21, 0x40, 0x90, 0xc7, 0x24, 0x65, 0x3c, 0x02, 
+  0xf0, 0x33, 0x10, 0x03, 0x01, 0x00, 0x41, 0x29, 0x46, 0x95, 0xd3, 0xb9, 
+  0xcf, 0x21, 0x22, 0x05, 0x5c, 0x00, 0x22, 0x00, 0x00, 0x40, 0x34, 0x70, 
+  0x0e, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x20, 0x00, 0x2f, 0x2a, 0x41, 0x10, 
+  0x14, 0x70, 0x4a, 0x22, 0xc0, 0x17, 0x0c, 0x00, 0x04, 0x00, 0x2f, 0x2a, 
+  0x01, 0x10, 0x40, 0x22, 0x0a, 0x18, 0x42, 0x22, 0x8a, 0x12, 0x02, 0x26, 
+  0x86, 0x02, 0xc4, 0x71, 0x02, 0x26, 0x8b, 0xf2, 0xbf, 0x00, 0xf1, 0x00, 
+  0x01, 0x28, 0xcb, 0x02, 0x14, 0x00, 0x09, 0x00, 0x42, 0x22, 0x0b, 0x18, 
+  0x00, 0x28, 0xc1, 0x26, 0x03, 0xf1, 0x16, 0x0c, 0x70, 0x00, 0x28, 0x80, 
+  0x02, 0x00, 0x29, 0x8a, 0x02, 0x05, 0x23, 0x81, 0x12, 0x41, 0x2d, 0x47, 
+  0x85, 0x53, 0x23, 0xc8, 0x04, 0xcf, 0x20, 0x22, 0x15, 0x5a, 0x00, 0x22, 
+  0x00, 0x40, 0x42, 0x15, 0x70, 0x0c, 0x00, 0x01, 0xec, 0x02, 0x51, 0x2f, 
+  0x2a, 0x01, 0x12, 0x54, 0x66, 0x00, 0x11, 0x0e, 0x66, 0x00, 0x16, 0x81, 
+  0x66, 0x00, 0x46, 0x27, 0x87, 0x02, 0xe4, 0x66, 0x00, 0x44, 0x2a, 0xcb, 
+  0x02, 0x12, 0x66, 0x00, 0xf0, 0x3e, 0x2a, 0xc8, 0x02, 0x13, 0x00, 0x20, 
+  0x00, 0x4c, 0x70, 0x00, 0x2a, 0x82, 0x02, 0x00, 0x28, 0x8a, 0x12, 0x05, 
+  0x23, 0x88, 0x12, 0x8c, 0x26, 0xdf, 0x8f, 0xea, 0x01, 0x01, 0x00, 0x8c, 
+  0x27, 0xdf, 0x8f, 0x14, 0x02, 0x21, 0x00, 0x00, 0x26, 0xc6, 0x01, 0x1d, 
+  0x20, 0x8a, 0x00, 0x1c, 0x20, 0x8b, 0x00, 0x82, 0x26, 0xcf, 0x0f, 0x1d, 
+  0x21, 0x87, 0x00, 0x1c, 0x21, 0x8c, 0x00, 0x00, 0x23, 0xcb, 0x91, 0x41, 
+  0x24, 0x02, 0x10, 0x1d, 0x20, 0x07, 0x02, 0x1c, 0x20, 0x0c, 0x02, 0x10, 
+  0x00, 0xf0, 0x31, 0x01, 0x22, 0x02, 0x03, 0x1d, 0x21, 0x07, 0x02, 0x1c, 
+  0x21, 0x0c, 0x02, 0x00, 0x22, 0xc2, 0x81, 0x41, 0x24, 0x09, 0x10, 0x40, 
+  0x29, 0x01, 0x13, 0x41, 0x2a, 0x03, 0x05, 0x65, 0x79, 0x40, 0x2a, 0x07, 
+  0x03, 0x40, 0x2a, 0x00, 0x03, 0x41, 0x2b, 0x03, 0x15, 0x65, 0x78, 0x40, 
+  0x2b, 0x0c, 0x13, 0x55, 0x70, 0xc5, 0x24, 0xa2, 0x10, 0xd4, 0x70, 0x20, 
+  0x00, 0x0c, 0x00, 0x04, 0x21, 0xbe, 0x8f, 0xee, 0x02, 0x63, 0x14, 0x00, 
+  0x01, 0x00, 0xc4, 0x71, 0x80, 0x01, 0xf0, 0x1a, 0x80, 0x2f, 0x24, 0x04, 
+  0x13, 0xd4, 0x70, 0x62, 0x00, 0x0c, 0x00, 0x95, 0x70, 0x36, 0x00, 0x0a, 
+  0x00, 0x04, 0x24, 0xbe, 0x9f, 0xff, 0x7f, 0xff, 0xff, 0x0c, 0x00, 0x02, 
+  0x00, 0x44, 0x20, 0x7e, 0x80, 0x22, 0x00, 0x01, 0x00, 0x40, 0x20, 0x40, 
+  0x80, 0xc0, 0x01, 0x04, 0x42, 0x00, 0x00, 0x7a, 0x01, 0x05, 0x42, 0x00, 
+  0x10, 0x00, 0xd0, 0x00, 0xd1, 0xfe, 0x00, 0x0a, 0x00, 0xd4, 0x70, 0x1a, 
+  0x00, 0x0c, 0x00, 0x06, 0x21, 0x81, 0xe0, 0x01, 0xf0, 0x0b, 0x40, 0x2e, 
+  0x02, 0x05, 0x45, 0x79, 0x2f, 0x22, 0x03, 0x01, 0x45, 0x79, 0xe0, 0x7e, 
+  0x8c, 0x26, 0xff, 0x82, 0xea, 0x00, 0x0b, 0x00, 0x02, 0x26, 0x8a, 0x71, 
+  0xe6, 0x01, 0xf1, 0x30, 0x42, 0x22, 0x4a, 0x90, 0x84, 0x00, 0x0b, 0x00, 
+  0x88, 0x00, 0x01, 0x00, 0x4c, 0x22, 0x00, 0x98, 0x2a, 0x00, 0x0b, 0x00, 
+  0x42, 0x22, 0x0a, 0x18, 0x05, 0x24, 0x0c, 0x90, 0x6d, 0x77, 0x10, 0x00, 
+  0x02, 0x00, 0x00, 0x2b, 0x8b, 0x12, 0x87, 0x23, 0xff, 0x1f, 0x04, 0x21, 
+  0xcc, 0x02, 0x01, 0x29, 0x80, 0x02, 0x5d, 0x00, 0x20, 0x00, 0x2c, 0x70, 
+  0x95, 0x70, 0x6d, 0x77, 0x1e, 0x00, 0x02, 0x34, 0x00, 0x76, 0xc2, 0x23, 
+  0xca, 0x12, 0x0a, 0x00, 0x0a, 0x2a, 0x00, 0x34, 0x20, 0xcc, 0x02, 0x86, 
+  0x01, 0x22, 0x00, 0x29, 0xec, 0x01, 0x62, 0x40, 0x22, 0x0b, 0x18, 0x01, 
+  0x29, 0x12, 0x05, 0xf0, 0x00, 0x2c, 0x70, 0x01, 0x28, 0x80, 0x02, 0x01, 
+  0x29, 0x81, 0x02, 0x05, 0x20, 0xc0, 0x02, 0x0d, 0x84, 0x02, 0xf0, 0x08, 
+  0x20, 0x00, 0x80, 0x2f, 0x21, 0x4b, 0x00, 0x44, 0x20, 0xbe, 0x80, 0x18, 
+  0x00, 0x01, 0x00, 0x44, 0x20, 0x4a, 0x01, 0x05, 0x22, 0x3e, 0x93, 0xf4, 
+  0x01, 0x31, 0x40, 0x20, 0x80, 0xf4, 0x00, 0x04, 0xe6, 0x00, 0x04, 0x08, 
+  0x00, 0x40, 0x02, 0x26, 0x86, 0x01, 0x08, 0x01, 0x00, 0xe4, 0x00, 0xc0, 
+  0xc0, 0x26, 0x62, 0x00, 0x88, 0xf1, 0x8a, 0x26, 0xdf, 0x0f, 0xc3, 0x41, 
+  0x10, 0x00, 0x60, 0x05, 0x07, 0xef, 0xff, 0x0c, 0x70, 0x22, 0x00, 0x40, 
+  0x2c, 0x70, 0xf9, 0x06, 0x0c, 0x00, 0x20, 0xd3, 0x71, 0x18, 0x00, 0x00, 
+  0xc4, 0x02, 0x80, 0x2f, 0x21, 0x03, 0x01, 0xc5, 0x21, 0x82, 0x0f, 0xc2, 
+  0x06, 0x41, 0xc0, 0x78, 0x78, 0xf5, 0xfe, 0x01, 0x10, 0x00, 0x60, 0x00, 
+  0x60, 0x03, 0x01, 0x05, 0x21, 0x81, 0x0f, 0xce, 0x07, 0x81, 0x0c, 0x70, 
+  0x6c, 0xf1, 0x0c, 0x20, 0x80, 0x9f, 0x34, 0x00, 0x1a, 0x22, 0x34, 0x00, 
+  0x00, 0x00, 0x05, 0x02, 0x24, 0x00, 0x60, 0x5a, 0xf1, 0x0c, 0x25, 0x80, 
+  0x8f, 0x26, 0x04, 0x10, 0x22, 0x18, 0x04, 0x50, 0x70, 0x2c, 0x70, 0x94, 
+  0x70, 0x26, 0x00, 0x60, 0x00, 0x80, 0x00, 0x00, 0x4c, 0xf1, 0x34, 0x03, 
+  0x40, 0x0c, 0x21, 0x80, 0x9f, 0x20, 0x00, 0x40, 0xb2, 0xf7, 0xc3, 0x41, 
+  0x3c, 0x00, 0x50, 0x0c, 0x70, 0x40, 0xf1, 0x07, 0x40, 0x05, 0x30, 0x80, 
+  0x00, 0x00, 0xf8, 0x00, 0x31, 0x07, 0x23, 0x83, 0x0c, 0x00, 0xf4, 0x19, 
+  0x00, 0x21, 0x44, 0x00, 0x00, 0x23, 0xc5, 0x00, 0x0c, 0x24, 0x40, 0x81, 
+  0xcc, 0x20, 0x81, 0x80, 0x10, 0x00, 0x06, 0x00, 0x08, 0x44, 0x40, 0x40, 
+  0x81, 0x42, 0x28, 0x44, 0x60, 0x41, 0x81, 0x43, 0x8a, 0x24, 0xdf, 0x1f, 
+  0x40, 0x2c, 0x4c, 0x15, 0x8e, 0x04, 0x40, 0x40, 0x2c, 0x8c, 0x10, 0x90, 
+  0x04, 0xf3, 0x1a, 0xcc, 0x25, 0x05, 0x83, 0xc6, 0x01, 0x06, 0x00, 0x41, 
+  0x29, 0x04, 0x05, 0x41, 0x2b, 0x05, 0x05, 0x02, 0x24, 0x46, 0x01, 0x53, 
+  0x26, 0x86, 0x02, 0x07, 0x21, 0xc7, 0x00, 0x40, 0x29, 0xc1, 0x02, 0x41, 
+  0x28, 0x4c, 0x05, 0x85, 0x79, 0x40, 0x28, 0xc0, 0x84, 0x04, 0xf0, 0x5b, 
+  0x4c, 0x05, 0x85, 0x7b, 0x40, 0x2a, 0xc2, 0x02, 0x9f, 0xbb, 0x4e, 0x26, 
+  0x0c, 0x88, 0x1c, 0x00, 0x2d, 0x00, 0x01, 0x2a, 0x85, 0x01, 0x8c, 0x26, 
+  0x01, 0x80, 0x01, 0x2b, 0x85, 0x01, 0xca, 0x25, 0x26, 0x00, 0x17, 0x00, 
+  0x20, 0x00, 0x8d, 0x70, 0xd4, 0x70, 0x00, 0x2b, 0x0c, 0x03, 0xc5, 0x25, 
+  0x02, 0x03, 0x01, 0x2b, 0x8c, 0x01, 0x41, 0x2f, 0xc7, 0x87, 0x62, 0x00, 
+  0x22, 0x00, 0x9f, 0xb9, 0x00, 0x25, 0x05, 0x80, 0x01, 0x24, 0x4c, 0x90, 
+  0x10, 0x00, 0x26, 0x00, 0xc2, 0x24, 0x66, 0x00, 0x2f, 0x24, 0x04, 0x93, 
+  0x2f, 0x25, 0x44, 0x01, 0x41, 0x2d, 0xc0, 0x82, 0x40, 0x2c, 0x41, 0x15, 
+  0x25, 0x78, 0x41, 0x2c, 0xc1, 0x12, 0x40, 0x2c, 0x04, 0x05, 0x5a, 0x05, 
+  0xf0, 0x0b, 0x80, 0x71, 0x4c, 0x26, 0x00, 0x88, 0xca, 0x23, 0x85, 0x00, 
+  0xca, 0x22, 0x25, 0x00, 0x13, 0x23, 0x83, 0x01, 0x05, 0x23, 0x83, 0x80, 
+  0xd3, 0x25, 0x61, 0x82, 0x68, 0x05, 0x20, 0xca, 0x27, 0x90, 0x04, 0x40, 
+  0xc0, 0x81, 0xe0, 0x7f, 0xde, 0x01, 0xea, 0x0e, 0x25, 0x05, 0x80, 0x03, 
+  0x21, 0x0c, 0x83, 0x52, 0x00, 0x23, 0x00, 0x0c, 0x70, 0x50, 0x00, 0x4f, 
+  0x42, 0x24, 0x44, 0x00, 0x54, 0x00, 0x0b, 0x71, 0xca, 0x27, 0x22, 0x00, 
+  0x04, 0x27, 0x07, 0x5c, 0x00, 0x0a, 0x58, 0x00, 0x40, 0xcc, 0x25, 0x21, 
+  0x80, 0xaa, 0x06, 0xf0, 0x21, 0x2c, 0x70, 0x2f, 0x28, 0x01, 0x03, 0x9f, 
+  0xe0, 0x14, 0x00, 0x25, 0x00, 0x04, 0x71, 0x2f, 0x28, 0x41, 0x81, 0xca, 
+  0x20, 0x24, 0x08, 0xc0, 0x20, 0x63, 0x08, 0x4e, 0x20, 0x01, 0x88, 0x18, 
+  0x00, 0x2d, 0x00, 0x00, 0x2c, 0x0c, 0x10, 0xc0, 0xe0, 0x00, 0x2d, 0x0c, 
+  0x00, 0xca, 0x24, 0x26, 0x10, 0x08, 0x01, 0xf1, 0x1c, 0xac, 0x70, 0x14, 
+  0x70, 0x01, 0x2d, 0x41, 0x00, 0xc5, 0x24, 0x42, 0x10, 0x00, 0x2d, 0x05, 
+  0x00, 0x53, 0x24, 0x81, 0x02, 0x0e, 0x20, 0x40, 0x80, 0x04, 0x24, 0x84, 
+  0x0f, 0x00, 0x00, 0x00, 0x08, 0x12, 0x00, 0x22, 0x00, 0xc0, 0x20, 0x61, 
+  0x00, 0x2f, 0x24, 0x02, 0x06, 0x01, 0xc0, 0x4c, 0x07, 0xe6, 0xff, 0xc5, 
+  0x24, 0x06, 0x00, 0x4e, 0x20, 0x40, 0x00, 0x56, 0x00, 0x10, 0x1a, 0x60, 
+  0x01, 0x90, 0x2d, 0x05, 0x00, 0xc0, 0xe0, 0x01, 0x2c, 0x05, 0x10, 0x5e, 
+  0x01, 0x00, 0xfe, 0x02, 0xf4, 0x0b, 0x8d, 0x70, 0x14, 0x70, 0x00, 0x2c, 
+  0x41, 0x10, 0xc5, 0x25, 0x42, 0x00, 0x01, 0x2c, 0x0c, 0x10, 0x15, 0x07, 
+  0xef, 0xff, 0x84, 0x71, 0x2f, 0x22, 0x40, 0x90, 0x7a, 0x05, 0xb1, 0x52, 
+  0x02, 0x01, 0x00, 0x2f, 0x23, 0xc0, 0x90, 0x41, 0x26, 0x05, 0x10, 0x00, 
+  0xff, 0x1f, 0x60, 0x02, 0x01, 0x00, 0x0c, 0x23, 0x80, 0x92, 0xcc, 0x22, 
+  0x01, 0x80, 0xcc, 0x21, 0xc1, 0x80, 0x08, 0x42, 0x14, 0x00, 0x0e, 0x00, 
+  0x40, 0x40, 0x41, 0x42, 0x28, 0x42, 0x60, 0x41, 0x41, 0x43, 0x88, 0x42, 
+  0xa0, 0x44, 0x41, 0x45, 0x2f, 0x26, 0x40, 0x00, 0x41, 0x2e, 0x46, 0x85, 
+  0x9c, 0x05, 0x4d, 0x6f, 0x2f, 0x27, 0xc0, 0x00, 0x41, 0x2f, 0xa0, 0x05, 
+  0x55, 0x22, 0x38, 0x03, 0xa0, 0x05, 0xf0, 0x09, 0x7e, 0x03, 0x21, 0x00, 
+  0x02, 0x26, 0xcb, 0x01, 0x4c, 0x23, 0x80, 0x9d, 0x02, 0x21, 0x49, 0x12, 
+  0x18, 0x01, 0x09, 0x00, 0x42, 0x23, 0x8a, 0x90, 0xb8, 0x04, 0xf0, 0x02, 
+  0x22, 0x00, 0x09, 0x00, 0x2f, 0x22, 0x80, 0x80, 0x2f, 0x20, 0x0b, 0x12, 
+  0x40, 0x22, 0x4a, 0x90, 0x74, 0xce, 0x03, 0x40, 0x22, 0x80, 0x80, 0x6d, 
+  0x8e, 0x00, 0x30, 0x20, 0x0b, 0x12, 0xa4, 0x04, 0x51, 0x6d, 0x70, 0x26, 
+  0x00, 0x2b, 0xda, 0x04, 0x40, 0x0a, 0x21, 0x80, 0x90, 0xd8, 0x04, 0x41, 
+  0x02, 0x26, 0x8b, 0x72, 0xa2, 0x04, 0xd5, 0x28, 0xc9, 0x12, 0x01, 0x28, 
+  0x82, 0x12, 0x3d, 0x00, 0x20, 0x00, 0x0d, 0x70, 0x16, 0x00, 0x26, 0x2a, 
+  0xc9, 0xc4, 0x04, 0x35, 0x28, 0xcb, 0x12, 0xc4, 0x04, 0x30, 0x28, 0xc2, 
+  0x12, 0x14, 0x01, 0xe4, 0x0d, 0x70, 0x01, 0x2a, 0x82, 0x02, 0x01, 0x28, 
+  0x88, 0x12, 0x05, 0x22, 0xc2, 0x02, 0xc0, 0x04, 0x04, 0x08, 0x00, 0x00, 
+  0xc8, 0x03, 0xc0, 0x9e, 0x01, 0x02, 0x00, 0x00, 0x20, 0x80, 0x80, 0x01, 
+  0x21, 0x01, 0x02, 0xa8, 0x04, 0x00, 0xe7, 0x03, 0x19, 0x12, 0xf2, 0x05, 
+  0x40, 0xc5, 0x21, 0x65, 0x10, 0xf2, 0x04, 0xa2, 0x2e, 0x00, 0x21, 0x00, 
+  0x35, 0x70, 0xcb, 0x20, 0x61, 0x81, 0xe4, 0x05, 0x51, 0x80, 0x80, 0xc0, 
+  0x21, 0x65, 0xe4, 0x05, 0x00, 0x34, 0x00, 0x00, 0xc2, 0x01, 0x04, 0xf4, 
+  0x04, 0x06, 0xec, 0x05, 0x04, 0x08, 0x00, 0x51, 0xd4, 0x70, 0x48, 0x00, 
+  0x0c, 0xfa, 0x05, 0x3f, 0x14, 0x01, 0x0a, 0xf4, 0x05, 0x04, 0x80, 0x14, 
+  0x70, 0xb2, 0x05, 0xc2, 0xff, 0xd3, 0x73, 0x6a, 0x04, 0x20, 0x7c, 0x71, 
+  0x50, 0x06, 0xf8, 0x05, 0x54, 0x70, 0x7c, 0x71, 0xca, 0x21, 0x41, 0x00, 
+  0x40, 0x40, 0xe0, 0x7e, 0x54, 0x70, 0xa6, 0x05, 0xc2, 0xff, 0xe0, 0x7e, 
+  0x12, 0x06, 0x53, 0x82, 0x00, 0x0b, 0x00, 0x86, 0x12, 0x06, 0x14, 0x28, 
+  0x12, 0x06, 0x69, 0x21, 0x09, 0x90, 0x6d, 0x77, 0x12, 0x12, 0x06, 0x11, 
+  0xc9, 0x12, 0x06, 0x11, 0x5f, 0xd4, 0x05, 0x57, 0x35, 0x70, 0x6d, 0x77, 
+  0x1c, 0x12, 0x06, 0x19, 0x08, 0x12, 0x06, 0x07, 0x4e, 0x01, 0x12, 0x29, 
+  0xf8, 0x01, 0x04, 0x12, 0x06, 0x00, 0xf8, 0x01, 0x0a, 0x12, 0x06, 0x00, 
+  0x5d, 0x03, 0x08, 0x12, 0x06, 0x15, 0x1a, 0x12, 0x06, 0x20, 0x7e, 0x92, 
+  0x0e, 0x01, 0x0f, 0x12, 0x06, 0x15, 0x17, 0x7a, 0x12, 0x06, 0x42, 0x0c, 
+  0x70, 0x72, 0xf1, 0x10, 0x06, 0x11, 0xdd, 0x10, 0x06, 0x53, 0x02, 0x20, 
+  0x80, 0x80, 0x03, 0x9a, 0x01, 0x40, 0x40, 0x00, 0x00, 0x00, 0xcc, 0x06, 
+  0x04, 0x74, 0x00, 0x31, 0x42, 0x26, 0x46, 0x7e, 0x01, 0x00, 0x18, 0x00, 
+  0x11, 0x44, 0x7c, 0x00, 0x51, 0xbe, 0x80, 0x3c, 0x00, 0x21, 0x86, 0x07, 
+  0x71, 0x14, 0x00, 0x02, 0x00, 0x35, 0x70, 0x2c, 0x94, 0x07, 0x37, 0x3e, 
+  0x81, 0x24, 0x8e, 0x00, 0x04, 0xb0, 0x01, 0x00, 0x7a, 0x00, 0x00, 0x0c, 
+  0x03, 0x0c, 0x9e, 0x00, 0x04, 0x08, 0x00, 0x02, 0x8a, 0x06, 0x51, 0x4a, 
+  0x06, 0xca, 0xff, 0x34, 0x34, 0x03, 0xd0, 0x2f, 0x2a, 0x41, 0x00, 0x19, 
+  0x00, 0x00, 0x00, 0x14, 0x70, 0x0a, 0x00, 0x0c, 0x3e, 0x03, 0xfb, 0x02, 
+  0x00, 0xc0, 0x22, 0x29, 0x08, 0xab, 0xf3, 0xca, 0x22, 0xeb, 0x07, 0x6a, 
+  0xba, 0x02, 0x26, 0x8b, 0xf0, 0x98, 0x03, 0x17, 0x08, 0x98, 0x03, 0xa0, 
+  0x29, 0x81, 0x00, 0x05, 0x21, 0xc1, 0x02, 0x00, 0x28, 0x80, 0xfe, 0x00, 
+  0x9a, 0x80, 0x3c, 0x06, 0xcc, 0xff, 0xfd, 0x05, 0xcf, 0xff, 0xee, 0x06, 
+  0x20, 0x02, 0x78, 0x36, 0x01, 0x00, 0xdc, 0x06, 0x00, 0x84, 0x06, 0x20, 
+  0xe0, 0x7e, 0x50, 0x03, 0x48, 0x22, 0x00, 0x02, 0x00, 0xe2, 0x06, 0x02, 
+  0xb2, 0x00, 0x40, 0x43, 0x01, 0xee, 0xf1, 0xbc, 0x02, 0x26, 0xea, 0xf5, 
+  0x0a, 0x07, 0x40, 0xe0, 0x7e, 0x60, 0x41, 0x28, 0x02, 0xf0, 0x37, 0xe4, 
+  0xc2, 0x48, 0x31, 0x01, 0x00, 0x07, 0x36, 0x4c, 0x70, 0x48, 0x47, 0x00, 
+  0x00, 0x08, 0x45, 0x09, 0x90, 0xc3, 0x43, 0x83, 0x3a, 0x6f, 0x12, 0xcd, 
+  0x70, 0x48, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x10, 0x00, 0x30, 0xc1, 
+  0x00, 0x04, 0x31, 0x80, 0x83, 0xc5, 0xf6, 0x3f, 0xd8, 0x18, 0xb8, 0x04, 
+  0xf0, 0xc3, 0x40, 0x00, 0xbf, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x30, 
+  0x8d, 0x48, 0x30, 0xc0, 0x02, 0x10, 0x7a, 0x8b, 0xe2, 0x44, 0x00, 0xf1, 
+  0x0b, 0xca, 0x20, 0xa6, 0x02, 0x00, 0x34, 0x41, 0x10, 0x10, 0x78, 0x48, 
+  0x20, 0xc0, 0x00, 0x0c, 0xb5, 0xa6, 0x0a, 0xef, 0xf7, 0x00, 0x31, 0xc0, 
+  0x00, 0x04, 0x30, 0x3c, 0x00, 0x71, 0xd9, 0x18, 0xb9, 0x04, 0xf0, 0xc3, 
+  0x41, 0x3c, 0x00, 0x30, 0x30, 0x40, 0x00, 0x3a, 0x00, 0xf0, 0x8c, 0x05, 
+  0xa5, 0xc4, 0xc6, 0xea, 0xc3, 0x82, 0x24, 0x0d, 0x34, 0x50, 0x41, 0x08, 
+  0x45, 0x94, 0xc0, 0x8a, 0x22, 0x0c, 0x00, 0x3a, 0x0c, 0x6f, 0xed, 0x28, 
+  0x46, 0x00, 0x85, 0x40, 0x24, 0x83, 0x30, 0x40, 0x24, 0x04, 0x32, 0x54, 
+  0x24, 0x85, 0x39, 0x40, 0x24, 0x06, 0x31, 0x40, 0x24, 0xc7, 0x30, 0xc1, 
+  0x41, 0x22, 0x42, 0x46, 0x08, 0xaf, 0xf4, 0x02, 0x1c, 0x43, 0x32, 0x02, 
+  0xc7, 0x04, 0xef, 0xe1, 0x40, 0xca, 0xc7, 0x03, 0x14, 0x8e, 0x30, 0x56, 
+  0x25, 0x10, 0x1d, 0x2c, 0x70, 0xed, 0x70, 0xf8, 0xe9, 0x02, 0x14, 0x81, 
+  0x30, 0xcf, 0x78, 0xe9, 0x09, 0x24, 0x80, 0x04, 0x77, 0xa9, 0x08, 0x55, 
+  0x02, 0x25, 0x20, 0x00, 0x00, 0x0a, 0xf0, 0x13, 0xf0, 0x1a, 0xf0, 0x1e, 
+  0xf0, 0x26, 0xf0, 0x2e, 0xf0, 0x38, 0xf0, 0x3c, 0xf0, 0x42, 0xf0, 0x94, 
+  0xc0, 0x81, 0xc1, 0x26, 0x0b, 0x6f, 0xf8, 0x83, 0xc2, 0x83, 0xc1, 0x40, 
+  0xda, 0xca, 0x0b, 0x6f, 0xed, 0x02, 0x40, 0x3c, 0xf0, 0x94, 0xc0, 0x46, 
+  0x08, 0xef, 0xf8, 0x81, 0xc1, 0x78, 0x1d, 0x18, 0x10, 0x36, 0x0e, 0x00, 
+  0xc1, 0x0d, 0xaf, 0xf0, 0x81, 0xc1, 0x01, 0xa5, 0x30, 0xf0, 0x94, 0xc0, 
+  0x2e, 0x1a, 0x00, 0xb3, 0x00, 0x30, 0x00, 0x00, 0x04, 0xa5, 0x28, 0xf0, 
+  0x94, 0xc0, 0x1e, 0x10, 0x00, 0xd5, 0x01, 0x00, 0x89, 0x1d, 0x18, 0x10, 
+  0x25, 0xa5, 0x1e, 0xf0, 0x94, 0xc0, 0x0a, 0x14, 0x00, 0xf1, 0x14, 0x8a, 
+  0x1d, 0x18, 0x10, 0x26, 0xa5, 0x14, 0xf0, 0x94, 0xc0, 0xf6, 0x0f, 0xaf, 
+  0xf8, 0x81, 0xc1, 0x07, 0xa5, 0x0e, 0xf0, 0x94, 0xc0, 0xf2, 0x0e, 0xaf, 
+  0xf7, 0x81, 0xc1, 0x10, 0xb5, 0x08, 0xf0, 0x94, 0xc0, 0xde, 0x18, 0x00, 
+  0xf1, 0x68, 0x8b, 0x1d, 0x18, 0x10, 0x01, 0xc0, 0x8a, 0x21, 0x3e, 0x06, 
+  0x32, 0x70, 0xca, 0x27, 0x4d, 0x10, 0x3c, 0x21, 0x01, 0x20, 0x3d, 0x21, 
+  0x00, 0x20, 0x1e, 0x66, 0x9c, 0xf1, 0xec, 0xc3, 0xa7, 0xc1, 0x0a, 0x21, 
+  0x00, 0x21, 0x70, 0x40, 0x50, 0x42, 0x28, 0x46, 0x08, 0x45, 0x1e, 0x0b, 
+  0x20, 0x00, 0x55, 0x20, 0x8f, 0x09, 0x22, 0x85, 0x26, 0x0a, 0xef, 0xfb, 
+  0x03, 0x85, 0x4a, 0x24, 0xc0, 0x70, 0x41, 0x68, 0x14, 0x20, 0x01, 0x00, 
+  0x0c, 0x70, 0x0c, 0x1d, 0x80, 0x10, 0xa8, 0x20, 0x00, 0x02, 0x02, 0x4e, 
+  0x15, 0x25, 0x43, 0x10, 0x04, 0x71, 0x24, 0x71, 0x4b, 0xa3, 0x76, 0x0c, 
+  0x20, 0x00, 0xa1, 0x40, 0x00, 0x19, 0x00, 0x20, 0xa1, 0x40, 0x8a, 0x0d, 
+  0x20, 0x00, 0xc1, 0x41, 0x00, 0x41, 0xa1, 0x40, 0xb6, 0x0d, 0x20, 0x00, 
+  0x30, 0x0a, 0x00, 0xf0, 0x27, 0x3a, 0x0c, 0x20, 0x00, 0x22, 0x42, 0xcd, 
+  0x70, 0x00, 0x18, 0x82, 0x23, 0x36, 0xe8, 0x21, 0x87, 0x02, 0x87, 0x40, 
+  0x87, 0x44, 0xc1, 0x45, 0xc0, 0x56, 0x25, 0x80, 0x1a, 0x83, 0xc1, 0x46, 
+  0xc6, 0x8a, 0x0b, 0x2f, 0xef, 0x43, 0xc2, 0x00, 0x18, 0x43, 0x20, 0xb8, 
+  0x17, 0x02, 0x10, 0xbc, 0x17, 0x01, 0x10, 0xc0, 0x17, 0x00, 0x10, 0x76, 
+  0x00, 0xf0, 0x07, 0x3f, 0xdb, 0x40, 0xc2, 0x18, 0xbb, 0x80, 0xc2, 0x41, 
+  0xc1, 0x08, 0x1c, 0x00, 0x30, 0xa8, 0x20, 0x00, 0x04, 0x20, 0x82, 0x60, 
+  0x40, 0x22, 0x02, 0x40, 0xcf, 0x20, 0xec, 0x07, 0x18, 0x02, 0x00, 0xdc, 
+  0x01, 0xf0, 0x15, 0x48, 0x30, 0x80, 0x00, 0x04, 0x1a, 0x10, 0x00, 0x02, 
+  0xc2, 0x01, 0xc1, 0x00, 0xc0, 0x45, 0xa7, 0x24, 0xa7, 0x03, 0xa7, 0x00, 
+  0x10, 0x8e, 0x20, 0xa1, 0x40, 0xc1, 0x41, 0xd2, 0x0a, 0x20, 0x00, 0x0a, 
+  0x22, 0x40, 0x04, 0x4e, 0x00, 0xf1, 0x03, 0x55, 0x25, 0x40, 0x1a, 0xa8, 
+  0x20, 0x80, 0x01, 0x04, 0x10, 0x01, 0x04, 0x04, 0x1a, 0x50, 0x20, 0x00, 
+  0x88, 0x78, 0x02, 0xf0, 0x17, 0x1a, 0x00, 0x20, 0xcc, 0xc7, 0xe8, 0xc3, 
+  0xb2, 0xc1, 0x08, 0x46, 0x00, 0x80, 0x60, 0x44, 0x40, 0x24, 0xc3, 0x30, 
+  0x40, 0x24, 0x05, 0x31, 0x40, 0x24, 0x86, 0x30, 0x48, 0x47, 0x0a, 0x25, 
+  0x40, 0x10, 0x9a, 0x0e, 0x6f, 0xf4, 0x03, 0x08, 0x02, 0xf3, 0x05, 0x14, 
+  0x80, 0x30, 0x56, 0x26, 0x10, 0x1d, 0x03, 0x14, 0x81, 0x30, 0x0f, 0x78, 
+  0x8f, 0x09, 0x24, 0x00, 0x04, 0x77, 0x7b, 0xfa, 0x01, 0xf0, 0x23, 0x09, 
+  0xf0, 0x15, 0xf0, 0x16, 0xf0, 0x1d, 0xf0, 0x1f, 0xf0, 0x22, 0xf0, 0x23, 
+  0xf0, 0x25, 0xf0, 0x2a, 0xf0, 0x82, 0xc0, 0x40, 0xda, 0xda, 0x09, 0x6f, 
+  0xed, 0x02, 0x41, 0x82, 0xc0, 0x81, 0xc3, 0xa1, 0x41, 0x3e, 0x09, 0x6f, 
+  0xf8, 0xe1, 0x42, 0x25, 0xf0, 0x78, 0x16, 0x00, 0x16, 0x1e, 0xf0, 0x01, 
+  0x86, 0x14, 0x00, 0xf0, 0x13, 0x6a, 0x0b, 0xaf, 0xf0, 0xe1, 0x42, 0x1b, 
+  0xf0, 0x04, 0x86, 0x2f, 0x30, 0x00, 0x00, 0x12, 0xf0, 0x89, 0x16, 0x00, 
+  0x16, 0x10, 0xf0, 0x8a, 0x16, 0x00, 0x16, 0x0c, 0xf0, 0x07, 0x86, 0x0a, 
+  0xf0, 0x10, 0x96, 0x26, 0x00, 0xc0, 0x36, 0x0d, 0xaf, 0xf7, 0xe1, 0x42, 
+  0x09, 0xf0, 0x8b, 0x16, 0x00, 0x16, 0x10, 0x00, 0x60, 0x26, 0x0e, 0xaf, 
+  0xf8, 0xe1, 0x42, 0x8e, 0x00, 0xf0, 0x57, 0x04, 0x71, 0x02, 0x1c, 0x02, 
+  0x30, 0xb8, 0xf1, 0x01, 0xc0, 0x41, 0x28, 0x01, 0x02, 0x00, 0xad, 0x21, 
+  0xad, 0xc8, 0xc7, 0xe0, 0x78, 0xe8, 0xc3, 0xa1, 0xc1, 0x50, 0x40, 0x28, 
+  0x45, 0x2c, 0x70, 0x10, 0xda, 0x60, 0x40, 0x88, 0x46, 0x96, 0x0f, 0x2f, 
+  0xfb, 0x68, 0x47, 0xb5, 0x70, 0xad, 0x70, 0x1b, 0xf4, 0x4a, 0x24, 0x00, 
+  0x71, 0xc3, 0x42, 0x13, 0x00, 0x6c, 0x5e, 0x0c, 0x70, 0xa8, 0x20, 0x80, 
+  0x02, 0x04, 0x12, 0x03, 0x04, 0x80, 0xc1, 0x1c, 0x61, 0x04, 0x71, 0x38, 
+  0x23, 0x01, 0x04, 0x20, 0xac, 0x9e, 0x0a, 0xaf, 0xf6, 0x80, 0xc0, 0x07, 
+  0xe8, 0xad, 0x72, 0x01, 0x1f, 0x03, 0x11, 0x00, 0x1f, 0x43, 0x10, 0xa0, 
+  0xa6, 0x54, 0x00, 0x6d, 0xf2, 0xc3, 0xb2, 0xc1, 0x10, 0x45, 0x20, 0x01, 
+  0x70, 0x45, 0x0a, 0x24, 0x40, 0x20, 0x7a, 0x0d, 0x20, 0x01, 0x12, 0xc3, 
+  0x20, 0x01, 0xf2, 0x08, 0x25, 0x0e, 0x2b, 0x55, 0x25, 0x4f, 0x2a, 0x55, 
+  0x25, 0xd0, 0x28, 0x55, 0x25, 0x91, 0x29, 0x55, 0x25, 0x13, 0x2d, 0x40, 
+  0x25, 0x12, 0x2b, 0x34, 0x01, 0x11, 0xaf, 0x34, 0x01, 0x31, 0x9b, 0x08, 
+  0xd5, 0x34, 0x01, 0xf1, 0x0c, 0x0b, 0xf0, 0x0e, 0xf0, 0x18, 0xf0, 0x1a, 
+  0xf0, 0x20, 0xf0, 0x23, 0xf0, 0x28, 0xf0, 0x2b, 0xf0, 0x30, 0xf0, 0x37, 
+  0xf0, 0x38, 0xf0, 0x81, 0xc3, 0xe1, 0x40, 0x1d, 0x3e, 0x01, 0x51, 0x9a, 
+  0x08, 0x6f, 0xed, 0xc1, 0x3e, 0x01, 0xf0, 0x03, 0x82, 0x41, 0xfe, 0x0f, 
+  0x2f, 0xf8, 0xa1, 0x42, 0x31, 0xf0, 0xbe, 0x40, 0x2a, 0xf0, 0xb0, 0x15, 
+  0x80, 0x20, 0x14, 0x00, 0xf0, 0x39, 0x0a, 0x0f, 0x2f, 0xf6, 0xa1, 0x42, 
+  0x27, 0xf0, 0x81, 0xc3, 0x02, 0x40, 0x03, 0xf0, 0x81, 0xc3, 0x22, 0x40, 
+  0x82, 0x41, 0x76, 0x0f, 0xaf, 0xf8, 0xa1, 0x42, 0x1d, 0xf0, 0x28, 0x15, 
+  0x00, 0x20, 0x14, 0xf0, 0x81, 0xc3, 0x42, 0x40, 0x82, 0x41, 0x2e, 0x0e, 
+  0xef, 0xf8, 0xa1, 0x42, 0x13, 0xf0, 0x81, 0xc3, 0x62, 0x40, 0x82, 0x41, 
+  0x8e, 0x0e, 0xef, 0xf9, 0xa1, 0x42, 0x0b, 0xf0, 0xcc, 0x15, 0x00, 0x20, 
+  0x04, 0xf0, 0x53, 0x15, 0x00, 0x26, 0x4c, 0x00, 0x57, 0xde, 0x09, 0xaf, 
+  0xf0, 0xa1, 0x54, 0x01, 0x14, 0xa8, 0x54, 0x01, 0xf0, 0x5e, 0x1c, 0x02, 
+  0x20, 0x01, 0x1c, 0x42, 0x20, 0xd2, 0xc7, 0xe0, 0x78, 0x9d, 0x05, 0x80, 
+  0x03, 0xe8, 0xc3, 0xb4, 0xc1, 0x10, 0x40, 0xb1, 0x10, 0x80, 0x00, 0x3a, 
+  0xe8, 0x55, 0x20, 0x4d, 0x2a, 0x2c, 0x8d, 0x2f, 0x09, 0x70, 0x00, 0xb1, 
+  0x18, 0x03, 0x20, 0xc3, 0x40, 0x13, 0x00, 0x00, 0x5f, 0x0b, 0x09, 0x90, 
+  0x00, 0x09, 0x09, 0xd0, 0x00, 0x14, 0xf0, 0x10, 0xe0, 0x82, 0x0d, 0x2f, 
+  0xf8, 0x84, 0xc1, 0x56, 0x20, 0x00, 0x2b, 0x84, 0xc1, 0xce, 0x0f, 0x2f, 
+  0xed, 0x40, 0xda, 0x40, 0x85, 0x21, 0x85, 0x02, 0x85, 0xac, 0x1d, 0x80, 
+  0x10, 0xb0, 0x1d, 0x40, 0x10, 0xb4, 0x1d, 0x00, 0x10, 0x56, 0x20, 0x01, 
+  0x2b, 0x84, 0xc0, 0x40, 0xda, 0xae, 0x0f, 0x2f, 0xed, 0x84, 0xc5, 0x9e, 
+  0x01, 0x20, 0x80, 0xc0, 0xa4, 0x02, 0xf0, 0x05, 0x14, 0x15, 0x01, 0x14, 
+  0x04, 0x18, 0x50, 0x00, 0x55, 0x20, 0x40, 0x2b, 0x80, 0xc1, 0x92, 0x0f, 
+  0x2f, 0xed, 0x10, 0xda, 0x88, 0x01, 0xa0, 0xe4, 0xc3, 0xa7, 0xc1, 0x08, 
+  0x45, 0x32, 0xe9, 0xb0, 0xea, 0xd2, 0x02, 0x10, 0x2c, 0xc4, 0x01, 0xf0, 
+  0x54, 0x03, 0x15, 0x25, 0x40, 0x10, 0xa4, 0x10, 0x0c, 0x00, 0x98, 0x10, 
+  0x03, 0x00, 0x84, 0xc2, 0x35, 0x7a, 0x02, 0x33, 0x00, 0x03, 0x24, 0x71, 
+  0x00, 0xa2, 0x56, 0x09, 0x6f, 0xfb, 0x84, 0xc0, 0xb0, 0x15, 0x81, 0x10, 
+  0x37, 0x09, 0x94, 0x00, 0x32, 0x21, 0x83, 0x0f, 0x13, 0x00, 0xfb, 0x5e, 
+  0x01, 0x30, 0x82, 0x0f, 0xfa, 0xc4, 0x00, 0x00, 0x6a, 0x7b, 0x00, 0x30, 
+  0x80, 0x00, 0x01, 0x30, 0x81, 0x0f, 0x74, 0x49, 0x00, 0x24, 0x48, 0x33, 
+  0x80, 0x00, 0x04, 0x31, 0x00, 0x80, 0xc5, 0xf6, 0xa6, 0x0d, 0xa0, 0x03, 
+  0xa1, 0x40, 0xc4, 0xc7, 0x56, 0x25, 0x00, 0x1b, 0x80, 0xc1, 0x26, 0x09, 
+  0x60, 0x04, 0x80, 0xc6, 0x98, 0x00, 0xf1, 0x08, 0x55, 0x25, 0x41, 0x1b, 
+  0x20, 0x42, 0xa8, 0x20, 0xc0, 0x02, 0x60, 0x82, 0x04, 0x16, 0x00, 0x14, 
+  0x04, 0x33, 0x00, 0x80, 0xca, 0x20, 0xc5, 0x7a, 0x03, 0xe0, 0x80, 0xc0, 
+  0x10, 0xda, 0xee, 0x0e, 0x2f, 0xed, 0x80, 0xc6, 0x00, 0x14, 0x00, 0x30, 
+  0x9a, 0x00, 0x00, 0x24, 0x04, 0x40, 0x04, 0x16, 0x01, 0x12, 0x54, 0x00, 
+  0x30, 0xca, 0x20, 0x49, 0x9a, 0x05, 0xd0, 0x8f, 0xc9, 0x36, 0x9c, 0x53, 
+  0x44, 0xf7, 0xb0, 0x1d, 0xc3, 0x10, 0xc4, 0xc7, 0x10, 0x00, 0x40, 0x38, 
+  0x37, 0xa4, 0x8c, 0x10, 0x00, 0x13, 0x83, 0x10, 0x00, 0xf0, 0x4d, 0xd3, 
+  0x38, 0xf6, 0xcf, 0x6f, 0x20, 0x0b, 0x00, 0xb0, 0x1d, 0x02, 0x10, 0xc4, 
+  0xc7, 0xe0, 0x78, 0xf1, 0xc0, 0x00, 0x43, 0x0c, 0x70, 0x09, 0xe9, 0x87, 
+  0xea, 0x55, 0x23, 0x40, 0x0c, 0x8a, 0x0e, 0xef, 0xee, 0x55, 0x23, 0x81, 
+  0x09, 0xd1, 0xc0, 0xe0, 0x7e, 0xe0, 0x78, 0xec, 0xc3, 0xac, 0xc1, 0x08, 
+  0x47, 0x0b, 0x80, 0x42, 0x87, 0x2c, 0x87, 0x43, 0xc0, 0x0d, 0x87, 0x7f, 
+  0xdc, 0x17, 0xbc, 0x45, 0xc0, 0x09, 0x6a, 0x48, 0x32, 0x88, 0x00, 0x50, 
+  0x40, 0x48, 0x30, 0x8b, 0x00, 0x31, 0x0a, 0xb2, 0x00, 0x44, 0xc1, 0x40, 
+  0x27, 0x02, 0x1e, 0x4a, 0x21, 0x80, 0x00, 0x94, 0x00, 0xa0, 0x40, 0x24, 
+  0x00, 0x33, 0xa8, 0x20, 0x40, 0x02, 0xa0, 0x80, 0xf6, 0x02, 0xf0, 0x03, 
+  0x01, 0x33, 0x43, 0x03, 0x04, 0x18, 0xd0, 0x00, 0x12, 0x71, 0x24, 0x71, 
+  0xb2, 0xf6, 0x07, 0x34, 0x08, 0x12, 0x24, 0x00, 0xf1, 0x2c, 0x4a, 0x21, 
+  0x00, 0x00, 0x07, 0x34, 0xd1, 0x12, 0xa8, 0x20, 0x40, 0x04, 0x83, 0xc3, 
+  0x35, 0x7b, 0x00, 0x83, 0x15, 0x27, 0x4c, 0x10, 0x4b, 0x84, 0x00, 0x30, 
+  0x00, 0x10, 0x89, 0xc5, 0x02, 0x32, 0x02, 0x00, 0x35, 0x7d, 0x24, 0x71, 
+  0x00, 0xa3, 0x40, 0xa5, 0x89, 0xc0, 0x80, 0xc1, 0xd2, 0x0a, 0x6f, 0xfb, 
+  0x80, 0xc6, 0x61, 0x08, 0xb2, 0x20, 0x4a, 0x25, 0x80, 0xb2, 0x04, 0x61, 
+  0x14, 0x25, 0x40, 0x13, 0x4b, 0x68, 0x5c, 0x03, 0xf3, 0x16, 0x03, 0x83, 
+  0xc1, 0x15, 0x27, 0x83, 0x10, 0x01, 0x49, 0x8b, 0x83, 0x89, 0xc3, 0x15, 
+  0x7b, 0x02, 0x34, 0x41, 0x10, 0x04, 0x71, 0x44, 0x71, 0x20, 0xa3, 0x89, 
+  0xc0, 0x86, 0xc1, 0x96, 0x0a, 0x6f, 0xfb, 0x40, 0x24, 0x12, 0x36, 0x98, 
+  0x00, 0x10, 0x30, 0x98, 0x00, 0xa0, 0x40, 0x80, 0x04, 0x12, 0x01, 0x24, 
+  0x01, 0x31, 0x81, 0x00, 0xfa, 0x01, 0x91, 0x12, 0x75, 0xb0, 0x07, 0xeb, 
+  0xff, 0x40, 0x25, 0x4d, 0x58, 0x00, 0xe0, 0xa8, 0x20, 0xc0, 0x01, 0x00, 
+  0x86, 0x00, 0x31, 0x0b, 0x20, 0x04, 0x1e, 0xd0, 0x12, 0xe8, 0x04, 0x60, 
+  0x00, 0xc2, 0x01, 0xc3, 0x02, 0xc4, 0xe0, 0x06, 0xf0, 0x10, 0x8c, 0x1f, 
+  0x80, 0x10, 0x90, 0x1f, 0xc0, 0x10, 0x01, 0x30, 0xc0, 0x02, 0x94, 0x1f, 
+  0x00, 0x13, 0xcc, 0xc7, 0xe0, 0x78, 0xe2, 0xc3, 0xa3, 0xc1, 0x20, 0x42, 
+  0x08, 0x45, 0x80, 0xc1, 0x2e, 0x6a, 0x00, 0x10, 0x40, 0x32, 0x00, 0x20, 
+  0x02, 0xc2, 0x2e, 0x00, 0xf0, 0x01, 0x25, 0x85, 0x01, 0x30, 0x82, 0x00, 
+  0x0c, 0x71, 0x04, 0x32, 0x40, 0x80, 0x47, 0xf7, 0x26, 0x85, 0x08, 0x00, 
+  0xc0, 0xc3, 0xf6, 0x0c, 0x70, 0xc2, 0xc7, 0xe6, 0xc3, 0xaa, 0xc1, 0x84, 
+  0x80, 0x6e, 0x00, 0x80, 0x08, 0x45, 0x28, 0x47, 0x55, 0x20, 0xce, 0x08, 
+  0xc8, 0x00, 0xf2, 0x39, 0x40, 0x03, 0x04, 0x16, 0x03, 0x14, 0x40, 0x24, 
+  0x41, 0x39, 0x1a, 0x61, 0x04, 0x33, 0x00, 0x83, 0x04, 0x71, 0x6f, 0x21, 
+  0x0b, 0x00, 0x20, 0xaa, 0x52, 0x0a, 0xaf, 0xf5, 0x40, 0x24, 0x40, 0x39, 
+  0x9d, 0x0f, 0x11, 0x10, 0x99, 0x08, 0x30, 0x00, 0x0c, 0x70, 0x49, 0x85, 
+  0x2a, 0x85, 0x50, 0x71, 0x24, 0x71, 0xca, 0x21, 0x8a, 0x00, 0x83, 0x09, 
+  0xa2, 0x00, 0x2a, 0xa5, 0x5c, 0x4d, 0x83, 0xc1, 0xb6, 0x0f, 0x6f, 0xf6, 
+  0x83, 0xc7, 0x08, 0x15, 0xd2, 0x05, 0x41, 0x48, 0x30, 0x81, 0x00, 0xcc, 
+  0x00, 0x81, 0x87, 0x07, 0x30, 0x40, 0x00, 0x04, 0x1f, 0x10, 0x16, 0x00, 
+  0x06, 0xc8, 0x02, 0x97, 0x83, 0xc2, 0x98, 0x10, 0x0c, 0x00, 0x23, 0x4a, 
+  0x86, 0xc8, 0x02, 0x80, 0x86, 0xc0, 0x6a, 0x08, 0xaf, 0xf7, 0x80, 0xc1, 
+  0xc4, 0x00, 0x40, 0x47, 0x85, 0x02, 0xc3, 0xc6, 0x00, 0x60, 0x00, 0x32, 
+  0x81, 0x0f, 0x40, 0x40, 0xe0, 0x07, 0x11, 0xc0, 0xb8, 0x02, 0xf0, 0x1f, 
+  0x0c, 0x70, 0x49, 0xf7, 0x03, 0xc3, 0x04, 0xc2, 0x05, 0xc1, 0x0c, 0x71, 
+  0x60, 0xa6, 0x41, 0xa6, 0x22, 0xa6, 0xc6, 0xc7, 0x0c, 0x70, 0x28, 0x1d, 
+  0x01, 0x10, 0xc6, 0xc7, 0xf6, 0xc3, 0x82, 0x24, 0x10, 0x3d, 0x50, 0x44, 
+  0x08, 0x45, 0x00, 0x24, 0x80, 0x3f, 0x00, 0x00, 0x34, 0x01, 0xfe, 0x07, 
+  0x34, 0x3e, 0x0c, 0x2f, 0xfe, 0x07, 0x62, 0x33, 0x40, 0x24, 0x04, 0x35, 
+  0x56, 0xfe, 0x07, 0xf2, 0x48, 0x34, 0x40, 0x24, 0xc7, 0x33, 0xc1, 0x41, 
+  0x82, 0x42, 0x4a, 0x08, 0x6f, 0xf4, 0x0e, 0x1c, 0xc3, 0x32, 0x14, 0x14, 
+  0x11, 0x30, 0x0f, 0x09, 0x30, 0x20, 0x55, 0x25, 0x10, 0x1b, 0x22, 0x40, 
+  0xd6, 0xc7, 0x0f, 0x14, 0x8f, 0x30, 0x55, 0x25, 0x4e, 0x1a, 0x56, 0x25, 
+  0x15, 0x1b, 0x55, 0x25, 0xd2, 0x18, 0x55, 0x25, 0x93, 0x19, 0x55, 0x25, 
+  0x17, 0x1d, 0x40, 0x25, 0x16, 0x1b, 0x2e, 0x70, 0x4a, 0x20, 0x00, 0x00, 
+  0xed, 0xe8, 0x0e, 0x14, 0x81, 0x30, 0xef, 0x78, 0xd3, 0x09, 0x24, 0x80, 
+  0x04, 0x77, 0x8a, 0xe0, 0x4e, 0x01, 0x0d, 0x00, 0xf0, 0x04, 0xf4, 0x05, 
+  0x28, 0xf0, 0x32, 0xf0, 0x3b, 0xf0, 0x43, 0xf0, 0x55, 0xf0, 0x65, 0xf0, 
+  0x6e, 0xf0, 0x7a, 0xf0, 0x88, 0xf0, 0x90, 0xf0, 0x94, 0x00, 0xf2, 0x05, 
+  0x84, 0xc1, 0x9e, 0x0a, 0xaf, 0xf8, 0x80, 0xc2, 0x00, 0xc3, 0x01, 0xc2, 
+  0x02, 0xc1, 0xc3, 0x40, 0x7a, 0x44, 0x00, 0x00, 0xca, 0x00, 0xf7, 0x08, 
+  0xac, 0x18, 0x00, 0x20, 0x40, 0x86, 0x21, 0x86, 0x02, 0x86, 0x54, 0x1d, 
+  0x98, 0x10, 0x55, 0x1d, 0x58, 0x10, 0x56, 0x1d, 0x18, 0x10, 0x7d, 0x3a, 
+  0x00, 0xd5, 0xc6, 0x0a, 0x2f, 0xf8, 0x86, 0xc2, 0x86, 0xc1, 0x40, 0xda, 
+  0xa2, 0x40, 0x5b, 0x18, 0x00, 0x95, 0xee, 0x0c, 0x6f, 0xf0, 0x84, 0xc1, 
+  0x03, 0xa5, 0x67, 0x12, 0x00, 0xb7, 0xce, 0x09, 0x2f, 0xf6, 0x84, 0xc1, 
+  0x00, 0x18, 0x02, 0x20, 0x5d, 0x3e, 0x00, 0x12, 0x26, 0x78, 0x00, 0xf7, 
+  0x03, 0xc2, 0x01, 0xc1, 0x02, 0xc0, 0x00, 0x1a, 0x80, 0x20, 0x04, 0x1a, 
+  0x40, 0x20, 0x08, 0x1a, 0x00, 0x20, 0x4b, 0x24, 0x00, 0x18, 0x02, 0x24, 
+  0x00, 0xc5, 0x1b, 0x80, 0x20, 0x04, 0x1b, 0x40, 0x20, 0x08, 0x1b, 0x00, 
+  0x20, 0x39, 0x24, 0x00, 0x11, 0x82, 0x6e, 0x00, 0x37, 0x0a, 0xa5, 0x31, 
+  0x36, 0x00, 0xf7, 0x02, 0x9a, 0x08, 0xef, 0xf8, 0x55, 0x24, 0x02, 0x3d, 
+  0x55, 0x24, 0x01, 0x3d, 0x60, 0xda, 0xc2, 0x40, 0x0d, 0x1c, 0x00, 0xf5, 
+  0x02, 0xea, 0x08, 0xef, 0xf9, 0x96, 0xc2, 0x96, 0xc1, 0x78, 0xda, 0xe2, 
+  0x40, 0xb2, 0x0a, 0x0f, 0xed, 0x15, 0x1c, 0x00, 0x11, 0x36, 0x4a, 0x00, 
+  0x55, 0x1c, 0x18, 0x00, 0x20, 0x0b, 0x14, 0x00, 0x11, 0x22, 0x14, 0x00, 
+  0xf0, 0x4f, 0x9c, 0x18, 0x00, 0x20, 0x04, 0xc0, 0x8a, 0x21, 0x3e, 0x06, 
+  0x92, 0x70, 0xca, 0x21, 0x4d, 0x20, 0x2c, 0x71, 0x3c, 0x24, 0x00, 0x20, 
+  0x06, 0x79, 0x3f, 0x67, 0x46, 0xf1, 0xe0, 0x78, 0xe1, 0xc5, 0x48, 0x31, 
+  0x01, 0x00, 0x07, 0x36, 0x4b, 0x70, 0x48, 0x47, 0x00, 0x00, 0x21, 0x80, 
+  0xcb, 0x45, 0x83, 0x3a, 0x6f, 0x12, 0x3f, 0xdc, 0x0d, 0x70, 0x48, 0x31, 
+  0x81, 0x00, 0x18, 0xbc, 0x00, 0x33, 0x41, 0x10, 0x00, 0x31, 0x42, 0x03, 
+  0x81, 0x41, 0x04, 0x32, 0x00, 0x82, 0xcf, 0x21, 0xec, 0x07, 0x70, 0x90, 
+  0x01, 0x32, 0x41, 0x00, 0x48, 0x31, 0xc2, 0x02, 0x48, 0x33, 0x01, 0x00, 
+  0x20, 0x00, 0x40, 0x49, 0x22, 0x03, 0x02, 0x24, 0x00, 0x40, 0x48, 0x23, 
+  0x01, 0x01, 0x26, 0x00, 0xf0, 0x0b, 0x22, 0xa0, 0x03, 0xf6, 0x9f, 0xbc, 
+  0x01, 0x32, 0x01, 0x03, 0x48, 0x31, 0xc1, 0x02, 0x49, 0x21, 0x41, 0x06, 
+  0x48, 0x21, 0x01, 0x01, 0x29, 0xa0, 0xc2, 0xc4, 0x70, 0x00, 0x00, 0xbc, 
+  0x02, 0xf1, 0x26, 0x47, 0xdd, 0xc3, 0x41, 0xdc, 0x44, 0x30, 0x4e, 0x18, 
+  0xbd, 0xcb, 0x44, 0xa3, 0x42, 0x0b, 0xd7, 0xc3, 0x43, 0xd3, 0x3e, 0x98, 
+  0xdd, 0xc3, 0x42, 0x3b, 0x4a, 0xc1, 0xbf, 0x26, 0xa0, 0x00, 0x41, 0x35, 
+  0x18, 0x03, 0x02, 0xac, 0xa0, 0x8b, 0xa0, 0x6a, 0xa0, 0x1c, 0x18, 0x80, 
+  0x00, 0xa8, 0x20, 0x00, 0x01, 0x04, 0x19, 0x11, 0x90, 0x04, 0x04, 0x0c, 
+  0x00, 0x80, 0x34, 0x18, 0x03, 0x00, 0x20, 0x18, 0x03, 0x00, 0x54, 0x00, 
+  0x40, 0xea, 0xc3, 0xa7, 0xc1, 0x1c, 0x00, 0xc0, 0x68, 0x40, 0x48, 0x46, 
+  0x28, 0x43, 0x08, 0x45, 0x0c, 0x70, 0x84, 0xc4, 0x74, 0x05, 0xf0, 0x05, 
+  0x02, 0x4d, 0xf0, 0x23, 0x01, 0x10, 0x15, 0x24, 0x03, 0x10, 0x04, 0x71, 
+  0x02, 0x31, 0x81, 0x00, 0x20, 0xa3, 0x49, 0x85, 0x28, 0x00, 0x41, 0x81, 
+  0xc3, 0x81, 0xc0, 0x6c, 0x05, 0x61, 0x14, 0x01, 0x14, 0x00, 0x32, 0x41, 
+  0x3a, 0x04, 0x00, 0x18, 0x00, 0x43, 0x0a, 0x20, 0x40, 0x03, 0x54, 0x04, 
+  0x34, 0x13, 0x01, 0x04, 0x54, 0x04, 0x11, 0x09, 0x34, 0x00, 0x60, 0x2d, 
+  0x70, 0x02, 0x36, 0x06, 0x70, 0x58, 0x01, 0x01, 0xe0, 0x03, 0xf0, 0x10, 
+  0x04, 0x81, 0xc2, 0x84, 0xc3, 0x15, 0x22, 0x0c, 0x00, 0x03, 0x4b, 0xe0, 
+  0x84, 0x15, 0x25, 0x01, 0x10, 0x23, 0x81, 0x00, 0x37, 0xc3, 0x10, 0x04, 
+  0x71, 0x01, 0x31, 0xc1, 0x00, 0x20, 0xa4, 0x32, 0x00, 0x01, 0xd0, 0x04, 
+  0x50, 0x02, 0x01, 0x4a, 0x15, 0x25, 0x80, 0x00, 0x73, 0x00, 0x36, 0x41, 
+  0x00, 0x0c, 0x1b, 0x40, 0xc4, 0x00, 0xf1, 0x0c, 0x40, 0x02, 0x15, 0x25, 
+  0x40, 0x12, 0x03, 0x80, 0x15, 0x20, 0x41, 0x12, 0x25, 0x71, 0x00, 0xa1, 
+  0x84, 0xc1, 0x61, 0x40, 0xba, 0x0c, 0x6f, 0xf7, 0x84, 0xc7, 0x8c, 0x6e, 
+  0x00, 0x02, 0x0c, 0x05, 0xa0, 0x04, 0x17, 0x03, 0x14, 0x2c, 0x70, 0x40, 
+  0x24, 0x42, 0x30, 0x44, 0x04, 0xd0, 0x1a, 0x62, 0x04, 0x71, 0xca, 0x21, 
+  0x69, 0x00, 0x20, 0xaa, 0x8e, 0x0f, 0x6f, 0x46, 0x04, 0x21, 0x30, 0x67, 
+  0x2c, 0x00, 0x20, 0x10, 0x40, 0x40, 0x03, 0xa0, 0xa8, 0x20, 0xc0, 0x03, 
+  0x15, 0x25, 0x02, 0x10, 0xe3, 0x82, 0x32, 0x00, 0x80, 0x4c, 0x30, 0x04, 
+  0x37, 0xc0, 0x90, 0x1a, 0x64, 0x32, 0x00, 0x53, 0x6a, 0x00, 0x20, 0xaa, 
+  0x5e, 0x32, 0x00, 0x11, 0x66, 0x32, 0x00, 0x20, 0x08, 0x47, 0x60, 0x00, 
+  0x20, 0x00, 0x04, 0x30, 0x00, 0x43, 0x0c, 0x12, 0x0b, 0x00, 0x32, 0x00, 
+  0x14, 0x33, 0x32, 0x00, 0x00, 0x64, 0x00, 0x13, 0x2a, 0x32, 0x00, 0xf1, 
+  0x24, 0x04, 0xe8, 0x34, 0x1d, 0x03, 0x10, 0x0f, 0xf0, 0x34, 0x15, 0x80, 
+  0x10, 0x35, 0x15, 0x81, 0x10, 0x04, 0x71, 0x0f, 0x7a, 0x0b, 0x09, 0x85, 
+  0x00, 0x34, 0x1d, 0x42, 0x10, 0x03, 0xf0, 0x34, 0x1d, 0x02, 0x10, 0x84, 
+  0xc1, 0xa1, 0x40, 0x79, 0x27, 0x0f, 0x10, 0xfa, 0x0b, 0x6f, 0xf7, 0x40, 
+  0x24, 0x11, 0x34, 0x8b, 0x64, 0x00, 0x02, 0x94, 0x00, 0x6f, 0x80, 0x03, 
+  0x04, 0x11, 0x03, 0x24, 0xc4, 0x00, 0x01, 0x22, 0xca, 0x0e, 0x60, 0x00, 
+  0xf1, 0x29, 0x13, 0xe8, 0x82, 0xbf, 0x50, 0x27, 0x40, 0x10, 0x16, 0x70, 
+  0xcf, 0x20, 0x62, 0x00, 0x00, 0xae, 0x20, 0x15, 0x81, 0x10, 0x0f, 0x7a, 
+  0x11, 0x0a, 0x40, 0x00, 0x20, 0x1d, 0x02, 0x10, 0x00, 0x8e, 0x87, 0xb8, 
+  0x00, 0xae, 0xca, 0xc7, 0xdf, 0x08, 0x11, 0xa0, 0x35, 0x15, 0x80, 0x10, 
+  0x34, 0x15, 0x81, 0x10, 0xd5, 0x09, 0x05, 0x80, 0xe7, 0xf1, 0xb0, 0x01, 
+  0x10, 0x21, 0x64, 0x00, 0x0f, 0x1c, 0x02, 0x03, 0x20, 0xe0, 0x7f, 0x1e, 
+  0x02, 0xf0, 0x11, 0xe0, 0x78, 0xc3, 0x40, 0xa0, 0x00, 0x7c, 0x7e, 0x00, 
+  0x80, 0x2c, 0x70, 0x4c, 0x70, 0x75, 0x03, 0x2f, 0xfd, 0x6c, 0x70, 0xe0, 
+  0x78, 0xe2, 0xc2, 0xcb, 0x45, 0xa0, 0x00, 0x58, 0x7e, 0x21, 0x85, 0x1e, 
+  0x00, 0xf1, 0x04, 0x88, 0x6e, 0x00, 0x80, 0x24, 0x77, 0x8a, 0x08, 0x6f, 
+  0xfd, 0x21, 0xa5, 0x00, 0x1d, 0x03, 0x10, 0xc2, 0xc6, 0xe4, 0x20, 0x00, 
+  0xf0, 0x2f, 0x68, 0xb2, 0x08, 0x46, 0x58, 0x25, 0xc3, 0x19, 0x0c, 0xd8, 
+  0x1c, 0xd9, 0x8c, 0x70, 0xba, 0x09, 0x2f, 0xfd, 0xa1, 0x42, 0xc3, 0x41, 
+  0xa0, 0x00, 0x60, 0x7e, 0x00, 0xa1, 0x56, 0x25, 0x85, 0x1a, 0x57, 0x25, 
+  0x86, 0x1a, 0xc3, 0x40, 0x12, 0x00, 0xcc, 0x92, 0xc3, 0x41, 0x13, 0x00, 
+  0x87, 0x78, 0x8a, 0x22, 0x18, 0x00, 0x8a, 0x24, 0x42, 0x00, 0xa6, 0x0e, 
+  0xaf, 0xfe, 0xc1, 0x43, 0x2a, 0x00, 0xf0, 0x0b, 0x88, 0x6e, 0x00, 0xa1, 
+  0xc4, 0xc6, 0xe0, 0x78, 0xe4, 0xc3, 0xa1, 0xc1, 0x80, 0xc2, 0x0c, 0x70, 
+  0x2c, 0x77, 0x4a, 0x08, 0x6f, 0xfd, 0x6c, 0x77, 0x14, 0xe8, 0x60, 0x00, 
+  0xa0, 0x7c, 0x7e, 0x00, 0x85, 0x2c, 0x70, 0x4c, 0x77, 0x86, 0x09, 0x96, 
+  0x00, 0x20, 0x7a, 0xe8, 0x32, 0x00, 0xf1, 0x03, 0x58, 0x7e, 0x00, 0x89, 
+  0x08, 0xe8, 0x00, 0xc6, 0x00, 0x19, 0x03, 0x00, 0x0b, 0xf0, 0xcd, 0x70, 
+  0x09, 0xf0, 0x24, 0x00, 0xb0, 0x70, 0x6c, 0x70, 0xba, 0x0a, 0x2f, 0xfd, 
+  0xcd, 0x70, 0xc1, 0x40, 0xe4, 0x07, 0xf0, 0x11, 0x50, 0x21, 0xc3, 0x07, 
+  0x17, 0x0b, 0x23, 0x00, 0x6c, 0x21, 0x81, 0x07, 0x00, 0x21, 0x81, 0x8f, 
+  0x00, 0x80, 0x00, 0x00, 0x6c, 0x77, 0x01, 0x22, 0xc2, 0x80, 0x25, 0x78, 
+  0xe0, 0x7f, 0x40, 0x41, 0x70, 0x00, 0xf0, 0x1d, 0x0a, 0x25, 0x80, 0x1f, 
+  0xa0, 0x00, 0x30, 0x7e, 0x86, 0x0f, 0xcf, 0xff, 0x7e, 0xe8, 0xb4, 0xd9, 
+  0xc3, 0x40, 0xf0, 0x00, 0x4b, 0x00, 0xc3, 0x42, 0xa0, 0x00, 0x48, 0xac, 
+  0x20, 0xa8, 0x00, 0x8a, 0x05, 0xe8, 0x01, 0x82, 0x04, 0x71, 0x01, 0xa2, 
+  0xf0, 0xf1, 0x2c, 0x72, 0x60, 0x00, 0xf0, 0x41, 0xa1, 0x40, 0xdb, 0x59, 
+  0xd6, 0x0e, 0xef, 0xff, 0x08, 0x46, 0x1c, 0x8d, 0xcd, 0x08, 0x9e, 0x80, 
+  0x03, 0x1c, 0x03, 0x30, 0x02, 0x1c, 0x82, 0x33, 0x01, 0x1c, 0x03, 0x32, 
+  0x3b, 0x58, 0x00, 0x42, 0x20, 0x43, 0x40, 0x24, 0x41, 0x30, 0xfe, 0xd8, 
+  0x52, 0x0f, 0x6f, 0xfb, 0x8c, 0x70, 0xd6, 0xf1, 0xf8, 0x1c, 0xc8, 0xb7, 
+  0x09, 0xe8, 0x22, 0x81, 0x20, 0x81, 0x61, 0xc1, 0xae, 0x0d, 0x6f, 0xfb, 
+  0x81, 0xc1, 0x0c, 0x70, 0x02, 0xf0, 0x23, 0xd8, 0x08, 0x14, 0x1f, 0x34, 
+  0xe0, 0x7e, 0xe0, 0x78, 0x20, 0x00, 0x73, 0x08, 0xe8, 0x3a, 0x80, 0x61, 
+  0xc1, 0x92, 0x1e, 0x00, 0x15, 0x03, 0x1e, 0x00, 0xc0, 0xf1, 0xc0, 0x62, 
+  0x08, 0x00, 0x00, 0xd1, 0xc0, 0xe0, 0x7f, 0x0c, 0x70, 0x10, 0x04, 0x21, 
+  0x00, 0x77, 0x10, 0x01, 0x90, 0xac, 0x2c, 0x70, 0xcb, 0x44, 0xa0, 0x00, 
+  0x14, 0xaf, 0x9c, 0x02, 0xf1, 0x15, 0x5a, 0x21, 0x00, 0x06, 0xc3, 0x43, 
+  0x06, 0x01, 0xff, 0x00, 0x24, 0x71, 0x1a, 0x65, 0x62, 0xa2, 0x40, 0x24, 
+  0x03, 0x16, 0x78, 0x60, 0x04, 0x1a, 0xc1, 0x02, 0x00, 0xa2, 0x4a, 0x24, 
+  0x80, 0x71, 0x0a, 0x20, 0x00, 0x03, 0xf0, 0x01, 0xf0, 0x06, 0x18, 0x11, 
+  0x00, 0x0c, 0x1c, 0xc1, 0x10, 0x14, 0x1c, 0x41, 0x10, 0x0c, 0x70, 0x04, 
+  0x1c, 0x81, 0x10, 0xc2, 0xc4, 0xc3, 0x43, 0xe6, 0x00, 0xf0, 0x17, 0x00, 
+  0x8b, 0x08, 0xe8, 0x02, 0x83, 0x24, 0x83, 0x41, 0x68, 0x01, 0x69, 0x42, 
+  0xa3, 0xe0, 0x7f, 0x04, 0xa3, 0x24, 0x83, 0x08, 0xe9, 0x03, 0x83, 0x09, 
+  0x08, 0x45, 0x00, 0x23, 0xa3, 0x10, 0x1b, 0x01, 0x00, 0x05, 0x00, 0x00, 
+  0x00, 0xe8, 0x06, 0x40, 0x02, 0x38, 0xcb, 0x47, 0x2c, 0x01, 0xf0, 0xff, 
+  0xae, 0x28, 0x87, 0x02, 0x87, 0x69, 0x87, 0x43, 0x87, 0x00, 0x21, 0x01, 
+  0x80, 0xcd, 0x70, 0xae, 0x70, 0x0e, 0x70, 0xce, 0x70, 0x01, 0x22, 0xc0, 
+  0x80, 0xd3, 0x44, 0xa0, 0x00, 0xdc, 0xab, 0x4b, 0xc6, 0x4a, 0xc6, 0x49, 
+  0xc6, 0x22, 0xa7, 0x03, 0xa7, 0x5a, 0x25, 0x03, 0x27, 0x00, 0x24, 0xcd, 
+  0x20, 0x05, 0x85, 0x14, 0x70, 0x10, 0x42, 0x58, 0xf2, 0x03, 0x85, 0x22, 
+  0x87, 0x84, 0x85, 0x43, 0x87, 0x08, 0x15, 0x0b, 0x10, 0x04, 0x15, 0x08, 
+  0x10, 0x02, 0x21, 0x09, 0x80, 0x03, 0x22, 0x00, 0x83, 0x3c, 0x21, 0x08, 
+  0x12, 0x3c, 0x20, 0xcc, 0x02, 0x71, 0x70, 0xca, 0x24, 0x01, 0x12, 0x95, 
+  0x70, 0x42, 0xf4, 0x98, 0x8d, 0x32, 0x23, 0x13, 0x05, 0x40, 0x24, 0x00, 
+  0x23, 0x78, 0x60, 0x23, 0xa5, 0x41, 0xa0, 0x88, 0xec, 0xa2, 0x0b, 0x20, 
+  0x06, 0x42, 0x40, 0x14, 0x70, 0x18, 0xad, 0x34, 0xf2, 0x50, 0x12, 0x01, 
+  0x20, 0x42, 0x40, 0x60, 0x79, 0x18, 0x1c, 0xc2, 0x34, 0x80, 0x12, 0x11, 
+  0x20, 0x78, 0x12, 0x01, 0x20, 0xcf, 0x7a, 0x89, 0xc3, 0x55, 0x7b, 0x47, 
+  0xc0, 0x00, 0x1b, 0x40, 0x04, 0x14, 0x1c, 0x40, 0x34, 0x2f, 0x27, 0x3f, 
+  0x03, 0x6f, 0x23, 0x3f, 0x00, 0x00, 0x81, 0x61, 0x81, 0x22, 0x81, 0x2f, 
+  0x26, 0x3f, 0x03, 0x43, 0xc1, 0x42, 0xc3, 0x5f, 0x22, 0x01, 0x06, 0x5f, 
+  0x22, 0x03, 0x03, 0x41, 0xc0, 0x96, 0xc0, 0x8d, 0xc2, 0x19, 0x61, 0x7a, 
+  0x62, 0xb6, 0x09, 0xaf, 0xee, 0x81, 0xc0, 0x0d, 0x0e, 0x10, 0x20, 0x05, 
+  0x87, 0x09, 0x0b, 0x01, 0x20, 0x50, 0x21, 0xd0, 0x27, 0xc5, 0x71, 0xce, 
+  0x71, 0xa6, 0x71, 0xb6, 0x73, 0x40, 0x07, 0xc5, 0xff, 0x06, 0x87, 0x15, 
+  0x08, 0x22, 0x04, 0x02, 0x20, 0x00, 0x04, 0x0d, 0x08, 0x83, 0x0f, 0x00, 
+  0x00, 0x00, 0x19, 0xd6, 0xc7, 0x2f, 0x26, 0x87, 0x93, 0x18, 0x1f, 0x00, 
+  0x14, 0xfb, 0xf3, 0xad, 0x70, 0x5c, 0x8f, 0x5a, 0x25, 0x00, 0x16, 0x96, 
+  0xc1, 0x19, 0x61, 0x2d, 0x0a, 0x3e, 0x00, 0x04, 0x19, 0x00, 0x04, 0x10, 
+  0x89, 0x22, 0x81, 0x89, 0xc2, 0x10, 0x17, 0x86, 0x10, 0xf0, 0x22, 0x47, 
+  0x03, 0x62, 0x81, 0x41, 0x81, 0x20, 0x81, 0xac, 0x70, 0x0a, 0x24, 0x00, 
+  0x04, 0x0e, 0x08, 0xef, 0xfa, 0x00, 0x1c, 0x01, 0x30, 0xa5, 0x71, 0xcd, 
+  0x0d, 0x84, 0x93, 0x10, 0x8f, 0x96, 0xc2, 0x2c, 0x71, 0x04, 0x71, 0x10, 
+  0xaf, 0xe1, 0x40, 0xc1, 0x43, 0x30, 0x1c, 0x01, 0x37, 0xdb, 0x59, 0x14, 
+  0x70, 0xba, 0x00, 0x2b, 0x00, 0x08, 0x45, 0xcf, 0xf5, 0x55, 0x24, 0x91, 
+  0x29, 0x8c, 0xc2, 0xe1, 0x40, 0x22, 0x41, 0xdd, 0x59, 0x2e, 0x41, 0x10, 
+  0x43, 0x42, 0x21, 0x55, 0x00, 0x3b, 0x58, 0x10, 0x47, 0x30, 0x46, 0x4e, 
+  0x70, 0xcd, 0x70, 0xad, 0x70, 0x0c, 0xc0, 0x65, 0x0a, 0x05, 0x20, 0x5a, 
+  0x22, 0x10, 0x26, 0x00, 0x24, 0x00, 0x24, 0x9c, 0x10, 0x0b, 0x00, 0x2d, 
+  0x0b, 0x60, 0x15, 0xa8, 0x10, 0x0c, 0x01, 0xfe, 0xe4, 0x07, 0xf4, 0x7e, 
+  0xdc, 0x0a, 0x25, 0xc0, 0x22, 0xea, 0x46, 0xca, 0x45, 0x0a, 0xf0, 0x61, 
+  0x40, 0xe2, 0x41, 0xfa, 0x0c, 0xef, 0xff, 0xc2, 0x42, 0x08, 0x46, 0x28, 
+  0x45, 0x18, 0x00, 0xf5, 0x2f, 0xca, 0x08, 0xaf, 0xf8, 0x9d, 0x78, 0x10, 
+  0xe8, 0x75, 0x80, 0x0e, 0xeb, 0x4b, 0x80, 0x2a, 0x80, 0xa7, 0x7a, 0xc7, 
+  0x79, 0x05, 0x21, 0xbe, 0x80, 0x06, 0xf2, 0x00, 0x20, 0x41, 0x24, 0xca, 
+  0xa0, 0x60, 0x7b, 0xab, 0xa0, 0x46, 0x71, 0xd0, 0xf1, 0x29, 0x0b, 0x50, 
+  0x20, 0x3c, 0x8f, 0x25, 0x09, 0x1e, 0x00, 0x23, 0x1c, 0x02, 0x30, 0x22, 
+  0x1c, 0xc2, 0x34, 0x21, 0x1c, 0xc3, 0x31, 0xe6, 0x02, 0x50, 0x38, 0xfe, 
+  0xd8, 0x6e, 0x0c, 0xe6, 0x02, 0xe0, 0x59, 0x0b, 0xd0, 0xa0, 0x75, 0xf1, 
+  0x96, 0x0a, 0x6f, 0xfb, 0x51, 0xd8, 0xb3, 0x79, 0x42, 0x03, 0xf0, 0x33, 
+  0x4c, 0x00, 0x20, 0xb0, 0xd6, 0xc7, 0xf4, 0xc2, 0x96, 0x0d, 0x4f, 0xf8, 
+  0x06, 0x0c, 0x6f, 0xf8, 0x10, 0x42, 0x10, 0x43, 0x2e, 0x70, 0xcb, 0x46, 
+  0xa0, 0x00, 0x30, 0xac, 0xce, 0x70, 0xed, 0x70, 0xae, 0x70, 0x4a, 0x24, 
+  0x00, 0x20, 0xa1, 0x86, 0x0c, 0x70, 0x08, 0x16, 0x10, 0x14, 0x04, 0x35, 
+  0x80, 0x9f, 0x7f, 0x47, 0x00, 0xff, 0xca, 0x20, 0x6b, 0x00, 0x04, 0x35, 
+  0x40, 0x94, 0xca, 0x25, 0x8e, 0x1f, 0x42, 0x06, 0xa0, 0x14, 0x70, 0x49, 
+  0x08, 0x30, 0x20, 0xca, 0x25, 0x21, 0x10, 0x16, 0x00, 0xf0, 0x0f, 0x3c, 
+  0x00, 0x2e, 0x00, 0x02, 0x40, 0x42, 0x41, 0x3a, 0x0d, 0x6f, 0xf8, 0x62, 
+  0x42, 0x13, 0xe8, 0x2a, 0x0c, 0xcf, 0xf7, 0x04, 0x35, 0x40, 0x95, 0xce, 
+  0x71, 0x0a, 0xf6, 0x10, 0xf4, 0xa2, 0x04, 0xf0, 0x0f, 0x14, 0xaf, 0xe1, 
+  0x48, 0xf0, 0x20, 0x00, 0x04, 0x11, 0x09, 0x03, 0x00, 0xb1, 0x45, 0x0a, 
+  0x47, 0x04, 0xf0, 0x02, 0x0a, 0x6f, 0xfb, 0x54, 0xd8, 0x86, 0x71, 0x99, 
+  0x0c, 0xd4, 0xa0, 0x3c, 0x03, 0xf2, 0xcd, 0x30, 0x7e, 0x0b, 0x0e, 0x11, 
+  0x20, 0x18, 0x1d, 0xc1, 0x1f, 0xd4, 0xc6, 0x5e, 0x0e, 0x00, 0x05, 0x1e, 
+  0xe8, 0xe2, 0x0b, 0xcf, 0xf7, 0x05, 0x85, 0xf5, 0x08, 0xc0, 0x83, 0xea, 
+  0x0c, 0x4f, 0xf8, 0x5a, 0x0b, 0x6f, 0xf8, 0x08, 0x46, 0x00, 0x42, 0xe1, 
+  0x40, 0xd2, 0x0c, 0x6f, 0xf8, 0xc1, 0x41, 0x08, 0x46, 0x0e, 0xe8, 0x36, 
+  0x0e, 0x00, 0x05, 0x0a, 0xe8, 0x27, 0x80, 0x04, 0xe9, 0x00, 0x19, 0x01, 
+  0x00, 0x00, 0xa6, 0xe5, 0xa5, 0xc7, 0xa0, 0xd4, 0xc6, 0x56, 0xd8, 0x03, 
+  0xf0, 0x54, 0xd8, 0xa2, 0x09, 0x4f, 0xfb, 0xd4, 0xc6, 0xea, 0xc2, 0xa0, 
+  0x80, 0x08, 0x46, 0x30, 0x41, 0x08, 0x18, 0x43, 0x00, 0x4f, 0x0d, 0x10, 
+  0x10, 0x36, 0x08, 0xaf, 0xf9, 0xa1, 0x40, 0x21, 0xe8, 0x0e, 0x0f, 0x6f, 
+  0xf8, 0xa1, 0x40, 0x32, 0x08, 0x8f, 0xf9, 0x1b, 0xe8, 0x1d, 0x95, 0x3c, 
+  0x95, 0xe1, 0x68, 0x2d, 0x0f, 0x44, 0x10, 0x15, 0x85, 0xed, 0x70, 0x00, 
+  0x1e, 0x41, 0x70, 0xa0, 0x00, 0x34, 0x41, 0x10, 0x40, 0x08, 0x1d, 0x43, 
+  0x10, 0x0a, 0xe8, 0x0a, 0x86, 0x22, 0x41, 0x0a, 0xa5, 0x0b, 0x86, 0x0b, 
+  0xa5, 0x23, 0x20, 0x00, 0x04, 0xa1, 0x40, 0xe8, 0xad, 0xfd, 0xb5, 0xa0, 
+  0x85, 0xdc, 0xed, 0x0c, 0x70, 0x08, 0x1e, 0x03, 0x10, 0xca, 0xc6, 0xe0, 
+  0x78, 0xfa, 0xc2, 0x30, 0x46, 0x46, 0x0c, 0x6f, 0xf8, 0x18, 0x41, 0xb6, 
+  0x0a, 0x6f, 0xf8, 0x18, 0x40, 0x10, 0x47, 0xcd, 0x70, 0xbd, 0x0e, 0x30, 
+  0x20, 0x6e, 0x77, 0x0e, 0x70, 0xed, 0x77, 0xae, 0x70, 0x2e, 0x70, 0x7e, 
+  0x03, 0xf0, 0x0d, 0x16, 0x21, 0x12, 0x34, 0x4e, 0x40, 0x5a, 0x20, 0x0d, 
+  0x27, 0x04, 0x30, 0x80, 0x83, 0x82, 0x75, 0xc4, 0xa5, 0x64, 0x00, 0x2c, 
+  0x00, 0xc3, 0xa5, 0x04, 0x30, 0x80, 0x8f, 0x64, 0x01, 0xf2, 0x0f, 0x54, 
+  0x00, 0x06, 0x00, 0x07, 0x36, 0x00, 0x70, 0x6e, 0x4e, 0x28, 0x6b, 0xf6, 
+  0x08, 0xcf, 0xec, 0x00, 0x42, 0x3c, 0x25, 0x88, 0x20, 0x3c, 0x21, 0x4c, 
+  0x20, 0x0c, 0x21, 0x40, 0xa0, 0x80, 0x03, 0xf1, 0x31, 0x3c, 0x22, 0xcb, 
+  0x04, 0x3c, 0x21, 0xc3, 0x03, 0xca, 0x21, 0x42, 0x20, 0xca, 0x25, 0x82, 
+  0x20, 0x30, 0x77, 0x46, 0x40, 0xca, 0x23, 0xc1, 0x02, 0x74, 0x70, 0x22, 
+  0xa5, 0x41, 0xa5, 0x3c, 0x77, 0xca, 0x23, 0x82, 0x20, 0x03, 0x41, 0xe2, 
+  0x42, 0xae, 0x0b, 0x6f, 0xf8, 0x00, 0xa5, 0x04, 0xf0, 0x0c, 0x70, 0xd8, 
+  0xad, 0x06, 0x71, 0x89, 0x08, 0xa4, 0xa5, 0x05, 0xa5, 0x0a, 0x24, 0x80, 
+  0x75, 0x98, 0x04, 0xf0, 0x18, 0x26, 0x00, 0x17, 0x82, 0x70, 0x25, 0x80, 
+  0x09, 0xe9, 0x41, 0x80, 0x22, 0x80, 0x0e, 0x22, 0x42, 0x85, 0x03, 0x21, 
+  0x41, 0xa0, 0x43, 0xa0, 0x24, 0xa0, 0xc5, 0x71, 0xaa, 0x46, 0x04, 0xf0, 
+  0xed, 0x77, 0x2e, 0x70, 0x02, 0x26, 0xc2, 0x94, 0xce, 0x05, 0xf0, 0xb1, 
+  0x30, 0x7e, 0x03, 0x21, 0xc0, 0xa3, 0x20, 0x19, 0xc0, 0x04, 0xe9, 0xa1, 
+  0x42, 0xa1, 0x03, 0xa1, 0xda, 0xc6, 0xe0, 0x78, 0xf4, 0xc3, 0x82, 0x24, 
+  0x0c, 0x3f, 0x50, 0x42, 0x70, 0x40, 0x28, 0x45, 0x08, 0x46, 0x07, 0xea, 
+  0x2c, 0x70, 0xa1, 0x40, 0x2a, 0x0f, 0xaf, 0xfa, 0x42, 0x42, 0x4a, 0x24, 
+  0xc0, 0x73, 0xfe, 0xd9, 0x00, 0x26, 0x8f, 0x1f, 0x00, 0x00, 0x82, 0x03, 
+  0x0c, 0x74, 0x22, 0xad, 0x2e, 0x71, 0x81, 0xc2, 0x4a, 0x21, 0x40, 0x00, 
+  0x00, 0x1c, 0x01, 0x31, 0xa8, 0x20, 0x40, 0x01, 0x01, 0x1a, 0x52, 0x00, 
+  0x24, 0x71, 0x19, 0x08, 0x30, 0x20, 0x4c, 0x20, 0xc0, 0xa3, 0x2e, 0x01, 
+  0x2d, 0x00, 0x04, 0x1c, 0x02, 0x34, 0x03, 0x1d, 0x02, 0x14, 0x06, 0xf0, 
+  0x4a, 0x21, 0xc0, 0x23, 0x03, 0x1d, 0x03, 0x10, 0xd1, 0x43, 0x54, 0x26, 
+  0x15, 0x19, 0x54, 0x26, 0x96, 0x1b, 0x0e, 0x70, 0x40, 0x24, 0x14, 0x31, 
+  0x80, 0x23, 0x07, 0x2d, 0x01, 0x14, 0x80, 0x24, 0x04, 0x77, 0xef, 0x08, 
+  0xd5, 0x03, 0x25, 0x20, 0x00, 0x00, 0x10, 0xf0, 0x1c, 0xf0, 0x2e, 0xf0, 
+  0x39, 0xf0, 0x4d, 0xf0, 0x4d, 0xf0, 0x4f, 0xf0, 0x4f, 0xf0, 0x52, 0xf0, 
+  0x58, 0xf0, 0x5b, 0xf0, 0x5b, 0xf0, 0x5d, 0xf0, 0x5d, 0xf0, 0x5f, 0xf0, 
+  0x56, 0x24, 0x40, 0x3d, 0x14, 0xda, 0x56, 0x08, 0xef, 0xec, 0xa2, 0x41, 
+  0x0c, 0x00, 0xe0, 0x80, 0xc3, 0xa1, 0x41, 0x4a, 0x0e, 0xe0, 0x04, 0x42, 
+  0x42, 0x57, 0xf0, 0x00, 0x24, 0xbe, 0x02, 0xa4, 0x94, 0x01, 0x14, 0xda, 
+  0x36, 0x08, 0xef, 0xec, 0xc2, 0x41, 0x10, 0x00, 0x00, 0x24, 0x00, 0xf0, 
+  0x07, 0x12, 0x08, 0x20, 0x05, 0x42, 0x42, 0x45, 0xf0, 0x85, 0xc0, 0x8a, 
+  0x22, 0x06, 0x00, 0x16, 0x08, 0xef, 0xec, 0x62, 0x41, 0x85, 0xc0, 0x1a, 
+  0x00, 0x11, 0x7e, 0x1a, 0x00, 0xf2, 0x07, 0x37, 0xf0, 0x70, 0x16, 0x82, 
+  0x10, 0x00, 0x24, 0x81, 0x3f, 0x00, 0x00, 0xbc, 0x01, 0x7e, 0x09, 0xa0, 
+  0x04, 0xdf, 0x16, 0x00, 0x16, 0x42, 0x00, 0x11, 0xbc, 0x42, 0x00, 0x20, 
+  0x52, 0x09, 0x28, 0x00, 0xf1, 0x09, 0x23, 0xf0, 0x0a, 0x86, 0x0a, 0xf0, 
+  0x0b, 0x86, 0x08, 0xf0, 0x0c, 0x86, 0x06, 0xf0, 0xdd, 0x16, 0x00, 0x16, 
+  0x04, 0xf0, 0xde, 0x16, 0x00, 0x16, 0x22, 0x00, 0x10, 0x0b, 0x22, 0x00, 
+  0xf0, 0x0b, 0x13, 0xf0, 0xff, 0x17, 0x80, 0x90, 0x0a, 0xf0, 0x00, 0x8f, 
+  0x08, 0xf0, 0x01, 0x8f, 0x06, 0xf0, 0x02, 0x8f, 0x04, 0xf0, 0x03, 0x8f, 
+  0x02, 0xf0, 0x04, 0x8f, 0x24, 0x00, 0x11, 0xce, 0x24, 0x00, 0xf1, 0x10, 
+  0x06, 0x71, 0x0d, 0x08, 0x44, 0xa4, 0x00, 0xc0, 0x41, 0x28, 0x01, 0x02, 
+  0x00, 0xad, 0x21, 0xad, 0xd4, 0xc7, 0xee, 0xc3, 0xa1, 0xc1, 0x50, 0x42, 
+  0x68, 0x46, 0x28, 0x45, 0x10, 0x40, 0x06, 0x76, 0x01, 0x20, 0xb6, 0x0d, 
+  0x76, 0x01, 0x20, 0xfe, 0xd9, 0x5e, 0x01, 0xf0, 0x05, 0x22, 0xad, 0x07, 
+  0xee, 0x53, 0x0e, 0xf5, 0x10, 0x0c, 0x74, 0xc3, 0xad, 0x6e, 0x71, 0x05, 
+  0xf0, 0x6e, 0x72, 0xcd, 0x71, 0x4e, 0x01, 0xf1, 0x16, 0x8a, 0x21, 0x0e, 
+  0x20, 0xed, 0x71, 0x19, 0x0e, 0xb0, 0x10, 0x80, 0xc3, 0x21, 0x0e, 0x71, 
+  0x10, 0x80, 0xc3, 0x42, 0x42, 0x02, 0x40, 0x9e, 0x0d, 0x20, 0x05, 0xa1, 
+  0x41, 0x08, 0xf0, 0x32, 0x20, 0x40, 0x24, 0xa1, 0x41, 0x5e, 0x72, 0x00, 
+  0x86, 0x72, 0x77, 0xcd, 0x72, 0xed, 0x72, 0xac, 0xf7, 0x74, 0x00, 0xf0, 
+  0x58, 0xce, 0xc7, 0xe8, 0xc2, 0x48, 0x46, 0x28, 0x47, 0x2c, 0x70, 0x10, 
+  0xda, 0x60, 0x40, 0x0a, 0x20, 0x00, 0x21, 0x42, 0x0d, 0xaf, 0xfa, 0x68, 
+  0x45, 0x0c, 0x70, 0x36, 0xef, 0x29, 0x6e, 0x21, 0x09, 0xf5, 0x00, 0x42, 
+  0x26, 0x41, 0x1e, 0x04, 0x1d, 0x83, 0x12, 0x03, 0x1d, 0x03, 0x11, 0x02, 
+  0x1d, 0xc3, 0x10, 0x01, 0x1d, 0x83, 0x10, 0x00, 0x1d, 0x43, 0x10, 0x0c, 
+  0x75, 0x26, 0xf0, 0x49, 0x09, 0xd5, 0x02, 0x25, 0x20, 0x40, 0x00, 0x0b, 
+  0xf0, 0x0e, 0xf0, 0x0f, 0xf0, 0x12, 0xf0, 0x1c, 0xf0, 0x1c, 0xf0, 0x1a, 
+  0xf0, 0x17, 0xf0, 0x0f, 0xf0, 0x18, 0xf0, 0x10, 0xf0, 0x00, 0x1d, 0xc3, 
+  0x11, 0x13, 0xf0, 0x00, 0x1d, 0x83, 0x12, 0x0f, 0x0c, 0x00, 0x80, 0x12, 
+  0x0d, 0xf0, 0x00, 0x1d, 0x03, 0x13, 0x09, 0x12, 0x00, 0x20, 0x13, 0x07, 
+  0x12, 0x00, 0xf0, 0x0e, 0x13, 0x03, 0xf0, 0x00, 0x1d, 0x43, 0x13, 0x0c, 
+  0x71, 0x00, 0x18, 0x00, 0x20, 0xc8, 0xc6, 0xe0, 0x78, 0xe2, 0xc2, 0xca, 
+  0x0d, 0x20, 0x03, 0x08, 0x45, 0x4a, 0x24, 0x40, 0x71, 0xfe, 0x00, 0x00, 
+  0x50, 0x02, 0xf1, 0x3d, 0x21, 0xa0, 0x08, 0x18, 0x11, 0x00, 0x80, 0x25, 
+  0x0e, 0x10, 0x00, 0x1d, 0x03, 0x10, 0xc2, 0xc6, 0x69, 0x02, 0xc0, 0x04, 
+  0xe8, 0xc3, 0x82, 0x24, 0x0e, 0x33, 0x10, 0x40, 0x8b, 0xc0, 0x8a, 0x22, 
+  0x0d, 0x08, 0x4e, 0x0e, 0xaf, 0xec, 0x28, 0x45, 0x02, 0x8d, 0x8c, 0x20, 
+  0x83, 0x8f, 0x8a, 0x20, 0x3e, 0x07, 0x0a, 0xf4, 0x23, 0x8d, 0xcd, 0x71, 
+  0x07, 0xe9, 0x8a, 0x20, 0xfe, 0x06, 0x0f, 0x09, 0xf4, 0x00, 0xed, 0x71, 
+  0xc8, 0xc7, 0xed, 0x72, 0x2c, 0x71, 0x0a, 0x45, 0x46, 0x00, 0xf0, 0xff, 
+  0x1e, 0x1c, 0x01, 0x31, 0x23, 0x09, 0xb0, 0x00, 0x8b, 0xc0, 0x2d, 0x78, 
+  0x23, 0x08, 0x71, 0x00, 0x8b, 0xc0, 0x80, 0xc1, 0x72, 0x0f, 0x20, 0x05, 
+  0x81, 0xc2, 0x81, 0xc1, 0x28, 0xda, 0x02, 0x0e, 0xaf, 0xec, 0x02, 0x40, 
+  0x05, 0xf0, 0x56, 0x0c, 0x20, 0x05, 0x80, 0xc1, 0x00, 0xad, 0xf1, 0x76, 
+  0x2c, 0x72, 0xcd, 0x72, 0xa8, 0xf7, 0x0c, 0x70, 0xc8, 0xc7, 0xe0, 0x78, 
+  0xe6, 0xc0, 0x3f, 0xda, 0x18, 0xba, 0xc3, 0x41, 0x4c, 0x3f, 0xcd, 0xcc, 
+  0xcb, 0x45, 0xcc, 0x3d, 0xcd, 0xcc, 0xcb, 0x44, 0x48, 0x42, 0x00, 0x00, 
+  0xc3, 0x43, 0xf9, 0x3b, 0x6c, 0x09, 0x8a, 0x23, 0x10, 0x10, 0xcb, 0x46, 
+  0x83, 0x3a, 0x6f, 0x12, 0xcb, 0x47, 0xf4, 0x49, 0x00, 0x24, 0x48, 0xa0, 
+  0x27, 0xa0, 0xb8, 0xb9, 0x97, 0xba, 0x0c, 0x18, 0x43, 0x00, 0xa6, 0xa0, 
+  0x85, 0xa0, 0x79, 0xa0, 0x24, 0x18, 0xc4, 0x02, 0xc2, 0xa0, 0xe1, 0xa0, 
+  0x38, 0xa0, 0x44, 0xa0, 0xc6, 0xc4, 0xe0, 0x78, 0xe6, 0xc2, 0x08, 0x45, 
+  0x7a, 0x0b, 0x60, 0x00, 0x55, 0x20, 0x0e, 0x09, 0x4a, 0x24, 0xc0, 0x70, 
+  0x7f, 0xda, 0x17, 0xba, 0x0c, 0x70, 0x6c, 0x71, 0x55, 0x25, 0x41, 0x1c, 
+  0x4a, 0xa6, 0x09, 0xa6, 0x08, 0xa6, 0x07, 0xa6, 0x0a, 0xa5, 0x0b, 0xa5, 
+  0x0c, 0xa5, 0x0d, 0xa5, 0x30, 0x1e, 0xc2, 0x10, 0x74, 0xae, 0x4e, 0xa5, 
+  0xa8, 0x20, 0x00, 0x01, 0x04, 0x19, 0x11, 0x00, 0xa1, 0x41, 0xcb, 0x44, 
+  0x13, 0x00, 0x20, 0x5f, 0x80, 0x21, 0x09, 0x0a, 0x06, 0xa6, 0x80, 0x1e, 
+  0x18, 0x10, 0x44, 0xa6, 0x03, 0xa6, 0x02, 0xa6, 0x01, 0xa6, 0xc3, 0x42, 
+  0x49, 0x40, 0xdb, 0x0f, 0x7c, 0x1e, 0x18, 0x10, 0x14, 0xa9, 0x01, 0x84, 
+  0x77, 0x1e, 0x98, 0x10, 0x7a, 0x1e, 0x98, 0x10, 0x79, 0x1e, 0x98, 0x10, 
+  0x78, 0x1e, 0x98, 0x10, 0x60, 0xa9, 0x40, 0x84, 0x22, 0x84, 0xcb, 0x47, 
+  0xa3, 0x3b, 0x0a, 0xd7, 0xcb, 0x43, 0x2b, 0x3c, 0x40, 0xeb, 0x7e, 0x1e, 
+  0x18, 0x10, 0xa1, 0x40, 0x60, 0xae, 0xff, 0xa5, 0x81, 0x1e, 0xd8, 0x12, 
+  0x7d, 0x1e, 0x98, 0x10, 0x92, 0x0f, 0xa0, 0x00, 0x7f, 0x1e, 0x58, 0x10, 
+  0xc6, 0xfc, 0x04, 0xf0, 0x28, 0xc3, 0x82, 0x24, 0x03, 0x38, 0x04, 0x15, 
+  0x0c, 0x00, 0x6d, 0x70, 0x0a, 0x22, 0x40, 0x21, 0x04, 0x34, 0xc0, 0x92, 
+  0x0a, 0x21, 0xc0, 0x21, 0x0a, 0x26, 0x80, 0x21, 0x0a, 0x20, 0x00, 0x31, 
+  0x70, 0x43, 0x58, 0x41, 0x08, 0x46, 0xc5, 0xf6, 0x3f, 0xd8, 0x18, 0xb8, 
+  0x04, 0xf0, 0xc3, 0x40, 0x00, 0xbf, 0x00, 0x00, 0x47, 0x14, 0x0f, 0x36, 
+  0xd0, 0x00, 0xf0, 0x0d, 0x01, 0x34, 0x0d, 0x10, 0x00, 0x26, 0x90, 0x1f, 
+  0x00, 0x00, 0x2d, 0x01, 0x55, 0x24, 0x40, 0x3d, 0xa8, 0x20, 0x80, 0x02, 
+  0x04, 0x11, 0x02, 0x04, 0x00, 0x32, 0x82, 0x0f, 0x28, 0x01, 0xf0, 0x29, 
+  0x04, 0x18, 0x90, 0x00, 0x55, 0x24, 0x41, 0x3d, 0x55, 0x24, 0x82, 0x3c, 
+  0xc1, 0x40, 0x4e, 0x09, 0xef, 0xee, 0x55, 0x24, 0x94, 0x3c, 0x48, 0x35, 
+  0xc0, 0x12, 0x1d, 0x78, 0x55, 0x24, 0x44, 0x3d, 0x55, 0x24, 0xc5, 0x3b, 
+  0x44, 0x20, 0x43, 0x00, 0xc1, 0x40, 0x62, 0x41, 0x03, 0x42, 0x55, 0x24, 
+  0xcd, 0x3b, 0x42, 0x08, 0x2f, 0xef, 0x70, 0x45, 0x5c, 0x00, 0xf0, 0x31, 
+  0x4a, 0x20, 0x00, 0x00, 0xa8, 0x20, 0x80, 0x03, 0x01, 0x4d, 0xf0, 0x24, 
+  0x03, 0x20, 0x55, 0x24, 0x02, 0x3b, 0x00, 0x31, 0x81, 0x05, 0x15, 0x7a, 
+  0x01, 0x33, 0x41, 0x00, 0x04, 0x71, 0x20, 0xa2, 0x61, 0x86, 0x49, 0x86, 
+  0x28, 0x4e, 0x55, 0x24, 0x01, 0x3b, 0x55, 0x24, 0x04, 0x3a, 0x3e, 0x0e, 
+  0x2f, 0xf3, 0x10, 0x46, 0x55, 0x24, 0x01, 0x3a, 0x10, 0xda, 0x1e, 0x0c, 
+  0xaf, 0xec, 0xc2, 0x40, 0x0c, 0x00, 0x42, 0xe2, 0x0c, 0x2f, 0xf3, 0x0a, 
+  0x00, 0x31, 0x10, 0xda, 0x06, 0x16, 0x00, 0xf0, 0x30, 0x3c, 0x86, 0xc1, 
+  0x40, 0x6a, 0x0a, 0xef, 0xee, 0xa2, 0x42, 0x00, 0x10, 0x81, 0x20, 0x99, 
+  0x09, 0x30, 0x00, 0x10, 0x45, 0xee, 0x70, 0x8a, 0x25, 0x02, 0x11, 0x40, 
+  0x24, 0x14, 0x30, 0xb9, 0x66, 0x10, 0xda, 0xde, 0x0b, 0xaf, 0xec, 0x82, 
+  0x40, 0xe6, 0x71, 0x40, 0x24, 0x14, 0x24, 0xf1, 0x0f, 0x74, 0xa2, 0x10, 
+  0xe5, 0x10, 0xda, 0x82, 0x40, 0xca, 0x0b, 0xaf, 0xec, 0xc2, 0x41, 0xee, 
+  0xce, 0x04, 0x80, 0x30, 0x74, 0xdd, 0xb8, 0x66, 0x10, 0xda, 0xb6, 0x28, 
+  0x00, 0x90, 0x41, 0xe6, 0x71, 0x10, 0xe5, 0xf5, 0x0f, 0xb4, 0xa2, 0x2e, 
+  0x00, 0xf0, 0x1b, 0xe7, 0x10, 0x80, 0xa0, 0x0d, 0x08, 0xb5, 0x02, 0x04, 
+  0x71, 0xe7, 0x18, 0x02, 0xa0, 0x3d, 0x08, 0x31, 0x30, 0x55, 0x24, 0x43, 
+  0x3d, 0x56, 0x40, 0x2f, 0x31, 0x40, 0x06, 0x55, 0x24, 0x4d, 0x3d, 0x2f, 
+  0x32, 0x00, 0x00, 0xee, 0x08, 0xef, 0xee, 0xc1, 0x40, 0xe0, 0x00, 0x41, 
+  0x56, 0x26, 0xc1, 0x18, 0x30, 0x01, 0xf0, 0x2c, 0x15, 0x00, 0x14, 0x00, 
+  0x30, 0x80, 0x0f, 0x6a, 0x44, 0xfb, 0xae, 0x04, 0x19, 0x10, 0x00, 0x7e, 
+  0x40, 0x00, 0xa1, 0x4a, 0x24, 0x00, 0x71, 0x0a, 0x20, 0x40, 0x04, 0xa8, 
+  0x20, 0x80, 0x01, 0x04, 0x16, 0x01, 0x24, 0x04, 0x18, 0x50, 0x00, 0x00, 
+  0x18, 0x40, 0x05, 0xff, 0x10, 0x80, 0xa0, 0x0f, 0xe8, 0x0c, 0x70, 0x04, 
+  0x31, 0x00, 0x80, 0x16, 0x00, 0x06, 0x00, 0x28, 0x00, 0xf0, 0x05, 0xa8, 
+  0x20, 0xc0, 0x01, 0x26, 0x40, 0x52, 0x20, 0xc0, 0x07, 0x04, 0x19, 0x10, 
+  0x20, 0x00, 0x10, 0x80, 0x20, 0x0d, 0xe8, 0x18, 0x00, 0x30, 0x56, 0x26, 
+  0xc0, 0x60, 0x00, 0xf0, 0x18, 0x01, 0x04, 0x10, 0x01, 0x04, 0x04, 0x1f, 
+  0x50, 0x10, 0xda, 0xc7, 0x0c, 0x70, 0x03, 0xa7, 0x02, 0xa7, 0x01, 0xa7, 
+  0x00, 0xa7, 0xda, 0xc7, 0xe0, 0x78, 0xe4, 0xc0, 0x81, 0x81, 0x63, 0x81, 
+  0xc2, 0x81, 0xa0, 0x81, 0x00, 0x33, 0x0c, 0x03, 0x92, 0x00, 0xf1, 0x00, 
+  0x00, 0x35, 0x83, 0x13, 0x02, 0x33, 0x03, 0x03, 0x01, 0x33, 0xc3, 0x00, 
+  0x60, 0xa2, 0x80, 0x1e, 0x00, 0x11, 0xa1, 0x1e, 0x00, 0x00, 0x1a, 0x00, 
+  0x13, 0x01, 0x1a, 0x00, 0x51, 0x61, 0xa2, 0x60, 0x81, 0x83, 0x18, 0x00, 
+  0xf2, 0x05, 0xcb, 0x00, 0x00, 0x34, 0x03, 0x13, 0x22, 0x81, 0x00, 0x35, 
+  0x4c, 0x13, 0x02, 0x33, 0xc3, 0x02, 0x00, 0x31, 0x41, 0x00, 0x40, 0x00, 
+  0xa0, 0x41, 0x00, 0x22, 0xa2, 0xa8, 0x20, 0x40, 0x02, 0x60, 0x82, 0x7e, 
+  0x00, 0xa0, 0x02, 0x31, 0xc1, 0x00, 0x04, 0x1a, 0x50, 0x00, 0xc4, 0xc4, 
+  0xd8, 0x03, 0xe0, 0x0c, 0x34, 0x50, 0x40, 0x08, 0x47, 0x84, 0xc0, 0x8a, 
+  0x22, 0x0c, 0x00, 0x72, 0x0a, 0xda, 0x03, 0xf0, 0x51, 0x00, 0x87, 0x40, 
+  0x24, 0x83, 0x30, 0x40, 0x24, 0x04, 0x32, 0x40, 0x24, 0x05, 0x33, 0x40, 
+  0x24, 0x06, 0x31, 0x40, 0x24, 0xc7, 0x30, 0xa1, 0x41, 0x02, 0x42, 0x7e, 
+  0x0e, 0xaf, 0xf3, 0x02, 0x1c, 0x83, 0x32, 0x02, 0xc5, 0x04, 0xed, 0xa1, 
+  0x40, 0xc8, 0xc7, 0x03, 0x14, 0x8e, 0x30, 0xad, 0x70, 0x0c, 0x70, 0xfa, 
+  0xe8, 0x02, 0x14, 0x80, 0x30, 0xcf, 0x79, 0xed, 0x08, 0x64, 0x80, 0x84, 
+  0xc2, 0x81, 0xc3, 0xfe, 0x0e, 0x20, 0x00, 0xe1, 0x40, 0x01, 0xc0, 0x8a, 
+  0x21, 0x3e, 0x06, 0x12, 0x70, 0xca, 0x25, 0x4d, 0x10, 0x2c, 0x71, 0x3c, 
+  0x20, 0x00, 0x20, 0x06, 0x79, 0x3e, 0x66, 0xea, 0xf1, 0xf0, 0x06, 0x20, 
+  0xb0, 0xc1, 0xe2, 0x00, 0xf2, 0x09, 0x0a, 0x20, 0x80, 0x21, 0x0a, 0x21, 
+  0x00, 0x21, 0x70, 0x43, 0x48, 0x40, 0x08, 0x45, 0xcd, 0x70, 0x40, 0x24, 
+  0x06, 0x3d, 0x40, 0x24, 0x09, 0x3a, 0x6c, 0x02, 0xf1, 0x00, 0x00, 0x05, 
+  0x03, 0x49, 0xf0, 0x20, 0x0b, 0x10, 0x15, 0x26, 0x02, 0x00, 0x00, 0x33, 
+  0x8c, 0xc2, 0x02, 0xf0, 0x17, 0x00, 0x33, 0x83, 0x1f, 0x7a, 0x3d, 0x00, 
+  0x00, 0x15, 0x21, 0x0f, 0x10, 0x04, 0x71, 0x80, 0xa2, 0x60, 0xa7, 0x5a, 
+  0x85, 0xc3, 0x41, 0xc8, 0x42, 0x00, 0x00, 0x04, 0x32, 0x40, 0x80, 0xa6, 
+  0x00, 0x26, 0x00, 0x4a, 0x22, 0x40, 0x20, 0x5c, 0x00, 0x60, 0xa8, 0x20, 
+  0x00, 0x02, 0x04, 0x11, 0xcc, 0x01, 0xf0, 0x01, 0x00, 0x00, 0x01, 0x36, 
+  0x0e, 0x10, 0x04, 0x36, 0x80, 0x9f, 0xa0, 0x40, 0x00, 0x00, 0x18, 0xf6, 
+  0x1e, 0x00, 0x52, 0xcd, 0x70, 0x8d, 0xc4, 0x6c, 0x24, 0x00, 0x13, 0x14, 
+  0x24, 0x00, 0xf0, 0x2a, 0x33, 0x03, 0x00, 0x98, 0x85, 0x01, 0x33, 0x80, 
+  0x0f, 0x80, 0xbf, 0x00, 0x00, 0x04, 0x30, 0x00, 0x83, 0x5c, 0x00, 0x2c, 
+  0x00, 0xed, 0x71, 0x7a, 0x0f, 0xef, 0xf7, 0x07, 0x31, 0x80, 0x00, 0x24, 
+  0x85, 0x3f, 0xda, 0x6c, 0x70, 0x07, 0x36, 0x4c, 0x70, 0x23, 0x3c, 0x0a, 
+  0xd7, 0x18, 0xba, 0x04, 0x30, 0xc0, 0x80, 0x40, 0x41, 0xca, 0x21, 0x8c, 
+  0x0f, 0x82, 0x03, 0xf0, 0x01, 0x01, 0x30, 0x41, 0x00, 0x48, 0x31, 0xcf, 
+  0x02, 0x00, 0x34, 0x80, 0x1f, 0x74, 0x49, 0x00, 0x24, 0x1e, 0x00, 0x22, 
+  0xca, 0x22, 0x1c, 0x00, 0xf0, 0x2b, 0x2f, 0x26, 0xc7, 0xf3, 0x47, 0xf2, 
+  0x01, 0x30, 0x80, 0x00, 0x48, 0x30, 0xce, 0x02, 0x02, 0xf0, 0xed, 0x71, 
+  0x40, 0x25, 0x14, 0x1b, 0x42, 0x22, 0x40, 0x20, 0x0f, 0x79, 0xcc, 0x79, 
+  0x8a, 0xc2, 0x40, 0x24, 0x05, 0x37, 0x00, 0x21, 0x44, 0x04, 0x8d, 0xc1, 
+  0xa1, 0x40, 0x62, 0x43, 0x40, 0x24, 0x15, 0x3a, 0xce, 0x0a, 0x20, 0x00, 
+  0x40, 0x24, 0x16, 0x37, 0xaa, 0x00, 0x41, 0x40, 0x24, 0x00, 0x30, 0x98, 
+  0x02, 0xb0, 0x16, 0x02, 0x24, 0x04, 0x15, 0x01, 0x24, 0x01, 0x31, 0x81, 
+  0x00, 0x80, 0x02, 0xf0, 0x01, 0x80, 0xc1, 0x83, 0xc2, 0x7a, 0x0f, 0x20, 
+  0x00, 0xa1, 0x40, 0x83, 0xc1, 0x10, 0xda, 0xba, 0x08, 0x26, 0x03, 0xf0, 
+  0x17, 0x1b, 0x0b, 0x31, 0x20, 0x8d, 0xc0, 0x80, 0xc2, 0xb6, 0x0d, 0xef, 
+  0xff, 0x82, 0x41, 0x00, 0xc2, 0x01, 0xc1, 0x02, 0xc0, 0x53, 0xa5, 0x34, 
+  0xa5, 0x15, 0xa5, 0x46, 0x71, 0xef, 0x79, 0x2f, 0x20, 0x87, 0x04, 0x8d, 
+  0x09, 0x05, 0x80, 0x8e, 0x02, 0x52, 0x5c, 0x4d, 0x0a, 0x21, 0x00, 0xd0, 
+  0x02, 0xf1, 0x02, 0x10, 0x02, 0x04, 0x04, 0x19, 0x90, 0x00, 0x00, 0x88, 
+  0x48, 0x30, 0x00, 0x00, 0x00, 0xa1, 0x0c, 0x8d, 0xd2, 0x02, 0x54, 0x32, 
+  0x00, 0x80, 0x4b, 0xf7, 0xd0, 0x02, 0x12, 0x06, 0xd0, 0x02, 0xf0, 0x17, 
+  0x18, 0x10, 0x20, 0xd4, 0xc7, 0xe6, 0xc3, 0xa2, 0xc1, 0x08, 0x46, 0x00, 
+  0x80, 0x60, 0x44, 0x40, 0x24, 0xc3, 0x30, 0x40, 0x24, 0x05, 0x31, 0x40, 
+  0x24, 0x86, 0x30, 0x48, 0x47, 0x0a, 0x25, 0x40, 0x10, 0xba, 0x0c, 0xaf, 
+  0xf3, 0x03, 0x20, 0x02, 0xf3, 0x41, 0x14, 0x80, 0x30, 0x03, 0x14, 0x81, 
+  0x30, 0x0f, 0x78, 0x79, 0x09, 0x24, 0x00, 0x04, 0x77, 0x65, 0x08, 0x95, 
+  0x02, 0x25, 0x20, 0x00, 0x00, 0x0a, 0xf0, 0x0c, 0xf0, 0x0c, 0xf0, 0x0e, 
+  0xf0, 0x0e, 0xf0, 0x10, 0xf0, 0x16, 0xf0, 0x1e, 0xf0, 0x1e, 0xf0, 0x20, 
+  0xf0, 0x0c, 0x8e, 0x0c, 0xf0, 0x05, 0x86, 0x1d, 0xf0, 0x06, 0x86, 0x1b, 
+  0xf0, 0x07, 0x86, 0x19, 0xf0, 0x08, 0x86, 0x17, 0xf0, 0x24, 0x16, 0x80, 
+  0x10, 0x81, 0xc3, 0xa1, 0x41, 0x9e, 0x0a, 0xaf, 0xfa, 0xe1, 0x42, 0x14, 
+  0xf0, 0x25, 0x10, 0x00, 0xf1, 0x03, 0x62, 0x0e, 0x6f, 0xf5, 0xe1, 0x42, 
+  0x0c, 0xf0, 0x18, 0x86, 0x05, 0xf0, 0x19, 0x86, 0x03, 0xf0, 0x04, 0x86, 
+  0x16, 0x00, 0x50, 0x0c, 0xef, 0xf7, 0xe1, 0x42, 0x74, 0x00, 0x95, 0x04, 
+  0x71, 0x02, 0x1c, 0x02, 0x30, 0xc4, 0xf1, 0x01, 0x70, 0x07, 0xa6, 0xc6, 
+  0xc7, 0xe8, 0xc3, 0xa2, 0xc1, 0x48, 0x47, 0x28, 0x45, 0x72, 0x07, 0xf2, 
+  0x03, 0xd2, 0x0d, 0x6f, 0xfa, 0x68, 0x46, 0x2c, 0x70, 0xc3, 0x42, 0x13, 
+  0x00, 0x2c, 0x5f, 0x51, 0x0d, 0x10, 0x10, 0x30, 0x02, 0xf0, 0x09, 0xc0, 
+  0x02, 0x04, 0x12, 0x03, 0x04, 0x40, 0x24, 0x40, 0x30, 0x3c, 0x60, 0x24, 
+  0x71, 0x38, 0x23, 0xc0, 0x03, 0x00, 0xac, 0x0a, 0x0e, 0x2f, 0xf7, 0x12, 
+  0x00, 0xf0, 0x1b, 0x2c, 0xe8, 0x09, 0xdd, 0x08, 0x1e, 0x43, 0x12, 0x07, 
+  0x1e, 0x03, 0x12, 0x06, 0x1e, 0xc3, 0x11, 0x05, 0x1e, 0x83, 0x11, 0x04, 
+  0x1e, 0x43, 0x11, 0x03, 0x1e, 0x03, 0x11, 0x02, 0x1e, 0xc3, 0x10, 0x01, 
+  0x1e, 0x83, 0x10, 0x00, 0x1e, 0x43, 0x10, 0x19, 0xf0, 0x34, 0x01, 0x41, 
+  0x40, 0x22, 0x02, 0x03, 0xb4, 0x01, 0x56, 0x12, 0x03, 0x04, 0x81, 0xc0, 
+  0x4e, 0x00, 0xf0, 0x1a, 0x8a, 0x08, 0xef, 0xf5, 0x81, 0xc0, 0x17, 0xe8, 
+  0xad, 0x71, 0x00, 0x1e, 0xc3, 0x10, 0x14, 0xf0, 0xad, 0x70, 0xaa, 0x0e, 
+  0x6f, 0xf7, 0x78, 0x27, 0x00, 0x1c, 0x06, 0xe8, 0xb8, 0x66, 0xa5, 0x71, 
+  0x00, 0x18, 0x83, 0x01, 0x11, 0x0f, 0x71, 0x1e, 0xbe, 0x0c, 0x00, 0xb0, 
+  0x1e, 0x83, 0x12, 0x02, 0xf0, 0xad, 0x70, 0x00, 0x18, 0x40, 0x23, 0x0c, 
+  0x07, 0x1f, 0xec, 0x78, 0x01, 0x08, 0x21, 0x42, 0x0b, 0x78, 0x01, 0x10, 
+  0x31, 0x04, 0x01, 0xc2, 0x54, 0x26, 0x11, 0x18, 0x54, 0x26, 0x92, 0x19, 
+  0x40, 0x26, 0x10, 0x1b, 0x84, 0x01, 0x11, 0x75, 0x84, 0x01, 0x40, 0x61, 
+  0x08, 0x95, 0x01, 0x84, 0x01, 0xf1, 0x0c, 0x06, 0xf0, 0x0d, 0xf0, 0x12, 
+  0xf0, 0x1a, 0xf0, 0x1b, 0xf0, 0x22, 0xf0, 0x81, 0xc3, 0x02, 0x40, 0xa1, 
+  0x41, 0x12, 0x0a, 0xef, 0xfa, 0xe1, 0x42, 0x20, 0xf0, 0x0a, 0x4e, 0x01, 
+  0x93, 0x1e, 0x08, 0xef, 0xef, 0xe1, 0x42, 0x1a, 0xf0, 0x3d, 0x74, 0x01, 
+  0x20, 0x1a, 0x09, 0x84, 0x01, 0xf0, 0x01, 0x12, 0xf0, 0x81, 0xc3, 0x22, 
+  0x40, 0x03, 0xf0, 0x81, 0xc3, 0x42, 0x40, 0xa1, 0x41, 0x5a, 0x0d, 0x72, 
+  0x01, 0x31, 0x08, 0xf0, 0x1a, 0x32, 0x00, 0x2a, 0xe2, 0x0a, 0x80, 0x01, 
+  0x17, 0xc6, 0x80, 0x01, 0xc2, 0xcc, 0xc7, 0xea, 0xc3, 0xbe, 0xc1, 0xa8, 
+  0x47, 0x08, 0x46, 0x0c, 0x70, 0xec, 0x04, 0xf5, 0x25, 0x8a, 0x86, 0x30, 
+  0x41, 0xcb, 0x45, 0x82, 0x44, 0x55, 0x35, 0x02, 0x24, 0x01, 0x03, 0x84, 
+  0x86, 0x48, 0x31, 0x8b, 0x00, 0x21, 0x86, 0x00, 0x34, 0xcc, 0x12, 0x28, 
+  0x1e, 0x00, 0x11, 0x04, 0x34, 0x40, 0x90, 0xca, 0x21, 0x05, 0x03, 0x04, 
+  0x31, 0x40, 0x83, 0xca, 0x25, 0x49, 0x10, 0xb6, 0xa6, 0x02, 0xeb, 0xca, 
+  0xc7, 0xd0, 0x03, 0x30, 0x12, 0x01, 0x04, 0xd6, 0x04, 0xb1, 0x01, 0x30, 
+  0x40, 0x00, 0x28, 0x86, 0x04, 0x30, 0x40, 0x80, 0x19, 0xce, 0x03, 0x61, 
+  0x0e, 0x70, 0x22, 0x41, 0x4a, 0x22, 0x34, 0x04, 0x00, 0xf4, 0x03, 0x11, 
+  0x04, 0xd0, 0x03, 0x74, 0x32, 0x02, 0x00, 0x38, 0x86, 0x01, 0x32, 0xd0, 
+  0x03, 0x60, 0x40, 0x80, 0x94, 0x01, 0x0c, 0x00, 0x5a, 0x02, 0x91, 0x1c, 
+  0x16, 0x10, 0x10, 0x04, 0xe8, 0x5c, 0x1e, 0x03, 0xf8, 0x01, 0x42, 0xad, 
+  0x70, 0x97, 0xc4, 0x70, 0x04, 0xf1, 0x05, 0xc0, 0x03, 0x15, 0x26, 0x01, 
+  0x10, 0x53, 0x81, 0xf0, 0x21, 0x01, 0x20, 0x00, 0x30, 0x83, 0x20, 0x15, 
+  0x24, 0x02, 0x10, 0x2c, 0x05, 0x30, 0x71, 0x20, 0xa2, 0x0e, 0x01, 0x00, 
+  0x52, 0x01, 0xf0, 0x31, 0x3c, 0xe8, 0x97, 0xc1, 0x80, 0xc2, 0x02, 0x40, 
+  0x7a, 0x0e, 0xef, 0xf2, 0x3d, 0x1e, 0x42, 0x13, 0x8e, 0x0d, 0x6f, 0xf4, 
+  0x80, 0xc0, 0x02, 0xc6, 0x80, 0xc0, 0x82, 0x0d, 0x6f, 0xf4, 0x42, 0xc5, 
+  0x7f, 0xd8, 0x17, 0xb8, 0x01, 0x36, 0x01, 0x10, 0x50, 0x20, 0xc2, 0x05, 
+  0x02, 0x30, 0x80, 0x03, 0x00, 0x31, 0x81, 0x00, 0x00, 0x30, 0x80, 0x00, 
+  0x2f, 0x33, 0x40, 0x00, 0x01, 0xc1, 0x45, 0xc5, 0x74, 0x06, 0x20, 0x00, 
+  0xc0, 0x4e, 0x03, 0x21, 0x46, 0xc3, 0x1c, 0x00, 0xf0, 0x0a, 0x32, 0x00, 
+  0x00, 0x43, 0xc1, 0x44, 0xc0, 0x83, 0xc0, 0x9a, 0xc2, 0x5a, 0x0d, 0xef, 
+  0xf2, 0x02, 0x41, 0x9a, 0xc0, 0xbe, 0x0d, 0xef, 0xf2, 0x83, 0xc1, 0xd6, 
+  0x03, 0xd0, 0xe2, 0x0c, 0x6f, 0xec, 0x02, 0x40, 0xca, 0xc7, 0x9a, 0xc0, 
+  0x10, 0xda, 0xd6, 0x0c, 0x00, 0x51, 0x41, 0x9a, 0xc0, 0x6a, 0x0a, 0x1e, 
+  0x00, 0xf0, 0x00, 0xc0, 0x7a, 0x0a, 0xef, 0xf2, 0x8a, 0xc1, 0x97, 0xc0, 
+  0x8a, 0xc1, 0x8d, 0xc2, 0xc2, 0x0a, 0xa6, 0x02, 0x40, 0x10, 0x3d, 0x86, 
+  0x86, 0xd2, 0x00, 0x60, 0x54, 0x26, 0x0d, 0x18, 0xa1, 0x41, 0xac, 0x07, 
+  0xc0, 0x04, 0x10, 0x00, 0x24, 0x56, 0x86, 0x60, 0x81, 0x00, 0x34, 0x00, 
+  0x10, 0x86, 0x00, 0x40, 0x01, 0x33, 0x00, 0x00, 0xd4, 0x06, 0x60, 0x40, 
+  0x85, 0x02, 0x85, 0x21, 0x85, 0x2c, 0x00, 0xf2, 0x06, 0x47, 0xc2, 0x49, 
+  0xc0, 0x40, 0xc2, 0x42, 0xc0, 0x0e, 0x70, 0x80, 0xc2, 0x87, 0xc3, 0x0c, 
+  0x70, 0x48, 0xc1, 0x04, 0x1c, 0x40, 0x70, 0x04, 0x50, 0x12, 0x0c, 0x04, 
+  0x04, 0x13, 0x70, 0x01, 0x20, 0x01, 0x03, 0x70, 0x01, 0x40, 0x04, 0x30, 
+  0x80, 0x8f, 0xfa, 0x04, 0x83, 0x24, 0x00, 0x0c, 0x00, 0xa6, 0x0f, 0xcf, 
+  0xf8, 0x94, 0x01, 0xf3, 0x05, 0x03, 0x00, 0x15, 0x01, 0x10, 0x00, 0x30, 
+  0x41, 0x00, 0x00, 0x31, 0x81, 0x0f, 0xcc, 0x3d, 0xcd, 0xcc, 0x04, 0x1d, 
+  0x50, 0x50, 0x03, 0xf0, 0x01, 0x40, 0x04, 0x8d, 0xc0, 0x45, 0x86, 0xf0, 
+  0x20, 0x00, 0x04, 0x15, 0x26, 0x01, 0x14, 0x30, 0x81, 0xec, 0x00, 0x40, 
+  0x15, 0x27, 0x03, 0x14, 0x4e, 0x00, 0x60, 0x06, 0x71, 0x00, 0xa3, 0x15, 
+  0xf1, 0x8e, 0x01, 0xf2, 0x2f, 0x14, 0x70, 0x3e, 0xf3, 0xdc, 0x4e, 0x9a, 
+  0xc0, 0xf6, 0x0b, 0x6f, 0xec, 0x10, 0xda, 0x9a, 0xc0, 0x8a, 0x09, 0xef, 
+  0xf2, 0x93, 0xc1, 0x93, 0xc0, 0x9a, 0x09, 0xef, 0xf2, 0x90, 0xc1, 0x90, 
+  0xc1, 0x8d, 0xc2, 0x22, 0x40, 0xe2, 0x09, 0x2f, 0xf7, 0x8d, 0xc5, 0x5c, 
+  0x16, 0x80, 0x10, 0x25, 0x16, 0x81, 0x10, 0x0f, 0x08, 0x65, 0x00, 0x04, 
+  0x71, 0x5c, 0x1e, 0x02, 0x10, 0x20, 0xf1, 0xfe, 0x01, 0x23, 0x4a, 0x21, 
+  0xfc, 0x01, 0x01, 0xbc, 0x07, 0xa0, 0x00, 0x00, 0x01, 0x31, 0x01, 0x00, 
+  0x64, 0x16, 0x00, 0x10, 0x98, 0x07, 0x42, 0x1c, 0x06, 0xec, 0xff, 0x16, 
+  0x01, 0xf0, 0x15, 0x80, 0x19, 0x3d, 0x1e, 0x43, 0x10, 0xa8, 0x20, 0x00, 
+  0x01, 0x04, 0x18, 0x11, 0x00, 0x02, 0xf1, 0xe0, 0x78, 0xc9, 0x00, 0x00, 
+  0x03, 0xe6, 0xc0, 0x3f, 0xda, 0x18, 0xba, 0xc3, 0x41, 0x4c, 0x3f, 0xcd, 
+  0xcc, 0xcb, 0x45, 0xc2, 0x00, 0xf0, 0x03, 0xcb, 0x44, 0x48, 0x42, 0x00, 
+  0x00, 0xc3, 0x43, 0xf9, 0x3b, 0x6c, 0x09, 0x8a, 0x23, 0x10, 0x10, 0xcb, 
+  0x46, 0x7a, 0x06, 0xf0, 0x51, 0xcb, 0x47, 0xf4, 0x49, 0x00, 0x24, 0x48, 
+  0xa0, 0x27, 0xa0, 0xb8, 0xb9, 0x97, 0xba, 0x0c, 0x18, 0x43, 0x00, 0xa6, 
+  0xa0, 0x85, 0xa0, 0x79, 0xa0, 0x24, 0x18, 0xc4, 0x02, 0xc2, 0xa0, 0xe1, 
+  0xa0, 0x38, 0xa0, 0x44, 0xa0, 0xc6, 0xc4, 0xe0, 0x78, 0xe2, 0xc2, 0x24, 
+  0x77, 0x29, 0x09, 0xb5, 0x02, 0x08, 0x45, 0x25, 0x20, 0x40, 0x00, 0x0b, 
+  0xf0, 0x0f, 0xf0, 0x15, 0xf0, 0x19, 0xf0, 0x1f, 0xf0, 0x23, 0xf0, 0x2a, 
+  0xf0, 0x2f, 0xf0, 0x3b, 0xf0, 0x33, 0xf0, 0x40, 0x40, 0xba, 0x0d, 0x6f, 
+  0xfa, 0x60, 0x41, 0x0c, 0xad, 0xc2, 0xc6, 0x40, 0x40, 0x86, 0x0f, 0xaf, 
+  0xf7, 0x60, 0x41, 0x05, 0xa5, 0x0c, 0x00, 0x11, 0x7a, 0x0c, 0x00, 0x11, 
+  0x06, 0x0c, 0x00, 0x11, 0x6e, 0x0c, 0x00, 0x11, 0x07, 0x0c, 0x00, 0x11, 
+  0x62, 0x0c, 0x00, 0x11, 0x08, 0x0c, 0x00, 0x11, 0x7e, 0x3c, 0x00, 0x40, 
+  0x24, 0x1d, 0x02, 0x10, 0x0e, 0x00, 0x73, 0x46, 0x09, 0x6f, 0xf5, 0x60, 
+  0x41, 0x25, 0x0e, 0x00, 0x11, 0x3a, 0x28, 0x00, 0x11, 0x18, 0x28, 0x00, 
+  0x11, 0x2e, 0x0c, 0x00, 0x11, 0x04, 0x0c, 0x00, 0x11, 0x22, 0x0c, 0x00, 
+  0x6c, 0x19, 0xa5, 0xc2, 0xc6, 0xe0, 0x78, 0xf4, 0x07, 0x3f, 0x7e, 0x0a, 
+  0x6f, 0xf4, 0x07, 0x0a, 0x30, 0x8a, 0x0e, 0x6f, 0xf4, 0x07, 0x1f, 0x31, 
+  0xf4, 0x07, 0x0d, 0x2f, 0x62, 0x08, 0xf4, 0x07, 0x0b, 0x00, 0x84, 0x01, 
+  0xf1, 0x09, 0x7f, 0xd9, 0x17, 0xb9, 0x6c, 0x70, 0x54, 0x20, 0x02, 0x08, 
+  0x3c, 0x18, 0x43, 0x00, 0x2e, 0xa0, 0x6d, 0xa0, 0x6c, 0xa0, 0x6b, 0xa0, 
+  0x6a, 0xa0, 0x94, 0x01, 0x33, 0x1a, 0x11, 0x00, 0x54, 0x02, 0x01, 0x0c, 
+  0x00, 0x02, 0xd6, 0x07, 0xf0, 0x07, 0x5c, 0x18, 0xc2, 0x00, 0xe0, 0x7f, 
+  0x3a, 0xa0, 0xe0, 0x78, 0xe2, 0xc3, 0xa4, 0xc1, 0x89, 0x69, 0x40, 0x41, 
+  0x2b, 0x0c, 0xb5, 0x11, 0x5c, 0x01, 0x31, 0x00, 0x03, 0x07, 0x46, 0x06, 
+  0xf0, 0x07, 0x1b, 0xf0, 0x27, 0xf0, 0x31, 0xf0, 0x80, 0xc2, 0x20, 0x40, 
+  0x2e, 0x0d, 0xaf, 0xfa, 0x60, 0x41, 0x5c, 0x4d, 0x80, 0xc1, 0xaa, 0x09, 
+  0x4c, 0x02, 0xc0, 0xc2, 0xc7, 0x20, 0x40, 0x36, 0x0b, 0xaf, 0xef, 0x60, 
+  0x41, 0x0a, 0xa5, 0x0c, 0x00, 0x20, 0x46, 0x0c, 0x3a, 0x01, 0x10, 0x3d, 
+  0x2c, 0x01, 0x10, 0xc7, 0x30, 0x00, 0x53, 0x7a, 0x08, 0xef, 0xf7, 0x60, 
+  0x26, 0x07, 0x62, 0x50, 0xa5, 0x31, 0xa5, 0x12, 0xa5, 0x18, 0x00, 0x17, 
+  0x62, 0x18, 0x00, 0x02, 0x3e, 0x07, 0x00, 0x3e, 0x00, 0x20, 0xde, 0x0d, 
+  0x44, 0x01, 0x42, 0x1a, 0xa5, 0xc2, 0xc7, 0x8c, 0x00, 0xf0, 0x11, 0x48, 
+  0x45, 0x62, 0x80, 0x56, 0x80, 0x2c, 0xe0, 0x52, 0x0b, 0xef, 0xf2, 0xa1, 
+  0x44, 0x80, 0xc0, 0x10, 0xda, 0x36, 0x09, 0x6f, 0xec, 0xa1, 0x41, 0x80, 
+  0xc0, 0xfe, 0x09, 0xef, 0xf2, 0xa1, 0x41, 0x28, 0x00, 0xf0, 0x05, 0x48, 
+  0x31, 0x01, 0x00, 0x07, 0x36, 0x41, 0x70, 0x48, 0x47, 0x00, 0x00, 0x3d, 
+  0x18, 0x43, 0x00, 0x07, 0x36, 0x42, 0x70, 0x46, 0x02, 0xc0, 0x3a, 0xa0, 
+  0xe0, 0x7f, 0x41, 0xa0, 0xe0, 0x78, 0x08, 0x44, 0x6c, 0x70, 0x7c, 0x04, 
+  0xf0, 0x96, 0x62, 0x4c, 0x04, 0x32, 0x40, 0x80, 0x4c, 0x70, 0xca, 0x20, 
+  0x69, 0x00, 0xe1, 0x20, 0xc9, 0x07, 0xca, 0x22, 0x6c, 0x00, 0x5b, 0x63, 
+  0xed, 0x0b, 0x14, 0x81, 0xe0, 0x7e, 0xe4, 0xc0, 0x7a, 0x10, 0x8c, 0x00, 
+  0x7f, 0xdd, 0x50, 0x21, 0xfe, 0x87, 0x17, 0xbd, 0x08, 0x46, 0x48, 0x34, 
+  0x0c, 0x10, 0xca, 0x21, 0x41, 0x03, 0x04, 0x34, 0xc0, 0x90, 0x80, 0x26, 
+  0x09, 0x1a, 0x0b, 0xf7, 0xec, 0x10, 0x8c, 0x00, 0x89, 0xec, 0x56, 0x20, 
+  0x4c, 0x08, 0x80, 0x8c, 0xdd, 0x0c, 0x30, 0x10, 0x48, 0x33, 0xc3, 0x02, 
+  0x60, 0x8e, 0x05, 0xeb, 0xc3, 0x43, 0x49, 0x40, 0xdb, 0x0f, 0x53, 0xf0, 
+  0xc0, 0x10, 0x83, 0x00, 0x11, 0xeb, 0x50, 0x22, 0xfe, 0x87, 0x5c, 0x75, 
+  0x48, 0x35, 0xc2, 0x12, 0x15, 0x20, 0x82, 0x00, 0xa4, 0x10, 0x03, 0x06, 
+  0xa0, 0x12, 0x02, 0x06, 0x01, 0x32, 0xc2, 0x00, 0xa4, 0x18, 0x98, 0x00, 
+  0x54, 0x8e, 0x0d, 0xea, 0xec, 0x10, 0x82, 0x00, 0x86, 0xea, 0x56, 0x20, 
+  0x42, 0x08, 0x40, 0x8a, 0x07, 0xea, 0xc3, 0x42, 0xb2, 0x3d, 0xc2, 0xb8, 
+  0xa0, 0x18, 0x98, 0x00, 0x48, 0x31, 0xc1, 0x02, 0x24, 0x77, 0x48, 0xae, 
+  0x04, 0xf0, 0x07, 0x31, 0x81, 0x0f, 0x32, 0xbe, 0xc2, 0xb8, 0x9b, 0x10, 
+  0x02, 0x06, 0x01, 0x31, 0x81, 0x0f, 0xb2, 0x3e, 0xc2, 0xb8, 0xa0, 0x10, 
+  0x0b, 0x0c, 0x00, 0xd2, 0x00, 0xa5, 0x10, 0x08, 0x06, 0x01, 0x31, 0xc1, 
+  0x02, 0x9d, 0x10, 0x09, 0x06, 0x7a, 0x00, 0xf0, 0x1f, 0x02, 0x36, 0x02, 
+  0x72, 0x80, 0x3f, 0x00, 0x00, 0x04, 0x31, 0xc0, 0x80, 0xca, 0x23, 0x45, 
+  0x00, 0x00, 0x32, 0x42, 0x02, 0x00, 0x30, 0xc1, 0x10, 0xa4, 0x10, 0x0c, 
+  0x06, 0x01, 0x32, 0x41, 0x00, 0x9c, 0x18, 0xd8, 0x00, 0x01, 0x31, 0x03, 
+  0x03, 0x9d, 0x18, 0x58, 0x00, 0xc3, 0x41, 0x32, 0x00, 0x42, 0x04, 0x33, 
+  0x40, 0x80, 0x78, 0x00, 0xf0, 0x13, 0xca, 0x21, 0xc5, 0x00, 0x04, 0x31, 
+  0x80, 0x80, 0xca, 0x21, 0x85, 0x00, 0x9e, 0x18, 0x58, 0x00, 0xc4, 0xc4, 
+  0x80, 0x8e, 0xf0, 0x26, 0xc3, 0x70, 0x13, 0x00, 0x50, 0x5f, 0x4c, 0x70, 
+  0x14, 0x1e, 0x43, 0x10, 0xb6, 0x00, 0x00, 0x9e, 0x00, 0xfe, 0x0b, 0x0d, 
+  0x0c, 0x71, 0x10, 0x9b, 0x18, 0xd8, 0x00, 0x8d, 0x70, 0x40, 0xae, 0x9e, 
+  0x10, 0x02, 0x06, 0x95, 0x70, 0x9d, 0x18, 0x98, 0x00, 0x83, 0xf5, 0xa5, 
+  0xf1, 0xec, 0x02, 0x3f, 0x92, 0x0f, 0x2f, 0xec, 0x02, 0x0a, 0x20, 0x9e, 
+  0x0b, 0xec, 0x02, 0x2f, 0x43, 0x35, 0xec, 0x02, 0x0d, 0x3f, 0x16, 0x0a, 
+  0x60, 0xec, 0x02, 0x0a, 0xf0, 0x1f, 0xf2, 0xc3, 0xb3, 0xc1, 0x2f, 0x26, 
+  0xc5, 0xf1, 0x0a, 0x21, 0x80, 0x21, 0x0a, 0x21, 0x40, 0x11, 0x0a, 0x22, 
+  0x00, 0x21, 0x70, 0x45, 0x50, 0x44, 0x30, 0x43, 0x10, 0x00, 0x23, 0x00, 
+  0x08, 0x47, 0x44, 0x27, 0x40, 0x00, 0xc0, 0x1f, 0x02, 0x10, 0x80, 0x14, 
+  0x0d, 0x30, 0x1e, 0xc6, 0xf6, 0x02, 0xf0, 0x0f, 0x0c, 0x70, 0x54, 0x24, 
+  0x08, 0x38, 0x40, 0x24, 0x0b, 0x3d, 0xa8, 0x20, 0x40, 0x05, 0xf0, 0x23, 
+  0x03, 0x20, 0xf0, 0x24, 0x01, 0x20, 0x15, 0x20, 0x02, 0x10, 0x00, 0x33, 
+  0x83, 0x0f, 0x80, 0x04, 0x00, 0x7c, 0x01, 0xe0, 0x7a, 0x3d, 0x00, 0x00, 
+  0x15, 0x23, 0x0c, 0x10, 0x04, 0x71, 0x60, 0xa2, 0x20, 0xa4, 0x1c, 0x05, 
+  0xf2, 0x07, 0x40, 0x24, 0x05, 0x3a, 0x0a, 0x24, 0x40, 0x02, 0xe1, 0x40, 
+  0x0a, 0x23, 0x80, 0x04, 0x62, 0x09, 0xe0, 0x02, 0x40, 0x24, 0x10, 0x3a, 
+  0x48, 0x03, 0xf0, 0x09, 0xc0, 0x01, 0x06, 0x40, 0x00, 0x30, 0x80, 0x03, 
+  0x04, 0x18, 0x10, 0x20, 0x8d, 0xc1, 0x40, 0x24, 0x04, 0x37, 0x22, 0x43, 
+  0xe1, 0x40, 0xa2, 0x42, 0x2a, 0x06, 0xa0, 0xd6, 0x0b, 0x20, 0x00, 0x87, 
+  0xc6, 0x1f, 0x87, 0x36, 0x87, 0x2c, 0x00, 0xc2, 0x00, 0x30, 0x80, 0x0f, 
+  0x74, 0x49, 0x00, 0x24, 0x07, 0x30, 0x4b, 0x00, 0x0c, 0x07, 0xf0, 0x1f, 
+  0x40, 0x04, 0x8a, 0xc1, 0xf0, 0x20, 0x03, 0x20, 0x04, 0x4e, 0x02, 0x49, 
+  0x80, 0xc1, 0x15, 0x79, 0x01, 0x33, 0x83, 0x00, 0x00, 0x33, 0x02, 0x13, 
+  0x04, 0x71, 0x01, 0x33, 0x82, 0x00, 0x40, 0xa1, 0x80, 0xc1, 0x83, 0xc2, 
+  0x0a, 0x0d, 0xe0, 0x02, 0xe1, 0x40, 0x40, 0x27, 0x0e, 0x1b, 0xac, 0x06, 
+  0xf4, 0x04, 0x36, 0x0e, 0x2f, 0xec, 0xc1, 0x40, 0x1d, 0x0a, 0x31, 0x20, 
+  0x90, 0xc0, 0x80, 0xc2, 0x36, 0x0b, 0xaf, 0xff, 0xc1, 0x44, 0x03, 0xf0, 
+  0x2a, 0xa7, 0x34, 0xa7, 0x15, 0xa7, 0xbe, 0x43, 0x9e, 0x42, 0x7e, 0x41, 
+  0x36, 0x0d, 0xef, 0xff, 0xe1, 0x40, 0x4a, 0x24, 0x00, 0x71, 0x0a, 0x21, 
+  0x40, 0x03, 0xa8, 0x20, 0x80, 0x01, 0x04, 0x16, 0x02, 0x14, 0x04, 0x19, 
+  0x90, 0x00, 0x9e, 0x17, 0x00, 0x16, 0x00, 0xa1, 0x0c, 0x8f, 0x0f, 0xe8, 
+  0x0c, 0x70, 0x04, 0x32, 0x00, 0x80, 0x16, 0x00, 0x06, 0x00, 0x28, 0x00, 
+  0x00, 0xc8, 0x00, 0x20, 0x00, 0x85, 0x32, 0x07, 0xf0, 0x1c, 0x04, 0x1d, 
+  0x10, 0x10, 0xd2, 0xc7, 0xe8, 0xc3, 0xa2, 0xc1, 0x08, 0x45, 0x00, 0x80, 
+  0x60, 0x44, 0x40, 0x24, 0xc3, 0x30, 0x40, 0x24, 0x05, 0x31, 0x40, 0x24, 
+  0x86, 0x30, 0x50, 0x40, 0x0a, 0x26, 0x40, 0x10, 0x55, 0x25, 0x4f, 0x18, 
+  0x36, 0x0a, 0x6f, 0xf3, 0x03, 0xc4, 0x01, 0xf1, 0x11, 0x14, 0x80, 0x30, 
+  0x03, 0x14, 0x81, 0x30, 0x0f, 0x78, 0xef, 0x09, 0x24, 0x00, 0x04, 0x77, 
+  0x65, 0x08, 0x95, 0x02, 0x25, 0x20, 0x00, 0x00, 0x0a, 0xf0, 0x0c, 0xf0, 
+  0x0c, 0xf0, 0x0e, 0xf0, 0x0e, 0x3e, 0x04, 0xf3, 0x1c, 0x1e, 0xf0, 0x1e, 
+  0xf0, 0x20, 0xf0, 0x0c, 0x8d, 0x0c, 0xf0, 0x05, 0x85, 0x1d, 0xf0, 0x06, 
+  0x85, 0x1b, 0xf0, 0x07, 0x85, 0x19, 0xf0, 0x08, 0x85, 0x17, 0xf0, 0x24, 
+  0x15, 0x80, 0x10, 0x81, 0xc3, 0xc1, 0x41, 0x1a, 0x08, 0x6f, 0xfa, 0x02, 
+  0x42, 0x14, 0xf0, 0x25, 0x10, 0x00, 0xf1, 0x03, 0xde, 0x0b, 0x2f, 0xf5, 
+  0x02, 0x42, 0x0c, 0xf0, 0x18, 0x85, 0x05, 0xf0, 0x19, 0x85, 0x03, 0xf0, 
+  0x04, 0x85, 0x16, 0x00, 0x50, 0x09, 0xaf, 0xf7, 0x02, 0x42, 0x74, 0x00, 
+  0x51, 0x6b, 0xb8, 0x73, 0x08, 0xd5, 0x6a, 0x00, 0x71, 0x0c, 0xf0, 0x0d, 
+  0xf0, 0x10, 0xf0, 0x11, 0xfe, 0x05, 0xf3, 0x0e, 0x21, 0xf0, 0x21, 0xf0, 
+  0x23, 0xf0, 0x23, 0xf0, 0x25, 0xf0, 0x6c, 0x15, 0x80, 0x10, 0x11, 0xf0, 
+  0x6d, 0x15, 0x80, 0x10, 0x07, 0xf0, 0x78, 0x15, 0x80, 0x10, 0x03, 0xf0, 
+  0x79, 0x5a, 0x00, 0x93, 0xb2, 0x0f, 0x2f, 0xfa, 0x02, 0x42, 0x19, 0xf0, 
+  0x7a, 0x10, 0x00, 0x11, 0x76, 0x6a, 0x00, 0xf0, 0x09, 0x11, 0xf0, 0x1c, 
+  0x85, 0x0a, 0xf0, 0x01, 0x87, 0x08, 0xf0, 0x02, 0x87, 0x06, 0xf0, 0x1d, 
+  0x85, 0x04, 0xf0, 0x00, 0x87, 0x02, 0xf0, 0x0e, 0x87, 0x22, 0x00, 0x15, 
+  0x66, 0x76, 0x00, 0xf0, 0x05, 0x04, 0x71, 0x02, 0x1c, 0x02, 0x30, 0x88, 
+  0xf1, 0x01, 0xc0, 0x41, 0x28, 0x01, 0x02, 0x00, 0xae, 0x21, 0xae, 0xc8, 
+  0xc7, 0x00, 0x03, 0xf2, 0x13, 0xa3, 0xc1, 0x48, 0x47, 0x28, 0x45, 0x2c, 
+  0x70, 0x10, 0xda, 0x60, 0x40, 0x0a, 0x20, 0x00, 0x21, 0xd6, 0x0a, 0x2f, 
+  0xfa, 0x68, 0x46, 0x2c, 0x70, 0xc3, 0x42, 0x13, 0x00, 0x60, 0x5f, 0x65, 
+  0x0d, 0x10, 0x10, 0x64, 0x01, 0x00, 0xf0, 0x07, 0xf4, 0x4f, 0x03, 0x04, 
+  0x80, 0xc0, 0x3c, 0x60, 0x24, 0x71, 0x38, 0x23, 0xc0, 0x03, 0x00, 0xac, 
+  0xde, 0x0d, 0x6f, 0xf5, 0x80, 0xc0, 0x38, 0xe8, 0x0f, 0xdd, 0x0e, 0x1e, 
+  0x43, 0x15, 0x0d, 0x1e, 0x03, 0x15, 0x0c, 0x1e, 0xc3, 0x14, 0x0b, 0x1e, 
+  0x83, 0x13, 0x0a, 0x1e, 0x43, 0x13, 0x09, 0x1e, 0xc3, 0x12, 0x08, 0x1e, 
+  0x43, 0x12, 0x07, 0x1e, 0x03, 0x12, 0x06, 0x1e, 0xc3, 0x11, 0x05, 0x1e, 
+  0x83, 0x11, 0x04, 0x1e, 0x43, 0x11, 0x03, 0x1e, 0x03, 0x11, 0x02, 0x1e, 
+  0xc3, 0x10, 0x01, 0x1e, 0x83, 0x10, 0x00, 0x1e, 0x43, 0x10, 0x19, 0xf0, 
+  0x4a, 0x24, 0x40, 0x71, 0x40, 0x22, 0x02, 0x04, 0x64, 0x00, 0x17, 0x81, 
+  0x64, 0x00, 0xf0, 0x2d, 0xd6, 0x08, 0xaf, 0xf7, 0x81, 0xc0, 0x26, 0xe8, 
+  0xad, 0x71, 0x00, 0x1e, 0x03, 0x12, 0x23, 0xf0, 0xad, 0x70, 0x1b, 0x0f, 
+  0xb0, 0x19, 0xb8, 0x66, 0x19, 0x0f, 0x71, 0x1c, 0xb8, 0x66, 0xa5, 0x72, 
+  0x01, 0x18, 0x83, 0x03, 0x00, 0x18, 0x43, 0x03, 0x04, 0xf0, 0xa5, 0x71, 
+  0x00, 0x18, 0xc3, 0x02, 0x7a, 0x0b, 0x2f, 0xf7, 0x78, 0x27, 0x00, 0x1c, 
+  0x05, 0xe8, 0xb8, 0x66, 0x12, 0x00, 0x70, 0x83, 0x01, 0x13, 0x0f, 0x71, 
+  0x1e, 0xbe, 0x0c, 0x00, 0xe0, 0x1e, 0x83, 0x12, 0x03, 0xf0, 0xad, 0x70, 
+  0x00, 0x18, 0x40, 0x23, 0xc8, 0xc7, 0xf0, 0x24, 0x02, 0x1d, 0x46, 0x24, 
+  0x02, 0x71, 0x44, 0x0a, 0x25, 0x40, 0x10, 0x16, 0x08, 0x20, 0x02, 0x10, 
+  0x32, 0x36, 0x01, 0xf2, 0x05, 0x55, 0x26, 0xd3, 0x1a, 0x55, 0x26, 0x52, 
+  0x19, 0x54, 0x26, 0x10, 0x18, 0x54, 0x26, 0x8f, 0x19, 0x40, 0x26, 0x11, 
+  0x1b, 0x34, 0x02, 0x11, 0xa7, 0x34, 0x02, 0x40, 0x61, 0x08, 0x95, 0x01, 
+  0xca, 0x01, 0xf0, 0x1b, 0x06, 0xf0, 0x0d, 0xf0, 0x12, 0xf0, 0x1a, 0xf0, 
+  0x1b, 0xf0, 0x22, 0xf0, 0x81, 0xc3, 0x22, 0x40, 0xa1, 0x41, 0xde, 0x0e, 
+  0x6f, 0xfa, 0x82, 0x42, 0x20, 0xf0, 0x0a, 0x86, 0x81, 0xc3, 0xa1, 0x41, 
+  0xea, 0x0c, 0x6f, 0xef, 0x82, 0x42, 0x1a, 0xf0, 0x3c, 0x16, 0xba, 0x01, 
+  0xf1, 0x10, 0xa1, 0x41, 0xe6, 0x0d, 0x2f, 0xfa, 0x82, 0x42, 0x12, 0xf0, 
+  0x81, 0xc3, 0x02, 0x40, 0x03, 0xf0, 0x81, 0xc3, 0xe1, 0x40, 0xa1, 0x41, 
+  0x26, 0x0a, 0xaf, 0xf7, 0x82, 0x42, 0x08, 0xf0, 0x1a, 0x32, 0x00, 0x51, 
+  0xae, 0x0f, 0x6f, 0xf7, 0x82, 0xba, 0x01, 0xf1, 0x0e, 0x25, 0x08, 0x70, 
+  0x02, 0x81, 0xc3, 0x13, 0x08, 0x30, 0x02, 0x81, 0xc3, 0x23, 0x08, 0xf1, 
+  0x01, 0x81, 0xc3, 0x62, 0x40, 0x09, 0xf0, 0x90, 0x16, 0x80, 0x10, 0xa1, 
+  0x41, 0x9e, 0x48, 0x00, 0x71, 0x07, 0xf0, 0x42, 0x40, 0xa1, 0x41, 0x6a, 
+  0x72, 0x00, 0x06, 0xec, 0x01, 0x14, 0xac, 0xec, 0x01, 0xf0, 0x10, 0xad, 
+  0x21, 0xad, 0xd0, 0xc7, 0xe0, 0x78, 0xec, 0xc3, 0xb3, 0xc1, 0x88, 0x47, 
+  0x48, 0x45, 0x30, 0x42, 0x10, 0x41, 0x2c, 0x70, 0x22, 0xa7, 0x21, 0xa7, 
+  0x20, 0xa7, 0x02, 0xeb, 0xcc, 0xc7, 0xe0, 0x03, 0x42, 0x55, 0x21, 0x0e, 
+  0x28, 0xd8, 0x03, 0xf0, 0x9b, 0xc0, 0x02, 0x02, 0x4d, 0x90, 0xc3, 0x15, 
+  0x7b, 0x00, 0x32, 0x82, 0x0f, 0xcc, 0x3d, 0xcd, 0xcc, 0x04, 0x71, 0x40, 
+  0xa3, 0x6d, 0x11, 0x80, 0x20, 0x14, 0x70, 0x0c, 0x70, 0x0d, 0xf2, 0x40, 
+  0x16, 0x82, 0x10, 0x90, 0xc1, 0x5e, 0x0b, 0x20, 0x00, 0x22, 0x40, 0x56, 
+  0x21, 0x41, 0x28, 0x6c, 0x16, 0x80, 0x10, 0x20, 0x89, 0x05, 0x20, 0x7e, 
+  0x80, 0xdd, 0xf5, 0x23, 0x85, 0x0c, 0x70, 0x04, 0x31, 0x00, 0x80, 0xc4, 
+  0xf6, 0x3f, 0xd8, 0x18, 0xb8, 0x05, 0xf0, 0xc3, 0x40, 0x00, 0xbf, 0x00, 
+  0x00, 0x01, 0x31, 0x00, 0x00, 0x7a, 0x11, 0x81, 0x20, 0x48, 0x30, 0xc0, 
+  0x02, 0x0f, 0x78, 0x93, 0x08, 0x44, 0x80, 0x10, 0x8e, 0x0f, 0xe8, 0x6c, 
+  0x11, 0x80, 0x20, 0x31, 0x08, 0xb1, 0x00, 0x10, 0x1e, 0x03, 0x10, 0x40, 
+  0x21, 0x00, 0x2b, 0x90, 0xc1, 0x4a, 0x0b, 0xaf, 0xf2, 0x80, 0xc2, 0x20, 
+  0xf0, 0x79, 0x11, 0x80, 0x20, 0xd7, 0x08, 0x30, 0x00, 0x40, 0x21, 0x0d, 
+  0x2b, 0x55, 0x21, 0x40, 0x29, 0x84, 0xc2, 0xca, 0x09, 0xaf, 0xf2, 0xa1, 
+  0x41, 0x66, 0xf0, 0x55, 0x21, 0xcd, 0x2a, 0x90, 0xc1, 0x80, 0xc2, 0x1e, 
+  0x0b, 0xaf, 0xf2, 0x0a, 0x20, 0x40, 0x03, 0x98, 0x02, 0x00, 0x3c, 0x00, 
+  0x01, 0x24, 0x04, 0xf1, 0x24, 0x10, 0x01, 0x04, 0x04, 0x1d, 0x50, 0x10, 
+  0xad, 0x70, 0x80, 0xc0, 0x1a, 0x0a, 0x2f, 0xf4, 0x42, 0xc5, 0x01, 0xc0, 
+  0x7f, 0xd9, 0x17, 0xb9, 0x04, 0x30, 0x40, 0x80, 0x4f, 0x21, 0xc2, 0x07, 
+  0xca, 0x20, 0x49, 0x00, 0x04, 0x30, 0x80, 0x80, 0xf6, 0x0d, 0x6f, 0xf4, 
+  0xca, 0x20, 0x85, 0x00, 0x08, 0x46, 0xc3, 0x40, 0x50, 0x06, 0xf1, 0x2c, 
+  0x36, 0x00, 0x90, 0x83, 0xf6, 0x02, 0x30, 0x8e, 0x03, 0x00, 0xc0, 0x43, 
+  0xc0, 0x56, 0x0c, 0x6f, 0xf5, 0x83, 0xc0, 0x00, 0x36, 0x8e, 0x1f, 0x00, 
+  0x3f, 0x00, 0x00, 0x45, 0xc5, 0xc1, 0x40, 0x56, 0x0f, 0xaf, 0xf6, 0x44, 
+  0xc5, 0x47, 0xc0, 0x9e, 0x0c, 0xef, 0xfa, 0xc1, 0x40, 0x03, 0xc1, 0x79, 
+  0x11, 0x82, 0x20, 0x00, 0x30, 0x40, 0x00, 0x46, 0xc0, 0x07, 0xea, 0x9e, 
+  0x00, 0x50, 0xc1, 0x10, 0xda, 0x0f, 0xf0, 0xac, 0x00, 0x51, 0x84, 0xc0, 
+  0x88, 0xc2, 0x22, 0xaa, 0x00, 0xf1, 0x08, 0x88, 0xc0, 0x1e, 0x0a, 0xaf, 
+  0xf2, 0x8c, 0xc1, 0x8c, 0xc1, 0x10, 0xda, 0xa1, 0x40, 0x42, 0x09, 0x0f, 
+  0xec, 0x1d, 0x02, 0x00, 0x00, 0x84, 0x00, 0x08, 0xf0, 0x09, 0x2f, 0xec, 
+  0xa1, 0x41, 0x6c, 0x11, 0x90, 0x20, 0x84, 0xc0, 0x90, 0xc1, 0x56, 0x0a, 
+  0xaf, 0xf2, 0x40, 0x24, 0x02, 0x30, 0x19, 0x08, 0xb0, 0x20, 0xcc, 0x00, 
+  0x41, 0x55, 0x21, 0xc0, 0x2a, 0xcc, 0x00, 0xf0, 0x16, 0x15, 0x01, 0x14, 
+  0x04, 0x18, 0x50, 0x00, 0x80, 0xc0, 0xad, 0x70, 0x4e, 0x09, 0x2f, 0xf4, 
+  0x08, 0x1c, 0x01, 0x30, 0x01, 0xc0, 0x00, 0xc1, 0x04, 0x30, 0x40, 0x83, 
+  0x48, 0xc1, 0x45, 0xf7, 0xae, 0x0b, 0x6f, 0xf5, 0x88, 0xc0, 0xfa, 0x00, 
+  0xf0, 0x01, 0x82, 0x0e, 0x6f, 0xf2, 0x84, 0xc1, 0x84, 0xc0, 0x92, 0x0e, 
+  0x6f, 0xf2, 0xe1, 0x41, 0x08, 0xc2, 0xca, 0x01, 0x20, 0xe1, 0x40, 0x10, 
+  0x05, 0x60, 0x20, 0x80, 0x00, 0x32, 0x41, 0x00, 0x46, 0x00, 0x60, 0x78, 
+  0x11, 0x80, 0x20, 0x2e, 0xe8, 0x1a, 0x00, 0xf0, 0x04, 0x4c, 0x70, 0x0c, 
+  0x70, 0xa8, 0x20, 0x00, 0x02, 0x04, 0x12, 0x01, 0x24, 0x00, 0x31, 0x41, 
+  0x00, 0x01, 0x30, 0x40, 0x14, 0x01, 0xf0, 0x0a, 0x8f, 0x61, 0x44, 0x00, 
+  0x00, 0x43, 0xc0, 0xc6, 0xf6, 0x00, 0x30, 0x82, 0x0f, 0xbc, 0x38, 0x62, 
+  0xbe, 0x7f, 0xd8, 0x17, 0xb8, 0x70, 0x11, 0x03, 0x20, 0x64, 0x05, 0x00, 
+  0x38, 0x00, 0x00, 0x30, 0x01, 0x30, 0x00, 0x30, 0x01, 0xf4, 0x05, 0xf2, 
+  0x02, 0x02, 0x00, 0x87, 0x00, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 
+  0x04, 0x1f, 0x10, 0x10, 0xa2, 0xf0, 0x3c, 0x02, 0x60, 0x4d, 0x2c, 0xa1, 
+  0x40, 0xe1, 0x42, 0x20, 0x00, 0x91, 0x60, 0x80, 0x04, 0x12, 0x01, 0x04, 
+  0x01, 0x31, 0xc1, 0x7c, 0x00, 0xf0, 0x15, 0x42, 0x0a, 0x2f, 0xfa, 0xa1, 
+  0x40, 0xd3, 0x40, 0xc8, 0x42, 0x00, 0x00, 0x04, 0x30, 0x00, 0x84, 0xda, 
+  0xf6, 0x02, 0x85, 0x40, 0x85, 0x21, 0x85, 0x42, 0xc0, 0xa1, 0x40, 0x40, 
+  0xc2, 0x22, 0x0a, 0x2f, 0xfa, 0x41, 0xc1, 0x42, 0x00, 0x41, 0x80, 0xc1, 
+  0x0a, 0x22, 0xec, 0x05, 0xf0, 0x2a, 0x02, 0x04, 0x11, 0x03, 0x04, 0x07, 
+  0x33, 0x03, 0x00, 0x00, 0x33, 0x03, 0x04, 0x04, 0x1a, 0xd0, 0x00, 0x00, 
+  0x86, 0x08, 0xc1, 0x4a, 0x86, 0x02, 0x36, 0x03, 0x70, 0x80, 0x3f, 0x00, 
+  0x00, 0x24, 0x16, 0x8c, 0x10, 0x00, 0x30, 0x41, 0x00, 0x00, 0x33, 0x80, 
+  0x00, 0x01, 0x30, 0x42, 0x00, 0x4a, 0xa6, 0x07, 0xec, 0x02, 0x86, 0x50, 
+  0x22, 0xc1, 0x07, 0x78, 0x02, 0x20, 0x11, 0xf6, 0x4c, 0x00, 0x13, 0x2c, 
+  0xe4, 0x00, 0x40, 0x00, 0x24, 0x00, 0x30, 0x7e, 0x02, 0x40, 0x01, 0x00, 
+  0x0f, 0x86, 0x1e, 0x00, 0x80, 0x40, 0x00, 0x0c, 0x00, 0x74, 0x11, 0x0c, 
+  0x20, 0x80, 0x00, 0x61, 0x02, 0x85, 0x70, 0x11, 0x0b, 0x20, 0x7a, 0x00, 
+  0xf0, 0x08, 0xc3, 0x43, 0xc4, 0x40, 0xc2, 0x41, 0xc1, 0x08, 0x1c, 0x00, 
+  0x30, 0xa8, 0x20, 0x40, 0x03, 0x04, 0x13, 0x00, 0x04, 0x20, 0x87, 0x00, 
+  0x34, 0x56, 0x07, 0x51, 0x40, 0x10, 0x01, 0x30, 0x80, 0xe8, 0x00, 0xf0, 
+  0x01, 0x2e, 0xf0, 0xa6, 0xec, 0x23, 0x86, 0xbf, 0xba, 0x04, 0x32, 0x40, 
+  0x80, 0x44, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x71, 0x74, 0x11, 0x01, 0x20, 
+  0x40, 0x85, 0x61, 0x4c, 0x00, 0xf3, 0x03, 0x0c, 0x20, 0x40, 0x24, 0x0b, 
+  0x30, 0x24, 0x1e, 0x43, 0x10, 0x43, 0xc1, 0x40, 0xc2, 0x41, 0xc3, 0x42, 
+  0xc0, 0x4c, 0x00, 0xe1, 0x14, 0x40, 0x87, 0x00, 0x31, 0x03, 0x00, 0x00, 
+  0x34, 0x80, 0x10, 0x01, 0x30, 0xc0, 0x4c, 0x00, 0xf1, 0x00, 0x08, 0xf0, 
+  0x0c, 0x70, 0x24, 0x1e, 0x02, 0x10, 0x02, 0xa7, 0x01, 0xa7, 0x00, 0xa7, 
+  0xed, 0x5a, 0x03, 0xf0, 0x21, 0x7e, 0x04, 0xc2, 0xff, 0xed, 0x19, 0x43, 
+  0x20, 0xcc, 0xc7, 0xf0, 0xc3, 0xa4, 0xc1, 0x55, 0x20, 0x0e, 0x0d, 0x28, 
+  0x45, 0x10, 0x41, 0x32, 0x86, 0x65, 0x16, 0x00, 0x16, 0x50, 0x42, 0x0a, 
+  0x0e, 0x6f, 0xfa, 0x1c, 0x1e, 0x43, 0x10, 0x04, 0x71, 0x65, 0x1e, 0x18, 
+  0x10, 0x80, 0xc1, 0xc6, 0x0b, 0x56, 0x01, 0xa0, 0x01, 0xc1, 0x00, 0xc0, 
+  0x65, 0x16, 0x0f, 0x16, 0x02, 0xc2, 0xc8, 0x01, 0x00, 0x92, 0x00, 0x83, 
+  0x92, 0x6f, 0x01, 0x30, 0x8b, 0x00, 0x2c, 0x6c, 0xa0, 0x07, 0xf0, 0x5e, 
+  0x02, 0x02, 0x4d, 0x15, 0x21, 0x43, 0x20, 0x04, 0x71, 0x24, 0x71, 0x47, 
+  0x1b, 0x98, 0x00, 0x2f, 0x33, 0xc0, 0x02, 0x22, 0x42, 0x80, 0x22, 0x09, 
+  0x08, 0x20, 0x8a, 0x15, 0x21, 0x00, 0x23, 0x46, 0x18, 0xd8, 0x00, 0x8f, 
+  0xe9, 0x63, 0x16, 0x00, 0x16, 0x32, 0x86, 0x0f, 0x09, 0x23, 0x00, 0x2c, 
+  0x71, 0x00, 0x1a, 0x43, 0x00, 0x05, 0xf0, 0x04, 0x71, 0x2c, 0x70, 0x63, 
+  0x1e, 0x18, 0x10, 0x34, 0x70, 0x8a, 0xf2, 0xb2, 0x86, 0x10, 0x86, 0x09, 
+  0x20, 0x50, 0x03, 0x17, 0x0f, 0x23, 0x14, 0x42, 0x20, 0x53, 0x20, 0x2d, 
+  0x0f, 0xe1, 0x14, 0x8e, 0x71, 0xf1, 0x43, 0xa1, 0x43, 0x18, 0xf0, 0xbf, 
+  0x67, 0x02, 0x27, 0x00, 0x14, 0x04, 0x71, 0x6e, 0x0d, 0x6f, 0xfa, 0xa1, 
+  0x41, 0x8a, 0x00, 0x20, 0x10, 0x44, 0x24, 0x00, 0xf1, 0x00, 0x6c, 0x72, 
+  0xad, 0x71, 0x0a, 0xf0, 0xb8, 0x67, 0x02, 0x20, 0x00, 0x04, 0x04, 0x71, 
+  0x4e, 0x1e, 0x00, 0xf0, 0x43, 0x00, 0x43, 0x7f, 0xd9, 0x48, 0x30, 0x90, 
+  0x20, 0x17, 0xb9, 0x48, 0x33, 0x93, 0x20, 0x07, 0x31, 0x05, 0x04, 0x22, 
+  0x40, 0x80, 0x20, 0x04, 0x07, 0x40, 0x24, 0x07, 0x30, 0xe1, 0x42, 0x07, 
+  0x31, 0xc6, 0x04, 0x82, 0x41, 0xc6, 0x0b, 0x20, 0x00, 0xa1, 0x44, 0x09, 
+  0x0a, 0x10, 0x20, 0x20, 0x86, 0x03, 0xf0, 0x21, 0x86, 0x0a, 0x0d, 0xaf, 
+  0xff, 0x80, 0xc0, 0x65, 0x16, 0x01, 0x16, 0x42, 0x86, 0x6d, 0x71, 0x04, 
+  0xb9, 0x22, 0x71, 0x46, 0x11, 0x01, 0x06, 0x04, 0x31, 0x80, 0x80, 0x86, 
+  0xf7, 0x43, 0x86, 0x08, 0x00, 0xf0, 0x0f, 0x02, 0xf6, 0x6d, 0x70, 0x8a, 
+  0xe8, 0x15, 0x0b, 0x11, 0x10, 0x06, 0x86, 0xa1, 0x68, 0xe4, 0xe5, 0xc2, 
+  0xf6, 0x64, 0xdd, 0xa6, 0xa6, 0x05, 0xf0, 0xad, 0x70, 0x18, 0x1e, 0x01, 
+  0x10, 0x5a, 0x01, 0x20, 0x21, 0xe8, 0x50, 0x00, 0x80, 0x28, 0x86, 0x03, 
+  0xf0, 0x29, 0x86, 0xba, 0x0c, 0x50, 0x00, 0xf0, 0x0d, 0x05, 0xe8, 0x56, 
+  0x21, 0x40, 0x28, 0x00, 0x18, 0x43, 0x00, 0x0f, 0x0b, 0x30, 0x10, 0x80, 
+  0xc0, 0x34, 0x1e, 0x01, 0x10, 0x11, 0xf0, 0x9e, 0x0c, 0xaf, 0xff, 0x2a, 
+  0x86, 0xe2, 0x04, 0xe2, 0x03, 0xf4, 0x0d, 0x86, 0x04, 0x71, 0x2c, 0x86, 
+  0x0f, 0x08, 0x62, 0x00, 0x0d, 0xa6, 0x2c, 0x00, 0xc0, 0x03, 0x00, 0x05, 
+  0x86, 0x09, 0x0d, 0x02, 0x10, 0x1c, 0x1e, 0x03, 0x10, 0x48, 0x05, 0xf0, 
+  0x43, 0x59, 0x04, 0x80, 0x02, 0x4c, 0x70, 0x56, 0x20, 0x41, 0x08, 0x8a, 
+  0x24, 0x01, 0x74, 0x40, 0xa9, 0x00, 0x41, 0x55, 0x20, 0x83, 0x0e, 0x80, 
+  0x21, 0x04, 0x07, 0x40, 0xa3, 0x47, 0xa3, 0x42, 0xb3, 0xa8, 0x20, 0x00, 
+  0x01, 0x04, 0x19, 0x11, 0x00, 0x80, 0x20, 0x09, 0x08, 0x5f, 0x1b, 0x98, 
+  0x00, 0x40, 0xa1, 0xe0, 0x7f, 0x40, 0xa8, 0xe0, 0x78, 0xe8, 0xc2, 0x68, 
+  0x45, 0x48, 0x46, 0x30, 0x40, 0xc6, 0x0a, 0xa0, 0x02, 0x08, 0x47, 0x42, 
+  0x20, 0xc0, 0x22, 0x31, 0x08, 0xf5, 0x02, 0x55, 0x27, 0x50, 0x18, 0x42, 
+  0x06, 0xf3, 0x1e, 0x0c, 0xf0, 0x11, 0xf0, 0x18, 0xf0, 0x1d, 0xf0, 0x24, 
+  0xf0, 0x29, 0xf0, 0x2f, 0xf0, 0x34, 0xf0, 0x3b, 0xf0, 0x3f, 0xf0, 0x46, 
+  0xf0, 0xc1, 0x40, 0x86, 0x0b, 0xef, 0xf4, 0xa1, 0x41, 0x6c, 0x1f, 0x02, 
+  0x10, 0xc8, 0xc6, 0xc1, 0x40, 0xa2, 0x0f, 0xef, 0xf9, 0xa1, 0x41, 0x6d, 
+  0x0e, 0x00, 0x11, 0x96, 0x0e, 0x00, 0x13, 0x78, 0x0e, 0x00, 0x11, 0x86, 
+  0x0e, 0x00, 0x13, 0x79, 0x0e, 0x00, 0x11, 0x4e, 0x38, 0x00, 0x13, 0x7a, 
+  0x0e, 0x00, 0x80, 0x42, 0x09, 0x6f, 0xf7, 0xa1, 0x41, 0x1c, 0xa7, 0x0c, 
+  0x00, 0x11, 0x36, 0x0c, 0x00, 0x40, 0x04, 0x18, 0x00, 0x20, 0x0e, 0x00, 
+  0x11, 0x2a, 0x0e, 0x00, 0x13, 0x08, 0x0e, 0x00, 0x11, 0x1a, 0x0e, 0x00, 
+  0x11, 0x1d, 0x28, 0x00, 0x11, 0x0e, 0x0c, 0x00, 0x13, 0x00, 0x1a, 0x00, 
+  0x11, 0x02, 0x0e, 0x00, 0x11, 0x38, 0x0e, 0x00, 0xf0, 0x28, 0xe0, 0x78, 
+  0xe8, 0xc3, 0x82, 0x24, 0x0c, 0x34, 0x50, 0x40, 0x08, 0x47, 0x84, 0xc0, 
+  0x8a, 0x22, 0x0c, 0x00, 0x5a, 0x0c, 0xef, 0xeb, 0x28, 0x45, 0x00, 0x87, 
+  0x40, 0x24, 0x83, 0x30, 0x40, 0x24, 0x04, 0x32, 0x40, 0x24, 0x05, 0x33, 
+  0x40, 0x24, 0x06, 0x31, 0x40, 0x24, 0xc7, 0x30, 0xa1, 0x41, 0x02, 0x42, 
+  0x66, 0x08, 0x2f, 0xf3, 0x02, 0x54, 0x07, 0xf0, 0x02, 0xc5, 0x04, 0xed, 
+  0xa1, 0x40, 0xc8, 0xc7, 0x03, 0x14, 0x8e, 0x30, 0xad, 0x70, 0x0c, 0x70, 
+  0xfa, 0xe8, 0xb0, 0x06, 0xf0, 0x19, 0xcf, 0x79, 0xed, 0x08, 0x64, 0x80, 
+  0x84, 0xc2, 0x81, 0xc3, 0x22, 0x08, 0x20, 0x00, 0xe1, 0x40, 0x01, 0xc0, 
+  0x8a, 0x21, 0x3e, 0x06, 0x12, 0x70, 0xca, 0x25, 0x4d, 0x10, 0x2c, 0x71, 
+  0x3c, 0x20, 0x00, 0x20, 0x06, 0x79, 0x3e, 0x66, 0xea, 0xf1, 0x78, 0x00, 
+  0x20, 0xa4, 0xc1, 0x46, 0x01, 0xf3, 0x1c, 0x28, 0x47, 0x22, 0x0a, 0xa0, 
+  0x02, 0x10, 0x40, 0x21, 0x0f, 0x70, 0x12, 0x80, 0xc2, 0x33, 0x0f, 0x30, 
+  0x12, 0xc1, 0x40, 0x29, 0x0f, 0xf1, 0x11, 0x80, 0xc2, 0xc1, 0x40, 0x46, 
+  0x0f, 0x2f, 0xfa, 0xa1, 0x41, 0x55, 0x20, 0xc0, 0x2a, 0x08, 0xf0, 0xc1, 
+  0x40, 0x3a, 0x0e, 0x00, 0xe0, 0x40, 0x29, 0x80, 0xc1, 0xb6, 0x0b, 0xef, 
+  0xeb, 0x10, 0xda, 0xc8, 0xc7, 0x5e, 0x0e, 0x2a, 0x01, 0x50, 0x90, 0x18, 
+  0x02, 0x20, 0xc8, 0x18, 0x07, 0xf0, 0x0c, 0xc2, 0x48, 0x31, 0x01, 0x00, 
+  0xcb, 0x44, 0x48, 0x47, 0x00, 0x00, 0x07, 0x34, 0x43, 0x10, 0x22, 0x92, 
+  0x55, 0x20, 0xcd, 0x09, 0x08, 0x46, 0xe8, 0x15, 0x00, 0x90, 0x1a, 0x00, 
+  0x60, 0x07, 0x34, 0x52, 0x10, 0xd3, 0x41, 0x80, 0x04, 0xe0, 0x38, 0x85, 
+  0xd3, 0x40, 0x83, 0x3a, 0x6f, 0x12, 0x0d, 0x70, 0x00, 0x30, 0x80, 0x0f, 
+  0xd6, 0x04, 0xf1, 0x35, 0x50, 0x21, 0xc2, 0x25, 0x48, 0x31, 0x81, 0x00, 
+  0x07, 0x36, 0xcc, 0x70, 0xf4, 0x49, 0x00, 0x24, 0x48, 0x43, 0x3c, 0x1e, 
+  0x43, 0x10, 0xf4, 0x1d, 0x43, 0x90, 0x7a, 0xa6, 0x07, 0x31, 0x8f, 0x24, 
+  0x07, 0x30, 0x86, 0x04, 0x11, 0x85, 0x81, 0xa6, 0x48, 0x30, 0x80, 0x00, 
+  0x00, 0x32, 0x00, 0x20, 0x00, 0x32, 0x41, 0x20, 0x00, 0x30, 0x00, 0x04, 
+  0x00, 0x31, 0x09, 0x04, 0x04, 0x30, 0x00, 0x82, 0xca, 0x23, 0x8c, 0x1f, 
+  0x26, 0x07, 0x70, 0x30, 0xc0, 0x02, 0x04, 0x31, 0x00, 0x92, 0x26, 0x07, 
+  0xc2, 0x12, 0xa5, 0xff, 0xa6, 0xe4, 0x1d, 0x80, 0x91, 0x40, 0x40, 0x05, 
+  0xf6, 0x44, 0x07, 0x20, 0x3e, 0x85, 0x64, 0x00, 0xf0, 0x01, 0x00, 0x32, 
+  0x4c, 0x20, 0x01, 0x31, 0x01, 0x10, 0x00, 0x34, 0x00, 0x14, 0x48, 0x31, 
+  0xc1, 0x02, 0x40, 0x00, 0x62, 0x39, 0xa5, 0x05, 0xf6, 0xc3, 0x42, 0x42, 
+  0x00, 0x11, 0x80, 0x06, 0x04, 0x00, 0x42, 0x00, 0xe1, 0x1d, 0xa5, 0xc1, 
+  0x40, 0xc3, 0x41, 0x13, 0x00, 0x84, 0x5f, 0x80, 0x20, 0x0a, 0x01, 0x10, 
+  0x05, 0xf5, 0x20, 0x11, 0x02, 0x04, 0x07, 0x32, 0xc2, 0x00, 0x04, 0x18, 
+  0x90, 0x00, 0x07, 0x36, 0xc0, 0x70, 0x80, 0xbf, 0x00, 0x00, 0x07, 0x30, 
+  0x80, 0x0f, 0x72, 0x3f, 0x22, 0xb0, 0x72, 0x09, 0xcf, 0xfd, 0x02, 0x31, 
+  0x00, 0x20, 0x7e, 0x1d, 0x18, 0x10, 0x2a, 0x0d, 0xef, 0xff, 0xc1, 0x40, 
+  0x1c, 0x85, 0xb0, 0x00, 0x32, 0x30, 0x01, 0x04, 0xd6, 0x07, 0x11, 0xc5, 
+  0xd6, 0x07, 0x17, 0x04, 0xd6, 0x07, 0x00, 0x6a, 0x00, 0xf1, 0x3c, 0x49, 
+  0x20, 0x00, 0x05, 0x48, 0x20, 0x80, 0x00, 0x1f, 0xa5, 0xcc, 0xc6, 0xf6, 
+  0xc3, 0xa4, 0xc1, 0x40, 0x29, 0x96, 0x00, 0x42, 0x26, 0x13, 0x21, 0x50, 
+  0x41, 0x28, 0x47, 0x08, 0x45, 0x15, 0x20, 0xc1, 0x04, 0x80, 0xc0, 0x10, 
+  0xda, 0x0a, 0x20, 0xc0, 0x21, 0x0a, 0x27, 0x80, 0x21, 0x0a, 0x25, 0x40, 
+  0x21, 0x0a, 0x22, 0x00, 0x21, 0x68, 0x46, 0x2a, 0x0a, 0xef, 0xeb, 0x40, 
+  0x24, 0x14, 0x30, 0x2f, 0x0f, 0x63, 0x14, 0x15, 0x25, 0x82, 0x15, 0x0a, 
+  0x21, 0xc0, 0xd0, 0x07, 0x30, 0x48, 0x44, 0x80, 0x3c, 0x05, 0x00, 0x48, 
+  0x06, 0xf0, 0x12, 0x14, 0x0b, 0x14, 0x01, 0x33, 0xc3, 0x10, 0x04, 0x18, 
+  0xd0, 0x00, 0x24, 0x71, 0xe5, 0x09, 0x62, 0x84, 0x10, 0xe2, 0x33, 0x0a, 
+  0xa2, 0x23, 0x34, 0x6e, 0xb9, 0x61, 0xc1, 0x42, 0x42, 0x21, 0x01, 0x04, 
+  0x30, 0x00, 0x4e, 0x80, 0xc0, 0x28, 0x44, 0x30, 0x00, 0x80, 0x10, 0xe1, 
+  0x52, 0x72, 0x44, 0x71, 0xb0, 0xf6, 0x22, 0x00, 0x10, 0x8d, 0x10, 0x06, 
+  0xf0, 0x1a, 0x05, 0x15, 0x24, 0x01, 0x23, 0x00, 0x81, 0xf0, 0x25, 0xc2, 
+  0x14, 0x15, 0x20, 0x03, 0x23, 0x00, 0x30, 0x40, 0x05, 0x85, 0x71, 0x02, 
+  0x32, 0x02, 0x00, 0x66, 0x71, 0x00, 0x32, 0x82, 0x00, 0x00, 0xa1, 0x00, 
+  0x1b, 0x80, 0x00, 0x39, 0x0f, 0x63, 0x14, 0x32, 0x00, 0x00, 0x40, 0x05, 
+  0xf0, 0x0b, 0x15, 0x20, 0xc2, 0x03, 0xa8, 0x20, 0x40, 0x04, 0x80, 0xc1, 
+  0x43, 0x4d, 0x01, 0x49, 0x15, 0x20, 0x0c, 0x20, 0x04, 0x71, 0x02, 0x33, 
+  0x41, 0x00, 0x60, 0x84, 0x3a, 0x07, 0xf0, 0x03, 0x44, 0x71, 0x01, 0x33, 
+  0x41, 0x00, 0x20, 0xa4, 0xe5, 0x71, 0xcd, 0x07, 0xcf, 0xff, 0x39, 0x0a, 
+  0x82, 0x23, 0x38, 0x00, 0x61, 0x12, 0x6e, 0x6c, 0x68, 0x4a, 0x21, 0x7c, 
+  0x05, 0xf0, 0x04, 0x04, 0x80, 0xc0, 0x62, 0x4d, 0x20, 0x48, 0x15, 0x20, 
+  0x4c, 0x20, 0x24, 0x71, 0x02, 0x32, 0x00, 0x00, 0x40, 0x84, 0x8e, 0x06, 
+  0xd1, 0x64, 0x71, 0x01, 0x32, 0x00, 0x00, 0x00, 0xa4, 0x52, 0x76, 0xc5, 
+  0x71, 0xa8, 0x9e, 0x00, 0x00, 0xac, 0x07, 0xf0, 0x3d, 0x06, 0x40, 0x00, 
+  0x30, 0xc0, 0x05, 0x04, 0x18, 0x10, 0x20, 0xd6, 0xc7, 0xe4, 0xc2, 0x49, 
+  0x68, 0x4f, 0x7d, 0x9f, 0x25, 0x02, 0x13, 0xcb, 0x44, 0xa0, 0x00, 0xcc, 
+  0x49, 0x20, 0x43, 0xba, 0x64, 0xd1, 0x82, 0x54, 0x24, 0x82, 0x1a, 0x59, 
+  0x65, 0x42, 0x6e, 0x40, 0xb1, 0x0f, 0x78, 0xc3, 0x44, 0x13, 0x00, 0x64, 
+  0x3e, 0xb2, 0x0e, 0x2f, 0xf8, 0x4c, 0x74, 0xc4, 0xc6, 0x00, 0x43, 0x02, 
+  0x80, 0x04, 0x30, 0x40, 0x80, 0x0c, 0x70, 0xe0, 0x20, 0xce, 0x07, 0x43, 
+  0x83, 0xa2, 0x06, 0x40, 0xc9, 0xf7, 0x04, 0x83, 0x14, 0x00, 0xf0, 0x0a, 
+  0xc8, 0xf7, 0xc3, 0x40, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x7e, 0x7f, 0xd8, 
+  0xe0, 0x7f, 0x17, 0xb8, 0x0c, 0x70, 0xe0, 0x7f, 0x9e, 0xb8, 0xe0, 0x78, 
+  0xea, 0xbc, 0x03, 0x10, 0x37, 0xbc, 0x03, 0x11, 0x87, 0xbc, 0x03, 0x25, 
+  0x9e, 0x08, 0xbc, 0x03, 0xf0, 0x02, 0x33, 0x40, 0x24, 0x04, 0x35, 0x40, 
+  0x24, 0x05, 0x36, 0x40, 0x24, 0x06, 0x34, 0x40, 0x24, 0xc7, 0x33, 0xbc, 
+  0x03, 0x91, 0xaa, 0x0c, 0xef, 0xf2, 0x0e, 0x1c, 0x03, 0x31, 0x05, 0xbc, 
+  0x03, 0x31, 0xca, 0xc7, 0x0f, 0xbc, 0x03, 0x11, 0x2e, 0x28, 0x01, 0xf1, 
+  0x40, 0xf8, 0xe8, 0x0e, 0x14, 0x81, 0x30, 0xcf, 0x78, 0xe9, 0x09, 0x04, 
+  0x80, 0x23, 0x08, 0x30, 0x01, 0x84, 0xc1, 0x29, 0x08, 0xb0, 0x00, 0x84, 
+  0xc1, 0x37, 0x08, 0xf0, 0x00, 0x84, 0xc1, 0x3b, 0x08, 0x71, 0x00, 0x87, 
+  0xc0, 0xc2, 0x0e, 0xaf, 0xf4, 0x84, 0xc1, 0x04, 0xaf, 0x15, 0xf0, 0xba, 
+  0x0e, 0xaf, 0xf4, 0x87, 0xc0, 0x15, 0xaf, 0x11, 0xf0, 0x87, 0xc0, 0xae, 
+  0x0e, 0x6f, 0xf8, 0x80, 0xc2, 0x00, 0xc2, 0x01, 0xc1, 0x02, 0xc0, 0x42, 
+  0xa7, 0x23, 0xa7, 0x04, 0xa7, 0x05, 0xf0, 0x9a, 0x20, 0x00, 0x33, 0x14, 
+  0xaf, 0x04, 0x00, 0x04, 0x00, 0xfa, 0x03, 0x00, 0x04, 0x04, 0xf0, 0x3b, 
+  0x06, 0x21, 0x01, 0x20, 0x3e, 0x66, 0xca, 0xf1, 0xe0, 0x78, 0xf2, 0xc3, 
+  0xac, 0xc1, 0x17, 0xc7, 0x50, 0x45, 0x30, 0x42, 0x08, 0x46, 0x2c, 0x70, 
+  0x24, 0xda, 0xe1, 0x40, 0xe8, 0x45, 0x0a, 0x20, 0x80, 0x21, 0x0a, 0x21, 
+  0x40, 0x21, 0x0a, 0x23, 0x00, 0x21, 0x16, 0x0e, 0xaf, 0xf9, 0x70, 0x44, 
+  0x04, 0x8e, 0x13, 0x08, 0x3f, 0x00, 0x14, 0xda, 0x15, 0x08, 0x7f, 0x00, 
+  0x80, 0xc0, 0x14, 0xda, 0x62, 0x41, 0x07, 0xf0, 0x80, 0xc0, 0xa2, 0x41, 
+  0x05, 0xf0, 0x0e, 0x00, 0xa0, 0x82, 0x41, 0xae, 0x0f, 0x8f, 0xeb, 0x04, 
+  0xc1, 0xc6, 0x0e, 0xec, 0x02, 0xf1, 0x10, 0x44, 0xc0, 0x80, 0xc0, 0x3a, 
+  0x0d, 0x2f, 0xf2, 0x88, 0xc1, 0x88, 0xc0, 0x4a, 0x0d, 0x2f, 0xf2, 0x85, 
+  0xc1, 0x04, 0x8e, 0x23, 0x08, 0x3f, 0x01, 0x4a, 0x24, 0x40, 0x71, 0x2b, 
+  0x08, 0x7f, 0x08, 0x00, 0xf4, 0x10, 0x33, 0x08, 0xbf, 0x01, 0x80, 0xc1, 
+  0x14, 0xda, 0x76, 0x0f, 0xaf, 0xeb, 0xa1, 0x40, 0x21, 0xf0, 0xa1, 0x40, 
+  0xa8, 0x20, 0x80, 0x01, 0x04, 0x15, 0x01, 0x24, 0x04, 0x18, 0x50, 0x00, 
+  0x14, 0x10, 0x00, 0x12, 0x14, 0x10, 0x00, 0x20, 0x0c, 0xf0, 0x34, 0x00, 
+  0x61, 0x62, 0x41, 0x0a, 0x20, 0x40, 0x03, 0x18, 0x00, 0x30, 0x11, 0x02, 
+  0x04, 0x78, 0x03, 0x31, 0x24, 0x85, 0x56, 0x72, 0x00, 0x40, 0x04, 0xa5, 
+  0x18, 0xc1, 0x22, 0x00, 0x05, 0x20, 0x00, 0x91, 0x10, 0x02, 0x04, 0x04, 
+  0x1f, 0x90, 0x10, 0x15, 0x8e, 0x16, 0x00, 0x11, 0xe8, 0x14, 0x00, 0x90, 
+  0x13, 0x00, 0x24, 0x04, 0x19, 0x10, 0x00, 0x11, 0x00, 0x50, 0x02, 0x00, 
+  0x6c, 0x00, 0x20, 0x00, 0x14, 0x10, 0x00, 0x20, 0x04, 0xc2, 0xe4, 0x03, 
+  0xf0, 0x05, 0x0c, 0x70, 0x40, 0x24, 0x0d, 0x35, 0x0c, 0x19, 0x80, 0x20, 
+  0xa8, 0x20, 0x80, 0x04, 0x01, 0x4d, 0x15, 0x21, 0x03, 0x20, 0xa4, 0x02, 
+  0xf3, 0x00, 0x20, 0xa3, 0x00, 0x31, 0x81, 0x0f, 0x7a, 0xc4, 0x00, 0x00, 
+  0xf0, 0x22, 0x03, 0x20, 0x04, 0xa6, 0x02, 0x60, 0x0c, 0x18, 0x80, 0x20, 
+  0xd2, 0xc7, 0x3c, 0x05, 0xf0, 0x13, 0xa2, 0xc1, 0x08, 0x46, 0x00, 0x80, 
+  0x60, 0x44, 0x40, 0x24, 0xc3, 0x30, 0x40, 0x24, 0x05, 0x31, 0x40, 0x24, 
+  0x86, 0x30, 0x48, 0x47, 0x0a, 0x25, 0x40, 0x10, 0x22, 0x0b, 0xef, 0xf2, 
+  0x03, 0x1c, 0x03, 0x31, 0x8e, 0x05, 0xf0, 0x37, 0x40, 0x26, 0x10, 0x12, 
+  0x03, 0x14, 0x81, 0x30, 0x0f, 0x78, 0x4b, 0x09, 0x04, 0x00, 0x1f, 0x08, 
+  0x10, 0x01, 0x1f, 0x08, 0xb0, 0x00, 0x81, 0xc3, 0x23, 0x08, 0xd0, 0x00, 
+  0x2b, 0x08, 0x71, 0x00, 0x81, 0xc3, 0x04, 0x8e, 0xe1, 0x42, 0xa1, 0x41, 
+  0x0d, 0xf0, 0x15, 0x8e, 0x08, 0xf0, 0x02, 0x40, 0xa1, 0x41, 0xfe, 0x0c, 
+  0x6f, 0xf8, 0xe1, 0x42, 0x07, 0xf0, 0x14, 0x8e, 0x81, 0xc3, 0xa1, 0x41, 
+  0xe1, 0x42, 0xde, 0x0c, 0x8f, 0xf4, 0x4a, 0x00, 0xf0, 0x03, 0x04, 0x71, 
+  0x02, 0x1c, 0x02, 0x30, 0xda, 0xf1, 0x01, 0xc0, 0x41, 0x28, 0x01, 0x02, 
+  0x00, 0xad, 0x21, 0xad, 0x70, 0x05, 0xf0, 0x0d, 0xe8, 0xc3, 0xa1, 0xc1, 
+  0x60, 0x40, 0x48, 0x45, 0x28, 0x46, 0x2c, 0x70, 0x10, 0xda, 0x88, 0x47, 
+  0x62, 0x0c, 0xaf, 0xf9, 0x70, 0x40, 0xd5, 0x70, 0xcd, 0x70, 0x2b, 0xf2, 
+  0xde, 0x00, 0xf0, 0x41, 0xc3, 0x42, 0x13, 0x00, 0x90, 0x5f, 0x0c, 0x70, 
+  0xa8, 0x20, 0xc0, 0x02, 0x04, 0x12, 0x03, 0x04, 0x40, 0x24, 0x41, 0x30, 
+  0x1c, 0x61, 0x04, 0x71, 0x38, 0x23, 0x41, 0x03, 0x20, 0xac, 0x9a, 0x0c, 
+  0x6f, 0xf6, 0x40, 0x24, 0x40, 0x30, 0x06, 0xe8, 0xcd, 0x71, 0x00, 0x18, 
+  0x43, 0x20, 0x11, 0xf0, 0x13, 0x0d, 0x10, 0x1f, 0x15, 0x0d, 0xd0, 0x1e, 
+  0x17, 0x0d, 0x91, 0x1b, 0x00, 0x18, 0x83, 0x20, 0x06, 0xf0, 0x00, 0x18, 
+  0x03, 0x21, 0x04, 0xf0, 0x00, 0x18, 0xc3, 0x20, 0xcd, 0x71, 0xc0, 0xa7, 
+  0x74, 0x00, 0x18, 0xe6, 0xfc, 0x00, 0x92, 0x31, 0x40, 0x24, 0x05, 0x30, 
+  0x40, 0x24, 0x86, 0x31, 0xfc, 0x00, 0xf5, 0x24, 0x26, 0x0a, 0xef, 0xf2, 
+  0x07, 0x1c, 0x43, 0x30, 0x07, 0x14, 0x83, 0x30, 0x06, 0x14, 0x81, 0x30, 
+  0x2f, 0x78, 0x23, 0x0b, 0x04, 0x00, 0x17, 0x08, 0x51, 0x00, 0x00, 0xc0, 
+  0x41, 0x68, 0x0f, 0x0f, 0xa4, 0x10, 0xb8, 0x60, 0x96, 0x8e, 0x40, 0xc2, 
+  0x80, 0xa8, 0x24, 0x71, 0x06, 0x1c, 0x42, 0x30, 0xf0, 0xf1, 0x00, 0xd0, 
+  0x00, 0x40, 0xc6, 0xc7, 0xe0, 0x78, 0x6a, 0x05, 0xf1, 0x10, 0x9c, 0x5f, 
+  0x41, 0x81, 0x60, 0x81, 0x22, 0x81, 0x04, 0x18, 0x43, 0x00, 0x16, 0x18, 
+  0x43, 0x00, 0x14, 0x18, 0x05, 0x00, 0x43, 0xa0, 0x62, 0xa0, 0xe0, 0x7f, 
+  0x24, 0xa0, 0xe6, 0xc3, 0xa4, 0x7c, 0x00, 0x47, 0x40, 0x24, 0x83, 0x31, 
+  0x1c, 0x07, 0xf1, 0x12, 0x30, 0x40, 0x24, 0xc7, 0x31, 0x48, 0x47, 0x28, 
+  0x45, 0x4a, 0x09, 0xef, 0xf2, 0x06, 0x1c, 0x43, 0x30, 0x02, 0xc0, 0x03, 
+  0xe8, 0xc6, 0xc7, 0x06, 0x14, 0x83, 0x30, 0x07, 0x14, 0x8c, 0x30, 0x4c, 
+  0x70, 0x60, 0x03, 0xf0, 0x8c, 0xea, 0x8f, 0x7a, 0xed, 0x0b, 0x84, 0x80, 
+  0x0f, 0x0a, 0x71, 0x00, 0x00, 0xc1, 0x2a, 0x65, 0x24, 0x71, 0x40, 0xc1, 
+  0x56, 0xae, 0xf1, 0x71, 0x8a, 0x22, 0x3e, 0x06, 0xca, 0x20, 0x8d, 0x00, 
+  0x3c, 0x27, 0x42, 0x10, 0x3d, 0x27, 0x41, 0x10, 0x3c, 0x64, 0xec, 0xf1, 
+  0xe0, 0x7e, 0xe0, 0x78, 0xe6, 0xc0, 0x34, 0x10, 0x8c, 0x00, 0x55, 0x20, 
+  0xcd, 0x0c, 0x0c, 0xea, 0x0d, 0x0c, 0xd1, 0x10, 0x5c, 0x8d, 0x25, 0x0a, 
+  0xb5, 0x00, 0xe9, 0x6a, 0xed, 0x70, 0x1c, 0x1d, 0x03, 0x10, 0x0d, 0xf0, 
+  0x5c, 0x8d, 0x28, 0x15, 0x8f, 0x10, 0x44, 0x71, 0x4f, 0x7e, 0x0d, 0x0e, 
+  0xc5, 0x13, 0x48, 0x47, 0x5c, 0xad, 0x03, 0xf0, 0xfc, 0xad, 0xe9, 0x10, 
+  0x82, 0x00, 0x08, 0xe9, 0x21, 0x0a, 0xb5, 0x00, 0xcd, 0x70, 0xe9, 0x18, 
+  0x03, 0x00, 0x0f, 0xf0, 0x28, 0x15, 0x8e, 0x10, 0x21, 0x6a, 0x2f, 0x7a, 
+  0x0f, 0x0a, 0x85, 0x03, 0x28, 0x46, 0xe9, 0x18, 0x42, 0x00, 0x05, 0xf0, 
+  0xc9, 0x6a, 0xe9, 0x18, 0x82, 0x03, 0x28, 0x15, 0x8b, 0x10, 0xef, 0x79, 
+  0x31, 0x09, 0xc5, 0x02, 0x60, 0x00, 0xf1, 0x02, 0xf5, 0x10, 0x82, 0x00, 
+  0x25, 0x09, 0x85, 0x00, 0xcf, 0x79, 0xb3, 0x09, 0xc5, 0x02, 0x0f, 0x0c, 
+  0x94, 0x12, 0x00, 0xf1, 0x16, 0xa7, 0x09, 0x85, 0x00, 0x69, 0x6c, 0xa3, 
+  0x0b, 0x53, 0x00, 0x6c, 0x71, 0x34, 0x18, 0x43, 0x00, 0x53, 0xf0, 0x21, 
+  0x6c, 0x49, 0x6b, 0x2f, 0x7e, 0x4f, 0x79, 0x09, 0x23, 0x83, 0x03, 0x97, 
+  0x0c, 0x61, 0x10, 0x34, 0x18, 0xc2, 0xae, 0x06, 0xf1, 0x10, 0x40, 0x20, 
+  0x09, 0x04, 0x55, 0x20, 0x02, 0x0c, 0x0a, 0x23, 0x40, 0x12, 0xa8, 0x20, 
+  0x80, 0x02, 0x04, 0x13, 0x08, 0x14, 0x00, 0x15, 0x01, 0x10, 0x01, 0x30, 
+  0x41, 0x10, 0x04, 0x1a, 0x50, 0x24, 0x00, 0x42, 0x55, 0x20, 0x42, 0x0b, 
+  0x20, 0x00, 0x11, 0x40, 0x20, 0x00, 0x33, 0x20, 0x85, 0x02, 0x1e, 0x00, 
+  0x20, 0x20, 0x85, 0x20, 0x00, 0x83, 0x01, 0x31, 0x4b, 0x00, 0x55, 0x20, 
+  0xc1, 0x0d, 0xe8, 0x06, 0x83, 0x14, 0x01, 0x33, 0x82, 0x10, 0x04, 0x19, 
+  0x90, 0x3c, 0x00, 0x61, 0x02, 0x0d, 0x40, 0x20, 0x00, 0x04, 0x1c, 0x00, 
+  0x40, 0x10, 0x01, 0x04, 0x02, 0x38, 0x07, 0x90, 0x1a, 0x50, 0x00, 0x09, 
+  0xf0, 0x0d, 0x0b, 0xd5, 0x00, 0x86, 0x00, 0xf0, 0x07, 0x05, 0xf0, 0x6c, 
+  0x72, 0x34, 0x18, 0x83, 0x00, 0x6f, 0x78, 0x11, 0x08, 0x05, 0x03, 0x0f, 
+  0x0c, 0x90, 0x10, 0x09, 0x0c, 0xd1, 0x10, 0x2e, 0x01, 0xf0, 0x05, 0xc6, 
+  0xc4, 0x1c, 0x1d, 0x05, 0x10, 0xc6, 0xc4, 0xec, 0xc3, 0xa1, 0xc1, 0x55, 
+  0x20, 0x4f, 0x09, 0xbc, 0x80, 0x83, 0x87, 0x54, 0x00, 0x80, 0x08, 0x46, 
+  0x20, 0x40, 0x70, 0x41, 0x50, 0x40, 0x98, 0x02, 0x30, 0x0a, 0x22, 0x00, 
+  0x84, 0x03, 0x11, 0x02, 0xc4, 0x03, 0xf0, 0x00, 0x32, 0x00, 0x83, 0x6f, 
+  0x22, 0x0b, 0x00, 0x01, 0x19, 0x92, 0x00, 0x9e, 0x08, 0x2f, 0xf4, 0xa6, 
+  0x02, 0x62, 0x33, 0xe8, 0x64, 0x87, 0xbd, 0x86, 0xb4, 0x03, 0xf0, 0x09, 
+  0x0a, 0x21, 0x80, 0x04, 0xa8, 0x20, 0x40, 0x03, 0x04, 0x11, 0x0b, 0x04, 
+  0x40, 0x24, 0x42, 0x30, 0x1c, 0x62, 0x04, 0x33, 0xc0, 0x90, 0x04, 0x71, 
+  0x34, 0x00, 0x33, 0x40, 0xac, 0x6e, 0x32, 0x00, 0x51, 0x1b, 0xe8, 0x45, 
+  0x87, 0xbe, 0x32, 0x00, 0x00, 0x00, 0x02, 0x01, 0x30, 0x00, 0x30, 0x12, 
+  0x0c, 0x24, 0x6c, 0x00, 0x50, 0x1b, 0x61, 0x04, 0x34, 0x80, 0x30, 0x00, 
+  0x63, 0x21, 0x0b, 0x00, 0x20, 0xab, 0x3e, 0x30, 0x00, 0xf0, 0x19, 0x03, 
+  0xe8, 0xbf, 0x86, 0x01, 0x87, 0x36, 0x87, 0x7d, 0x86, 0x02, 0x35, 0x0b, 
+  0x10, 0x57, 0x87, 0x00, 0x31, 0xc1, 0x02, 0x9c, 0x86, 0x01, 0x30, 0x41, 
+  0x00, 0x00, 0x32, 0xc0, 0x00, 0x04, 0x35, 0x40, 0x90, 0x21, 0xa7, 0xca, 
+  0x21, 0x45, 0x03, 0xc4, 0x07, 0xb1, 0x89, 0x43, 0xd0, 0xf6, 0xbe, 0x86, 
+  0x68, 0x43, 0x00, 0x32, 0x40, 0x10, 0x00, 0x61, 0xca, 0xf6, 0x7f, 0x86, 
+  0xa9, 0x43, 0x28, 0x00, 0xf0, 0x0a, 0x31, 0x00, 0x80, 0xc2, 0xf6, 0x68, 
+  0x43, 0x02, 0x87, 0x7f, 0xdb, 0x17, 0xbb, 0x07, 0x30, 0x00, 0x03, 0x07, 
+  0x33, 0x01, 0x03, 0x01, 0x30, 0xc0, 0x00, 0x4a, 0x06, 0xf0, 0x17, 0xca, 
+  0x21, 0x05, 0x00, 0x07, 0x33, 0x42, 0x00, 0x61, 0x40, 0x20, 0xa7, 0x04, 
+  0x32, 0xc0, 0x82, 0xca, 0x20, 0x89, 0x00, 0x00, 0x18, 0x00, 0x20, 0x02, 
+  0x87, 0x01, 0x33, 0x00, 0x10, 0x04, 0x30, 0xc0, 0x80, 0xca, 0x20, 0xc9, 
+  0x00, 0x08, 0x00, 0xf1, 0x11, 0x02, 0xa7, 0x05, 0xf4, 0x00, 0x19, 0xc3, 
+  0x20, 0xcc, 0xc7, 0x04, 0x30, 0x80, 0x8f, 0x00, 0x3f, 0x00, 0x00, 0x45, 
+  0xf6, 0x00, 0x19, 0x43, 0x20, 0xcc, 0xc7, 0x00, 0x19, 0x83, 0x20, 0xcc, 
+  0xc7, 0x7c, 0x06, 0x61, 0x38, 0x50, 0x41, 0x08, 0x45, 0x88, 0x7c, 0x06, 
+  0xc3, 0x22, 0x0a, 0xaf, 0xeb, 0x28, 0x46, 0x00, 0x85, 0x40, 0x24, 0x83, 
+  0x30, 0x1c, 0x03, 0xf1, 0x65, 0x37, 0x40, 0x24, 0x06, 0x31, 0x40, 0x24, 
+  0xc7, 0x30, 0xc1, 0x41, 0x22, 0x42, 0x2e, 0x0e, 0xaf, 0xf2, 0x02, 0x1c, 
+  0x03, 0x33, 0x02, 0xc6, 0x04, 0xee, 0xc1, 0x40, 0xca, 0xc7, 0x03, 0x14, 
+  0x8f, 0x30, 0x55, 0x25, 0x10, 0x18, 0xcd, 0x70, 0x0c, 0x70, 0xf8, 0xe8, 
+  0x02, 0x14, 0x81, 0x30, 0xef, 0x78, 0xe9, 0x09, 0x24, 0x80, 0x04, 0x77, 
+  0xc3, 0x08, 0x15, 0x03, 0x25, 0x20, 0x00, 0x00, 0x0d, 0xf0, 0x12, 0xf0, 
+  0x18, 0xf0, 0x1c, 0xf0, 0x22, 0xf0, 0x26, 0xf0, 0x2c, 0xf0, 0x30, 0xf0, 
+  0x3b, 0xf0, 0x40, 0xf0, 0x47, 0xf0, 0x4c, 0xf0, 0x88, 0xc0, 0x46, 0x0d, 
+  0xef, 0xf5, 0x81, 0xc1, 0x90, 0x1d, 0x04, 0x10, 0x4b, 0xf0, 0x88, 0xc0, 
+  0x32, 0x0e, 0xef, 0xf6, 0x81, 0xc1, 0x0c, 0xa5, 0x45, 0xf0, 0x88, 0xc0, 
+  0x26, 0x0c, 0x00, 0x71, 0x14, 0xa5, 0x3f, 0xf0, 0x88, 0xc0, 0x1a, 0x0c, 
+  0x00, 0x71, 0x15, 0xa5, 0x39, 0xf0, 0x88, 0xc0, 0x0e, 0x0c, 0x00, 0x71, 
+  0x18, 0xa5, 0x33, 0xf0, 0x88, 0xc0, 0x02, 0x0c, 0x00, 0x80, 0x19, 0xa5, 
+  0x2d, 0xf0, 0x88, 0xc0, 0xf6, 0x0d, 0x0c, 0x00, 0xf1, 0x0e, 0x1a, 0xa5, 
+  0x27, 0xf0, 0x88, 0xc0, 0x81, 0xc1, 0x2e, 0x0b, 0x6f, 0xfb, 0x83, 0xc2, 
+  0x83, 0xc1, 0x10, 0xda, 0x56, 0x09, 0xaf, 0xeb, 0x02, 0x40, 0x1b, 0xf0, 
+  0x88, 0xc0, 0xd2, 0x22, 0x00, 0xf1, 0x08, 0xac, 0x1d, 0x00, 0x10, 0x15, 
+  0xf0, 0x88, 0xc0, 0xc2, 0x0f, 0x6f, 0xf4, 0x81, 0xc1, 0x6d, 0x1d, 0x02, 
+  0x10, 0x0d, 0xf0, 0x88, 0xc0, 0xb6, 0x1c, 0x00, 0x91, 0xcc, 0x1d, 0x00, 
+  0x10, 0x07, 0xf0, 0x88, 0xc0, 0xaa, 0x0e, 0x00, 0x31, 0x0b, 0xa5, 0x01, 
+  0xf4, 0x06, 0xf0, 0x61, 0x32, 0x70, 0xca, 0x26, 0x4d, 0x10, 0x2c, 0x71, 
+  0x3c, 0x21, 0x00, 0x20, 0x06, 0x79, 0x3f, 0x67, 0x8e, 0xf1, 0xe0, 0x78, 
+  0xee, 0xc3, 0xad, 0xc1, 0xa8, 0x47, 0x0a, 0x20, 0x00, 0x21, 0x30, 0x41, 
+  0x08, 0x46, 0x2f, 0x26, 0x85, 0xf0, 0x12, 0x00, 0x23, 0x00, 0x00, 0x1d, 
+  0x03, 0x00, 0x0c, 0x71, 0x46, 0x78, 0x36, 0x1e, 0x02, 0x10, 0x2f, 0x26, 
+  0xc5, 0xf0, 0x0e, 0x00, 0x23, 0x00, 0x0c, 0x71, 0x66, 0x78, 0x35, 0x1e, 
+  0x02, 0x10, 0x78, 0x4e, 0x40, 0x24, 0xc2, 0x32, 0x8a, 0xc3, 0x22, 0x0f, 
+  0x6f, 0xfe, 0x22, 0x41, 0x36, 0x16, 0x80, 0x10, 0x08, 0xe8, 0x35, 0x16, 
+  0x80, 0x10, 0x06, 0xe8, 0x0b, 0x14, 0x80, 0x30, 0x6e, 0x70, 0x03, 0xe8, 
+  0x6e, 0x71, 0x40, 0x26, 0x0d, 0x17, 0x87, 0xc1, 0x84, 0x06, 0x81, 0x76, 
+  0x0c, 0xef, 0xf5, 0x40, 0x24, 0x12, 0x37, 0x90, 0x03, 0x32, 0x24, 0x41, 
+  0x36, 0x74, 0x02, 0xf8, 0x33, 0x02, 0x24, 0x0c, 0x70, 0x04, 0x32, 0x80, 
+  0x8f, 0x00, 0x47, 0x00, 0x00, 0xca, 0x20, 0x69, 0x00, 0x01, 0x19, 0x12, 
+  0x00, 0x4e, 0x0f, 0xef, 0xf3, 0x40, 0x24, 0x40, 0x36, 0x08, 0xe8, 0x0c, 
+  0x70, 0x02, 0xa5, 0x01, 0xa5, 0x00, 0xa5, 0x34, 0x1e, 0x02, 0x10, 0x76, 
+  0x70, 0x04, 0x02, 0x22, 0x00, 0x8a, 0xc1, 0x81, 0xc2, 0x40, 0x24, 0x83, 
+  0x32, 0xc1, 0x40, 0xd2, 0x0c, 0xef, 0xff, 0x40, 0x24, 0x12, 0x3a, 0xc4, 
+  0x02, 0xf0, 0x02, 0x15, 0x26, 0x01, 0x10, 0xf0, 0x21, 0x03, 0x20, 0x21, 
+  0x81, 0x15, 0x22, 0x02, 0x20, 0x04, 0x71, 0x02, 0x9a, 0x06, 0x30, 0xa2, 
+  0x01, 0xc4, 0x24, 0x00, 0x42, 0x04, 0x6e, 0x8a, 0xc2, 0xec, 0x05, 0x80, 
+  0x01, 0x04, 0x60, 0x80, 0x00, 0x34, 0x41, 0x10, 0xb8, 0x06, 0x00, 0x4a, 
+  0x07, 0xf0, 0x05, 0x2a, 0x16, 0x80, 0x10, 0x54, 0x96, 0x04, 0x71, 0x0f, 
+  0x79, 0x30, 0x72, 0xa0, 0x01, 0x2d, 0x00, 0x2a, 0x1e, 0x02, 0x10, 0x32, 
+  0x00, 0xf0, 0x15, 0x2c, 0x70, 0x2a, 0x1e, 0x03, 0x10, 0xa8, 0x20, 0x00, 
+  0x03, 0x15, 0x26, 0x40, 0x10, 0x44, 0x80, 0x01, 0x80, 0x8a, 0xc3, 0x35, 
+  0x7b, 0x02, 0x30, 0x80, 0x00, 0x24, 0x71, 0x00, 0xa3, 0x8a, 0xc0, 0x87, 
+  0xc1, 0xa2, 0x0b, 0xd4, 0x00, 0x60, 0x11, 0x37, 0x3f, 0x86, 0x01, 0xc0, 
+  0x32, 0x00, 0xf0, 0x04, 0x4c, 0x70, 0x07, 0x30, 0x41, 0x00, 0x0c, 0x86, 
+  0x02, 0x1c, 0x82, 0x30, 0x03, 0x1c, 0x82, 0x30, 0x00, 0x31, 0x0c, 0x58, 
+  0x07, 0x50, 0x03, 0x04, 0x11, 0x03, 0x24, 0x4e, 0x07, 0xf2, 0x03, 0x41, 
+  0x36, 0x04, 0x33, 0x00, 0x83, 0x59, 0x61, 0x44, 0x71, 0xca, 0x20, 0x6a, 
+  0x00, 0x00, 0xa9, 0x62, 0x0e, 0xea, 0x00, 0xf1, 0x0c, 0xbb, 0x08, 0x30, 
+  0x00, 0x4c, 0x70, 0xb0, 0x16, 0x00, 0x10, 0x7f, 0xdc, 0x17, 0xbc, 0x01, 
+  0x30, 0x01, 0x03, 0x2c, 0x16, 0x0b, 0x10, 0xc3, 0x40, 0x20, 0x41, 0x00, 
+  0x60, 0x04, 0x01, 0x46, 0x03, 0xb1, 0x20, 0x45, 0x00, 0x40, 0x24, 0x08, 
+  0x37, 0xb0, 0x1e, 0x00, 0x10, 0x54, 0x00, 0xf2, 0x1c, 0x10, 0x09, 0x14, 
+  0x2c, 0x70, 0x40, 0x24, 0x43, 0x36, 0x04, 0x31, 0xc0, 0x92, 0x5b, 0x63, 
+  0x44, 0x71, 0xca, 0x21, 0x69, 0x00, 0x20, 0xab, 0x07, 0x34, 0x11, 0x10, 
+  0xc3, 0x40, 0xcc, 0x3e, 0xcd, 0xcc, 0x04, 0x31, 0x00, 0xa0, 0xca, 0x21, 
+  0x05, 0x20, 0xfe, 0x0d, 0x66, 0x00, 0xb1, 0x8a, 0xc2, 0x2b, 0xe8, 0xc6, 
+  0x0e, 0xa0, 0x03, 0x8a, 0xc0, 0x6b, 0xfa, 0x03, 0x61, 0x83, 0xc4, 0x87, 
+  0xc2, 0x83, 0xc1, 0x58, 0x04, 0x50, 0x12, 0x00, 0x04, 0x04, 0x33, 0x64, 
+  0x00, 0x20, 0xc5, 0x00, 0x00, 0x08, 0x06, 0x54, 0x01, 0xf0, 0x15, 0x00, 
+  0x04, 0x8a, 0xc1, 0x01, 0x49, 0x03, 0x4c, 0x15, 0x26, 0x02, 0x10, 0x00, 
+  0x31, 0x4b, 0x20, 0x24, 0x82, 0x00, 0x33, 0xc3, 0x10, 0x04, 0x71, 0x01, 
+  0x31, 0xc1, 0x00, 0x24, 0xa2, 0x11, 0xf0, 0x2c, 0x70, 0x25, 0xf0, 0x2e, 
+  0x00, 0x27, 0x28, 0x4e, 0x5c, 0x01, 0x34, 0x31, 0x41, 0x20, 0x5c, 0x01, 
+  0xe1, 0x40, 0x24, 0x81, 0x30, 0x40, 0x24, 0xc2, 0x30, 0x92, 0x0c, 0x20, 
+  0x00, 0xc1, 0x40, 0xfc, 0x01, 0x70, 0x26, 0x00, 0x14, 0xa8, 0x20, 0x40, 
+  0x01, 0x28, 0x05, 0x60, 0x22, 0xa0, 0x03, 0x14, 0x82, 0x30, 0x60, 0x03, 
+  0xf0, 0x13, 0x80, 0xd8, 0x00, 0xaf, 0x0a, 0x14, 0x83, 0x30, 0x34, 0x16, 
+  0x91, 0x10, 0xa6, 0x09, 0xef, 0xff, 0xc1, 0x40, 0x34, 0x16, 0x80, 0x10, 
+  0x0d, 0x09, 0x00, 0x20, 0x00, 0x8f, 0x87, 0xb8, 0x00, 0x1f, 0x02, 0x10, 
+  0x8c, 0x01, 0x00, 0x40, 0x00, 0xc0, 0xa8, 0x20, 0x80, 0x01, 0x04, 0x15, 
+  0x00, 0x14, 0x04, 0x18, 0x10, 0x20, 0x24, 0x00, 0x31, 0x48, 0x30, 0x00, 
+  0x26, 0x04, 0x11, 0xce, 0xf4, 0x07, 0x07, 0x80, 0x07, 0x92, 0x30, 0x40, 
+  0x24, 0x05, 0x31, 0x40, 0x24, 0x86, 0x30, 0x80, 0x07, 0x50, 0xa6, 0x0a, 
+  0xaf, 0xf2, 0x03, 0xe4, 0x03, 0xf3, 0x05, 0x14, 0x80, 0x30, 0x55, 0x26, 
+  0x10, 0x18, 0x03, 0x14, 0x81, 0x30, 0x0f, 0x78, 0x93, 0x09, 0x24, 0x00, 
+  0x04, 0x77, 0x7f, 0xd6, 0x03, 0xf0, 0x49, 0x0c, 0xf0, 0x14, 0xf0, 0x14, 
+  0xf0, 0x16, 0xf0, 0x16, 0xf0, 0x18, 0xf0, 0x18, 0xf0, 0x1a, 0xf0, 0x1f, 
+  0xf0, 0x22, 0xf0, 0x28, 0xf0, 0x2b, 0xf0, 0x90, 0x16, 0x00, 0x11, 0x81, 
+  0xc3, 0xa1, 0x41, 0x7e, 0x09, 0xef, 0xf5, 0xe1, 0x42, 0x29, 0xf0, 0x0c, 
+  0x86, 0x22, 0xf0, 0x14, 0x86, 0x20, 0xf0, 0x15, 0x86, 0x1e, 0xf0, 0x18, 
+  0x86, 0x1c, 0xf0, 0x19, 0x86, 0x1a, 0xf0, 0x1a, 0x86, 0x18, 0xf0, 0x81, 
+  0xc3, 0x02, 0x40, 0xa1, 0x41, 0xa2, 0x0f, 0x2f, 0xfb, 0xe1, 0x42, 0x15, 
+  0xf0, 0xac, 0x16, 0x00, 0x10, 0x0e, 0xf0, 0x6d, 0x16, 0x80, 0x10, 0x3c, 
+  0x00, 0xf1, 0x01, 0x2e, 0x0c, 0x6f, 0xf4, 0xe1, 0x42, 0x0b, 0xf0, 0xcc, 
+  0x16, 0x00, 0x10, 0x02, 0xf0, 0x0b, 0x86, 0x14, 0x00, 0x50, 0x0a, 0xef, 
+  0xf6, 0xe1, 0x42, 0x92, 0x00, 0x95, 0x04, 0x71, 0x02, 0x1c, 0x02, 0x30, 
+  0xb6, 0xf1, 0x01, 0xf4, 0x07, 0x11, 0xc8, 0xd0, 0x00, 0xf0, 0x16, 0xa1, 
+  0xc1, 0x50, 0x40, 0x28, 0x45, 0x2c, 0x70, 0x10, 0xda, 0x60, 0x40, 0x88, 
+  0x46, 0x9e, 0x0b, 0x6f, 0xf9, 0x68, 0x47, 0xb5, 0x70, 0xad, 0x70, 0x2f, 
+  0xf4, 0x4a, 0x24, 0x00, 0x71, 0xc3, 0x42, 0x13, 0x00, 0xa8, 0x5f, 0x0c, 
+  0x14, 0x01, 0xf0, 0x3e, 0x02, 0x04, 0x12, 0x03, 0x04, 0x80, 0xc1, 0x1c, 
+  0x61, 0x04, 0x71, 0x38, 0x23, 0x01, 0x04, 0x20, 0xac, 0xa6, 0x0e, 0xaf, 
+  0xf4, 0x80, 0xc0, 0x1b, 0xe8, 0x0c, 0xdd, 0x0b, 0x1f, 0xc3, 0x13, 0x0a, 
+  0x1f, 0x83, 0x13, 0x09, 0x1f, 0x43, 0x13, 0x08, 0x1f, 0x03, 0x13, 0x07, 
+  0x1f, 0xc3, 0x12, 0x06, 0x1f, 0x83, 0x12, 0x05, 0x1f, 0x43, 0x12, 0x04, 
+  0x1f, 0x03, 0x12, 0x03, 0x1f, 0xc3, 0x11, 0x02, 0x1f, 0x03, 0x11, 0x01, 
+  0x1f, 0x83, 0x10, 0x00, 0x1f, 0x43, 0x10, 0xa0, 0xa6, 0x7c, 0x00, 0x10, 
+  0xf2, 0x4c, 0x01, 0x10, 0x45, 0x6a, 0x01, 0x0b, 0x4e, 0x01, 0x50, 0x46, 
+  0x30, 0x45, 0x5a, 0x09, 0x4c, 0x01, 0x11, 0xc3, 0x4c, 0x01, 0xf2, 0x09, 
+  0x40, 0x25, 0x10, 0x13, 0x55, 0x25, 0x11, 0x1b, 0x55, 0x25, 0xd2, 0x1b, 
+  0x55, 0x25, 0xd3, 0x1c, 0x55, 0x25, 0x94, 0x1d, 0x40, 0x25, 0x0f, 0x16, 
+  0x60, 0x01, 0x11, 0xaf, 0x60, 0x01, 0x31, 0x9b, 0x08, 0xd5, 0x60, 0x01, 
+  0xf1, 0x00, 0x0f, 0xf0, 0x12, 0xf0, 0x13, 0xf0, 0x16, 0xf0, 0x17, 0xf0, 
+  0x1a, 0xf0, 0x1b, 0xf0, 0x1e, 0x60, 0x01, 0xf1, 0x24, 0x23, 0xf0, 0x26, 
+  0xf0, 0x2b, 0xf0, 0x2e, 0xf0, 0x34, 0xf0, 0x81, 0xc3, 0xe1, 0x40, 0x22, 
+  0xf0, 0x30, 0x15, 0x80, 0x10, 0x28, 0xf0, 0x26, 0x15, 0x80, 0x10, 0x26, 
+  0xf0, 0x81, 0xc3, 0xa1, 0x40, 0x18, 0xf0, 0x31, 0x15, 0x80, 0x10, 0x20, 
+  0xf0, 0x32, 0x15, 0x80, 0x10, 0x1c, 0xf0, 0x98, 0x15, 0x00, 0x10, 0x22, 
+  0x68, 0x01, 0xf0, 0x1b, 0x0c, 0xf0, 0x81, 0xc3, 0x22, 0x40, 0x0a, 0xf0, 
+  0x81, 0xc3, 0x42, 0x40, 0x06, 0xf0, 0x81, 0xc3, 0x62, 0x40, 0x04, 0xf0, 
+  0x81, 0xc3, 0x82, 0x40, 0xa2, 0x41, 0x46, 0x0b, 0xef, 0xf6, 0xc1, 0x42, 
+  0x13, 0xf0, 0xe4, 0x15, 0x80, 0x10, 0x04, 0xf0, 0xe5, 0x15, 0x80, 0x01, 
+  0xd1, 0xa2, 0x41, 0xae, 0x0a, 0x6f, 0xf4, 0xc1, 0x42, 0x09, 0xf0, 0xac, 
+  0x15, 0x00, 0x10, 0x00, 0x20, 0xb2, 0x08, 0x26, 0x00, 0x06, 0x7c, 0x01, 
+  0x14, 0xa8, 0x7c, 0x01, 0xf0, 0x01, 0x1d, 0x02, 0x20, 0x01, 0x1d, 0x42, 
+  0x20, 0xd2, 0xc7, 0xe0, 0x78, 0xf9, 0x03, 0x00, 0x02, 0xf0, 0x4c, 0x06, 
+  0x61, 0x37, 0x50, 0x44, 0x08, 0x45, 0x87, 0x4c, 0x06, 0x34, 0xd6, 0x0b, 
+  0x6f, 0x4c, 0x06, 0xf0, 0x21, 0x33, 0x40, 0x24, 0x04, 0x35, 0x40, 0x24, 
+  0x05, 0x36, 0x40, 0x24, 0x06, 0x34, 0x40, 0x24, 0xc7, 0x33, 0xc1, 0x41, 
+  0x82, 0x42, 0xe2, 0x0f, 0x6f, 0xf2, 0x0e, 0x1c, 0xc3, 0x33, 0x14, 0x14, 
+  0x11, 0x30, 0x0d, 0x09, 0x30, 0x20, 0x55, 0x25, 0x4f, 0x1b, 0x22, 0x40, 
+  0xd0, 0xc7, 0x0f, 0x14, 0x8e, 0x54, 0x06, 0xf1, 0x07, 0x1c, 0x55, 0x25, 
+  0x12, 0x1d, 0x55, 0x25, 0xd3, 0x1d, 0x2e, 0x70, 0x0c, 0x70, 0xf4, 0xe8, 
+  0x0e, 0x14, 0x81, 0x30, 0xcf, 0x78, 0xe1, 0x5c, 0x06, 0x62, 0x8e, 0xe0, 
+  0x4e, 0x01, 0x0d, 0x00, 0x28, 0x01, 0xf1, 0x36, 0x1b, 0xf0, 0x20, 0xf0, 
+  0x27, 0xf0, 0x31, 0xf0, 0x38, 0xf0, 0x3d, 0xf0, 0x44, 0xf0, 0x4e, 0xf0, 
+  0x5a, 0xf0, 0x67, 0xf0, 0x76, 0xf0, 0x83, 0xf0, 0x8a, 0xf0, 0x8f, 0xf0, 
+  0x87, 0xc0, 0x84, 0xc1, 0x46, 0x0a, 0xef, 0xf6, 0x80, 0xc2, 0x00, 0xc2, 
+  0x01, 0xc1, 0x02, 0xc0, 0x47, 0xa5, 0x28, 0xa5, 0x09, 0xa5, 0x89, 0xf0, 
+  0x87, 0xc0, 0xbe, 0x09, 0x6f, 0xf4, 0x84, 0xc1, 0x34, 0x1d, 0x02, 0x10, 
+  0x83, 0xf0, 0x87, 0xc0, 0xb2, 0x0e, 0x00, 0x51, 0x2a, 0x1d, 0x02, 0x10, 
+  0x7b, 0x34, 0x00, 0x17, 0x12, 0x34, 0x00, 0xb1, 0x41, 0xa5, 0x22, 0xa5, 
+  0x03, 0xa5, 0x6f, 0xf0, 0x87, 0xc0, 0x8a, 0x26, 0x00, 0x91, 0x35, 0x1d, 
+  0x02, 0x10, 0x69, 0xf0, 0x87, 0xc0, 0x7e, 0x0e, 0x00, 0xf1, 0x04, 0x36, 
+  0x1d, 0x02, 0x10, 0x61, 0xf0, 0x87, 0xc0, 0x72, 0x0f, 0xaf, 0xf6, 0x84, 
+  0xc1, 0x9c, 0x1d, 0x00, 0x10, 0x5b, 0x42, 0x00, 0x26, 0xce, 0x09, 0x42, 
+  0x00, 0x71, 0x44, 0xa5, 0x25, 0xa5, 0x06, 0xa5, 0x4f, 0x18, 0x00, 0x17, 
+  0xb6, 0x18, 0x00, 0x71, 0x40, 0xa7, 0x21, 0xa7, 0x02, 0xa7, 0x43, 0x18, 
+  0x00, 0x17, 0x9e, 0x18, 0x00, 0xd1, 0x00, 0x18, 0x80, 0x20, 0x04, 0x18, 
+  0x40, 0x20, 0x08, 0x18, 0x00, 0x20, 0x33, 0x1e, 0x00, 0x18, 0x82, 0x1e, 
+  0x00, 0xc1, 0x1a, 0x80, 0x20, 0x04, 0x1a, 0x40, 0x20, 0x08, 0x1a, 0x00, 
+  0x20, 0x25, 0x1e, 0x00, 0x18, 0x62, 0x1e, 0x00, 0xf0, 0x02, 0x1b, 0x80, 
+  0x20, 0x04, 0x1b, 0x40, 0x20, 0x08, 0x1b, 0x00, 0x20, 0x15, 0xf0, 0x87, 
+  0xc0, 0xd6, 0x08, 0xa6, 0x00, 0x91, 0xe8, 0x1d, 0x02, 0x10, 0x0f, 0xf0, 
+  0x87, 0xc0, 0xca, 0x0e, 0x00, 0x50, 0xe9, 0x1d, 0x02, 0x10, 0x07, 0x04, 
+  0x01, 0x10, 0x0e, 0xb4, 0x00, 0x51, 0xb0, 0x1d, 0x00, 0x10, 0x04, 0xec, 
+  0x06, 0xa0, 0x92, 0x70, 0xca, 0x21, 0x4d, 0x20, 0x2c, 0x71, 0x3c, 0x24, 
+  0xec, 0x06, 0xf0, 0x6d, 0x3e, 0x66, 0x46, 0xf1, 0xe0, 0x78, 0xe6, 0xc0, 
+  0x48, 0x43, 0x08, 0x41, 0x55, 0x20, 0xc2, 0x0c, 0x0c, 0x70, 0x4a, 0x26, 
+  0x00, 0x00, 0x00, 0x1b, 0x02, 0x10, 0x5d, 0x0e, 0xf5, 0x00, 0x15, 0x21, 
+  0x8d, 0x11, 0x55, 0x25, 0x4c, 0x1b, 0x64, 0x85, 0xc3, 0x84, 0x55, 0x25, 
+  0x0f, 0x1c, 0x04, 0x33, 0x80, 0x83, 0xc9, 0xf6, 0x60, 0xa7, 0xa0, 0x82, 
+  0x01, 0x35, 0x48, 0x13, 0x02, 0x33, 0x03, 0x02, 0x60, 0xa4, 0x0c, 0xf0, 
+  0xa0, 0x84, 0x04, 0x33, 0x40, 0x83, 0x4b, 0xf7, 0x60, 0xa4, 0x80, 0x82, 
+  0x01, 0x34, 0x0c, 0x13, 0x01, 0x33, 0x03, 0x03, 0x60, 0xa7, 0x00, 0x1b, 
+  0x43, 0x10, 0x0a, 0xf0, 0x60, 0x82, 0x01, 0x33, 0xc3, 0x00, 0x01, 0x36, 
+  0xce, 0x10, 0x02, 0x35, 0xc3, 0x10, 0xca, 0xa4, 0x67, 0xa4, 0xc4, 0x71, 
+  0xd4, 0xf1, 0x00, 0x19, 0x02, 0x00, 0x55, 0x08, 0x60, 0x00, 0xf0, 0x2f, 
+  0x03, 0x10, 0x55, 0x23, 0x0e, 0x0d, 0xa4, 0x83, 0x83, 0x86, 0x04, 0x35, 
+  0x00, 0x93, 0x55, 0x23, 0xcc, 0x0d, 0xcd, 0xf6, 0xe0, 0x82, 0xa0, 0xa4, 
+  0x00, 0x37, 0x8b, 0x1f, 0x80, 0xc0, 0x00, 0x00, 0x01, 0x35, 0xcf, 0x12, 
+  0xe0, 0xa6, 0x00, 0x19, 0x43, 0x00, 0xa4, 0x83, 0x60, 0x86, 0x04, 0x35, 
+  0xc0, 0x90, 0x4c, 0xf7, 0x60, 0x82, 0xa0, 0xa6, 0x00, 0x33, 0x83, 0x0f, 
+  0x80, 0x40, 0x20, 0x00, 0x40, 0xc3, 0x10, 0x60, 0xa4, 0x20, 0x00, 0xf1, 
+  0x4b, 0x04, 0x71, 0xd8, 0xf1, 0xc6, 0xc4, 0xe0, 0x78, 0xec, 0xc3, 0xa7, 
+  0xc1, 0x48, 0x31, 0x01, 0x00, 0x07, 0x36, 0x52, 0x70, 0x48, 0x47, 0x00, 
+  0x00, 0x08, 0x46, 0x18, 0x80, 0xd3, 0x40, 0x80, 0x3f, 0x00, 0x00, 0xcb, 
+  0x45, 0xc8, 0x41, 0x00, 0x00, 0x02, 0x30, 0x00, 0x20, 0x55, 0x26, 0x0f, 
+  0x19, 0x7a, 0x09, 0x6f, 0xfd, 0x07, 0x35, 0x91, 0x14, 0xea, 0x0f, 0x2f, 
+  0xfd, 0x00, 0x31, 0x00, 0x20, 0x04, 0x31, 0x00, 0xa4, 0x22, 0x41, 0xca, 
+  0x21, 0x09, 0x04, 0x2f, 0x36, 0x40, 0x00, 0x20, 0x97, 0x50, 0x20, 0xc2, 
+  0x25, 0x2d, 0x70, 0x07, 0x32, 0x4b, 0x23, 0x4e, 0x00, 0xf1, 0x22, 0x35, 
+  0x43, 0x10, 0x02, 0x30, 0x0c, 0x20, 0x00, 0x36, 0x40, 0x00, 0x40, 0x41, 
+  0x00, 0x33, 0x00, 0x10, 0x97, 0xa6, 0x04, 0x30, 0x40, 0x82, 0xca, 0x21, 
+  0x8c, 0x0f, 0x00, 0xbf, 0x00, 0x00, 0x01, 0x30, 0x40, 0x00, 0x04, 0x33, 
+  0x40, 0x82, 0x48, 0x30, 0xc1, 0x02, 0x34, 0xb6, 0x04, 0xf6, 0xc3, 0x42, 
+  0x16, 0x00, 0xf0, 0x0a, 0x33, 0x80, 0x00, 0x30, 0x7c, 0x48, 0x30, 0xc0, 
+  0x02, 0x10, 0x78, 0x48, 0x30, 0x02, 0x00, 0x07, 0x36, 0x88, 0x70, 0x00, 
+  0x41, 0x00, 0x00, 0xc3, 0x43, 0x1e, 0x00, 0xf0, 0x1b, 0x48, 0x34, 0x80, 
+  0x10, 0x07, 0x32, 0x01, 0x20, 0x02, 0x30, 0x80, 0x21, 0x00, 0x30, 0xc0, 
+  0x00, 0x01, 0x30, 0x0b, 0x04, 0x00, 0x33, 0x00, 0x12, 0x00, 0x30, 0x41, 
+  0x00, 0x04, 0x31, 0x40, 0x82, 0xc4, 0xf6, 0x3f, 0xdb, 0x18, 0xbb, 0x07, 
+  0x36, 0x82, 0x70, 0xea, 0x00, 0xf1, 0x1d, 0x48, 0x34, 0x00, 0x10, 0x07, 
+  0x32, 0x0c, 0x20, 0x01, 0x31, 0xc3, 0x00, 0x00, 0x33, 0x80, 0x10, 0x4c, 
+  0x70, 0x00, 0x30, 0x01, 0x03, 0x48, 0x33, 0xc0, 0x02, 0x04, 0x31, 0x80, 
+  0x80, 0x64, 0x1f, 0x02, 0x10, 0xc5, 0xf6, 0x3f, 0xd8, 0x18, 0xb8, 0x04, 
+  0xf0, 0xc3, 0x40, 0x7c, 0x00, 0x30, 0x31, 0x00, 0x00, 0x7a, 0x00, 0x20, 
+  0xf5, 0x1e, 0xaa, 0x06, 0xa0, 0x80, 0x2f, 0x24, 0xbd, 0xca, 0xa5, 0xfe, 
+  0x0e, 0x0f, 0xfd, 0x28, 0x05, 0x00, 0x04, 0x01, 0x71, 0x2c, 0x70, 0x17, 
+  0xa7, 0xa8, 0x20, 0x40, 0xcc, 0x07, 0xa0, 0x80, 0x10, 0x00, 0x00, 0x83, 
+  0xc5, 0x15, 0x25, 0x42, 0x10, 0x1a, 0x00, 0xa0, 0x24, 0x71, 0x00, 0xa2, 
+  0x42, 0x0a, 0x60, 0x02, 0x83, 0xc0, 0x2c, 0x00, 0x61, 0xa8, 0x20, 0xc0, 
+  0x01, 0x00, 0x85, 0x22, 0x01, 0xd0, 0x1d, 0x10, 0x10, 0x83, 0xc0, 0x0a, 
+  0x0a, 0x60, 0x02, 0x40, 0x24, 0x0d, 0x33, 0x1c, 0x00, 0xf0, 0x01, 0x54, 
+  0x26, 0x00, 0x1e, 0xa8, 0x20, 0x00, 0x02, 0x04, 0x15, 0x01, 0x14, 0x02, 
+  0x30, 0x41, 0x20, 0xe2, 0x06, 0x80, 0x1f, 0x86, 0x5d, 0x86, 0x3e, 0x86, 
+  0x87, 0x87, 0x9c, 0x06, 0xc1, 0x55, 0x26, 0x03, 0x1a, 0x42, 0xc0, 0x80, 
+  0xc0, 0x40, 0xc2, 0x41, 0xc1, 0x28, 0x00, 0xe1, 0x10, 0x01, 0x04, 0x07, 
+  0x34, 0x41, 0x10, 0x04, 0x1b, 0x50, 0x00, 0x36, 0x1e, 0x43, 0xc4, 0x06, 
+  0xf1, 0x5c, 0x35, 0x1e, 0x43, 0x10, 0xcc, 0xc7, 0xe0, 0x78, 0xe4, 0xc2, 
+  0x08, 0x45, 0x5f, 0x20, 0x02, 0x0f, 0xc3, 0x40, 0xa0, 0x00, 0x70, 0x4c, 
+  0xc3, 0x41, 0xf0, 0x00, 0x2c, 0x01, 0x5e, 0x60, 0x00, 0x19, 0x41, 0x00, 
+  0x67, 0x86, 0x1c, 0xeb, 0x00, 0x22, 0x82, 0x0f, 0xa0, 0x00, 0xa9, 0x4c, 
+  0xc3, 0x40, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x00, 0xb5, 0x78, 
+  0xcb, 0x44, 0xa0, 0x00, 0x14, 0x42, 0x28, 0x90, 0x13, 0x88, 0x40, 0x84, 
+  0xc5, 0xb8, 0x02, 0x79, 0x26, 0xa6, 0x06, 0xea, 0x60, 0x7a, 0xa1, 0x40, 
+  0x86, 0xe8, 0x67, 0x86, 0x26, 0x86, 0x07, 0x09, 0xc5, 0x00, 0xc4, 0xc6, 
+  0x00, 0x16, 0x02, 0x70, 0xa0, 0x00, 0xe8, 0x41, 0x20, 0x1e, 0x01, 0x10, 
+  0x05, 0x1e, 0x00, 0xf0, 0x0d, 0xc4, 0xc6, 0x0f, 0x0d, 0xf1, 0x10, 0xa1, 
+  0x40, 0x6a, 0x09, 0xcf, 0xea, 0xc4, 0xc6, 0x8e, 0x0b, 0x8f, 0xea, 0xc4, 
+  0xc6, 0xe6, 0xc2, 0x08, 0x47, 0x5f, 0x27, 0x0e, 0x1f, 0x5e, 0x00, 0xf0, 
+  0x07, 0x2c, 0x01, 0xcb, 0x45, 0xa0, 0x00, 0xa0, 0x4c, 0x00, 0x18, 0x41, 
+  0x00, 0xd8, 0x65, 0x06, 0x0f, 0x2f, 0xfb, 0x09, 0x18, 0x03, 0x00, 0x96, 
+  0x00, 0xf0, 0x05, 0x14, 0x42, 0x40, 0x80, 0x06, 0xea, 0xa1, 0x66, 0x60, 
+  0x7a, 0xe1, 0x40, 0x84, 0xe8, 0x0c, 0x70, 0x8b, 0x58, 0xc6, 0xc6, 0xb8, 
+  0x00, 0xf0, 0x31, 0xe1, 0xc4, 0xfc, 0x1c, 0xc8, 0xb2, 0xfc, 0x1c, 0x88, 
+  0xb2, 0xfc, 0x1c, 0x48, 0xb2, 0xfc, 0x1c, 0x08, 0xb2, 0xfc, 0x1c, 0xc8, 
+  0xb1, 0xfc, 0x1c, 0x88, 0xb1, 0xfc, 0x1c, 0x48, 0xb1, 0xfc, 0x1c, 0x08, 
+  0xb1, 0xe1, 0xc3, 0xe1, 0xc2, 0xe1, 0xc1, 0xe1, 0xc0, 0xfc, 0x1c, 0x88, 
+  0xb7, 0x6a, 0x25, 0xc0, 0x10, 0xe1, 0xc5, 0x6a, 0x25, 0x80, 0x10, 0xe1, 
+  0xc5, 0xfc, 0x1c, 0x08, 0xbf, 0xa1, 0xc1, 0x76, 0x00, 0xe0, 0x44, 0x01, 
+  0x00, 0x18, 0x01, 0x02, 0xca, 0x0e, 0x4f, 0xfb, 0x14, 0x71, 0x43, 0xf2, 
+  0x82, 0x00, 0xf0, 0x05, 0x84, 0x6e, 0xcd, 0x70, 0xa1, 0x40, 0x00, 0x1c, 
+  0x01, 0x30, 0x2f, 0x26, 0x0c, 0x10, 0x2f, 0x21, 0x88, 0x83, 0x0c, 0xf2, 
+  0x86, 0x00, 0xf1, 0x0a, 0x9c, 0x7e, 0x00, 0x80, 0x4c, 0x71, 0x6c, 0x70, 
+  0xea, 0x0d, 0x6f, 0xfb, 0x40, 0x24, 0x04, 0x30, 0x04, 0x26, 0x81, 0x9f, 
+  0xff, 0x00, 0x00, 0x00, 0x0b, 0x1e, 0x00, 0x13, 0x80, 0x1e, 0x00, 0x17, 
+  0xce, 0x1e, 0x00, 0xa0, 0x00, 0x0f, 0x00, 0x00, 0x0a, 0xf2, 0x02, 0x85, 
+  0x08, 0xe8, 0x1a, 0x00, 0x13, 0xb2, 0x1a, 0x00, 0x91, 0x6c, 0x26, 0xc1, 
+  0x96, 0x09, 0xf2, 0x01, 0x85, 0x07, 0x16, 0x00, 0x13, 0x9e, 0x16, 0x00, 
+  0xf0, 0x07, 0x00, 0xc0, 0x03, 0xe8, 0x16, 0x0e, 0x8f, 0xfc, 0x87, 0x74, 
+  0xc1, 0xc5, 0x0a, 0x24, 0x40, 0x73, 0xc1, 0xc5, 0x6b, 0x25, 0x80, 0x10, 
+  0x06, 0x00, 0xf1, 0x68, 0xc0, 0x10, 0x04, 0x14, 0x1e, 0x34, 0xc1, 0xc0, 
+  0xc1, 0xc1, 0xc1, 0xc2, 0xc1, 0xc3, 0x04, 0x14, 0x04, 0x34, 0x04, 0x14, 
+  0x05, 0x34, 0x04, 0x14, 0x06, 0x34, 0x04, 0x14, 0x07, 0x34, 0x04, 0x14, 
+  0x08, 0x34, 0x04, 0x14, 0x09, 0x34, 0x04, 0x14, 0x0a, 0x34, 0x04, 0x14, 
+  0x0b, 0x34, 0xc1, 0xc4, 0xc4, 0xc2, 0x6f, 0x24, 0x3f, 0x00, 0xe0, 0x78, 
+  0xe9, 0x04, 0x8f, 0xea, 0xe6, 0xc3, 0xa3, 0xc1, 0x08, 0x46, 0x20, 0x40, 
+  0xc9, 0x45, 0x80, 0xc1, 0x80, 0x25, 0x0c, 0x17, 0x7a, 0x09, 0xaf, 0xf5, 
+  0x80, 0xc7, 0x00, 0xc2, 0x8d, 0x71, 0x2c, 0x71, 0x4a, 0x20, 0x40, 0x00, 
+  0x03, 0x4f, 0x0c, 0x72, 0x04, 0x33, 0x80, 0x80, 0xca, 0x22, 0xc9, 0x00, 
+  0x34, 0x70, 0x2c, 0x70, 0xf8, 0xf5, 0x26, 0x86, 0x04, 0x32, 0x40, 0x80, 
+  0xce, 0xf7, 0x24, 0x08, 0x00, 0xf7, 0x2e, 0xd9, 0xf7, 0x05, 0x86, 0x04, 
+  0x32, 0x00, 0x80, 0x48, 0x00, 0x2e, 0x00, 0x8d, 0x74, 0x15, 0x15, 0xc1, 
+  0x10, 0x2a, 0xf0, 0x00, 0x8d, 0x21, 0x8d, 0x49, 0x68, 0x09, 0x69, 0x4d, 
+  0x7a, 0x0d, 0x79, 0x88, 0x22, 0x3e, 0x02, 0x8c, 0x21, 0x3e, 0x82, 0x40, 
+  0xad, 0x5e, 0xf6, 0x88, 0xd9, 0x0c, 0x71, 0x29, 0xf0, 0x20, 0x8d, 0x41, 
+  0x8d, 0x69, 0x69, 0x29, 0x6a, 0x6d, 0x7a, 0x2d, 0x1e, 0x00, 0xf2, 0x03, 
+  0x99, 0xf6, 0x21, 0xad, 0x8d, 0x72, 0x0d, 0xf0, 0x01, 0x8d, 0x14, 0x15, 
+  0xc2, 0x10, 0x04, 0x77, 0x0d, 0x79, 0x18, 0x00, 0xf0, 0x1e, 0x8f, 0xf6, 
+  0x8d, 0x73, 0x21, 0xad, 0x0b, 0x09, 0x32, 0x00, 0x0c, 0x74, 0xc6, 0xc7, 
+  0x80, 0x26, 0x0c, 0x17, 0x00, 0x16, 0xc2, 0x10, 0x81, 0x40, 0x06, 0xf0, 
+  0x88, 0xd9, 0x03, 0xf0, 0x88, 0xd9, 0x0c, 0x73, 0x21, 0xad, 0xe9, 0x0a, 
+  0x12, 0x80, 0x0c, 0x73, 0xc6, 0xc7, 0xf2, 0x00, 0x07, 0x10, 0x3d, 0x00, 
+  0x07, 0x12, 0x8d, 0x00, 0x07, 0x2c, 0x0c, 0x2f, 0x00, 0x07, 0x19, 0x3c, 
+  0x00, 0x07, 0x10, 0x08, 0x00, 0x07, 0xf0, 0x0e, 0x43, 0x35, 0x05, 0xc0, 
+  0x03, 0xe8, 0xd2, 0xc7, 0x0f, 0x14, 0x8f, 0x30, 0xb1, 0x40, 0xb1, 0x41, 
+  0xb1, 0x42, 0x0a, 0x23, 0x40, 0x23, 0x55, 0x25, 0x8e, 0x1e, 0x56, 0x25, 
+  0x15, 0x0a, 0x06, 0xd0, 0x27, 0x80, 0x21, 0x04, 0x2d, 0x80, 0x22, 0x05, 
+  0x23, 0x80, 0x23, 0x05, 0x2f, 0x06, 0x07, 0xf3, 0x00, 0xef, 0x78, 0x30, 
+  0x70, 0xc6, 0x01, 0x2d, 0x00, 0x2c, 0x70, 0x04, 0x77, 0x94, 0xe0, 0x20, 
+  0x0a, 0x07, 0xf1, 0x2a, 0x16, 0xf0, 0x1a, 0xf0, 0x20, 0xf0, 0x24, 0xf0, 
+  0x2a, 0xf0, 0x2e, 0xf0, 0x34, 0xf0, 0x3b, 0xf0, 0x41, 0xf0, 0x48, 0xf0, 
+  0x51, 0xf0, 0x58, 0xf0, 0x67, 0xf0, 0x74, 0xf0, 0x84, 0xf0, 0x89, 0xf0, 
+  0x98, 0xf0, 0x9d, 0xf0, 0xa4, 0xf0, 0xb1, 0xf0, 0xc0, 0xf0, 0x8d, 0xc0, 
+  0xd2, 0x0d, 0x6f, 0xee, 0x84, 0xc1, 0x00, 0xa6, 0x72, 0xf0, 0x8d, 0xc0, 
+  0xc6, 0x0c, 0x00, 0x80, 0x01, 0xa6, 0x6c, 0xf0, 0x8d, 0xc0, 0xae, 0x08, 
+  0x12, 0x06, 0x71, 0x02, 0xa6, 0x66, 0xf0, 0x8d, 0xc0, 0xa2, 0x0c, 0x00, 
+  0x71, 0x03, 0xa6, 0x60, 0xf0, 0x8d, 0xc0, 0x96, 0x0c, 0x00, 0x30, 0x04, 
+  0xa6, 0x5a, 0x0c, 0x00, 0x01, 0x30, 0x00, 0xf1, 0x0a, 0x05, 0xa6, 0x54, 
+  0xf0, 0x8d, 0xc0, 0x84, 0xc1, 0x0e, 0x0a, 0xef, 0xf9, 0x86, 0xc2, 0x86, 
+  0xc1, 0x18, 0xda, 0xa2, 0x40, 0x48, 0xf0, 0x8d, 0xc0, 0x6a, 0x2a, 0x00, 
+  0x31, 0x0c, 0xa6, 0x44, 0x1e, 0x00, 0x24, 0xf2, 0x09, 0x1e, 0x00, 0x31, 
+  0x02, 0x40, 0x3a, 0x12, 0x00, 0x15, 0xde, 0x12, 0x00, 0x31, 0x22, 0x40, 
+  0x30, 0x12, 0x00, 0x15, 0xce, 0x12, 0x00, 0x31, 0x42, 0x40, 0x28, 0x12, 
+  0x00, 0x44, 0x22, 0x0a, 0xef, 0xf7, 0xd0, 0x06, 0xd1, 0x59, 0x1d, 0x98, 
+  0x10, 0x5a, 0x1d, 0x58, 0x10, 0x5b, 0x1d, 0x18, 0x10, 0x1a, 0x1e, 0x00, 
+  0x17, 0x06, 0x1e, 0x00, 0xd1, 0x5c, 0x1d, 0x98, 0x10, 0x5d, 0x1d, 0x58, 
+  0x10, 0x5e, 0x1d, 0x18, 0x10, 0x0c, 0x1e, 0x00, 0x15, 0x7e, 0x4e, 0x00, 
+  0xf0, 0x01, 0x62, 0x40, 0x56, 0x0b, 0x0f, 0xeb, 0x04, 0xc0, 0x92, 0x70, 
+  0xcc, 0x06, 0xee, 0xff, 0xe5, 0x71, 0xb0, 0x00, 0xc0, 0xce, 0x0f, 0x6f, 
+  0xf6, 0x84, 0xc1, 0xac, 0x1e, 0x00, 0x10, 0xf4, 0xf1, 0x2e, 0x00, 0x26, 
+  0xba, 0x09, 0x4c, 0x00, 0xf0, 0x03, 0x66, 0x1d, 0x98, 0x10, 0x67, 0x1d, 
+  0x58, 0x10, 0x68, 0x1d, 0x18, 0x10, 0xe6, 0xf1, 0x8d, 0xc0, 0xae, 0x0c, 
+  0xe8, 0x00, 0x91, 0xbc, 0x1e, 0x00, 0x10, 0xde, 0xf1, 0x8d, 0xc0, 0x9e, 
+  0x0e, 0x00, 0x51, 0xc0, 0x1e, 0x00, 0x10, 0xd8, 0x3a, 0x00, 0x35, 0xee, 
+  0x09, 0xaf, 0x74, 0x07, 0xd1, 0x6b, 0x1d, 0x98, 0x10, 0x6c, 0x1d, 0x58, 
+  0x10, 0x6d, 0x1d, 0x18, 0x10, 0xc8, 0x1e, 0x00, 0x17, 0xd2, 0x1e, 0x00, 
+  0xf1, 0x02, 0x6e, 0x1d, 0x98, 0x10, 0x6f, 0x1d, 0x58, 0x10, 0x70, 0x1d, 
+  0x18, 0x10, 0xba, 0xf1, 0x8d, 0xc0, 0x56, 0x4a, 0x00, 0xf0, 0x3b, 0xdc, 
+  0x1e, 0x00, 0x10, 0xb2, 0xf1, 0x8b, 0xb9, 0xc3, 0x42, 0x13, 0x00, 0x24, 
+  0x60, 0x76, 0x0e, 0xe0, 0x01, 0xa1, 0x40, 0x0c, 0x70, 0xd2, 0xc7, 0x8a, 
+  0x20, 0x3e, 0x06, 0xd2, 0xc7, 0xe0, 0x78, 0xee, 0xc3, 0xad, 0xc1, 0x08, 
+  0x45, 0x04, 0x88, 0xb1, 0x43, 0x0a, 0x20, 0x80, 0x21, 0xa8, 0x47, 0x70, 
+  0x42, 0x48, 0x46, 0x30, 0x41, 0x80, 0x23, 0x0c, 0x29, 0x09, 0xe8, 0x00, 
+  0x13, 0x80, 0x20, 0x05, 0xe8, 0xa1, 0x40, 0x22, 0x0c, 0x60, 0x00, 0x22, 
+  0x41, 0x4e, 0x05, 0xf2, 0x21, 0x8d, 0x70, 0xcb, 0x43, 0x00, 0x3f, 0x00, 
+  0x00, 0x2c, 0x70, 0x00, 0x1b, 0x43, 0x20, 0x04, 0x1d, 0x02, 0x13, 0xa8, 
+  0x20, 0x80, 0x06, 0x20, 0x4e, 0x0a, 0x20, 0xc0, 0x12, 0x80, 0xc2, 0x00, 
+  0x30, 0x80, 0x0f, 0x7a, 0x3d, 0x00, 0x00, 0x8b, 0xc3, 0x04, 0x30, 0x00, 
+  0x83, 0xca, 0x20, 0x8c, 0x1f, 0x98, 0x06, 0x60, 0x08, 0x02, 0x35, 0x7a, 
+  0x34, 0x7b, 0xd4, 0x05, 0xf0, 0x15, 0x48, 0x30, 0xc0, 0x12, 0x00, 0xb3, 
+  0xa9, 0x46, 0x80, 0x26, 0x09, 0x1f, 0x8b, 0xc2, 0x2c, 0x71, 0x1e, 0x09, 
+  0xef, 0xf1, 0xc1, 0x40, 0x56, 0x70, 0x4e, 0x70, 0x1c, 0xf4, 0x80, 0xc1, 
+  0x5e, 0x0c, 0xef, 0xff, 0xa1, 0x40, 0x68, 0x00, 0xf0, 0x07, 0x00, 0x43, 
+  0x40, 0x24, 0x00, 0x38, 0xa8, 0x20, 0x80, 0x02, 0x04, 0x11, 0x01, 0x24, 
+  0x00, 0x31, 0x81, 0x0f, 0xcc, 0x3d, 0xcd, 0xcc, 0xdc, 0x05, 0xf0, 0x1b, 
+  0xa1, 0x42, 0x88, 0xc1, 0x80, 0x22, 0x0c, 0x01, 0xda, 0x0e, 0x20, 0x00, 
+  0xa1, 0x40, 0x10, 0x42, 0xce, 0x15, 0x01, 0x16, 0x16, 0xe9, 0x8a, 0x20, 
+  0x0b, 0x04, 0x08, 0x65, 0x92, 0xe8, 0x8b, 0xc2, 0xc1, 0x40, 0x4a, 0x09, 
+  0xef, 0xf1, 0x40, 0x24, 0x11, 0x3b, 0x48, 0x00, 0x20, 0x80, 0xc0, 0xf4, 
+  0x05, 0x80, 0x02, 0x11, 0x41, 0x25, 0x48, 0x31, 0x81, 0x00, 0x40, 0x00, 
+  0xf0, 0x27, 0xcd, 0x15, 0x00, 0x16, 0xb1, 0x41, 0x80, 0x21, 0x0c, 0x21, 
+  0x00, 0x30, 0x82, 0x0f, 0x74, 0x49, 0x00, 0x24, 0x80, 0xc1, 0x40, 0x24, 
+  0x04, 0x34, 0xc3, 0x43, 0x2b, 0x32, 0x77, 0xcc, 0x22, 0x40, 0x9e, 0x0b, 
+  0xaf, 0xf1, 0x80, 0xc6, 0x84, 0xc1, 0x10, 0xda, 0x82, 0x09, 0x2f, 0xeb, 
+  0x22, 0x40, 0x84, 0xc1, 0x4a, 0x0a, 0xaf, 0xf1, 0x08, 0x00, 0x31, 0x10, 
+  0xda, 0x6e, 0x12, 0x00, 0xa0, 0x40, 0x24, 0xc1, 0x33, 0x40, 0x24, 0x82, 
+  0x33, 0x8e, 0x08, 0x82, 0x00, 0xf0, 0x11, 0x0e, 0x14, 0x80, 0x30, 0x00, 
+  0x18, 0x03, 0x20, 0x05, 0x20, 0xbe, 0x84, 0x04, 0xf2, 0x80, 0xd8, 0x00, 
+  0x18, 0x02, 0x20, 0x75, 0x15, 0x02, 0x16, 0x76, 0x15, 0x01, 0x16, 0x77, 
+  0x15, 0x00, 0x16, 0x86, 0x00, 0x00, 0x7c, 0x06, 0x41, 0x08, 0x1c, 0x00, 
+  0x30, 0xd0, 0x00, 0x30, 0x16, 0x00, 0x14, 0x28, 0x01, 0xf1, 0x07, 0x20, 
+  0x41, 0x00, 0x00, 0x04, 0x1f, 0x10, 0x10, 0x0f, 0x14, 0x80, 0x30, 0x48, 
+  0x30, 0x00, 0x00, 0x00, 0xa7, 0xce, 0xc7, 0xa3, 0xc1, 0xb4, 0x00, 0x50, 
+  0xc4, 0x40, 0x24, 0x02, 0x30, 0xf4, 0x06, 0x00, 0xac, 0x06, 0xf1, 0x37, 
+  0xbf, 0xb9, 0x04, 0x1a, 0x50, 0x00, 0x00, 0xc0, 0x4c, 0x71, 0x2c, 0x71, 
+  0x23, 0x4c, 0x2c, 0x72, 0x04, 0x33, 0x00, 0x80, 0xca, 0x20, 0xc9, 0x00, 
+  0x54, 0x70, 0x4c, 0x70, 0xf8, 0xf5, 0xe0, 0x7f, 0xa3, 0xc0, 0xe0, 0x78, 
+  0xe8, 0xc3, 0x82, 0x24, 0x02, 0x3a, 0x48, 0x47, 0x28, 0x46, 0x08, 0x45, 
+  0x56, 0x20, 0x01, 0x0f, 0x86, 0xc0, 0x90, 0xda, 0xc2, 0x08, 0x2f, 0xeb, 
+  0x40, 0x24, 0x10, 0x36, 0x4a, 0x24, 0x80, 0x71, 0x40, 0x24, 0x7c, 0x00, 
+  0xf0, 0x04, 0x01, 0x1c, 0x10, 0x03, 0x24, 0x04, 0x18, 0xd0, 0x00, 0x04, 
+  0xc1, 0x03, 0xc0, 0xc0, 0x15, 0x02, 0x10, 0x04, 0x31, 0x4c, 0x00, 0x24, 
+  0x49, 0x00, 0x54, 0x00, 0xf1, 0x04, 0x04, 0x30, 0x80, 0x80, 0x44, 0xf7, 
+  0x00, 0x1e, 0xc3, 0x10, 0x11, 0xf0, 0xbc, 0x15, 0x01, 0x10, 0x04, 0x30, 
+  0x40, 0x10, 0x00, 0x53, 0x83, 0x10, 0x09, 0xf0, 0xb8, 0x10, 0x00, 0xf0, 
+  0x95, 0x6f, 0x20, 0x0b, 0x00, 0x00, 0xae, 0x8a, 0x20, 0x4c, 0x05, 0x08, 
+  0x65, 0x09, 0x08, 0x91, 0x01, 0x00, 0x1e, 0x03, 0x10, 0x00, 0x1f, 0x03, 
+  0x10, 0x80, 0x25, 0x0c, 0x15, 0x20, 0x8d, 0x00, 0x8e, 0x0d, 0x08, 0x40, 
+  0x00, 0x00, 0x1f, 0x43, 0x10, 0x00, 0x8e, 0x00, 0xad, 0xc8, 0xc7, 0xe0, 
+  0x78, 0xfa, 0xc3, 0xa2, 0xc1, 0x10, 0x47, 0x00, 0x80, 0x60, 0x44, 0x40, 
+  0x24, 0xc3, 0x30, 0x40, 0x24, 0x05, 0x31, 0x40, 0x24, 0x86, 0x30, 0x48, 
+  0x45, 0x38, 0x40, 0x55, 0x27, 0x99, 0x2e, 0xa6, 0x0c, 0x2f, 0xf2, 0x03, 
+  0x1c, 0x43, 0x35, 0x02, 0x14, 0x80, 0x30, 0xea, 0x46, 0x0a, 0x27, 0xc0, 
+  0x15, 0x0a, 0x20, 0xc0, 0x25, 0x0a, 0x21, 0xc0, 0x25, 0x0a, 0x22, 0xc0, 
+  0x25, 0x56, 0x27, 0x13, 0x28, 0x56, 0x27, 0x94, 0x2b, 0x56, 0x27, 0xd5, 
+  0x2c, 0x56, 0x27, 0xd6, 0x2d, 0x80, 0x27, 0x05, 0x2f, 0x80, 0x26, 0x06, 
+  0x1b, 0x80, 0x27, 0x04, 0x17, 0x80, 0x20, 0x04, 0x2d, 0x80, 0x21, 0x05, 
+  0x23, 0x80, 0x22, 0x05, 0x29, 0x03, 0x14, 0x81, 0x30, 0x0f, 0x78, 0xe3, 
+  0x09, 0x24, 0x00, 0x04, 0x77, 0xcf, 0x08, 0x55, 0x05, 0xa6, 0x04, 0xf0, 
+  0xa3, 0x15, 0xf0, 0x17, 0xf0, 0x17, 0xf0, 0x19, 0xf0, 0x19, 0xf0, 0x1b, 
+  0xf0, 0x1b, 0xf0, 0x1e, 0xf0, 0x1f, 0xf0, 0x22, 0xf0, 0x23, 0xf0, 0x26, 
+  0xf0, 0x27, 0xf0, 0x2a, 0xf0, 0x2f, 0xf0, 0x37, 0xf0, 0x3c, 0xf0, 0x3f, 
+  0xf0, 0x40, 0xf0, 0x43, 0xf0, 0x48, 0xf0, 0x27, 0x40, 0x48, 0xf0, 0x2f, 
+  0x40, 0x46, 0xf0, 0x37, 0x40, 0x25, 0xf0, 0x3f, 0x40, 0x23, 0xf0, 0x27, 
+  0x44, 0x21, 0xf0, 0x2f, 0x44, 0x3e, 0xf0, 0x81, 0xc3, 0x62, 0x40, 0x16, 
+  0xf0, 0x30, 0x11, 0x00, 0x30, 0x19, 0xf0, 0x81, 0xc3, 0xe1, 0x40, 0x10, 
+  0xf0, 0x81, 0xc3, 0x02, 0x40, 0x0c, 0xf0, 0x81, 0xc3, 0x22, 0x40, 0x0a, 
+  0xf0, 0x81, 0xc3, 0x42, 0x40, 0x15, 0xf0, 0x81, 0xc3, 0x82, 0x40, 0x13, 
+  0xf0, 0x81, 0xc3, 0xe2, 0x40, 0x03, 0x41, 0x8a, 0x0d, 0xaf, 0xf9, 0xa1, 
+  0x42, 0x27, 0xf0, 0xac, 0x11, 0x00, 0x30, 0x81, 0xc3, 0x03, 0x41, 0xe6, 
+  0x0b, 0x6f, 0xf6, 0xa1, 0x42, 0x1f, 0xf0, 0x81, 0xc3, 0xa2, 0x40, 0x03, 
+  0x41, 0xd2, 0x0d, 0xaf, 0xf7, 0xa1, 0x42, 0x19, 0xf0, 0xbc, 0x11, 0x00, 
+  0x30, 0x10, 0xf0, 0xc0, 0x11, 0x00, 0x30, 0x0e, 0xf0, 0x81, 0xc3, 0xc1, 
+  0x40, 0x03, 0xf0, 0x81, 0xc3, 0xc2, 0x40, 0x03, 0x41, 0x22, 0x0e, 0x2e, 
+  0x00, 0x33, 0x09, 0xf0, 0xdc, 0x3e, 0x00, 0x60, 0xb2, 0x08, 0x6f, 0xee, 
+  0xa1, 0x42, 0x18, 0x01, 0xf0, 0x09, 0x04, 0x71, 0x02, 0x1c, 0x02, 0x30, 
+  0x8e, 0xf1, 0x01, 0xc0, 0x41, 0x28, 0x01, 0x02, 0x00, 0x18, 0x02, 0x30, 
+  0x01, 0x18, 0x42, 0x30, 0xda, 0xc7, 0xf8, 0x01, 0xf0, 0x1b, 0xa1, 0xc1, 
+  0x60, 0x40, 0x48, 0x45, 0x28, 0x46, 0x2c, 0x70, 0x10, 0xda, 0x88, 0x47, 
+  0x12, 0x0d, 0xef, 0xf8, 0x70, 0x40, 0xd5, 0x70, 0xcd, 0x70, 0x08, 0xf2, 
+  0x47, 0x0d, 0x91, 0x19, 0x00, 0x18, 0x83, 0x21, 0xcd, 0x71, 0x1f, 0xf0, 
+  0x4a, 0x24, 0x00, 0x71, 0x00, 0x04, 0x41, 0x14, 0x60, 0x0c, 0x70, 0x84, 
+  0x02, 0xf0, 0x1c, 0x12, 0x03, 0x04, 0x80, 0xc1, 0x1c, 0x61, 0x04, 0x71, 
+  0x38, 0x23, 0x41, 0x03, 0x20, 0xac, 0x0e, 0x08, 0x6f, 0xf4, 0x80, 0xc0, 
+  0x0b, 0xe8, 0xcd, 0x74, 0x03, 0x18, 0xc3, 0x21, 0x02, 0x18, 0x43, 0x21, 
+  0x01, 0x18, 0x83, 0x20, 0x00, 0x18, 0x43, 0x20, 0xc0, 0xa7, 0xc4, 0x01, 
+  0x6c, 0xf4, 0xc3, 0xa2, 0xc1, 0x08, 0x46, 0xc4, 0x01, 0x60, 0x50, 0x46, 
+  0x28, 0x45, 0xe6, 0x0a, 0xc0, 0x01, 0x20, 0xc3, 0x31, 0xa8, 0x00, 0xf2, 
+  0x13, 0xd1, 0x43, 0x0a, 0x22, 0x80, 0x23, 0x8a, 0x21, 0x4c, 0x25, 0x8a, 
+  0x20, 0x8c, 0x25, 0x8a, 0x27, 0x0c, 0x19, 0x56, 0x26, 0x55, 0x1e, 0x56, 
+  0x26, 0x14, 0x1f, 0x80, 0x23, 0x09, 0x2c, 0x80, 0x22, 0x0c, 0x21, 0xa8, 
+  0x01, 0x11, 0x85, 0xa8, 0x01, 0x40, 0x71, 0x08, 0xd5, 0x01, 0xa8, 0x01, 
+  0xd1, 0x07, 0xf0, 0x1f, 0xf0, 0x0c, 0xf0, 0x13, 0xf0, 0x18, 0xf0, 0x22, 
+  0xf0, 0x28, 0x2c, 0x01, 0x80, 0xa1, 0x41, 0x6e, 0x0d, 0xef, 0xf9, 0xc2, 
+  0x42, 0x0e, 0x00, 0xb1, 0x62, 0x40, 0xa1, 0x41, 0x0a, 0x0d, 0x6f, 0xf6, 
+  0xc2, 0x42, 0x20, 0x72, 0x01, 0xe0, 0xa1, 0x41, 0x7e, 0x09, 0x6f, 0xf9, 
+  0xc2, 0x42, 0x1a, 0xf0, 0x32, 0x26, 0x40, 0x14, 0x86, 0x01, 0xf0, 0x0f, 
+  0x82, 0x40, 0xa1, 0x41, 0xe2, 0x0a, 0x6f, 0xfa, 0xc2, 0x42, 0x10, 0xf0, 
+  0x32, 0x26, 0x00, 0x14, 0x81, 0xc3, 0xa1, 0x41, 0x56, 0x0c, 0xef, 0xf3, 
+  0xc2, 0x42, 0x08, 0xf0, 0xe8, 0x66, 0x0e, 0x00, 0x57, 0x76, 0x08, 0x2f, 
+  0xf9, 0xc2, 0x4a, 0x01, 0x14, 0xbe, 0x4a, 0x01, 0xf0, 0x1a, 0xad, 0x21, 
+  0xad, 0xd4, 0xc7, 0xee, 0xc3, 0x82, 0x24, 0x07, 0x35, 0x50, 0x41, 0x28, 
+  0x45, 0x10, 0x40, 0x56, 0x24, 0x80, 0x3d, 0x2c, 0x70, 0x24, 0xda, 0xa8, 
+  0x46, 0x0a, 0x23, 0x00, 0x21, 0x70, 0x42, 0xc2, 0x0b, 0xef, 0xf8, 0x56, 
+  0x24, 0x8f, 0x3d, 0x96, 0x03, 0x00, 0x40, 0x03, 0x00, 0xbc, 0x03, 0xf0, 
+  0x09, 0x10, 0x1f, 0x10, 0x10, 0x8d, 0x70, 0x0a, 0x21, 0x40, 0x14, 0x6c, 
+  0x70, 0x0a, 0x20, 0x80, 0x14, 0x4a, 0x22, 0x00, 0x00, 0x5a, 0x22, 0x80, 
+  0x01, 0x68, 0x03, 0xf0, 0x04, 0x56, 0x24, 0x4e, 0x3b, 0x79, 0x60, 0x35, 
+  0x7e, 0x0a, 0x23, 0x40, 0x12, 0x01, 0x41, 0x0c, 0x70, 0x00, 0x1e, 0x00, 
+  0x20, 0x05, 0xf0, 0x2e, 0x02, 0x0c, 0x11, 0x07, 0x04, 0x18, 0x13, 0x06, 
+  0x14, 0x00, 0x36, 0xc6, 0x01, 0x01, 0x30, 0x80, 0x01, 0x44, 0x71, 0x05, 
+  0x74, 0xcd, 0x0a, 0xf4, 0x80, 0x00, 0xa6, 0x64, 0x71, 0xbd, 0x0b, 0xb4, 
+  0x81, 0x40, 0x21, 0x09, 0x11, 0x55, 0x24, 0xc8, 0x3f, 0x55, 0x24, 0xc9, 
+  0x3f, 0x0a, 0x26, 0x80, 0x04, 0x15, 0x20, 0x05, 0x13, 0x4c, 0x70, 0x0a, 
+  0x23, 0x40, 0x14, 0x0c, 0x70, 0x58, 0x00, 0xf1, 0x01, 0x14, 0x20, 0x01, 
+  0x00, 0x15, 0x25, 0x4e, 0x00, 0xc0, 0x43, 0x2c, 0x70, 0x00, 0x1e, 0x80, 
+  0x10, 0xc4, 0x01, 0xf0, 0x0c, 0x13, 0x04, 0x14, 0x0c, 0x13, 0x07, 0x04, 
+  0x00, 0x37, 0x07, 0x01, 0x01, 0x31, 0xc1, 0x01, 0x04, 0x71, 0xd9, 0x08, 
+  0xb4, 0x81, 0x20, 0xa6, 0x0a, 0x24, 0x80, 0x04, 0x34, 0x00, 0x81, 0x6d, 
+  0x70, 0x21, 0x41, 0x0a, 0x20, 0x00, 0x01, 0x80, 0x00, 0xf1, 0x35, 0x10, 
+  0x07, 0x04, 0x0c, 0x11, 0x03, 0x04, 0x00, 0x33, 0xc3, 0x01, 0x01, 0x33, 
+  0xcb, 0x10, 0x14, 0x22, 0x80, 0x00, 0x56, 0x24, 0x81, 0x3d, 0x98, 0x60, 
+  0x01, 0x49, 0x00, 0x24, 0x83, 0x3f, 0x00, 0x00, 0x44, 0x01, 0x44, 0x71, 
+  0x01, 0x33, 0x41, 0x10, 0x84, 0x74, 0x15, 0x7b, 0xc5, 0x0a, 0xf4, 0x80, 
+  0x20, 0xa3, 0x85, 0x71, 0x25, 0x74, 0x79, 0x0c, 0xf4, 0x90, 0xc4, 0x74, 
+  0x56, 0x24, 0x40, 0x3b, 0x00, 0x24, 0x81, 0x26, 0x00, 0xe0, 0x55, 0x24, 
+  0x42, 0x3b, 0x1e, 0x0b, 0xef, 0xf8, 0x55, 0x24, 0x4e, 0x3b, 0x2c, 0x70, 
+  0x18, 0x01, 0x81, 0xc1, 0x42, 0x62, 0x40, 0x4a, 0x23, 0x00, 0x00, 0x94, 
+  0x00, 0xf0, 0x22, 0x10, 0x0b, 0x04, 0x18, 0x12, 0x0c, 0x04, 0x00, 0x34, 
+  0xcc, 0x12, 0x01, 0x33, 0x03, 0x03, 0x20, 0x4d, 0x15, 0x20, 0x42, 0x20, 
+  0x24, 0x71, 0x01, 0x33, 0x00, 0x00, 0xc5, 0x74, 0xd5, 0x09, 0xb4, 0x81, 
+  0x72, 0x1a, 0x18, 0x00, 0x55, 0x24, 0x00, 0x39, 0x2c, 0x70, 0x4a, 0x22, 
+  0x00, 0x09, 0x62, 0x0a, 0x4a, 0x00, 0x20, 0x0d, 0x39, 0xb0, 0x00, 0xe0, 
+  0xa8, 0x20, 0x00, 0x01, 0x07, 0x1d, 0x53, 0x10, 0xcc, 0x70, 0x55, 0x24, 
+  0x48, 0x3b, 0x62, 0x01, 0x20, 0x80, 0x14, 0x58, 0x00, 0x00, 0x64, 0x00, 
+  0x32, 0x01, 0x40, 0x6d, 0xb8, 0x02, 0xf2, 0x3e, 0x11, 0x02, 0x14, 0x18, 
+  0x10, 0x01, 0x04, 0x00, 0x31, 0x81, 0x00, 0x01, 0x33, 0x4b, 0x10, 0x5a, 
+  0x23, 0x80, 0x01, 0x55, 0x24, 0x01, 0x39, 0x40, 0x24, 0x04, 0x30, 0x98, 
+  0x60, 0x33, 0x21, 0x01, 0x00, 0x15, 0x24, 0x02, 0x00, 0x64, 0x71, 0x48, 
+  0x31, 0x80, 0x00, 0x02, 0x30, 0xc0, 0x02, 0xc5, 0x0b, 0xb4, 0x81, 0x00, 
+  0xa2, 0x85, 0x71, 0xb5, 0x0c, 0xb4, 0x91, 0x05, 0x74, 0x4c, 0x70, 0x15, 
+  0x20, 0x87, 0x20, 0x0a, 0x20, 0x40, 0x14, 0x4a, 0x21, 0x00, 0x00, 0x5a, 
+  0x21, 0xb4, 0x01, 0xf1, 0x25, 0x80, 0x43, 0x15, 0x27, 0x0c, 0x00, 0x0c, 
+  0x70, 0x78, 0x1c, 0x98, 0x11, 0xa8, 0x20, 0x00, 0x03, 0x04, 0x10, 0x09, 
+  0x14, 0x18, 0x13, 0x0b, 0x04, 0x00, 0x33, 0x4b, 0x12, 0x01, 0x30, 0xc0, 
+  0x02, 0x78, 0x1c, 0x18, 0x10, 0x24, 0x71, 0xd5, 0x09, 0x94, 0x81, 0x44, 
+  0x71, 0xc1, 0x0a, 0xb4, 0x81, 0x84, 0x74, 0xce, 0xc7, 0x70, 0x05, 0x10, 
+  0x34, 0x3e, 0x00, 0xa1, 0x50, 0x40, 0x0a, 0x25, 0x00, 0x10, 0x56, 0x20, 
+  0x4e, 0x0e, 0x20, 0x02, 0xf2, 0x04, 0x11, 0x00, 0x04, 0x04, 0x1e, 0x10, 
+  0x10, 0x80, 0xc0, 0x2c, 0x70, 0x90, 0xda, 0x86, 0x09, 0xef, 0xf8, 0x80, 
+  0xc7, 0xdc, 0x00, 0xf1, 0x07, 0x80, 0x01, 0x04, 0x10, 0x00, 0x24, 0x1c, 
+  0x1f, 0x10, 0x10, 0x80, 0xc1, 0x90, 0xda, 0x26, 0x0b, 0xef, 0xea, 0x0a, 
+  0x20, 0x80, 0x03, 0xee, 0x05, 0x30, 0x25, 0x09, 0x1c, 0xfc, 0x00, 0x40, 
+  0x04, 0x1d, 0x11, 0x10, 0x6c, 0x03, 0xf0, 0x15, 0xee, 0xc3, 0xab, 0xc1, 
+  0x28, 0x47, 0x08, 0x46, 0xad, 0x70, 0x10, 0x41, 0x88, 0xc1, 0xe1, 0x40, 
+  0x70, 0x43, 0x50, 0x42, 0x1b, 0x1c, 0x42, 0x33, 0x80, 0x26, 0x4c, 0x15, 
+  0xc6, 0x0e, 0x2f, 0xf5, 0x40, 0x24, 0x10, 0x38, 0x38, 0x00, 0x20, 0x4a, 
+  0x20, 0x74, 0x01, 0xf0, 0x67, 0x40, 0x04, 0x15, 0x21, 0x01, 0x20, 0xf0, 
+  0x20, 0x03, 0x20, 0xd8, 0x11, 0x01, 0x00, 0x40, 0x24, 0x42, 0x37, 0x1a, 
+  0x62, 0x04, 0x33, 0x40, 0x80, 0x04, 0x71, 0x6f, 0x21, 0x0b, 0x00, 0x20, 
+  0xaa, 0x12, 0x08, 0x6f, 0xf3, 0x40, 0x24, 0x40, 0x37, 0x20, 0x8e, 0x2e, 
+  0xe8, 0x34, 0x76, 0x8c, 0x01, 0x0d, 0x00, 0x25, 0x20, 0x40, 0x00, 0x07, 
+  0xf0, 0xc2, 0xf0, 0x2e, 0xf0, 0xc0, 0xf0, 0x4d, 0xf0, 0x5f, 0xf0, 0x6b, 
+  0xf0, 0xc6, 0x11, 0x00, 0x26, 0xce, 0x11, 0x01, 0x26, 0x41, 0x68, 0x30, 
+  0x70, 0x6c, 0x01, 0x2b, 0x00, 0xc6, 0x19, 0x98, 0x20, 0xcc, 0x11, 0x02, 
+  0x20, 0xd0, 0x11, 0x01, 0x20, 0xd4, 0x11, 0x00, 0x20, 0x43, 0xc2, 0x44, 
+  0xc1, 0x45, 0xc0, 0x40, 0x21, 0x02, 0x28, 0x80, 0xc1, 0x22, 0x40, 0xc6, 
+  0x19, 0x58, 0x23, 0x12, 0x06, 0xf0, 0x07, 0x40, 0xc5, 0x41, 0xc5, 0xfa, 
+  0x0e, 0xef, 0xff, 0x42, 0xc5, 0x9c, 0xf0, 0x07, 0x09, 0x50, 0x01, 0x21, 
+  0xae, 0x00, 0x1e, 0x43, 0x11, 0x1e, 0x00, 0x11, 0x94, 0x52, 0x00, 0x00, 
+  0x94, 0x01, 0xf0, 0x1b, 0x40, 0x24, 0xc5, 0x36, 0x04, 0x71, 0xc6, 0x19, 
+  0x18, 0x20, 0xe1, 0x41, 0x42, 0x42, 0x62, 0x43, 0x52, 0x09, 0x20, 0x00, 
+  0x22, 0x40, 0x87, 0xc1, 0x80, 0xc2, 0x52, 0x09, 0xef, 0xff, 0x22, 0x40, 
+  0x27, 0xc0, 0xf5, 0x08, 0xd0, 0x00, 0xcb, 0x11, 0x01, 0x26, 0x32, 0x00, 
+  0x40, 0xf1, 0x09, 0x03, 0x00, 0x40, 0x00, 0x44, 0xa0, 0xae, 0x72, 0xf0, 
+  0x3e, 0x00, 0x20, 0x22, 0x40, 0x3a, 0x00, 0xd2, 0x1a, 0x09, 0x20, 0x00, 
+  0x62, 0x43, 0x20, 0xc0, 0xcd, 0x08, 0x10, 0x00, 0xc0, 0x80, 0x00, 0x21, 
+  0x11, 0x60, 0x66, 0x00, 0xa0, 0xc8, 0x11, 0x01, 0x26, 0x04, 0x71, 0xb5, 
+  0x08, 0x62, 0x00, 0x66, 0x00, 0x21, 0x01, 0x8e, 0x9e, 0x00, 0x71, 0xae, 
+  0x52, 0xf0, 0xc6, 0x11, 0x10, 0x26, 0x7a, 0x07, 0x30, 0x20, 0x40, 0x20, 
+  0x1a, 0x00, 0x00, 0xf8, 0x04, 0x20, 0x40, 0x03, 0x2c, 0x01, 0xf1, 0x5b, 
+  0x04, 0x4f, 0x9c, 0x11, 0x03, 0x06, 0x88, 0xc2, 0x15, 0x7a, 0x02, 0x34, 
+  0xc1, 0x10, 0x04, 0x71, 0x20, 0xa2, 0x8e, 0x08, 0xef, 0xff, 0x88, 0xc0, 
+  0xc0, 0x11, 0x01, 0x26, 0xe7, 0x16, 0x8f, 0x90, 0x10, 0x43, 0x01, 0x30, 
+  0x42, 0x00, 0x1f, 0x0f, 0xb5, 0x12, 0xc0, 0x19, 0x98, 0x20, 0x15, 0x21, 
+  0xc0, 0x23, 0xb5, 0x18, 0xd8, 0x04, 0xc0, 0x11, 0x12, 0x26, 0xe5, 0x71, 
+  0xe7, 0x1e, 0xc2, 0x93, 0x12, 0xf0, 0xb5, 0x11, 0x03, 0x26, 0x22, 0x40, 
+  0x22, 0x41, 0x02, 0x32, 0xd2, 0x00, 0x80, 0x20, 0x0b, 0x05, 0x80, 0x21, 
+  0x0b, 0x06, 0x24, 0xda, 0x0a, 0x0f, 0xaf, 0xf8, 0xc0, 0x19, 0x98, 0x24, 
+  0xbe, 0x19, 0xd8, 0x24, 0xb4, 0x11, 0x01, 0x20, 0xef, 0x78, 0xd6, 0x07, 
+  0xd0, 0x31, 0x00, 0x00, 0x04, 0x32, 0x00, 0xa0, 0x4d, 0xf7, 0xe7, 0x1e, 
+  0x42, 0x93, 0xbc, 0x00, 0x02, 0x40, 0x01, 0xff, 0x01, 0x03, 0x11, 0x1b, 
+  0x14, 0x80, 0x30, 0xce, 0xc7, 0xca, 0x11, 0x00, 0x26, 0xf9, 0x08, 0x02, 
+  0xa0, 0x70, 0x01, 0x07, 0x08, 0x38, 0x00, 0x00, 0x74, 0x01, 0x20, 0x86, 
+  0x0d, 0x74, 0x01, 0x00, 0x82, 0x01, 0xf0, 0x11, 0xe0, 0xf1, 0xf2, 0xc3, 
+  0x82, 0x24, 0x05, 0x3a, 0x08, 0x46, 0x0a, 0x24, 0x40, 0x21, 0x0a, 0x21, 
+  0x00, 0x21, 0x70, 0x43, 0x48, 0x43, 0x30, 0x40, 0x10, 0x42, 0x55, 0x20, 
+  0x4f, 0x08, 0xad, 0x70, 0x32, 0x02, 0xb1, 0x00, 0x1d, 0x42, 0x03, 0x57, 
+  0x0b, 0x71, 0x00, 0x00, 0x1c, 0x42, 0x6e, 0x02, 0x01, 0x08, 0x01, 0xf0, 
+  0x0c, 0x04, 0x15, 0x22, 0x02, 0x20, 0xf0, 0x20, 0x01, 0x20, 0x9c, 0x12, 
+  0x03, 0x06, 0x00, 0x24, 0x82, 0x3f, 0x00, 0x00, 0x5c, 0x01, 0x15, 0x7a, 
+  0x02, 0x31, 0xc1, 0x00, 0x10, 0x01, 0x31, 0x00, 0x24, 0x80, 0x12, 0x00, 
+  0x60, 0x76, 0x0f, 0x8f, 0xff, 0x2c, 0x87, 0xf4, 0x07, 0xf2, 0x19, 0x5e, 
+  0x00, 0x0c, 0x00, 0x00, 0x19, 0x43, 0x20, 0x09, 0x8e, 0x14, 0x70, 0x06, 
+  0x02, 0x02, 0x00, 0xd2, 0xc7, 0x09, 0x8e, 0x02, 0xe8, 0xa9, 0xae, 0x56, 
+  0x24, 0xc1, 0x39, 0x61, 0x40, 0x32, 0x0f, 0x2f, 0xf1, 0x56, 0x24, 0xd5, 
+  0x39, 0x0c, 0x70, 0x26, 0x04, 0x20, 0x14, 0x01, 0x6a, 0x00, 0x40, 0x0a, 
+  0x22, 0x40, 0x05, 0xf8, 0x02, 0xf1, 0x4c, 0x0c, 0x12, 0x03, 0x04, 0x04, 
+  0x19, 0xd0, 0x00, 0x04, 0x71, 0xed, 0x08, 0xf4, 0x80, 0xa6, 0x74, 0x41, 
+  0x0b, 0xf0, 0x20, 0x54, 0x22, 0x81, 0x2d, 0x35, 0x0b, 0x31, 0x21, 0x54, 
+  0x22, 0x81, 0x2a, 0x18, 0xf0, 0x27, 0x16, 0x81, 0x10, 0x49, 0x8e, 0x30, 
+  0x72, 0x68, 0x01, 0x06, 0x00, 0x04, 0x30, 0x80, 0x8f, 0x20, 0x41, 0x00, 
+  0x00, 0xa2, 0x01, 0x2c, 0x00, 0x44, 0x71, 0x9f, 0x17, 0x01, 0x16, 0x49, 
+  0xae, 0x01, 0x30, 0x40, 0x00, 0x9f, 0x1f, 0x18, 0x10, 0xd2, 0xc7, 0x40, 
+  0x22, 0x01, 0x2f, 0x55, 0x24, 0xc0, 0x3f, 0xe6, 0x0f, 0xaf, 0xea, 0x18, 
+  0xda, 0x95, 0x66, 0x03, 0x80, 0x1e, 0x0e, 0xaf, 0xf8, 0x54, 0x24, 0x95, 
+  0x3a, 0x68, 0x03, 0x00, 0x1c, 0x00, 0x02, 0x6c, 0x03, 0xf1, 0x1e, 0x01, 
+  0x04, 0x1c, 0x1d, 0x50, 0x20, 0x4a, 0x24, 0x00, 0x79, 0x56, 0x22, 0x01, 
+  0x2f, 0x95, 0xc0, 0xe0, 0x78, 0xa8, 0x20, 0x40, 0x02, 0x04, 0x11, 0x03, 
+  0x04, 0x40, 0x80, 0x01, 0x33, 0x82, 0x00, 0x04, 0x18, 0x90, 0x00, 0x56, 
+  0x22, 0x41, 0x2e, 0x55, 0x24, 0x40, 0x3e, 0x9a, 0x4e, 0x00, 0x31, 0x0d, 
+  0x70, 0x8d, 0xd0, 0x04, 0x20, 0x14, 0x24, 0xb4, 0x05, 0xa4, 0x00, 0x05, 
+  0x33, 0x20, 0x82, 0x0f, 0x13, 0x00, 0xc0, 0x5f, 0xd4, 0x00, 0xf0, 0x0b, 
+  0x03, 0x49, 0x40, 0x24, 0x09, 0x33, 0x15, 0x21, 0x01, 0x10, 0x48, 0x32, 
+  0x82, 0x00, 0x04, 0x71, 0x60, 0xa1, 0x49, 0xa1, 0x85, 0x71, 0xd1, 0x0c, 
+  0xd4, 0x90, 0x08, 0x05, 0xf1, 0x02, 0x80, 0x71, 0x15, 0x22, 0x0c, 0x22, 
+  0x55, 0x24, 0x42, 0x3e, 0x21, 0x43, 0x0c, 0x70, 0x9c, 0x1c, 0x58, 0xf8, 
+  0x05, 0x51, 0x04, 0x12, 0x06, 0x04, 0x0c, 0x4c, 0x04, 0x20, 0x8b, 0x11, 
+  0x4c, 0x04, 0xc2, 0x05, 0x71, 0x25, 0x74, 0xd5, 0x08, 0xf4, 0x90, 0x9c, 
+  0x1c, 0x18, 0x10, 0x54, 0x06, 0x00, 0x8c, 0x01, 0x95, 0x40, 0x20, 0xf0, 
+  0x20, 0x43, 0x20, 0x9c, 0x10, 0x00, 0x8c, 0x01, 0xe4, 0x35, 0x7a, 0x02, 
+  0x33, 0x00, 0x00, 0x24, 0x71, 0x00, 0xa2, 0x23, 0x0b, 0x10, 0x21, 0x90, 
+  0x01, 0x24, 0xe6, 0x0d, 0x90, 0x01, 0xf1, 0x18, 0xc5, 0xf6, 0x00, 0x8e, 
+  0x65, 0x08, 0xb1, 0x00, 0x6c, 0x71, 0x40, 0x87, 0x21, 0x87, 0x02, 0x87, 
+  0x6c, 0x70, 0x40, 0xc2, 0x41, 0xc1, 0x42, 0xc0, 0x00, 0x19, 0xc2, 0x20, 
+  0x55, 0x24, 0x41, 0x3e, 0x95, 0xc2, 0x83, 0xc3, 0x00, 0x24, 0x84, 0x36, 
+  0x00, 0xf0, 0x0f, 0x40, 0x24, 0x05, 0x30, 0x1e, 0x09, 0xef, 0xff, 0x42, 
+  0x40, 0x00, 0x1c, 0x43, 0x20, 0xd2, 0xc7, 0x1a, 0xf4, 0x48, 0x32, 0x01, 
+  0x00, 0x00, 0x30, 0x43, 0x00, 0x01, 0x31, 0x40, 0x00, 0x62, 0x01, 0xa0, 
+  0x02, 0x33, 0x0c, 0x00, 0x04, 0x31, 0x00, 0x83, 0xd7, 0xf6, 0xa8, 0x05, 
+  0xf0, 0x0b, 0x04, 0x31, 0x00, 0x80, 0x51, 0xf7, 0x01, 0x6a, 0x09, 0xae, 
+  0x12, 0xf1, 0x43, 0x87, 0x24, 0x87, 0x05, 0x87, 0xd3, 0xf1, 0x30, 0x72, 
+  0x10, 0x06, 0xce, 0xff, 0x9c, 0x01, 0x00, 0x8a, 0x00, 0xf0, 0x13, 0x0c, 
+  0x06, 0xc6, 0xff, 0x9f, 0x1f, 0x58, 0x13, 0xa9, 0xae, 0xd2, 0xc7, 0xe0, 
+  0x78, 0x39, 0x00, 0x80, 0x01, 0xe8, 0xc3, 0xa6, 0xc1, 0x10, 0x40, 0x80, 
+  0x20, 0x07, 0x05, 0x4a, 0x08, 0xef, 0xf8, 0x28, 0x46, 0x2a, 0x00, 0x71, 
+  0x7a, 0x44, 0x00, 0x00, 0x7c, 0x00, 0x26, 0xc0, 0x05, 0x41, 0x83, 0xc5, 
+  0x83, 0xc0, 0x10, 0x01, 0xe1, 0x16, 0x01, 0x14, 0x00, 0x31, 0x81, 0x0f, 
+  0xcc, 0x3d, 0xcd, 0xcc, 0x04, 0x18, 0x50, 0x1c, 0x00, 0x12, 0x6d, 0x94, 
+  0x02, 0xc7, 0x03, 0x15, 0x20, 0x01, 0x20, 0x04, 0x4d, 0x75, 0x11, 0x03, 
+  0x06, 0x80, 0x9c, 0x03, 0xf1, 0x8a, 0x00, 0xc6, 0x01, 0xc5, 0x02, 0xc4, 
+  0x03, 0xc3, 0x04, 0xc2, 0x05, 0xc1, 0x7f, 0xd8, 0x17, 0xb8, 0xc3, 0x18, 
+  0xd8, 0x22, 0xc2, 0x18, 0xd8, 0x22, 0xc1, 0x18, 0xd8, 0x22, 0xc4, 0x18, 
+  0x18, 0x20, 0x72, 0x18, 0x98, 0x23, 0x73, 0x18, 0x58, 0x23, 0x74, 0x18, 
+  0x18, 0x23, 0x9c, 0x18, 0xd8, 0x20, 0x9d, 0x18, 0x98, 0x20, 0x9e, 0x18, 
+  0x58, 0x20, 0xc8, 0xc7, 0x02, 0x09, 0xa0, 0x01, 0x02, 0x40, 0xc8, 0xc7, 
+  0xf4, 0xc3, 0x82, 0x24, 0x0f, 0x35, 0x50, 0x44, 0x08, 0x45, 0x55, 0x24, 
+  0x40, 0x3d, 0x8a, 0x22, 0x0c, 0x00, 0xaa, 0x0d, 0xaf, 0xea, 0x28, 0x46, 
+  0x00, 0x85, 0x40, 0x24, 0x83, 0x33, 0x40, 0x24, 0x04, 0x35, 0x55, 0x24, 
+  0x05, 0x3d, 0x40, 0x24, 0x06, 0x34, 0x40, 0x24, 0xc7, 0x33, 0xc1, 0x41, 
+  0x82, 0x42, 0xb6, 0x09, 0xef, 0xf1, 0x0e, 0x1c, 0xc3, 0x31, 0x05, 0xc6, 
+  0x03, 0xee, 0xc1, 0x40, 0xd4, 0xc7, 0x0f, 0x14, 0x8f, 0x30, 0xb1, 0x43, 
+  0xb1, 0x40, 0xb1, 0x41, 0xb1, 0x42, 0x56, 0x25, 0x55, 0x1e, 0x56, 0x25, 
+  0x16, 0x1f, 0xcd, 0x80, 0x05, 0xf0, 0x25, 0x80, 0x23, 0x0c, 0x21, 0x80, 
+  0x20, 0x4c, 0x25, 0x80, 0x21, 0x8c, 0x25, 0x80, 0x22, 0x0c, 0x29, 0xe9, 
+  0xe8, 0x0e, 0x14, 0x81, 0x30, 0xef, 0x78, 0xcb, 0x09, 0x24, 0x80, 0x04, 
+  0x77, 0xab, 0x08, 0xd5, 0x01, 0x25, 0x20, 0x00, 0x00, 0x08, 0xf0, 0x12, 
+  0xf0, 0x1c, 0xf0, 0x2a, 0xf0, 0x36, 0xf0, 0x3c, 0xf0, 0x44, 0xf0, 0x86, 
+  0x00, 0xf3, 0x04, 0x84, 0xc1, 0x72, 0x0c, 0xaf, 0xf9, 0x55, 0x24, 0x82, 
+  0x3b, 0x55, 0x24, 0x81, 0x3b, 0x18, 0xda, 0xa2, 0x40, 0x25, 0x18, 0x00, 
+  0xd3, 0xfe, 0x09, 0x2f, 0xfa, 0x8a, 0xc2, 0x8a, 0xc1, 0x90, 0xda, 0xc2, 
+  0x40, 0x1b, 0x14, 0x00, 0xf4, 0x09, 0xee, 0x0b, 0x2f, 0xf6, 0x80, 0xc2, 
+  0x00, 0xc2, 0x01, 0xc1, 0x02, 0xc0, 0x9c, 0x1d, 0x98, 0x10, 0x9d, 0x1d, 
+  0x58, 0x10, 0x9e, 0x1d, 0x18, 0x10, 0x34, 0x00, 0xf1, 0x02, 0x52, 0x08, 
+  0x2f, 0xf9, 0x86, 0xc2, 0x86, 0xc1, 0x10, 0xda, 0x62, 0x40, 0xce, 0x0c, 
+  0x8f, 0xea, 0x19, 0x18, 0x00, 0xb1, 0x46, 0x0b, 0xaf, 0xf3, 0x84, 0xc1, 
+  0x00, 0x18, 0x02, 0x20, 0x11, 0x10, 0x00, 0x12, 0x36, 0x10, 0x00, 0x41, 
+  0x19, 0x02, 0x20, 0x09, 0x10, 0x00, 0xf0, 0x97, 0x52, 0x0f, 0xaf, 0xf8, 
+  0x84, 0xc1, 0x00, 0x1a, 0x02, 0x20, 0x04, 0xc0, 0x8a, 0x21, 0x3e, 0x06, 
+  0x92, 0x70, 0xca, 0x26, 0x4d, 0x10, 0x2c, 0x71, 0x3c, 0x24, 0x00, 0x20, 
+  0x06, 0x79, 0x3f, 0x67, 0x9a, 0xf1, 0xe0, 0x78, 0xec, 0xc3, 0xa6, 0xc1, 
+  0x40, 0x92, 0xcb, 0x44, 0x48, 0x47, 0x00, 0x00, 0x08, 0x45, 0x48, 0x32, 
+  0x02, 0x00, 0x07, 0x34, 0x8b, 0x10, 0xcb, 0x47, 0xc8, 0x41, 0x00, 0x00, 
+  0xf1, 0x41, 0xc3, 0x43, 0x83, 0x3a, 0x6f, 0x12, 0x3f, 0xda, 0x48, 0x31, 
+  0x00, 0x00, 0x07, 0x34, 0x12, 0x10, 0x6a, 0x15, 0x00, 0x16, 0x69, 0x15, 
+  0x01, 0x16, 0x0d, 0x70, 0x18, 0xba, 0x48, 0x30, 0x80, 0x00, 0x48, 0x31, 
+  0x81, 0x00, 0x48, 0x41, 0x04, 0x33, 0xc0, 0x93, 0xca, 0x21, 0xc5, 0x22, 
+  0x00, 0x31, 0x00, 0x20, 0x00, 0x31, 0x41, 0x20, 0x00, 0x30, 0xc0, 0x00, 
+  0x00, 0x31, 0xc6, 0x00, 0x04, 0x30, 0x00, 0x82, 0xca, 0x21, 0x8c, 0x1f, 
+  0x00, 0xbf, 0x00, 0x00, 0x01, 0x30, 0x40, 0x02, 0x55, 0x25, 0x90, 0x1e, 
+  0x04, 0x36, 0x00, 0x82, 0x48, 0x30, 0xc0, 0x02, 0xcb, 0x1d, 0x18, 0x10, 
+  0x40, 0x40, 0x05, 0xf6, 0xc3, 0x40, 0x1e, 0x00, 0xf0, 0x03, 0x7f, 0xde, 
+  0x17, 0xbe, 0x07, 0x36, 0x89, 0x14, 0x06, 0x41, 0x00, 0x25, 0x8c, 0x1f, 
+  0x00, 0x00, 0x1c, 0x03, 0x5a, 0x00, 0xf0, 0x15, 0x00, 0x31, 0x4b, 0x20, 
+  0x01, 0x36, 0x01, 0x00, 0x00, 0x31, 0xc0, 0x12, 0x48, 0x31, 0xcb, 0x02, 
+  0x00, 0x30, 0xc1, 0x00, 0xca, 0x1d, 0xd8, 0x12, 0x04, 0x31, 0x00, 0x82, 
+  0xcd, 0x1d, 0x58, 0x12, 0x04, 0xf6, 0xc3, 0x42, 0x3e, 0x00, 0xa0, 0xec, 
+  0x15, 0x00, 0x10, 0x01, 0x31, 0x81, 0x00, 0x6d, 0x70, 0x94, 0x00, 0x02, 
+  0x86, 0x00, 0xf2, 0x09, 0x00, 0x10, 0x00, 0x30, 0xc2, 0x00, 0x48, 0x31, 
+  0xc0, 0x02, 0x04, 0x32, 0xc0, 0x82, 0x14, 0xac, 0xc4, 0xf6, 0x3f, 0xd8, 
+  0x18, 0xb8, 0x05, 0xf0, 0x70, 0x00, 0x71, 0xfc, 0x15, 0x01, 0x10, 0x01, 
+  0x32, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x32, 0x41, 0x20, 0x92, 0x00, 0x60, 
+  0x00, 0x31, 0xc2, 0x00, 0x15, 0xac, 0x2e, 0x00, 0x0a, 0x2c, 0x00, 0xe0, 
+  0x71, 0x15, 0x0b, 0x16, 0x01, 0x32, 0x08, 0x00, 0x2c, 0x70, 0x48, 0x33, 
+  0x80, 0x10, 0x5e, 0x00, 0x32, 0xc6, 0x1d, 0x58, 0x5e, 0x00, 0xfa, 0x00, 
+  0x30, 0xc0, 0x12, 0x04, 0x32, 0x40, 0x80, 0x20, 0xb4, 0x22, 0xac, 0xce, 
+  0x1d, 0x18, 0x10, 0x38, 0x00, 0x00, 0x60, 0x00, 0x80, 0x00, 0x31, 0x82, 
+  0x2f, 0xcc, 0x3e, 0xcd, 0xcc, 0x60, 0x00, 0x00, 0x2a, 0x00, 0x51, 0xc8, 
+  0x1d, 0x18, 0x10, 0xc5, 0x26, 0x00, 0x15, 0x04, 0x26, 0x00, 0xf0, 0x05, 
+  0x01, 0x00, 0xa1, 0x40, 0x80, 0x20, 0x09, 0x0f, 0x48, 0x31, 0xc1, 0x02, 
+  0xb2, 0x0a, 0x6f, 0xf1, 0x20, 0x1c, 0x42, 0x10, 0x12, 0x00, 0xf0, 0x13, 
+  0x0b, 0x05, 0x2c, 0x70, 0x29, 0xda, 0x22, 0x09, 0xaf, 0xf8, 0xc0, 0x1d, 
+  0x19, 0x10, 0x18, 0x4d, 0xe0, 0xda, 0xd2, 0x0a, 0xaf, 0xea, 0x02, 0x41, 
+  0xa1, 0x41, 0x80, 0x21, 0x04, 0x07, 0x80, 0xc0, 0xc6, 0x0a, 0xd4, 0x04, 
+  0x40, 0x07, 0x37, 0x40, 0x14, 0x9c, 0x04, 0xf0, 0x11, 0x00, 0x30, 0x80, 
+  0x0f, 0xc8, 0x42, 0x00, 0x00, 0x07, 0x30, 0x90, 0x04, 0x40, 0x25, 0x12, 
+  0x1f, 0x40, 0x24, 0x00, 0x30, 0x04, 0x30, 0x80, 0xa3, 0xca, 0x20, 0x89, 
+  0x23, 0xa8, 0x20, 0x00, 0x02, 0x30, 0x05, 0x81, 0x00, 0x30, 0x41, 0x20, 
+  0x04, 0x1a, 0x50, 0x20, 0x42, 0x00, 0x41, 0x0d, 0x80, 0xc0, 0x82, 0x42, 
+  0x00, 0x00, 0x3e, 0x00, 0x2f, 0x80, 0xc0, 0x24, 0x00, 0x01, 0x5f, 0x05, 
+  0x03, 0x80, 0xc0, 0x5e, 0x24, 0x00, 0x08, 0x40, 0xc3, 0x41, 0x48, 0x42, 
+  0x4e, 0x04, 0xf0, 0x10, 0x40, 0xa0, 0xc3, 0x40, 0x48, 0x41, 0x00, 0x00, 
+  0xca, 0x21, 0x49, 0x20, 0x04, 0x31, 0x00, 0xa0, 0xca, 0x21, 0x05, 0x20, 
+  0x07, 0x37, 0x41, 0x14, 0xb4, 0x15, 0x00, 0x10, 0x04, 0x1d, 0x43, 0x34, 
+  0x01, 0xf0, 0x1a, 0x00, 0xb4, 0x1d, 0x00, 0x10, 0xcc, 0xc7, 0xe0, 0x78, 
+  0xe6, 0xc0, 0x21, 0x0a, 0xb2, 0x00, 0x8d, 0x71, 0x0a, 0x23, 0x00, 0x00, 
+  0xe3, 0x83, 0xc4, 0x83, 0xa5, 0x83, 0x85, 0x71, 0xe0, 0xa3, 0xc1, 0xa3, 
+  0xa2, 0xa3, 0xf5, 0x0c, 0xa2, 0x90, 0x0c, 0xe3, 0x30, 0x04, 0x80, 0x54, 
+  0x7a, 0x6b, 0x6a, 0x4a, 0x22, 0x00, 0x00, 0x70, 0x00, 0xf0, 0x01, 0x44, 
+  0x49, 0x15, 0x20, 0xcd, 0x00, 0x44, 0x71, 0x64, 0x71, 0x80, 0xa5, 0xc6, 
+  0xc4, 0xe0, 0x78, 0x10, 0x07, 0x80, 0x0c, 0x3b, 0x50, 0x43, 0x08, 0x46, 
+  0x8b, 0xc0, 0xea, 0x03, 0x84, 0xbe, 0x09, 0xaf, 0xea, 0x28, 0x45, 0x00, 
+  0x86, 0xea, 0x03, 0x44, 0x40, 0x24, 0x05, 0x3a, 0xea, 0x03, 0xf1, 0x0a, 
+  0xa1, 0x41, 0x62, 0x42, 0xca, 0x0d, 0xaf, 0xf1, 0x0e, 0x1c, 0x03, 0x35, 
+  0x14, 0x14, 0x10, 0x30, 0x0b, 0x08, 0x30, 0x20, 0xd1, 0x42, 0x02, 0x40, 
+  0xd2, 0xf0, 0x03, 0xf3, 0x08, 0xd1, 0x41, 0x55, 0x26, 0xcd, 0x18, 0x55, 
+  0x26, 0x94, 0x19, 0x0e, 0x70, 0x0c, 0x70, 0x80, 0x22, 0x0a, 0x2b, 0x80, 
+  0x21, 0x0a, 0x2f, 0xf1, 0xe0, 0x03, 0x11, 0xdb, 0xe0, 0x03, 0x60, 0x93, 
+  0xe0, 0x88, 0x01, 0x0d, 0x00, 0xe2, 0x03, 0xf0, 0x23, 0x14, 0xf0, 0x1a, 
+  0xf0, 0x1e, 0xf0, 0x2a, 0xf0, 0x34, 0xf0, 0x49, 0xf0, 0x51, 0xf0, 0x5b, 
+  0xf0, 0x5f, 0xf0, 0x65, 0xf0, 0x69, 0xf0, 0x6f, 0xf0, 0x73, 0xf0, 0x82, 
+  0xf0, 0x87, 0xf0, 0x92, 0xf0, 0x97, 0xf0, 0x9d, 0xf0, 0xa1, 0xf0, 0xa8, 
+  0xf0, 0x8b, 0xc0, 0xc2, 0x0a, 0xef, 0xed, 0x84, 0xc1, 0x02, 0xa6, 0x0c, 
+  0x00, 0x11, 0xb6, 0x0c, 0x00, 0xc0, 0x00, 0xa5, 0xa2, 0xf0, 0x8b, 0xc0, 
+  0x9e, 0x0d, 0xef, 0xf5, 0x84, 0xc1, 0xa8, 0x01, 0xf9, 0x00, 0x80, 0x40, 
+  0x00, 0x00, 0x7a, 0x1d, 0x18, 0x10, 0x01, 0xa5, 0x96, 0xf0, 0x8b, 0xc0, 
+  0x86, 0x18, 0x00, 0xf0, 0x07, 0x80, 0x1d, 0x18, 0x10, 0x02, 0xa5, 0x8a, 
+  0xf0, 0x8b, 0xc0, 0x84, 0xc1, 0x80, 0xc2, 0xd6, 0x0f, 0xef, 0xf5, 0x40, 
+  0x24, 0x15, 0x30, 0x16, 0x01, 0x21, 0x82, 0x40, 0x60, 0x05, 0x30, 0x15, 
+  0x01, 0x24, 0x60, 0x05, 0x00, 0x2c, 0x00, 0x00, 0x60, 0x05, 0x59, 0x74, 
+  0xf0, 0x8b, 0xc0, 0x42, 0x42, 0x00, 0x79, 0x07, 0xa5, 0x6a, 0xf0, 0x8b, 
+  0xc0, 0x2e, 0x14, 0x00, 0x71, 0x1b, 0xa5, 0x60, 0xf0, 0x8b, 0xc0, 0x26, 
+  0x8e, 0x00, 0x71, 0x0a, 0xa5, 0x5a, 0xf0, 0x8b, 0xc0, 0x1a, 0x0c, 0x00, 
+  0x71, 0x0f, 0xa5, 0x54, 0xf0, 0x8b, 0xc0, 0x0e, 0x0c, 0x00, 0x71, 0x13, 
+  0xa5, 0x4e, 0xf0, 0x8b, 0xc0, 0x02, 0x0c, 0x00, 0x80, 0x16, 0xa5, 0x48, 
+  0xf0, 0x8b, 0xc0, 0xf6, 0x09, 0x0c, 0x00, 0x31, 0x1d, 0xa5, 0x42, 0x8e, 
+  0x00, 0x44, 0xda, 0x0e, 0x2f, 0xf7, 0xa4, 0x04, 0xf1, 0x03, 0xa7, 0x1e, 
+  0x98, 0x10, 0xa8, 0x1e, 0x58, 0x10, 0xa9, 0x1e, 0x18, 0x10, 0x34, 0xf0, 
+  0x8b, 0xc0, 0xea, 0x0a, 0x6a, 0x04, 0x41, 0x19, 0x02, 0x20, 0x2c, 0x2c, 
+  0x00, 0x42, 0xfa, 0x09, 0x6f, 0xfa, 0xb0, 0x04, 0x70, 0x1e, 0x08, 0xaf, 
+  0xea, 0x42, 0x40, 0x22, 0x00, 0x01, 0x10, 0x0c, 0x92, 0x00, 0x51, 0x87, 
+  0x1d, 0x18, 0x10, 0x1a, 0x1a, 0x01, 0x00, 0x32, 0x00, 0x71, 0x0c, 0xae, 
+  0x14, 0xf0, 0x8b, 0xc0, 0x8e, 0x68, 0x00, 0x71, 0x10, 0xa5, 0x0e, 0xf0, 
+  0x8b, 0xc0, 0x76, 0x26, 0x00, 0x91, 0x96, 0x1d, 0x18, 0x10, 0x08, 0xf0, 
+  0x8b, 0xc0, 0x6a, 0x0e, 0x00, 0x42, 0x97, 0x1d, 0x18, 0x10, 0xc2, 0x04, 
+  0xa2, 0x72, 0x70, 0xca, 0x20, 0x4d, 0x20, 0x2c, 0x71, 0x3c, 0x23, 0xc2, 
+  0x04, 0x80, 0x2a, 0xf1, 0xf6, 0xc3, 0x82, 0x24, 0x02, 0x39, 0x20, 0x01, 
+  0xf0, 0x0d, 0x10, 0x41, 0x0a, 0x27, 0x80, 0x21, 0x0a, 0x26, 0x40, 0x21, 
+  0x0a, 0x25, 0x00, 0x21, 0x68, 0x46, 0x48, 0x47, 0x08, 0x45, 0x55, 0x20, 
+  0x90, 0x08, 0x80, 0x21, 0x0b, 0x24, 0xbc, 0x02, 0xa0, 0x80, 0x02, 0x04, 
+  0x11, 0x02, 0x04, 0x00, 0x32, 0x82, 0x0f, 0x92, 0x03, 0xf0, 0x85, 0x04, 
+  0x18, 0x90, 0x00, 0x12, 0x0a, 0xef, 0xf3, 0x80, 0xc0, 0xa8, 0x4d, 0x8b, 
+  0xc0, 0x78, 0xda, 0x76, 0x0f, 0x6f, 0xea, 0x30, 0x42, 0x06, 0x42, 0x8b, 
+  0xc0, 0x62, 0x0d, 0xef, 0xff, 0x80, 0xc1, 0x8b, 0xc1, 0x78, 0xda, 0x62, 
+  0x0f, 0x6f, 0xea, 0x42, 0x40, 0x3a, 0x0f, 0x20, 0x00, 0xa1, 0x40, 0x2c, 
+  0x8d, 0x10, 0x44, 0x0b, 0xe9, 0x02, 0x85, 0x13, 0x08, 0xf3, 0x00, 0x80, 
+  0xc1, 0xa1, 0x40, 0xfe, 0x08, 0x60, 0x00, 0x82, 0x42, 0x10, 0x43, 0x04, 
+  0xf0, 0x6e, 0x70, 0xee, 0x19, 0x03, 0xa1, 0xec, 0x11, 0x81, 0xa0, 0x0d, 
+  0x8d, 0x34, 0x70, 0x10, 0x42, 0xca, 0x22, 0x22, 0x20, 0x76, 0x70, 0xca, 
+  0x22, 0x01, 0x20, 0xa1, 0x40, 0xb2, 0x09, 0x20, 0x00, 0x42, 0x41, 0x04, 
+  0x37, 0x80, 0x9f, 0x1c, 0x44, 0x00, 0x40, 0x79, 0x26, 0x00, 0x10, 0xc5, 
+  0x20, 0x66, 0x00, 0x78, 0x23, 0x01, 0x20, 0x24, 0x78, 0x52, 0x20, 0x01, 
+  0x00, 0x7a, 0x0b, 0x60, 0x00, 0xa1, 0x40, 0xa9, 0x46, 0x80, 0x26, 0x0a, 
+  0x10, 0x08, 0x47, 0x58, 0x00, 0xf0, 0x35, 0xc1, 0x42, 0xda, 0x0f, 0x20, 
+  0x00, 0x42, 0x43, 0xee, 0x11, 0x83, 0xa0, 0x22, 0x85, 0x4e, 0x70, 0x78, 
+  0x23, 0x82, 0x00, 0x7f, 0x21, 0x41, 0x00, 0x4b, 0x79, 0x04, 0xf4, 0x65, 
+  0x0b, 0x11, 0x01, 0xed, 0x11, 0x81, 0xa0, 0x1e, 0xe9, 0x79, 0x27, 0x02, 
+  0x10, 0x79, 0x20, 0x00, 0x00, 0x56, 0x25, 0x4f, 0x18, 0x04, 0x7a, 0xa1, 
+  0x40, 0x62, 0x43, 0x72, 0x0e, 0x20, 0x00, 0xe1, 0x41, 0x00, 0x42, 0xa1, 
+  0x40, 0xca, 0x0d, 0x0a, 0x00, 0xf0, 0x41, 0x10, 0x42, 0x1a, 0xe8, 0x40, 
+  0x86, 0x21, 0x86, 0x02, 0x86, 0x60, 0x18, 0x80, 0x20, 0x64, 0x18, 0x40, 
+  0x20, 0x68, 0x18, 0x00, 0x20, 0x10, 0xf0, 0x01, 0xc2, 0x02, 0xc1, 0x1e, 
+  0x40, 0x00, 0xc3, 0x44, 0xc2, 0x45, 0xc1, 0x46, 0xc0, 0x56, 0x25, 0x00, 
+  0x1d, 0x83, 0xc1, 0x10, 0xda, 0x7a, 0x0e, 0x6f, 0xea, 0x43, 0xc3, 0xed, 
+  0x19, 0x43, 0xa0, 0x0f, 0x0b, 0x30, 0x20, 0xa1, 0x40, 0xed, 0x70, 0x0e, 
+  0x1d, 0x03, 0x10, 0x04, 0xf0, 0x5e, 0x09, 0x00, 0x00, 0x08, 0x47, 0x02, 
+  0x86, 0x6d, 0x8d, 0x4c, 0x00, 0xf0, 0x1d, 0x81, 0x10, 0x0e, 0x26, 0x56, 
+  0x70, 0x8a, 0x24, 0x3e, 0x10, 0xca, 0x24, 0x21, 0x10, 0x76, 0x70, 0x42, 
+  0xc0, 0x38, 0x23, 0xc0, 0x03, 0xcf, 0x24, 0x62, 0x10, 0x40, 0xc2, 0x41, 
+  0xc1, 0x00, 0x1f, 0x02, 0x23, 0x94, 0xe8, 0x85, 0x24, 0x42, 0x10, 0x13, 
+  0x0f, 0xf1, 0x10, 0x0e, 0x00, 0xf0, 0x05, 0x02, 0x11, 0x00, 0x21, 0x00, 
+  0x19, 0x04, 0x20, 0x08, 0xf0, 0xa1, 0x40, 0x56, 0x25, 0x81, 0x1f, 0xba, 
+  0x0b, 0x6f, 0xf5, 0xd8, 0x04, 0xf0, 0x03, 0x04, 0x8d, 0xed, 0xad, 0x03, 
+  0xe8, 0x04, 0x1d, 0x03, 0x10, 0x00, 0x11, 0x00, 0x21, 0x43, 0x08, 0x71, 
+  0x00, 0x6e, 0x04, 0xf1, 0x07, 0x0b, 0x05, 0x83, 0xc0, 0x10, 0xda, 0xee, 
+  0x0d, 0x6f, 0xea, 0x40, 0x24, 0x10, 0x33, 0x4a, 0x24, 0x00, 0x71, 0x40, 
+  0x24, 0x00, 0x37, 0xb8, 0x01, 0x12, 0x10, 0xf4, 0x02, 0x20, 0xcc, 0x3d, 
+  0xb8, 0x01, 0x20, 0x50, 0x00, 0x4c, 0x00, 0xc0, 0x6e, 0x0b, 0x6f, 0xf5, 
+  0x87, 0xc0, 0x0c, 0x70, 0x02, 0xf0, 0x04, 0x77, 0xfe, 0x01, 0x00, 0x68, 
+  0x00, 0x62, 0x80, 0xc0, 0xc3, 0x41, 0x20, 0x40, 0x38, 0x04, 0x20, 0x04, 
+  0x10, 0xec, 0x01, 0xf2, 0x2d, 0x42, 0x00, 0x04, 0x1d, 0x90, 0x20, 0x00, 
+  0x36, 0x40, 0x10, 0x48, 0x37, 0x02, 0x10, 0x00, 0x1d, 0x80, 0x20, 0x00, 
+  0x1e, 0x00, 0x20, 0x00, 0x17, 0x80, 0x20, 0x00, 0x34, 0x41, 0x20, 0xc6, 
+  0xb8, 0x48, 0x30, 0x00, 0x00, 0x08, 0x1e, 0x40, 0x20, 0x04, 0x1e, 0x00, 
+  0x20, 0xd6, 0xc7, 0xe4, 0xc3, 0xb4, 0xc1, 0x65, 0x09, 0xf1, 0x00, 0x08, 
+  0x45, 0x04, 0x8d, 0x2e, 0xe8, 0x94, 0x00, 0xa0, 0x90, 0xc0, 0x10, 0xda, 
+  0x5a, 0x0d, 0x6f, 0xea, 0x90, 0xc6, 0x92, 0x00, 0x80, 0xe0, 0x78, 0xa8, 
+  0x20, 0x40, 0x02, 0x00, 0x86, 0x58, 0x03, 0x01, 0x8e, 0x00, 0xe1, 0x1e, 
+  0x10, 0x10, 0x80, 0xc0, 0x2c, 0x70, 0x40, 0xda, 0x7a, 0x0b, 0x6f, 0xf8, 
+  0x80, 0x24, 0x00, 0x10, 0x90, 0x6c, 0x02, 0x10, 0x01, 0x28, 0x05, 0xb0, 
+  0x14, 0x1e, 0x50, 0x10, 0x56, 0x25, 0x80, 0x1f, 0x80, 0xc1, 0x1a, 0xd6, 
+  0x00, 0xd0, 0xda, 0x80, 0x25, 0x0b, 0x14, 0x00, 0x1d, 0x05, 0x10, 0xc4, 
+  0xc7, 0xe0, 0x78, 0x6c, 0x00, 0xf1, 0x00, 0x08, 0x45, 0x56, 0x20, 0x81, 
+  0x0d, 0x84, 0xc0, 0x40, 0xda, 0xfa, 0x0c, 0x6f, 0xea, 0x84, 0x3e, 0x00, 
+  0x21, 0x80, 0xc4, 0xac, 0x02, 0x50, 0x01, 0x14, 0x16, 0x01, 0x14, 0xec, 
+  0x00, 0xf0, 0x18, 0x00, 0xc3, 0x2c, 0x71, 0x4a, 0x20, 0x40, 0x00, 0x02, 
+  0x4c, 0x0c, 0x72, 0x04, 0x32, 0xc0, 0x80, 0xca, 0x23, 0x89, 0x00, 0x34, 
+  0x70, 0x2c, 0x70, 0xf8, 0xf5, 0xa6, 0x15, 0x00, 0x16, 0x2c, 0x73, 0x04, 
+  0x33, 0x00, 0x80, 0x8d, 0xf7, 0xa5, 0x0c, 0x00, 0x10, 0x72, 0x0c, 0x00, 
+  0x60, 0x87, 0xf7, 0xa4, 0x15, 0x00, 0x16, 0x0a, 0x00, 0x60, 0x6f, 0x21, 
+  0x0b, 0x00, 0x2f, 0x78, 0x6c, 0x00, 0xf0, 0x0b, 0xf0, 0xc3, 0xa8, 0xc1, 
+  0x08, 0x46, 0x00, 0x80, 0x60, 0x44, 0x40, 0x24, 0xc3, 0x33, 0x40, 0x24, 
+  0x05, 0x34, 0x40, 0x24, 0x86, 0x33, 0x50, 0x42, 0x30, 0x40, 0x02, 0x05, 
+  0xf0, 0x25, 0x06, 0x09, 0xaf, 0xf1, 0x0f, 0x1c, 0x03, 0x35, 0x0e, 0x14, 
+  0x80, 0x30, 0xd1, 0x43, 0x0a, 0x24, 0x80, 0x23, 0x8a, 0x21, 0x0a, 0x2f, 
+  0x55, 0x26, 0x8f, 0x19, 0x80, 0x23, 0x0a, 0x27, 0x80, 0x24, 0x0a, 0x2b, 
+  0x0f, 0x14, 0x81, 0x30, 0x0f, 0x78, 0x30, 0x70, 0x06, 0x01, 0x2d, 0x00, 
+  0x04, 0x77, 0xeb, 0x08, 0x15, 0x05, 0x12, 0x05, 0xf0, 0x2f, 0x15, 0xf0, 
+  0x15, 0xf0, 0x17, 0xf0, 0x17, 0xf0, 0x19, 0xf0, 0x33, 0xf0, 0x35, 0xf0, 
+  0x3e, 0xf0, 0x40, 0xf0, 0x40, 0xf0, 0x42, 0xf0, 0x42, 0xf0, 0x44, 0xf0, 
+  0x49, 0xf0, 0x4c, 0xf0, 0x51, 0xf0, 0x54, 0xf0, 0x59, 0xf0, 0x65, 0xf0, 
+  0x66, 0xf0, 0x02, 0x86, 0x56, 0xf0, 0x00, 0x85, 0x54, 0xf0, 0x01, 0x85, 
+  0x22, 0xf0, 0x02, 0x85, 0x20, 0xf0, 0x21, 0x87, 0x02, 0x87, 0x40, 0x87, 
+  0xb4, 0x01, 0xc8, 0x41, 0xc1, 0x42, 0xc0, 0x80, 0xc1, 0x85, 0xc0, 0x00, 
+  0x1c, 0x80, 0x30, 0xa0, 0x03, 0x20, 0x80, 0x3e, 0xdc, 0x04, 0xf1, 0x07, 
+  0x90, 0x00, 0x85, 0xc0, 0x84, 0xc3, 0x02, 0x41, 0xee, 0x0a, 0xef, 0xf5, 
+  0x42, 0x42, 0x39, 0xf0, 0x07, 0x85, 0x02, 0xf0, 0x1b, 0x85, 0xd2, 0x04, 
+  0x30, 0x3e, 0x00, 0x00, 0x1a, 0x00, 0x20, 0x66, 0x08, 0x1a, 0x00, 0xf0, 
+  0x31, 0x2d, 0xf0, 0x0a, 0x85, 0x26, 0xf0, 0x0f, 0x85, 0x24, 0xf0, 0x13, 
+  0x85, 0x22, 0xf0, 0x16, 0x85, 0x20, 0xf0, 0x1d, 0x85, 0x1e, 0xf0, 0x84, 
+  0xc3, 0x62, 0x40, 0x02, 0x41, 0x42, 0x0a, 0x2f, 0xf7, 0x42, 0x42, 0x1b, 
+  0xf0, 0x32, 0x26, 0x40, 0x14, 0x0d, 0xf0, 0x84, 0xc3, 0x82, 0x40, 0x02, 
+  0x41, 0x7a, 0x0d, 0x2f, 0xfa, 0x42, 0x42, 0x11, 0xf0, 0x87, 0x15, 0x00, 
+  0x16, 0xde, 0xf1, 0x0c, 0x8e, 0x4a, 0x00, 0xa0, 0x36, 0x0e, 0x6f, 0xf8, 
+  0x42, 0x42, 0x07, 0xf0, 0x10, 0x85, 0x0e, 0x00, 0x60, 0x1a, 0x0d, 0xaf, 
+  0xed, 0x42, 0x42, 0x10, 0x01, 0xf0, 0x37, 0x04, 0x71, 0x0e, 0x1c, 0x02, 
+  0x30, 0x80, 0xf1, 0x96, 0x15, 0x00, 0x16, 0xc8, 0xf1, 0x97, 0x15, 0x00, 
+  0x16, 0xc4, 0xf1, 0x04, 0xc0, 0x41, 0x28, 0x01, 0x02, 0x00, 0x18, 0x02, 
+  0x20, 0x01, 0x18, 0x42, 0x20, 0xd0, 0xc7, 0xe0, 0x78, 0xe8, 0xc3, 0xa3, 
+  0xc1, 0x50, 0x40, 0x28, 0x46, 0x2c, 0x70, 0x10, 0xda, 0x60, 0x40, 0x88, 
+  0x45, 0x6e, 0x09, 0x6f, 0xf8, 0x68, 0x47, 0x4c, 0x70, 0xc3, 0x41, 0x13, 
+  0x00, 0x9c, 0x60, 0x1e, 0xee, 0xec, 0x00, 0xf0, 0x0b, 0xa8, 0x20, 0xc0, 
+  0x02, 0x04, 0x11, 0x03, 0x04, 0x40, 0x24, 0x40, 0x31, 0x5c, 0x60, 0x44, 
+  0x71, 0x38, 0x23, 0x00, 0x04, 0x00, 0xac, 0xaa, 0x09, 0x2f, 0xf5, 0x12, 
+  0x00, 0xf1, 0x07, 0x30, 0xe8, 0xcd, 0x74, 0x03, 0x1f, 0xc3, 0x10, 0x02, 
+  0x1f, 0x43, 0x14, 0x01, 0x1f, 0x83, 0x13, 0x00, 0x1f, 0x43, 0x11, 0x27, 
+  0xf0, 0x04, 0x03, 0x32, 0x21, 0x01, 0x03, 0x1c, 0x01, 0x46, 0x03, 0x04, 
+  0x82, 0xc0, 0x3a, 0x00, 0xf6, 0x4c, 0x3e, 0x0c, 0xaf, 0xf3, 0x82, 0xc0, 
+  0x26, 0xe8, 0x08, 0xde, 0x07, 0x1f, 0x83, 0x13, 0x06, 0x1f, 0x43, 0x13, 
+  0x05, 0x1f, 0x83, 0x10, 0x04, 0x1f, 0x83, 0x11, 0x03, 0x1f, 0xc3, 0x11, 
+  0x02, 0x1f, 0x43, 0x11, 0x01, 0x1f, 0x03, 0x11, 0x00, 0x1f, 0x43, 0x10, 
+  0x15, 0xf0, 0xcd, 0x70, 0x78, 0x20, 0xc0, 0x2c, 0x78, 0x20, 0x01, 0x2e, 
+  0x03, 0x1c, 0x02, 0x30, 0x40, 0x24, 0xc0, 0x30, 0xd2, 0x09, 0xef, 0xf5, 
+  0x61, 0xc1, 0x07, 0xe8, 0xd8, 0x67, 0xc5, 0x71, 0x00, 0x18, 0x83, 0x03, 
+  0x03, 0xf0, 0xcd, 0x70, 0xc0, 0xa5, 0xc8, 0xc7, 0xe0, 0x78, 0xf8, 0xc3, 
+  0xb2, 0x2c, 0x02, 0xf0, 0x0b, 0x30, 0x40, 0x24, 0x05, 0x31, 0x40, 0x24, 
+  0x86, 0x30, 0x50, 0x41, 0x28, 0x45, 0x55, 0x26, 0xcf, 0x1a, 0xda, 0x0e, 
+  0x6f, 0xf1, 0x03, 0x1c, 0xc3, 0x35, 0x02, 0x2c, 0x02, 0x32, 0x40, 0xd1, 
+  0x42, 0x30, 0x02, 0xf3, 0x12, 0x56, 0x26, 0x95, 0x1d, 0x55, 0x26, 0x96, 
+  0x1e, 0x56, 0x26, 0x57, 0x18, 0x56, 0x26, 0x18, 0x1d, 0x80, 0x20, 0x0b, 
+  0x24, 0x80, 0x22, 0x0a, 0x20, 0x80, 0x23, 0x0b, 0x22, 0x80, 0x24, 0x0b, 
+  0x25, 0x03, 0x40, 0x02, 0x11, 0x1c, 0x40, 0x02, 0x33, 0x96, 0xe0, 0x08, 
+  0x54, 0x07, 0xf0, 0x91, 0x17, 0xf0, 0x1a, 0xf0, 0x1b, 0xf0, 0x22, 0xf0, 
+  0x22, 0xf0, 0x24, 0xf0, 0x25, 0xf0, 0x28, 0xf0, 0x28, 0xf0, 0x2a, 0xf0, 
+  0x2a, 0xf0, 0x2c, 0xf0, 0x2c, 0xf0, 0x33, 0xf0, 0x3d, 0xf0, 0x40, 0xf0, 
+  0x46, 0xf0, 0x4d, 0xf0, 0x4e, 0xf0, 0x56, 0xf0, 0x5b, 0xf0, 0x5e, 0xf0, 
+  0x64, 0xf0, 0x81, 0xc3, 0x42, 0x40, 0x07, 0xf0, 0x81, 0xc3, 0xc2, 0x40, 
+  0x03, 0xf0, 0x81, 0xc3, 0xe2, 0x40, 0xa1, 0x41, 0xd2, 0x08, 0xef, 0xf5, 
+  0x22, 0x42, 0x5e, 0xf0, 0x0d, 0x8e, 0x2c, 0xf0, 0x0e, 0x8e, 0x2a, 0xf0, 
+  0xed, 0x10, 0x80, 0xa0, 0x26, 0xf0, 0x78, 0x17, 0x00, 0x16, 0x36, 0xf0, 
+  0x16, 0x87, 0x29, 0xf0, 0x03, 0x87, 0x27, 0xf0, 0x09, 0x87, 0x25, 0xf0, 
+  0x0c, 0x87, 0x23, 0xf0, 0x00, 0x87, 0x21, 0xf0, 0x81, 0xc3, 0x03, 0x40, 
+  0xa1, 0x41, 0x22, 0x0d, 0xaf, 0xf8, 0x22, 0x42, 0x42, 0xf0, 0x82, 0xc0, 
+  0x40, 0xda, 0x82, 0x09, 0x6f, 0xea, 0xa2, 0x41, 0x82, 0xc0, 0x81, 0xc3, 
+  0xa1, 0x41, 0xe6, 0x08, 0x6f, 0xf5, 0x22, 0x42, 0x36, 0xf0, 0xee, 0x10, 
+  0x80, 0xa0, 0x04, 0xf0, 0xef, 0x10, 0x80, 0xa0, 0x16, 0x00, 0xa0, 0xee, 
+  0x0f, 0x2f, 0xf3, 0x22, 0x42, 0x2c, 0xf0, 0x04, 0x87, 0x0e, 0x00, 0xf0, 
+  0x03, 0x02, 0x0b, 0xaf, 0xed, 0x22, 0x42, 0x24, 0xf0, 0x85, 0x17, 0x00, 
+  0x16, 0x04, 0xf0, 0x86, 0x17, 0x00, 0x16, 0x16, 0x00, 0xf0, 0x11, 0xde, 
+  0x0d, 0xaf, 0xf5, 0x22, 0x42, 0x1a, 0xf0, 0x81, 0xc3, 0x62, 0x40, 0xa1, 
+  0x41, 0x9e, 0x0f, 0xef, 0xf4, 0x22, 0x42, 0x12, 0xf0, 0x00, 0x10, 0x00, 
+  0x21, 0x04, 0xf0, 0x02, 0x10, 0x00, 0x21, 0x24, 0x00, 0xf0, 0x05, 0xba, 
+  0x0c, 0xaf, 0xf4, 0x22, 0x42, 0x08, 0xf0, 0x81, 0xc3, 0x82, 0x40, 0xa1, 
+  0x41, 0xf6, 0x0a, 0x2f, 0xfa, 0x22, 0x42, 0x46, 0x01, 0x92, 0x04, 0x71, 
+  0x02, 0x1c, 0x02, 0x30, 0x70, 0xf1, 0x01, 0x56, 0x02, 0xf2, 0x14, 0xad, 
+  0x21, 0xad, 0xd8, 0xc7, 0xa1, 0x01, 0x40, 0x01, 0xe4, 0xc3, 0xa7, 0xc1, 
+  0x08, 0x45, 0x99, 0x0a, 0x30, 0x00, 0x0c, 0x70, 0x47, 0x15, 0x02, 0x16, 
+  0x8d, 0x0a, 0x12, 0x01, 0x60, 0x81, 0x41, 0x81, 0x22, 0x81, 0xb6, 0x05, 
+  0xf0, 0x09, 0x45, 0xc1, 0x83, 0xc1, 0x43, 0xc3, 0x9a, 0x09, 0x2f, 0xec, 
+  0x44, 0xc2, 0x68, 0x15, 0x02, 0x16, 0x69, 0x15, 0x01, 0x16, 0x6a, 0x15, 
+  0x00, 0x16, 0x6c, 0x02, 0xf1, 0x29, 0x3f, 0xde, 0x40, 0xc2, 0x80, 0xc2, 
+  0x18, 0xbe, 0x6d, 0x70, 0x41, 0xc1, 0x08, 0x1c, 0x00, 0x30, 0xa8, 0x20, 
+  0x00, 0x04, 0x20, 0x82, 0xc1, 0x40, 0x04, 0x31, 0xc0, 0x82, 0xcf, 0x20, 
+  0xec, 0x07, 0x01, 0x31, 0x00, 0x00, 0x48, 0x30, 0xc0, 0x02, 0x48, 0x30, 
+  0x80, 0x00, 0x04, 0x1a, 0x10, 0x00, 0x6b, 0x15, 0x01, 0x16, 0x00, 0xc3, 
+  0x01, 0xc2, 0x20, 0x00, 0xf2, 0x13, 0x26, 0xec, 0x17, 0x01, 0x31, 0x81, 
+  0x03, 0x02, 0xc4, 0x48, 0x31, 0xc1, 0x02, 0x0c, 0x71, 0x48, 0x31, 0x81, 
+  0x00, 0xa0, 0x1d, 0xd8, 0x10, 0xa1, 0x1d, 0x98, 0x10, 0xa2, 0x1d, 0x18, 
+  0x13, 0xa3, 0x1d, 0x58, 0xc0, 0x04, 0xf0, 0x40, 0xc2, 0x68, 0x46, 0x08, 
+  0x45, 0x0c, 0x70, 0x06, 0xea, 0xa1, 0x40, 0x36, 0x08, 0x2f, 0xec, 0x80, 
+  0x20, 0x04, 0x05, 0x05, 0xee, 0x67, 0x1d, 0x59, 0x10, 0x47, 0x1d, 0x19, 
+  0x10, 0xc4, 0xc6, 0xec, 0xc3, 0xac, 0xc1, 0x08, 0x45, 0x04, 0x80, 0x88, 
+  0x15, 0x10, 0x10, 0x25, 0x85, 0x40, 0xc0, 0x06, 0x85, 0x7f, 0xde, 0x17, 
+  0xbe, 0x42, 0xc0, 0x42, 0x20, 0x40, 0x20, 0x48, 0x30, 0x88, 0x20, 0x48, 
+  0x30, 0x8b, 0x00, 0x2d, 0x08, 0xb2, 0x20, 0x41, 0xc1, 0x40, 0x25, 0x02, 
+  0x17, 0x2c, 0x72, 0xb8, 0x00, 0x20, 0x40, 0x24, 0xac, 0x00, 0xf0, 0x0b, 
+  0x40, 0x02, 0x80, 0x80, 0x04, 0x12, 0x03, 0x04, 0x01, 0x33, 0x03, 0x03, 
+  0x04, 0x18, 0xd0, 0x00, 0x12, 0x71, 0x24, 0x71, 0xb2, 0xf6, 0x07, 0x36, 
+  0x08, 0x12, 0x24, 0x00, 0xf0, 0x2d, 0x4a, 0x21, 0x00, 0x00, 0x07, 0x36, 
+  0xd1, 0x12, 0xa8, 0x20, 0x40, 0x04, 0x80, 0xc3, 0x35, 0x7b, 0x00, 0x83, 
+  0x15, 0x25, 0x4c, 0x10, 0x44, 0x84, 0x00, 0x30, 0x00, 0x10, 0x89, 0xc6, 
+  0x02, 0x32, 0x02, 0x00, 0x35, 0x7e, 0x24, 0x71, 0x00, 0xa3, 0x40, 0xa6, 
+  0x89, 0xc0, 0x83, 0xc1, 0x7a, 0x0c, 0x6f, 0xf8, 0x83, 0xc6, 0x61, 0x08, 
+  0xb2, 0x20, 0x4a, 0x27, 0x80, 0x10, 0x40, 0x00, 0x70, 0x14, 0x27, 0xc0, 
+  0x13, 0x4b, 0x68, 0x0c, 0x90, 0x03, 0xf0, 0x18, 0x03, 0x80, 0xc1, 0x15, 
+  0x25, 0x83, 0x10, 0x04, 0x49, 0x10, 0x13, 0x0b, 0x00, 0x89, 0xc3, 0x15, 
+  0x7b, 0x02, 0x33, 0x01, 0x13, 0x04, 0x71, 0x44, 0x71, 0x20, 0xa3, 0x89, 
+  0xc0, 0x86, 0xc1, 0x3e, 0x0c, 0x6f, 0xf8, 0x40, 0x24, 0x12, 0x36, 0x36, 
+  0x00, 0x20, 0x83, 0xc0, 0x98, 0x00, 0xa0, 0x40, 0x80, 0x04, 0x12, 0x01, 
+  0x24, 0x01, 0x31, 0x81, 0x00, 0x9a, 0x05, 0x91, 0x12, 0x77, 0xb0, 0x07, 
+  0xeb, 0xff, 0x40, 0x27, 0x4f, 0x58, 0x00, 0xf0, 0x15, 0xa8, 0x20, 0xc0, 
+  0x01, 0x00, 0x86, 0x00, 0x31, 0x02, 0x20, 0x04, 0x1e, 0x90, 0x10, 0x04, 
+  0xc1, 0x03, 0xc0, 0x01, 0x30, 0x40, 0x00, 0x01, 0x30, 0x80, 0x00, 0x2f, 
+  0x30, 0x00, 0x00, 0xcc, 0xc7, 0xe8, 0xc3, 0xa6, 0xc1, 0x28, 0x00, 0x60, 
+  0x70, 0x40, 0x08, 0x45, 0x4a, 0x20, 0xa4, 0x06, 0xf0, 0x06, 0x80, 0x02, 
+  0x07, 0x4a, 0x06, 0x49, 0x83, 0xc4, 0x15, 0x7c, 0x02, 0x36, 0xc3, 0x13, 
+  0x04, 0x71, 0x60, 0xa4, 0x83, 0xc0, 0xca, 0x46, 0x06, 0xf0, 0x48, 0xc1, 
+  0xee, 0x0a, 0x2f, 0xf9, 0x80, 0xc0, 0x0f, 0x08, 0xf1, 0x20, 0x2f, 0x31, 
+  0x00, 0x10, 0x04, 0x8d, 0x07, 0xe8, 0x0c, 0x71, 0xb1, 0x1d, 0x58, 0x12, 
+  0xb0, 0x1d, 0x58, 0x12, 0xc8, 0xc7, 0xb2, 0x15, 0x00, 0x16, 0x7f, 0xda, 
+  0xb3, 0x15, 0x01, 0x16, 0xb0, 0x15, 0x03, 0x16, 0x17, 0xba, 0x00, 0x31, 
+  0x0c, 0x10, 0x02, 0x32, 0x00, 0x00, 0xb1, 0x15, 0x0b, 0x16, 0x00, 0x31, 
+  0x48, 0x10, 0x02, 0x32, 0x41, 0x00, 0x00, 0x30, 0xc0, 0x00, 0x01, 0x34, 
+  0x02, 0x10, 0x00, 0x31, 0xc0, 0x02, 0xb0, 0x1d, 0x98, 0x10, 0x01, 0x30, 
+  0x03, 0x10, 0x44, 0x00, 0x20, 0xd8, 0x10, 0x84, 0x06, 0xf2, 0x14, 0x20, 
+  0x95, 0x05, 0xe9, 0x24, 0x77, 0x20, 0xb5, 0xc8, 0xc7, 0x02, 0x32, 0xc1, 
+  0x00, 0xbf, 0xb9, 0x04, 0x31, 0x80, 0x8f, 0x80, 0x40, 0x00, 0x00, 0xcf, 
+  0xf6, 0x02, 0x31, 0x81, 0x10, 0xc3, 0x42, 0x40, 0x41, 0x00, 0x16, 0x00, 
+  0x72, 0x80, 0x09, 0xf6, 0x02, 0x31, 0xc1, 0x10, 0x0c, 0x00, 0x60, 0x88, 
+  0x07, 0xcc, 0xff, 0x0c, 0x70, 0x24, 0x04, 0xf0, 0x11, 0xee, 0xc3, 0xa7, 
+  0xc1, 0x30, 0x40, 0x10, 0x41, 0x55, 0x20, 0x0d, 0x09, 0x08, 0x46, 0x84, 
+  0xc1, 0x02, 0x40, 0x50, 0x43, 0x80, 0x26, 0xca, 0x1f, 0x0a, 0x0a, 0xaf, 
+  0xf4, 0x40, 0x24, 0x12, 0x34, 0xe8, 0x00, 0x20, 0xed, 0x70, 0x64, 0x01, 
+  0xf0, 0x0b, 0x40, 0x04, 0x15, 0x21, 0x03, 0x20, 0xf0, 0x22, 0x01, 0x20, 
+  0x98, 0x13, 0x03, 0x00, 0x40, 0x24, 0x42, 0x33, 0x1a, 0x62, 0x04, 0x31, 
+  0xc0, 0x80, 0x04, 0x71, 0x9e, 0x06, 0xf0, 0x4d, 0x20, 0xaa, 0x56, 0x0b, 
+  0xaf, 0xf2, 0x40, 0x24, 0x40, 0x33, 0xff, 0x16, 0x81, 0x90, 0x1f, 0xe8, 
+  0x34, 0x76, 0x52, 0x02, 0x0d, 0x00, 0x24, 0x20, 0x40, 0x00, 0x1f, 0x00, 
+  0x00, 0x00, 0x47, 0x02, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3f, 0x02, 
+  0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x13, 0x01, 
+  0x00, 0x00, 0x13, 0x85, 0x34, 0x85, 0xe0, 0xae, 0x30, 0x70, 0x80, 0x01, 
+  0x2a, 0x00, 0x04, 0x71, 0x1b, 0x02, 0x20, 0x00, 0x13, 0xa5, 0x09, 0x09, 
+  0x50, 0x01, 0x20, 0xae, 0xff, 0x1e, 0x43, 0x91, 0xe7, 0xa5, 0x0c, 0x71, 
+  0xce, 0xc7, 0x0d, 0x11, 0xea, 0x07, 0xf1, 0x01, 0x83, 0x10, 0x14, 0x73, 
+  0xfa, 0x01, 0x22, 0x00, 0x0c, 0x70, 0xff, 0x1e, 0x03, 0x91, 0xce, 0xc7, 
+  0x40, 0x02, 0xf0, 0x1a, 0x20, 0x00, 0x00, 0x00, 0x1e, 0x03, 0x11, 0xa8, 
+  0x20, 0x80, 0x03, 0x15, 0x21, 0x01, 0x20, 0xf0, 0x20, 0x03, 0x20, 0xe8, 
+  0x11, 0x01, 0x00, 0x80, 0xc2, 0x15, 0x7a, 0x02, 0x33, 0x41, 0x00, 0x04, 
+  0x71, 0x20, 0xa2, 0x80, 0xc0, 0x84, 0xc1, 0x3e, 0x09, 0xcc, 0x00, 0x40, 
+  0x10, 0x34, 0x80, 0x85, 0x36, 0x00, 0x01, 0xcc, 0x00, 0xf4, 0x00, 0x03, 
+  0x04, 0x10, 0x03, 0x24, 0x40, 0x24, 0x41, 0x33, 0x1a, 0x61, 0x04, 0x33, 
+  0x00, 0x83, 0xc4, 0x00, 0x22, 0x92, 0x0a, 0xc4, 0x00, 0xf1, 0x04, 0x85, 
+  0xe8, 0xea, 0xa5, 0xff, 0x1e, 0x83, 0x91, 0x05, 0x85, 0x04, 0x30, 0xc0, 
+  0x84, 0x82, 0x01, 0x09, 0x00, 0xf0, 0x10, 0x00, 0x20, 0xb9, 0xf1, 0x22, 
+  0x01, 0x26, 0xee, 0x08, 0x1c, 0x01, 0x02, 0x00, 0x02, 0x00, 0x1c, 0x01, 
+  0x94, 0x01, 0x20, 0xf0, 0x22, 0x03, 0x20, 0x98, 0x11, 0x01, 0x1c, 0x01, 
+  0x25, 0x33, 0x40, 0x1c, 0x01, 0x13, 0x3a, 0x58, 0x00, 0xf4, 0x0d, 0xa3, 
+  0x08, 0x10, 0x00, 0x07, 0x85, 0x48, 0x85, 0x04, 0x71, 0x50, 0x70, 0x2e, 
+  0x01, 0x2b, 0x00, 0x07, 0xa5, 0x20, 0x8e, 0x47, 0xa5, 0xff, 0x1e, 0x42, 
+  0x90, 0x91, 0xf0, 0x9c, 0x00, 0x0f, 0xcc, 0x00, 0x0b, 0x11, 0x72, 0x7c, 
+  0x00, 0x39, 0x10, 0x34, 0x40, 0xcc, 0x00, 0x11, 0x0c, 0xcc, 0x00, 0x63, 
+  0x1b, 0x61, 0x04, 0x34, 0x80, 0x90, 0x74, 0x00, 0x32, 0xab, 0xc6, 0x09, 
+  0x74, 0x00, 0xf0, 0x13, 0x08, 0xe8, 0x20, 0x8e, 0xff, 0x16, 0x80, 0x90, 
+  0x2f, 0x08, 0x61, 0x00, 0x4c, 0x70, 0x0b, 0x85, 0x4c, 0x85, 0x6c, 0x70, 
+  0x21, 0x68, 0xea, 0xa5, 0x1b, 0x08, 0xa3, 0x00, 0x2b, 0xa5, 0x20, 0x42, 
+  0x15, 0xf0, 0x54, 0x01, 0xf2, 0x13, 0x83, 0x90, 0xf3, 0xa5, 0xce, 0xc7, 
+  0xe7, 0xa5, 0x4b, 0xf0, 0x4b, 0xa5, 0x0b, 0xf0, 0x0a, 0x85, 0x6d, 0x85, 
+  0x04, 0x71, 0x70, 0x70, 0xeb, 0xa5, 0x0a, 0xa5, 0xca, 0x23, 0x0b, 0x00, 
+  0x83, 0xf6, 0x6a, 0xa5, 0x0c, 0x01, 0xf0, 0x31, 0xca, 0xf6, 0x30, 0x85, 
+  0x11, 0x85, 0x24, 0x71, 0x11, 0x09, 0x22, 0x00, 0x30, 0xa5, 0x10, 0xa5, 
+  0x00, 0x41, 0x04, 0xf0, 0x2c, 0x70, 0xf0, 0xa5, 0x0d, 0x85, 0x17, 0x0b, 
+  0x01, 0x00, 0x11, 0x85, 0x0f, 0x09, 0x01, 0x00, 0x00, 0x8e, 0x4c, 0x70, 
+  0xeb, 0xa5, 0xff, 0x1e, 0x02, 0x90, 0x0c, 0x85, 0x47, 0x0a, 0x02, 0x00, 
+  0x11, 0x85, 0x43, 0x09, 0x01, 0x00, 0x01, 0x85, 0x0d, 0x19, 0xc2, 0x23, 
+  0x6a, 0x00, 0xf0, 0x01, 0x7f, 0x1d, 0x18, 0x10, 0xea, 0x0e, 0xef, 0xeb, 
+  0x56, 0x21, 0x00, 0x2d, 0x7f, 0x15, 0x00, 0x16, 0x5c, 0x07, 0xf0, 0x0f, 
+  0x54, 0x60, 0x40, 0xda, 0x47, 0x1d, 0x18, 0x10, 0x56, 0x21, 0x80, 0x2d, 
+  0x44, 0x1d, 0xd8, 0x13, 0x45, 0x1d, 0xd8, 0x13, 0xae, 0x0b, 0x2f, 0xea, 
+  0x46, 0x1d, 0xd8, 0x13, 0xeb, 0xa5, 0x54, 0x02, 0xf1, 0x04, 0x34, 0x74, 
+  0xf4, 0x05, 0xed, 0xff, 0x0c, 0x71, 0x2d, 0x78, 0x32, 0x20, 0x80, 0x0f, 
+  0x13, 0x00, 0x94, 0x60, 0xce, 0xb0, 0x07, 0xf1, 0x23, 0xa9, 0xc1, 0x00, 
+  0x42, 0x55, 0x20, 0x4d, 0x09, 0x0c, 0x70, 0x03, 0xe9, 0x1c, 0xa5, 0xc8, 
+  0xc7, 0x3c, 0x85, 0x7a, 0x85, 0x24, 0x71, 0xf9, 0x09, 0xe2, 0x80, 0x3c, 
+  0xa5, 0x2d, 0x8a, 0x0d, 0x09, 0xf1, 0x00, 0x8a, 0x21, 0x0b, 0x04, 0x31, 
+  0x62, 0x06, 0xe9, 0x40, 0x41, 0x80, 0x21, 0x0b, 0x09, 0x05, 0xf0, 0x08, 
+  0x00, 0xd0, 0x0a, 0xf4, 0x15, 0x0c, 0x90, 0xc0, 0x81, 0x7c, 0xa5, 0x5a, 
+  0x24, 0x01, 0x13, 0x4c, 0x01, 0xe1, 0x59, 0x61, 0x81, 0x81, 0x62, 0x81, 
+  0x23, 0x81, 0x40, 0xc4, 0x41, 0xc3, 0x42, 0xc1, 0x88, 0x01, 0xc0, 0x22, 
+  0x01, 0x00, 0x80, 0xc3, 0x42, 0x11, 0x0b, 0x06, 0x04, 0x4b, 0x86, 0x54, 
+  0x04, 0xf1, 0x03, 0x34, 0xc1, 0x12, 0x04, 0x71, 0x20, 0xa3, 0x86, 0xc0, 
+  0x83, 0xc1, 0xea, 0x0e, 0x6f, 0xf4, 0x83, 0xc7, 0x18, 0x86, 0x01, 0xc0, 
+  0x7f, 0xd9, 0x00, 0x36, 0x03, 0x10, 0x17, 0xb9, 0x4a, 0x20, 0x00, 0x20, 
+  0x0c, 0x04, 0xf0, 0x00, 0x40, 0x87, 0x0c, 0x70, 0x04, 0x33, 0x80, 0x80, 
+  0xca, 0x20, 0x45, 0x00, 0x04, 0x1f, 0x10, 0xec, 0x00, 0x61, 0xf8, 0x83, 
+  0xc0, 0x08, 0x46, 0xe2, 0x08, 0x00, 0xf0, 0x03, 0x04, 0x36, 0x00, 0x94, 
+  0xc5, 0xf6, 0x3f, 0xd9, 0x18, 0xb9, 0x04, 0xf0, 0xc3, 0x41, 0x00, 0xbf, 
+  0x00, 0x00, 0x5e, 0x04, 0x00, 0xc4, 0x05, 0x60, 0x8b, 0x20, 0x83, 0x8f, 
+  0x09, 0xf2, 0xbe, 0x05, 0xc2, 0x02, 0xc1, 0x0c, 0x71, 0x7d, 0xa5, 0x5e, 
+  0xa5, 0x3f, 0xa5, 0xc8, 0xc7, 0xa8, 0x03, 0xf0, 0x65, 0xf4, 0xc3, 0x82, 
+  0x24, 0x0d, 0x3d, 0x50, 0x44, 0x08, 0x45, 0x9d, 0xc0, 0x8a, 0x22, 0x0c, 
+  0x00, 0x92, 0x0a, 0x2f, 0xea, 0x28, 0x46, 0x00, 0x85, 0x40, 0x24, 0x83, 
+  0x35, 0x40, 0x24, 0x04, 0x37, 0x54, 0x24, 0x05, 0x3e, 0x40, 0x24, 0x06, 
+  0x36, 0x40, 0x24, 0xc7, 0x35, 0xc1, 0x41, 0x82, 0x42, 0x9e, 0x0e, 0x2f, 
+  0xf1, 0x16, 0x1c, 0xc3, 0x35, 0x1c, 0x14, 0x12, 0x30, 0x0b, 0x0a, 0x30, 
+  0x20, 0xb1, 0x41, 0x42, 0x40, 0xd4, 0xc7, 0x17, 0x14, 0x8f, 0x30, 0xb1, 
+  0x43, 0x55, 0x25, 0xce, 0x1a, 0x55, 0x25, 0x90, 0x1e, 0x56, 0x25, 0x15, 
+  0x1d, 0x56, 0x25, 0x96, 0x1d, 0x4e, 0x70, 0x0c, 0x70, 0x80, 0x21, 0x0b, 
+  0x24, 0x80, 0x23, 0x0b, 0x25, 0xed, 0xe8, 0x16, 0x14, 0x81, 0x30, 0xef, 
+  0x78, 0xd3, 0x09, 0x24, 0x80, 0xe0, 0x07, 0x15, 0xb0, 0xe0, 0x07, 0xf0, 
+  0x34, 0x26, 0xf0, 0x33, 0xf0, 0x42, 0xf0, 0x46, 0xf0, 0x4c, 0xf0, 0x51, 
+  0xf0, 0x58, 0xf0, 0x5c, 0xf0, 0x62, 0xf0, 0x66, 0xf0, 0x6c, 0xf0, 0x70, 
+  0xf0, 0x79, 0xf0, 0x80, 0xf0, 0x87, 0xf0, 0x8c, 0xf0, 0x92, 0xf0, 0x97, 
+  0xf0, 0x9e, 0xf0, 0xa8, 0xf0, 0xaf, 0xf0, 0xb4, 0xf0, 0x9d, 0xc0, 0x86, 
+  0xc1, 0xe6, 0x08, 0xaf, 0xf5, 0x80, 0xc2, 0x00, 0xc2, 0x01, 0xc1, 0x02, 
+  0xc0, 0xa0, 0x1d, 0x98, 0x10, 0xa1, 0x1d, 0x58, 0x76, 0x06, 0x21, 0x10, 
+  0xb0, 0x1e, 0x00, 0x17, 0xc6, 0x1e, 0x00, 0xd1, 0x00, 0x18, 0x80, 0x20, 
+  0x04, 0x18, 0x40, 0x20, 0x08, 0x18, 0x00, 0x20, 0xa0, 0x1e, 0x00, 0x17, 
+  0xaa, 0x1e, 0x00, 0xf1, 0x0e, 0x42, 0x1d, 0x98, 0x10, 0x43, 0x1d, 0x58, 
+  0x10, 0x44, 0x1d, 0x18, 0x10, 0x92, 0xf0, 0x9d, 0xc0, 0x1e, 0x08, 0x2f, 
+  0xf3, 0x86, 0xc1, 0x0d, 0xad, 0x8c, 0xf0, 0x9d, 0xc0, 0x12, 0x0c, 0x00, 
+  0x71, 0x0e, 0xad, 0x86, 0xf0, 0x9d, 0xc0, 0x06, 0x0c, 0x00, 0xf0, 0x04, 
+  0xed, 0x19, 0x02, 0xa0, 0x7e, 0xf0, 0x9d, 0xc0, 0xfa, 0x0d, 0x6f, 0xf5, 
+  0x86, 0xc1, 0x78, 0x1e, 0x18, 0x10, 0x78, 0x0e, 0x00, 0xc1, 0x0a, 0x6f, 
+  0xed, 0x86, 0xc1, 0x16, 0xa6, 0x72, 0xf0, 0x9d, 0xc0, 0xee, 0x0c, 0x00, 
+  0x71, 0x03, 0xa6, 0x6c, 0xf0, 0x9d, 0xc0, 0xe2, 0x0c, 0x00, 0x71, 0x09, 
+  0xa6, 0x66, 0xf0, 0x9d, 0xc0, 0xd6, 0x0c, 0x00, 0x71, 0x0c, 0xa6, 0x60, 
+  0xf0, 0x9d, 0xc0, 0xca, 0x0c, 0x00, 0x31, 0x00, 0xa6, 0x5a, 0x8e, 0x00, 
+  0xd1, 0x9e, 0x0c, 0x6f, 0xf8, 0x98, 0xc2, 0x98, 0xc1, 0x10, 0xda, 0xa2, 
+  0x40, 0x4e, 0x12, 0x00, 0xf1, 0x10, 0xd2, 0x0c, 0xef, 0xf9, 0x88, 0xc2, 
+  0x88, 0xc1, 0x40, 0xda, 0xc2, 0x40, 0x46, 0xf0, 0x9d, 0xc0, 0x8a, 0x0f, 
+  0xef, 0xf2, 0x86, 0xc1, 0xee, 0x19, 0x02, 0xa0, 0x40, 0xf0, 0x9d, 0xc0, 
+  0x7a, 0x0e, 0x00, 0x91, 0xef, 0x19, 0x02, 0xa0, 0x3a, 0xf0, 0x9d, 0xc0, 
+  0x7e, 0x4c, 0x00, 0x71, 0x04, 0xa6, 0x34, 0xf0, 0x9d, 0xc0, 0x66, 0x96, 
+  0x00, 0x91, 0x85, 0x1e, 0x18, 0x10, 0x2c, 0xf0, 0x9d, 0xc0, 0x56, 0x0e, 
+  0x00, 0x51, 0x86, 0x1e, 0x18, 0x10, 0x26, 0x56, 0x00, 0xf1, 0x16, 0x12, 
+  0x0f, 0xaf, 0xf4, 0x83, 0xc2, 0x03, 0xc1, 0x04, 0xc0, 0xb2, 0x1d, 0x58, 
+  0x10, 0xb3, 0x1d, 0x18, 0x10, 0x1a, 0xf0, 0x9d, 0xc0, 0x3a, 0x0c, 0x6f, 
+  0xf4, 0x86, 0xc1, 0x00, 0x19, 0x04, 0x20, 0x12, 0xf0, 0x9d, 0xc0, 0x2a, 
+  0x0e, 0x00, 0x51, 0x02, 0x19, 0x04, 0x20, 0x0c, 0x34, 0x00, 0x42, 0x5a, 
+  0x0a, 0xef, 0xf9, 0x9c, 0x00, 0xf0, 0x23, 0x62, 0x40, 0x7e, 0x08, 0x0f, 
+  0xea, 0x06, 0xc0, 0x8a, 0x21, 0x3e, 0x06, 0x92, 0x70, 0xca, 0x22, 0x4d, 
+  0x20, 0x2c, 0x71, 0x3c, 0x24, 0x00, 0x20, 0x06, 0x79, 0x3f, 0x67, 0x16, 
+  0xf1, 0xf8, 0xc3, 0xa8, 0xc1, 0x10, 0x42, 0x55, 0x20, 0x8d, 0x08, 0x19, 
+  0x09, 0x80, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x48, 0x31, 0x7e, 0x07, 0xf1, 
+  0x3b, 0x11, 0x70, 0x48, 0x47, 0x00, 0x00, 0x05, 0xf0, 0xd3, 0x41, 0x00, 
+  0x45, 0x00, 0x00, 0x40, 0x22, 0x00, 0x24, 0x2c, 0x70, 0x7a, 0x0e, 0xef, 
+  0xf7, 0x78, 0xda, 0xd3, 0x43, 0xc8, 0x41, 0x00, 0x00, 0x07, 0x33, 0x54, 
+  0x24, 0x01, 0x85, 0xcb, 0x44, 0x83, 0x3a, 0x6f, 0x12, 0xd3, 0x40, 0x00, 
+  0x3f, 0x00, 0x00, 0x6d, 0x70, 0x48, 0x30, 0x80, 0x00, 0x00, 0x31, 0x00, 
+  0x20, 0x00, 0x30, 0x01, 0x03, 0x02, 0x40, 0x04, 0x31, 0xc0, 0x82, 0xca, 
+  0x20, 0x8c, 0x0f, 0xca, 0x02, 0x50, 0x31, 0x00, 0x00, 0x28, 0x85, 0xcc, 
+  0x02, 0xf0, 0x21, 0x49, 0x20, 0x80, 0x02, 0x48, 0x20, 0x02, 0x01, 0x48, 
+  0x34, 0xc0, 0x22, 0x11, 0x08, 0x30, 0x01, 0x40, 0xa5, 0x1f, 0x08, 0xb0, 
+  0x00, 0x14, 0x71, 0x27, 0xa5, 0x18, 0xf0, 0x07, 0x31, 0x80, 0x0f, 0xc8, 
+  0x43, 0x00, 0x00, 0x00, 0x30, 0x80, 0x0f, 0x16, 0x43, 0x00, 0x00, 0x09, 
+  0xf0, 0xc3, 0x40, 0x10, 0x00, 0x82, 0x07, 0x31, 0x01, 0x00, 0xb8, 0xb8, 
+  0x00, 0x31, 0x1a, 0x00, 0x00, 0xc6, 0x06, 0xc0, 0x07, 0xa5, 0x0b, 0x85, 
+  0x30, 0x85, 0x74, 0x85, 0x51, 0x85, 0xd7, 0x85, 0x76, 0x00, 0xf2, 0x39, 
+  0x48, 0x31, 0x81, 0x00, 0x48, 0x33, 0x83, 0x00, 0x00, 0x31, 0x06, 0x20, 
+  0xfe, 0x85, 0x48, 0x32, 0x82, 0x00, 0x00, 0x31, 0x48, 0x20, 0x00, 0x31, 
+  0xc0, 0x20, 0x00, 0x31, 0x81, 0x20, 0x00, 0x36, 0x1f, 0x03, 0x48, 0x36, 
+  0x8e, 0x10, 0x00, 0x30, 0x15, 0x13, 0x00, 0x30, 0x08, 0x03, 0x00, 0x31, 
+  0x80, 0x23, 0x0a, 0x24, 0x00, 0x04, 0x00, 0x31, 0x16, 0x03, 0x04, 0x37, 
+  0xc0, 0xb2, 0x48, 0x37, 0x8f, 0x10, 0x0a, 0x25, 0x00, 0x04, 0xca, 0x24, 
+  0xae, 0x00, 0xf3, 0x05, 0x04, 0x35, 0xc0, 0xa2, 0x00, 0x30, 0x06, 0x03, 
+  0x00, 0x31, 0xc0, 0x23, 0x0a, 0x26, 0x00, 0x34, 0x0f, 0x70, 0xca, 0x25, 
+  0x1a, 0x00, 0xb1, 0x36, 0xc0, 0xa2, 0x0a, 0x21, 0x00, 0x14, 0xca, 0x26, 
+  0x8c, 0x3f, 0x10, 0x00, 0xf2, 0x00, 0x30, 0x00, 0x96, 0x00, 0x30, 0x00, 
+  0x03, 0x0a, 0x27, 0x00, 0x04, 0xca, 0x21, 0x8c, 0x1f, 0x24, 0x00, 0x83, 
+  0x00, 0x86, 0x0a, 0x27, 0x00, 0x24, 0xca, 0x27, 0x34, 0x00, 0x72, 0x30, 
+  0x00, 0x86, 0xca, 0x27, 0x8c, 0x2f, 0xd2, 0x03, 0xf0, 0x35, 0xc0, 0x05, 
+  0x86, 0x15, 0x0b, 0x16, 0x48, 0x30, 0xc2, 0x02, 0x48, 0x32, 0x80, 0x00, 
+  0x07, 0x30, 0x40, 0x04, 0x87, 0x15, 0x0c, 0x16, 0x83, 0x1d, 0xd8, 0x12, 
+  0x7c, 0x85, 0x84, 0x1d, 0x18, 0x13, 0x01, 0x35, 0x4b, 0x21, 0x01, 0x36, 
+  0x8c, 0x27, 0x85, 0x15, 0x17, 0x16, 0x42, 0x41, 0x80, 0x21, 0x0a, 0x0b, 
+  0x5d, 0xa5, 0x10, 0xda, 0x84, 0xc6, 0x82, 0x1d, 0xd8, 0x15, 0x07, 0x30, 
+  0xcf, 0x03, 0x01, 0x37, 0x00, 0x31, 0x48, 0x01, 0xf1, 0x06, 0x0a, 0xa5, 
+  0x48, 0x33, 0xc0, 0x12, 0x01, 0x30, 0x4b, 0x12, 0x0f, 0xa5, 0x48, 0x34, 
+  0xc0, 0x12, 0x01, 0x36, 0xcc, 0x01, 0x0e, 0x14, 0x00, 0x11, 0x13, 0x10, 
+  0x00, 0xf3, 0x41, 0x16, 0xa5, 0x00, 0x33, 0xc0, 0x03, 0x1b, 0xa5, 0x82, 
+  0x0e, 0xef, 0xe9, 0x84, 0xc0, 0x4a, 0x24, 0x00, 0x71, 0x80, 0xc0, 0xa8, 
+  0x20, 0x00, 0x02, 0x04, 0x16, 0x01, 0x14, 0x00, 0x34, 0x41, 0x20, 0x04, 
+  0x18, 0x50, 0x00, 0x56, 0x22, 0x81, 0x2f, 0x0a, 0x0c, 0xef, 0xf4, 0x80, 
+  0xc0, 0x07, 0x31, 0xc3, 0x24, 0x88, 0x15, 0x00, 0x16, 0x4c, 0x70, 0x00, 
+  0x31, 0x81, 0x2f, 0x20, 0x41, 0x00, 0x00, 0x04, 0x31, 0x80, 0x80, 0x00, 
+  0x33, 0x00, 0x00, 0x6a, 0x1d, 0x18, 0x10, 0x04, 0xf6, 0xd3, 0x40, 0xc6, 
+  0x01, 0x90, 0x04, 0x04, 0x1a, 0x43, 0x20, 0x80, 0x22, 0x8b, 0x24, 0x84, 
+  0x00, 0x51, 0x00, 0x1a, 0x04, 0x20, 0xd8, 0x6c, 0x05, 0x91, 0x82, 0x24, 
+  0x0c, 0x34, 0x50, 0x40, 0x08, 0x45, 0x84, 0x84, 0x04, 0x30, 0x28, 0x47, 
+  0x0e, 0x76, 0x00, 0x11, 0xc6, 0x86, 0x04, 0xf1, 0x1d, 0x31, 0x40, 0x24, 
+  0x04, 0x32, 0x40, 0x24, 0x05, 0x33, 0x40, 0x24, 0x06, 0x30, 0x40, 0x24, 
+  0xc7, 0x31, 0xe1, 0x41, 0x02, 0x42, 0x1a, 0x0a, 0x2f, 0xf1, 0x06, 0x1c, 
+  0x83, 0x30, 0x02, 0xc0, 0x02, 0xe8, 0xc8, 0xc7, 0x07, 0x14, 0x8f, 0x30, 
+  0x4a, 0x20, 0x40, 0x20, 0x06, 0x62, 0x04, 0x80, 0x35, 0x09, 0x24, 0x00, 
+  0x2f, 0x26, 0x07, 0xf4, 0x18, 0x02, 0xf0, 0x1f, 0x80, 0xc1, 0x21, 0x08, 
+  0x51, 0x00, 0x00, 0xc0, 0x09, 0x66, 0x04, 0x71, 0x40, 0xc0, 0xda, 0x0a, 
+  0x20, 0x00, 0xa1, 0x40, 0x10, 0x40, 0x06, 0xf0, 0x32, 0x0c, 0xef, 0xf2, 
+  0x84, 0xc0, 0x39, 0x1d, 0x02, 0x10, 0xe5, 0x71, 0xe6, 0xf1, 0x0c, 0x70, 
+  0xdf, 0xf5, 0x8a, 0x20, 0x7e, 0x06, 0x10, 0x05, 0xf0, 0x05, 0xe2, 0xc2, 
+  0x84, 0x88, 0x06, 0xec, 0x00, 0x1f, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 
+  0x04, 0xf0, 0x00, 0x1f, 0x43, 0x00, 0x8c, 0x05, 0xf1, 0x21, 0x40, 0x20, 
+  0x0c, 0x02, 0x0a, 0x25, 0x80, 0x11, 0xa8, 0x20, 0x80, 0x01, 0x04, 0x14, 
+  0x0b, 0x14, 0x04, 0x1d, 0xd0, 0x12, 0x3a, 0x10, 0x8c, 0x00, 0x48, 0x34, 
+  0x0c, 0x10, 0x80, 0xa5, 0x8d, 0x70, 0xa3, 0x83, 0x04, 0x35, 0x00, 0x93, 
+  0xc5, 0xf6, 0x3f, 0xdc, 0x18, 0xbc, 0x04, 0xf0, 0xcb, 0x44, 0xf0, 0x00, 
+  0xf2, 0x08, 0x35, 0x0c, 0x13, 0x48, 0x34, 0xcd, 0x12, 0xaf, 0x7c, 0x8c, 
+  0x24, 0xc3, 0x9f, 0x1e, 0xf2, 0x39, 0x10, 0x8b, 0x00, 0x21, 0x0c, 0xe4, 
+  0x12, 0x50, 0x00, 0x62, 0x0b, 0x02, 0x0a, 0x24, 0xc0, 0x10, 0x50, 0x00, 
+  0xa0, 0x08, 0x14, 0x04, 0x1b, 0x10, 0x12, 0x3a, 0x18, 0x42, 0x03, 0x6a, 
+  0x01, 0x00, 0x7e, 0x00, 0x01, 0x18, 0x00, 0xf0, 0x25, 0x13, 0x0c, 0x04, 
+  0x04, 0x1e, 0x10, 0x03, 0x80, 0x43, 0xb6, 0x0a, 0x20, 0x00, 0x0a, 0x24, 
+  0x40, 0x01, 0xc2, 0xc6, 0xe6, 0xc3, 0xa2, 0xc1, 0x08, 0x46, 0x00, 0x80, 
+  0x60, 0x44, 0x40, 0x24, 0xc3, 0x30, 0x40, 0x24, 0x05, 0x31, 0x40, 0x24, 
+  0x86, 0x30, 0x48, 0x47, 0x0a, 0x25, 0x40, 0x10, 0x5e, 0x09, 0x2f, 0xf1, 
+  0x03, 0x16, 0x01, 0xf0, 0x1a, 0x14, 0x80, 0x30, 0x03, 0x14, 0x81, 0x30, 
+  0x0f, 0x78, 0x2f, 0x09, 0x04, 0x00, 0x11, 0x08, 0x90, 0x00, 0x1b, 0x08, 
+  0x51, 0x00, 0x38, 0x16, 0x80, 0x10, 0x04, 0xf0, 0x39, 0x16, 0x80, 0x10, 
+  0x81, 0xc3, 0xa1, 0x41, 0x3a, 0x0b, 0xef, 0xf2, 0xe1, 0x42, 0x2a, 0x00, 
+  0xf0, 0x23, 0x04, 0x71, 0x02, 0x1c, 0x02, 0x30, 0xe8, 0xf1, 0x01, 0xc0, 
+  0x41, 0x28, 0x01, 0x02, 0x00, 0xad, 0x21, 0xad, 0xc6, 0xc7, 0xe0, 0x78, 
+  0xec, 0xc3, 0xa2, 0xc1, 0x50, 0x41, 0x30, 0x40, 0x08, 0x47, 0x2c, 0x70, 
+  0x10, 0xda, 0x60, 0x40, 0x0a, 0x22, 0x00, 0x21, 0xba, 0x0a, 0xef, 0xf7, 
+  0x68, 0x45, 0xcd, 0x71, 0xc0, 0x00, 0x40, 0x04, 0x1c, 0x03, 0x35, 0x6c, 
+  0x00, 0xf0, 0x01, 0x2f, 0x08, 0x30, 0x20, 0x02, 0x1c, 0x82, 0x33, 0x40, 
+  0x24, 0x40, 0x31, 0x40, 0x24, 0x81, 0x30, 0x24, 0x02, 0xf0, 0x01, 0x01, 
+  0x11, 0x82, 0x04, 0x38, 0x22, 0x42, 0x04, 0x01, 0x18, 0x92, 0x00, 0xea, 
+  0x0a, 0xaf, 0xf4, 0x1c, 0x00, 0xc0, 0x1a, 0xe8, 0x0e, 0x72, 0x6b, 0xf0, 
+  0x0c, 0x70, 0xa8, 0x20, 0x00, 0x03, 0x28, 0x00, 0xf3, 0x02, 0x09, 0x61, 
+  0x40, 0x24, 0x42, 0x31, 0x1a, 0x62, 0x04, 0x71, 0x38, 0x21, 0x41, 0x04, 
+  0x20, 0xaa, 0xc2, 0x28, 0x00, 0xf0, 0x4d, 0x1f, 0xe8, 0x0e, 0x72, 0x01, 
+  0x1d, 0x83, 0x10, 0xc0, 0xad, 0x1c, 0xf0, 0x00, 0x87, 0x13, 0x09, 0x71, 
+  0x25, 0x0e, 0x70, 0x0b, 0x08, 0x91, 0x01, 0xc0, 0xad, 0x00, 0x87, 0x0e, 
+  0x71, 0x15, 0x09, 0xd1, 0x25, 0x11, 0x08, 0x51, 0x02, 0x00, 0x25, 0x00, 
+  0x14, 0xc0, 0xa8, 0x06, 0x71, 0x00, 0x87, 0x89, 0x09, 0x91, 0x25, 0x85, 
+  0x08, 0xf1, 0x01, 0x02, 0x75, 0x06, 0x71, 0x3d, 0xf0, 0x0e, 0x70, 0x00, 
+  0x87, 0x2b, 0x08, 0xb1, 0x01, 0x78, 0x21, 0xc1, 0x27, 0x78, 0x21, 0x00, 
+  0x28, 0x60, 0xc0, 0x80, 0xc0, 0x0a, 0x0b, 0x6f, 0xf5, 0x01, 0x1c, 0x42, 
+  0x30, 0x08, 0xe8, 0x36, 0x00, 0xf0, 0x03, 0x06, 0x72, 0x01, 0x18, 0x83, 
+  0x00, 0xc0, 0xa8, 0x00, 0x87, 0x29, 0x08, 0xf1, 0x01, 0x78, 0x21, 0x40, 
+  0x28, 0x2c, 0x00, 0x00, 0x28, 0x00, 0x2f, 0xe2, 0x0a, 0x28, 0x00, 0x03, 
+  0x95, 0xa0, 0xb8, 0x25, 0x08, 0x31, 0x02, 0x78, 0x21, 0x80, 0x2a, 0x00, 
+  0x13, 0xb6, 0x2a, 0x00, 0x53, 0x06, 0xe8, 0x02, 0x75, 0x06, 0xae, 0x00, 
+  0x82, 0x00, 0x1a, 0x00, 0x24, 0xcc, 0xc7, 0xe0, 0x78, 0xa0, 0x01, 0x4c, 
+  0x08, 0x16, 0x00, 0x14, 0xa2, 0x01, 0x6a, 0x28, 0x45, 0xbe, 0x0f, 0xef, 
+  0xf0, 0xa0, 0x01, 0xfa, 0x15, 0x37, 0x09, 0x04, 0x00, 0x1b, 0x08, 0xb0, 
+  0x00, 0x81, 0xc3, 0x1f, 0x08, 0x71, 0x00, 0x81, 0xc3, 0xc1, 0x40, 0xa1, 
+  0x41, 0x22, 0x0a, 0x6f, 0xf5, 0xe1, 0x42, 0x07, 0xf0, 0x32, 0x16, 0x80, 
+  0x10, 0xa1, 0x41, 0x92, 0x09, 0xa8, 0x01, 0x1b, 0xe4, 0xa8, 0x01, 0xf0, 
+  0x07, 0x89, 0x04, 0xc0, 0x00, 0x00, 0x42, 0x9f, 0xe1, 0x0c, 0x70, 0xe0, 
+  0x20, 0xcd, 0x07, 0x0c, 0x71, 0xe0, 0x7f, 0x38, 0x1a, 0x42, 0x00, 0x88, 
+  0x00, 0x91, 0x82, 0x24, 0x0c, 0x37, 0x48, 0x47, 0x08, 0x45, 0x87, 0x54, 
+  0x03, 0x43, 0xba, 0x0a, 0xef, 0xe9, 0xd8, 0x07, 0xf6, 0x33, 0x34, 0x40, 
+  0x24, 0x04, 0x33, 0x40, 0x24, 0x05, 0x36, 0x40, 0x24, 0x06, 0x35, 0x40, 
+  0x24, 0xc7, 0x34, 0xc1, 0x41, 0xe1, 0x42, 0xc6, 0x0e, 0xef, 0xf0, 0x12, 
+  0x1c, 0x83, 0x30, 0x03, 0xc0, 0x03, 0xe8, 0xc6, 0xc7, 0x13, 0x14, 0x8e, 
+  0x30, 0x12, 0x14, 0x81, 0x30, 0xcf, 0x78, 0x35, 0x09, 0x04, 0x00, 0x23, 
+  0x08, 0xb0, 0x00, 0x85, 0xc1, 0x29, 0x08, 0x71, 0x00, 0x87, 0xc0, 0x85, 
+  0xc1, 0x66, 0x09, 0x6f, 0x44, 0x07, 0xf0, 0x20, 0xa5, 0x23, 0xa5, 0x04, 
+  0xa5, 0x06, 0xf0, 0xe2, 0x08, 0xef, 0xf2, 0x87, 0xc0, 0x3a, 0x1d, 0x02, 
+  0x10, 0xc5, 0x71, 0xe5, 0xf1, 0x03, 0xc0, 0xc6, 0xc7, 0xee, 0xc3, 0xaa, 
+  0xc1, 0x38, 0x10, 0x8c, 0x00, 0x08, 0x45, 0x88, 0x47, 0x68, 0x46, 0x50, 
+  0x41, 0x41, 0x0c, 0x3f, 0x10, 0x30, 0x40, 0x3a, 0x02, 0x61, 0x02, 0x40, 
+  0x0a, 0x21, 0xc0, 0x03, 0xe0, 0x02, 0xb0, 0x10, 0x02, 0x04, 0x04, 0x19, 
+  0x90, 0x00, 0x3a, 0x15, 0x80, 0x10, 0x1a, 0x00, 0xb2, 0x48, 0x30, 0x02, 
+  0x00, 0x40, 0xa1, 0x22, 0x41, 0x0a, 0x20, 0x80, 0x20, 0x00, 0xf0, 0x2c, 
+  0x11, 0x03, 0x04, 0x04, 0x18, 0xd0, 0x00, 0x40, 0xa0, 0x68, 0xf0, 0x42, 
+  0x85, 0x23, 0x85, 0x04, 0x85, 0x3a, 0x15, 0x92, 0x10, 0x43, 0xc2, 0x44, 
+  0xc1, 0x1b, 0x0c, 0xff, 0x10, 0x45, 0xc0, 0x03, 0xc2, 0x04, 0xc1, 0x05, 
+  0xc0, 0x0a, 0x23, 0x80, 0x24, 0x40, 0xc2, 0x41, 0xc1, 0x42, 0xc0, 0x13, 
+  0xf0, 0x4f, 0x85, 0x30, 0x85, 0x11, 0x85, 0x48, 0x15, 0x93, 0x10, 0x12, 
+  0x00, 0x62, 0x17, 0x0c, 0x3e, 0x11, 0x42, 0xc0, 0xaa, 0x00, 0x40, 0x0a, 
+  0x22, 0xc0, 0x24, 0x3a, 0x00, 0x11, 0x45, 0xcc, 0x04, 0x08, 0x64, 0x00, 
+  0xf0, 0x09, 0x02, 0x04, 0x04, 0x18, 0x90, 0x00, 0x80, 0xc2, 0x2c, 0x73, 
+  0x22, 0x40, 0xbe, 0x08, 0xef, 0xf1, 0xc1, 0x43, 0x60, 0x86, 0x41, 0x86, 
+  0x22, 0x86, 0x28, 0x00, 0xf0, 0x02, 0x48, 0x33, 0x00, 0x20, 0x49, 0xc0, 
+  0x46, 0xc3, 0x0c, 0x70, 0x86, 0xc3, 0x47, 0xc2, 0x20, 0x1c, 0x40, 0xe0, 
+  0x02, 0xf0, 0x1a, 0x03, 0x01, 0x4b, 0x15, 0x26, 0x02, 0x10, 0x20, 0xa2, 
+  0xf0, 0x20, 0x01, 0x20, 0x15, 0x27, 0x02, 0x10, 0x04, 0x71, 0x20, 0xa2, 
+  0x83, 0xc2, 0x2c, 0x73, 0x02, 0x40, 0x7e, 0x08, 0xef, 0xf1, 0xe1, 0x43, 
+  0x41, 0x87, 0x22, 0x87, 0x60, 0x87, 0x48, 0x32, 0x3c, 0x00, 0xf0, 0x2d, 
+  0x47, 0xc2, 0x48, 0xc1, 0x86, 0xc1, 0x10, 0xda, 0xe1, 0x40, 0x3a, 0x09, 
+  0xef, 0xe9, 0x46, 0xc3, 0x38, 0x15, 0x8c, 0x10, 0x27, 0x0c, 0x7f, 0x10, 
+  0x2c, 0x74, 0x21, 0x0c, 0xbe, 0x10, 0x14, 0xe5, 0x2c, 0x74, 0x02, 0x40, 
+  0xe1, 0x43, 0x0e, 0x0a, 0x2f, 0xf3, 0xa1, 0x42, 0x2c, 0x74, 0x22, 0x40, 
+  0xa1, 0x42, 0x02, 0x0a, 0x2f, 0xf3, 0xc1, 0x43, 0xce, 0xc7, 0x14, 0xe5, 
+  0x1a, 0x00, 0x44, 0x5a, 0x08, 0xef, 0xf1, 0x1a, 0x00, 0x11, 0x4e, 0x9e, 
+  0x00, 0x22, 0xce, 0xc7, 0x40, 0x04, 0x61, 0x01, 0x0f, 0x40, 0x20, 0x02, 
+  0x02, 0xc4, 0x00, 0xf0, 0x04, 0x12, 0x03, 0x04, 0x04, 0x19, 0xd0, 0x00, 
+  0x3a, 0x10, 0x81, 0x00, 0x04, 0x18, 0x43, 0x00, 0xe0, 0x7f, 0x48, 0x18, 
+  0x04, 0x02, 0xf2, 0x3f, 0xec, 0xc3, 0xa9, 0xc1, 0x30, 0x40, 0x86, 0xc1, 
+  0x48, 0x47, 0x96, 0x0d, 0xef, 0xf7, 0x08, 0x45, 0xba, 0x0c, 0xaf, 0xf8, 
+  0x86, 0xc0, 0xd3, 0x41, 0xdb, 0x2e, 0xff, 0xe6, 0x04, 0x30, 0x40, 0x84, 
+  0xd3, 0xf6, 0x02, 0x0c, 0x4f, 0xf6, 0x33, 0x08, 0x30, 0x28, 0xcd, 0x70, 
+  0x43, 0x08, 0x11, 0x24, 0x21, 0x85, 0x60, 0x85, 0x42, 0x85, 0x52, 0x21, 
+  0xc1, 0x07, 0x42, 0xc6, 0x41, 0xc3, 0x00, 0x30, 0x8e, 0x00, 0x40, 0xc1, 
+  0x15, 0xf0, 0x40, 0x85, 0x21, 0x85, 0x02, 0x85, 0xcd, 0x70, 0x64, 0x01, 
+  0xc2, 0x0d, 0xf0, 0x40, 0x85, 0x22, 0x85, 0x61, 0x85, 0x52, 0x22, 0xc2, 
+  0x07, 0x2a, 0x00, 0xf0, 0x13, 0x40, 0xc3, 0x00, 0x30, 0x4e, 0x00, 0x41, 
+  0xc2, 0x80, 0xc0, 0x83, 0xc1, 0x2e, 0x0d, 0xef, 0xf7, 0x40, 0x24, 0x12, 
+  0x30, 0xd3, 0x40, 0x80, 0x3f, 0x00, 0x00, 0x01, 0x36, 0x01, 0x14, 0x50, 
+  0x20, 0xc0, 0x25, 0x7a, 0x07, 0xa0, 0x2f, 0x35, 0x00, 0x10, 0x3a, 0x0c, 
+  0xaf, 0xf8, 0x83, 0xc0, 0x7a, 0x00, 0xf0, 0x03, 0xda, 0xf6, 0x04, 0x36, 
+  0x00, 0x94, 0xca, 0x26, 0x09, 0x14, 0x01, 0x30, 0x01, 0x00, 0x02, 0x30, 
+  0x80, 0x23, 0xd4, 0x00, 0x81, 0x07, 0x30, 0x40, 0x00, 0x2f, 0x31, 0x00, 
+  0x00, 0x68, 0x06, 0x30, 0x12, 0x00, 0x24, 0x38, 0x00, 0xf0, 0x73, 0x04, 
+  0x1f, 0x10, 0x10, 0xa0, 0xa7, 0xcc, 0xc7, 0x0c, 0x70, 0xa3, 0xa7, 0x02, 
+  0xa7, 0x01, 0xa7, 0x00, 0xa7, 0xcc, 0xc7, 0xf4, 0xc3, 0xb1, 0xc1, 0x28, 
+  0x46, 0x10, 0x44, 0x8e, 0xc1, 0xc1, 0x40, 0x0a, 0x25, 0x40, 0x21, 0x0a, 
+  0x23, 0x00, 0x21, 0x70, 0x40, 0xb2, 0x0c, 0xef, 0xf7, 0x48, 0x45, 0x40, 
+  0x14, 0x12, 0x30, 0x0f, 0xc7, 0x38, 0x14, 0x11, 0x30, 0x01, 0x86, 0x01, 
+  0x37, 0x96, 0x14, 0x00, 0x31, 0x82, 0x2f, 0x6b, 0x3c, 0xfa, 0xed, 0x22, 
+  0x86, 0x04, 0x36, 0x80, 0xa0, 0x52, 0x20, 0xc0, 0x07, 0x4d, 0xf7, 0x01, 
+  0x32, 0x42, 0x24, 0x6c, 0x70, 0x2f, 0x32, 0x80, 0x00, 0x04, 0x31, 0xc0, 
+  0x80, 0x40, 0x41, 0x03, 0xf6, 0x52, 0x22, 0xc1, 0x07, 0xa2, 0x0f, 0x0f, 
+  0xf2, 0x2f, 0x31, 0x80, 0x05, 0x00, 0xa5, 0x96, 0x0f, 0x2f, 0xf2, 0x00, 
+  0x86, 0x00, 0x18, 0x00, 0x20, 0x00, 0x85, 0x8d, 0x70, 0x34, 0x00, 0xc1, 
+  0x00, 0xa5, 0x02, 0x86, 0x04, 0x30, 0x00, 0x83, 0x88, 0xf7, 0x06, 0x40, 
+  0x10, 0x00, 0x90, 0x18, 0x00, 0x20, 0x02, 0x86, 0x21, 0x86, 0x3f, 0xda, 
+  0x16, 0x00, 0xf0, 0x03, 0x18, 0xba, 0x47, 0xf7, 0x01, 0x37, 0x43, 0x14, 
+  0x04, 0x33, 0x80, 0x80, 0x8b, 0xf7, 0x01, 0x32, 0x43, 0x24, 0x0a, 0x00, 
+  0xf0, 0x19, 0xc4, 0x31, 0x05, 0x83, 0xca, 0x00, 0x26, 0x00, 0x04, 0x31, 
+  0x00, 0x83, 0x40, 0x86, 0x46, 0xc0, 0x45, 0xc1, 0x44, 0xc2, 0x84, 0xc0, 
+  0x80, 0xc2, 0x6e, 0x0e, 0xef, 0xff, 0x20, 0xd9, 0x02, 0xc3, 0x03, 0xc0, 
+  0x01, 0xc1, 0x00, 0xc2, 0x41, 0xc0, 0x46, 0x01, 0xf0, 0x31, 0x52, 0x23, 
+  0xc0, 0x07, 0x42, 0xc2, 0x43, 0xc1, 0x40, 0xc0, 0x80, 0xc1, 0x87, 0xc2, 
+  0xd6, 0x08, 0x20, 0x00, 0x82, 0x40, 0x0a, 0xc1, 0x0e, 0x0f, 0x2f, 0xf2, 
+  0x09, 0xc0, 0x00, 0x30, 0x80, 0x0f, 0x00, 0xc0, 0x00, 0x00, 0x4c, 0x70, 
+  0x04, 0x30, 0x80, 0x80, 0x45, 0xf7, 0x01, 0x30, 0x80, 0x0f, 0xc9, 0x40, 
+  0xdb, 0x0f, 0x00, 0x1b, 0x00, 0x20, 0x00, 0x86, 0x22, 0x86, 0x4b, 0xc0, 
+  0x01, 0x86, 0x6e, 0x07, 0xb1, 0x80, 0xc2, 0x4c, 0xc0, 0x8b, 0xc0, 0x4d, 
+  0xc1, 0x52, 0xf7, 0x0a, 0x62, 0x00, 0x95, 0x01, 0xc3, 0x03, 0xc0, 0x00, 
+  0xc1, 0x02, 0xc2, 0x40, 0x62, 0x00, 0xe0, 0x41, 0xc2, 0x43, 0xc1, 0x42, 
+  0xc0, 0x05, 0xf0, 0xea, 0x0d, 0xef, 0xff, 0x10, 0xd9, 0x6a, 0x00, 0x13, 
+  0x6e, 0x6a, 0x00, 0x20, 0xa6, 0x0e, 0x6a, 0x00, 0x00, 0x8c, 0x01, 0xb2, 
+  0x0c, 0x70, 0x04, 0x31, 0x00, 0x80, 0x46, 0xf7, 0x01, 0x31, 0x81, 0x66, 
+  0x00, 0xf0, 0x00, 0x1d, 0x40, 0x20, 0xd4, 0xc7, 0x60, 0x86, 0x56, 0xf7, 
+  0xc3, 0x42, 0x35, 0xbf, 0xf3, 0x04, 0x6a, 0x00, 0x20, 0xd0, 0xf6, 0xf6, 
+  0x00, 0x20, 0x4e, 0xf7, 0x90, 0x00, 0xc0, 0xca, 0xf6, 0x04, 0x33, 0x80, 
+  0x8f, 0x35, 0x3f, 0xf3, 0x04, 0x46, 0xf7, 0xf6, 0x00, 0x40, 0x16, 0x07, 
+  0xc9, 0xff, 0xec, 0x00, 0x00, 0xea, 0x00, 0xf0, 0x3f, 0x10, 0xd9, 0x82, 
+  0x0d, 0xef, 0xff, 0x44, 0xc3, 0x96, 0xf1, 0xe0, 0x78, 0xe6, 0xc0, 0x80, 
+  0x81, 0x63, 0x80, 0x0c, 0x11, 0x0b, 0x00, 0xe0, 0x80, 0xc1, 0x81, 0xa2, 
+  0x80, 0x00, 0x33, 0x0c, 0x03, 0x00, 0x37, 0xc3, 0x12, 0x00, 0x35, 0x88, 
+  0x13, 0xc2, 0x81, 0xa1, 0x80, 0x01, 0x33, 0x03, 0x03, 0x02, 0x33, 0x0c, 
+  0x02, 0x00, 0x35, 0x83, 0x13, 0x01, 0x34, 0xc3, 0x10, 0x60, 0xa2, 0x80, 
+  0x81, 0x62, 0x80, 0xc2, 0x81, 0xa0, 0x80, 0x00, 0x33, 0x0b, 0x03, 0x83, 
+  0x81, 0x61, 0x80, 0x2a, 0x00, 0xb5, 0xc1, 0x81, 0xa3, 0x80, 0x00, 0x33, 
+  0x03, 0x03, 0x01, 0x33, 0xcc, 0x2a, 0x00, 0xb4, 0x02, 0x33, 0x03, 0x02, 
+  0x61, 0xa2, 0x80, 0x81, 0x61, 0x80, 0xc3, 0x58, 0x00, 0xd5, 0x35, 0x83, 
+  0x13, 0xc2, 0x81, 0x02, 0x33, 0x0b, 0x03, 0x81, 0x81, 0x60, 0x80, 0x32, 
+  0x00, 0x14, 0x10, 0x32, 0x00, 0x71, 0x62, 0xa2, 0x80, 0x81, 0x60, 0x80, 
+  0xc3, 0x4c, 0x00, 0x31, 0x08, 0x03, 0x81, 0x5c, 0x00, 0x51, 0x8b, 0x13, 
+  0xa2, 0x81, 0x22, 0x2a, 0x00, 0xf0, 0x51, 0x02, 0x33, 0x00, 0x12, 0x00, 
+  0x31, 0x41, 0x03, 0x02, 0x30, 0xc0, 0x00, 0x02, 0x30, 0x40, 0x00, 0x03, 
+  0xa2, 0xc6, 0xc4, 0xe0, 0x78, 0x40, 0x81, 0x02, 0xa1, 0x54, 0x70, 0xe0, 
+  0x7c, 0x21, 0x81, 0x00, 0x7a, 0xec, 0xc2, 0x70, 0x42, 0x48, 0x47, 0x08, 
+  0x46, 0xc4, 0xe1, 0xc8, 0x00, 0x25, 0x00, 0x0e, 0x70, 0xcb, 0x45, 0xa0, 
+  0x00, 0x6c, 0x7e, 0x00, 0x8d, 0x0b, 0x08, 0x71, 0x00, 0xff, 0xd8, 0x08, 
+  0x8d, 0x04, 0xf0, 0x00, 0x1d, 0x43, 0x10, 0x08, 0xad, 0x0b, 0x08, 0x81, 
+  0x03, 0x0c, 0x15, 0x10, 0x10, 0x22, 0xf0, 0x0f, 0x0e, 0x51, 0x19, 0xcb, 
+  0x44, 0x12, 0x00, 0xec, 0x4a, 0x04, 0xf0, 0x08, 0x00, 0xf1, 0x3c, 0xf0, 
+  0x4a, 0x40, 0x25, 0x06, 0x11, 0xc3, 0x40, 0xa0, 0x00, 0x30, 0x7e, 0xc3, 
+  0x42, 0xa0, 0x00, 0xd8, 0xcb, 0x8a, 0x23, 0x10, 0x00, 0xc3, 0x44, 0xa0, 
+  0x00, 0xd8, 0xcf, 0x8a, 0x25, 0x08, 0x00, 0x23, 0x20, 0x00, 0x03, 0xc1, 
+  0x41, 0x0e, 0x70, 0x05, 0xe8, 0x00, 0x1d, 0x02, 0x14, 0x30, 0xf0, 0xc8, 
+  0xad, 0x53, 0x20, 0x80, 0x21, 0x00, 0xaf, 0x01, 0x85, 0x40, 0x28, 0x91, 
+  0x21, 0x54, 0x21, 0x01, 0x28, 0x17, 0x09, 0x24, 0x00, 0x40, 0xde, 0x4f, 
+  0x20, 0xc0, 0x16, 0x00, 0xf0, 0x15, 0x00, 0x1d, 0x03, 0x10, 0x02, 0x20, 
+  0x4e, 0x04, 0xc1, 0xaf, 0x01, 0x85, 0x2c, 0x70, 0x40, 0xda, 0x02, 0xaf, 
+  0x01, 0x85, 0x28, 0xb8, 0x03, 0xaf, 0xe5, 0x74, 0x06, 0x0b, 0xaf, 0xf7, 
+  0xe1, 0x40, 0x00, 0x21, 0x81, 0x2f, 0x66, 0x00, 0xf6, 0x23, 0xcf, 0x7a, 
+  0xb2, 0x0c, 0xaf, 0xe9, 0xe1, 0x40, 0x40, 0x20, 0x41, 0x20, 0x44, 0xd8, 
+  0x0e, 0x71, 0x23, 0xa5, 0x00, 0x1a, 0x04, 0x20, 0x02, 0x40, 0xcc, 0xc6, 
+  0xea, 0xc2, 0x08, 0x46, 0xb3, 0x09, 0x30, 0x00, 0x6c, 0x70, 0x00, 0x12, 
+  0xd1, 0x00, 0x0d, 0x09, 0x32, 0x20, 0xc4, 0xe1, 0xa2, 0x00, 0x05, 0x00, 
+  0xdc, 0x00, 0x51, 0xb1, 0x00, 0xff, 0xd8, 0x09, 0xdc, 0x00, 0xf0, 0x29, 
+  0x83, 0x10, 0x09, 0xad, 0x0b, 0x08, 0xa1, 0x03, 0x22, 0x40, 0xe1, 0x85, 
+  0x08, 0xf0, 0xe3, 0x8a, 0x02, 0x8a, 0xc9, 0xad, 0x08, 0xbf, 0x05, 0x7f, 
+  0xe1, 0xa5, 0x00, 0x8a, 0x8c, 0x27, 0x10, 0x90, 0x38, 0x00, 0x2d, 0x00, 
+  0x06, 0xb8, 0x61, 0x8a, 0x04, 0x20, 0x81, 0x0f, 0x00, 0x00, 0xc0, 0x1f, 
+  0x78, 0x61, 0x29, 0x0f, 0x04, 0x10, 0xd3, 0x40, 0x82, 0x00, 0xf0, 0x02, 
+  0x00, 0x21, 0x00, 0x04, 0x24, 0x6a, 0x2e, 0x0c, 0xaf, 0xe9, 0x60, 0x42, 
+  0x41, 0x09, 0x13, 0x20, 0x15, 0x1a, 0x01, 0x90, 0x46, 0x12, 0x00, 0xf4, 
+  0x4a, 0x09, 0xf0, 0x6c, 0x70, 0xc8, 0x00, 0x20, 0x17, 0xf0, 0x10, 0x00, 
+  0x23, 0xf8, 0x4a, 0x1e, 0x01, 0x11, 0x43, 0x14, 0x01, 0xf0, 0x02, 0x24, 
+  0x08, 0x00, 0x02, 0x41, 0x23, 0x20, 0x80, 0x03, 0xe1, 0x42, 0x6c, 0x70, 
+  0x0b, 0x08, 0x32, 0x00, 0x2a, 0x00, 0xf7, 0x96, 0x6c, 0x71, 0x60, 0x40, 
+  0xca, 0xc6, 0xe0, 0x78, 0xe2, 0xc2, 0x08, 0x44, 0xfd, 0xe0, 0x68, 0x45, 
+  0x09, 0xf2, 0xfe, 0xe4, 0x0c, 0xf4, 0x40, 0x40, 0xdf, 0x59, 0x00, 0x1d, 
+  0x05, 0x11, 0x0c, 0x71, 0xc2, 0xc6, 0x25, 0xd8, 0x56, 0x0e, 0xef, 0xff, 
+  0xa1, 0x43, 0xc2, 0xc6, 0xbf, 0xe4, 0x0c, 0x70, 0x38, 0xf7, 0x13, 0x0c, 
+  0x50, 0x10, 0x13, 0x0c, 0x50, 0x11, 0xe9, 0x0c, 0xd1, 0x90, 0x21, 0xd8, 
+  0xf2, 0xf1, 0x20, 0xd8, 0xf0, 0xf1, 0x22, 0xd8, 0xee, 0xf1, 0xe0, 0x78, 
+  0xf1, 0xc0, 0x00, 0x43, 0xfd, 0xe0, 0x06, 0xf4, 0x25, 0xd8, 0xfa, 0x0e, 
+  0xcf, 0xff, 0x0d, 0xf0, 0xbf, 0xe3, 0x0c, 0x70, 0x09, 0xf7, 0x17, 0x0b, 
+  0x50, 0x00, 0x17, 0x0b, 0x50, 0x01, 0x0b, 0x0b, 0xd1, 0x00, 0x21, 0xd8, 
+  0xf3, 0xf1, 0xd1, 0xc0, 0xe0, 0x7e, 0x20, 0xd8, 0xef, 0xf1, 0x22, 0xd8, 
+  0xed, 0xf1, 0xe0, 0x78, 0xe4, 0xc3, 0xa1, 0xc1, 0x80, 0xc0, 0xc3, 0x41, 
+  0x13, 0x00, 0xb8, 0x78, 0x5a, 0x0b, 0xaf, 0xe9, 0x4c, 0x74, 0x3b, 0x58, 
+  0x08, 0x46, 0x28, 0x45, 0xfe, 0xd8, 0x80, 0xc1, 0x8c, 0x70, 0xc1, 0x42, 
+  0xa1, 0x43, 0x6b, 0x58, 0xf8, 0x0c, 0x00, 0xf0, 0x72, 0xc3, 0x40, 0xf0, 
+  0x00, 0x3f, 0x00, 0x20, 0x88, 0x84, 0xb9, 0x20, 0xa8, 0xc4, 0xc7, 0xe0, 
+  0x78, 0xe6, 0xc2, 0x08, 0x45, 0x12, 0x18, 0x85, 0x07, 0x28, 0xda, 0x0c, 
+  0x18, 0x01, 0x05, 0x68, 0x18, 0x81, 0x02, 0xc3, 0x41, 0xc0, 0x49, 0x00, 
+  0x92, 0xc3, 0x40, 0x07, 0x49, 0x00, 0x24, 0x40, 0x25, 0x0e, 0x17, 0x50, 
+  0xad, 0x22, 0xa5, 0x01, 0xa5, 0x2c, 0x70, 0x3c, 0xda, 0xc1, 0x40, 0x64, 
+  0x1d, 0x81, 0x12, 0x3a, 0x09, 0xaf, 0xf7, 0x58, 0x1d, 0xc3, 0x10, 0xae, 
+  0x0a, 0x6f, 0xf0, 0xc1, 0x40, 0x1a, 0x85, 0x19, 0x08, 0x72, 0x02, 0xed, 
+  0x70, 0x19, 0x85, 0x11, 0x08, 0x70, 0x02, 0xc1, 0x40, 0x96, 0x0a, 0x6f, 
+  0xf0, 0x64, 0x1d, 0x41, 0x12, 0x09, 0x95, 0xcb, 0x44, 0xc8, 0x42, 0x00, 
+  0x00, 0xc3, 0x43, 0x83, 0x3a, 0x6f, 0x12, 0x48, 0x30, 0x00, 0x00, 0x00, 
+  0x30, 0x00, 0x03, 0x00, 0x30, 0xc1, 0xf0, 0x04, 0xf0, 0x2a, 0x83, 0xc5, 
+  0xf6, 0x3f, 0xd8, 0x18, 0xb8, 0x04, 0xf0, 0xc3, 0x40, 0x00, 0xbf, 0x00, 
+  0x00, 0x01, 0x31, 0x00, 0x00, 0x30, 0x8d, 0x48, 0x30, 0xc0, 0x02, 0x10, 
+  0x7a, 0x8b, 0xe2, 0x48, 0x31, 0x01, 0x00, 0xca, 0x20, 0xa6, 0x02, 0x00, 
+  0x31, 0x01, 0x03, 0x10, 0x78, 0x48, 0x20, 0xc0, 0x00, 0x0c, 0xb5, 0xb6, 
+  0x08, 0x2f, 0xf4, 0x00, 0x31, 0xc0, 0x00, 0x24, 0x00, 0x42, 0x05, 0xa5, 
+  0xc6, 0xc6, 0xb8, 0x00, 0xf0, 0x1d, 0x8a, 0x20, 0x0a, 0x00, 0xcb, 0x46, 
+  0x16, 0x43, 0x00, 0x00, 0xc3, 0x41, 0xfd, 0x44, 0x00, 0x20, 0x10, 0xb5, 
+  0x01, 0xa5, 0x55, 0x25, 0x40, 0x1c, 0xc7, 0xa5, 0x16, 0x0b, 0x6f, 0xeb, 
+  0x24, 0xa5, 0x0a, 0x0d, 0x6f, 0xeb, 0x56, 0x25, 0x80, 0x1a, 0x56, 0x25, 
+  0x00, 0x1d, 0x22, 0x01, 0xf0, 0x1f, 0x7c, 0x5e, 0x3a, 0x0a, 0xaf, 0xe9, 
+  0x40, 0xda, 0x07, 0x85, 0x7f, 0xd9, 0x17, 0xb9, 0x07, 0x31, 0x09, 0x00, 
+  0x04, 0x15, 0x0b, 0x10, 0xc3, 0x42, 0x1c, 0x49, 0x00, 0x40, 0xc3, 0x40, 
+  0x48, 0x41, 0x00, 0x00, 0x46, 0xa5, 0x48, 0x33, 0x8b, 0x10, 0x00, 0x33, 
+  0x02, 0x10, 0xcb, 0x47, 0xb8, 0x00, 0xf0, 0x41, 0xcb, 0x44, 0x48, 0x44, 
+  0x00, 0x00, 0x00, 0x32, 0xc2, 0x03, 0xcc, 0x70, 0x8a, 0x1d, 0x18, 0x13, 
+  0x50, 0x21, 0xcc, 0x05, 0xcb, 0x40, 0x10, 0x42, 0x00, 0x00, 0x8b, 0x1d, 
+  0x98, 0x13, 0xc3, 0x43, 0x96, 0x44, 0x00, 0x00, 0xcb, 0x46, 0xaf, 0x49, 
+  0x00, 0xc8, 0x81, 0x41, 0x04, 0x32, 0x80, 0x81, 0x78, 0x1d, 0x18, 0x12, 
+  0x89, 0x1d, 0xd8, 0x10, 0xc5, 0xa5, 0xc4, 0x1d, 0x40, 0x12, 0xcf, 0x21, 
+  0xec, 0x07, 0x70, 0x95, 0x01, 0x32, 0x41, 0x00, 0x48, 0x31, 0xc2, 0x02, 
+  0x48, 0x33, 0x01, 0x00, 0x4e, 0x06, 0xf0, 0x0b, 0x49, 0x22, 0x02, 0x02, 
+  0x00, 0x30, 0xc1, 0x03, 0x48, 0x22, 0x00, 0x01, 0x04, 0x31, 0x80, 0x81, 
+  0x02, 0xa5, 0x02, 0xf6, 0x9f, 0xbc, 0x01, 0x31, 0x00, 0x03, 0xde, 0x00, 
+  0xf0, 0x01, 0x49, 0x20, 0x40, 0x06, 0x48, 0x20, 0x00, 0x01, 0x09, 0xa5, 
+  0x0e, 0x08, 0x20, 0x00, 0xa1, 0x40, 0xec, 0x00, 0xf1, 0x1d, 0xe8, 0xc3, 
+  0xa4, 0xc1, 0x4a, 0x24, 0x00, 0x76, 0x08, 0x46, 0x40, 0x20, 0x0d, 0x0b, 
+  0x0c, 0x70, 0xa8, 0x20, 0x00, 0x01, 0x04, 0x1d, 0x11, 0x10, 0x4a, 0x24, 
+  0x80, 0x77, 0xcc, 0x1e, 0x00, 0x10, 0x0c, 0x1e, 0x00, 0x10, 0x55, 0x26, 
+  0x00, 0x1d, 0x53, 0x1e, 0x59, 0x10, 0x1c, 0x00, 0x30, 0x18, 0x11, 0x00, 
+  0xcc, 0x06, 0x84, 0x55, 0x26, 0x4f, 0x1a, 0x0a, 0x20, 0xc0, 0x03, 0x14, 
+  0x00, 0xf0, 0x21, 0x00, 0x18, 0x03, 0x00, 0x56, 0x26, 0x80, 0x1a, 0x4a, 
+  0x0c, 0x6f, 0xeb, 0x10, 0x40, 0x41, 0x87, 0x02, 0x87, 0x60, 0x87, 0xc3, 
+  0x41, 0x7a, 0x44, 0x00, 0x00, 0x43, 0xc1, 0x41, 0xc2, 0x42, 0xc0, 0x80, 
+  0xc1, 0x10, 0xda, 0x02, 0x40, 0x16, 0x09, 0xaf, 0xe9, 0x40, 0xc3, 0x56, 
+  0x26, 0x0f, 0x1b, 0x34, 0x01, 0x80, 0xbc, 0x5e, 0x40, 0xda, 0x02, 0x09, 
+  0xaf, 0xe9, 0x48, 0x00, 0x00, 0x54, 0x00, 0x06, 0x7c, 0x00, 0x81, 0xc0, 
+  0x70, 0x0a, 0x20, 0x80, 0x0f, 0x7a, 0xc4, 0x2c, 0x07, 0xf2, 0x39, 0x01, 
+  0x04, 0x1d, 0x10, 0x10, 0x80, 0xc1, 0xe1, 0x40, 0xb1, 0x1e, 0x43, 0x10, 
+  0xe2, 0x0a, 0xa0, 0x00, 0x28, 0x1e, 0x01, 0x10, 0x55, 0x26, 0x40, 0x1b, 
+  0x80, 0xc1, 0xc6, 0x08, 0xaf, 0xe9, 0x10, 0xda, 0xc8, 0xc7, 0xe0, 0x78, 
+  0xee, 0xc3, 0x82, 0x24, 0x06, 0x3d, 0x08, 0x46, 0x54, 0x20, 0x00, 0x09, 
+  0x2c, 0x70, 0xf2, 0x0e, 0x6f, 0xf7, 0x14, 0xda, 0x4a, 0x24, 0x40, 0x71, 
+  0xd1, 0x41, 0x54, 0x26, 0x93, 0x1b, 0x80, 0x21, 0x8e, 0x21, 0xad, 0x60, 
+  0x00, 0xf5, 0x39, 0x1b, 0x11, 0x20, 0x2c, 0x70, 0x28, 0x47, 0x8f, 0xbf, 
+  0x40, 0xdc, 0x00, 0x19, 0x42, 0x23, 0xfe, 0x19, 0x44, 0xa3, 0xfc, 0x19, 
+  0x44, 0xa3, 0x47, 0x09, 0x75, 0x01, 0x15, 0x26, 0x43, 0x10, 0x4d, 0x83, 
+  0x1d, 0x0a, 0x70, 0x01, 0x14, 0x26, 0x40, 0x10, 0x23, 0x0a, 0x51, 0x02, 
+  0x52, 0x18, 0x44, 0x03, 0x48, 0x18, 0x44, 0x03, 0x7f, 0xd8, 0x17, 0xb8, 
+  0x10, 0xf0, 0x52, 0x18, 0xc4, 0x03, 0x48, 0x18, 0x04, 0x03, 0x4f, 0xd8, 
+  0x18, 0xb8, 0x08, 0x0e, 0x00, 0xf2, 0x5f, 0xc3, 0x40, 0x7f, 0x7f, 0xff, 
+  0xff, 0x17, 0xa3, 0x24, 0x71, 0xde, 0xf1, 0xc1, 0x40, 0x80, 0x20, 0x07, 
+  0x0d, 0x4a, 0x21, 0x00, 0x00, 0x6e, 0x0e, 0x6f, 0xf7, 0x8a, 0x22, 0x06, 
+  0x00, 0xdf, 0xe5, 0x94, 0x00, 0x2d, 0x00, 0x15, 0x26, 0x52, 0x13, 0x74, 
+  0x12, 0x03, 0x20, 0x4a, 0x24, 0x80, 0x7b, 0xd3, 0x40, 0x13, 0x00, 0xb8, 
+  0x60, 0x4a, 0x20, 0x00, 0x00, 0x40, 0x20, 0x0c, 0x23, 0xa8, 0x20, 0x80, 
+  0x02, 0x04, 0x14, 0x0b, 0x14, 0x81, 0xc1, 0x1a, 0x61, 0x04, 0x71, 0x38, 
+  0x23, 0xc1, 0x10, 0x20, 0xaa, 0x26, 0x0e, 0xe0, 0x01, 0x81, 0xc0, 0x14, 
+  0x70, 0x0c, 0x70, 0x0a, 0xf2, 0x14, 0x26, 0x41, 0x13, 0xfa, 0x19, 0x1c, 
+  0x00, 0x80, 0x21, 0x0a, 0x0d, 0x00, 0xb1, 0x22, 0xf0, 0x46, 0x00, 0x00, 
+  0x2c, 0x01, 0xf0, 0x13, 0xc0, 0x02, 0x04, 0x10, 0x01, 0x24, 0x40, 0x24, 
+  0x42, 0x30, 0x1a, 0x62, 0x04, 0x71, 0x38, 0x21, 0xc1, 0x00, 0x20, 0xaa, 
+  0x40, 0x24, 0x40, 0x30, 0x5a, 0x0e, 0x2f, 0xf4, 0x14, 0x26, 0x50, 0x13, 
+  0x02, 0x41, 0x34, 0x00, 0xf0, 0x09, 0x04, 0xe8, 0x8a, 0x20, 0x04, 0x00, 
+  0x03, 0xf0, 0x40, 0xd8, 0xe0, 0xb1, 0xfa, 0x18, 0x1c, 0x20, 0xa5, 0x71, 
+  0xb8, 0xf1, 0x8d, 0xc0, 0x2c, 0x70, 0x9c, 0x00, 0xf0, 0xb7, 0xca, 0x0d, 
+  0x6f, 0xf7, 0x40, 0x24, 0x0d, 0x3d, 0x8a, 0x24, 0x01, 0x78, 0x54, 0x26, 
+  0x89, 0x1e, 0xa8, 0x20, 0x82, 0x07, 0x04, 0x11, 0x02, 0x14, 0xc3, 0x40, 
+  0x8b, 0x3a, 0x58, 0xa0, 0xd5, 0xe2, 0x96, 0x00, 0x29, 0x00, 0x8d, 0x71, 
+  0xee, 0x6a, 0xd5, 0x0f, 0x75, 0x1f, 0x6c, 0x70, 0x6d, 0x71, 0x0d, 0x71, 
+  0x4c, 0x71, 0x25, 0x20, 0xc0, 0x03, 0x65, 0xf0, 0x62, 0xf0, 0x63, 0xf0, 
+  0x60, 0xf0, 0x61, 0xf0, 0x5e, 0xf0, 0x5f, 0xf0, 0x5c, 0xf0, 0x5d, 0xf0, 
+  0x5a, 0xf0, 0x5b, 0xf0, 0x58, 0xf0, 0x59, 0xf0, 0x56, 0xf0, 0x54, 0xf0, 
+  0x54, 0xf0, 0x52, 0xf0, 0x52, 0xf0, 0x58, 0xf0, 0x50, 0xf0, 0x56, 0xf0, 
+  0x4e, 0xf0, 0x54, 0xf0, 0x4c, 0xf0, 0x52, 0xf0, 0x4a, 0xf0, 0x50, 0xf0, 
+  0x48, 0xf0, 0x4e, 0xf0, 0x46, 0xf0, 0x4c, 0xf0, 0x44, 0xf0, 0x42, 0xf0, 
+  0x42, 0xf0, 0x40, 0xf0, 0x40, 0xf0, 0x19, 0xf0, 0x3e, 0xf0, 0x17, 0xf0, 
+  0x3c, 0xf0, 0x15, 0xf0, 0x3a, 0xf0, 0x13, 0xf0, 0x38, 0xf0, 0x11, 0xf0, 
+  0x36, 0xf0, 0x0f, 0xf0, 0x34, 0xf0, 0x0d, 0xf0, 0x32, 0xf0, 0x27, 0xf0, 
+  0x30, 0xf0, 0x25, 0xf0, 0x2e, 0xf0, 0x23, 0xf0, 0x2c, 0xf0, 0x2d, 0xf0, 
+  0x2a, 0xf0, 0x2b, 0xf0, 0x28, 0xf0, 0x29, 0xf0, 0x8d, 0x70, 0x25, 0xf0, 
+  0x8c, 0x22, 0x42, 0x8d, 0xcf, 0xf6, 0x8c, 0x22, 0x82, 0x8d, 0x18, 0xf2, 
+  0x8c, 0x22, 0x02, 0x8e, 0x06, 0x00, 0xf0, 0x4f, 0x82, 0x8e, 0xf3, 0xf3, 
+  0x8c, 0x22, 0x03, 0x80, 0x0a, 0xf2, 0x14, 0xf0, 0x80, 0x22, 0xbe, 0x0a, 
+  0x25, 0x0a, 0x75, 0x01, 0x15, 0xd8, 0x1d, 0x08, 0x8e, 0x00, 0x8a, 0x21, 
+  0x44, 0x00, 0x0b, 0xf0, 0x6d, 0x70, 0x6c, 0x71, 0x0b, 0xf0, 0x6c, 0x70, 
+  0x08, 0xf0, 0x0d, 0x71, 0x6d, 0x71, 0x4c, 0x71, 0x0a, 0xf0, 0x2c, 0x70, 
+  0x6c, 0x71, 0x6d, 0x71, 0xc3, 0x40, 0xcc, 0x3d, 0xcd, 0xcc, 0x4c, 0x70, 
+  0x68, 0x40, 0x52, 0x24, 0x0c, 0x10, 0x75, 0x70, 0x52, 0x23, 0x03, 0x10, 
+  0x85, 0x7a, 0xca, 0x20, 0x81, 0x0f, 0x1c, 0x41, 0x0a, 0xe8, 0x15, 0x70, 
+  0x52, 0x20, 0x0b, 0x10, 0x45, 0x7b, 0x10, 0x00, 0xf0, 0x23, 0x20, 0x3c, 
+  0x12, 0xac, 0x05, 0x23, 0xfe, 0x82, 0x1c, 0x71, 0x41, 0x29, 0x03, 0x06, 
+  0x41, 0x29, 0x02, 0x04, 0x41, 0x29, 0x00, 0x02, 0x20, 0xad, 0x63, 0xad, 
+  0x42, 0xad, 0x01, 0xad, 0xa5, 0x74, 0x00, 0x13, 0x82, 0x20, 0xdf, 0x16, 
+  0x00, 0x16, 0x8e, 0x0f, 0x20, 0x01, 0x8d, 0xc1, 0x7f, 0xda, 0xc3, 0x43, 
+  0xa2, 0x04, 0xa0, 0x17, 0xba, 0xc3, 0x41, 0x74, 0x49, 0x00, 0x24, 0xc3, 
+  0x40, 0x0a, 0x03, 0xf0, 0x24, 0xfb, 0x19, 0x43, 0xa0, 0xde, 0x1e, 0x19, 
+  0x10, 0xdd, 0x1e, 0xd8, 0x10, 0x4c, 0xa6, 0x2b, 0xa6, 0x0a, 0xa6, 0xce, 
+  0xc7, 0xea, 0xc2, 0x10, 0x40, 0x82, 0x0a, 0x2f, 0xfd, 0x55, 0x20, 0x4d, 
+  0x08, 0xcb, 0x40, 0x48, 0x43, 0x00, 0x00, 0x83, 0xdb, 0x8a, 0x27, 0x44, 
+  0x30, 0x8a, 0x25, 0x01, 0x09, 0xc3, 0x44, 0xa0, 0xe6, 0x04, 0xe0, 0x47, 
+  0x20, 0x41, 0x00, 0x00, 0xc3, 0x46, 0xc0, 0x3f, 0x00, 0x00, 0xcb, 0x43, 
+  0xfa, 0x16, 0x04, 0xf0, 0x15, 0x47, 0x0e, 0x3d, 0x4d, 0xf3, 0xcb, 0x46, 
+  0xd6, 0x3c, 0x62, 0xa1, 0xcb, 0x44, 0x03, 0x3b, 0x6f, 0x12, 0xcb, 0x41, 
+  0x23, 0x3c, 0x0a, 0xd7, 0x8a, 0x21, 0x07, 0x2d, 0x8a, 0x26, 0x04, 0x3b, 
+  0x17, 0xbb, 0xc3, 0x42, 0xc8, 0x34, 0x00, 0xf3, 0x88, 0x41, 0x7a, 0x45, 
+  0x00, 0x00, 0xc3, 0x40, 0x70, 0x41, 0x00, 0x00, 0x70, 0x18, 0x00, 0x22, 
+  0x8a, 0x20, 0x87, 0x10, 0x7a, 0x18, 0x83, 0x20, 0x78, 0x18, 0x05, 0x20, 
+  0x6c, 0x18, 0xc4, 0x27, 0x74, 0x18, 0x40, 0x22, 0x90, 0x1d, 0x00, 0x12, 
+  0x5c, 0x1d, 0x40, 0x11, 0x58, 0x1d, 0x00, 0x11, 0x54, 0x1d, 0xc0, 0x11, 
+  0x50, 0x1d, 0x80, 0x11, 0x4c, 0x1d, 0xc0, 0x12, 0xe2, 0xa5, 0xc1, 0xa5, 
+  0x80, 0xa5, 0x88, 0x1d, 0x40, 0x14, 0x78, 0x1d, 0x80, 0x17, 0x7d, 0xa5, 
+  0x5c, 0xa5, 0x3b, 0xa5, 0x0e, 0xa5, 0xca, 0xc6, 0xea, 0xc3, 0xbe, 0xc1, 
+  0xa8, 0x47, 0x08, 0x46, 0x0c, 0x70, 0x02, 0xa7, 0x01, 0xa7, 0x00, 0xa7, 
+  0x8a, 0x86, 0x30, 0x41, 0xcb, 0x45, 0x82, 0x44, 0x55, 0x35, 0x02, 0x24, 
+  0x01, 0x03, 0x84, 0x86, 0x48, 0x31, 0x8b, 0x00, 0x21, 0x86, 0x00, 0x34, 
+  0xcc, 0x12, 0x28, 0x1e, 0x00, 0x11, 0x04, 0x34, 0x40, 0x90, 0xca, 0x21, 
+  0x05, 0x03, 0x04, 0x31, 0x40, 0x83, 0xca, 0x25, 0x49, 0x10, 0xb6, 0xa6, 
+  0x02, 0xeb, 0xca, 0xc7, 0xec, 0x03, 0xf0, 0x06, 0x02, 0x04, 0x12, 0x01, 
+  0x04, 0x00, 0x31, 0x41, 0x00, 0x01, 0x30, 0x40, 0x00, 0x28, 0x86, 0x04, 
+  0x30, 0x40, 0x80, 0x19, 0xf6, 0x1c, 0x00, 0x61, 0x0e, 0x70, 0x22, 0x41, 
+  0x4a, 0x22, 0xfc, 0x03, 0xf0, 0x08, 0x02, 0x04, 0x11, 0x00, 0x04, 0x00, 
+  0x30, 0x00, 0x00, 0x01, 0x32, 0x02, 0x00, 0x38, 0x86, 0x01, 0x32, 0x80, 
+  0x0f, 0x80, 0xbf, 0x00, 0x00, 0x2c, 0x00, 0xf1, 0x02, 0x90, 0x01, 0x0c, 
+  0x00, 0x24, 0x16, 0x80, 0x10, 0x1c, 0x16, 0x10, 0x10, 0x04, 0xe8, 0x5c, 
+  0x1e, 0x03, 0x38, 0x04, 0x20, 0xad, 0x70, 0xc4, 0x04, 0xf0, 0x35, 0xc0, 
+  0x03, 0x15, 0x26, 0x01, 0x10, 0x33, 0x81, 0xf0, 0x21, 0x03, 0x20, 0x97, 
+  0xc2, 0x00, 0x30, 0x41, 0x20, 0x15, 0x7a, 0x02, 0x33, 0x41, 0x00, 0x04, 
+  0x71, 0x20, 0xa2, 0x3c, 0x16, 0x80, 0x10, 0x40, 0x26, 0x10, 0x1b, 0x3c, 
+  0xe8, 0x97, 0xc1, 0x80, 0xc2, 0x02, 0x40, 0xb2, 0x0d, 0xef, 0xef, 0x3c, 
+  0x1e, 0x42, 0x13, 0xc6, 0x0c, 0x6f, 0xf1, 0x80, 0xc0, 0x02, 0xc6, 0x80, 
+  0xc0, 0xba, 0x0c, 0x6f, 0xf1, 0x42, 0xc5, 0xf4, 0x03, 0xf1, 0x19, 0x01, 
+  0x36, 0x01, 0x10, 0x50, 0x20, 0xc2, 0x05, 0x02, 0x30, 0x80, 0x03, 0x00, 
+  0x31, 0x81, 0x00, 0x00, 0x30, 0x80, 0x00, 0x2f, 0x33, 0x40, 0x00, 0x01, 
+  0xc1, 0x45, 0xc5, 0x2f, 0x32, 0x00, 0x00, 0x00, 0xc0, 0x52, 0x20, 0xc0, 
+  0x07, 0x46, 0xc3, 0x1c, 0x00, 0x10, 0x32, 0xec, 0x04, 0xf0, 0x16, 0x44, 
+  0xc0, 0x83, 0xc0, 0x9a, 0xc2, 0x92, 0x0c, 0xef, 0xef, 0x02, 0x41, 0x9a, 
+  0xc0, 0xf6, 0x0c, 0xef, 0xef, 0x83, 0xc1, 0x83, 0xc1, 0x10, 0xda, 0x1a, 
+  0x0c, 0x6f, 0xe9, 0x02, 0x40, 0xca, 0xc7, 0x9a, 0xc0, 0x10, 0xda, 0x0e, 
+  0x0c, 0x00, 0x51, 0x41, 0x9a, 0xc0, 0xa2, 0x09, 0x1e, 0x00, 0xf0, 0x08, 
+  0xc0, 0xb2, 0x09, 0xef, 0xef, 0x8a, 0xc1, 0x97, 0xc0, 0x8a, 0xc1, 0x8d, 
+  0xc2, 0xfa, 0x09, 0x2f, 0xf4, 0x40, 0x24, 0x10, 0x3d, 0x86, 0x86, 0xce, 
+  0x00, 0xf0, 0x07, 0x54, 0x26, 0x0d, 0x18, 0xa1, 0x41, 0xa8, 0x20, 0x80, 
+  0x03, 0x04, 0x10, 0x00, 0x24, 0x56, 0x86, 0x60, 0x81, 0x00, 0x34, 0x00, 
+  0x10, 0x86, 0x00, 0xe0, 0x01, 0x33, 0x00, 0x00, 0x04, 0x19, 0x10, 0x00, 
+  0x40, 0x85, 0x02, 0x85, 0x21, 0x85, 0x2c, 0x00, 0xf1, 0x07, 0x47, 0xc2, 
+  0x49, 0xc0, 0x40, 0xc2, 0x42, 0xc0, 0x0e, 0x70, 0x80, 0xc2, 0x87, 0xc3, 
+  0x0c, 0x70, 0x48, 0xc1, 0x04, 0x1c, 0x40, 0x30, 0x60, 0x04, 0x50, 0x12, 
+  0x0c, 0x04, 0x04, 0x13, 0x6c, 0x01, 0x20, 0x01, 0x03, 0x6c, 0x01, 0x40, 
+  0x04, 0x30, 0x80, 0x8f, 0x30, 0x02, 0x83, 0x24, 0x00, 0x0c, 0x00, 0xde, 
+  0x0e, 0xcf, 0xf5, 0x90, 0x01, 0xd0, 0x03, 0x00, 0x15, 0x01, 0x10, 0x00, 
+  0x30, 0x41, 0x00, 0x00, 0x31, 0x81, 0x0f, 0x18, 0x03, 0x31, 0x04, 0x1d, 
+  0x50, 0x54, 0x01, 0xf0, 0x03, 0xa8, 0x20, 0x40, 0x04, 0x8d, 0xc0, 0x45, 
+  0x86, 0xf0, 0x20, 0x00, 0x04, 0x15, 0x26, 0x01, 0x14, 0x30, 0x81, 0xec, 
+  0x00, 0x40, 0x15, 0x27, 0x03, 0x14, 0x4e, 0x00, 0x60, 0x06, 0x71, 0x00, 
+  0xa3, 0x17, 0xf1, 0x8a, 0x01, 0xf2, 0x2f, 0x14, 0x70, 0x40, 0xf3, 0xdc, 
+  0x4e, 0x9a, 0xc0, 0x2e, 0x0b, 0x6f, 0xe9, 0x10, 0xda, 0x9a, 0xc0, 0xc2, 
+  0x08, 0xef, 0xef, 0x93, 0xc1, 0x93, 0xc0, 0xd2, 0x08, 0xef, 0xef, 0x90, 
+  0xc1, 0x90, 0xc1, 0x8d, 0xc2, 0x22, 0x40, 0x1a, 0x09, 0x2f, 0xf4, 0x8d, 
+  0xc5, 0x5c, 0x16, 0x80, 0x10, 0x25, 0x16, 0x81, 0x10, 0x0f, 0x08, 0x65, 
+  0x00, 0x04, 0x71, 0x5c, 0x1e, 0x02, 0x10, 0x22, 0xf1, 0xfa, 0x01, 0x00, 
+  0x3c, 0x05, 0x01, 0xf8, 0x01, 0x31, 0x15, 0x00, 0x14, 0xf8, 0x01, 0xd2, 
+  0x31, 0x01, 0x00, 0x19, 0x86, 0x04, 0x31, 0x00, 0x80, 0x24, 0x06, 0xec, 
+  0xff, 0x14, 0x01, 0x75, 0x80, 0x19, 0x0e, 0x70, 0x3c, 0x1e, 0x43, 0x90, 
+  0x06, 0xc0, 0x04, 0xf1, 0xe0, 0x78, 0xe2, 0xc2, 0xda, 0x0c, 0xaf, 0xfc, 
+  0x08, 0x45, 0x22, 0x00, 0x00, 0xba, 0x01, 0xf1, 0x01, 0x4c, 0x70, 0x54, 
+  0x25, 0x01, 0x18, 0x0e, 0xa5, 0x4d, 0xa5, 0x4c, 0xa5, 0x4b, 0xa5, 0x4a, 
+  0xa5, 0x2c, 0x00, 0x12, 0x19, 0xbc, 0x06, 0x04, 0x0c, 0x00, 0x20, 0xc3, 
+  0x41, 0xa4, 0x03, 0xf0, 0x05, 0xc3, 0x40, 0x9c, 0x46, 0x00, 0x40, 0x5c, 
+  0x1d, 0x82, 0x10, 0x3d, 0x1d, 0x43, 0x10, 0x3a, 0xa5, 0x01, 0xa5, 0xc2, 
+  0xc6, 0x50, 0x00, 0xf0, 0x27, 0x24, 0x77, 0x29, 0x09, 0xb5, 0x02, 0x08, 
+  0x45, 0x25, 0x20, 0x40, 0x00, 0x0b, 0xf0, 0x0f, 0xf0, 0x15, 0xf0, 0x19, 
+  0xf0, 0x1f, 0xf0, 0x23, 0xf0, 0x2a, 0xf0, 0x2f, 0xf0, 0x3b, 0xf0, 0x33, 
+  0xf0, 0x40, 0x40, 0xf6, 0x0c, 0x6f, 0xf7, 0x60, 0x41, 0x0c, 0xad, 0xc2, 
+  0xc6, 0x40, 0x40, 0xc2, 0x0e, 0xaf, 0xf4, 0x60, 0x41, 0x05, 0xa5, 0x0c, 
+  0x00, 0x11, 0xb6, 0x0c, 0x00, 0x11, 0x06, 0x0c, 0x00, 0x11, 0xaa, 0x0c, 
+  0x00, 0x11, 0x07, 0x0c, 0x00, 0x11, 0x9e, 0x0c, 0x00, 0x11, 0x08, 0x0c, 
+  0x00, 0x11, 0xba, 0x3c, 0x00, 0x40, 0x24, 0x1d, 0x02, 0x10, 0x0e, 0x00, 
+  0x73, 0x82, 0x08, 0x6f, 0xf2, 0x60, 0x41, 0x25, 0x0e, 0x00, 0x11, 0x76, 
+  0x28, 0x00, 0x11, 0x18, 0x28, 0x00, 0x11, 0x6a, 0x0c, 0x00, 0x11, 0x04, 
+  0x0c, 0x00, 0x11, 0x5e, 0x0c, 0x00, 0x12, 0x19, 0xa0, 0x00, 0xb0, 0xc3, 
+  0xa4, 0xc1, 0x89, 0x69, 0x40, 0x41, 0x2b, 0x0c, 0xb5, 0x11, 0xa4, 0x00, 
+  0xf0, 0x0f, 0x00, 0x03, 0x07, 0xf0, 0x10, 0xf0, 0x16, 0xf0, 0x1b, 0xf0, 
+  0x27, 0xf0, 0x31, 0xf0, 0x80, 0xc2, 0x20, 0x40, 0x22, 0x0d, 0xaf, 0xf7, 
+  0x60, 0x41, 0x5c, 0x4d, 0x80, 0xc1, 0x9e, 0x09, 0x90, 0x01, 0xc0, 0xc2, 
+  0xc7, 0x20, 0x40, 0x2a, 0x0b, 0xaf, 0xec, 0x60, 0x41, 0x0a, 0xa5, 0x0c, 
+  0x00, 0x11, 0x3a, 0x82, 0x00, 0x10, 0x3c, 0x74, 0x00, 0x10, 0xc7, 0x30, 
+  0x00, 0xf2, 0x03, 0x6e, 0x08, 0xef, 0xf4, 0x60, 0x41, 0x00, 0xc2, 0x01, 
+  0xc1, 0x02, 0xc0, 0x50, 0xa5, 0x31, 0xa5, 0x12, 0xa5, 0x18, 0x00, 0x17, 
+  0x56, 0x18, 0x00, 0x51, 0x53, 0xa5, 0x34, 0xa5, 0x15, 0x3e, 0x00, 0x20, 
+  0xd2, 0x0d, 0x8c, 0x00, 0x42, 0x1a, 0xa5, 0xc2, 0xc7, 0x8c, 0x00, 0xf0, 
+  0x11, 0x48, 0x45, 0x62, 0x80, 0x56, 0x80, 0x2c, 0xe0, 0x46, 0x0b, 0xef, 
+  0xef, 0xa1, 0x44, 0x80, 0xc0, 0x10, 0xda, 0x2a, 0x09, 0x6f, 0xe9, 0xa1, 
+  0x41, 0x80, 0xc0, 0xf2, 0x09, 0xef, 0xef, 0xa1, 0x41, 0x28, 0x00, 0xf0, 
+  0x09, 0xe6, 0xc2, 0x08, 0x45, 0x12, 0x0b, 0xef, 0xff, 0x55, 0x20, 0xce, 
+  0x09, 0x7a, 0x0b, 0xaf, 0xfc, 0xa1, 0x40, 0xe8, 0x16, 0x09, 0x90, 0xc3, 
+  0x40, 0x86, 0x01, 0x20, 0xcb, 0x43, 0xb2, 0x04, 0xf0, 0x1b, 0x00, 0x31, 
+  0x09, 0x10, 0x71, 0x86, 0x07, 0x31, 0xc9, 0x12, 0x98, 0x86, 0x1a, 0xa5, 
+  0xcb, 0x40, 0x83, 0x3a, 0x6f, 0x12, 0x3f, 0xdf, 0x48, 0x33, 0x83, 0x00, 
+  0x00, 0x33, 0xc0, 0x02, 0xc3, 0x42, 0x23, 0x3d, 0x0a, 0xd7, 0x00, 0x30, 
+  0x00, 0x02, 0xc3, 0x41, 0xb4, 0x01, 0xf0, 0x0d, 0xcc, 0x70, 0x18, 0xbf, 
+  0x48, 0x34, 0x8c, 0x10, 0x5f, 0xa5, 0x21, 0xa5, 0xe1, 0x42, 0x00, 0x34, 
+  0xc1, 0x12, 0x04, 0x30, 0x80, 0x81, 0xca, 0x22, 0x8c, 0x0f, 0x00, 0xbf, 
+  0x4c, 0x00, 0xf0, 0x13, 0x03, 0x02, 0x01, 0x30, 0x80, 0x00, 0x04, 0x33, 
+  0x80, 0x81, 0x48, 0x30, 0xc0, 0x02, 0xf4, 0x1e, 0x43, 0x90, 0x3c, 0x1d, 
+  0x43, 0x10, 0x12, 0xa6, 0xe4, 0x1e, 0x40, 0x92, 0xe1, 0x41, 0x05, 0xf6, 
+  0xc3, 0x41, 0x28, 0x00, 0xf0, 0x03, 0x1e, 0x86, 0x48, 0x30, 0x80, 0x00, 
+  0x00, 0x30, 0xc2, 0x02, 0x01, 0x33, 0x40, 0x00, 0x00, 0x32, 0x03, 0x02, 
+  0x2e, 0x00, 0x00, 0x36, 0x00, 0x60, 0x19, 0xa6, 0x05, 0xf6, 0xcb, 0x47, 
+  0x24, 0x00, 0xa0, 0x01, 0x33, 0xc0, 0x03, 0xc3, 0x42, 0x13, 0x00, 0x48, 
+  0x5f, 0x1c, 0x00, 0xf3, 0x16, 0xc3, 0x41, 0x2b, 0x3c, 0x40, 0xeb, 0x1d, 
+  0xa6, 0x01, 0x82, 0x7e, 0x1e, 0x58, 0x10, 0x60, 0x82, 0x22, 0x82, 0x7b, 
+  0x1e, 0x18, 0x10, 0xa1, 0x40, 0x7a, 0x1e, 0xd8, 0x10, 0xca, 0x0a, 0x6f, 
+  0xfd, 0x7c, 0x1e, 0x58, 0x10, 0x1c, 0x56, 0x00, 0x80, 0xc0, 0x02, 0x00, 
+  0x30, 0x01, 0x02, 0x0c, 0x70, 0xc2, 0x02, 0xa1, 0xc4, 0xf6, 0x3f, 0xd8, 
+  0x18, 0xb8, 0x05, 0xf0, 0xc3, 0x40, 0x54, 0x00, 0x30, 0x31, 0x00, 0x00, 
+  0x4e, 0x00, 0xf0, 0x93, 0x49, 0x20, 0x00, 0x05, 0x48, 0x20, 0x80, 0x00, 
+  0x1f, 0xa6, 0xc6, 0xc6, 0xe0, 0x78, 0xe8, 0xc3, 0xa7, 0xc1, 0x08, 0x45, 
+  0x55, 0x20, 0x4e, 0x08, 0x6d, 0x18, 0x03, 0x02, 0x47, 0xdc, 0xc3, 0x42, 
+  0x3b, 0x4a, 0xc1, 0xbf, 0xc3, 0x41, 0xdc, 0x44, 0x30, 0x4e, 0xc3, 0x40, 
+  0x7b, 0x3e, 0xd7, 0x5e, 0x18, 0xbc, 0xc3, 0x43, 0xa3, 0x42, 0x0b, 0xd7, 
+  0xcb, 0x47, 0xd3, 0x3e, 0x98, 0xdd, 0x55, 0xa5, 0x34, 0xa5, 0x0c, 0xa5, 
+  0x55, 0x25, 0x00, 0x18, 0xc3, 0x41, 0x13, 0x00, 0x7c, 0x61, 0x10, 0xda, 
+  0x9a, 0xa5, 0x79, 0xa5, 0xf8, 0xa5, 0xaa, 0x0f, 0x2f, 0xe9, 0x0c, 0x1e, 
+  0x85, 0x11, 0x4a, 0x24, 0x00, 0x71, 0x8a, 0x21, 0x10, 0x02, 0xf7, 0xa5, 
+  0x7f, 0xdf, 0xcb, 0x43, 0x51, 0x3f, 0x18, 0xb7, 0xcb, 0x44, 0x98, 0x3d, 
+  0xc2, 0xb5, 0xc3, 0x43, 0x4c, 0x3f, 0xcd, 0xcc, 0xc3, 0x42, 0x83, 0x41, 
+  0x3b, 0x6c, 0xc3, 0x40, 0x21, 0x3d, 0xe0, 0x61, 0x70, 0x1e, 0x44, 0x10, 
+  0x2c, 0x70, 0x17, 0xbf, 0x28, 0x1d, 0x85, 0x11, 0x48, 0x1e, 0xc0, 0x12, 
+  0x8a, 0xa6, 0x7b, 0xa6, 0x4b, 0xa5, 0x68, 0x1e, 0x00, 0x10, 0x80, 0x04, 
+  0xf1, 0x10, 0x15, 0x25, 0x40, 0x10, 0x80, 0x10, 0x00, 0x00, 0x40, 0x24, 
+  0x10, 0x33, 0x15, 0x20, 0x42, 0x20, 0x02, 0x37, 0x00, 0x10, 0x24, 0x71, 
+  0x00, 0xa2, 0x82, 0x09, 0x60, 0x00, 0x83, 0xc0, 0x62, 0x06, 0x00, 0x00, 
+  0x6c, 0x00, 0x41, 0x54, 0x25, 0x00, 0x1e, 0xc0, 0x03, 0xf1, 0x03, 0x10, 
+  0x01, 0x24, 0x02, 0x37, 0x41, 0x10, 0x04, 0x18, 0x50, 0x00, 0x3e, 0x85, 
+  0x1f, 0x85, 0x5d, 0x85, 0x6a, 0xd2, 0x04, 0xf2, 0x01, 0x55, 0x25, 0x10, 
+  0x1a, 0x41, 0xc1, 0x42, 0xc0, 0x80, 0xc1, 0x02, 0x40, 0x00, 0x1c, 0x80, 
+  0x30, 0xe4, 0x05, 0x91, 0x02, 0x04, 0x07, 0x33, 0x82, 0x00, 0x04, 0x18, 
+  0x90, 0xa0, 0x03, 0xa6, 0x40, 0x25, 0x00, 0x17, 0x35, 0x1d, 0x43, 0x10, 
+  0x36, 0x1d, 0xe4, 0x03, 0x03, 0x18, 0x00, 0x18, 0x14, 0x10, 0x00, 0x32, 
+  0xa1, 0x40, 0xed, 0xcc, 0x03, 0xf1, 0x09, 0x18, 0x09, 0x00, 0x78, 0x4d, 
+  0x34, 0x1d, 0xc2, 0x13, 0x06, 0x0f, 0x2f, 0xfc, 0x2a, 0x1d, 0xc2, 0x13, 
+  0x02, 0x86, 0x40, 0x86, 0x21, 0x86, 0x8a, 0x72, 0x00, 0xe0, 0xc3, 0x43, 
+  0x51, 0x39, 0x17, 0xb7, 0x45, 0xc0, 0x83, 0xc0, 0xe6, 0xa6, 0xe4, 0xa6, 
+  0x54, 0x00, 0x00, 0x5c, 0x00, 0x51, 0x65, 0xa6, 0x43, 0xc2, 0x10, 0x20, 
+  0x05, 0x01, 0xac, 0x00, 0x31, 0x04, 0x07, 0x34, 0xac, 0x00, 0x10, 0x20, 
+  0x32, 0x00, 0x8f, 0x0c, 0x70, 0x55, 0x25, 0x41, 0x1b, 0x0b, 0xa6, 0x34, 
+  0x04, 0x01, 0x02, 0xc4, 0x00, 0x28, 0x00, 0x1d, 0x88, 0x00, 0x04, 0x0c, 
+  0x00, 0x00, 0x68, 0x01, 0x40, 0xe9, 0x1d, 0x03, 0x10, 0x4a, 0x01, 0xf0, 
+  0x17, 0x00, 0x18, 0x03, 0x00, 0xc8, 0xc7, 0xe0, 0x78, 0xe8, 0xc2, 0x4a, 
+  0x24, 0x80, 0x71, 0x10, 0x40, 0xfc, 0x18, 0x01, 0x00, 0xc3, 0x40, 0x00, 
+  0x00, 0x40, 0x9c, 0x8d, 0x70, 0xc3, 0x43, 0xa0, 0x3f, 0x00, 0x00, 0xc3, 
+  0x42, 0x7a, 0x44, 0xa4, 0x07, 0xf0, 0x21, 0xfa, 0x43, 0x00, 0x00, 0xec, 
+  0x18, 0x00, 0x20, 0xe8, 0x18, 0x00, 0x20, 0x56, 0x20, 0x00, 0x28, 0xcb, 
+  0x45, 0x13, 0x00, 0xb8, 0x5f, 0xf8, 0x18, 0xc0, 0x20, 0xf4, 0x18, 0x80, 
+  0x20, 0xf0, 0x18, 0x40, 0x20, 0xa8, 0x20, 0x40, 0x02, 0x33, 0x24, 0x41, 
+  0x13, 0x85, 0x71, 0x48, 0x31, 0x81, 0x00, 0x52, 0x01, 0xf0, 0x1b, 0xc3, 
+  0x41, 0x20, 0x42, 0x00, 0x00, 0x02, 0x40, 0x40, 0x25, 0x0e, 0x18, 0x46, 
+  0x18, 0x58, 0x20, 0x80, 0x20, 0x04, 0x07, 0x18, 0xda, 0xb6, 0x0d, 0x2f, 
+  0xe9, 0xc1, 0x41, 0x02, 0x40, 0x80, 0x20, 0x04, 0x0d, 0xf8, 0x4d, 0xaa, 
+  0x0d, 0x2f, 0xe9, 0x18, 0xda, 0x0e, 0x00, 0x51, 0x05, 0x03, 0x18, 0xda, 
+  0x9a, 0x1c, 0x00, 0x00, 0xae, 0x00, 0xa2, 0x02, 0x40, 0x7d, 0xd9, 0x80, 
+  0x20, 0x05, 0x09, 0x17, 0xb9, 0xb8, 0x00, 0x11, 0x50, 0xc4, 0x00, 0x86, 
+  0x0a, 0x21, 0x80, 0x0f, 0x74, 0x49, 0x00, 0x24, 0x14, 0x00, 0x46, 0x80, 
+  0x71, 0x81, 0xd9, 0x24, 0x00, 0x51, 0x85, 0x85, 0x66, 0x85, 0x47, 0x68, 
+  0x06, 0x60, 0x7d, 0xde, 0x02, 0x41, 0xcb, 0x47, 0xae, 0x03, 0xf4, 0x15, 
+  0xcb, 0x43, 0x12, 0x00, 0x80, 0x4f, 0x05, 0xbe, 0x80, 0x21, 0x06, 0x0b, 
+  0x00, 0x18, 0xc0, 0x03, 0x6a, 0x18, 0xd8, 0x22, 0x69, 0x18, 0x98, 0x23, 
+  0x67, 0x18, 0xd8, 0x20, 0x66, 0x18, 0x18, 0x23, 0x68, 0x18, 0x98, 0x20, 
+  0x38, 0x01, 0xf1, 0x3a, 0x0a, 0x46, 0xc3, 0x40, 0xa2, 0x44, 0x00, 0x80, 
+  0x80, 0x26, 0x09, 0x1f, 0x8a, 0x23, 0x0f, 0x0a, 0xc3, 0x42, 0x1c, 0x45, 
+  0x00, 0x40, 0x00, 0xa1, 0x6f, 0x18, 0x18, 0x20, 0xc1, 0x40, 0x71, 0x18, 
+  0xd8, 0x20, 0xda, 0x0b, 0xef, 0xef, 0x70, 0x18, 0x98, 0x20, 0x08, 0xd9, 
+  0xea, 0x0c, 0xef, 0xef, 0xc1, 0x40, 0x54, 0x25, 0x0d, 0x1a, 0x8a, 0x21, 
+  0x08, 0x00, 0x02, 0x40, 0xa6, 0x08, 0x20, 0x00, 0xa1, 0x42, 0x2c, 0x70, 
+  0x8b, 0xb9, 0x02, 0x40, 0x9a, 0x0c, 0x00, 0xf4, 0x4b, 0x0e, 0x08, 0x20, 
+  0x00, 0x02, 0x40, 0xc8, 0xc6, 0xe0, 0x78, 0xe6, 0xc3, 0xa6, 0xc1, 0x08, 
+  0x47, 0x80, 0x27, 0x09, 0x1f, 0x08, 0x46, 0x76, 0x0c, 0xef, 0xef, 0xe1, 
+  0x40, 0x4a, 0x24, 0x80, 0x72, 0x7f, 0xd9, 0xc1, 0x40, 0xad, 0x70, 0x40, 
+  0x29, 0xc1, 0x05, 0x80, 0x20, 0x0b, 0x05, 0xc0, 0x1f, 0x83, 0x12, 0xa0, 
+  0x1f, 0x44, 0x13, 0xc4, 0x1e, 0x58, 0x10, 0xc3, 0x1e, 0x58, 0x13, 0xc2, 
+  0x1e, 0x58, 0x13, 0xc1, 0x1e, 0x58, 0x13, 0xa2, 0x1f, 0x42, 0x13, 0xc6, 
+  0x1e, 0x58, 0x13, 0x9a, 0x1f, 0x42, 0x13, 0x98, 0x1f, 0x44, 0x13, 0x80, 
+  0x1f, 0x42, 0x13, 0xcc, 0x01, 0xf0, 0x1a, 0xcc, 0x16, 0x02, 0x10, 0xd0, 
+  0x16, 0x01, 0x10, 0xd4, 0x16, 0x00, 0x10, 0x43, 0xc2, 0x44, 0xc1, 0x45, 
+  0xc0, 0x40, 0x26, 0x02, 0x18, 0x80, 0xc1, 0xc1, 0x40, 0xc0, 0x1e, 0x58, 
+  0x13, 0x40, 0xc5, 0x41, 0xc5, 0xe6, 0x08, 0x6f, 0xfe, 0x42, 0xc5, 0xa8, 
+  0x44, 0x00, 0xf0, 0x0c, 0xc7, 0xe0, 0x78, 0xf0, 0xc3, 0xa6, 0xc1, 0x40, 
+  0x92, 0xcb, 0x44, 0x48, 0x47, 0x00, 0x00, 0x08, 0x45, 0x48, 0x32, 0x02, 
+  0x00, 0x07, 0x34, 0x8b, 0x10, 0xd3, 0x40, 0x28, 0x01, 0x61, 0x0a, 0x22, 
+  0x00, 0x24, 0xc3, 0x43, 0xcc, 0x04, 0xf0, 0x06, 0xda, 0x48, 0x31, 0x00, 
+  0x00, 0x07, 0x34, 0x13, 0x10, 0x6a, 0x15, 0x00, 0x16, 0x69, 0x15, 0x01, 
+  0x16, 0x0d, 0x70, 0x18, 0xba, 0x2a, 0x04, 0x00, 0xda, 0x01, 0xf1, 0x13, 
+  0x48, 0x41, 0x04, 0x33, 0x00, 0x94, 0xca, 0x22, 0xc5, 0x22, 0x00, 0x32, 
+  0x00, 0x20, 0x00, 0x32, 0x41, 0x20, 0x00, 0x30, 0xc0, 0x00, 0x00, 0x31, 
+  0xcb, 0x00, 0x04, 0x30, 0x00, 0x82, 0xca, 0x21, 0x8c, 0x1f, 0x38, 0x04, 
+  0xb0, 0x30, 0x40, 0x02, 0x55, 0x25, 0x91, 0x1e, 0x04, 0x33, 0x00, 0x92, 
+  0x40, 0x04, 0x82, 0xcb, 0x1d, 0x18, 0x10, 0x40, 0x40, 0x04, 0xf6, 0x56, 
+  0x04, 0xf0, 0x03, 0x7f, 0xdf, 0x17, 0xbf, 0x07, 0x37, 0xc9, 0x14, 0x26, 
+  0x41, 0x00, 0x25, 0x8e, 0x1f, 0x00, 0x00, 0x1c, 0x03, 0x5a, 0x00, 0xf0, 
+  0x15, 0x00, 0x32, 0x4c, 0x20, 0x01, 0x33, 0x01, 0x10, 0x00, 0x31, 0x00, 
+  0x13, 0x48, 0x31, 0xcc, 0x02, 0x00, 0x30, 0xc1, 0x00, 0xca, 0x1d, 0x18, 
+  0x13, 0x04, 0x31, 0x00, 0x82, 0xcd, 0x1d, 0x58, 0x12, 0x05, 0xf6, 0xc3, 
+  0x42, 0x3e, 0x00, 0xa1, 0xec, 0x15, 0x00, 0x10, 0x01, 0x31, 0x81, 0x00, 
+  0x8d, 0x70, 0xbe, 0x04, 0x00, 0x86, 0x00, 0xf1, 0x03, 0x31, 0x00, 0x10, 
+  0x00, 0x30, 0xc2, 0x00, 0x48, 0x31, 0xc0, 0x02, 0x04, 0x32, 0x00, 0x83, 
+  0x14, 0xae, 0xc5, 0xc6, 0x04, 0x13, 0x04, 0xc6, 0x04, 0x71, 0xfc, 0x15, 
+  0x01, 0x10, 0x01, 0x32, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x33, 0x41, 0x20, 
+  0x92, 0x00, 0x60, 0x00, 0x31, 0xc2, 0x00, 0x15, 0xae, 0x2e, 0x00, 0x0a, 
+  0x2c, 0x00, 0xe0, 0x71, 0x15, 0x0c, 0x16, 0x01, 0x32, 0x0b, 0x00, 0x2c, 
+  0x70, 0x48, 0x34, 0x80, 0x10, 0x5e, 0x00, 0x32, 0xc6, 0x1d, 0x58, 0x5e, 
+  0x00, 0xfa, 0x00, 0x33, 0xc0, 0x12, 0x04, 0x32, 0x40, 0x80, 0x20, 0xb6, 
+  0x22, 0xae, 0xce, 0x1d, 0x18, 0x10, 0x38, 0x00, 0x00, 0x60, 0x00, 0x81, 
+  0x00, 0x32, 0x82, 0x2f, 0xcc, 0x3e, 0xcd, 0xcc, 0x9c, 0x05, 0x7b, 0x32, 
+  0x40, 0x80, 0xc8, 0x1d, 0x18, 0x10, 0x50, 0x05, 0xf0, 0x06, 0x32, 0x01, 
+  0x00, 0xa1, 0x40, 0x80, 0x20, 0x09, 0x0f, 0x48, 0x31, 0xc1, 0x02, 0x6a, 
+  0x0a, 0xef, 0xef, 0x20, 0x1e, 0x42, 0x10, 0x0e, 0x02, 0x40, 0xa1, 0x40, 
+  0x2c, 0x70, 0x08, 0x02, 0x44, 0xe0, 0x1e, 0x42, 0x90, 0xe0, 0x01, 0xf0, 
+  0x15, 0x18, 0x4d, 0xe0, 0xda, 0x22, 0x41, 0x86, 0x0a, 0x2f, 0xe9, 0xc0, 
+  0x1d, 0x19, 0x10, 0xa1, 0x41, 0x80, 0x21, 0x04, 0x07, 0x80, 0xc0, 0x18, 
+  0xda, 0x72, 0x0a, 0x2f, 0xe9, 0x40, 0x24, 0x14, 0x30, 0x07, 0x30, 0x80, 
+  0x24, 0x04, 0x03, 0x80, 0x40, 0x25, 0x11, 0x1f, 0x00, 0x30, 0x80, 0x0f, 
+  0xa4, 0x06, 0xb0, 0x07, 0x30, 0xce, 0x04, 0x04, 0x36, 0xc0, 0x93, 0xca, 
+  0x26, 0xc9, 0x28, 0x02, 0xd1, 0x02, 0x04, 0x14, 0x00, 0x24, 0x00, 0x36, 
+  0x00, 0x10, 0x04, 0x19, 0x10, 0x20, 0x42, 0x00, 0x10, 0x0d, 0x42, 0x00, 
+  0x60, 0x32, 0x0a, 0x2f, 0xe9, 0x80, 0xc7, 0x3c, 0x00, 0x01, 0x24, 0x00, 
+  0x38, 0x17, 0x00, 0x14, 0x24, 0x00, 0x20, 0x05, 0x03, 0x24, 0x00, 0x1f, 
+  0x0e, 0x24, 0x00, 0x06, 0xf0, 0x18, 0xc3, 0x41, 0x48, 0x42, 0x00, 0x00, 
+  0x04, 0x32, 0x40, 0xa0, 0xc3, 0x40, 0x48, 0x41, 0x00, 0x00, 0xca, 0x22, 
+  0x49, 0x20, 0x04, 0x32, 0x00, 0xa0, 0xca, 0x22, 0x05, 0x20, 0x07, 0x30, 
+  0x81, 0x24, 0xb4, 0x15, 0x00, 0x10, 0x04, 0x1d, 0x43, 0xca, 0x01, 0xf0, 
+  0xca, 0x00, 0xb4, 0x1d, 0x00, 0x10, 0xd0, 0xc7, 0xe0, 0x78, 0xec, 0xc3, 
+  0xa4, 0xc1, 0x10, 0x41, 0x55, 0x20, 0xcd, 0x08, 0x8a, 0x21, 0x05, 0x00, 
+  0x33, 0xa5, 0x2f, 0xa5, 0x22, 0x41, 0xc3, 0x42, 0xf0, 0x42, 0x00, 0x00, 
+  0xc3, 0x43, 0x1c, 0x46, 0x00, 0x40, 0xd3, 0x40, 0x13, 0x00, 0x30, 0x60, 
+  0x80, 0x21, 0x0a, 0x0f, 0x08, 0x18, 0x81, 0x00, 0x0c, 0x18, 0x43, 0x00, 
+  0xc3, 0x40, 0xa2, 0x45, 0x00, 0x80, 0x80, 0x1d, 0x98, 0x10, 0x42, 0xa5, 
+  0x65, 0xa5, 0x00, 0x19, 0x03, 0x00, 0x16, 0x42, 0x1e, 0x43, 0x06, 0x45, 
+  0x83, 0xdf, 0x04, 0xa5, 0x03, 0xa5, 0x22, 0x40, 0xcb, 0x40, 0xa0, 0x43, 
+  0x00, 0x00, 0x8a, 0x27, 0x06, 0x04, 0x8a, 0x23, 0x03, 0x12, 0x17, 0xbf, 
+  0x8a, 0x26, 0x0a, 0x00, 0xcb, 0x46, 0x00, 0x00, 0x88, 0x13, 0x8a, 0x21, 
+  0x0f, 0x1a, 0xcb, 0x44, 0xc8, 0x43, 0x00, 0x00, 0x80, 0x20, 0x04, 0x05, 
+  0x04, 0x1d, 0x00, 0x12, 0x00, 0x1d, 0xc0, 0x11, 0x74, 0x1d, 0xc0, 0x12, 
+  0xfb, 0xa5, 0x58, 0x1d, 0x80, 0x11, 0xd0, 0xa5, 0x28, 0x1d, 0x40, 0x12, 
+  0x87, 0xa5, 0x84, 0x1d, 0x98, 0x10, 0x85, 0x1d, 0xd8, 0x10, 0xe6, 0x09, 
+  0xef, 0xea, 0x86, 0x1d, 0x58, 0x10, 0xda, 0x0b, 0xef, 0xea, 0x56, 0x21, 
+  0x00, 0x2d, 0x0a, 0x22, 0x40, 0x24, 0x80, 0x22, 0x0a, 0x2b, 0x40, 0x20, 
+  0x01, 0x25, 0x10, 0xda, 0x06, 0x09, 0x2f, 0xe9, 0x42, 0x40, 0x01, 0x85, 
+  0x4a, 0x24, 0x80, 0x77, 0x7f, 0xda, 0xc3, 0x43, 0x40, 0x40, 0x00, 0x00, 
+  0x17, 0xba, 0x8c, 0x04, 0xf2, 0x08, 0x94, 0x42, 0x00, 0x00, 0x40, 0x21, 
+  0x0c, 0x24, 0x97, 0x1d, 0xd8, 0x10, 0x96, 0x1d, 0x98, 0x10, 0x87, 0x1d, 
+  0x58, 0x10, 0x7a, 0x1d, 0x18, 0x10, 0x06, 0x70, 0x1c, 0x11, 0x10, 0x00, 
+  0x85, 0xc3, 0x42, 0x5c, 0x03, 0x02, 0x58, 0x03, 0x02, 0x6c, 0x07, 0x40, 
+  0x80, 0x00, 0x3f, 0xde, 0xda, 0x02, 0xe4, 0x18, 0xbe, 0x8c, 0x70, 0xc1, 
+  0x40, 0x04, 0x31, 0x00, 0x81, 0xca, 0x20, 0x8c, 0x0f, 0x6c, 0x07, 0x22, 
+  0xe7, 0x85, 0x6e, 0x07, 0xf2, 0x0f, 0x80, 0x02, 0x48, 0x20, 0x00, 0x01, 
+  0xe6, 0xa5, 0x00, 0xa4, 0x0a, 0x85, 0x93, 0x85, 0x30, 0x85, 0x48, 0x30, 
+  0x87, 0x00, 0x0f, 0x85, 0x48, 0x34, 0x8c, 0x10, 0x00, 0x37, 0x9e, 0x00, 
+  0x4a, 0x00, 0x61, 0x87, 0x00, 0x00, 0x34, 0x80, 0x10, 0xd4, 0x02, 0x00, 
+  0x04, 0x00, 0xf1, 0x00, 0x30, 0xcc, 0x00, 0x16, 0x85, 0x00, 0x36, 0xcf, 
+  0x30, 0x00, 0x31, 0xde, 0x00, 0x3d, 0x85, 0x24, 0x00, 0x21, 0x37, 0xdf, 
+  0x72, 0x00, 0x60, 0xc1, 0x45, 0x04, 0x37, 0x00, 0x91, 0x2a, 0x00, 0x42, 
+  0xc9, 0x40, 0xca, 0x25, 0x6e, 0x00, 0xf2, 0x01, 0x04, 0x37, 0x00, 0xb1, 
+  0x00, 0x30, 0xc7, 0x00, 0x00, 0x31, 0x80, 0x00, 0xc1, 0x46, 0xca, 0x20, 
+  0xb8, 0x03, 0x83, 0x04, 0x36, 0x00, 0xb1, 0xc9, 0x41, 0xca, 0x26, 0x24, 
+  0x00, 0x30, 0x34, 0x00, 0x91, 0xde, 0x03, 0x24, 0xc9, 0x43, 0xd8, 0x03, 
+  0x63, 0x04, 0x37, 0x00, 0x81, 0xca, 0x23, 0x0c, 0x00, 0x54, 0x30, 0x00, 
+  0x81, 0xca, 0x26, 0xf0, 0x03, 0xf0, 0x29, 0x80, 0x03, 0x48, 0x30, 0xc3, 
+  0x02, 0x48, 0x33, 0x80, 0x00, 0x07, 0x30, 0x80, 0x00, 0xa7, 0x11, 0x02, 
+  0x26, 0x7c, 0xa5, 0x81, 0x1d, 0x98, 0x10, 0x01, 0x36, 0x82, 0x31, 0x07, 
+  0x30, 0x44, 0x00, 0xa9, 0x11, 0x00, 0x26, 0xa8, 0x11, 0x01, 0x26, 0x83, 
+  0x1d, 0x18, 0x10, 0x01, 0x37, 0x40, 0x11, 0x82, 0x1d, 0x58, 0x10, 0x01, 
+  0x37, 0x01, 0x32, 0xf0, 0x00, 0x20, 0x09, 0xa5, 0xba, 0x03, 0xf1, 0x00, 
+  0x01, 0x34, 0x41, 0x12, 0x0e, 0xa5, 0x48, 0x32, 0xc0, 0x02, 0x01, 0x37, 
+  0xc2, 0x02, 0x0d, 0x14, 0x00, 0x31, 0x3b, 0x85, 0x12, 0x12, 0x00, 0xf1, 
+  0x24, 0x15, 0xa5, 0x00, 0x31, 0x00, 0x01, 0x10, 0xda, 0x1a, 0xa5, 0x80, 
+  0xc0, 0x76, 0x0f, 0xef, 0xe8, 0x42, 0x41, 0x56, 0x21, 0x81, 0x2f, 0x12, 
+  0x0d, 0xef, 0xf3, 0x80, 0xc0, 0x87, 0x15, 0x00, 0x16, 0xfa, 0xd9, 0x04, 
+  0x19, 0x43, 0x20, 0x80, 0x21, 0x8b, 0x24, 0x00, 0x19, 0x44, 0x20, 0x69, 
+  0x1d, 0x18, 0x10, 0xcc, 0xd8, 0x06, 0xa0, 0x08, 0x46, 0x8a, 0x0d, 0xef, 
+  0xff, 0x55, 0x20, 0x4d, 0x09, 0xbe, 0x01, 0x2a, 0x40, 0x26, 0x9c, 0x07, 
+  0x72, 0x0a, 0x27, 0x80, 0x13, 0x80, 0x27, 0x0a, 0xb0, 0x01, 0x31, 0x1f, 
+  0x11, 0x10, 0x38, 0x07, 0x78, 0x26, 0x80, 0x1e, 0x4a, 0x21, 0x00, 0x00, 
+  0x28, 0x00, 0x44, 0x56, 0x26, 0x40, 0x18, 0x10, 0x00, 0x11, 0x40, 0x08, 
+  0x02, 0xf2, 0x1e, 0xc1, 0x40, 0x56, 0x26, 0x03, 0x19, 0x80, 0x20, 0x4a, 
+  0x0f, 0x0e, 0x70, 0x2e, 0xae, 0x2d, 0xae, 0x3c, 0xa5, 0x32, 0xa5, 0x2f, 
+  0xa5, 0x2a, 0xa5, 0x24, 0x1d, 0x81, 0x10, 0x42, 0x1d, 0x59, 0x10, 0x18, 
+  0x1d, 0x01, 0x15, 0x20, 0xa8, 0x88, 0x1d, 0x40, 0x10, 0x00, 0x1f, 0x80, 
+  0x60, 0x00, 0xf0, 0x00, 0x1b, 0x11, 0x00, 0xd2, 0x09, 0xef, 0xea, 0x56, 
+  0x26, 0x00, 0x1d, 0x00, 0x87, 0xcb, 0x47, 0xee, 0x02, 0xf1, 0x45, 0xcc, 
+  0x4f, 0x46, 0x1d, 0x18, 0x10, 0x56, 0x26, 0x80, 0x1d, 0x40, 0xda, 0x45, 
+  0x1d, 0x18, 0x14, 0x44, 0x1d, 0x18, 0x14, 0x96, 0x0e, 0xef, 0xe8, 0x43, 
+  0x1d, 0x18, 0x14, 0xc1, 0x40, 0x80, 0x20, 0x8a, 0x0f, 0x2c, 0x70, 0xca, 
+  0x0c, 0xef, 0xf6, 0x0a, 0xda, 0x20, 0x87, 0x01, 0x87, 0xc3, 0x42, 0xfa, 
+  0x00, 0xfa, 0x00, 0x80, 0x26, 0x0b, 0x15, 0x8f, 0x1d, 0x98, 0x10, 0x8e, 
+  0x1d, 0x18, 0x10, 0x8d, 0x1d, 0x58, 0x10, 0xac, 0x4f, 0x10, 0xda, 0x62, 
+  0x0e, 0xef, 0xe8, 0xc1, 0x40, 0xc8, 0xc6, 0xe4, 0xc3, 0xa3, 0xc1, 0xd8, 
+  0x00, 0xa2, 0x25, 0x00, 0x10, 0x40, 0x20, 0x0e, 0x02, 0x38, 0x18, 0x45, 
+  0xc8, 0x00, 0xf0, 0x14, 0x1e, 0x11, 0x10, 0x40, 0x24, 0x40, 0x30, 0x2c, 
+  0x70, 0x07, 0xda, 0x7a, 0x0c, 0xef, 0xf6, 0x3a, 0x1d, 0x03, 0x10, 0x4a, 
+  0x24, 0x40, 0x72, 0x0c, 0x71, 0x80, 0xc1, 0x62, 0xc0, 0x61, 0xc0, 0x00, 
+  0x1c, 0x02, 0x30, 0xe4, 0x03, 0x40, 0x01, 0x11, 0xc0, 0x04, 0x38, 0x02, 
+  0x31, 0x04, 0x1e, 0x10, 0x0c, 0x01, 0xf0, 0x0d, 0x7c, 0x4d, 0x98, 0x4d, 
+  0xa8, 0x20, 0x80, 0x01, 0x04, 0x11, 0x02, 0x04, 0x04, 0x18, 0x90, 0x00, 
+  0x48, 0x1d, 0x03, 0x10, 0xc4, 0xc7, 0xe0, 0x78, 0x4a, 0x24, 0x00, 0x71, 
+  0x18, 0x00, 0xf0, 0x11, 0x14, 0x10, 0x02, 0x04, 0x04, 0x19, 0x90, 0x00, 
+  0xe0, 0x7e, 0xe0, 0x78, 0xe4, 0xc2, 0x08, 0x46, 0x4a, 0x25, 0x00, 0x10, 
+  0xaa, 0x0c, 0xef, 0xfa, 0x00, 0x86, 0xa5, 0x71, 0xf9, 0x0d, 0x34, 0x91, 
+  0x48, 0x00, 0x26, 0xc4, 0xc6, 0x1c, 0x00, 0x2e, 0x16, 0x0e, 0x1c, 0x00, 
+  0xf0, 0x1b, 0xe0, 0x7f, 0x00, 0xa1, 0x31, 0x88, 0x0d, 0xe9, 0x18, 0x88, 
+  0x1b, 0x08, 0x51, 0x00, 0xc3, 0x40, 0xa0, 0x00, 0x4d, 0x7e, 0x00, 0x88, 
+  0x14, 0x70, 0x80, 0xd8, 0x05, 0xf2, 0xe0, 0x7e, 0xe0, 0x7f, 0x0c, 0x70, 
+  0xe0, 0x7f, 0xff, 0xd8, 0xe0, 0x78, 0x78, 0x88, 0x92, 0x00, 0x00, 0x20, 
+  0x00, 0xf0, 0x25, 0x30, 0xac, 0xa8, 0x20, 0xc0, 0x01, 0x40, 0x80, 0x0d, 
+  0x0a, 0xe0, 0x00, 0x4c, 0x70, 0x08, 0xe0, 0xe0, 0x7e, 0x01, 0x80, 0x6c, 
+  0x70, 0x04, 0x30, 0x80, 0x8f, 0x7f, 0x47, 0x00, 0xff, 0xca, 0x22, 0x6b, 
+  0x00, 0x04, 0x30, 0xc0, 0x80, 0xca, 0x20, 0x8e, 0x0f, 0x80, 0x3f, 0x00, 
+  0x00, 0x54, 0x70, 0xca, 0x20, 0x21, 0x00, 0x66, 0x00, 0x41, 0xe0, 0x78, 
+  0xe6, 0xc2, 0x44, 0x00, 0xf1, 0x0d, 0x43, 0xa0, 0x00, 0xf0, 0xab, 0x28, 
+  0x47, 0x60, 0x41, 0xa8, 0x20, 0x40, 0x02, 0x1c, 0x11, 0x02, 0x04, 0x09, 
+  0x0a, 0x01, 0x00, 0xe8, 0x19, 0x03, 0x80, 0xe0, 0x78, 0x58, 0x66, 0x00, 
+  0x40, 0x54, 0x23, 0x00, 0x08, 0xe0, 0x00, 0xc0, 0x20, 0x80, 0x0b, 0x09, 
+  0x80, 0x00, 0x08, 0xe0, 0xc6, 0xc6, 0xc1, 0x80, 0x54, 0x05, 0xf0, 0x2d, 
+  0xfc, 0xf3, 0xcb, 0x45, 0xf0, 0x00, 0x49, 0x00, 0x55, 0xd8, 0x3e, 0x0c, 
+  0x6f, 0xf7, 0x40, 0xad, 0x48, 0x37, 0x41, 0x12, 0x48, 0x36, 0x40, 0x12, 
+  0x03, 0x1d, 0x44, 0x10, 0x05, 0x1d, 0x04, 0x10, 0xc6, 0xc6, 0xe0, 0x78, 
+  0xfa, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0x26, 0x0a, 0xaf, 0xf4, 0xa9, 0xc1, 
+  0xaa, 0x0d, 0x6f, 0xf4, 0x18, 0x43, 0x46, 0xc0, 0x3b, 0x58, 0xcb, 0x47, 
+  0xb8, 0x00, 0x70, 0x0e, 0x70, 0x0f, 0x70, 0x6e, 0x70, 0xd3, 0x0c, 0x00, 
+  0xf0, 0xa0, 0x7e, 0x44, 0xc0, 0x45, 0xc1, 0x34, 0x1f, 0x00, 0x14, 0x38, 
+  0x1f, 0x00, 0x14, 0x3c, 0x1f, 0x00, 0x14, 0x40, 0x1f, 0x00, 0x14, 0x06, 
+  0xc0, 0x0c, 0x20, 0x00, 0xb0, 0x82, 0x02, 0x26, 0x00, 0x40, 0x28, 0xce, 
+  0x31, 0x63, 0x76, 0x07, 0x86, 0x14, 0x70, 0x26, 0xf4, 0x6e, 0x8e, 0x49, 
+  0x8e, 0x31, 0x8e, 0x18, 0x16, 0x94, 0x10, 0x04, 0xeb, 0x0d, 0x87, 0x04, 
+  0x71, 0x0d, 0xa7, 0x78, 0x22, 0x0c, 0x00, 0x79, 0x21, 0x00, 0x00, 0x04, 
+  0x24, 0x0c, 0x90, 0x04, 0xf2, 0x0e, 0x87, 0x04, 0x71, 0x0e, 0xa7, 0x04, 
+  0xe9, 0x0f, 0x87, 0x04, 0x71, 0x0f, 0xa7, 0x04, 0xea, 0x10, 0x87, 0x04, 
+  0x71, 0x10, 0xa7, 0x2f, 0x26, 0x05, 0x25, 0xd6, 0x70, 0x08, 0x02, 0x2c, 
+  0x00, 0x52, 0x24, 0x00, 0x10, 0x78, 0x23, 0x01, 0x00, 0x0b, 0x79, 0xf8, 
+  0x01, 0x22, 0x00, 0x4e, 0x71, 0xc1, 0x40, 0x1c, 0x1c, 0xc1, 0x30, 0x1a, 
+  0x09, 0xef, 0xf3, 0x20, 0x1c, 0x80, 0x34, 0x4d, 0x86, 0x30, 0x16, 0x11, 
+  0x10, 0xad, 0x70, 0x2f, 0x21, 0x00, 0x05, 0x04, 0x30, 0x40, 0x83, 0x42, 
+  0xc1, 0xca, 0xf7, 0x42, 0x26, 0x01, 0x2d, 0x2f, 0x79, 0x34, 0x73, 0x54, 
+  0x01, 0x06, 0x00, 0x10, 0x41, 0x05, 0xf0, 0xd3, 0x41, 0x5a, 0x01, 0xf0, 
+  0x75, 0x50, 0x45, 0x4a, 0x21, 0x00, 0x30, 0x82, 0xc1, 0x88, 0xc2, 0x40, 
+  0x24, 0x04, 0x37, 0xe1, 0x43, 0xe2, 0x40, 0x18, 0x1f, 0x43, 0x10, 0x0c, 
+  0x1c, 0x40, 0x34, 0x96, 0x5a, 0x6e, 0x0c, 0xef, 0xfb, 0x10, 0x44, 0x1c, 
+  0x17, 0x80, 0x20, 0x2f, 0x08, 0x7e, 0x00, 0x18, 0x1f, 0x03, 0x10, 0x45, 
+  0x87, 0x0c, 0x17, 0x07, 0x10, 0x08, 0x17, 0x86, 0x10, 0x04, 0x17, 0x05, 
+  0x10, 0x00, 0x17, 0x84, 0x10, 0x90, 0x8f, 0x27, 0xc3, 0x03, 0xc1, 0x22, 
+  0xc0, 0x41, 0xc2, 0x2f, 0x22, 0x07, 0x05, 0xf2, 0x0f, 0xaf, 0xf6, 0x40, 
+  0xc4, 0x8c, 0x24, 0x3f, 0xad, 0x0c, 0xf4, 0x0b, 0x87, 0xa5, 0x71, 0x00, 
+  0x31, 0x91, 0x2f, 0x00, 0x3f, 0x00, 0x00, 0x09, 0x08, 0x65, 0x03, 0x2f, 
+  0x71, 0xab, 0xa7, 0x82, 0x40, 0x04, 0x31, 0x40, 0xa5, 0xb9, 0x20, 0x3f, 
+  0x0d, 0xc5, 0x20, 0x6b, 0x00, 0x05, 0x20, 0x80, 0x04, 0x89, 0x08, 0x51, 
+  0x80, 0x80, 0x01, 0xf0, 0x23, 0x34, 0x00, 0xa1, 0x0c, 0x32, 0x20, 0x52, 
+  0xd8, 0x19, 0x09, 0x30, 0x30, 0x52, 0xd8, 0xb2, 0x0a, 0x4f, 0xf7, 0x4e, 
+  0x24, 0x00, 0x20, 0x48, 0x31, 0x41, 0x22, 0x0c, 0xb5, 0x2d, 0xb5, 0x07, 
+  0xc1, 0x6e, 0x09, 0x2f, 0xfc, 0xe1, 0x40, 0x03, 0xc5, 0x42, 0x26, 0x00, 
+  0x2d, 0x0f, 0x78, 0x14, 0x72, 0xc3, 0x40, 0xbe, 0x00, 0xe0, 0x07, 0xf7, 
+  0x04, 0x35, 0x00, 0x90, 0x45, 0xf7, 0x7f, 0xdd, 0x17, 0xbd, 0x43, 0xc5, 
+  0x0c, 0x00, 0xf0, 0x05, 0x2c, 0x70, 0x0c, 0x70, 0xca, 0x20, 0x6b, 0x00, 
+  0x04, 0x35, 0x40, 0x90, 0x44, 0x16, 0x11, 0x10, 0xca, 0x25, 0x8e, 0x1f, 
+  0x32, 0x02, 0xf0, 0x09, 0x14, 0x70, 0xca, 0x25, 0x21, 0x10, 0xc1, 0x40, 
+  0x16, 0x09, 0xaf, 0xf5, 0xb0, 0xa6, 0x23, 0xe8, 0x04, 0x31, 0x40, 0xa3, 
+  0x5e, 0xf2, 0x0c, 0x70, 0x34, 0x00, 0xfb, 0x18, 0x6c, 0x00, 0x2c, 0x00, 
+  0x3c, 0x96, 0xb2, 0xe9, 0x4e, 0x16, 0x82, 0x10, 0x8a, 0x21, 0xbf, 0x0f, 
+  0x0c, 0x77, 0x8c, 0x22, 0xc3, 0x8f, 0xca, 0x20, 0x41, 0x00, 0x38, 0x1e, 
+  0x45, 0x10, 0x4e, 0x1e, 0x02, 0x10, 0xff, 0xd8, 0x2a, 0xf0, 0x1e, 0x94, 
+  0x00, 0xf0, 0x25, 0x3f, 0xf0, 0x2c, 0x71, 0x5a, 0x0b, 0xaf, 0xf3, 0xc1, 
+  0x40, 0x3a, 0xf0, 0x39, 0x8e, 0x25, 0x09, 0x7f, 0x01, 0x6c, 0x70, 0xc3, 
+  0x41, 0x48, 0x44, 0x00, 0x00, 0x04, 0x31, 0x40, 0xa0, 0xca, 0x23, 0x69, 
+  0x00, 0x50, 0x21, 0xfe, 0xa7, 0x31, 0xf2, 0x74, 0x70, 0xca, 0x21, 0x42, 
+  0x20, 0x2e, 0xf0, 0x2e, 0x70, 0x4b, 0xf1, 0x6e, 0x00, 0xf0, 0x15, 0x0f, 
+  0xf7, 0x0f, 0xe9, 0x1c, 0xb6, 0x0c, 0x70, 0xe2, 0x08, 0x4f, 0xf4, 0x04, 
+  0xc3, 0x14, 0x14, 0x04, 0x30, 0x00, 0x42, 0x2c, 0x73, 0xac, 0x70, 0xaa, 
+  0x0e, 0x6f, 0xf7, 0xc1, 0x40, 0xc3, 0x40, 0x7f, 0x43, 0x00, 0x00, 0x28, 
+  0x00, 0x82, 0xca, 0x20, 0x45, 0x03, 0x48, 0x30, 0x40, 0x02, 0x24, 0x00, 
+  0x91, 0x0f, 0x7a, 0x78, 0x22, 0x05, 0x00, 0x2c, 0x72, 0x86, 0x26, 0x00, 
+  0xf1, 0x01, 0xb1, 0xa6, 0x66, 0x71, 0xa9, 0x05, 0xef, 0xff, 0x07, 0x71, 
+  0x30, 0x41, 0xd3, 0x45, 0xc8, 0x3f, 0xb8, 0x07, 0xf1, 0x49, 0x85, 0xca, 
+  0x25, 0x89, 0x20, 0x04, 0x30, 0x40, 0x85, 0x6f, 0x21, 0x0b, 0x00, 0x04, 
+  0x30, 0x40, 0x84, 0x05, 0xf6, 0xe0, 0xb9, 0xbe, 0x70, 0x10, 0x41, 0x4e, 
+  0x70, 0x0e, 0xf1, 0x49, 0x0b, 0x30, 0x20, 0x2e, 0x71, 0x06, 0xc0, 0x1b, 
+  0xe8, 0x18, 0xde, 0x40, 0xdd, 0x33, 0x23, 0x80, 0x33, 0x17, 0x08, 0x52, 
+  0x00, 0x30, 0x23, 0x41, 0x33, 0x50, 0x21, 0xfe, 0x87, 0x05, 0xf2, 0x6e, 
+  0x09, 0xe0, 0x00, 0x0f, 0x78, 0x0a, 0xe8, 0x06, 0xc0, 0x06, 0x71, 0x55, 
+  0x25, 0x0d, 0x18, 0xe1, 0x08, 0x24, 0xa0, 0x55, 0x26, 0x0e, 0x18, 0x03, 
+  0xf0, 0x2e, 0xa0, 0x03, 0xf0, 0x23, 0x4d, 0x7e, 0x00, 0x18, 0x42, 0x04, 
+  0x0c, 0x87, 0x0b, 0x08, 0xc5, 0x04, 0x30, 0x1f, 0xc0, 0x14, 0x92, 0x0e, 
+  0xcf, 0xfb, 0xa9, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xda, 0xc6, 0xe0, 0x78, 
+  0xf1, 0xc0, 0x36, 0x0b, 0xaf, 0xe8, 0x0c, 0x71, 0xc3, 0x41, 0x12, 0x00, 
+  0x84, 0xfd, 0x0a, 0x08, 0x6f, 0xf7, 0x0c, 0x72, 0x0c, 0x00, 0x31, 0xc8, 
+  0xfd, 0x92, 0x0c, 0x00, 0x84, 0x26, 0x09, 0xc0, 0x00, 0xd1, 0xc0, 0xe0, 
+  0x7e, 0xd0, 0x03, 0x42, 0x2c, 0x70, 0x4c, 0x70, 0xd4, 0x03, 0x17, 0x40, 
+  0xd4, 0x03, 0x20, 0xe0, 0x7f, 0xd6, 0x03, 0xf0, 0x95, 0xe6, 0xc3, 0x08, 
+  0x45, 0x03, 0x80, 0x00, 0x80, 0x27, 0x80, 0x1f, 0x09, 0xf0, 0x00, 0xa3, 
+  0xc1, 0x73, 0x09, 0x51, 0x01, 0x48, 0x80, 0x24, 0x82, 0x61, 0x92, 0x00, 
+  0x81, 0x23, 0x82, 0x82, 0xbb, 0x61, 0xb2, 0x40, 0xc0, 0x0a, 0xf0, 0x28, 
+  0x80, 0x22, 0x89, 0x5d, 0x09, 0x7f, 0x00, 0x80, 0xc1, 0x44, 0x80, 0x40, 
+  0x7a, 0x00, 0x41, 0x27, 0xe8, 0x04, 0x85, 0x40, 0x24, 0xc3, 0x32, 0x40, 
+  0x24, 0x04, 0x31, 0xc0, 0x80, 0x11, 0x85, 0xe4, 0x86, 0xf2, 0x0d, 0x6f, 
+  0xfb, 0x42, 0x87, 0x0b, 0x14, 0x80, 0x30, 0x11, 0x08, 0x51, 0x00, 0x00, 
+  0xc0, 0x23, 0x86, 0x01, 0xa7, 0x60, 0x79, 0xc1, 0x40, 0x01, 0x85, 0x07, 
+  0x80, 0x0b, 0x20, 0x80, 0x8f, 0x00, 0x08, 0x18, 0x00, 0x0b, 0xf2, 0x04, 
+  0x85, 0x01, 0xc1, 0x01, 0x80, 0x64, 0x80, 0x42, 0x83, 0x20, 0xa2, 0x00, 
+  0xc1, 0x43, 0x80, 0x60, 0x7a, 0x21, 0xa3, 0xc6, 0xc7, 0x3a, 0x0a, 0x8f, 
+  0xf6, 0xc6, 0xc7, 0xe0, 0x78, 0xe2, 0xc2, 0x11, 0x80, 0xae, 0x0e, 0x6f, 
+  0xfb, 0x88, 0x45, 0x00, 0xa5, 0xc2, 0xc6, 0xe0, 0x78, 0x11, 0x80, 0x6d, 
+  0x07, 0x6f, 0xfb, 0x2f, 0x79, 0x18, 0x00, 0x26, 0xb6, 0x0f, 0x18, 0x00, 
+  0xb1, 0xad, 0x00, 0xaf, 0xfb, 0x11, 0x80, 0xe0, 0x78, 0x65, 0x04, 0x6f, 
+  0x08, 0x00, 0x22, 0x55, 0x04, 0x10, 0x00, 0x22, 0x35, 0x06, 0x08, 0x00, 
+  0x02, 0x40, 0x04, 0xf0, 0x7b, 0xa1, 0xc1, 0xcb, 0x46, 0xa0, 0x00, 0x90, 
+  0x6e, 0x0a, 0x86, 0x0a, 0x80, 0x14, 0x70, 0x5e, 0x01, 0x62, 0x00, 0x8a, 
+  0x20, 0xfc, 0x00, 0x0b, 0x86, 0x80, 0x20, 0x4e, 0x00, 0x20, 0x88, 0x22, 
+  0x0c, 0xa0, 0x01, 0xc1, 0x40, 0x2a, 0x86, 0x0b, 0x86, 0xc6, 0x0e, 0xe0, 
+  0x00, 0x30, 0x19, 0x41, 0x00, 0x0b, 0x86, 0x30, 0xd9, 0xed, 0x70, 0xdf, 
+  0x18, 0x98, 0x03, 0x70, 0x18, 0x42, 0x00, 0x80, 0x20, 0x0e, 0x00, 0xe0, 
+  0xa8, 0xb2, 0x0f, 0x6f, 0xf6, 0x78, 0x4e, 0xad, 0x70, 0xd3, 0x46, 0x13, 
+  0x00, 0x8c, 0x61, 0x8f, 0xbd, 0xd3, 0x40, 0x7f, 0x7f, 0xff, 0xff, 0xc3, 
+  0x42, 0x00, 0x00, 0xef, 0xff, 0x40, 0x24, 0x07, 0x30, 0x56, 0x26, 0xc1, 
+  0x2b, 0x40, 0xdb, 0xcc, 0x75, 0xc1, 0x40, 0xa1, 0x44, 0x0a, 0x25, 0x00, 
+  0x04, 0x40, 0xc7, 0x00, 0x1e, 0xc0, 0x73, 0xa0, 0x00, 0x70, 0x90, 0x2a, 
+  0x0e, 0x60, 0x01, 0x50, 0x47, 0xd3, 0x41, 0x13, 0x00, 0x14, 0x64, 0x2a, 
+  0x00, 0x42, 0x58, 0x21, 0xc1, 0x2a, 0x2a, 0x00, 0x80, 0xe2, 0x42, 0xa1, 
+  0x44, 0x0e, 0x0e, 0x60, 0x01, 0x30, 0x00, 0x40, 0x58, 0x21, 0xc1, 0x2f, 
+  0x1e, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1e, 0x00, 0xf1, 
+  0x22, 0xf2, 0x0d, 0x60, 0x01, 0xa1, 0x44, 0xc3, 0x40, 0x13, 0x00, 0xf0, 
+  0x73, 0x40, 0xc7, 0x76, 0x0f, 0x6f, 0xf5, 0x18, 0x41, 0xc3, 0x41, 0xa0, 
+  0x00, 0x68, 0x91, 0x0c, 0x71, 0xb2, 0x0a, 0x6f, 0xf3, 0x38, 0x43, 0x56, 
+  0x21, 0x00, 0x28, 0x3a, 0x0f, 0xaf, 0xf5, 0x2c, 0x71, 0x40, 0x26, 0x00, 
+  0x25, 0x32, 0x0a, 0x00, 0xfb, 0x18, 0xd3, 0x45, 0x13, 0x00, 0x20, 0x68, 
+  0x55, 0x25, 0x00, 0x29, 0x3e, 0x0a, 0xe0, 0x01, 0x10, 0xd9, 0x57, 0x25, 
+  0x01, 0x29, 0x40, 0x24, 0x05, 0x30, 0x40, 0xda, 0x8a, 0x24, 0x01, 0x08, 
+  0xc1, 0x40, 0x12, 0x0a, 0xef, 0xf5, 0xa1, 0x43, 0x56, 0x16, 0x00, 0x20, 
+  0xfe, 0x09, 0x16, 0x00, 0x1b, 0x42, 0x16, 0x00, 0x11, 0xe6, 0x16, 0x00, 
+  0x60, 0xd3, 0x43, 0x13, 0x00, 0xb0, 0x71, 0x18, 0x00, 0x44, 0x42, 0x23, 
+  0x01, 0x29, 0x1c, 0x00, 0x12, 0xca, 0x1c, 0x00, 0x50, 0x42, 0x13, 0x00, 
+  0x84, 0x6a, 0x1c, 0x00, 0x26, 0x59, 0x22, 0x1c, 0x00, 0x11, 0xae, 0x1c, 
+  0x00, 0xf0, 0x09, 0xc6, 0x0e, 0x6f, 0xf5, 0x55, 0x21, 0x00, 0x39, 0x55, 
+  0x23, 0x81, 0x3a, 0x02, 0x0a, 0x6f, 0xf3, 0x0c, 0x73, 0x40, 0x26, 0x00, 
+  0x2f, 0x8a, 0x0e, 0xa6, 0x00, 0x51, 0x54, 0x26, 0x00, 0x2a, 0x82, 0x0a, 
+  0x00, 0x60, 0x55, 0x25, 0x80, 0x2d, 0x92, 0x09, 0xaa, 0x00, 0x00, 0xc8, 
+  0x07, 0x20, 0x4c, 0x6f, 0x4c, 0x00, 0x44, 0x57, 0x27, 0x81, 0x1d, 0x4c, 
+  0x00, 0x11, 0x62, 0x4c, 0x00, 0x10, 0x40, 0x5e, 0x00, 0x07, 0x9a, 0x00, 
+  0x11, 0x4e, 0x16, 0x00, 0x48, 0x57, 0x27, 0x01, 0x19, 0x16, 0x00, 0x11, 
+  0x36, 0x16, 0x00, 0x48, 0x58, 0x21, 0xc1, 0x3f, 0x16, 0x00, 0x11, 0x22, 
+  0x16, 0x00, 0x1b, 0x54, 0x42, 0x00, 0x11, 0x0a, 0x16, 0x00, 0xf3, 0x0f, 
+  0x22, 0x0e, 0x6f, 0xf5, 0x54, 0x21, 0x00, 0x39, 0x54, 0x23, 0x81, 0x3a, 
+  0x5e, 0x09, 0x6f, 0xf3, 0x0c, 0x72, 0xd3, 0x44, 0x13, 0x00, 0x1c, 0x66, 
+  0x58, 0x24, 0x40, 0x2f, 0xe2, 0x0d, 0x5a, 0x01, 0x21, 0x2a, 0xd6, 0x0a, 
+  0x00, 0x60, 0x55, 0x25, 0x40, 0x2b, 0xea, 0x08, 0xaa, 0x00, 0x1b, 0x54, 
+  0x28, 0x01, 0x21, 0xbe, 0x08, 0x78, 0x00, 0x38, 0x22, 0x81, 0x2d, 0x16, 
+  0x00, 0x11, 0xaa, 0x16, 0x00, 0x2a, 0x54, 0x25, 0x16, 0x00, 0x12, 0x92, 
+  0x16, 0x00, 0x00, 0x4a, 0x01, 0x07, 0x16, 0x00, 0x13, 0x7e, 0x42, 0x00, 
+  0x28, 0x41, 0x2b, 0x16, 0x00, 0x11, 0x66, 0x16, 0x00, 0x60, 0x7e, 0x0d, 
+  0x6f, 0xf5, 0x22, 0x40, 0xfa, 0x01, 0xf1, 0x06, 0x84, 0x90, 0x56, 0x0d, 
+  0xe0, 0x00, 0x0c, 0x76, 0x2c, 0x71, 0x46, 0x0d, 0xaf, 0xf5, 0xc2, 0x40, 
+  0x58, 0x21, 0x80, 0x29, 0x3a, 0x9c, 0x00, 0x50, 0x58, 0x24, 0x00, 0x2e, 
+  0x32, 0x0a, 0x00, 0x61, 0x70, 0x55, 0x27, 0x40, 0x1b, 0x42, 0xa6, 0x00, 
+  0xf1, 0x00, 0x55, 0x27, 0x00, 0x19, 0x3a, 0x08, 0xe0, 0x01, 0x2c, 0x70, 
+  0x54, 0x27, 0x80, 0x1d, 0x2e, 0x0a, 0x00, 0x2a, 0x58, 0x25, 0x62, 0x00, 
+  0x11, 0x06, 0x62, 0x00, 0x2a, 0x57, 0x23, 0xa4, 0x00, 0x80, 0xee, 0x0f, 
+  0xaf, 0xf5, 0xa1, 0x43, 0x55, 0x25, 0x94, 0x02, 0x06, 0x16, 0x00, 0x11, 
+  0xda, 0x16, 0x00, 0x21, 0xee, 0x0c, 0xd6, 0x01, 0x10, 0x29, 0x90, 0x00, 
+  0xe0, 0x1c, 0x91, 0xc6, 0x0c, 0xe0, 0x00, 0x09, 0xd8, 0x58, 0x24, 0x80, 
+  0x2b, 0xb2, 0x0c, 0x88, 0x00, 0x51, 0x57, 0x21, 0x80, 0x2b, 0xaa, 0x0a, 
+  0x00, 0x50, 0x58, 0x24, 0x40, 0x2a, 0x9e, 0x0a, 0x00, 0xf1, 0x0b, 0x70, 
+  0x58, 0x23, 0x80, 0x2d, 0xb2, 0x0f, 0xa0, 0x01, 0x10, 0xd9, 0x58, 0x23, 
+  0xc0, 0x2f, 0xa6, 0x0f, 0xa0, 0x01, 0x2c, 0x70, 0x59, 0x23, 0x00, 0x29, 
+  0x9e, 0x0a, 0x00, 0x21, 0x9e, 0x0c, 0x82, 0x01, 0x01, 0x50, 0x00, 0xd3, 
+  0xd0, 0x90, 0x76, 0x0c, 0xe0, 0x00, 0x07, 0xd8, 0x58, 0x21, 0x40, 0x28, 
+  0x62, 0x50, 0x00, 0x33, 0x00, 0x2e, 0x5a, 0x50, 0x00, 0x31, 0xc0, 0x2c, 
+  0x4e, 0x50, 0x00, 0x51, 0x56, 0x27, 0x00, 0x19, 0x62, 0x50, 0x00, 0x51, 
+  0x55, 0x27, 0xc0, 0x1f, 0x56, 0x46, 0x00, 0x51, 0x55, 0x27, 0x80, 0x1d, 
+  0x4e, 0x0a, 0x00, 0x08, 0xb2, 0x00, 0x31, 0xa2, 0x41, 0x26, 0xb4, 0x00, 
+  0x08, 0x14, 0x00, 0x31, 0x62, 0x41, 0x12, 0x14, 0x00, 0x2a, 0x58, 0x22, 
+  0xde, 0x00, 0x20, 0xfa, 0x0e, 0x16, 0x00, 0xf1, 0x09, 0x12, 0x0c, 0x6f, 
+  0xf5, 0x58, 0x21, 0x00, 0x39, 0x56, 0x23, 0xc1, 0x3e, 0xaa, 0x0e, 0x2f, 
+  0xf3, 0x10, 0xd8, 0x55, 0x21, 0xc0, 0x2e, 0xd6, 0x0b, 0xc8, 0x00, 0x50, 
+  0x25, 0x00, 0x29, 0xea, 0x0e, 0x78, 0x00, 0x80, 0xea, 0x0b, 0x6f, 0xf5, 
+  0x57, 0x21, 0x00, 0x39, 0xb4, 0x00, 0xd1, 0xe0, 0x95, 0x76, 0x0a, 0xe0, 
+  0x00, 0x0b, 0xd8, 0x55, 0x24, 0x00, 0x2a, 0xae, 0x28, 0x00, 0x53, 0x55, 
+  0x21, 0x80, 0x2d, 0xa6, 0x32, 0x00, 0x31, 0x80, 0x2d, 0xb6, 0x32, 0x00, 
+  0x13, 0x57, 0x06, 0x02, 0x40, 0x4c, 0x70, 0x6c, 0x70, 0x70, 0x00, 0x73, 
+  0x8e, 0x0e, 0xaf, 0xf5, 0xc1, 0x40, 0x57, 0x06, 0x02, 0x04, 0x16, 0x00, 
+  0x11, 0x76, 0x16, 0x00, 0x10, 0x8e, 0x5e, 0x00, 0x12, 0x24, 0x12, 0x01, 
+  0xd2, 0xa8, 0x9a, 0x2a, 0x0b, 0xe0, 0x00, 0x0d, 0xd8, 0x59, 0x25, 0x00, 
+  0x28, 0x52, 0x5e, 0x00, 0x41, 0x24, 0x80, 0x2c, 0x46, 0x0a, 0x00, 0x51, 
+  0x59, 0x27, 0x00, 0x19, 0x5a, 0x5e, 0x00, 0xf1, 0x06, 0xd3, 0x40, 0x13, 
+  0x00, 0xe8, 0x6c, 0x55, 0x20, 0xc0, 0x2f, 0x4a, 0x0e, 0xa0, 0x01, 0x40, 
+  0xd9, 0x4a, 0x0b, 0x6f, 0xf5, 0x82, 0x32, 0x02, 0xd2, 0x94, 0x9d, 0x06, 
+  0x0b, 0xe0, 0x00, 0x0e, 0xd8, 0x55, 0x24, 0xc0, 0x2d, 0x12, 0x94, 0x00, 
+  0x50, 0x27, 0xc0, 0x1f, 0x22, 0x0e, 0x2a, 0x01, 0x51, 0x56, 0x20, 0x00, 
+  0x29, 0x1a, 0x40, 0x00, 0x53, 0x1a, 0x0b, 0x6f, 0xf5, 0x54, 0x72, 0x00, 
+  0xe2, 0x24, 0x90, 0x6a, 0x08, 0x6f, 0xf3, 0x29, 0xd8, 0x58, 0x25, 0xc0, 
+  0x2e, 0xde, 0x0a, 0xc0, 0x01, 0x40, 0x40, 0x2b, 0xf2, 0x0d, 0x28, 0x00, 
+  0xf0, 0x19, 0xdb, 0x40, 0xa0, 0x00, 0x26, 0x6f, 0x00, 0x10, 0x00, 0x31, 
+  0x50, 0xd9, 0x04, 0x20, 0x80, 0x0f, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x18, 
+  0x04, 0x30, 0xd2, 0x0d, 0xa0, 0x01, 0x58, 0x23, 0x00, 0x29, 0x14, 0x10, 
+  0x00, 0x31, 0x58, 0x27, 0x41, 0x1b, 0xd4, 0x00, 0x04, 0x20, 0x00, 0x35, 
+  0x14, 0x18, 0x04, 0x64, 0x01, 0x20, 0x96, 0x0d, 0x64, 0x01, 0x1b, 0x56, 
+  0xfc, 0x02, 0x11, 0x82, 0x16, 0x00, 0x08, 0x12, 0x00, 0x31, 0x42, 0x41, 
+  0x6e, 0x14, 0x00, 0x10, 0x58, 0x08, 0x04, 0x07, 0x20, 0x01, 0x20, 0x56, 
+  0x0d, 0x20, 0x01, 0x22, 0x55, 0x23, 0xba, 0x01, 0x04, 0x16, 0x00, 0x11, 
+  0x42, 0x16, 0x00, 0x20, 0x56, 0x0a, 0x98, 0x02, 0xb0, 0x80, 0x3d, 0x56, 
+  0x23, 0x41, 0x3b, 0xbe, 0x0e, 0x2f, 0xf3, 0x12, 0x92, 0x01, 0x22, 0x2f, 
+  0x1e, 0xc2, 0x00, 0x41, 0x27, 0x00, 0x19, 0x2e, 0xc2, 0x00, 0x21, 0x32, 
+  0x0a, 0xba, 0x01, 0x01, 0xea, 0x00, 0xe1, 0xb8, 0x93, 0xb2, 0x09, 0xe0, 
+  0x00, 0x0c, 0xd8, 0x55, 0x24, 0x40, 0x2b, 0xf6, 0x09, 0x5c, 0x01, 0x41, 
+  0x20, 0x80, 0x2d, 0x06, 0x28, 0x00, 0x60, 0x55, 0x20, 0x00, 0x29, 0xfe, 
+  0x0c, 0x4c, 0x01, 0x51, 0x55, 0x20, 0x40, 0x2b, 0xf2, 0x0a, 0x00, 0x13, 
+  0x40, 0xf6, 0x03, 0x04, 0x78, 0x00, 0x20, 0xca, 0x0c, 0x78, 0x00, 0x1b, 
+  0x40, 0xc4, 0x01, 0x00, 0x08, 0x03, 0x00, 0x1e, 0x05, 0x60, 0x6f, 0xf5, 
+  0x55, 0x26, 0x00, 0x2a, 0x68, 0x00, 0xf0, 0x09, 0xb0, 0x94, 0x42, 0x0d, 
+  0x2f, 0xf3, 0x15, 0xd8, 0x54, 0x26, 0x80, 0x2c, 0x8e, 0x09, 0xaf, 0xf5, 
+  0xe2, 0x41, 0x55, 0x22, 0x40, 0x2b, 0x9e, 0x0c, 0x68, 0x00, 0x61, 0x56, 
+  0x22, 0x00, 0x29, 0x96, 0x0c, 0xc2, 0x02, 0x41, 0x22, 0x80, 0x2d, 0x8a, 
+  0x0a, 0x00, 0xf2, 0x11, 0xd3, 0x45, 0xa0, 0x00, 0xd6, 0x6e, 0x00, 0x15, 
+  0x00, 0x21, 0x2c, 0x70, 0xa2, 0xb8, 0x00, 0x1d, 0x04, 0x20, 0x72, 0x0c, 
+  0xa0, 0x01, 0x55, 0x22, 0xc0, 0x2f, 0x14, 0x15, 0x00, 0x21, 0x42, 0x20, 
+  0x70, 0x00, 0x64, 0xa2, 0xb8, 0x14, 0x1d, 0x04, 0x20, 0x32, 0x01, 0x21, 
+  0x3e, 0x0c, 0xb2, 0x03, 0x0b, 0x5a, 0x01, 0x11, 0x26, 0x16, 0x00, 0x1b, 
+  0x57, 0x98, 0x04, 0x11, 0x12, 0x16, 0x00, 0xf0, 0x09, 0x26, 0x09, 0x6f, 
+  0xf5, 0x58, 0x24, 0x00, 0x29, 0x55, 0x23, 0xc1, 0x3f, 0x4a, 0x08, 0xe0, 
+  0x00, 0x17, 0xd8, 0x54, 0x26, 0x00, 0x2f, 0xee, 0x08, 0xa0, 0x00, 0x60, 
+  0x58, 0x20, 0xc0, 0x2f, 0xfe, 0x0b, 0xa0, 0x00, 0x60, 0x59, 0x20, 0x00, 
+  0x29, 0xf6, 0x0b, 0x96, 0x00, 0x13, 0x57, 0x78, 0x00, 0x05, 0x00, 0x06, 
+  0x10, 0x0b, 0x46, 0x00, 0x1b, 0x54, 0x3a, 0x04, 0x11, 0xb6, 0x16, 0x00, 
+  0x1b, 0x58, 0x6c, 0x05, 0x11, 0x9e, 0x16, 0x00, 0x20, 0xb6, 0x08, 0x14, 
+  0x01, 0x20, 0x80, 0x2e, 0x14, 0x01, 0xd3, 0x10, 0x98, 0xf2, 0x0f, 0xa0, 
+  0x00, 0x18, 0xd8, 0x55, 0x26, 0xc0, 0x28, 0x7a, 0x74, 0x00, 0x31, 0x00, 
+  0x29, 0x8a, 0x74, 0x00, 0x51, 0x58, 0x20, 0x80, 0x2d, 0x82, 0x74, 0x00, 
+  0x51, 0x58, 0x20, 0x40, 0x2b, 0x76, 0x0a, 0x00, 0x13, 0x28, 0x0e, 0x01, 
+  0xdb, 0x28, 0x1d, 0x04, 0x20, 0x66, 0x0b, 0xa0, 0x01, 0x57, 0x20, 0x80, 
+  0x2d, 0x54, 0xfe, 0x05, 0x12, 0x3a, 0x7c, 0x00, 0x39, 0x21, 0x41, 0x3b, 
+  0xfe, 0x05, 0x01, 0x16, 0x00, 0x1b, 0x55, 0x92, 0x00, 0x11, 0x0e, 0x16, 
+  0x00, 0x71, 0x22, 0x08, 0x6f, 0xf5, 0x56, 0x26, 0x80, 0x0e, 0x02, 0xf0, 
+  0x00, 0x0c, 0x90, 0x82, 0x0f, 0xa0, 0x00, 0x2a, 0xd8, 0x58, 0x21, 0x80, 
+  0x2e, 0xe6, 0x0f, 0x6f, 0x92, 0x00, 0x43, 0x21, 0x40, 0x2d, 0xde, 0x0a, 
+  0x00, 0x31, 0x00, 0x2c, 0xd2, 0x0a, 0x00, 0xd5, 0x2c, 0x70, 0xe6, 0x0a, 
+  0xa0, 0x01, 0x02, 0x40, 0x3c, 0x15, 0x00, 0x21, 0x10, 0x04, 0x03, 0xf0, 
+  0x03, 0x3c, 0x1d, 0x04, 0x20, 0xce, 0x0a, 0xa0, 0x01, 0x40, 0x20, 0x00, 
+  0x29, 0x54, 0x20, 0x00, 0x29, 0xc2, 0x0a, 0xc8, 0x00, 0x51, 0x54, 0x20, 
+  0x80, 0x2d, 0xba, 0x0a, 0x00, 0xf1, 0x08, 0x4a, 0x24, 0xc0, 0x70, 0x55, 
+  0x24, 0x42, 0x29, 0xa8, 0x20, 0xc0, 0x02, 0x04, 0x12, 0x00, 0x04, 0x08, 
+  0x80, 0x21, 0x90, 0x04, 0x21, 0x81, 0x3c, 0x00, 0x7b, 0x21, 0xb0, 0xad, 
+  0x70, 0x8f, 0xbd, 0x42, 0xcc, 0x00, 0x22, 0x6e, 0x0a, 0xd0, 0x01, 0x0a, 
+  0xae, 0x05, 0x11, 0x56, 0x16, 0x00, 0x1b, 0x57, 0xcc, 0x00, 0x11, 0x42, 
+  0x16, 0x00, 0x08, 0x12, 0x00, 0x33, 0xe1, 0x41, 0x2e, 0x40, 0x00, 0x0a, 
+  0x9e, 0x01, 0x11, 0x16, 0x16, 0x00, 0x1b, 0x42, 0x40, 0x00, 0x11, 0x02, 
+  0x16, 0x00, 0x29, 0xcc, 0x4f, 0x02, 0x06, 0x12, 0x09, 0x4c, 0x01, 0x28, 
+  0x81, 0x3d, 0x16, 0x00, 0x11, 0xd6, 0x16, 0x00, 0x1b, 0x54, 0x50, 0x02, 
+  0x11, 0xc2, 0x16, 0x00, 0xf2, 0x59, 0x5e, 0x0c, 0xef, 0xf5, 0xc1, 0x40, 
+  0x87, 0x74, 0x04, 0x14, 0x1b, 0x34, 0xda, 0xc6, 0xe0, 0x78, 0xec, 0xc3, 
+  0xa7, 0xc1, 0x83, 0x80, 0x08, 0x47, 0x00, 0x84, 0xa8, 0x80, 0x02, 0x15, 
+  0x09, 0x11, 0x4f, 0x21, 0x80, 0x10, 0x01, 0xb5, 0x01, 0x84, 0xc8, 0x80, 
+  0x02, 0x16, 0x08, 0x11, 0x63, 0x86, 0x4f, 0x20, 0x80, 0x10, 0x01, 0xb6, 
+  0x02, 0x84, 0x44, 0x85, 0x08, 0x80, 0x00, 0x12, 0x11, 0x00, 0x0c, 0x10, 
+  0x0b, 0x00, 0x0f, 0x0b, 0x30, 0x10, 0x23, 0x85, 0x41, 0x90, 0x82, 0xba, 
+  0x41, 0xb0, 0x05, 0xf0, 0x40, 0x24, 0x0b, 0x32, 0x08, 0x1c, 0x01, 0x30, 
+  0x03, 0x84, 0x41, 0x28, 0x88, 0x10, 0x08, 0x80, 0x43, 0x80, 0x40, 0x45, 
+  0x06, 0xea, 0x1e, 0x00, 0xf0, 0xbb, 0x06, 0xf0, 0x40, 0x24, 0x05, 0x31, 
+  0x04, 0x1c, 0x01, 0x30, 0x50, 0x87, 0x80, 0x95, 0xa0, 0x96, 0x01, 0x92, 
+  0x15, 0x08, 0x3e, 0x00, 0x44, 0x20, 0x44, 0x10, 0x5b, 0x09, 0x9f, 0x10, 
+  0x57, 0x0c, 0x31, 0x00, 0xa0, 0xb8, 0x01, 0xb2, 0x48, 0x34, 0x02, 0x10, 
+  0x48, 0x35, 0x00, 0x10, 0x07, 0x30, 0x86, 0x00, 0x04, 0x87, 0x49, 0x8f, 
+  0x80, 0x80, 0x91, 0x40, 0x11, 0x0a, 0xb4, 0x00, 0x10, 0x14, 0x12, 0x10, 
+  0xa1, 0x80, 0xc4, 0x85, 0x82, 0x86, 0x03, 0xf0, 0x83, 0xc4, 0x08, 0x12, 
+  0x07, 0x20, 0x65, 0x42, 0x11, 0x87, 0x7e, 0x09, 0xef, 0xfb, 0x40, 0xc4, 
+  0x04, 0x1a, 0x40, 0x24, 0x1e, 0x41, 0x60, 0x79, 0x02, 0x40, 0x09, 0x8f, 
+  0x0f, 0x08, 0xb4, 0x00, 0xa1, 0x40, 0x04, 0x1e, 0x40, 0x14, 0x23, 0x85, 
+  0x40, 0x79, 0xcc, 0xc7, 0xe8, 0xc2, 0x63, 0x80, 0x00, 0x41, 0x00, 0x83, 
+  0x61, 0x83, 0x48, 0x80, 0x68, 0x83, 0x10, 0x81, 0xe1, 0x92, 0x00, 0x12, 
+  0x08, 0x01, 0xa1, 0x90, 0x4f, 0x27, 0x8c, 0x10, 0x81, 0xb2, 0x84, 0x82, 
+  0xc1, 0x93, 0x00, 0x13, 0x09, 0x01, 0x0c, 0x13, 0x07, 0x00, 0x43, 0x82, 
+  0x00, 0x14, 0x10, 0x10, 0x4f, 0x26, 0x8b, 0x10, 0x22, 0xbe, 0x02, 0x1b, 
+  0xc4, 0x02, 0x15, 0x0d, 0x3e, 0x10, 0x44, 0x26, 0x43, 0x10, 0x39, 0x0f, 
+  0x9f, 0x10, 0x9a, 0xeb, 0xa0, 0xbd, 0xa1, 0xb0, 0xa4, 0x81, 0x48, 0x30, 
+  0x0c, 0x10, 0x48, 0x31, 0x9e, 0x00, 0xf0, 0x2d, 0x05, 0x03, 0xa0, 0x85, 
+  0x11, 0x81, 0xe0, 0x41, 0x0a, 0x24, 0x00, 0x04, 0xc4, 0x85, 0xda, 0x0b, 
+  0xef, 0xfb, 0x08, 0x16, 0x06, 0x10, 0x23, 0x85, 0xa1, 0x40, 0x60, 0x79, 
+  0x04, 0x1e, 0x00, 0x14, 0xc8, 0xc6, 0xe0, 0x78, 0xe2, 0xc2, 0x11, 0x80, 
+  0x7a, 0x0d, 0xef, 0xfb, 0x88, 0x45, 0x00, 0xa5, 0xc2, 0xc6, 0xe0, 0x78, 
+  0x11, 0x80, 0x1d, 0x06, 0xef, 0xfb, 0x2f, 0x79, 0x18, 0x00, 0x26, 0xda, 
+  0x0e, 0x18, 0x00, 0xc0, 0x21, 0x02, 0x2f, 0xfc, 0x11, 0x80, 0xe0, 0x78, 
+  0x19, 0x03, 0xef, 0xfb, 0x08, 0x00, 0x22, 0x05, 0x03, 0x10, 0x00, 0x22, 
+  0x69, 0x04, 0x08, 0x00, 0xf2, 0xb1, 0xe6, 0xc2, 0xa3, 0xc1, 0x23, 0x80, 
+  0x40, 0x81, 0x82, 0x81, 0xe8, 0x82, 0x41, 0x81, 0x23, 0x81, 0x02, 0x17, 
+  0x05, 0x11, 0x48, 0x82, 0x0c, 0x17, 0x0b, 0x10, 0x4f, 0x25, 0x83, 0x00, 
+  0x61, 0xb7, 0x02, 0x12, 0x04, 0x01, 0x68, 0x84, 0x0c, 0x12, 0x09, 0x00, 
+  0x4f, 0x24, 0x8c, 0x00, 0x81, 0xb2, 0x02, 0x13, 0x07, 0x01, 0x0c, 0x13, 
+  0x08, 0x00, 0x4f, 0x27, 0x8c, 0x00, 0x81, 0xb3, 0x88, 0x81, 0x24, 0x87, 
+  0xa1, 0x94, 0xc0, 0x81, 0x15, 0x0d, 0xbf, 0x10, 0x2c, 0x70, 0x23, 0x84, 
+  0x82, 0xbd, 0xa1, 0xb4, 0x20, 0x89, 0x85, 0x21, 0x3e, 0x00, 0x90, 0x80, 
+  0xa0, 0x97, 0xe0, 0x93, 0x00, 0x12, 0x06, 0x01, 0x61, 0x94, 0x41, 0x2c, 
+  0x84, 0x00, 0x1d, 0x0b, 0x3e, 0x00, 0x41, 0x2f, 0x87, 0x00, 0x05, 0x27, 
+  0x02, 0x01, 0x44, 0x25, 0x05, 0x01, 0xc0, 0xba, 0x05, 0x22, 0x7e, 0x81, 
+  0x26, 0xf4, 0xa0, 0xbb, 0x61, 0xb4, 0x48, 0x35, 0x05, 0x10, 0x48, 0x37, 
+  0x02, 0x10, 0x07, 0x32, 0x4c, 0x01, 0x44, 0x80, 0x11, 0x80, 0x44, 0x24, 
+  0x44, 0x00, 0x48, 0x36, 0x03, 0x00, 0x07, 0x33, 0x43, 0x01, 0xa0, 0x82, 
+  0x44, 0x27, 0x46, 0x00, 0x2f, 0x27, 0x47, 0x00, 0x21, 0x41, 0xe4, 0x85, 
+  0xc1, 0x45, 0x42, 0x87, 0x41, 0xc4, 0x42, 0xc2, 0x61, 0x42, 0x40, 0xc3, 
+  0xa2, 0x0d, 0x2f, 0xfc, 0x01, 0x43, 0x16, 0x01, 0x60, 0xc1, 0xa7, 0xa3, 
+  0xc0, 0xc6, 0xc6, 0xfc, 0x00, 0x46, 0xe6, 0x0e, 0x2f, 0xfc, 0x14, 0x01, 
+  0x42, 0x05, 0x00, 0x6f, 0xfc, 0x14, 0x01, 0x35, 0xf2, 0x08, 0x6f, 0x18, 
+  0x00, 0x31, 0x21, 0x07, 0x6f, 0xfc, 0x00, 0x13, 0xe5, 0x04, 0x01, 0x31, 
+  0x15, 0x00, 0xaf, 0x08, 0x00, 0x13, 0xd9, 0x08, 0x00, 0xf2, 0x81, 0xea, 
+  0xc2, 0xa0, 0x80, 0x68, 0x47, 0x50, 0x41, 0x8a, 0x85, 0xcb, 0x85, 0x0c, 
+  0x84, 0x17, 0x08, 0x71, 0x00, 0x30, 0x40, 0xc1, 0x40, 0x80, 0x20, 0x0e, 
+  0x00, 0x30, 0x1c, 0x01, 0x10, 0x00, 0x18, 0x03, 0x00, 0x81, 0x08, 0x3e, 
+  0x20, 0x80, 0x26, 0x0e, 0x10, 0x00, 0x8e, 0x0f, 0x08, 0xe5, 0x03, 0xa1, 
+  0x40, 0x62, 0x0f, 0x00, 0x01, 0xe0, 0xae, 0x02, 0xf0, 0x28, 0xef, 0xf5, 
+  0x71, 0xe1, 0x42, 0xca, 0x22, 0x6e, 0x00, 0x0a, 0x24, 0x80, 0x70, 0x40, 
+  0x21, 0x08, 0x24, 0x2c, 0x70, 0x6c, 0x70, 0x8d, 0x70, 0xcd, 0x70, 0x0a, 
+  0x20, 0x40, 0x04, 0xa8, 0x20, 0x80, 0x04, 0x18, 0x10, 0x0b, 0x15, 0x75, 
+  0x71, 0xca, 0x26, 0x01, 0x10, 0x0b, 0xf2, 0x75, 0x75, 0xca, 0x23, 0x01, 
+  0x00, 0x07, 0xf2, 0x09, 0x0b, 0xd1, 0x10, 0x08, 0x44, 0x03, 0xf0, 0x21, 
+  0x80, 0x18, 0xe0, 0x03, 0xec, 0x21, 0x84, 0x08, 0xf0, 0x06, 0xee, 0x21, 
+  0x86, 0x06, 0xf0, 0x0c, 0x77, 0xca, 0xc6, 0x02, 0xeb, 0x21, 0x83, 0x4c, 
+  0x00, 0xf0, 0x81, 0x00, 0x21, 0xa8, 0x20, 0x00, 0x01, 0x18, 0x18, 0x50, 
+  0x00, 0xa1, 0x40, 0x02, 0x41, 0x22, 0x42, 0x22, 0x0a, 0x20, 0x01, 0xe1, 
+  0x43, 0xca, 0xc6, 0xe0, 0x78, 0x3e, 0x78, 0xe0, 0x7e, 0x48, 0x88, 0x00, 
+  0x19, 0x05, 0x00, 0x42, 0x22, 0x3c, 0x80, 0xe0, 0x7c, 0x83, 0x80, 0x6c, 
+  0x70, 0xa8, 0x20, 0x00, 0x03, 0x04, 0x14, 0x00, 0x14, 0x08, 0x80, 0x42, 
+  0x88, 0x0b, 0x0a, 0x9f, 0x01, 0x05, 0x90, 0x05, 0x7b, 0x60, 0xb1, 0xe0, 
+  0x78, 0xe0, 0x7e, 0xe0, 0x78, 0x54, 0xd9, 0x03, 0x18, 0xc3, 0x00, 0x01, 
+  0x18, 0x03, 0x00, 0x00, 0x18, 0x03, 0x01, 0xe0, 0x7f, 0x22, 0xa8, 0xe0, 
+  0x78, 0xfa, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xb9, 0xc1, 0xc3, 0x80, 0x08, 
+  0x47, 0x44, 0x17, 0x19, 0x10, 0xd1, 0x40, 0x00, 0x86, 0x86, 0xc5, 0x28, 
+  0x80, 0x01, 0x91, 0x44, 0x81, 0x82, 0xb8, 0x01, 0xb1, 0x03, 0x81, 0x00, 
+  0x12, 0x1b, 0x00, 0x2c, 0x70, 0x45, 0xc0, 0x86, 0xc0, 0x92, 0x09, 0x6f, 
+  0xf6, 0x14, 0xda, 0xc6, 0x04, 0xf0, 0xf5, 0x82, 0xc0, 0xa8, 0x20, 0x40, 
+  0x01, 0x08, 0x43, 0xa0, 0xa0, 0x04, 0x74, 0x08, 0x17, 0x89, 0x10, 0x02, 
+  0xc2, 0x03, 0xc3, 0xcc, 0x70, 0x4a, 0x20, 0x40, 0x10, 0x40, 0x24, 0x04, 
+  0x36, 0x4d, 0x08, 0x45, 0x12, 0x04, 0x10, 0x0c, 0x22, 0x08, 0x84, 0x20, 
+  0x90, 0x3d, 0x09, 0x85, 0x0f, 0x00, 0x00, 0xf0, 0xff, 0x21, 0x90, 0x35, 
+  0x09, 0x9f, 0x00, 0x8c, 0x94, 0x8c, 0x24, 0x05, 0x95, 0x0a, 0xf2, 0x8c, 
+  0x24, 0x85, 0x96, 0x0c, 0xf2, 0x8c, 0x24, 0x05, 0x96, 0x0d, 0xf4, 0x84, 
+  0x80, 0x43, 0x80, 0x08, 0xf0, 0x84, 0x80, 0x0c, 0x10, 0x04, 0x00, 0x04, 
+  0xf0, 0x84, 0x80, 0x63, 0x80, 0x82, 0xb9, 0x21, 0xb0, 0xc0, 0x84, 0xc4, 
+  0x71, 0x05, 0x71, 0xdc, 0xf1, 0x90, 0x87, 0x00, 0x1b, 0x00, 0x11, 0x42, 
+  0xc2, 0x01, 0x94, 0x19, 0x08, 0x3e, 0x00, 0x43, 0xc3, 0x16, 0x11, 0x8b, 
+  0x30, 0x2f, 0x21, 0x87, 0x01, 0x91, 0x09, 0xe1, 0x02, 0xa0, 0xb8, 0x01, 
+  0xb4, 0x04, 0x87, 0x29, 0x8f, 0x08, 0x10, 0x16, 0x00, 0x04, 0x10, 0x14, 
+  0x00, 0x80, 0x80, 0x10, 0x16, 0x17, 0x20, 0x10, 0x14, 0x15, 0x20, 0x10, 
+  0x14, 0x13, 0x10, 0x1d, 0x09, 0x34, 0x01, 0x91, 0x42, 0x84, 0x80, 0xa3, 
+  0x80, 0x91, 0x40, 0x10, 0x14, 0x18, 0x10, 0x10, 0x15, 0x11, 0x10, 0x17, 
+  0x40, 0x36, 0x41, 0x04, 0xf0, 0x8b, 0xc0, 0x90, 0xc1, 0x08, 0x17, 0x07, 
+  0x20, 0x08, 0x15, 0x06, 0x20, 0x08, 0x13, 0x05, 0x20, 0x40, 0xc1, 0x05, 
+  0xc1, 0x41, 0xc0, 0x82, 0x0a, 0xaf, 0xfc, 0x23, 0x40, 0x04, 0x1b, 0xc0, 
+  0x26, 0x5e, 0x41, 0x60, 0x79, 0x42, 0x40, 0x04, 0x1d, 0xc0, 0x26, 0x9e, 
+  0x41, 0x60, 0x79, 0x82, 0x40, 0x04, 0x1f, 0x80, 0x23, 0xde, 0x41, 0x60, 
+  0x79, 0xc2, 0x40, 0x09, 0x8f, 0x19, 0x08, 0x34, 0x01, 0xa1, 0x40, 0x04, 
+  0x19, 0x80, 0x23, 0x0c, 0x04, 0x42, 0x04, 0x18, 0x80, 0x33, 0x26, 0x04, 
+  0x22, 0xb9, 0xc0, 0xf2, 0x04, 0x00, 0x74, 0x02, 0x37, 0x72, 0x0b, 0xaf, 
+  0x8c, 0x02, 0x33, 0xed, 0x03, 0xaf, 0x8c, 0x02, 0x26, 0x56, 0x0c, 0x18, 
+  0x00, 0xf2, 0x43, 0xe6, 0xc0, 0xc3, 0x80, 0x71, 0x80, 0x08, 0x10, 0x8b, 
+  0x00, 0xad, 0x71, 0x40, 0x86, 0xe4, 0x8b, 0x48, 0x82, 0x41, 0x2f, 0x08, 
+  0x11, 0x85, 0x92, 0x00, 0x19, 0x04, 0x03, 0x33, 0x0d, 0xe5, 0x12, 0x4c, 
+  0x70, 0x04, 0x16, 0x03, 0x12, 0x0c, 0x93, 0x80, 0x20, 0x3a, 0x0b, 0x0f, 
+  0x08, 0xf5, 0x01, 0x0e, 0x78, 0x32, 0x20, 0x82, 0x0f, 0x13, 0x00, 0x80, 
+  0x78, 0xeb, 0x7a, 0xcb, 0x22, 0x01, 0x82, 0x05, 0xf2, 0x08, 0x83, 0x05, 
+  0x90, 0x05, 0x7c, 0x80, 0xb1, 0xa5, 0x71, 0xe8, 0xf1, 0xc6, 0xc4, 0x55, 
+  0x04, 0xc4, 0x02, 0x13, 0xfd, 0xcc, 0x02, 0x13, 0x65, 0x10, 0x00, 0xf0, 
+  0x69, 0xf0, 0xc2, 0x08, 0x45, 0x03, 0x80, 0x91, 0x85, 0x28, 0x46, 0x00, 
+  0x80, 0x54, 0x8c, 0x04, 0x14, 0x94, 0x10, 0x91, 0x42, 0x68, 0x80, 0x21, 
+  0x93, 0xa4, 0xb9, 0x8f, 0x0a, 0x30, 0x00, 0x21, 0xb3, 0x09, 0x15, 0x86, 
+  0x10, 0x2c, 0x70, 0xcb, 0x40, 0x00, 0x00, 0xff, 0xff, 0x4a, 0x26, 0x00, 
+  0x30, 0x4a, 0x25, 0x00, 0x00, 0x5f, 0x09, 0xa5, 0x01, 0x6d, 0x70, 0x44, 
+  0x85, 0x8d, 0x70, 0x27, 0x4a, 0x02, 0x17, 0x89, 0x10, 0x4b, 0x0c, 0x45, 
+  0x12, 0x42, 0x87, 0x0a, 0x24, 0x80, 0x07, 0x30, 0x22, 0xc2, 0x02, 0x48, 
+  0x82, 0x40, 0x92, 0x0f, 0x0a, 0x20, 0x02, 0x0a, 0x27, 0x40, 0x01, 0x8c, 
+  0x71, 0xec, 0x70, 0x38, 0x22, 0x1f, 0x02, 0x78, 0x21, 0x42, 0x00, 0x05, 
+  0x27, 0xbe, 0xb0, 0x0a, 0xf4, 0x0f, 0x0e, 0x30, 0x30, 0xec, 0x71, 0x8c, 
+  0x71, 0x1e, 0x00, 0xf0, 0x34, 0x02, 0xf0, 0x8c, 0x70, 0x65, 0x74, 0x85, 
+  0x71, 0x0a, 0x26, 0x00, 0x31, 0x0a, 0x25, 0xc0, 0x01, 0xdc, 0xf1, 0x24, 
+  0x71, 0xd2, 0xf1, 0x1b, 0x0d, 0x30, 0x00, 0x40, 0xda, 0xe4, 0x93, 0xe1, 
+  0x41, 0x06, 0x0c, 0x2f, 0xf6, 0xe3, 0xb3, 0xe0, 0xb6, 0x0b, 0xf0, 0x30, 
+  0x85, 0x03, 0xf0, 0x30, 0x85, 0x43, 0xb3, 0xf6, 0x0b, 0x2f, 0xf6, 0x20, 
+  0x91, 0x10, 0x85, 0x00, 0x90, 0x00, 0xb6, 0x41, 0x2c, 0x13, 0x21, 0x2e, 
+  0x54, 0x02, 0xf2, 0x18, 0x20, 0x08, 0x8d, 0xa7, 0x08, 0x25, 0x20, 0x4c, 
+  0x70, 0x03, 0x85, 0xf0, 0x20, 0x00, 0x04, 0x68, 0x80, 0x2c, 0x90, 0x81, 
+  0x93, 0x80, 0x21, 0x3a, 0x0b, 0x50, 0x24, 0x0f, 0x11, 0x11, 0x09, 0xf5, 
+  0x01, 0xe1, 0xb3, 0x2e, 0x79, 0x32, 0x21, 0x1e, 0x01, 0xf0, 0x21, 0x0b, 
+  0x22, 0x00, 0x85, 0x05, 0xf2, 0x30, 0x85, 0x84, 0xbc, 0x81, 0xb3, 0x2a, 
+  0xf0, 0x0b, 0x22, 0xc0, 0x84, 0x24, 0xf2, 0x24, 0x85, 0x8d, 0x70, 0x0d, 
+  0x70, 0x62, 0x81, 0x4a, 0x21, 0x00, 0x00, 0x02, 0x13, 0x8b, 0x00, 0x1d, 
+  0x09, 0xc5, 0x02, 0x42, 0x83, 0x24, 0x71, 0x82, 0x62, 0x85, 0x74, 0xce, 
+  0x00, 0x20, 0xd3, 0x72, 0xfe, 0x00, 0xc0, 0xca, 0x20, 0x62, 0x10, 0xf4, 
+  0xf1, 0x1f, 0x08, 0x50, 0x10, 0xc3, 0x41, 0x10, 0x00, 0xf3, 0x08, 0x6a, 
+  0x0b, 0x0f, 0xf6, 0x14, 0x26, 0x00, 0x14, 0x00, 0x18, 0xc5, 0x0f, 0x0f, 
+  0xf0, 0x15, 0x12, 0x81, 0x20, 0x74, 0xe9, 0x30, 0x85, 0x52, 0xa2, 0x00, 
+  0xf2, 0x07, 0x14, 0x26, 0x01, 0x14, 0x26, 0x71, 0x00, 0x90, 0x00, 0xb1, 
+  0x16, 0x1a, 0x42, 0x24, 0x06, 0x71, 0xae, 0xf1, 0xd0, 0xc6, 0x59, 0x03, 
+  0x74, 0x01, 0xf0, 0x13, 0xec, 0xc3, 0xa8, 0xc1, 0x08, 0x45, 0x01, 0x80, 
+  0x43, 0x85, 0xed, 0x70, 0xcd, 0x70, 0x27, 0x80, 0x0b, 0x21, 0x80, 0x8f, 
+  0x20, 0x00, 0x01, 0x00, 0x02, 0xf2, 0xc1, 0x82, 0x17, 0x09, 0xbe, 0x00, 
+  0x00, 0x82, 0xf6, 0x07, 0xf0, 0x11, 0x22, 0x00, 0x00, 0x00, 0x52, 0x21, 
+  0x7e, 0x84, 0x03, 0xf2, 0xe2, 0x82, 0x27, 0x80, 0x1d, 0x09, 0xd0, 0x00, 
+  0x67, 0x09, 0x51, 0x01, 0x08, 0x80, 0x21, 0x90, 0x44, 0x80, 0x0c, 0x10, 
+  0x12, 0x00, 0x06, 0x03, 0xf0, 0x27, 0x20, 0x82, 0x40, 0xc1, 0x0b, 0xf0, 
+  0x28, 0x80, 0x22, 0x89, 0x37, 0x09, 0x7f, 0x00, 0x80, 0xc1, 0x44, 0x80, 
+  0x40, 0x7a, 0x10, 0x42, 0x1f, 0xe8, 0x2e, 0x70, 0x0e, 0x70, 0x26, 0xee, 
+  0x08, 0x86, 0x21, 0x90, 0x45, 0x09, 0xbf, 0x00, 0x0e, 0x70, 0x47, 0x86, 
+  0x2d, 0x0a, 0xd0, 0x00, 0x27, 0x0a, 0x71, 0x01, 0x82, 0xb9, 0x44, 0x80, 
+  0x38, 0x00, 0xf0, 0x79, 0x03, 0x80, 0x43, 0xc1, 0x10, 0xf0, 0xf2, 0x08, 
+  0x0f, 0xf6, 0x05, 0xee, 0xea, 0x08, 0x2f, 0xf6, 0xc1, 0x40, 0x05, 0xef, 
+  0xe2, 0x08, 0x2f, 0xf6, 0xe1, 0x40, 0xcc, 0xc7, 0x44, 0x86, 0x83, 0xc1, 
+  0x60, 0x7a, 0xc1, 0x40, 0x00, 0x10, 0x90, 0x00, 0x85, 0x20, 0x3e, 0x20, 
+  0x19, 0xef, 0x48, 0x87, 0x21, 0x92, 0x2f, 0x09, 0x9f, 0x00, 0x07, 0x87, 
+  0x17, 0x08, 0xd0, 0x00, 0xdf, 0x08, 0x71, 0x81, 0x82, 0xb9, 0x64, 0x82, 
+  0x21, 0xb2, 0x03, 0x82, 0x20, 0x83, 0x42, 0xc1, 0x05, 0xf0, 0x44, 0x87, 
+  0x82, 0xc1, 0x60, 0x7a, 0xe1, 0x40, 0x00, 0x10, 0x91, 0x00, 0x85, 0x21, 
+  0x3e, 0x20, 0x01, 0x85, 0x1e, 0x88, 0x15, 0x08, 0x7f, 0x00, 0x40, 0x24, 
+  0x04, 0x34, 0x04, 0x85, 0xc0, 0x80, 0xe4, 0x86, 0x08, 0x17, 0x04, 0x10, 
+  0x11, 0x85, 0x2f, 0x22, 0x07, 0x04, 0x2f, 0x23, 0x47, 0x04, 0x40, 0x24, 
+  0xc5, 0x31, 0x26, 0x0e, 0xaf, 0xfc, 0x42, 0x41, 0x2a, 0x00, 0xf0, 0x09, 
+  0x8f, 0x08, 0x5f, 0x80, 0x07, 0x14, 0xc0, 0x30, 0x87, 0x08, 0x13, 0x80, 
+  0x00, 0xc0, 0x01, 0xa7, 0x23, 0x86, 0x60, 0x79, 0xc1, 0x40, 0xcc, 0xc7, 
+  0x14, 0x03, 0x37, 0xc2, 0x08, 0xef, 0x2c, 0x03, 0x33, 0x85, 0x01, 0xef, 
+  0x2c, 0x03, 0x26, 0xf6, 0x09, 0x18, 0x00, 0x31, 0xed, 0x02, 0xef, 0x58, 
+  0x01, 0x13, 0x9d, 0xd4, 0x02, 0x13, 0xe1, 0x10, 0x00, 0x22, 0x79, 0x05, 
+  0x08, 0x00, 0xf0, 0x29, 0xc3, 0x41, 0xa0, 0x00, 0x90, 0x6e, 0x49, 0x81, 
+  0x20, 0xa0, 0x00, 0x7a, 0x5e, 0x78, 0xe0, 0x7e, 0xe8, 0xc2, 0x50, 0x40, 
+  0x28, 0x47, 0x08, 0x45, 0x0f, 0xea, 0x2c, 0x70, 0x4a, 0x26, 0x40, 0x10, 
+  0x06, 0xed, 0x04, 0x85, 0x20, 0x48, 0x7e, 0x0c, 0xef, 0xf5, 0xe1, 0x41, 
+  0xcf, 0x79, 0xc5, 0x71, 0xf1, 0x09, 0x24, 0x84, 0xe5, 0x74, 0x0c, 0x70, 
+  0x50, 0x07, 0xf0, 0x01, 0xe8, 0xc2, 0x28, 0x47, 0x50, 0x40, 0x08, 0x45, 
+  0x2c, 0x70, 0x8a, 0x22, 0x06, 0x00, 0xb2, 0x0c, 0x22, 0x01, 0x82, 0x1f, 
+  0x08, 0x30, 0x20, 0x2c, 0x70, 0xcd, 0x71, 0x38, 0x00, 0x2a, 0xda, 0x0b, 
+  0x38, 0x00, 0xf3, 0x22, 0xc8, 0xc6, 0xec, 0xc3, 0xa5, 0xc1, 0x08, 0x47, 
+  0x01, 0x80, 0x43, 0x87, 0xad, 0x70, 0x3e, 0x88, 0x0b, 0x09, 0x3f, 0x00, 
+  0x00, 0x82, 0xa1, 0x82, 0x27, 0x80, 0x19, 0x09, 0xd0, 0x00, 0x5b, 0x09, 
+  0x51, 0x01, 0x28, 0x80, 0x41, 0x91, 0x64, 0x81, 0x82, 0xba, 0x41, 0xb1, 
+  0x20, 0x83, 0x40, 0xc1, 0x06, 0xc0, 0x01, 0xf2, 0xab, 0x5f, 0x00, 0x44, 
+  0x80, 0x60, 0x7a, 0x80, 0xc1, 0x10, 0x42, 0x1b, 0xe8, 0x01, 0x87, 0x4c, 
+  0x70, 0x87, 0x80, 0x57, 0x0c, 0x3f, 0x14, 0x6c, 0x71, 0x07, 0x85, 0x29, 
+  0x08, 0x71, 0x01, 0x82, 0xc1, 0x28, 0x85, 0x01, 0x91, 0x47, 0x08, 0xbf, 
+  0x00, 0x82, 0xb8, 0x43, 0x81, 0x01, 0xb1, 0x6c, 0x70, 0x40, 0x82, 0x1b, 
+  0xf0, 0x32, 0x0f, 0xcf, 0xf5, 0x05, 0xed, 0x2a, 0x0f, 0xef, 0xf5, 0xa1, 
+  0x40, 0xcc, 0xc7, 0x65, 0x85, 0x00, 0xc2, 0x60, 0x7b, 0xa1, 0x40, 0x8d, 
+  0x71, 0x4c, 0x70, 0x07, 0xe8, 0x27, 0x85, 0x0f, 0x09, 0xf1, 0x00, 0x6c, 
+  0x70, 0x40, 0x80, 0x04, 0xf0, 0x6c, 0x71, 0x02, 0xf0, 0x8d, 0x70, 0x6f, 
+  0xec, 0x01, 0x87, 0x87, 0x80, 0x04, 0x87, 0x4b, 0x24, 0x00, 0x96, 0xa0, 
+  0x80, 0xc4, 0x85, 0x08, 0xf2, 0x21, 0x80, 0x30, 0x40, 0x10, 0x11, 0x11, 
+  0x00, 0x08, 0x11, 0x05, 0x20, 0x04, 0xf0, 0x40, 0x24, 0x05, 0x32, 0x08, 
+  0x16, 0x04, 0x10, 0x11, 0x87, 0x40, 0x24, 0xc6, 0x31, 0xc6, 0x0d, 0xaf, 
+  0xfd, 0x42, 0x41, 0x07, 0x14, 0x80, 0x30, 0x8b, 0x20, 0x42, 0x80, 0x06, 
+  0xf2, 0x00, 0xc0, 0x01, 0xa6, 0x23, 0x85, 0x60, 0x79, 0xa1, 0x40, 0x01, 
+  0x87, 0x1c, 0x88, 0x4b, 0x20, 0x00, 0x86, 0xc7, 0xf3, 0x00, 0xc0, 0x04, 
+  0x19, 0x00, 0x20, 0xe2, 0x04, 0x02, 0xb0, 0x01, 0x47, 0xb2, 0x08, 0xef, 
+  0xfd, 0x68, 0x07, 0x32, 0x02, 0xef, 0xfd, 0xb0, 0x01, 0x26, 0xc6, 0x0a, 
+  0x18, 0x00, 0x40, 0x3d, 0x04, 0xef, 0xfd, 0x98, 0x01, 0x31, 0x51, 0x03, 
+  0xaf, 0x08, 0x00, 0x40, 0x75, 0x02, 0x2f, 0xfe, 0x08, 0x00, 0x22, 0xad, 
+  0x04, 0x08, 0x00, 0xf5, 0x29, 0xea, 0xc3, 0xa4, 0xc1, 0x23, 0x80, 0x08, 
+  0x46, 0x01, 0x81, 0xa0, 0x81, 0x48, 0x80, 0x28, 0x85, 0x87, 0x80, 0x61, 
+  0x92, 0xe1, 0x91, 0x23, 0x0c, 0xf0, 0x10, 0x44, 0x23, 0x11, 0x01, 0x5b, 
+  0x0c, 0x51, 0x11, 0x57, 0x09, 0x31, 0x20, 0x82, 0xbb, 0x04, 0x82, 0x0c, 
+  0x12, 0x10, 0x00, 0x61, 0xb2, 0x00, 0x80, 0x40, 0xc0, 0x08, 0xf0, 0x39, 
+  0x0b, 0x02, 0x03, 0xf0, 0x22, 0x40, 0x1b, 0xe8, 0x07, 0x85, 0x35, 0x08, 
+  0xf0, 0x00, 0x81, 0xc1, 0x2b, 0x08, 0x71, 0x01, 0x22, 0xbf, 0x44, 0x27, 
+  0x43, 0x90, 0x19, 0xf4, 0x08, 0x85, 0x6c, 0x70, 0x44, 0x80, 0x81, 0x90, 
+  0x23, 0x80, 0x40, 0x82, 0x82, 0xbc, 0x81, 0xb0, 0x41, 0xc2, 0x17, 0xf0, 
+  0xee, 0x0d, 0xcf, 0xf5, 0xea, 0x0d, 0x40, 0x01, 0x15, 0xca, 0x40, 0x01, 
+  0xf1, 0x38, 0x08, 0xe8, 0x00, 0x41, 0x07, 0xf0, 0x6f, 0x20, 0x43, 0x00, 
+  0x83, 0xc1, 0x41, 0xc0, 0x05, 0xf0, 0x83, 0xc1, 0x78, 0x20, 0x03, 0x00, 
+  0x50, 0x86, 0x01, 0x92, 0x11, 0x08, 0x3e, 0x00, 0x05, 0x23, 0x7e, 0x84, 
+  0xeb, 0xf5, 0xa0, 0xb8, 0x01, 0xb2, 0x04, 0x86, 0x00, 0x14, 0x04, 0x30, 
+  0x40, 0x24, 0xc6, 0x32, 0x02, 0x42, 0xa0, 0x80, 0x11, 0x86, 0xe4, 0x85, 
+  0xb6, 0x09, 0x2f, 0xfd, 0x08, 0x17, 0x05, 0x10, 0x0b, 0x14, 0xc0, 0x30, 
+  0xb3, 0xce, 0x02, 0x40, 0x23, 0x85, 0x01, 0xa7, 0x34, 0x01, 0x40, 0xca, 
+  0xc7, 0xe0, 0x78, 0x08, 0x01, 0x37, 0xf2, 0x0b, 0x2f, 0x20, 0x01, 0x33, 
+  0x41, 0x05, 0x2f, 0x20, 0x01, 0x26, 0x9e, 0x0d, 0x18, 0x00, 0x31, 0xad, 
+  0x05, 0x6f, 0x18, 0x01, 0x22, 0x19, 0x07, 0xc0, 0x02, 0x22, 0x3d, 0x06, 
+  0x10, 0x00, 0x22, 0x71, 0x07, 0x08, 0x00, 0xf0, 0x19, 0xe2, 0xc2, 0x29, 
+  0x08, 0xb1, 0x00, 0x4c, 0x73, 0xcb, 0x45, 0xa0, 0x00, 0x58, 0x7e, 0x21, 
+  0x85, 0xc3, 0x40, 0xa0, 0x00, 0x88, 0x6e, 0x00, 0x80, 0x24, 0x71, 0x21, 
+  0xa5, 0x2c, 0x71, 0xd2, 0x0a, 0x6f, 0xf8, 0x6c, 0x70, 0x00, 0x1d, 0x43, 
+  0x10, 0x4c, 0x00, 0xc0, 0xf0, 0xc3, 0xa9, 0xc1, 0x63, 0x80, 0x20, 0x83, 
+  0x28, 0x81, 0x41, 0x91, 0x72, 0x02, 0xf0, 0x5d, 0x41, 0x83, 0xa8, 0x82, 
+  0xe1, 0x95, 0xc4, 0x85, 0x4f, 0x27, 0x82, 0x10, 0x41, 0xb5, 0x81, 0x80, 
+  0x43, 0x85, 0xa4, 0x81, 0x23, 0x81, 0x9e, 0x8c, 0x00, 0x16, 0x14, 0x10, 
+  0x00, 0x15, 0x11, 0x10, 0x19, 0x0c, 0x3f, 0x10, 0xf1, 0x43, 0x62, 0x83, 
+  0x88, 0x83, 0xa1, 0x94, 0x0d, 0x0d, 0xbf, 0x10, 0x82, 0xbd, 0x63, 0x84, 
+  0xa1, 0xb4, 0x0b, 0xf0, 0x8d, 0x70, 0xcb, 0x45, 0x7f, 0x43, 0x00, 0x00, 
+  0x80, 0xc3, 0x42, 0xc4, 0x41, 0xc4, 0x40, 0xc4, 0x43, 0xc5, 0x84, 0x80, 
+  0x11, 0x80, 0x40, 0x24, 0x04, 0x35, 0x40, 0x24, 0xc7, 0x34, 0xc2, 0x84, 
+  0xa0, 0x84, 0x04, 0x14, 0x12, 0x10, 0x10, 0x16, 0x10, 0x10, 0xe4, 0x85, 
+  0x08, 0x10, 0x06, 0x20, 0xb2, 0x0d, 0x2f, 0xfe, 0x0a, 0x01, 0x82, 0x04, 
+  0x1f, 0x40, 0x14, 0x04, 0x18, 0x40, 0x24, 0x3a, 0x02, 0xe2, 0x17, 0x0b, 
+  0xbf, 0x20, 0x85, 0xc1, 0x42, 0x40, 0x6a, 0x0e, 0xa0, 0x00, 0x82, 0x42, 
+  0x48, 0x07, 0x82, 0x13, 0x14, 0x80, 0x30, 0x03, 0xe8, 0xd0, 0xc7, 0xf6, 
+  0x03, 0x13, 0xd0, 0x28, 0x01, 0x46, 0x12, 0x0e, 0x2f, 0xfe, 0x28, 0x01, 
+  0x42, 0x6d, 0x06, 0x2f, 0xfe, 0x28, 0x01, 0x26, 0x9a, 0x0f, 0x18, 0x00, 
+  0x62, 0x25, 0x07, 0x8f, 0xff, 0xf9, 0x07, 0x34, 0x02, 0x13, 0xb5, 0x3c, 
+  0x02, 0x31, 0x01, 0x00, 0x6f, 0x08, 0x00, 0x62, 0x15, 0x02, 0x00, 0x00, 
+  0xd1, 0x01, 0x0c, 0x00, 0x04, 0x04, 0x01, 0xf0, 0x0d, 0x88, 0x81, 0x21, 
+  0x94, 0x82, 0xb9, 0x21, 0xb4, 0x21, 0x83, 0x48, 0x81, 0xe1, 0x92, 0xc4, 
+  0x82, 0x4f, 0x27, 0x81, 0x10, 0x21, 0xb2, 0x21, 0x80, 0xa4, 0x84, 0x43, 
+  0x82, 0x00, 0x01, 0x20, 0x27, 0x81, 0x02, 0x01, 0x51, 0xf1, 0x43, 0x04, 
+  0x21, 0x8b, 0x7e, 0x05, 0x82, 0x23, 0x84, 0x52, 0x23, 0x7e, 0x94, 0x0b, 
+  0xf2, 0x0e, 0x01, 0x15, 0x0f, 0x0e, 0x01, 0x1f, 0x0a, 0x0e, 0x01, 0x1e, 
+  0x2f, 0xa6, 0x0c, 0x0e, 0x01, 0x01, 0x13, 0x15, 0x0e, 0x01, 0x2a, 0x5a, 
+  0x0d, 0x0e, 0x01, 0x17, 0x02, 0x0e, 0x01, 0x00, 0xf4, 0x00, 0x28, 0x06, 
+  0x0d, 0x0c, 0x01, 0x24, 0x61, 0x05, 0x0c, 0x01, 0x17, 0x8e, 0x24, 0x01, 
+  0x62, 0x19, 0x06, 0x8f, 0xff, 0xed, 0x06, 0x04, 0x01, 0x22, 0xa9, 0x03, 
+  0x08, 0x00, 0x13, 0xf5, 0x10, 0x00, 0x53, 0x09, 0x01, 0x00, 0x00, 0xc5, 
+  0x18, 0x01, 0x00, 0x0c, 0x01, 0x45, 0x43, 0x80, 0x20, 0x82, 0x0c, 0x01, 
+  0x71, 0x82, 0x68, 0x81, 0xe1, 0x93, 0xc4, 0x83, 0x0c, 0x01, 0x70, 0xb3, 
+  0x22, 0x82, 0x43, 0x83, 0x64, 0x84, 0x0c, 0x01, 0xff, 0x07, 0xa8, 0x81, 
+  0x23, 0x84, 0x00, 0x13, 0x11, 0x00, 0x81, 0x95, 0x11, 0x0c, 0xbf, 0x10, 
+  0xf1, 0x43, 0x63, 0x85, 0x82, 0xbc, 0x81, 0xb5, 0x08, 0x02, 0x1f, 0x2f, 
+  0xaa, 0x0b, 0x08, 0x02, 0x09, 0x2f, 0x62, 0x0c, 0x08, 0x02, 0x0d, 0x28, 
+  0x0a, 0x0c, 0xfc, 0x00, 0x24, 0x65, 0x04, 0xfc, 0x00, 0x17, 0x92, 0x14, 
+  0x01, 0x63, 0x1d, 0x05, 0x8f, 0xff, 0xf1, 0x05, 0x44, 0x04, 0x03, 0x4c, 
+  0x04, 0x13, 0xf9, 0x10, 0x00, 0x53, 0x0d, 0x00, 0x00, 0x00, 0xc9, 0x24, 
+  0x02, 0xf0, 0x2d, 0xe6, 0xc2, 0x08, 0x47, 0x50, 0x87, 0x03, 0x80, 0x28, 
+  0x45, 0xc0, 0x92, 0x00, 0x80, 0xaa, 0x0b, 0xef, 0xf5, 0xc1, 0x41, 0x03, 
+  0x87, 0xc1, 0x41, 0xc0, 0xb5, 0x9e, 0x0b, 0xef, 0xf5, 0x01, 0x80, 0xc1, 
+  0xb5, 0xc6, 0xc6, 0x41, 0x28, 0xc1, 0x00, 0x44, 0x21, 0x01, 0x07, 0x30, 
+  0x21, 0x81, 0x0f, 0xa0, 0x00, 0xb8, 0xcb, 0x01, 0x29, 0x00, 0x00, 0xe0, 
+  0x7f, 0xc0, 0xb8, 0x44, 0x06, 0xf4, 0x21, 0xb8, 0xcb, 0x01, 0x81, 0x40, 
+  0x81, 0x62, 0x81, 0x05, 0x20, 0x8c, 0x0f, 0xff, 0xf9, 0x00, 0x00, 0x05, 
+  0x22, 0x82, 0x0f, 0xff, 0x0f, 0x00, 0xfc, 0x05, 0x23, 0x80, 0x0f, 0x00, 
+  0x70, 0xf9, 0x78, 0x81, 0xa1, 0x40, 0xa1, 0xe0, 0x7f, 0x02, 0xa1, 0x8c, 
+  0x20, 0x02, 0x88, 0xe0, 0x20, 0xc5, 0x07, 0x4c, 0x00, 0x31, 0x00, 0x21, 
+  0x82, 0x4c, 0x00, 0x60, 0x20, 0x82, 0xc4, 0xb8, 0x0f, 0x21, 0x50, 0x00, 
+  0xf0, 0x23, 0x00, 0xa2, 0x69, 0x04, 0x8f, 0xff, 0xe6, 0xc2, 0xd1, 0x80, 
+  0x08, 0x45, 0x10, 0x80, 0x28, 0x47, 0x44, 0x8e, 0x2f, 0x0a, 0x71, 0x00, 
+  0x00, 0x90, 0x95, 0xe8, 0x03, 0x85, 0x2c, 0x70, 0x0e, 0x0b, 0xef, 0xf5, 
+  0x00, 0x80, 0x03, 0x85, 0xc3, 0x41, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f, 
+  0x05, 0x10, 0xfe, 0x0a, 0xa0, 0x00, 0xf4, 0x01, 0x10, 0x85, 0x02, 0x1f, 
+  0xc5, 0x1f, 0x44, 0x8e, 0x00, 0x90, 0x94, 0xe8, 0x25, 0x0a, 0x91, 0x00, 
+  0x22, 0x00, 0x22, 0xde, 0x0a, 0x30, 0x00, 0x71, 0x2c, 0x70, 0x00, 0x1f, 
+  0xc5, 0x1f, 0xd2, 0x2c, 0x00, 0xf2, 0x82, 0x02, 0x1f, 0x05, 0x10, 0xc6, 
+  0xc6, 0xe0, 0x78, 0xfa, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xec, 0x1c, 0x08, 
+  0xb1, 0xa0, 0x80, 0x00, 0xc0, 0x00, 0x12, 0x13, 0x00, 0xcb, 0x47, 0x7f, 
+  0x47, 0x00, 0xff, 0x2c, 0x15, 0x19, 0x10, 0x00, 0x80, 0x58, 0x43, 0x30, 
+  0x44, 0x0f, 0x70, 0xd3, 0x42, 0x10, 0x3a, 0xe0, 0x2d, 0x2e, 0x70, 0x44, 
+  0xc0, 0x0c, 0x70, 0xf1, 0x47, 0xf1, 0x45, 0x43, 0xc3, 0x41, 0xc0, 0x08, 
+  0x1c, 0x00, 0x30, 0xdd, 0x09, 0xe5, 0x24, 0x16, 0x24, 0x4e, 0x24, 0x00, 
+  0x86, 0xd1, 0x08, 0x30, 0x00, 0xea, 0xe0, 0x19, 0xf2, 0xe8, 0xe0, 0x30, 
+  0xf4, 0x1d, 0x8d, 0xc1, 0x08, 0x3e, 0x00, 0x68, 0xd8, 0x21, 0x86, 0x42, 
+  0xc0, 0x04, 0x31, 0xc0, 0x83, 0x30, 0x45, 0x55, 0xf2, 0x04, 0x35, 0x80, 
+  0xa4, 0x8a, 0x20, 0x3f, 0x2d, 0x97, 0xf7, 0x04, 0x35, 0x80, 0xaf, 0x48, 
+  0x42, 0x00, 0x00, 0xd9, 0xf6, 0x43, 0x03, 0x00, 0x00, 0x1d, 0x8d, 0x95, 
+  0x08, 0x3e, 0x00, 0x6a, 0xd8, 0x21, 0x86, 0x41, 0x2c, 0x00, 0x52, 0x47, 
+  0x41, 0xf2, 0x04, 0x37, 0x2c, 0x00, 0x62, 0x22, 0x03, 0x05, 0x00, 0x04, 
+  0x37, 0x2e, 0x00, 0xf0, 0x4d, 0x16, 0x03, 0x09, 0x00, 0x04, 0x1e, 0x00, 
+  0x16, 0x34, 0xf0, 0x01, 0x86, 0x04, 0x30, 0x00, 0x86, 0x60, 0x00, 0x0c, 
+  0x00, 0x04, 0x30, 0x80, 0x8f, 0x7f, 0x47, 0x00, 0xef, 0x54, 0x00, 0x0d, 
+  0x00, 0xd3, 0x40, 0xc8, 0x3f, 0x00, 0x00, 0x07, 0x30, 0x00, 0x04, 0x1e, 
+  0x0d, 0x6f, 0xf2, 0x10, 0x46, 0x48, 0x30, 0x40, 0x02, 0x29, 0x68, 0x2b, 
+  0x78, 0x08, 0xf4, 0x48, 0x30, 0x00, 0x00, 0x04, 0x36, 0x00, 0xa0, 0x0f, 
+  0xf4, 0x16, 0xf0, 0x4a, 0x24, 0x00, 0x71, 0x4a, 0x20, 0x80, 0x00, 0xa8, 
+  0x20, 0x80, 0x01, 0x05, 0x29, 0x02, 0x00, 0x0c, 0x78, 0x45, 0x79, 0x01, 
+  0x69, 0x22, 0x00, 0xf0, 0x1b, 0x00, 0x30, 0x00, 0x04, 0x01, 0xa6, 0x04, 
+  0xf0, 0xf1, 0x45, 0x02, 0xf0, 0xf1, 0x47, 0x26, 0x71, 0x94, 0xf1, 0x23, 
+  0x43, 0x80, 0x23, 0x0e, 0x01, 0x00, 0x8b, 0x2d, 0xe8, 0x02, 0x85, 0x20, 
+  0x88, 0x28, 0x43, 0x27, 0xe9, 0xc1, 0x80, 0xed, 0x70, 0xcb, 0x44, 0x50, 
+  0x01, 0xf0, 0x19, 0xe0, 0x4e, 0x20, 0x90, 0x39, 0x09, 0xd1, 0x02, 0x28, 
+  0x88, 0x50, 0x80, 0x42, 0x21, 0x3c, 0x80, 0x80, 0xb2, 0x0b, 0xf2, 0x0c, 
+  0x10, 0x02, 0x00, 0xa8, 0x20, 0xc0, 0x01, 0x04, 0x12, 0x01, 0x04, 0x28, 
+  0x81, 0x84, 0xb1, 0x83, 0xb1, 0x29, 0x88, 0x1c, 0x00, 0x40, 0x08, 0xf2, 
+  0x04, 0x80, 0x70, 0x00, 0xf0, 0x03, 0x04, 0x10, 0x01, 0x04, 0x24, 0x81, 
+  0x80, 0xb1, 0xe5, 0x71, 0xc5, 0x0f, 0xc4, 0x92, 0x00, 0x1b, 0x02, 0x06, 
+  0x62, 0x00, 0x80, 0x4e, 0x01, 0x00, 0x8b, 0xaf, 0x08, 0x10, 0x00, 0x64, 
+  0x00, 0xe0, 0xa3, 0x09, 0x30, 0x00, 0x28, 0x43, 0x81, 0x80, 0xcd, 0x70, 
+  0x0a, 0x22, 0x80, 0x0f, 0x68, 0x00, 0x20, 0xc0, 0x4c, 0x68, 0x00, 0x51, 
+  0x91, 0x03, 0x28, 0x88, 0xf0, 0x68, 0x00, 0x20, 0x40, 0xb7, 0x68, 0x00, 
+  0x12, 0x0f, 0x68, 0x00, 0x8f, 0x17, 0x01, 0x14, 0x28, 0x81, 0x44, 0xb1, 
+  0x43, 0x68, 0x00, 0x02, 0x8c, 0x40, 0xb1, 0xc5, 0x71, 0xc5, 0x0e, 0xc4, 
+  0x92, 0x4c, 0x00, 0x1f, 0x51, 0x4c, 0x00, 0x28, 0x00, 0xb4, 0x00, 0x80, 
+  0x80, 0x21, 0x8e, 0x31, 0x00, 0x11, 0x80, 0x30, 0x16, 0x01, 0xa1, 0xc0, 
+  0x88, 0x27, 0xee, 0x81, 0x80, 0xed, 0x70, 0xc3, 0x43, 0x14, 0x01, 0x01, 
+  0x60, 0x00, 0x24, 0x11, 0x03, 0x14, 0x01, 0x1d, 0x60, 0x14, 0x01, 0x3f, 
+  0x64, 0xb1, 0x63, 0x60, 0x00, 0x02, 0x11, 0x60, 0x14, 0x01, 0x80, 0x84, 
+  0x93, 0x00, 0x19, 0x02, 0x36, 0x03, 0xc3, 0x32, 0x07, 0xf0, 0x13, 0xa1, 
+  0x40, 0x82, 0x41, 0xba, 0x0d, 0x6f, 0xf5, 0x63, 0x42, 0xe9, 0x08, 0x31, 
+  0x00, 0x10, 0x40, 0x07, 0x85, 0xe1, 0x08, 0x1e, 0x02, 0x02, 0xc0, 0x19, 
+  0xe8, 0x02, 0x85, 0x02, 0x0d, 0xaf, 0xf4, 0x1f, 0xd9, 0x46, 0x02, 0x00, 
+  0xfc, 0x01, 0xf1, 0x19, 0x11, 0xf7, 0x0f, 0xe8, 0x30, 0x80, 0x20, 0x91, 
+  0x48, 0x31, 0x01, 0x00, 0x00, 0x35, 0x41, 0x20, 0x07, 0x36, 0x42, 0x70, 
+  0x48, 0x47, 0x00, 0x00, 0x31, 0x80, 0x48, 0x32, 0x40, 0x02, 0x1f, 0xa1, 
+  0x01, 0xc0, 0x1a, 0xe8, 0x02, 0x85, 0xce, 0x0c, 0x34, 0x00, 0x12, 0x37, 
+  0x34, 0x00, 0x36, 0x12, 0xf7, 0x10, 0x34, 0x00, 0x1c, 0x37, 0x34, 0x00, 
+  0xf3, 0x0d, 0x84, 0x19, 0x00, 0x00, 0xcd, 0x70, 0x8a, 0x47, 0x67, 0x40, 
+  0x6d, 0x0e, 0x05, 0x10, 0x08, 0x17, 0x00, 0x14, 0xea, 0xe0, 0x11, 0xf2, 
+  0xe8, 0xe0, 0x2a, 0xf4, 0x8e, 0x40, 0x72, 0x02, 0x61, 0xff, 0x24, 0xf2, 
+  0x02, 0x85, 0x7a, 0x54, 0x00, 0x86, 0x31, 0x80, 0x10, 0x80, 0x3f, 0x81, 
+  0x0f, 0xf0, 0x1c, 0x00, 0x55, 0x16, 0xf2, 0x02, 0x85, 0x5e, 0x1c, 0x00, 
+  0x60, 0x84, 0x11, 0x01, 0x00, 0x00, 0x90, 0x6a, 0x00, 0x02, 0x66, 0x02, 
+  0x51, 0x40, 0x00, 0x07, 0x36, 0x00, 0x6e, 0x00, 0xf4, 0x21, 0x04, 0x1c, 
+  0x00, 0x20, 0x40, 0x24, 0x14, 0x22, 0xc5, 0x71, 0xcc, 0xf1, 0x4a, 0x85, 
+  0x6c, 0x70, 0x4a, 0x24, 0x00, 0x10, 0x30, 0x1a, 0x41, 0x00, 0x2c, 0x1a, 
+  0x00, 0x06, 0x04, 0xc1, 0x8f, 0x78, 0x23, 0x08, 0x45, 0x00, 0x03, 0xc1, 
+  0x16, 0x21, 0x00, 0x00, 0x20, 0x80, 0x09, 0xe9, 0x01, 0x80, 0xee, 0x02, 
+  0xf1, 0x2c, 0x03, 0xf7, 0x64, 0x71, 0x6b, 0xa2, 0x85, 0x71, 0xee, 0xf1, 
+  0x02, 0x40, 0xa5, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xda, 0xc6, 0xf2, 0xc3, 
+  0x82, 0x24, 0x0c, 0x3f, 0x28, 0x45, 0x22, 0x89, 0x08, 0x46, 0x8a, 0x22, 
+  0x3e, 0x27, 0x8c, 0x21, 0x83, 0x8f, 0x18, 0xf4, 0x4a, 0x24, 0xc0, 0x73, 
+  0xc9, 0x47, 0x80, 0x27, 0x8e, 0x10, 0x0c, 0x70, 0x2e, 0x71, 0x4a, 0x21, 
+  0x40, 0x8c, 0x01, 0xf1, 0x86, 0x81, 0xc2, 0x1a, 0x62, 0x04, 0x71, 0x20, 
+  0xaa, 0x24, 0x71, 0x03, 0x8d, 0x08, 0xe8, 0x8a, 0x22, 0xfe, 0x26, 0x11, 
+  0x08, 0x34, 0x04, 0x61, 0xc0, 0x42, 0x40, 0xd2, 0xc7, 0x4a, 0x21, 0xc0, 
+  0x23, 0xd1, 0x43, 0x54, 0x26, 0x14, 0x19, 0x54, 0x26, 0x95, 0x1b, 0x4e, 
+  0x70, 0x0e, 0x71, 0x0c, 0x70, 0x80, 0x23, 0x07, 0x2d, 0x00, 0x1c, 0x01, 
+  0x31, 0xe1, 0x09, 0x24, 0xa4, 0x2f, 0x26, 0x07, 0xf0, 0xec, 0xf5, 0x81, 
+  0xc0, 0x04, 0x77, 0x32, 0x20, 0x00, 0x04, 0x04, 0x77, 0x8e, 0xe0, 0x24, 
+  0x01, 0x0d, 0x00, 0x25, 0x20, 0x00, 0x00, 0x10, 0xf0, 0x19, 0xf0, 0x28, 
+  0xf0, 0x32, 0xf0, 0x46, 0xf0, 0x4a, 0xf0, 0x50, 0xf0, 0x54, 0xf0, 0x5b, 
+  0xf0, 0x60, 0xf0, 0x67, 0xf0, 0x6b, 0xf0, 0x71, 0xf0, 0x75, 0xf0, 0x7b, 
+  0xf0, 0x80, 0xc1, 0x56, 0x24, 0x42, 0x3d, 0x26, 0x0b, 0x20, 0x00, 0xa1, 
+  0x40, 0x56, 0x24, 0x41, 0x3d, 0x14, 0xda, 0x82, 0x40, 0x19, 0xf0, 0x80, 
+  0xc1, 0x00, 0x24, 0x82, 0x3f, 0x00, 0x00, 0x94, 0x01, 0x8e, 0x1a, 0x00, 
+  0x31, 0x00, 0x24, 0x81, 0x0e, 0x00, 0xc0, 0x14, 0xda, 0xa2, 0x40, 0x0b, 
+  0xf0, 0x80, 0xc1, 0x85, 0xc2, 0x6e, 0x0c, 0x18, 0x00, 0xd5, 0x85, 0xc1, 
+  0x8a, 0x22, 0x06, 0x00, 0x62, 0x40, 0x12, 0x0b, 0xcf, 0xe7, 0x5a, 0x36, 
+  0x00, 0x40, 0xbc, 0x01, 0x76, 0x0e, 0x1e, 0x00, 0x42, 0x70, 0x16, 0x82, 
+  0x10, 0x3a, 0x00, 0xf1, 0x02, 0xbc, 0x01, 0x4a, 0x0c, 0xaf, 0xff, 0xdf, 
+  0x16, 0x00, 0x16, 0x10, 0x42, 0x46, 0xf0, 0x80, 0xc1, 0xf2, 0x20, 0x00, 
+  0x71, 0x0a, 0xa6, 0x40, 0xf0, 0x80, 0xc1, 0xe6, 0x0c, 0x00, 0x71, 0x0b, 
+  0xa6, 0x3a, 0xf0, 0x80, 0xc1, 0xda, 0x0c, 0x00, 0x71, 0x0c, 0xa6, 0x34, 
+  0xf0, 0x80, 0xc1, 0xce, 0x0c, 0x00, 0x91, 0xdd, 0x1e, 0x18, 0x10, 0x2c, 
+  0xf0, 0x80, 0xc1, 0xbe, 0x0e, 0x00, 0xf1, 0x08, 0xde, 0x1e, 0x18, 0x10, 
+  0x26, 0xf0, 0x80, 0xc1, 0xfe, 0x08, 0x60, 0x00, 0xa1, 0x40, 0xff, 0x1f, 
+  0x02, 0x90, 0x1e, 0xf0, 0x80, 0xc1, 0xee, 0x0e, 0x00, 0x71, 0x00, 0xaf, 
+  0x18, 0xf0, 0x80, 0xc1, 0xe2, 0x0c, 0x00, 0x71, 0x01, 0xaf, 0x12, 0xf0, 
+  0x80, 0xc1, 0xd6, 0x0c, 0x00, 0x71, 0x02, 0xaf, 0x0c, 0xf0, 0x80, 0xc1, 
+  0xca, 0x0c, 0x00, 0x30, 0x03, 0xaf, 0x06, 0x4c, 0x00, 0x01, 0x0c, 0x00, 
+  0xf0, 0x4b, 0x04, 0xaf, 0x56, 0x70, 0x78, 0x22, 0x01, 0x20, 0x0c, 0x71, 
+  0xc0, 0x20, 0x61, 0x20, 0x26, 0x78, 0x5e, 0xf1, 0x6d, 0x70, 0x6c, 0x71, 
+  0xcb, 0x44, 0x80, 0xbf, 0x00, 0x00, 0x2c, 0x70, 0x15, 0x20, 0x41, 0x00, 
+  0x40, 0x81, 0x04, 0x32, 0xc0, 0x82, 0x44, 0xf7, 0x80, 0xa1, 0x06, 0xf0, 
+  0xc4, 0xf6, 0x50, 0x24, 0xc2, 0x17, 0x40, 0xa1, 0x74, 0x70, 0x6c, 0x70, 
+  0x2c, 0x71, 0xf2, 0xf5, 0xe0, 0x7e, 0xe0, 0x78, 0xf1, 0xc0, 0x00, 0x41, 
+  0x14, 0x73, 0x0c, 0x77, 0x07, 0xf7, 0xf0, 0x26, 0x41, 0x70, 0x13, 0x00, 
+  0x1c, 0x91, 0x03, 0xe9, 0x40, 0x79, 0xd1, 0xc0, 0x1c, 0x00, 0xf1, 0x47, 
+  0xe6, 0xc3, 0xa5, 0xc1, 0x68, 0x45, 0x60, 0x83, 0x28, 0x47, 0x14, 0xe3, 
+  0x31, 0x0a, 0xe4, 0x00, 0x00, 0x41, 0x80, 0xc0, 0x14, 0xda, 0xea, 0x09, 
+  0xef, 0xe7, 0x80, 0xc6, 0x4a, 0x24, 0x00, 0x75, 0x4a, 0x20, 0x00, 0x00, 
+  0xa8, 0x20, 0x40, 0x02, 0x20, 0x85, 0x01, 0x16, 0x82, 0x14, 0x19, 0x61, 
+  0x04, 0x71, 0xf9, 0x61, 0x40, 0xa9, 0x00, 0x85, 0x14, 0xe0, 0x00, 0xa5, 
+  0xc6, 0xc7, 0xe0, 0x78, 0xe4, 0xc2, 0x08, 0x46, 0x20, 0x40, 0x28, 0x45, 
+  0x4a, 0x0f, 0x2f, 0xfe, 0x00, 0x19, 0x01, 0x00, 0xc0, 0xa5, 0xa1, 0x40, 
+  0xc4, 0xc6, 0x18, 0x00, 0xf0, 0x1e, 0x45, 0x70, 0x18, 0x03, 0x00, 0x54, 
+  0x20, 0x00, 0x09, 0x2c, 0x70, 0xde, 0x0f, 0xaf, 0xf5, 0x14, 0xda, 0x4a, 
+  0x24, 0x40, 0x71, 0x54, 0x25, 0x80, 0x1b, 0xa8, 0x20, 0x00, 0x01, 0x04, 
+  0x18, 0x11, 0x00, 0xa1, 0x40, 0x80, 0x20, 0x07, 0x0d, 0x2c, 0x70, 0xbe, 
+  0x0f, 0xaf, 0xf5, 0xa0, 0x01, 0x00, 0x20, 0x00, 0x44, 0x40, 0x25, 0x00, 
+  0x1d, 0x20, 0x00, 0xc6, 0x8a, 0x24, 0x01, 0x78, 0x54, 0x25, 0x80, 0x1e, 
+  0x4a, 0x26, 0x00, 0x10, 0x34, 0x00, 0x80, 0x96, 0x08, 0x6f, 0xfe, 0xdf, 
+  0x1d, 0x98, 0x13, 0x2e, 0x00, 0x93, 0xa1, 0x40, 0xa8, 0x20, 0x40, 0x01, 
+  0xc1, 0xa0, 0x08, 0x4e, 0x00, 0x60, 0x0e, 0x00, 0x00, 0x18, 0x03, 0x00, 
+  0x82, 0x00, 0x00, 0x88, 0x07, 0x20, 0xcd, 0x70, 0x9a, 0x00, 0xf4, 0x03, 
+  0x66, 0x0e, 0x6f, 0xfe, 0xc0, 0xa1, 0xd6, 0xa5, 0x3c, 0x1d, 0x82, 0x13, 
+  0xe0, 0xa5, 0xa1, 0x40, 0xc6, 0xc6, 0xb4, 0x00, 0x31, 0xee, 0x0f, 0x6f, 
+  0xb4, 0x00, 0xa2, 0xa1, 0x40, 0xe6, 0x0f, 0x6f, 0xfe, 0x58, 0x1d, 0x01, 
+  0x10, 0xbe, 0x00, 0xf0, 0x15, 0xc3, 0x42, 0x13, 0x00, 0x9c, 0x5f, 0x00, 
+  0xa1, 0x61, 0x82, 0x82, 0x82, 0x00, 0x82, 0x04, 0x19, 0x43, 0x00, 0x16, 
+  0x19, 0x43, 0x00, 0x14, 0x19, 0x05, 0x00, 0x63, 0xa1, 0x84, 0xa1, 0x02, 
+  0xa1, 0xe0, 0x7f, 0x20, 0x40, 0x44, 0x00, 0x80, 0x78, 0x49, 0x28, 0x45, 
+  0xc6, 0x0e, 0xaf, 0xfa, 0x44, 0x00, 0x62, 0xc6, 0x08, 0xaf, 0xfe, 0xa1, 
+  0x40, 0x40, 0x00, 0x04, 0x60, 0x00, 0x7c, 0x04, 0x19, 0x03, 0x00, 0x56, 
+  0x09, 0xef, 0x18, 0x01, 0x05, 0x1c, 0x00, 0x3d, 0x62, 0x0a, 0xaf, 0x1c, 
+  0x00, 0xf2, 0x03, 0x0c, 0x70, 0x38, 0x19, 0x02, 0x00, 0x04, 0xa9, 0x00, 
+  0xa1, 0x20, 0x40, 0x0a, 0x0a, 0xef, 0xfe, 0x28, 0x45, 0x1e, 0x00, 0xf0, 
+  0x05, 0x4a, 0x24, 0xc0, 0x70, 0xa8, 0x20, 0x00, 0x04, 0x40, 0x80, 0x2c, 
+  0x70, 0x04, 0x32, 0x40, 0x80, 0x45, 0xf7, 0xc3, 0x41, 0x02, 0x02, 0xc0, 
+  0x04, 0xf0, 0xc5, 0xf6, 0x7f, 0xd9, 0x17, 0xb9, 0x20, 0xa0, 0x04, 0x74, 
+  0xd0, 0x01, 0xf2, 0x03, 0xe2, 0xc2, 0x28, 0x45, 0x20, 0x81, 0x40, 0x43, 
+  0x14, 0xda, 0x19, 0x61, 0xda, 0x0d, 0xaf, 0xf5, 0x60, 0x40, 0xac, 0x01, 
+  0x2f, 0xc2, 0xc6, 0xec, 0x01, 0x05, 0x3f, 0xfe, 0x0f, 0xaf, 0xec, 0x01, 
+  0x14, 0x40, 0x8d, 0x04, 0x8f, 0xf8, 0x4c, 0x02, 0xf0, 0x0d, 0x01, 0x80, 
+  0x84, 0x20, 0x03, 0x0c, 0x13, 0x08, 0x30, 0x08, 0x90, 0xe0, 0x0c, 0x70, 
+  0x08, 0xf4, 0x00, 0x81, 0x9b, 0x5a, 0x04, 0xf0, 0x1a, 0x0d, 0xaf, 0xf8, 
+  0x00, 0x81, 0x56, 0x02, 0x08, 0x84, 0x00, 0x1d, 0x56, 0x84, 0x00, 0x42, 
+  0x82, 0x24, 0x06, 0x30, 0x86, 0x00, 0x53, 0x56, 0x23, 0x03, 0x0c, 0x33, 
+  0x88, 0x00, 0x00, 0x00, 0x02, 0x11, 0x72, 0x8a, 0x00, 0x6f, 0x8a, 0x24, 
+  0x06, 0x70, 0x0c, 0x70, 0x88, 0x00, 0x01, 0x40, 0x56, 0x20, 0x00, 0x0c, 
+  0x8a, 0x00, 0xf0, 0x7b, 0xe2, 0xc2, 0x08, 0x45, 0x04, 0x71, 0x6e, 0x0a, 
+  0xaf, 0xf2, 0x0f, 0x78, 0x10, 0xd9, 0xa1, 0x40, 0x0c, 0x58, 0xc3, 0x40, 
+  0xa0, 0x00, 0x8c, 0x7e, 0x20, 0x80, 0xc3, 0x40, 0x12, 0x00, 0x50, 0xb8, 
+  0x09, 0x09, 0x20, 0x00, 0xb5, 0x71, 0xc2, 0xc6, 0x60, 0xd8, 0xca, 0x20, 
+  0x21, 0x06, 0xb5, 0x70, 0xca, 0x20, 0xa1, 0x01, 0x0f, 0x58, 0xc2, 0xc6, 
+  0xe6, 0xc2, 0x48, 0x45, 0x28, 0x46, 0x7a, 0x0b, 0xef, 0xf2, 0x08, 0x47, 
+  0x14, 0x70, 0x0c, 0x70, 0x26, 0xf2, 0x8c, 0xd8, 0x5f, 0x27, 0x01, 0x17, 
+  0xea, 0x78, 0x30, 0x21, 0x82, 0x0f, 0xa0, 0x00, 0xa8, 0x4d, 0x30, 0x20, 
+  0x80, 0x0f, 0xa0, 0x00, 0x10, 0x4a, 0x50, 0x70, 0x0c, 0x71, 0xd8, 0xf7, 
+  0x80, 0x85, 0x2d, 0x0c, 0x85, 0x10, 0x5f, 0x27, 0x01, 0x1f, 0x30, 0x21, 
+  0x83, 0x0f, 0xa0, 0x00, 0xcc, 0x4c, 0x99, 0x62, 0x0a, 0xe1, 0x19, 0x09, 
+  0xe5, 0x00, 0x6c, 0x24, 0x41, 0x10, 0x40, 0x86, 0x59, 0x61, 0xbe, 0x01, 
+  0x86, 0x20, 0x85, 0x24, 0x74, 0x20, 0xa5, 0xc6, 0xc6, 0x7c, 0x01, 0x00, 
+  0xcc, 0x00, 0x42, 0x19, 0x61, 0x5e, 0x0c, 0xfa, 0x00, 0x02, 0xb6, 0x00, 
+  0x0f, 0xfc, 0x00, 0x0d, 0x2f, 0x76, 0x0e, 0xfc, 0x00, 0x14, 0xf0, 0x4e, 
+  0xc0, 0x08, 0x44, 0x14, 0x70, 0x1c, 0xd8, 0x2a, 0xf2, 0x2a, 0xe9, 0x60, 
+  0x91, 0xe1, 0xd8, 0x4d, 0x0b, 0x81, 0x0f, 0x00, 0x00, 0x2b, 0x66, 0x76, 
+  0x81, 0xb6, 0x84, 0x41, 0x0b, 0x41, 0x03, 0xa1, 0x94, 0x0d, 0x0d, 0xde, 
+  0x11, 0x39, 0x0b, 0x34, 0x04, 0x70, 0xbb, 0x80, 0x23, 0x3e, 0x01, 0x2d, 
+  0x0b, 0x84, 0x00, 0x41, 0x91, 0x29, 0x0a, 0x41, 0x03, 0x62, 0x94, 0x42, 
+  0x91, 0x21, 0x0a, 0xc1, 0x00, 0x63, 0x94, 0x43, 0x91, 0x19, 0x0a, 0xc1, 
+  0x00, 0x78, 0x84, 0x58, 0x81, 0x11, 0x0a, 0xc1, 0x00, 0x59, 0x84, 0x39, 
+  0x81, 0x09, 0x09, 0x81, 0x00, 0x0c, 0x70, 0xc2, 0xc4, 0xc4, 0x00, 0x20, 
+  0x08, 0x45, 0x60, 0x00, 0x62, 0x1a, 0xf2, 0x20, 0x95, 0x31, 0x09, 0x5c, 
+  0x00, 0xf0, 0x16, 0x5e, 0x85, 0x78, 0xd9, 0x4e, 0x0c, 0x2f, 0xeb, 0xa1, 
+  0x40, 0x14, 0x70, 0x1d, 0xd8, 0x0e, 0xf2, 0x1b, 0x85, 0x56, 0x85, 0x0a, 
+  0xb8, 0x10, 0x72, 0xe1, 0xd8, 0x08, 0xf7, 0x38, 0x85, 0x80, 0x22, 0x3e, 
+  0x09, 0x09, 0x0a, 0x44, 0x40, 0x00, 0xf0, 0x00, 0xc6, 0xe0, 0x78, 0xe8, 
+  0xc2, 0xcb, 0x45, 0x12, 0x00, 0x00, 0x40, 0x2d, 0x0d, 0x81, 0x1f, 0x08, 
+  0x00, 0xf1, 0x04, 0x2c, 0x70, 0xed, 0x71, 0x17, 0x69, 0x00, 0x20, 0x8e, 
+  0x0f, 0xa0, 0x00, 0xe0, 0x5e, 0x00, 0x96, 0x35, 0x08, 0x80, 0x54, 0x00, 
+  0xf0, 0x08, 0x01, 0x69, 0xed, 0x08, 0xb4, 0x80, 0x2c, 0x71, 0xcd, 0x70, 
+  0x12, 0xf0, 0x38, 0x25, 0x81, 0x1f, 0x20, 0x00, 0x00, 0x70, 0x38, 0x25, 
+  0x80, 0x08, 0x00, 0xf0, 0x16, 0x20, 0x25, 0x78, 0x0f, 0x08, 0x71, 0x00, 
+  0xcd, 0x70, 0xcb, 0x46, 0x12, 0x00, 0x84, 0x3f, 0xed, 0x70, 0x6e, 0x0f, 
+  0xef, 0xff, 0xc1, 0x40, 0xc3, 0x08, 0x11, 0x00, 0xc3, 0x41, 0x13, 0x00, 
+  0x84, 0x86, 0xb2, 0x49, 0xfe, 0x0e, 0x12, 0x00, 0xf0, 0x7f, 0xaf, 0x08, 
+  0x11, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x4e, 0x0f, 0xef, 0xff, 0x08, 0x45, 
+  0xa3, 0x08, 0x11, 0x00, 0x01, 0x96, 0x2d, 0x08, 0x5e, 0x00, 0x97, 0x08, 
+  0xbe, 0x00, 0x16, 0xd8, 0x16, 0x85, 0x2c, 0x77, 0x41, 0x28, 0xbc, 0x80, 
+  0x0a, 0xf2, 0x54, 0x25, 0x80, 0x1f, 0xa8, 0x20, 0x80, 0x01, 0x04, 0x10, 
+  0x02, 0x04, 0x06, 0x39, 0x81, 0x00, 0x17, 0x85, 0x77, 0x08, 0x61, 0x00, 
+  0x13, 0xd8, 0x7c, 0x15, 0x0b, 0x10, 0x00, 0x23, 0x40, 0x13, 0x54, 0x20, 
+  0x81, 0x0f, 0xa1, 0x40, 0xaa, 0x0e, 0xef, 0xff, 0x61, 0x42, 0xad, 0xe8, 
+  0x54, 0x25, 0x82, 0x1f, 0x54, 0x23, 0x83, 0x1f, 0xc1, 0x40, 0x92, 0x0c, 
+  0xaf, 0xf8, 0xa1, 0x41, 0x10, 0x40, 0x00, 0x16, 0x00, 0x70, 0xa0, 0x00, 
+  0xd8, 0x5e, 0x2c, 0x70, 0x16, 0x0b, 0xaf, 0xf5, 0x80, 0xda, 0xde, 0x08, 
+  0x20, 0x01, 0xa1, 0x40, 0x99, 0xe8, 0x16, 0xef, 0x36, 0x85, 0x16, 0x86, 
+  0x16, 0x70, 0xc2, 0x21, 0x22, 0x04, 0x38, 0x60, 0xe4, 0x00, 0xfa, 0x13, 
+  0x12, 0x00, 0x7c, 0x40, 0x02, 0x26, 0x0d, 0x70, 0xed, 0xff, 0x85, 0xbf, 
+  0xa2, 0x0f, 0x0f, 0xee, 0x1a, 0x65, 0x2c, 0x70, 0xe2, 0x0a, 0xaf, 0xf5, 
+  0xc1, 0x40, 0xc8, 0xc6, 0xee, 0x0d, 0x2f, 0xed, 0x2c, 0x71, 0x24, 0x02, 
+  0x2c, 0x3a, 0x0a, 0x24, 0x02, 0xf0, 0x05, 0x80, 0x83, 0x85, 0x74, 0x29, 
+  0x0a, 0x24, 0x03, 0xa1, 0xc1, 0x4a, 0x24, 0x00, 0x71, 0x4c, 0x70, 0x00, 
+  0x1c, 0x00, 0x30, 0x10, 0x02, 0xf0, 0x17, 0x00, 0x83, 0x80, 0xc4, 0x4c, 
+  0x64, 0x58, 0x60, 0x44, 0x71, 0x38, 0x60, 0x80, 0xa8, 0x00, 0x83, 0x04, 
+  0x74, 0x00, 0xa3, 0xe0, 0x7f, 0x87, 0x74, 0x69, 0x01, 0x6f, 0xf3, 0xc0, 
+  0xd8, 0xe0, 0x78, 0xc3, 0x40, 0x13, 0x00, 0xf0, 0x8f, 0x7c, 0x03, 0xf0, 
+  0x07, 0xa2, 0x0a, 0x6f, 0xf3, 0x08, 0x45, 0x8c, 0x25, 0x83, 0x9f, 0x0c, 
+  0xf2, 0x8c, 0x25, 0x83, 0x9e, 0x12, 0xf2, 0x8c, 0x25, 0xc3, 0x9e, 0x0c, 
+  0x00, 0xf0, 0x00, 0x43, 0x9e, 0x0f, 0xf4, 0x0c, 0x73, 0x0b, 0xf0, 0xa6, 
+  0x0a, 0xaf, 0xe9, 0x0c, 0x73, 0xa2, 0x06, 0x00, 0xf0, 0x36, 0x72, 0x0c, 
+  0x71, 0x03, 0xf0, 0x0c, 0x72, 0x96, 0x0a, 0x8f, 0xe9, 0xc2, 0xc6, 0xe4, 
+  0xc0, 0x40, 0x81, 0x58, 0x60, 0x84, 0x6a, 0x43, 0x88, 0x61, 0x88, 0xc2, 
+  0x88, 0xa0, 0x88, 0x08, 0xba, 0x08, 0xbb, 0xc5, 0x7a, 0x05, 0x23, 0x40, 
+  0x03, 0x10, 0xba, 0x45, 0x78, 0x80, 0xa1, 0xc4, 0xc4, 0xe0, 0x78, 0xe1, 
+  0xc5, 0xa0, 0x83, 0x81, 0x6d, 0x11, 0x0a, 0x24, 0x03, 0xb9, 0x61, 0x00, 
+  0xa9, 0x00, 0x83, 0x04, 0x71, 0x00, 0xa3, 0x38, 0x02, 0xf0, 0x11, 0x42, 
+  0x22, 0x3c, 0x80, 0xe0, 0x7c, 0x40, 0x21, 0x43, 0x06, 0xa8, 0x20, 0x00, 
+  0x03, 0x07, 0x13, 0x01, 0x00, 0x0d, 0x09, 0x01, 0x00, 0x20, 0x8b, 0x87, 
+  0xb9, 0x20, 0xab, 0x55, 0x23, 0x03, 0x08, 0x9c, 0x04, 0xf0, 0x53, 0x14, 
+  0x70, 0xe0, 0x7c, 0x39, 0x88, 0x87, 0xb9, 0x39, 0xa8, 0x00, 0x80, 0xfc, 
+  0xe8, 0xe0, 0x7e, 0xe8, 0xc3, 0xa1, 0xc1, 0xc3, 0x41, 0xa0, 0x00, 0x98, 
+  0x7e, 0x00, 0x89, 0x04, 0xe8, 0x00, 0x19, 0x03, 0x00, 0x91, 0x5a, 0x8a, 
+  0x20, 0x42, 0x2c, 0xcb, 0x47, 0xf0, 0x00, 0x4b, 0x00, 0xcb, 0x46, 0x00, 
+  0x00, 0xfc, 0x7f, 0x0c, 0x70, 0xc3, 0x41, 0x00, 0x00, 0xff, 0xff, 0x80, 
+  0xc2, 0xa2, 0x0c, 0xef, 0xf7, 0x6c, 0x77, 0x00, 0xc0, 0x78, 0xe8, 0xad, 
+  0x70, 0x5a, 0xd9, 0x00, 0x1f, 0x02, 0x14, 0xab, 0x21, 0x08, 0x0e, 0x0e, 
+  0xf0, 0x0b, 0x09, 0x50, 0x00, 0x05, 0xe9, 0x16, 0xf0, 0x60, 0x58, 0x06, 
+  0xe8, 0x08, 0x04, 0xf0, 0x1d, 0x90, 0x7e, 0x00, 0x80, 0x40, 0x78, 0x00, 
+  0xc0, 0x0e, 0xf0, 0x19, 0x08, 0x6e, 0x03, 0xaf, 0x79, 0x4a, 0x69, 0xdf, 
+  0x0a, 0x55, 0x83, 0xc4, 0x78, 0x9a, 0x5a, 0x00, 0xc1, 0xd2, 0x78, 0x24, 
+  0x78, 0x40, 0xc0, 0xa5, 0x71, 0xad, 0x0d, 0x15, 0x94, 0xf2, 0xe8, 0xd2, 
+  0xf1, 0x1c, 0x07, 0xc2, 0x04, 0x77, 0x0f, 0x78, 0x04, 0xe9, 0x21, 0x58, 
+  0x03, 0xf0, 0x1d, 0x58, 0x14, 0x07, 0x91, 0xf1, 0xc0, 0x2f, 0x7b, 0x8c, 
+  0xd8, 0x6a, 0x78, 0x00, 0x0e, 0x04, 0xf3, 0x18, 0x25, 0x4a, 0x2f, 0x27, 
+  0xbf, 0x00, 0x6f, 0x23, 0x3f, 0x00, 0x6f, 0x26, 0x3f, 0x04, 0x20, 0x88, 
+  0x00, 0x18, 0xc3, 0x0f, 0x2f, 0x26, 0xbf, 0x00, 0x8c, 0x21, 0xc3, 0x8f, 
+  0x07, 0xf2, 0xf0, 0x26, 0xc0, 0x70, 0x13, 0x00, 0xac, 0x78, 0x8c, 0x3c, 
+  0x00, 0xf0, 0x07, 0xe2, 0xc2, 0x4d, 0x08, 0xd1, 0x01, 0xc3, 0x40, 0xf0, 
+  0x00, 0x5b, 0x00, 0xa0, 0x88, 0x20, 0x88, 0xe0, 0x78, 0xfd, 0x0d, 0x41, 
+  0x90, 0x98, 0x00, 0xf1, 0x2c, 0xb2, 0x41, 0x20, 0x88, 0x35, 0x0d, 0x40, 
+  0x10, 0xa0, 0xa8, 0x4a, 0x09, 0x2f, 0xe7, 0xa1, 0x40, 0xaa, 0x0d, 0x2f, 
+  0xed, 0xa1, 0x40, 0xcb, 0x45, 0xf0, 0x00, 0x47, 0x00, 0xca, 0x0a, 0x2f, 
+  0xe7, 0x00, 0x8d, 0x0b, 0xe8, 0x00, 0x8d, 0x00, 0x16, 0x01, 0x70, 0xa0, 
+  0x00, 0x94, 0x7e, 0x40, 0x79, 0x07, 0xf0, 0xba, 0x0b, 0x8f, 0xf3, 0xc2, 
+  0xc6, 0x0c, 0x70, 0x0f, 0xe0, 0x04, 0x71, 0xa0, 0x42, 0x20, 0x88, 0x2f, 
+  0x27, 0xff, 0x8a, 0x00, 0xf0, 0x03, 0xc3, 0x42, 0xf0, 0x00, 0x50, 0x02, 
+  0x00, 0x82, 0x10, 0x20, 0x40, 0x00, 0x00, 0xa2, 0x2f, 0x26, 0xff, 0x00, 
+  0x3c, 0x02, 0xf2, 0x2d, 0xe0, 0x7f, 0x00, 0xa1, 0x40, 0x81, 0x02, 0xa1, 
+  0x54, 0x70, 0xe0, 0x7c, 0x21, 0x81, 0x00, 0x7a, 0xe2, 0xc3, 0xa3, 0xc1, 
+  0x08, 0xb8, 0x8f, 0xb8, 0x97, 0xb8, 0x88, 0x45, 0xff, 0xdc, 0xc3, 0x44, 
+  0x13, 0x00, 0x30, 0x3f, 0x40, 0x24, 0x05, 0x32, 0xcc, 0x70, 0x98, 0xb8, 
+  0x42, 0xc4, 0xba, 0x08, 0xef, 0xf3, 0x40, 0xc5, 0x26, 0x08, 0xaf, 0xf8, 
+  0x82, 0xc1, 0xc2, 0xc7, 0x2c, 0x00, 0x0f, 0x2a, 0x00, 0x03, 0x11, 0x8e, 
+  0x2a, 0x00, 0x31, 0xfe, 0x0f, 0x6f, 0x2a, 0x00, 0x60, 0xe0, 0x78, 0x08, 
+  0x44, 0x4c, 0x70, 0x2c, 0x06, 0xf0, 0x09, 0x49, 0x64, 0x34, 0x70, 0xc0, 
+  0x22, 0x61, 0x00, 0x78, 0x21, 0x03, 0x00, 0x7a, 0x22, 0x81, 0x0b, 0xca, 
+  0x20, 0x62, 0x00, 0x2b, 0x7b, 0xf6, 0xf5, 0x08, 0x01, 0xa0, 0x40, 0x81, 
+  0x48, 0x60, 0x44, 0x71, 0xe0, 0x7f, 0x40, 0xa1, 0xf8, 0x04, 0x13, 0xaa, 
+  0x78, 0x06, 0x15, 0x28, 0x78, 0x06, 0x43, 0x28, 0xda, 0x86, 0x09, 0x78, 
+  0x06, 0x1f, 0x7a, 0x78, 0x06, 0x05, 0x13, 0x28, 0x78, 0x06, 0xf0, 0x01, 
+  0xe2, 0xc2, 0xc3, 0x42, 0xa0, 0x00, 0xae, 0x4a, 0xff, 0xd8, 0xcb, 0x44, 
+  0xa0, 0x00, 0x22, 0x4a, 0x34, 0x02, 0xf0, 0x07, 0x3a, 0x4b, 0xf5, 0xdd, 
+  0xfb, 0xdb, 0x03, 0xaa, 0x03, 0xac, 0x03, 0xa9, 0xa0, 0xac, 0x60, 0xaa, 
+  0x96, 0x0a, 0xef, 0xf3, 0x60, 0xa9, 0x1a, 0x00, 0xa0, 0x04, 0x42, 0x00, 
+  0x19, 0x80, 0x0f, 0x13, 0x00, 0xb4, 0x3e, 0x14, 0x01, 0xa0, 0xf1, 0xc0, 
+  0x00, 0x16, 0x02, 0x70, 0xa0, 0x00, 0x68, 0x7f, 0x22, 0x03, 0x20, 0xe0, 
+  0x3d, 0x42, 0x04, 0xf0, 0x0b, 0xbc, 0x78, 0x6c, 0x70, 0xc3, 0x45, 0xa1, 
+  0x00, 0xf0, 0x05, 0xc3, 0x46, 0xa0, 0x00, 0x7c, 0xd3, 0x86, 0x08, 0x6f, 
+  0xf9, 0x8a, 0x24, 0x82, 0x00, 0x00, 0x1e, 0xe8, 0x03, 0x20, 0x9c, 0x7e, 
+  0xca, 0x01, 0x20, 0xe4, 0xc2, 0xc4, 0x01, 0xf1, 0x33, 0x3e, 0x00, 0x20, 
+  0x88, 0x81, 0xb9, 0x20, 0xa8, 0x00, 0x16, 0x80, 0x70, 0xf0, 0x00, 0x0c, 
+  0x01, 0x1b, 0x08, 0x3e, 0x01, 0xad, 0x70, 0xce, 0x09, 0x0f, 0xeb, 0x08, 
+  0x45, 0x29, 0x68, 0x0c, 0x70, 0x97, 0xb8, 0x10, 0x71, 0xca, 0x25, 0x06, 
+  0x10, 0xb6, 0x0b, 0x0f, 0xee, 0x9e, 0x0b, 0x2f, 0xee, 0x08, 0x46, 0x00, 
+  0x41, 0xa1, 0x42, 0xce, 0x0d, 0xef, 0xf8, 0xc1, 0x40, 0x42, 0x09, 0x4f, 
+  0xf7, 0x0c, 0x70, 0xd8, 0x07, 0xf2, 0x02, 0xc3, 0xa2, 0xc1, 0xcb, 0x45, 
+  0xa0, 0x00, 0xd8, 0xd1, 0x0c, 0x71, 0xd6, 0x0a, 0xaf, 0xf7, 0x9c, 0x4d, 
+  0x94, 0x00, 0x30, 0x70, 0x7f, 0xcb, 0x80, 0x00, 0x70, 0x7e, 0x00, 0xa6, 
+  0x54, 0x25, 0x86, 0x1a, 0xa0, 0x00, 0x20, 0x38, 0x58, 0xa0, 0x00, 0x11, 
+  0x96, 0xa0, 0x00, 0xf0, 0x37, 0xa0, 0x00, 0xf0, 0xfb, 0xee, 0x0f, 0x2f, 
+  0xf9, 0x8a, 0x24, 0xc2, 0x00, 0x01, 0xa6, 0x4a, 0x26, 0x00, 0x10, 0xc3, 
+  0x40, 0x69, 0x72, 0x4e, 0x56, 0x40, 0xc0, 0x74, 0xd8, 0x04, 0x1c, 0x04, 
+  0x30, 0x6a, 0x4e, 0x60, 0xc0, 0x54, 0xd8, 0xcc, 0x78, 0xf0, 0x26, 0x82, 
+  0x73, 0xa0, 0x00, 0x74, 0x7f, 0xf0, 0x26, 0x85, 0x73, 0xa0, 0x00, 0x80, 
+  0x7f, 0x55, 0x25, 0x81, 0x1a, 0x00, 0x20, 0x46, 0x00, 0x62, 0x6e, 0x4e, 
+  0x26, 0xc4, 0x11, 0x56, 0x00, 0xf0, 0x13, 0xb4, 0x5d, 0xa6, 0x0f, 0x2f, 
+  0xf9, 0x80, 0xc1, 0x15, 0x25, 0x81, 0x13, 0xc5, 0x71, 0xbd, 0x0e, 0xf4, 
+  0x90, 0x00, 0xa1, 0xc4, 0xc7, 0xe0, 0x78, 0xf2, 0xc2, 0x70, 0x42, 0x50, 
+  0x45, 0x30, 0x43, 0x08, 0x46, 0x72, 0x03, 0xf0, 0x2d, 0x34, 0x00, 0x97, 
+  0xd8, 0x34, 0x70, 0x06, 0x01, 0x21, 0x00, 0x17, 0xaf, 0x2e, 0x70, 0x8a, 
+  0x24, 0x03, 0x20, 0x32, 0x40, 0x1a, 0x20, 0x0d, 0x25, 0xdd, 0x65, 0x32, 
+  0x15, 0xc1, 0x10, 0x29, 0x09, 0x32, 0x00, 0x53, 0x21, 0x00, 0x01, 0x21, 
+  0x08, 0x75, 0x06, 0x25, 0xb9, 0x53, 0x21, 0x42, 0x00, 0xd2, 0x0a, 0x2f, 
+  0xf4, 0xa1, 0x41, 0x32, 0x15, 0x81, 0x10, 0x0c, 0x71, 0x90, 0x02, 0xf5, 
+  0x11, 0x60, 0x02, 0x38, 0x78, 0x00, 0xa2, 0x08, 0x85, 0x84, 0x20, 0x03, 
+  0x0c, 0xa0, 0xe0, 0x56, 0x00, 0x22, 0x00, 0x8d, 0x71, 0x2e, 0x15, 0x80, 
+  0x10, 0x2f, 0x15, 0x82, 0x10, 0x00, 0x2c, 0x01, 0x10, 0xbc, 0x02, 0xf0, 
+  0x00, 0x40, 0xf0, 0x00, 0x40, 0x02, 0x11, 0x0a, 0x10, 0x00, 0x45, 0x80, 
+  0x26, 0x7a, 0x45, 0xa0, 0xbe, 0x02, 0x71, 0x07, 0xf0, 0x45, 0x80, 0x45, 
+  0x79, 0x25, 0x0c, 0x00, 0x84, 0x2e, 0x15, 0x82, 0x10, 0x58, 0x7c, 0x86, 
+  0xa0, 0x30, 0x00, 0x71, 0x24, 0x80, 0x10, 0x21, 0x81, 0x00, 0x24, 0x1c, 
+  0x00, 0xf0, 0x09, 0x06, 0x71, 0x0c, 0x20, 0xc0, 0xa4, 0x6a, 0x07, 0xc5, 
+  0xff, 0x6f, 0x26, 0xff, 0x05, 0x98, 0xd8, 0xad, 0x70, 0x17, 0xaf, 0x5a, 
+  0xd9, 0x0c, 0x70, 0x0a, 0x04, 0xf2, 0x3d, 0xaa, 0x1e, 0x02, 0x10, 0xad, 
+  0x1e, 0x02, 0x10, 0xaf, 0x1e, 0x02, 0x10, 0x4e, 0x0a, 0xef, 0xf3, 0xc1, 
+  0x40, 0x25, 0x08, 0xb4, 0x00, 0x08, 0x43, 0x00, 0x86, 0x8a, 0x0b, 0xef, 
+  0xff, 0x07, 0x1e, 0x43, 0x10, 0xc1, 0x40, 0xa2, 0x41, 0x5a, 0x0b, 0xef, 
+  0xff, 0x42, 0x42, 0x18, 0x8e, 0x0a, 0x21, 0xc0, 0x22, 0x16, 0xaf, 0x07, 
+  0xf0, 0x32, 0x16, 0x80, 0x10, 0x2a, 0x08, 0xaf, 0xf2, 0xc4, 0xb8, 0xa5, 
+  0x71, 0xb7, 0x0d, 0xe4, 0x94, 0x55, 0x26, 0x0e, 0x1c, 0x06, 0xf0, 0x5e, 
+  0x00, 0xf0, 0x16, 0x2e, 0x70, 0x17, 0xaf, 0x99, 0xd8, 0x35, 0x0a, 0x30, 
+  0x20, 0x17, 0xaf, 0xcd, 0x70, 0xb7, 0x6e, 0xa2, 0x75, 0xa1, 0x40, 0x72, 
+  0x0b, 0xef, 0xf3, 0x3a, 0x1d, 0x05, 0x10, 0x17, 0x08, 0xb4, 0x00, 0x00, 
+  0x42, 0xa1, 0x40, 0x2e, 0x5c, 0x00, 0xf0, 0x0a, 0x1d, 0x43, 0x10, 0x18, 
+  0x8d, 0x50, 0x41, 0x16, 0xaf, 0xc5, 0x71, 0xdb, 0x0e, 0x84, 0x94, 0x9a, 
+  0xd8, 0x5a, 0xd9, 0x17, 0xaf, 0x2f, 0x20, 0x47, 0x04, 0x98, 0x00, 0x24, 
+  0xd2, 0xc6, 0xf4, 0x05, 0x71, 0x28, 0xda, 0x19, 0x61, 0x46, 0x0c, 0x6f, 
+  0xf2, 0x05, 0x00, 0xdc, 0x02, 0x00, 0xa0, 0x02, 0xf0, 0x15, 0x48, 0x81, 
+  0x23, 0x92, 0x0b, 0x08, 0x44, 0x00, 0x24, 0x92, 0x09, 0x21, 0x01, 0x00, 
+  0xe0, 0x7f, 0x20, 0x40, 0xe0, 0x78, 0xf6, 0xc3, 0xa3, 0xc1, 0x50, 0x47, 
+  0x30, 0x44, 0xc6, 0x0e, 0x2f, 0xf4, 0x08, 0x45, 0xd3, 0x42, 0x00, 0x05, 
+  0xf0, 0x89, 0x8f, 0x08, 0xa0, 0x04, 0x10, 0x41, 0x0e, 0x70, 0xd3, 0x45, 
+  0x00, 0x00, 0xef, 0xff, 0x40, 0x24, 0x16, 0x30, 0x4a, 0x47, 0x08, 0x8d, 
+  0x4d, 0x08, 0x25, 0x20, 0xf0, 0x7e, 0x03, 0x85, 0xf0, 0x20, 0x0e, 0x04, 
+  0x07, 0x86, 0x0b, 0x08, 0xf1, 0x00, 0xc1, 0x40, 0x82, 0x0f, 0x0f, 0xf5, 
+  0x17, 0x0d, 0x64, 0x24, 0x0a, 0x23, 0x80, 0x24, 0x22, 0x40, 0xc1, 0x41, 
+  0x23, 0x20, 0x00, 0x05, 0xe2, 0x42, 0x10, 0x43, 0xc1, 0x40, 0x1a, 0x09, 
+  0x6f, 0xf5, 0x62, 0x41, 0x14, 0x26, 0x00, 0x24, 0x00, 0x18, 0xc4, 0x04, 
+  0xf0, 0x78, 0x36, 0x0d, 0x2f, 0xf4, 0x62, 0x41, 0x08, 0x47, 0x06, 0x71, 
+  0xdc, 0xf1, 0x10, 0x85, 0x85, 0x0d, 0xa4, 0x23, 0xe0, 0xb0, 0x47, 0x85, 
+  0x05, 0xea, 0x80, 0xc1, 0x60, 0x7a, 0xa1, 0x40, 0x69, 0x85, 0x05, 0xeb, 
+  0x80, 0xc2, 0xc1, 0x41, 0x60, 0x7b, 0xa1, 0x40, 0x2e, 0x0d, 0x2f, 0xf4, 
+  0xa1, 0x40, 0x10, 0x85, 0x21, 0x90, 0x80, 0xb9, 0x21, 0xb0, 0x2c, 0xf0, 
+  0x08, 0x8d, 0x11, 0xe8, 0xed, 0x70, 0x40, 0x24, 0x10, 0x30, 0x98, 0x02, 
+  0xf1, 0x14, 0x03, 0x85, 0xe0, 0x60, 0x23, 0x80, 0x40, 0x79, 0x08, 0x8d, 
+  0xc5, 0x71, 0x02, 0x18, 0xd5, 0x2f, 0xf1, 0x0e, 0x24, 0x90, 0xe5, 0x74, 
+  0x69, 0x85, 0x10, 0x85, 0x00, 0x18, 0x84, 0x04, 0x06, 0xeb, 0x80, 0xc2, 
+  0x42, 0x46, 0x00, 0xa2, 0x09, 0x8d, 0x10, 0xe8, 0xcd, 0x70, 0xed, 0x70, 
+  0x04, 0x85, 0xd4, 0x05, 0xf0, 0x03, 0xb2, 0x0f, 0x6f, 0xf4, 0xc0, 0x60, 
+  0x09, 0x8d, 0xe5, 0x71, 0xf1, 0x0f, 0x24, 0x90, 0xc5, 0x74, 0xd6, 0xc7, 
+  0xb0, 0x03, 0xf1, 0x02, 0x88, 0x81, 0x62, 0x8c, 0x0f, 0x0b, 0x9e, 0x01, 
+  0x65, 0x94, 0x64, 0x7a, 0x17, 0x0a, 0xc1, 0x00, 0xc3, 0x00, 0x01, 0xa2, 
+  0x19, 0x08, 0x80, 0x00, 0x87, 0xe8, 0x43, 0x94, 0x08, 0xf0, 0x10, 0x00, 
+  0xe0, 0x04, 0xf0, 0xca, 0x0e, 0xcf, 0xff, 0x00, 0x42, 0xd1, 0xc0, 0xe0, 
+  0x7f, 0x50, 0x78, 0x24, 0x04, 0x80, 0x88, 0x81, 0xa1, 0x94, 0x0f, 0x0d, 
+  0x9e, 0x11, 0x38, 0x00, 0x15, 0x1b, 0x38, 0x00, 0xb7, 0x1d, 0x08, 0x80, 
+  0x00, 0x03, 0xe8, 0x13, 0x0d, 0x1f, 0x11, 0x44, 0x3c, 0x00, 0x11, 0x8e, 
+  0x3c, 0x00, 0x4f, 0x50, 0x78, 0xc2, 0xc6, 0x70, 0x00, 0x0b, 0x08, 0x34, 
+  0x00, 0x19, 0x5a, 0x70, 0x00, 0xf1, 0x6d, 0x0a, 0x80, 0xe0, 0x7f, 0x0a, 
+  0x80, 0xe0, 0x78, 0xe6, 0xc0, 0x64, 0x80, 0x8d, 0x70, 0x41, 0xa3, 0x08, 
+  0x8b, 0x2d, 0x0c, 0x05, 0x10, 0x03, 0x8b, 0x10, 0xe8, 0x1a, 0x24, 0x0d, 
+  0x10, 0x4c, 0x70, 0xc6, 0x83, 0x47, 0x49, 0x44, 0x71, 0xb5, 0x7e, 0x00, 
+  0x86, 0x01, 0x37, 0x00, 0x10, 0x00, 0xa6, 0x03, 0x8b, 0xf1, 0x0a, 0x24, 
+  0x80, 0xa5, 0x71, 0x85, 0x71, 0xec, 0xf1, 0xc6, 0xc4, 0xe0, 0x78, 0xe6, 
+  0xc2, 0xc4, 0x80, 0x08, 0x45, 0x00, 0x96, 0xb7, 0x08, 0x85, 0x0f, 0x00, 
+  0x00, 0xf0, 0xff, 0x91, 0x08, 0x30, 0x00, 0xa1, 0x40, 0xca, 0x09, 0x00, 
+  0x00, 0x0c, 0x16, 0x08, 0x10, 0x1c, 0x16, 0x09, 0x10, 0x6d, 0x70, 0x4a, 
+  0x22, 0x00, 0x00, 0x02, 0x8d, 0x75, 0x0b, 0x05, 0x10, 0x02, 0x85, 0xf0, 
+  0x20, 0xc1, 0x02, 0x08, 0x81, 0x80, 0x90, 0x61, 0x0c, 0x80, 0x1f, 0x90, 
+  0x00, 0xf0, 0x7b, 0x85, 0x4f, 0x7b, 0x00, 0x90, 0x05, 0x2c, 0x0c, 0x10, 
+  0x0c, 0x70, 0x15, 0x08, 0xe5, 0x00, 0x14, 0x21, 0xcf, 0x10, 0xf4, 0x21, 
+  0x06, 0x10, 0x29, 0x0c, 0x80, 0x11, 0x04, 0x71, 0xf8, 0xf1, 0x00, 0x20, 
+  0xc0, 0x12, 0x40, 0xa8, 0x03, 0x8e, 0x80, 0xb7, 0x44, 0x71, 0x1f, 0x20, 
+  0xcc, 0x00, 0xe4, 0x86, 0x08, 0x81, 0x25, 0x86, 0x75, 0x7f, 0xe4, 0xa0, 
+  0x95, 0x79, 0x23, 0xa0, 0x0e, 0xf0, 0x00, 0x20, 0xc3, 0x12, 0x00, 0xab, 
+  0x83, 0x8e, 0x64, 0x86, 0xe5, 0x86, 0x0c, 0x7c, 0x28, 0x81, 0x15, 0x7b, 
+  0x95, 0x7f, 0x64, 0xa1, 0xe3, 0xa1, 0x65, 0x71, 0xc8, 0xf1, 0x48, 0xae, 
+  0x13, 0xf0, 0x02, 0x8d, 0x42, 0x20, 0x3c, 0x80, 0x0f, 0xf2, 0x44, 0x86, 
+  0x65, 0x86, 0x08, 0x15, 0x01, 0x10, 0xa8, 0x20, 0xc0, 0x01, 0x04, 0x11, 
+  0x00, 0x04, 0x08, 0x80, 0x44, 0xa0, 0x63, 0xa0, 0x08, 0x1e, 0x03, 0x10, 
+  0x0c, 0x70, 0xc6, 0xc6, 0xe0, 0x78, 0xea, 0xc2, 0x24, 0xc8, 0x00, 0xf0, 
+  0x02, 0x91, 0xdb, 0x08, 0x30, 0x00, 0xcd, 0x70, 0x0c, 0x11, 0x11, 0x00, 
+  0xe8, 0x81, 0x1c, 0x11, 0x08, 0x00, 0xbc, 0x00, 0xf3, 0x7a, 0x08, 0x89, 
+  0x9b, 0x0a, 0x25, 0x00, 0x14, 0x27, 0x8b, 0x10, 0xf4, 0x27, 0x80, 0x10, 
+  0x04, 0x71, 0x00, 0x1b, 0x04, 0x10, 0xf4, 0x20, 0x83, 0x10, 0x10, 0x78, 
+  0x41, 0x08, 0xc1, 0x00, 0x63, 0x89, 0x17, 0xeb, 0x2d, 0x70, 0x06, 0x81, 
+  0x4c, 0x7b, 0xf4, 0x20, 0x86, 0x10, 0x00, 0x21, 0xcc, 0x10, 0x80, 0x48, 
+  0x48, 0x36, 0x03, 0x00, 0x25, 0x71, 0x07, 0x30, 0xc3, 0x00, 0x05, 0x81, 
+  0x95, 0x78, 0x60, 0xa0, 0x06, 0x81, 0x95, 0x78, 0xc0, 0xa0, 0x63, 0x89, 
+  0xdd, 0x09, 0xc4, 0x90, 0x04, 0x81, 0x61, 0x81, 0x00, 0x1b, 0x84, 0x13, 
+  0x1f, 0xf0, 0x3f, 0x0b, 0x94, 0x00, 0x24, 0x11, 0x80, 0x00, 0x37, 0x08, 
+  0x51, 0x00, 0x03, 0x89, 0x13, 0xe8, 0x4a, 0x21, 0x00, 0x10, 0x86, 0x81, 
+  0x4c, 0x78, 0x65, 0x81, 0x21, 0x70, 0x04, 0x4c, 0x15, 0x7b, 0x25, 0x71, 
+  0x80, 0xa3, 0x66, 0x81, 0x15, 0x7b, 0x00, 0x1b, 0x01, 0x00, 0x03, 0x89, 
+  0xe9, 0x09, 0x04, 0x3c, 0x00, 0xf0, 0x31, 0x05, 0x10, 0x55, 0x78, 0x60, 
+  0xa0, 0x44, 0x71, 0xb4, 0xf1, 0x0e, 0x70, 0x24, 0x19, 0x82, 0x03, 0x02, 
+  0x8d, 0x4b, 0x08, 0x05, 0x20, 0x01, 0x11, 0x80, 0x24, 0xf4, 0x27, 0x00, 
+  0x10, 0x8a, 0xe8, 0x02, 0x85, 0xc0, 0x60, 0x28, 0x80, 0x22, 0x89, 0x09, 
+  0x09, 0x1e, 0x00, 0xe2, 0x09, 0x4f, 0xf4, 0xc5, 0x74, 0x06, 0x71, 0xee, 
+  0xf1, 0x22, 0x8d, 0x11, 0xe9, 0xcd, 0x70, 0x4a, 0x27, 0x00, 0x10, 0x20, 
+  0x00, 0xf1, 0x16, 0x48, 0x80, 0x42, 0x8a, 0x0b, 0x0a, 0x1e, 0x00, 0xc2, 
+  0x09, 0x4f, 0xf4, 0x22, 0x8d, 0xe5, 0x71, 0xed, 0x0f, 0x64, 0x90, 0xc5, 
+  0x74, 0xca, 0xc6, 0x04, 0x80, 0x65, 0x80, 0x60, 0xa1, 0x04, 0x80, 0xe0, 
+  0x7f, 0x00, 0xa2, 0xe4, 0xdc, 0x01, 0xa0, 0x42, 0x88, 0x2c, 0x70, 0x03, 
+  0x86, 0x24, 0x1e, 0x43, 0x10, 0x2e, 0x01, 0xf7, 0x10, 0xda, 0x08, 0x6f, 
+  0xf5, 0x04, 0x1e, 0x01, 0x10, 0x22, 0x8d, 0x04, 0x86, 0x52, 0x69, 0xce, 
+  0x08, 0x6f, 0xf5, 0x2c, 0x70, 0x22, 0x8d, 0x03, 0x8e, 0x0a, 0x79, 0x05, 
+  0x86, 0x52, 0x69, 0xbe, 0x10, 0x00, 0x53, 0x06, 0x86, 0x52, 0x69, 0xae, 
+  0x10, 0x00, 0x53, 0x07, 0x86, 0x3b, 0x7a, 0xa2, 0x0c, 0x00, 0x51, 0x08, 
+  0x86, 0x3b, 0x7a, 0x96, 0x0c, 0x00, 0x01, 0x54, 0x06, 0xc2, 0xc2, 0xa4, 
+  0x80, 0x22, 0x88, 0x08, 0x46, 0x04, 0x85, 0x52, 0x69, 0x7e, 0x22, 0x00, 
+  0x63, 0x8e, 0x08, 0x85, 0x3b, 0x7a, 0x72, 0x0c, 0x00, 0x93, 0x03, 0x8d, 
+  0x0a, 0x79, 0x06, 0x85, 0x52, 0x69, 0x62, 0x32, 0x00, 0xe0, 0x44, 0x80, 
+  0x22, 0x88, 0x04, 0x1a, 0x01, 0x00, 0x05, 0x82, 0x3b, 0x7a, 0x4d, 0x00, 
+  0x14, 0x00, 0x00, 0x6c, 0x03, 0xf0, 0x03, 0x21, 0x80, 0x0d, 0x09, 0x50, 
+  0x00, 0x86, 0xe9, 0xe6, 0x0f, 0xcf, 0xff, 0x04, 0xf0, 0xae, 0x0f, 0xcf, 
+  0xff, 0xfc, 0x06, 0xf0, 0xb7, 0xee, 0xc2, 0xe8, 0x47, 0xcb, 0x80, 0xa0, 
+  0x87, 0x0a, 0x80, 0x70, 0x43, 0x60, 0x91, 0xb4, 0x78, 0x15, 0x26, 0x50, 
+  0x13, 0x04, 0x18, 0xc5, 0x0f, 0x20, 0x40, 0x40, 0x41, 0x0a, 0x21, 0x40, 
+  0x21, 0x0a, 0x22, 0x00, 0x21, 0x4e, 0x09, 0x6f, 0xf4, 0x34, 0x18, 0xc0, 
+  0x20, 0xb4, 0x7e, 0x01, 0x6d, 0x5c, 0x18, 0x40, 0x24, 0x52, 0x1e, 0x84, 
+  0x14, 0x48, 0x1e, 0xc4, 0x14, 0x00, 0xa7, 0xce, 0xc6, 0xf8, 0xc3, 0xaa, 
+  0xc1, 0x8a, 0x80, 0x08, 0x45, 0x70, 0x45, 0x91, 0x43, 0x0a, 0x84, 0x50, 
+  0x46, 0x38, 0x40, 0x14, 0x74, 0x8a, 0x20, 0xfc, 0x00, 0xee, 0xf4, 0x2c, 
+  0x15, 0x14, 0x10, 0x85, 0xc0, 0xff, 0xd9, 0x14, 0xda, 0xca, 0x0f, 0x2f, 
+  0xf5, 0x40, 0x24, 0x17, 0x35, 0x80, 0xc0, 0x2c, 0x70, 0xbe, 0x0f, 0x2f, 
+  0xf5, 0x14, 0xda, 0xb6, 0x70, 0x0e, 0x70, 0x2d, 0x70, 0x98, 0xf2, 0x18, 
+  0x15, 0x91, 0x10, 0x2d, 0x70, 0x0d, 0x70, 0xca, 0x47, 0x4a, 0x22, 0x00, 
+  0x20, 0x42, 0x21, 0x3c, 0xa0, 0x88, 0xf2, 0x23, 0x85, 0x68, 0x97, 0x4c, 
+  0x70, 0xa8, 0x20, 0x40, 0x02, 0x40, 0x49, 0x00, 0x90, 0x0d, 0x0b, 0x20, 
+  0x00, 0x15, 0x27, 0x8b, 0x20, 0x44, 0x71, 0x7c, 0xf0, 0x65, 0x40, 0x14, 
+  0x77, 0xb9, 0xf4, 0xd3, 0x72, 0x00, 0x00, 0xfe, 0xff, 0xe8, 0x00, 0x2d, 
+  0x00, 0x14, 0x23, 0x80, 0x20, 0x02, 0x90, 0xe1, 0x08, 0x80, 0x0f, 0x26, 
+  0x03, 0xf0, 0x77, 0x13, 0x8f, 0x14, 0x71, 0x5a, 0x01, 0x2d, 0x00, 0x0c, 
+  0x77, 0x15, 0x24, 0x00, 0x22, 0x77, 0x80, 0x12, 0x17, 0x9f, 0x10, 0x2c, 
+  0x70, 0x48, 0x33, 0xc4, 0x02, 0xec, 0x70, 0x48, 0x33, 0x4e, 0x02, 0x60, 
+  0x46, 0x2f, 0x25, 0x06, 0x01, 0x2f, 0x26, 0x05, 0x31, 0x8b, 0x0f, 0xe5, 
+  0x07, 0x80, 0xc4, 0x03, 0x87, 0x8c, 0x68, 0x95, 0x76, 0x18, 0x01, 0x2d, 
+  0x00, 0x8a, 0x20, 0xbf, 0x0f, 0x62, 0x87, 0x25, 0x20, 0x00, 0x03, 0x08, 
+  0xf0, 0x12, 0xf0, 0x19, 0xf0, 0x1b, 0xf0, 0x23, 0xf0, 0x24, 0xf0, 0x2c, 
+  0xf0, 0x23, 0x63, 0x04, 0x33, 0x80, 0x81, 0xf8, 0x00, 0x29, 0x00, 0x52, 
+  0x23, 0xc3, 0x07, 0x04, 0x36, 0xc0, 0x80, 0x4c, 0x00, 0x06, 0x00, 0x74, 
+  0xf0, 0x23, 0x63, 0xe5, 0x0c, 0xe2, 0x00, 0x73, 0x7b, 0x3d, 0x0c, 0xc3, 
+  0x00, 0x6c, 0xf0, 0x23, 0x63, 0x35, 0x0e, 0xc5, 0x10, 0x68, 0xf0, 0x35, 
+  0x23, 0x43, 0x00, 0xcd, 0x0d, 0x18, 0x00, 0xf0, 0x55, 0x25, 0x0d, 0xc3, 
+  0x00, 0x60, 0xf0, 0x34, 0x63, 0xd0, 0x7b, 0x0c, 0xf0, 0x33, 0x23, 0x43, 
+  0x00, 0xb5, 0x0e, 0xe2, 0x30, 0x73, 0x7b, 0x11, 0x0e, 0xc3, 0x30, 0x56, 
+  0xf0, 0x2c, 0x63, 0xcf, 0x7b, 0xa5, 0x0b, 0x04, 0x03, 0x24, 0x74, 0xe4, 
+  0x71, 0xbc, 0xf1, 0x01, 0x87, 0x16, 0x24, 0x81, 0x20, 0x15, 0x23, 0x83, 
+  0x20, 0x25, 0x71, 0x15, 0x24, 0x82, 0x10, 0x42, 0x28, 0xcc, 0x07, 0x00, 
+  0x1b, 0x00, 0x12, 0x00, 0xa1, 0x00, 0xa2, 0x81, 0xa1, 0x10, 0x1b, 0x80, 
+  0x04, 0x05, 0x71, 0x0c, 0x20, 0x40, 0x95, 0xe8, 0x06, 0xe5, 0xff, 0x18, 
+  0xe7, 0x78, 0x21, 0x03, 0x10, 0x79, 0x25, 0x01, 0x20, 0x8a, 0x22, 0x3c, 
+  0x01, 0xb4, 0x00, 0xf0, 0x03, 0x04, 0x21, 0xc1, 0x80, 0x5d, 0x09, 0x30, 
+  0x10, 0x5c, 0x70, 0x18, 0x8d, 0x49, 0x08, 0x25, 0x20, 0x85, 0xc0, 0x1c, 
+  0x06, 0xf0, 0x27, 0xd5, 0x77, 0x1c, 0xf2, 0x03, 0x85, 0x80, 0xc1, 0xf0, 
+  0x21, 0x01, 0x04, 0x5a, 0x26, 0x0e, 0x16, 0xf0, 0x20, 0x00, 0x04, 0xc2, 
+  0x76, 0x84, 0x80, 0x21, 0xa4, 0x32, 0x8e, 0x0e, 0xe9, 0x2c, 0x70, 0x4c, 
+  0x70, 0x62, 0x86, 0xe2, 0x84, 0x44, 0x71, 0x23, 0x63, 0x3f, 0x67, 0x60, 
+  0xa7, 0x72, 0x8e, 0xf5, 0x0a, 0xe4, 0x80, 0x24, 0x74, 0xd4, 0x05, 0x60, 
+  0x06, 0x71, 0xdd, 0xf1, 0x0e, 0x71, 0x5a, 0x00, 0xf0, 0x11, 0x09, 0xf0, 
+  0x0e, 0x70, 0x07, 0xf0, 0x52, 0x21, 0x10, 0x00, 0x03, 0xf0, 0x8a, 0x20, 
+  0xbf, 0x0e, 0x11, 0x08, 0x30, 0x20, 0x03, 0x41, 0x0a, 0x0b, 0x60, 0x00, 
+  0xa1, 0x40, 0x0c, 0x70, 0xd8, 0xc7, 0x84, 0x05, 0x82, 0x0b, 0x80, 0xb6, 
+  0x0e, 0x6f, 0xfa, 0x88, 0x45, 0xdc, 0x06, 0x00, 0x10, 0x00, 0x35, 0x1e, 
+  0x08, 0xaf, 0x10, 0x00, 0xf0, 0x56, 0xe6, 0xc0, 0xb9, 0x88, 0x60, 0x82, 
+  0x28, 0x41, 0xab, 0x0b, 0x64, 0x03, 0x8a, 0x26, 0x7f, 0x0c, 0x42, 0x25, 
+  0x3c, 0x90, 0xcc, 0x70, 0x4e, 0xf2, 0x10, 0x10, 0x0b, 0x00, 0x0d, 0x70, 
+  0xcb, 0x46, 0x00, 0x00, 0xee, 0xff, 0xa8, 0x20, 0x81, 0x01, 0xf0, 0x23, 
+  0x0c, 0x12, 0x5a, 0x20, 0x00, 0x15, 0xe8, 0x84, 0x8c, 0x94, 0x21, 0x70, 
+  0x60, 0x97, 0x80, 0xa0, 0x29, 0x6b, 0x30, 0x79, 0x15, 0x0e, 0x64, 0x10, 
+  0x48, 0x33, 0x01, 0x00, 0x07, 0x36, 0x43, 0x70, 0x48, 0x47, 0x00, 0x00, 
+  0x08, 0xf0, 0x74, 0x70, 0x6c, 0x70, 0xca, 0x23, 0x82, 0x0f, 0x7f, 0x47, 
+  0x00, 0xff, 0x83, 0x97, 0x61, 0xa0, 0x29, 0x6c, 0x30, 0x79, 0x13, 0x26, 
+  0x00, 0x34, 0x34, 0x01, 0x10, 0x26, 0x00, 0x37, 0x07, 0xf0, 0x95, 0x26, 
+  0x00, 0x31, 0x84, 0x97, 0x62, 0x26, 0x00, 0x01, 0x4c, 0x00, 0x01, 0x26, 
+  0x00, 0x13, 0x41, 0x4c, 0x00, 0x40, 0x05, 0xec, 0xc3, 0x41, 0x22, 0x00, 
+  0xf0, 0x01, 0x02, 0xf0, 0x2c, 0x70, 0x65, 0x97, 0x05, 0x71, 0x23, 0xa0, 
+  0x68, 0xb0, 0xa0, 0xa2, 0xc0, 0x40, 0xac, 0x05, 0xf0, 0x88, 0xfa, 0xc2, 
+  0xfc, 0x1c, 0xc8, 0xb6, 0xad, 0xc1, 0x0a, 0x23, 0xc0, 0x31, 0x0a, 0x21, 
+  0x80, 0x31, 0x0a, 0x22, 0x40, 0x21, 0x0a, 0x23, 0x00, 0x21, 0x70, 0x47, 
+  0x50, 0x44, 0x38, 0x40, 0x10, 0x40, 0xcd, 0x70, 0x04, 0x1c, 0x01, 0x34, 
+  0x42, 0xc6, 0x9d, 0x0a, 0x30, 0x00, 0x40, 0xc6, 0x99, 0x0b, 0x10, 0x20, 
+  0x95, 0x0a, 0x14, 0x22, 0x28, 0x10, 0x00, 0x20, 0x0a, 0x80, 0x4c, 0x20, 
+  0x00, 0x80, 0xaa, 0x01, 0x21, 0x00, 0x8a, 0x25, 0xfc, 0x20, 0x4c, 0x27, 
+  0x00, 0xa8, 0x9e, 0x01, 0x25, 0x00, 0x8a, 0x25, 0xff, 0x26, 0xcf, 0x08, 
+  0x30, 0x30, 0x8a, 0x27, 0xbc, 0x10, 0x2e, 0x70, 0xed, 0x70, 0x16, 0x40, 
+  0x20, 0x88, 0x67, 0x0f, 0x65, 0x10, 0x83, 0xc3, 0x01, 0x80, 0x40, 0x24, 
+  0x04, 0x3c, 0x2c, 0x70, 0xe5, 0x48, 0x03, 0x42, 0x40, 0x24, 0x15, 0x33, 
+  0x8e, 0x85, 0x23, 0x20, 0x00, 0x03, 0xa1, 0x40, 0xce, 0x70, 0x0c, 0xc0, 
+  0x3d, 0x0e, 0x25, 0x20, 0x40, 0x24, 0x04, 0x30, 0x01, 0x15, 0x83, 0x24, 
+  0x8d, 0x85, 0xa1, 0x40, 0x62, 0xda, 0x07, 0xf6, 0x54, 0x03, 0x42, 0x42, 
+  0x00, 0xc3, 0x0e, 0xeb, 0x81, 0xc2, 0x82, 0x40, 0xe2, 0x41, 0x0a, 0x24, 
+  0xc0, 0x04, 0x0a, 0x09, 0x6f, 0xf4, 0x0a, 0x25, 0x80, 0x04, 0x08, 0x46, 
+  0x86, 0xe8, 0x26, 0x71, 0xcd, 0x70, 0xc6, 0x71, 0xe4, 0xf1, 0xe5, 0x71, 
+  0xd0, 0xf1, 0x8a, 0x25, 0xbc, 0x20, 0x91, 0xf0, 0x83, 0xc3, 0x40, 0x24, 
+  0x04, 0x3b, 0x2c, 0x70, 0x02, 0x40, 0x03, 0x42, 0x72, 0x0f, 0x6f, 0xf4, 
+  0x83, 0xc7, 0x4a, 0x25, 0x00, 0x10, 0x0b, 0xc0, 0x3f, 0x0d, 0x25, 0x10, 
+  0x40, 0x24, 0x04, 0x32, 0x01, 0x17, 0x83, 0x14, 0x02, 0x40, 0x62, 0x41, 
+  0x4a, 0x0e, 0xef, 0xff, 0x42, 0x42, 0x02, 0xc0, 0x11, 0xe8, 0x00, 0xc3, 
+  0x5c, 0x00, 0x22, 0xae, 0x08, 0x5c, 0x00, 0x60, 0x87, 0x08, 0x31, 0x00, 
+  0x10, 0x45, 0x5e, 0x00, 0xe0, 0xa5, 0x71, 0xe2, 0xf1, 0xd1, 0x45, 0x3b, 
+  0xf0, 0x2e, 0x70, 0xad, 0x70, 0x63, 0xc6, 0xc8, 0x00, 0x30, 0x3d, 0x0d, 
+  0x65, 0x4a, 0x00, 0xb0, 0x30, 0x01, 0x80, 0x23, 0xc3, 0xc0, 0x60, 0x42, 
+  0x42, 0x8d, 0x80, 0xa6, 0x00, 0x57, 0x62, 0x41, 0x00, 0xc3, 0x0f, 0xa6, 
+  0x00, 0x13, 0x66, 0x4a, 0x00, 0x20, 0x08, 0x47, 0xa6, 0x00, 0x40, 0xed, 
+  0x70, 0xc5, 0x74, 0x4a, 0x00, 0x00, 0x82, 0x00, 0x20, 0x6c, 0x70, 0x80, 
+  0x00, 0x21, 0xca, 0x0d, 0x80, 0x00, 0x09, 0xda, 0x00, 0x13, 0x32, 0x34, 
+  0x00, 0x00, 0x7a, 0x00, 0xf1, 0x2c, 0x03, 0xf0, 0xf1, 0x45, 0x37, 0x0d, 
+  0x31, 0x20, 0x2f, 0x25, 0x47, 0x04, 0x2f, 0x0d, 0x30, 0x00, 0x81, 0xc2, 
+  0x01, 0xc0, 0x82, 0x41, 0x70, 0xb8, 0x41, 0xc0, 0x02, 0x40, 0x62, 0x43, 
+  0x0a, 0x24, 0x80, 0x04, 0x0a, 0x26, 0x00, 0x06, 0xc2, 0x0b, 0x6f, 0xf4, 
+  0x0a, 0x27, 0xc0, 0x06, 0x01, 0xc0, 0xae, 0x70, 0x00, 0x19, 0x00, 0x30, 
+  0x0c, 0xf0, 0x0b, 0x0d, 0x11, 0x7e, 0x01, 0xf0, 0x75, 0x2c, 0x70, 0x82, 
+  0x40, 0xe2, 0x42, 0x46, 0x0b, 0x2f, 0xf5, 0x00, 0x19, 0x01, 0x30, 0x2c, 
+  0x70, 0x62, 0x40, 0x3a, 0x0b, 0x2f, 0xf5, 0x42, 0x42, 0xa2, 0x40, 0xad, 
+  0xc0, 0x04, 0x14, 0x1b, 0x34, 0xda, 0xc6, 0x65, 0x06, 0x6f, 0xfa, 0x0b, 
+  0x80, 0xe0, 0x78, 0xec, 0xc2, 0x08, 0x47, 0x01, 0x80, 0x04, 0xe8, 0xc2, 
+  0x0d, 0xcf, 0xf3, 0x4e, 0x70, 0xcd, 0x70, 0x02, 0x87, 0x20, 0x88, 0x59, 
+  0x0e, 0x45, 0x10, 0x01, 0x80, 0xc5, 0x48, 0x68, 0x8d, 0x17, 0xeb, 0x2e, 
+  0x70, 0x0e, 0x70, 0x03, 0x85, 0x30, 0x20, 0x40, 0x04, 0x48, 0x80, 0x27, 
+  0x80, 0x81, 0x92, 0x34, 0x73, 0x46, 0x24, 0x81, 0x11, 0x82, 0xb9, 0x21, 
+  0xb2, 0x05, 0xf4, 0xf6, 0x0d, 0xcf, 0xf4, 0x68, 0x8d, 0x06, 0x71, 0xe1, 
+  0x08, 0xe4, 0xa0, 0x26, 0x74, 0x09, 0x8d, 0x0e, 0xe8, 0x2e, 0x70, 0x4a, 
+  0x20, 0x00, 0x20, 0x04, 0x85, 0x8a, 0x0a, 0xef, 0xff, 0x34, 0x00, 0xf0, 
+  0x03, 0x09, 0x8d, 0x06, 0x71, 0xf5, 0x08, 0x24, 0xa0, 0x26, 0x74, 0xc5, 
+  0x71, 0xd4, 0xf1, 0x38, 0x8f, 0x0f, 0xe9, 0x90, 0x01, 0xf2, 0x1d, 0x03, 
+  0x87, 0x30, 0x20, 0x80, 0x04, 0x05, 0xe8, 0x62, 0x0a, 0xcf, 0xff, 0x38, 
+  0x8f, 0xa5, 0x71, 0xf1, 0x0d, 0x64, 0x90, 0x46, 0x74, 0xcc, 0xc6, 0x15, 
+  0x09, 0xf0, 0x00, 0x0a, 0x80, 0x1b, 0x09, 0x91, 0x00, 0x24, 0x18, 0x80, 
+  0x0f, 0x13, 0x00, 0x2c, 0x44, 0xe0, 0x7e, 0x0a, 0x00, 0x24, 0xf4, 0x43, 
+  0x0a, 0x00, 0xf0, 0x08, 0x64, 0x44, 0xe0, 0x7e, 0xf2, 0xc3, 0xa6, 0xc1, 
+  0x0a, 0x20, 0x00, 0x21, 0x70, 0x45, 0x50, 0x44, 0x30, 0x43, 0x08, 0x46, 
+  0x2e, 0x70, 0x54, 0xa2, 0x02, 0xf0, 0x4e, 0x30, 0x06, 0xf2, 0x76, 0x70, 
+  0x8a, 0x21, 0xbc, 0x20, 0x02, 0xf2, 0xb6, 0x70, 0x8a, 0x02, 0x21, 0x00, 
+  0x4c, 0x20, 0x00, 0xa2, 0x82, 0x02, 0x05, 0x00, 0x0a, 0x86, 0x8a, 0x21, 
+  0xfc, 0x20, 0x0a, 0x80, 0x04, 0x77, 0x14, 0x71, 0x72, 0x02, 0x2d, 0x00, 
+  0x2c, 0x70, 0xeb, 0x86, 0xa2, 0x40, 0x2a, 0x0a, 0x2f, 0xf5, 0x02, 0x42, 
+  0x40, 0x24, 0x05, 0x32, 0x40, 0x24, 0x06, 0x34, 0x40, 0x24, 0x87, 0x33, 
+  0xc1, 0x40, 0x62, 0x41, 0x82, 0x42, 0xa2, 0x43, 0x76, 0x0f, 0xaf, 0xf4, 
+  0x0a, 0x24, 0x00, 0x04, 0x14, 0x70, 0x46, 0x02, 0x22, 0x00, 0x10, 0x41, 
+  0x02, 0xc5, 0x2e, 0x70, 0xac, 0x05, 0xf2, 0x13, 0x37, 0xed, 0x6f, 0x0a, 
+  0x11, 0x20, 0x04, 0xc0, 0x65, 0x08, 0x25, 0x05, 0x84, 0xc2, 0x40, 0x24, 
+  0xc5, 0x33, 0x40, 0x24, 0xc6, 0x35, 0x40, 0x24, 0x07, 0x31, 0x62, 0x40, 
+  0x82, 0x41, 0xa2, 0x43, 0x22, 0x08, 0x38, 0x00, 0xf1, 0x4c, 0x10, 0x42, 
+  0xa3, 0xe8, 0x0f, 0x14, 0x81, 0x30, 0x8c, 0x21, 0x83, 0x8f, 0x07, 0xf4, 
+  0x01, 0xc2, 0xc1, 0x40, 0x06, 0x0a, 0x20, 0x00, 0xa2, 0x41, 0x09, 0xf0, 
+  0x6a, 0x0b, 0xef, 0xf3, 0x02, 0x86, 0x0f, 0xe8, 0x6a, 0x80, 0x01, 0xc2, 
+  0x60, 0x7b, 0xa2, 0x41, 0x4e, 0x70, 0x02, 0xc0, 0x2c, 0x70, 0x02, 0x42, 
+  0xa9, 0x68, 0xa2, 0x40, 0x9a, 0x09, 0x2f, 0xf5, 0x42, 0xc5, 0xce, 0xf1, 
+  0x8a, 0x22, 0xbc, 0x20, 0xf6, 0xf1, 0x4e, 0x70, 0x4c, 0x87, 0x0a, 0x87, 
+  0x2a, 0x86, 0x00, 0x30, 0x80, 0x00, 0x48, 0x30, 0xc0, 0x02, 0x0d, 0xa1, 
+  0x0b, 0x87, 0x00, 0x32, 0x00, 0x0c, 0x00, 0xf0, 0x91, 0x13, 0x0a, 0x31, 
+  0x20, 0x0e, 0xa1, 0x0e, 0x14, 0x80, 0x30, 0x0b, 0x08, 0x15, 0x01, 0x28, 
+  0x19, 0x81, 0x00, 0x70, 0x17, 0x80, 0x10, 0x42, 0x20, 0x3c, 0x80, 0x13, 
+  0xf2, 0x10, 0x16, 0x03, 0x10, 0xa8, 0x20, 0xc0, 0x03, 0xf0, 0x23, 0x40, 
+  0x04, 0x14, 0x27, 0x42, 0x14, 0xfa, 0x12, 0x0c, 0x07, 0x26, 0x71, 0x28, 
+  0x80, 0x8a, 0x20, 0x0a, 0x0d, 0x83, 0xb1, 0x10, 0x62, 0x04, 0xb1, 0x18, 
+  0x8e, 0x2e, 0x70, 0x08, 0x43, 0x19, 0xe8, 0x43, 0x86, 0x2c, 0x70, 0x0d, 
+  0x71, 0x20, 0x4a, 0x60, 0x90, 0x82, 0x88, 0x00, 0x28, 0xc3, 0x10, 0x42, 
+  0x24, 0x3c, 0x90, 0x00, 0x1c, 0xc4, 0x30, 0x0a, 0xf2, 0x08, 0x10, 0x00, 
+  0x00, 0xa8, 0x20, 0x80, 0x01, 0x04, 0x10, 0x0c, 0x04, 0x88, 0x84, 0x65, 
+  0xb4, 0x24, 0x71, 0xdd, 0x09, 0xc4, 0x82, 0x0e, 0x70, 0x02, 0x86, 0x20, 
+  0x88, 0x7b, 0x08, 0x65, 0x20, 0xe9, 0x45, 0x01, 0x80, 0xf0, 0x20, 0x0d, 
+  0x04, 0x48, 0x85, 0x08, 0xea, 0x80, 0xc1, 0x60, 0x7a, 0xa1, 0x40, 0x00, 
+  0x14, 0x03, 0x31, 0x19, 0xf0, 0x08, 0x8d, 0x6c, 0x70, 0x00, 0x1c, 0x44, 
+  0x34, 0x8a, 0x00, 0x60, 0x11, 0xf2, 0x43, 0x85, 0x4a, 0x23, 0x48, 0x00, 
+  0xf0, 0x03, 0x40, 0x03, 0x04, 0x12, 0x00, 0x04, 0x08, 0x80, 0x22, 0x88, 
+  0x0d, 0x09, 0x9f, 0x01, 0x05, 0x90, 0x05, 0x7b, 0x66, 0x00, 0xf2, 0x0c, 
+  0xe0, 0x78, 0x09, 0x8d, 0x08, 0x40, 0x15, 0xe8, 0x84, 0x85, 0x2c, 0x70, 
+  0x20, 0x4c, 0x42, 0x88, 0x42, 0x22, 0x3c, 0x80, 0x14, 0x00, 0x01, 0x00, 
+  0x08, 0x10, 0x0b, 0x7c, 0x00, 0xf0, 0x4a, 0x13, 0x00, 0x14, 0x08, 0x80, 
+  0x65, 0xb0, 0x24, 0x71, 0xe5, 0x09, 0x04, 0x82, 0x06, 0x71, 0xc2, 0xf1, 
+  0xc1, 0x40, 0xb2, 0x0b, 0x20, 0x00, 0x80, 0x25, 0x4e, 0x10, 0x20, 0x8d, 
+  0x10, 0x41, 0xd6, 0x0d, 0xef, 0xff, 0xc1, 0x40, 0x01, 0x8d, 0x04, 0xe8, 
+  0xda, 0x08, 0x20, 0x00, 0xc1, 0x40, 0x80, 0x27, 0xce, 0x10, 0x00, 0x8f, 
+  0x91, 0x08, 0x30, 0x00, 0x0e, 0x70, 0x4a, 0x27, 0x00, 0x10, 0x19, 0x8e, 
+  0x85, 0x0f, 0x05, 0x10, 0x04, 0x86, 0x30, 0x20, 0x0d, 0x04, 0x0c, 0x95, 
+  0x00, 0x41, 0x80, 0x21, 0xbe, 0x0a, 0x1b, 0x09, 0x74, 0x01, 0x15, 0xda, 
+  0x0c, 0x00, 0xf0, 0x27, 0x3d, 0x00, 0x23, 0x09, 0x75, 0x02, 0x8a, 0x22, 
+  0x45, 0x00, 0x0b, 0x0a, 0x4f, 0x00, 0x0b, 0xf0, 0xef, 0x0a, 0x4e, 0x80, 
+  0x8a, 0x20, 0x84, 0x00, 0x40, 0xc0, 0x80, 0xc1, 0xba, 0x0f, 0xaf, 0xf4, 
+  0xa1, 0x40, 0x0c, 0x95, 0x21, 0x08, 0xd5, 0x04, 0x1d, 0x0e, 0x0e, 0x70, 
+  0x05, 0x00, 0x40, 0x51, 0xc3, 0x40, 0x20, 0xbc, 0x12, 0xac, 0x1e, 0x00, 
+  0x13, 0x9a, 0x1e, 0x00, 0xf1, 0x0a, 0x42, 0x20, 0x00, 0x0e, 0x1b, 0x08, 
+  0x75, 0x01, 0x15, 0xd9, 0x17, 0x09, 0x2e, 0x00, 0x80, 0xc1, 0xc3, 0x40, 
+  0x1c, 0xc1, 0x0a, 0xe8, 0x40, 0xc0, 0x7a, 0x20, 0x00, 0xf0, 0x07, 0x06, 
+  0x74, 0xe5, 0x71, 0xc0, 0xf1, 0x56, 0x70, 0xca, 0x21, 0x82, 0x24, 0x22, 
+  0x40, 0xd2, 0xc7, 0xe0, 0x78, 0xf1, 0xc0, 0x1a, 0x0b, 0x72, 0x03, 0xe0, 
+  0x14, 0x70, 0x8a, 0x20, 0x7c, 0x00, 0xd1, 0xc0, 0xe0, 0x7f, 0xca, 0x20, 
+  0x21, 0x00, 0x18, 0x00, 0x1f, 0x06, 0x18, 0x00, 0x02, 0xf0, 0x77, 0xe6, 
+  0xc2, 0x18, 0x10, 0x84, 0x00, 0xeb, 0x80, 0xac, 0x70, 0x6c, 0x70, 0x4b, 
+  0x0b, 0x25, 0x01, 0x6d, 0x70, 0x23, 0x80, 0x8d, 0x70, 0x65, 0x49, 0x14, 
+  0x27, 0xc1, 0x10, 0x52, 0x11, 0x09, 0x01, 0x48, 0x11, 0x0e, 0x01, 0x02, 
+  0x15, 0x88, 0x10, 0x2b, 0x0c, 0x05, 0x12, 0x22, 0x85, 0x30, 0x21, 0xc1, 
+  0x02, 0x28, 0x81, 0x43, 0x91, 0x05, 0xea, 0x08, 0x19, 0x44, 0x02, 0xc3, 
+  0xb1, 0xc3, 0x42, 0x00, 0x00, 0xff, 0xff, 0x09, 0x0e, 0x81, 0x10, 0x44, 
+  0xb1, 0x43, 0xb1, 0x65, 0x74, 0x85, 0x71, 0xec, 0xf1, 0x64, 0x71, 0xdc, 
+  0xf1, 0x22, 0x80, 0x0a, 0x26, 0x40, 0x30, 0x00, 0x11, 0x9f, 0x00, 0x0c, 
+  0x25, 0xc0, 0x87, 0x5e, 0x02, 0x26, 0x00, 0xec, 0x70, 0x04, 0x16, 0x00, 
+  0x30, 0xf0, 0x20, 0x4c, 0x01, 0x08, 0x8c, 0x00, 0x46, 0x10, 0xe8, 0x23, 
+  0x84, 0x0a, 0x24, 0x80, 0x71, 0xec, 0x70, 0xa8, 0x20, 0x80, 0x02, 0x04, 
+  0x11, 0xb8, 0x01, 0xf0, 0x02, 0x02, 0x88, 0x24, 0xb8, 0xc0, 0xb8, 0x00, 
+  0x27, 0x07, 0x00, 0xa9, 0x8c, 0xcd, 0x70, 0x6d, 0x70, 0x6c, 0xe4, 0x03, 
+  0xd0, 0x00, 0x31, 0x0b, 0x65, 0x03, 0x0d, 0x71, 0x24, 0x84, 0x61, 0x49, 
+  0x42, 0x89, 0xbc, 0x01, 0x61, 0x0e, 0xf2, 0x22, 0x81, 0x0a, 0x22, 0x38, 
+  0x02, 0x03, 0x38, 0x00, 0xf0, 0x26, 0x05, 0x90, 0x10, 0x72, 0xc5, 0x23, 
+  0x02, 0x10, 0x00, 0x42, 0x64, 0x71, 0xea, 0xf1, 0x4e, 0x87, 0x0d, 0x87, 
+  0x2f, 0x87, 0x2f, 0x23, 0xc8, 0x02, 0x00, 0x28, 0x8b, 0x10, 0x0f, 0x23, 
+  0x02, 0x10, 0x0f, 0x22, 0x4d, 0x00, 0x7d, 0x0d, 0xe1, 0x10, 0x00, 0x28, 
+  0x09, 0x10, 0x42, 0x26, 0x3c, 0x80, 0xe6, 0xf2, 0x0c, 0x14, 0x0d, 0xbc, 
+  0x02, 0xf1, 0x39, 0x0c, 0xc0, 0x4d, 0x2f, 0x21, 0xc7, 0x01, 0x4f, 0x09, 
+  0xb5, 0x00, 0x08, 0x80, 0x0a, 0x10, 0x08, 0x01, 0x40, 0x27, 0x06, 0x1d, 
+  0x8d, 0x70, 0x52, 0xdb, 0x49, 0x0c, 0x25, 0x11, 0x2c, 0x71, 0x04, 0x16, 
+  0x02, 0x04, 0x58, 0x79, 0x04, 0x21, 0x02, 0x82, 0x12, 0xf2, 0x23, 0x90, 
+  0x31, 0x72, 0xcc, 0x22, 0xc2, 0x82, 0x09, 0xf4, 0x0c, 0xe9, 0x24, 0x90, 
+  0x0a, 0xe9, 0x71, 0x67, 0x24, 0xb0, 0x23, 0xb0, 0x06, 0xf0, 0x06, 0xe9, 
+  0x24, 0x90, 0x04, 0x0e, 0x00, 0x82, 0x64, 0x72, 0x85, 0x71, 0xe4, 0xf1, 
+  0x23, 0x90, 0x12, 0x00, 0xf0, 0x07, 0x52, 0x17, 0x01, 0x11, 0x24, 0xb0, 
+  0xc5, 0x71, 0xb0, 0xf0, 0x00, 0x28, 0x48, 0x10, 0x05, 0x20, 0x40, 0x12, 
+  0x63, 0x08, 0xe1, 0x00, 0x7e, 0x00, 0xf0, 0x0b, 0xa6, 0xf2, 0xa3, 0x84, 
+  0xa8, 0x20, 0x80, 0x0a, 0x2f, 0x20, 0xc7, 0x01, 0x4b, 0x08, 0xb5, 0x00, 
+  0x40, 0x27, 0x08, 0x1d, 0xc0, 0x4d, 0x8d, 0x70, 0x52, 0xda, 0x84, 0x00, 
+  0x32, 0x0b, 0x01, 0x37, 0x7c, 0x00, 0xf2, 0x02, 0x10, 0x03, 0x14, 0x78, 
+  0x79, 0x04, 0x21, 0xc3, 0x82, 0x10, 0xf2, 0x17, 0x0b, 0x61, 0x02, 0x23, 
+  0x90, 0x78, 0x00, 0x19, 0x51, 0x78, 0x00, 0x00, 0x0e, 0x00, 0xc2, 0x44, 
+  0x72, 0x85, 0x71, 0xe6, 0xf1, 0xc5, 0x71, 0x7a, 0xf0, 0x5f, 0x0a, 0x62, 
+  0x00, 0x13, 0x76, 0xe0, 0x00, 0x20, 0x80, 0x09, 0x64, 0x00, 0x11, 0x43, 
+  0x64, 0x00, 0x13, 0x09, 0x64, 0x00, 0xf0, 0x1f, 0x28, 0x80, 0x0a, 0x11, 
+  0x03, 0x01, 0x2f, 0x0c, 0x25, 0x11, 0x0c, 0x71, 0x04, 0x11, 0x08, 0x14, 
+  0x00, 0x28, 0x00, 0x02, 0x04, 0x20, 0xc0, 0x80, 0x0c, 0xf2, 0x15, 0x08, 
+  0xc1, 0x02, 0x03, 0x91, 0x08, 0xe8, 0x04, 0x91, 0x06, 0xe8, 0x50, 0x67, 
+  0x22, 0xb8, 0x04, 0xb1, 0x03, 0xb1, 0x5c, 0x00, 0xb3, 0xea, 0xf1, 0xc5, 
+  0x71, 0x4c, 0xf0, 0x05, 0x20, 0xc0, 0x12, 0x67, 0xc2, 0x00, 0x50, 0x46, 
+  0xf2, 0xc3, 0x84, 0xad, 0xb8, 0x01, 0x07, 0xc4, 0x00, 0x89, 0x09, 0x1d, 
+  0xa0, 0x4e, 0x52, 0xda, 0x8d, 0x70, 0xc4, 0x00, 0x16, 0x11, 0xc4, 0x00, 
+  0x39, 0x15, 0x0b, 0x21, 0xc4, 0x00, 0x17, 0x08, 0xc2, 0x00, 0x13, 0x23, 
+  0xc4, 0x00, 0xc0, 0xa5, 0x71, 0x18, 0xf0, 0x31, 0x0e, 0x10, 0x00, 0x2d, 
+  0x08, 0xe1, 0x10, 0x1c, 0x02, 0x62, 0x23, 0x84, 0xa8, 0x20, 0x00, 0x04, 
+  0xe4, 0x01, 0xf1, 0x1e, 0x45, 0x90, 0x13, 0x0b, 0x81, 0x00, 0x43, 0x90, 
+  0x07, 0xea, 0x44, 0x90, 0x05, 0xea, 0x56, 0x17, 0x02, 0x11, 0x44, 0xb0, 
+  0xe0, 0x78, 0xa5, 0x05, 0xef, 0xff, 0xa4, 0x71, 0xc6, 0xc6, 0xee, 0xc2, 
+  0x18, 0x10, 0x86, 0x00, 0x2c, 0x10, 0x07, 0x00, 0x08, 0x47, 0xcd, 0x70, 
+  0x4c, 0x1c, 0x06, 0xf0, 0x23, 0x49, 0x0a, 0xa5, 0x01, 0x0d, 0x70, 0x03, 
+  0x87, 0x6d, 0x70, 0x44, 0x48, 0x14, 0x27, 0x80, 0x00, 0x48, 0x10, 0x03, 
+  0x01, 0x02, 0x14, 0x89, 0x10, 0x2d, 0x0b, 0x45, 0x12, 0x02, 0x84, 0x30, 
+  0x20, 0x00, 0x02, 0x08, 0x80, 0x23, 0x90, 0x0d, 0x09, 0xc5, 0x00, 0x4a, 
+  0x20, 0xc0, 0x23, 0x63, 0xb0, 0xc3, 0x41, 0xca, 0x02, 0x40, 0x0b, 0x0b, 
+  0x41, 0x00, 0x92, 0x00, 0xe0, 0x05, 0x74, 0x65, 0x71, 0xec, 0xf1, 0x44, 
+  0x71, 0xde, 0xf1, 0x0a, 0x23, 0x80, 0x2f, 0x1a, 0x00, 0x00, 0xb0, 0x06, 
+  0x60, 0xb7, 0x0e, 0x65, 0x10, 0x62, 0x42, 0xb2, 0x06, 0xa0, 0x08, 0x8d, 
+  0x12, 0xe8, 0x4e, 0x70, 0x2e, 0x70, 0x62, 0x42, 0xb4, 0x06, 0x20, 0x80, 
+  0x04, 0x4c, 0x00, 0xf0, 0x13, 0x32, 0x0d, 0xaf, 0xf3, 0x50, 0x78, 0x28, 
+  0x8d, 0x26, 0x71, 0x00, 0x42, 0xed, 0x09, 0x64, 0xa0, 0x46, 0x74, 0x09, 
+  0x6a, 0x10, 0x78, 0x4d, 0x08, 0x85, 0x0f, 0x00, 0x00, 0xef, 0xff, 0x09, 
+  0x15, 0x86, 0x10, 0xa8, 0x04, 0x20, 0x43, 0x0b, 0x98, 0x00, 0x60, 0x04, 
+  0x85, 0x6d, 0x70, 0x64, 0x48, 0x90, 0x00, 0x19, 0x29, 0x90, 0x00, 0x80, 
+  0x0b, 0xe9, 0x13, 0x09, 0x85, 0x00, 0x24, 0x90, 0x94, 0x00, 0x71, 0x0b, 
+  0x09, 0xa5, 0x00, 0x43, 0xb0, 0x44, 0x8c, 0x00, 0xf3, 0x12, 0xee, 0xf1, 
+  0x64, 0x71, 0xe4, 0xf1, 0x0b, 0x0a, 0xe0, 0x04, 0x4c, 0x70, 0xc5, 0x71, 
+  0xba, 0xf1, 0x29, 0x8d, 0xfb, 0x0a, 0x45, 0x80, 0x04, 0x85, 0x40, 0x48, 
+  0x62, 0x88, 0x42, 0x23, 0x3c, 0x80, 0x0d, 0x4c, 0x05, 0xf0, 0x21, 0x40, 
+  0x02, 0x04, 0x10, 0x03, 0x04, 0x68, 0x83, 0x08, 0x1b, 0xc5, 0x0f, 0x06, 
+  0x1b, 0xc5, 0x0f, 0x44, 0x71, 0xec, 0xf1, 0x02, 0x40, 0xce, 0xc6, 0xe0, 
+  0x78, 0x08, 0x80, 0x84, 0x21, 0x41, 0x0e, 0x85, 0x21, 0x02, 0x01, 0x0a, 
+  0x18, 0x05, 0x00, 0x00, 0x18, 0xc5, 0x0f, 0xe0, 0x7f, 0x21, 0xb0, 0x18, 
+  0x00, 0x00, 0x0c, 0x00, 0x82, 0x21, 0x90, 0x6c, 0x21, 0x81, 0x00, 0x82, 
+  0xb9, 0x14, 0x00, 0xf0, 0x3f, 0xe4, 0xc0, 0x28, 0x80, 0x31, 0x11, 0x8b, 
+  0x00, 0x0b, 0x81, 0x0f, 0x08, 0xe5, 0x02, 0x04, 0x71, 0x61, 0x91, 0x0b, 
+  0xa1, 0x0b, 0xf0, 0x4a, 0x81, 0x61, 0x91, 0x01, 0x6a, 0x81, 0xbb, 0x61, 
+  0xb1, 0x0b, 0x08, 0xe4, 0x02, 0x0a, 0xa1, 0x28, 0x19, 0x01, 0x00, 0x30, 
+  0x11, 0x8d, 0x00, 0x89, 0x81, 0xa2, 0xbb, 0x61, 0xb1, 0x10, 0xed, 0x1a, 
+  0x24, 0x42, 0x13, 0x0c, 0x70, 0x83, 0x81, 0xc5, 0x81, 0x03, 0x4c, 0x04, 
+  0x71, 0x55, 0x7e, 0x44, 0x71, 0xf5, 0x08, 0x64, 0x83, 0x60, 0xa6, 0x4a, 
+  0x00, 0xf1, 0x98, 0x89, 0x81, 0x04, 0x81, 0x66, 0x81, 0x40, 0x80, 0x95, 
+  0x7b, 0x40, 0xa3, 0x09, 0x81, 0x4b, 0x81, 0x6d, 0x81, 0x04, 0x71, 0x71, 
+  0x70, 0xca, 0x20, 0x26, 0x00, 0x0b, 0x0b, 0xa5, 0x00, 0x09, 0xa1, 0x4f, 
+  0x78, 0x0d, 0xa1, 0x0c, 0x71, 0xc4, 0xc4, 0xe0, 0x78, 0xe2, 0xc2, 0x27, 
+  0x09, 0x3e, 0x00, 0x08, 0x45, 0x02, 0x0e, 0xaf, 0xf3, 0x00, 0x85, 0x01, 
+  0x85, 0x0b, 0xe8, 0x24, 0x88, 0x09, 0xe9, 0xc3, 0x41, 0xff, 0xff, 0x88, 
+  0x88, 0x32, 0x0d, 0x8f, 0xf3, 0x01, 0x85, 0x04, 0x18, 0x03, 0x00, 0xc2, 
+  0xc6, 0xec, 0xc2, 0xcb, 0x45, 0xf0, 0x00, 0x34, 0x00, 0x93, 0xda, 0x2c, 
+  0x70, 0x94, 0xd8, 0x57, 0xad, 0x00, 0x1e, 0x42, 0x70, 0xa0, 0x00, 0xb4, 
+  0x41, 0x17, 0xad, 0xa2, 0x5a, 0x34, 0xe8, 0xa3, 0x5a, 0x95, 0xd8, 0x56, 
+  0x0e, 0xef, 0xf7, 0x17, 0xad, 0x96, 0xd8, 0x17, 0xad, 0x34, 0x58, 0x10, 
+  0x42, 0x3e, 0x58, 0x10, 0x41, 0x2e, 0x58, 0x10, 0x40, 0x2f, 0x58, 0x08, 
+  0x47, 0x02, 0x41, 0x22, 0x42, 0x00, 0x43, 0x42, 0x40, 0xa4, 0x5a, 0x08, 
+  0x46, 0x03, 0xe8, 0xc1, 0x40, 0x67, 0x58, 0x9b, 0xd9, 0x9c, 0xd8, 0x37, 
+  0xad, 0x02, 0x32, 0x00, 0xb1, 0x9d, 0xd8, 0x16, 0x0b, 0x6f, 0xff, 0x17, 
+  0xad, 0x9e, 0xd8, 0x92, 0x08, 0x00, 0x31, 0x9f, 0xd8, 0x3e, 0x08, 0x00, 
+  0x80, 0xa0, 0xd8, 0xd4, 0xad, 0x17, 0xad, 0x42, 0x40, 0x3e, 0x00, 0xf1, 
+  0x02, 0xe1, 0x43, 0xb1, 0x5a, 0x06, 0xf0, 0x14, 0x8d, 0x84, 0xe8, 0x20, 
+  0xd8, 0x14, 0xad, 0xa2, 0xd8, 0x0a, 0x3a, 0x00, 0xf0, 0x13, 0xa3, 0xd8, 
+  0x17, 0xad, 0x40, 0x58, 0xe0, 0x78, 0xc3, 0x40, 0xa0, 0x00, 0xa0, 0x7e, 
+  0x01, 0x18, 0x43, 0x00, 0x00, 0x16, 0x81, 0x70, 0xf0, 0x00, 0x06, 0x01, 
+  0xe0, 0x7f, 0x20, 0xa8, 0xe0, 0x78, 0xc3, 0x41, 0x18, 0x00, 0xf3, 0x18, 
+  0x61, 0x89, 0x15, 0xeb, 0x20, 0x89, 0x53, 0x21, 0x82, 0x01, 0x00, 0x20, 
+  0x80, 0x80, 0x0e, 0x00, 0x24, 0x00, 0x8c, 0x20, 0x02, 0x80, 0x84, 0xf6, 
+  0x7f, 0xd8, 0x02, 0xf0, 0x0c, 0x70, 0x84, 0x21, 0x02, 0x00, 0x25, 0x78, 
+  0x00, 0x1e, 0x02, 0x38, 0x00, 0xf0, 0x4d, 0x79, 0x23, 0x00, 0x00, 0xe0, 
+  0x7e, 0xe0, 0x78, 0xea, 0xc3, 0xa7, 0xc1, 0x68, 0x47, 0x04, 0x10, 0x08, 
+  0x00, 0xa2, 0x80, 0x83, 0x80, 0x60, 0x80, 0x40, 0x47, 0x30, 0x40, 0x08, 
+  0x46, 0x54, 0x71, 0x00, 0x35, 0x01, 0x12, 0x00, 0x34, 0x0b, 0x12, 0x00, 
+  0x33, 0x42, 0x03, 0x00, 0x30, 0x06, 0x12, 0x00, 0x35, 0x49, 0x13, 0x00, 
+  0x33, 0x00, 0x03, 0x00, 0x33, 0xc4, 0x00, 0x01, 0x30, 0x41, 0x00, 0x02, 
+  0x32, 0xc0, 0x02, 0x02, 0x31, 0x8b, 0x11, 0x01, 0x31, 0x49, 0x00, 0x01, 
+  0x30, 0x02, 0x00, 0x02, 0x33, 0x01, 0x11, 0x00, 0x34, 0x00, 0x13, 0x04, 
+  0x1c, 0x40, 0x32, 0x20, 0x00, 0xf0, 0x5d, 0x40, 0xc2, 0x42, 0xc1, 0x51, 
+  0xf2, 0x23, 0x0f, 0x30, 0x01, 0x83, 0xc1, 0x19, 0x0f, 0xb1, 0x00, 0x44, 
+  0x6f, 0x40, 0x27, 0x03, 0x12, 0x80, 0xc1, 0x40, 0x27, 0x05, 0x13, 0xc1, 
+  0x40, 0x3e, 0x0b, 0x2f, 0xfd, 0xe1, 0x44, 0xca, 0xc7, 0x96, 0x0d, 0x2f, 
+  0xf0, 0xc1, 0x40, 0x43, 0x86, 0x22, 0x86, 0x81, 0x86, 0x00, 0x86, 0x05, 
+  0xc6, 0x03, 0xc3, 0x00, 0x31, 0x82, 0x00, 0x00, 0x30, 0x00, 0x03, 0x02, 
+  0x33, 0x81, 0x03, 0x7f, 0xdd, 0x02, 0x30, 0x80, 0x00, 0x01, 0x31, 0x41, 
+  0x00, 0x17, 0xbd, 0x01, 0x30, 0x00, 0x00, 0x02, 0x35, 0x41, 0x10, 0x6a, 
+  0x0a, 0x6f, 0xef, 0x02, 0x42, 0x01, 0xc2, 0x08, 0x46, 0x00, 0xa7, 0x00, 
+  0x32, 0x81, 0x00, 0x52, 0x22, 0xc0, 0x07, 0x18, 0x00, 0xf0, 0x17, 0x02, 
+  0x42, 0x2f, 0x31, 0x40, 0x00, 0x4e, 0x0a, 0x6f, 0xef, 0x01, 0x31, 0x41, 
+  0x03, 0x04, 0xc2, 0x03, 0xc1, 0x01, 0x30, 0x03, 0x00, 0x00, 0xc4, 0x02, 
+  0x31, 0x80, 0x00, 0x02, 0x42, 0x01, 0x30, 0x01, 0x00, 0x52, 0x24, 0xc0, 
+  0x17, 0x2a, 0x00, 0xf0, 0x07, 0x2a, 0x0a, 0x6f, 0xef, 0x61, 0xa7, 0xc3, 
+  0xa7, 0x02, 0xa7, 0xca, 0xc7, 0x01, 0x33, 0xc2, 0x00, 0x01, 0x34, 0x00, 
+  0x13, 0x00, 0x32, 0xe6, 0x00, 0x20, 0x00, 0x02, 0x70, 0x00, 0x11, 0x0a, 
+  0x62, 0x00, 0xf2, 0x1f, 0x10, 0x41, 0x21, 0x86, 0x00, 0x86, 0x42, 0x86, 
+  0x63, 0x86, 0x01, 0x30, 0x0c, 0x00, 0x00, 0x32, 0x89, 0x00, 0x00, 0x31, 
+  0x48, 0x00, 0x01, 0x33, 0xcb, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x34, 
+  0x4c, 0x10, 0x02, 0x30, 0x41, 0x12, 0x00, 0x33, 0xc0, 0x00, 0x00, 0x33, 
+  0x82, 0x10, 0x12, 0x01, 0x80, 0x00, 0x03, 0x02, 0x31, 0x81, 0x01, 0xca, 
+  0x09, 0x40, 0x00, 0xf0, 0x18, 0x2c, 0x70, 0x04, 0x30, 0x40, 0x80, 0xc7, 
+  0xf6, 0x02, 0x36, 0x0d, 0x70, 0xc9, 0x40, 0xdb, 0x0f, 0x03, 0xf0, 0x52, 
+  0x20, 0xcd, 0x07, 0xc3, 0x40, 0x49, 0xc0, 0xdb, 0x0f, 0x04, 0x31, 0x00, 
+  0xa0, 0x46, 0xf7, 0x02, 0x36, 0x50, 0x74, 0xc9, 0x0e, 0x00, 0xf0, 0x00, 
+  0xf0, 0x52, 0x21, 0xd0, 0x27, 0x04, 0x30, 0x00, 0xa0, 0x45, 0xf7, 0x01, 
+  0x30, 0x90, 0x2f, 0x2e, 0x00, 0x80, 0xa0, 0xa7, 0x03, 0x86, 0x60, 0x86, 
+  0x42, 0x86, 0xb8, 0x00, 0x60, 0x01, 0x86, 0x00, 0x31, 0xc1, 0x00, 0x00, 
+  0x01, 0xf0, 0x69, 0x00, 0x30, 0x80, 0x00, 0x62, 0x09, 0x6f, 0xef, 0x01, 
+  0x30, 0x40, 0x00, 0x52, 0x20, 0xc0, 0x07, 0xa3, 0xa7, 0x08, 0x1f, 0x00, 
+  0x14, 0x01, 0xa7, 0xca, 0xc7, 0xe0, 0x78, 0xe2, 0xc3, 0x08, 0x45, 0x01, 
+  0x80, 0x84, 0x20, 0x03, 0x0c, 0x15, 0x08, 0x31, 0x04, 0xa1, 0xc1, 0x0e, 
+  0x8d, 0x00, 0x15, 0x04, 0x10, 0x1d, 0x78, 0x9d, 0x5a, 0xc2, 0xc7, 0xff, 
+  0xd8, 0x40, 0xc0, 0xc3, 0x44, 0x13, 0x00, 0xbc, 0x13, 0x40, 0x24, 0x05, 
+  0x30, 0xa1, 0x40, 0xaa, 0x5a, 0xa1, 0x40, 0x17, 0x58, 0x00, 0xc0, 0xc2, 
+  0xc7, 0xe0, 0x78, 0xea, 0xc2, 0x08, 0x46, 0x48, 0x30, 0x00, 0x00, 0x48, 
+  0x47, 0x30, 0x40, 0xc3, 0x41, 0x13, 0x00, 0x78, 0x3e, 0x60, 0x42, 0x0a, 
+  0x21, 0x00, 0x21, 0x68, 0x45, 0x83, 0x58, 0x14, 0x77, 0x12, 0xf2, 0x9f, 
+  0x25, 0x02, 0x13, 0x60, 0x02, 0xf4, 0xb5, 0xcc, 0x49, 0xb9, 0x61, 0x00, 
+  0x25, 0x8d, 0x1f, 0xa0, 0x00, 0x25, 0x4a, 0xe5, 0xa1, 0x10, 0x19, 0x00, 
+  0x04, 0xca, 0xa1, 0x00, 0xad, 0xca, 0xc6, 0xf0, 0x26, 0x40, 0x73, 0x13, 
+  0x00, 0xa0, 0x78, 0x09, 0x09, 0x10, 0x20, 0x8d, 0x58, 0xca, 0xc6, 0x8b, 
+  0x58, 0xca, 0xc6, 0x00, 0x41, 0x14, 0x70, 0x0c, 0x70, 0xe0, 0x7c, 0xab, 
+  0x11, 0x80, 0x00, 0x14, 0x70, 0x0c, 0x71, 0xe0, 0x7d, 0xac, 0x11, 0x81, 
+  0x00, 0x34, 0x70, 0xe0, 0x7d, 0xe0, 0x7f, 0x0c, 0x70, 0xe0, 0x78, 0xec, 
+  0xc3, 0xa1, 0xc1, 0x34, 0x58, 0x10, 0x40, 0x3e, 0x58, 0x08, 0x47, 0x2e, 
+  0x58, 0x08, 0x46, 0x2f, 0x58, 0x08, 0x45, 0x10, 0xd8, 0x8d, 0x58, 0x8a, 
+  0x21, 0x82, 0x2c, 0xff, 0xd9, 0x0c, 0x70, 0x10, 0xb9, 0x80, 0xc2, 0x52, 
+  0x0a, 0x2f, 0xf7, 0x6c, 0x77, 0x00, 0xc0, 0x78, 0xe8, 0x4a, 0x22, 0x00, 
+  0x24, 0x00, 0x1e, 0x42, 0x74, 0xf0, 0x00, 0x4b, 0x00, 0x03, 0xf0, 0x00, 
+  0xc0, 0x11, 0x20, 0x80, 0x84, 0x3c, 0xf2, 0x2f, 0x20, 0x87, 0x04, 0x1d, 
+  0x08, 0x10, 0x04, 0x4b, 0x08, 0xb0, 0x04, 0x91, 0xe0, 0x34, 0xf4, 0x02, 
+  0x40, 0xc1, 0x41, 0xe1, 0x42, 0xa1, 0x43, 0x99, 0x5a, 0x4c, 0x20, 0xc0, 
+  0x88, 0x2c, 0xf4, 0x00, 0x16, 0x00, 0x70, 0xa0, 0x00, 0x7c, 0x7e, 0x2c, 
+  0x70, 0x4c, 0x77, 0x56, 0x0b, 0xef, 0xf6, 0x6c, 0x70, 0x78, 0xe8, 0x24, 
+  0x00, 0x27, 0x98, 0x5a, 0x1e, 0x00, 0x30, 0x70, 0x96, 0x0c, 0x1e, 0x00, 
+  0xa0, 0x12, 0xf0, 0x2f, 0x27, 0xff, 0x00, 0x6f, 0x23, 0x3f, 0x00, 0x66, 
+  0x03, 0xf0, 0x2b, 0x74, 0x49, 0x26, 0x80, 0x47, 0x80, 0x18, 0x18, 0x01, 
+  0x00, 0x1c, 0x18, 0x01, 0x00, 0x2f, 0x26, 0xff, 0x00, 0xff, 0xd8, 0x45, 
+  0x58, 0x46, 0x71, 0x4c, 0x22, 0xc0, 0xa4, 0x80, 0x07, 0xce, 0xff, 0xae, 
+  0xf1, 0xe2, 0xc2, 0x2c, 0x70, 0x30, 0xda, 0xa6, 0x0e, 0xaf, 0xf4, 0x08, 
+  0x45, 0x7f, 0xd8, 0x17, 0xb8, 0x34, 0x1d, 0x01, 0x10, 0x0c, 0xa5, 0xc2, 
+  0xc6, 0x2c, 0x01, 0xf0, 0x05, 0x4c, 0x7e, 0xe0, 0x7f, 0x00, 0xa9, 0xe0, 
+  0x78, 0xf1, 0xc0, 0x2c, 0x71, 0x00, 0x29, 0x00, 0x00, 0xb3, 0x5a, 0xd1, 
+  0xc0, 0x6c, 0x03, 0x04, 0x10, 0x00, 0x1b, 0xb4, 0x10, 0x00, 0x22, 0x8e, 
+  0x58, 0x10, 0x00, 0x05, 0x82, 0x00, 0xb0, 0x42, 0xa0, 0x00, 0x84, 0x6e, 
+  0x20, 0x82, 0x25, 0x78, 0x00, 0xa2, 0x7c, 0x00, 0xf1, 0x06, 0xc3, 0x40, 
+  0xf0, 0x00, 0x40, 0x01, 0x00, 0x18, 0x01, 0x02, 0xe0, 0x7e, 0xe4, 0xc3, 
+  0xa1, 0xc1, 0x08, 0x45, 0x2f, 0x27, 0x7f, 0x2a, 0x00, 0xa0, 0xaa, 0x20, 
+  0x90, 0x02, 0xab, 0x20, 0xd0, 0x02, 0xcb, 0x46, 0x32, 0x00, 0xf7, 0x04, 
+  0xaa, 0x20, 0x88, 0x01, 0x0f, 0x78, 0x14, 0x73, 0x0c, 0xf7, 0x00, 0x86, 
+  0xa5, 0x78, 0x00, 0xa6, 0x2f, 0x26, 0x7f, 0x3c, 0x00, 0x20, 0xc4, 0xc7, 
+  0x10, 0x00, 0xf0, 0x03, 0xee, 0x0f, 0xcf, 0xf6, 0x3d, 0x08, 0x70, 0x00, 
+  0x2f, 0x21, 0x48, 0x83, 0x00, 0x1c, 0x01, 0x30, 0x05, 0xf2, 0xf0, 0x00, 
+  0xd1, 0x9c, 0x7e, 0x09, 0xf0, 0x04, 0x25, 0x81, 0x9f, 0xff, 0x00, 0x00, 
+  0x00, 0x11, 0x12, 0x00, 0xf0, 0x0b, 0x80, 0x7e, 0x00, 0x80, 0x4c, 0x71, 
+  0x6c, 0x70, 0x0a, 0x0f, 0xef, 0xf6, 0x40, 0x24, 0x04, 0x30, 0x00, 0xc0, 
+  0x04, 0xe8, 0x82, 0x0f, 0x0f, 0xf8, 0xc4, 0xc7, 0x28, 0x00, 0xf3, 0x10, 
+  0x00, 0x0f, 0x00, 0x00, 0x04, 0xf2, 0x02, 0x86, 0xf0, 0xe8, 0x6c, 0x25, 
+  0xc1, 0x96, 0xf2, 0xf3, 0x01, 0x86, 0xea, 0xe8, 0xf0, 0xf1, 0xe2, 0xc2, 
+  0x92, 0x0f, 0xef, 0xf6, 0x08, 0x45, 0x2d, 0x60, 0x00, 0x0e, 0x5c, 0x00, 
+  0x17, 0x0b, 0x5c, 0x00, 0x20, 0x2e, 0x0e, 0x78, 0x01, 0x24, 0xc2, 0xc6, 
+  0x50, 0x00, 0x02, 0xf6, 0x00, 0x51, 0x03, 0xf2, 0x02, 0x82, 0xf2, 0x56, 
+  0x00, 0x80, 0xf4, 0xf3, 0x01, 0x82, 0xee, 0xe8, 0xf0, 0xf1, 0x28, 0x01, 
+  0xc0, 0x62, 0xb8, 0x39, 0x08, 0xf5, 0x00, 0xa1, 0xc1, 0x0f, 0x78, 0xf0, 
+  0x26, 0xba, 0x01, 0xa0, 0xd8, 0xd1, 0x07, 0xe9, 0x2c, 0x71, 0x4c, 0x73, 
+  0xea, 0x0d, 0x44, 0x00, 0x20, 0x0e, 0xf0, 0x0c, 0x00, 0x20, 0x6c, 0x70, 
+  0xa8, 0x00, 0x40, 0x5a, 0x0e, 0xef, 0xf6, 0xd8, 0x00, 0x00, 0xb0, 0x00, 
+  0x64, 0xd2, 0x0e, 0x0f, 0xf8, 0x87, 0x74, 0x6c, 0x01, 0x80, 0x9f, 0x20, 
+  0x02, 0x03, 0x00, 0x20, 0x81, 0x0f, 0xc2, 0x02, 0xb3, 0x00, 0x89, 0x05, 
+  0xe8, 0x0d, 0x78, 0x00, 0x19, 0xc3, 0x0f, 0x85, 0x7c, 0x01, 0xf0, 0x1b, 
+  0xe4, 0xc2, 0x08, 0x46, 0x12, 0x58, 0x08, 0x45, 0xa4, 0x16, 0x00, 0x11, 
+  0xb5, 0x70, 0xca, 0x25, 0x61, 0x10, 0xb1, 0x70, 0x0c, 0x70, 0x0a, 0xf2, 
+  0x56, 0x86, 0x05, 0xea, 0xb0, 0x78, 0x60, 0x7a, 0xc1, 0x41, 0x0c, 0x71, 
+  0xa4, 0x1e, 0x44, 0x13, 0xc4, 0xc6, 0x34, 0x03, 0x60, 0x8c, 0xdb, 0x0a, 
+  0x7b, 0x08, 0x45, 0xcc, 0x00, 0xe0, 0x24, 0x4a, 0x1f, 0x63, 0x00, 0x8f, 
+  0x28, 0x46, 0x50, 0x40, 0x35, 0xe9, 0xb2, 0xe8, 0x12, 0x00, 0xf0, 0x01, 
+  0x64, 0x41, 0x21, 0x8f, 0xb6, 0x78, 0x41, 0x80, 0xe0, 0x80, 0x8c, 0x21, 
+  0xc3, 0x8f, 0xcb, 0x44, 0x3c, 0x03, 0xf0, 0x09, 0x06, 0xf2, 0x78, 0x64, 
+  0x0a, 0x80, 0x45, 0x0e, 0x05, 0x10, 0x16, 0x6e, 0x41, 0x2e, 0x8b, 0x16, 
+  0x00, 0x27, 0x11, 0x90, 0x01, 0x22, 0xcf, 0x82, 0x22, 0x00, 0xf1, 0x12, 
+  0x10, 0xf2, 0x78, 0x64, 0x25, 0x80, 0x44, 0x80, 0x3b, 0x27, 0x40, 0x10, 
+  0x3d, 0x21, 0x82, 0x20, 0x30, 0x77, 0xca, 0x20, 0x81, 0x00, 0x8c, 0xe8, 
+  0x52, 0x0f, 0xef, 0xff, 0xa1, 0x40, 0xc1, 0x40, 0x22, 0xb4, 0x02, 0xd1, 
+  0x5a, 0x0c, 0xef, 0xff, 0x0a, 0x24, 0x00, 0x04, 0xca, 0xc6, 0x92, 0xe8, 
+  0x36, 0x1a, 0x00, 0x20, 0xa1, 0x40, 0xd2, 0x00, 0x00, 0x36, 0x01, 0xf5, 
+  0x01, 0xcc, 0x49, 0x2c, 0x70, 0x58, 0x60, 0x00, 0x1f, 0x43, 0x10, 0x25, 
+  0xa0, 0x24, 0xa0, 0x2a, 0xa0, 0x94, 0x03, 0x16, 0x08, 0x94, 0x03, 0xe0, 
+  0xe2, 0xc2, 0x59, 0x88, 0xc1, 0xba, 0x54, 0x72, 0x17, 0xf2, 0x2f, 0x27, 
+  0x7f, 0x03, 0x3c, 0x02, 0xf0, 0x0d, 0x50, 0x80, 0x04, 0x32, 0x40, 0x80, 
+  0x0d, 0xf2, 0x4c, 0x70, 0x04, 0x31, 0x80, 0x80, 0xc5, 0xf7, 0x30, 0xa0, 
+  0x0e, 0x18, 0x43, 0x00, 0x03, 0xf0, 0x13, 0x18, 0x43, 0x00, 0x8e, 0x03, 
+  0x55, 0x2f, 0x26, 0x7f, 0x03, 0xc2, 0x38, 0x00, 0x15, 0x11, 0x38, 0x00, 
+  0xd9, 0x4c, 0x10, 0x02, 0x01, 0x13, 0x0a, 0x40, 0x00, 0x4c, 0x18, 0x44, 
+  0x00, 0x0f, 0x2c, 0x00, 0xf0, 0x0b, 0xe6, 0xc3, 0xa4, 0xc1, 0x08, 0x45, 
+  0x19, 0x88, 0x28, 0x46, 0xc1, 0xb8, 0x14, 0x72, 0x27, 0xf2, 0x40, 0x24, 
+  0xc1, 0x33, 0x83, 0xc2, 0x40, 0x24, 0x83, 0x32, 0x9a, 0x01, 0xc1, 0x40, 
+  0x24, 0x05, 0x31, 0xa1, 0x40, 0x39, 0x58, 0x00, 0xc1, 0xc1, 0x40, 0x74, 
+  0x00, 0x50, 0x83, 0xca, 0x20, 0x45, 0x00, 0x7c, 0x00, 0x71, 0xca, 0x26, 
+  0x09, 0x10, 0x2f, 0x27, 0xff, 0x5e, 0x00, 0xf0, 0x01, 0x10, 0x85, 0x04, 
+  0x30, 0x80, 0x83, 0x07, 0xf2, 0x10, 0xd8, 0xd0, 0xa5, 0x0e, 0x1d, 0x43, 
+  0x10, 0x5c, 0x00, 0xf0, 0x05, 0xff, 0x03, 0xc6, 0xc7, 0xcb, 0x44, 0x13, 
+  0x00, 0x28, 0x91, 0x80, 0x84, 0x95, 0x70, 0xe0, 0x20, 0x02, 0x03, 0xe0, 
+  0x7e, 0x10, 0x00, 0x12, 0x24, 0x10, 0x00, 0xf0, 0x64, 0x7c, 0x00, 0x7c, 
+  0xe0, 0x78, 0xe8, 0xc2, 0xde, 0x0e, 0x0f, 0xf8, 0xcb, 0x45, 0x13, 0x00, 
+  0xf0, 0x90, 0x2a, 0x85, 0x10, 0x40, 0xda, 0x0e, 0x2f, 0xf8, 0x09, 0x69, 
+  0x4d, 0x08, 0x74, 0x02, 0x08, 0x46, 0x08, 0x85, 0xce, 0x0e, 0x2f, 0xf8, 
+  0x04, 0x77, 0xa6, 0x09, 0x6f, 0xed, 0x08, 0x47, 0x39, 0x0f, 0x75, 0x12, 
+  0x21, 0x6f, 0x55, 0x26, 0x83, 0x1f, 0x2f, 0x79, 0x40, 0x20, 0xc2, 0x20, 
+  0x6f, 0x7e, 0x08, 0x20, 0x40, 0x00, 0x4f, 0x7a, 0xd9, 0x60, 0x25, 0x0a, 
+  0x64, 0x00, 0x2c, 0x71, 0x0f, 0x78, 0xa2, 0x09, 0x6f, 0xed, 0xc1, 0x41, 
+  0x56, 0x0a, 0x6f, 0xed, 0xc1, 0x40, 0x3a, 0x09, 0x20, 0x01, 0x00, 0x85, 
+  0xc8, 0xc6, 0x2f, 0xd8, 0xce, 0x0d, 0x2f, 0xec, 0x2c, 0x71, 0xc6, 0x0d, 
+  0x2f, 0xec, 0x2d, 0xd8, 0x8c, 0x07, 0xc0, 0x13, 0x00, 0xec, 0x90, 0x19, 
+  0x02, 0x2f, 0xf5, 0x00, 0x80, 0xea, 0xc2, 0x78, 0x00, 0xf1, 0x2c, 0xf4, 
+  0x90, 0x00, 0x85, 0x21, 0x85, 0xe4, 0x85, 0xc5, 0x85, 0x02, 0x79, 0x26, 
+  0xb9, 0x1e, 0x21, 0x81, 0x0f, 0xaa, 0xaa, 0xab, 0xaa, 0x08, 0x15, 0x11, 
+  0x10, 0x0c, 0x15, 0x10, 0x10, 0x66, 0x0a, 0x2f, 0xf5, 0x2f, 0x79, 0x02, 
+  0x85, 0xf2, 0x4e, 0x02, 0x20, 0x41, 0x24, 0x27, 0xb9, 0x27, 0xba, 0x2f, 
+  0x79, 0xb2, 0x0a, 0x2f, 0xf5, 0x4f, 0x7a, 0xca, 0xc6, 0xe4, 0x40, 0x00, 
+  0xf3, 0x10, 0x0c, 0x91, 0x0e, 0x0f, 0x2f, 0xed, 0xc0, 0x85, 0x63, 0x85, 
+  0x42, 0x85, 0x00, 0x41, 0x64, 0x77, 0xc1, 0x40, 0xa5, 0x5a, 0xc4, 0xc6, 
+  0xf1, 0xc0, 0x5a, 0xd8, 0xab, 0x20, 0x08, 0x0e, 0x97, 0x34, 0x04, 0xf0, 
+  0x31, 0xe2, 0xc2, 0x08, 0x45, 0x00, 0x90, 0xd3, 0x70, 0x00, 0x00, 0x2b, 
+  0x66, 0x1c, 0xd8, 0x17, 0xf4, 0x5e, 0x85, 0x78, 0xd9, 0x52, 0x0a, 0x2f, 
+  0xea, 0xa1, 0x40, 0x14, 0x70, 0x1d, 0xd8, 0x0f, 0xf2, 0x4a, 0x24, 0x00, 
+  0x71, 0x0c, 0x70, 0x4c, 0x70, 0xa8, 0x20, 0x40, 0x02, 0x4f, 0x79, 0x15, 
+  0x25, 0x41, 0x10, 0x4b, 0x11, 0x01, 0x06, 0x04, 0xe9, 0x44, 0x71, 0xc2, 
+  0xc6, 0x1e, 0xd8, 0xc2, 0xc6, 0x40, 0x04, 0xf2, 0x03, 0x0f, 0x7d, 0x11, 
+  0x0d, 0xb5, 0x11, 0x0c, 0x73, 0x48, 0x25, 0x80, 0x10, 0x80, 0x20, 0x83, 
+  0x0f, 0xd3, 0x68, 0xf4, 0x04, 0xff, 0x1d, 0x84, 0x26, 0x1f, 0x1e, 0x1e, 
+  0x66, 0x2c, 0x77, 0x0c, 0x70, 0x80, 0xc2, 0xd2, 0x0c, 0xef, 0xf6, 0x20, 
+  0x43, 0x00, 0xc0, 0x79, 0xe8, 0x9e, 0x78, 0x41, 0x86, 0x20, 0x86, 0x04, 
+  0x1e, 0x01, 0x10, 0x00, 0x1e, 0x01, 0x10, 0xbe, 0x78, 0xa1, 0x40, 0x45, 
+  0x58, 0xef, 0xf1, 0x70, 0x06, 0x05, 0x1f, 0xa1, 0x70, 0x06, 0x00, 0x15, 
+  0xb5, 0x70, 0x06, 0x1f, 0x00, 0x01, 0x00, 0x26, 0xfc, 0x05, 0x20, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1f, 0x00, 
+  0x00, 0x00, 0xbd, 0x37, 0x86, 0x35, 0x24, 0x00, 0x0f, 0x14, 0x00, 0x15, 
+  0x00, 0x01, 0x00, 0x4f, 0x17, 0xb7, 0xd1, 0x38, 0x14, 0x00, 0x25, 0x00, 
+  0x01, 0x00, 0x84, 0xaa, 0x41, 0x32, 0x00, 0xac, 0xc5, 0xa7, 0x36, 0x04, 
+  0x00, 0x00, 0x14, 0x00, 0x44, 0xac, 0xc5, 0x27, 0x37, 0x04, 0x00, 0x00, 
+  0x10, 0x00, 0xc0, 0xd3, 0x02, 0xb7, 0x38, 0xa9, 0x68, 0x92, 0x37, 0xa9, 
+  0x68, 0x12, 0x37, 0xb8, 0x00, 0x57, 0x29, 0x00, 0x00, 0x00, 0x2c, 0xc8, 
+  0x00, 0x04, 0x10, 0x00, 0x08, 0x28, 0x00, 0xc8, 0xdb, 0x0f, 0x49, 0x40, 
+  0xf3, 0x66, 0xdf, 0x3e, 0xc2, 0xb8, 0xb2, 0x3d, 0x24, 0x00, 0x1f, 0x2d, 
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0xc4, 0x35, 0xfa, 0x0e, 0x3c, 0x88, 
+  0xc3, 0xe4, 0x3a, 0x88, 0xc3, 0x64, 0x3a, 0x20, 0x00, 0x80, 0x03, 0x00, 
+  0x00, 0x00, 0xf3, 0x66, 0x5f, 0x3f, 0x48, 0x00, 0x5b, 0x50, 0x77, 0x56, 
+  0x3e, 0x21, 0x3c, 0x01, 0x62, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x14, 
+  0x00, 0x04, 0x04, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x80, 0x3f, 0x9a, 0x99, 
+  0x19, 0x3e, 0x9a, 0x99, 0x99, 0x3d, 0x0a, 0xd7, 0xa3, 0x3c, 0x04, 0x00, 
+  0x00, 0x40, 0x01, 0x04, 0x04, 0x00, 0x45, 0x00, 0x24, 0xf4, 0x49, 0x04, 
+  0x00, 0x08, 0x01, 0x00, 0x16, 0x08, 0x0b, 0x00, 0x1b, 0x22, 0x6c, 0x00, 
+  0x08, 0x1c, 0x00, 0xc0, 0x0a, 0xd7, 0x23, 0x3d, 0x6f, 0x12, 0x83, 0x3b, 
+  0x6f, 0x12, 0x03, 0x3a, 0x58, 0x01, 0x84, 0xac, 0xc5, 0x27, 0x38, 0x95, 
+  0xbf, 0xd6, 0x32, 0x04, 0x00, 0x8e, 0xac, 0xc5, 0x27, 0x35, 0x00, 0x00, 
+  0x80, 0x3e, 0x6e, 0x01, 0x0f, 0x14, 0x00, 0x16, 0x32, 0x40, 0x00, 0x01, 
+  0xcf, 0x00, 0x04, 0x80, 0x00, 0x1f, 0x23, 0x94, 0x00, 0x00, 0x90, 0x50, 
+  0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x54, 0x94, 0x00, 0xf0, 0x41, 
+  0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xb8, 
+  0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x5c, 
+  0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x62, 
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x64, 
+  0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x68, 
+  0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6e, 
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x7e, 0x86, 0x00, 0xf1, 0x51, 
+  0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7a, 
+  0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x74, 
+  0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xe4, 
+  0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0xf8, 
+  0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x8a, 
+  0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x9e, 
+  0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0xa0, 
+  0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa6, 
+  0x98, 0x02, 0xf1, 0x02, 0x51, 0x39, 0x6f, 0x12, 0x03, 0x3b, 0x53, 0x05, 
+  0xa3, 0x3c, 0xb6, 0xf3, 0x3d, 0x3e, 0x6b, 0x00, 0x05, 0x02, 0x01, 0xf1, 
+  0x00, 0x68, 0x77, 0x13, 0x00, 0x7c, 0xd2, 0x11, 0x00, 0x78, 0x76, 0xa0, 
+  0x00, 0x77, 0x00, 0x04, 0xf8, 0x00, 0xd3, 0xd8, 0x76, 0x13, 0x00, 0xa4, 
+  0x45, 0x13, 0x00, 0x3c, 0x7d, 0xa0, 0x00, 0x79, 0x14, 0x00, 0x13, 0xe8, 
+  0x14, 0x00, 0x71, 0x64, 0x7d, 0xa0, 0x00, 0x69, 0x00, 0x04, 0x3c, 0x00, 
+  0x22, 0xf8, 0x76, 0x3c, 0x00, 0x53, 0x0c, 0x75, 0xa0, 0x00, 0x75, 0x28, 
+  0x00, 0x22, 0x08, 0x77, 0x28, 0x00, 0x62, 0x8c, 0x7d, 0xa0, 0x00, 0xbd, 
+  0x02, 0x28, 0x00, 0x13, 0x18, 0x64, 0x00, 0x53, 0x28, 0x75, 0xa0, 0x00, 
+  0xc1, 0x14, 0x00, 0x13, 0x38, 0x14, 0x00, 0x53, 0x44, 0x75, 0xa0, 0x00, 
+  0xc3, 0x14, 0x00, 0x13, 0x48, 0x14, 0x00, 0xf5, 0x10, 0x60, 0x75, 0xa0, 
+  0x00, 0x15, 0x00, 0x00, 0x00, 0x90, 0x6e, 0xa0, 0x00, 0x04, 0x01, 0x00, 
+  0x00, 0x28, 0x77, 0x13, 0x00, 0x2c, 0x75, 0x13, 0x00, 0xc0, 0x6e, 0xa0, 
+  0x00, 0x48, 0x22, 0x13, 0xbe, 0x01, 0xf7, 0x16, 0x4c, 0x66, 0x11, 0x00, 
+  0x34, 0x66, 0x11, 0x00, 0x04, 0x66, 0x11, 0x00, 0x40, 0x66, 0x11, 0x00, 
+  0x1c, 0x66, 0x11, 0x00, 0x10, 0x66, 0x11, 0x00, 0x28, 0x66, 0x11, 0x00, 
+  0xf8, 0x6f, 0xa0, 0x00, 0xb0, 0x94, 0xa0, 0x00, 0x18, 0x48, 0x00, 0x53, 
+  0x58, 0x77, 0x13, 0x00, 0x34, 0x48, 0x00, 0x26, 0xe0, 0x23, 0x48, 0x00, 
+  0xf4, 0x16, 0xec, 0x24, 0x13, 0x00, 0xdc, 0x24, 0x13, 0x00, 0xac, 0x24, 
+  0x13, 0x00, 0xe4, 0x24, 0x13, 0x00, 0xc4, 0x24, 0x13, 0x00, 0xbc, 0x24, 
+  0x13, 0x00, 0xd4, 0x24, 0x13, 0x00, 0x08, 0x70, 0xa0, 0x00, 0x10, 0x98, 
+  0xa0, 0x00, 0x2a, 0x48, 0x00, 0x92, 0x03, 0x00, 0x00, 0xac, 0x66, 0x13, 
+  0x00, 0x0c, 0x76, 0x48, 0x00, 0xf1, 0x22, 0xe8, 0x25, 0x13, 0x00, 0xc8, 
+  0x27, 0x13, 0x00, 0x60, 0x27, 0x13, 0x00, 0x34, 0x29, 0x13, 0x00, 0xb8, 
+  0x27, 0x13, 0x00, 0x38, 0x27, 0x13, 0x00, 0xc0, 0x27, 0x13, 0x00, 0x50, 
+  0x27, 0x13, 0x00, 0x48, 0x27, 0x13, 0x00, 0xb0, 0x27, 0x13, 0x00, 0x10, 
+  0x70, 0xa0, 0x00, 0x0c, 0x90, 0xa0, 0x00, 0x01, 0x6e, 0x03, 0x42, 0x00, 
+  0x00, 0xf4, 0x75, 0xec, 0x00, 0x53, 0x64, 0x74, 0xa0, 0x00, 0x03, 0x14, 
+  0x00, 0x13, 0x00, 0x50, 0x01, 0x62, 0xb8, 0x74, 0xa0, 0x00, 0x23, 0x03, 
+  0x14, 0x00, 0x13, 0x18, 0x14, 0x00, 0x53, 0x7c, 0x75, 0xa0, 0x00, 0x25, 
+  0x14, 0x00, 0x13, 0x24, 0x14, 0x00, 0x53, 0x98, 0x75, 0xa0, 0x00, 0x29, 
+  0x14, 0x00, 0x13, 0x30, 0x14, 0x00, 0x53, 0xb4, 0x75, 0xa0, 0x00, 0x05, 
+  0x50, 0x00, 0x13, 0x54, 0x14, 0x00, 0x71, 0x24, 0x76, 0xa0, 0x00, 0x7b, 
+  0x00, 0x03, 0xa0, 0x01, 0x13, 0x6c, 0xc8, 0x01, 0x53, 0xb4, 0x7d, 0xa0, 
+  0x00, 0x6d, 0x28, 0x00, 0x13, 0x84, 0x28, 0x00, 0x53, 0xb0, 0x76, 0xa0, 
+  0x00, 0x7d, 0x28, 0x00, 0x13, 0x9c, 0x28, 0x00, 0x53, 0xdc, 0x7d, 0xa0, 
+  0x00, 0x81, 0x14, 0x00, 0x13, 0xc0, 0x14, 0x00, 0x53, 0x04, 0x7e, 0xa0, 
+  0x00, 0x0c, 0x10, 0x01, 0x93, 0x03, 0x01, 0x00, 0x00, 0x3c, 0x76, 0x13, 
+  0x00, 0x3c, 0x58, 0x01, 0x26, 0x3c, 0x29, 0x58, 0x01, 0xf4, 0x16, 0xa4, 
+  0x2a, 0x13, 0x00, 0x94, 0x2a, 0x13, 0x00, 0x64, 0x2a, 0x13, 0x00, 0x9c, 
+  0x2a, 0x13, 0x00, 0x7c, 0x2a, 0x13, 0x00, 0x74, 0x2a, 0x13, 0x00, 0x8c, 
+  0x2a, 0x13, 0x00, 0x14, 0x70, 0xa0, 0x00, 0xb8, 0x93, 0xa0, 0x00, 0x06, 
+  0x48, 0x00, 0x83, 0x03, 0x00, 0x00, 0x78, 0x76, 0x13, 0x00, 0x60, 0x58, 
+  0x01, 0xf7, 0x22, 0xa8, 0x2d, 0x13, 0x00, 0xa0, 0x2e, 0x13, 0x00, 0x84, 
+  0x2e, 0x13, 0x00, 0xa4, 0x2e, 0x13, 0x00, 0x90, 0x2e, 0x13, 0x00, 0x5c, 
+  0x2e, 0x13, 0x00, 0x98, 0x2e, 0x13, 0x00, 0x74, 0x2e, 0x13, 0x00, 0x6c, 
+  0x2e, 0x13, 0x00, 0x88, 0x2e, 0x13, 0x00, 0x3c, 0x70, 0xa0, 0x00, 0x84, 
+  0x90, 0xa0, 0x00, 0x07, 0x48, 0x00, 0x53, 0xa8, 0x76, 0x13, 0x00, 0x90, 
+  0x48, 0x00, 0xf7, 0x22, 0xac, 0x2e, 0x13, 0x00, 0xac, 0x2f, 0x13, 0x00, 
+  0x90, 0x2f, 0x13, 0x00, 0xb0, 0x2f, 0x13, 0x00, 0x9c, 0x2f, 0x13, 0x00, 
+  0x68, 0x2f, 0x13, 0x00, 0xa4, 0x2f, 0x13, 0x00, 0x80, 0x2f, 0x13, 0x00, 
+  0x78, 0x2f, 0x13, 0x00, 0x94, 0x2f, 0x13, 0x00, 0x48, 0x70, 0xa0, 0x00, 
+  0xd0, 0x90, 0xa0, 0x00, 0x09, 0x48, 0x00, 0x53, 0xcc, 0x76, 0x13, 0x00, 
+  0xb4, 0x48, 0x00, 0xf1, 0x22, 0xb8, 0x2f, 0x13, 0x00, 0xa8, 0x30, 0x13, 
+  0x00, 0x8c, 0x30, 0x13, 0x00, 0xac, 0x30, 0x13, 0x00, 0x98, 0x30, 0x13, 
+  0x00, 0x64, 0x30, 0x13, 0x00, 0xa0, 0x30, 0x13, 0x00, 0x7c, 0x30, 0x13, 
+  0x00, 0x74, 0x30, 0x13, 0x00, 0x90, 0x30, 0x13, 0x00, 0x54, 0x70, 0xa0, 
+  0x00, 0x1c, 0x91, 0xa0, 0x00, 0xcb, 0x3e, 0x04, 0x33, 0x00, 0x00, 0x64, 
+  0xe8, 0x01, 0x62, 0x48, 0x74, 0xa0, 0x00, 0x2d, 0x01, 0x14, 0x00, 0x13, 
+  0x6c, 0x14, 0x00, 0x53, 0x80, 0x74, 0xa0, 0x00, 0x65, 0x28, 0x00, 0x13, 
+  0x84, 0x14, 0x00, 0x53, 0xd4, 0x74, 0xa0, 0x00, 0x67, 0x14, 0x00, 0x13, 
+  0x94, 0x14, 0x00, 0x53, 0xf0, 0x74, 0xa0, 0x00, 0x89, 0x14, 0x00, 0x13, 
+  0xcc, 0x14, 0x00, 0x53, 0x94, 0x76, 0xa0, 0x00, 0x87, 0x14, 0x00, 0x13, 
+  0xd4, 0x14, 0x00, 0x53, 0xcc, 0x76, 0xa0, 0x00, 0x71, 0x14, 0x00, 0x13, 
+  0xdc, 0x14, 0x00, 0x53, 0xe8, 0x76, 0xa0, 0x00, 0x85, 0x14, 0x00, 0x13, 
+  0xe4, 0x14, 0x00, 0x53, 0x04, 0x77, 0xa0, 0x00, 0x17, 0xe8, 0x00, 0x93, 
+  0x02, 0x01, 0x00, 0x00, 0xac, 0x75, 0x13, 0x00, 0x30, 0xc0, 0x01, 0x17, 
+  0x1c, 0x18, 0x03, 0xf0, 0x0a, 0xd8, 0x23, 0x13, 0x00, 0xc8, 0x23, 0x13, 
+  0x00, 0x98, 0x23, 0x13, 0x00, 0xd0, 0x23, 0x13, 0x00, 0xb0, 0x23, 0x13, 
+  0x00, 0xa8, 0x23, 0x13, 0x00, 0xc0, 0x24, 0x00, 0x84, 0x70, 0xa0, 0x00, 
+  0x64, 0x92, 0xa0, 0x00, 0x0d, 0x48, 0x00, 0x84, 0x02, 0x00, 0x00, 0xbc, 
+  0x75, 0x13, 0x00, 0xb4, 0x48, 0x00, 0x16, 0x2b, 0x48, 0x00, 0xf7, 0x16, 
+  0x54, 0x2c, 0x13, 0x00, 0x44, 0x2c, 0x13, 0x00, 0x14, 0x2c, 0x13, 0x00, 
+  0x4c, 0x2c, 0x13, 0x00, 0x2c, 0x2c, 0x13, 0x00, 0x24, 0x2c, 0x13, 0x00, 
+  0x3c, 0x2c, 0x13, 0x00, 0x20, 0x70, 0xa0, 0x00, 0xa8, 0x9a, 0xa0, 0x00, 
+  0x0e, 0x90, 0x00, 0x53, 0xc4, 0x75, 0x13, 0x00, 0x48, 0x48, 0x00, 0x26, 
+  0x5c, 0x2c, 0x48, 0x00, 0xf1, 0x14, 0x74, 0x2d, 0x13, 0x00, 0x64, 0x2d, 
+  0x13, 0x00, 0x34, 0x2d, 0x13, 0x00, 0x6c, 0x2d, 0x13, 0x00, 0x4c, 0x2d, 
+  0x13, 0x00, 0x44, 0x2d, 0x13, 0x00, 0x5c, 0x2d, 0x13, 0x00, 0x24, 0x70, 
+  0xa0, 0x00, 0x94, 0x9d, 0xa0, 0xec, 0x06, 0x04, 0x48, 0x00, 0x53, 0xec, 
+  0x75, 0x13, 0x00, 0x60, 0x48, 0x00, 0xf3, 0x32, 0xfc, 0x77, 0x11, 0x00, 
+  0x44, 0x31, 0x13, 0x00, 0x40, 0x31, 0x13, 0x00, 0x78, 0x79, 0x11, 0x00, 
+  0xec, 0x78, 0x11, 0x00, 0x94, 0x78, 0x11, 0x00, 0xf8, 0x78, 0x11, 0x00, 
+  0xac, 0x78, 0x11, 0x00, 0xa0, 0x78, 0x11, 0x00, 0xe0, 0x78, 0x11, 0x00, 
+  0x68, 0x70, 0xa0, 0x00, 0x24, 0x90, 0xa0, 0x00, 0xe8, 0x6c, 0x13, 0x00, 
+  0x54, 0x6d, 0x13, 0x00, 0x30, 0x6d, 0x13, 0x00, 0x0c, 0x6d, 0x13, 0x00, 
+  0xc9, 0xf6, 0x06, 0x13, 0x18, 0x44, 0x01, 0x53, 0x9c, 0x74, 0xa0, 0x00, 
+  0xd3, 0x14, 0x00, 0x13, 0x38, 0x14, 0x00, 0x53, 0xd0, 0x75, 0xa0, 0x00, 
+  0xdf, 0x14, 0x00, 0x13, 0x40, 0x14, 0x00, 0x53, 0xec, 0x75, 0xa0, 0x00, 
+  0xe7, 0x14, 0x00, 0x13, 0x44, 0x14, 0x00, 0x62, 0x08, 0x76, 0xa0, 0x00, 
+  0x31, 0x01, 0x14, 0x00, 0x13, 0x4c, 0x14, 0x00, 0x53, 0x40, 0x76, 0xa0, 
+  0x00, 0xdd, 0x28, 0x00, 0x13, 0x58, 0x14, 0x00, 0x50, 0x5c, 0x76, 0xa0, 
+  0x00, 0x27, 0x61, 0x03, 0x00, 0x60, 0x06, 0x03, 0x14, 0x00, 0xf1, 0x10, 
+  0x20, 0x77, 0xa0, 0x00, 0xa8, 0x73, 0x13, 0x00, 0x14, 0x65, 0x13, 0x00, 
+  0xb8, 0xec, 0x11, 0x00, 0xc4, 0xec, 0x11, 0x00, 0xa0, 0xec, 0x11, 0x00, 
+  0xb4, 0xec, 0x11, 0x00, 0xcc, 0x00, 0x00, 0xd6, 0x05, 0x20, 0xc8, 0x71, 
+  0xfe, 0x05, 0x46, 0x00, 0x00, 0x7c, 0x63, 0x24, 0x00, 0x08, 0x7b, 0x07, 
+  0x00, 0x74, 0x03, 0xae, 0x3c, 0x77, 0xa0, 0x00, 0x60, 0x73, 0x13, 0x00, 
+  0x8c, 0x61, 0x48, 0x00, 0x13, 0xe8, 0x48, 0x00, 0x13, 0xdc, 0x48, 0x00, 
+  0x17, 0x3c, 0x6c, 0x00, 0x05, 0x9c, 0x07, 0x03, 0x48, 0x00, 0x22, 0x5c, 
+  0x77, 0x24, 0x00, 0x1f, 0x04, 0x6c, 0x00, 0x00, 0x00, 0x76, 0x02, 0x00, 
+  0x24, 0x00, 0x13, 0x7c, 0x24, 0x00, 0x17, 0xa0, 0x6c, 0x00, 0x04, 0x01, 
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x13, 0x9c, 0x24, 0x00, 0x1f, 
+  0xa4, 0x48, 0x00, 0x00, 0x13, 0x1a, 0x24, 0x00, 0x13, 0xbc, 0x24, 0x00, 
+  0x1f, 0x50, 0x90, 0x00, 0x00, 0x00, 0x90, 0x07, 0x00, 0x24, 0x00, 0x13, 
+  0xdc, 0x24, 0x00, 0x1f, 0x18, 0x48, 0x00, 0x00, 0x13, 0x14, 0x24, 0x00, 
+  0x13, 0xfc, 0x24, 0x00, 0x1f, 0xb4, 0x90, 0x00, 0x00, 0x00, 0x30, 0x06, 
+  0x00, 0x24, 0x00, 0x79, 0x1c, 0x78, 0xa0, 0x00, 0xf0, 0x73, 0x13, 0xd8, 
+  0x00, 0x04, 0x20, 0x01, 0x13, 0xac, 0x20, 0x01, 0x79, 0xf0, 0x71, 0xa0, 
+  0x00, 0x38, 0x74, 0x13, 0x6c, 0x00, 0x04, 0x24, 0x00, 0x13, 0xae, 0x24, 
+  0x00, 0x9f, 0x04, 0x72, 0xa0, 0x00, 0x80, 0x74, 0x13, 0x00, 0x68, 0x24, 
+  0x00, 0x00, 0x13, 0xb0, 0x24, 0x00, 0x2f, 0x18, 0x72, 0xb0, 0x01, 0x07, 
+  0x14, 0x10, 0xb0, 0x01, 0x1f, 0x78, 0x68, 0x01, 0x07, 0x00, 0x3e, 0x07, 
+  0x01, 0x8c, 0x01, 0x03, 0x24, 0x00, 0x0f, 0x68, 0x01, 0x01, 0x14, 0x12, 
+  0x8c, 0x01, 0x03, 0x24, 0x00, 0x0f, 0x68, 0x01, 0x01, 0x14, 0x22, 0x8c, 
+  0x01, 0x03, 0x24, 0x00, 0x0f, 0x44, 0x01, 0x01, 0x14, 0x16, 0x8c, 0x01, 
+  0x03, 0x24, 0x00, 0x0f, 0x44, 0x01, 0x01, 0x14, 0x24, 0x8c, 0x01, 0x04, 
+  0xb4, 0x00, 0x1e, 0x62, 0x24, 0x00, 0x14, 0x4e, 0x8c, 0x01, 0x03, 0x24, 
+  0x00, 0x1f, 0xf0, 0x48, 0x00, 0x00, 0x14, 0x54, 0x8c, 0x01, 0x12, 0x79, 
+  0x24, 0x00, 0x1f, 0x2c, 0x90, 0x00, 0x00, 0x14, 0x3c, 0x20, 0x01, 0x03, 
+  0x24, 0x00, 0x1f, 0x40, 0x24, 0x00, 0x00, 0x14, 0x42, 0x20, 0x01, 0x03, 
+  0x24, 0x00, 0x1f, 0xb8, 0x24, 0x00, 0x00, 0x14, 0x34, 0x20, 0x01, 0x03, 
+  0x24, 0x00, 0x08, 0xb0, 0x01, 0x04, 0x01, 0x00, 0x14, 0x28, 0x20, 0x01, 
+  0x03, 0x24, 0x00, 0x1f, 0xdc, 0xb4, 0x00, 0x00, 0x14, 0x36, 0x20, 0x01, 
+  0x03, 0x24, 0x00, 0x1f, 0x54, 0x48, 0x00, 0x00, 0x14, 0x5a, 0x20, 0x01, 
+  0x03, 0x24, 0x00, 0x1f, 0x18, 0x20, 0x01, 0x00, 0x14, 0x48, 0x20, 0x01, 
+  0x5f, 0x79, 0xa0, 0x00, 0x2c, 0x62, 0xa8, 0x03, 0x03, 0x13, 0xee, 0x40, 
+  0x02, 0x22, 0x2c, 0x72, 0x24, 0x00, 0x2e, 0xec, 0x64, 0x24, 0x00, 0x22, 
+  0xbc, 0x01, 0x24, 0x00, 0x22, 0xd4, 0x6e, 0x24, 0x00, 0x2e, 0xe4, 0x66, 
+  0x24, 0x00, 0x13, 0xc2, 0x24, 0x00, 0x13, 0xe8, 0x24, 0x00, 0x1f, 0x64, 
+  0x5c, 0x04, 0x00, 0x13, 0x34, 0x24, 0x00, 0x6f, 0x40, 0x72, 0xa0, 0x00, 
+  0x8c, 0x65, 0x90, 0x00, 0x03, 0x13, 0xf0, 0x90, 0x00, 0x13, 0x54, 0x24, 
+  0x00, 0x1f, 0x90, 0xf4, 0x02, 0x00, 0x13, 0x1a, 0x48, 0x00, 0x5f, 0x68, 
+  0x72, 0xa0, 0x00, 0x74, 0xd8, 0x00, 0x04, 0x13, 0xf2, 0x48, 0x00, 0x13, 
+  0x7c, 0x24, 0x00, 0x1f, 0x00, 0x90, 0x00, 0x00, 0x13, 0x9a, 0x48, 0x00, 
+  0x22, 0xfc, 0x6e, 0x24, 0x00, 0x0f, 0x6c, 0x00, 0x01, 0x13, 0x1c, 0x24, 
+  0x00, 0x13, 0x90, 0x48, 0x00, 0x0f, 0xd8, 0x00, 0x01, 0x13, 0x32, 0x24, 
+  0x00, 0x13, 0xa4, 0x84, 0x03, 0x0f, 0xac, 0x02, 0x01, 0x14, 0x4a, 0x88, 
+  0x02, 0x1f, 0x7a, 0xac, 0x02, 0x07, 0x14, 0x50, 0x88, 0x02, 0x4f, 0x7a, 
+  0xa0, 0x00, 0xbc, 0xd8, 0x00, 0x04, 0x13, 0xf4, 0xd8, 0x00, 0x22, 0x10, 
+  0x6f, 0x24, 0x00, 0x08, 0x48, 0x00, 0x04, 0x24, 0x00, 0x13, 0x54, 0x90, 
+  0x00, 0x22, 0xb8, 0x72, 0x24, 0x00, 0x08, 0x90, 0x00, 0x04, 0x24, 0x00, 
+  0x13, 0x5a, 0x24, 0x00, 0x13, 0xcc, 0x24, 0x00, 0x08, 0x40, 0x02, 0x04, 
+  0x24, 0x00, 0x13, 0x58, 0x24, 0x00, 0x6f, 0xe0, 0x72, 0xa0, 0x00, 0xcc, 
+  0x63, 0x44, 0x01, 0x03, 0x13, 0x96, 0x24, 0x00, 0x13, 0xf4, 0x24, 0x00, 
+  0x2f, 0x0c, 0x67, 0xa4, 0x04, 0x00, 0x03, 0x24, 0x00, 0x22, 0x08, 0x73, 
+  0x24, 0x00, 0x1f, 0x28, 0x48, 0x00, 0x00, 0x13, 0xd0, 0xd8, 0x00, 0x6f, 
+  0x1c, 0x73, 0xa0, 0x00, 0xd4, 0x65, 0x88, 0x02, 0x03, 0x13, 0xba, 0x48, 
+  0x00, 0x6f, 0x30, 0x73, 0xa0, 0x00, 0x1c, 0x66, 0xb0, 0x01, 0x03, 0x13, 
+  0x1e, 0x24, 0x00, 0x13, 0x44, 0x48, 0x00, 0x1f, 0xc8, 0x20, 0x01, 0x00, 
+  0x13, 0xd6, 0x6c, 0x00, 0x13, 0x58, 0x48, 0x00, 0x0f, 0x24, 0x00, 0x01, 
+  0x13, 0xd8, 0x24, 0x00, 0x22, 0x6c, 0x73, 0xb0, 0x01, 0x1f, 0x78, 0x30, 
+  0x06, 0x00, 0x14, 0x2e, 0x14, 0x04, 0x03, 0xd4, 0x01, 0x0f, 0x14, 0x04, 
+  0x01, 0x14, 0x2c, 0x14, 0x04, 0x5f, 0x7a, 0xa0, 0x00, 0xc8, 0x74, 0x6c, 
+  0x00, 0x03, 0x13, 0xda, 0x6c, 0x00, 0x13, 0x80, 0x6c, 0x00, 0x0f, 0x38, 
+  0x04, 0x01, 0x14, 0x26, 0x38, 0x04, 0x03, 0x6c, 0x00, 0x0f, 0x38, 0x04, 
+  0x01, 0x14, 0x2a, 0x38, 0x04, 0x03, 0x24, 0x00, 0x0f, 0xec, 0x04, 0x01, 
+  0x14, 0x38, 0x38, 0x04, 0x03, 0x24, 0x00, 0x0f, 0xec, 0x04, 0x01, 0x14, 
+  0x3e, 0x38, 0x04, 0x03, 0x24, 0x00, 0x0f, 0x80, 0x04, 0x01, 0x14, 0x56, 
+  0xd0, 0x02, 0x1f, 0x7b, 0x80, 0x04, 0x07, 0x14, 0x44, 0xd0, 0x02, 0x8f, 
+  0x7b, 0xa0, 0x00, 0x14, 0x64, 0x13, 0x00, 0xbc, 0x38, 0x04, 0x00, 0x13, 
+  0x38, 0xb0, 0x01, 0x22, 0x94, 0x73, 0x24, 0x00, 0x08, 0x78, 0x06, 0x04, 
+  0x24, 0x00, 0x13, 0xdc, 0x20, 0x01, 0x13, 0xa8, 0x24, 0x00, 0x1f, 0x14, 
+  0x40, 0x02, 0x00, 0x13, 0xca, 0x24, 0x00, 0x9f, 0xbc, 0x73, 0xa0, 0x00, 
+  0x5c, 0x64, 0x13, 0x00, 0xd0, 0x6c, 0x00, 0x00, 0x13, 0x3a, 0x6c, 0x00, 
+  0x13, 0xd0, 0x24, 0x00, 0x08, 0x78, 0x06, 0x04, 0x24, 0x00, 0x13, 0xde, 
+  0x48, 0x00, 0x13, 0xe4, 0x24, 0x00, 0x0f, 0xac, 0x02, 0x01, 0x13, 0xce, 
+  0x24, 0x00, 0x9f, 0xf8, 0x73, 0xa0, 0x00, 0xa4, 0x64, 0x13, 0x00, 0x34, 
+  0xf4, 0x02, 0x00, 0x13, 0x3e, 0x6c, 0x00, 0x22, 0x0c, 0x74, 0x24, 0x00, 
+  0x08, 0xb0, 0x01, 0x04, 0x24, 0x00, 0x13, 0xe2, 0x48, 0x00, 0x13, 0x20, 
+  0x24, 0x00, 0x0f, 0x1c, 0x02, 0x01, 0x13, 0xd4, 0x24, 0x00, 0x9f, 0x34, 
+  0x74, 0xa0, 0x00, 0x64, 0x66, 0x13, 0x00, 0x20, 0x6c, 0x00, 0x00, 0x13, 
+  0x40, 0x6c, 0x00, 0x22, 0x24, 0x6f, 0x24, 0x00, 0x1f, 0xf8, 0xfc, 0x00, 
+  0x00, 0x13, 0x42, 0x24, 0x00, 0x22, 0x38, 0x6f, 0xb0, 0x01, 0x1f, 0x7c, 
+  0xd4, 0x01, 0x00, 0x14, 0x0c, 0xd0, 0x02, 0x03, 0xd4, 0x01, 0x1f, 0x3c, 
+  0xf4, 0x02, 0x00, 0x14, 0xb6, 0xd0, 0x02, 0x03, 0x24, 0x00, 0x08, 0xb0, 
+  0x01, 0x04, 0x01, 0x00, 0x14, 0x0e, 0xac, 0x02, 0x03, 0x24, 0x00, 0x1f, 
+  0xa4, 0x6c, 0x00, 0x00, 0x14, 0x1e, 0xac, 0x02, 0x03, 0x24, 0x00, 0x1f, 
+  0x50, 0x6c, 0x00, 0x00, 0x14, 0xb8, 0xac, 0x02, 0x03, 0x24, 0x00, 0x08, 
+  0xb0, 0x01, 0x04, 0x01, 0x00, 0x14, 0x20, 0xac, 0x02, 0x03, 0x24, 0x00, 
+  0x0f, 0x7c, 0x05, 0x01, 0x14, 0x4c, 0xac, 0x02, 0x1f, 0x7c, 0x7c, 0x05, 
+  0x07, 0x14, 0x52, 0xac, 0x02, 0x03, 0x24, 0x00, 0x0f, 0x3c, 0x03, 0x01, 
+  0x14, 0x3a, 0x20, 0x01, 0x03, 0x24, 0x00, 0x0f, 0x3c, 0x03, 0x01, 0x14, 
+  0x40, 0x20, 0x01, 0x03, 0x24, 0x00, 0x0f, 0x38, 0x04, 0x01, 0x14, 0xba, 
+  0x20, 0x01, 0x03, 0x24, 0x00, 0x0f, 0x38, 0x04, 0x01, 0x14, 0x30, 0x20, 
+  0x01, 0x03, 0x24, 0x00, 0x0f, 0xf0, 0x03, 0x01, 0x14, 0x32, 0x20, 0x01, 
+  0x03, 0x24, 0x00, 0x0f, 0xa8, 0x03, 0x01, 0x14, 0x58, 0x20, 0x01, 0x03, 
+  0x24, 0x00, 0x0f, 0xa8, 0x03, 0x01, 0x14, 0x46, 0x20, 0x01, 0x40, 0x7d, 
+  0xa0, 0x00, 0x10, 0xec, 0x06, 0xf6, 0x06, 0x6e, 0xa0, 0x00, 0x01, 0x01, 
+  0x00, 0x00, 0x14, 0x75, 0x13, 0x00, 0x10, 0x75, 0x13, 0x00, 0xc0, 0x6e, 
+  0xa0, 0x00, 0x80, 0x61, 0x30, 0x00, 0xf0, 0x0a, 0xfc, 0x61, 0x11, 0x00, 
+  0xe4, 0x61, 0x11, 0x00, 0xb4, 0x61, 0x11, 0x00, 0xf0, 0x61, 0x11, 0x00, 
+  0xcc, 0x61, 0x11, 0x00, 0xc0, 0x61, 0x11, 0x00, 0xd8, 0x14, 0x00, 0x84, 
+  0x6f, 0xa0, 0x00, 0x40, 0x93, 0xa0, 0x00, 0x0b, 0x48, 0x00, 0x83, 0x02, 
+  0x00, 0x00, 0x1c, 0x75, 0x13, 0x00, 0x74, 0x48, 0x00, 0x35, 0xf8, 0x17, 
+  0x13, 0x48, 0x00, 0xf7, 0x16, 0xc4, 0x18, 0x13, 0x00, 0xb4, 0x18, 0x13, 
+  0x00, 0x84, 0x18, 0x13, 0x00, 0xbc, 0x18, 0x13, 0x00, 0x9c, 0x18, 0x13, 
+  0x00, 0x94, 0x18, 0x13, 0x00, 0xac, 0x18, 0x13, 0x00, 0xc4, 0x6f, 0xa0, 
+  0x00, 0xe0, 0x95, 0xa0, 0x00, 0x01, 0x48, 0x00, 0x53, 0x20, 0x75, 0x13, 
+  0x00, 0x8c, 0x48, 0x00, 0x27, 0xbc, 0x63, 0x68, 0x04, 0xf7, 0x15, 0x64, 
+  0x11, 0x00, 0x2c, 0x64, 0x11, 0x00, 0xfc, 0x63, 0x11, 0x00, 0x38, 0x64, 
+  0x11, 0x00, 0x14, 0x64, 0x11, 0x00, 0x08, 0x64, 0x11, 0x00, 0x20, 0x64, 
+  0x11, 0x00, 0xcc, 0x6f, 0xa0, 0x00, 0x68, 0x91, 0xa0, 0x00, 0x02, 0x48, 
+  0x00, 0x53, 0x24, 0x75, 0x13, 0x00, 0x9c, 0x48, 0x00, 0x26, 0x50, 0x64, 
+  0x48, 0x00, 0x90, 0xd8, 0x64, 0x11, 0x00, 0xc0, 0x64, 0x11, 0x00, 0x90, 
+  0x38, 0x00, 0xf0, 0x01, 0x64, 0x11, 0x00, 0xa8, 0x64, 0x11, 0x00, 0x9c, 
+  0x64, 0x11, 0x00, 0xb4, 0x64, 0x11, 0x00, 0xdc, 0x70, 0x07, 0x47, 0x91, 
+  0xa0, 0x00, 0x03, 0x48, 0x00, 0x53, 0x28, 0x75, 0x13, 0x00, 0xa4, 0x48, 
+  0x00, 0x17, 0xe4, 0x48, 0x00, 0xf7, 0x16, 0x6c, 0x65, 0x11, 0x00, 0x54, 
+  0x65, 0x11, 0x00, 0x24, 0x65, 0x11, 0x00, 0x60, 0x65, 0x11, 0x00, 0x3c, 
+  0x65, 0x11, 0x00, 0x30, 0x65, 0x11, 0x00, 0x48, 0x65, 0x11, 0x00, 0xec, 
+  0x6f, 0xa0, 0x00, 0x10, 0x92, 0xa0, 0x00, 0x12, 0x68, 0x01, 0x53, 0x54, 
+  0x75, 0x13, 0x00, 0x50, 0x48, 0x00, 0x26, 0x64, 0x70, 0x48, 0x00, 0xf1, 
+  0x14, 0xe0, 0x70, 0x11, 0x00, 0xc8, 0x70, 0x11, 0x00, 0x98, 0x70, 0x11, 
+  0x00, 0xd4, 0x70, 0x11, 0x00, 0xb0, 0x70, 0x11, 0x00, 0xa4, 0x70, 0x11, 
+  0x00, 0xbc, 0x70, 0x11, 0x00, 0x2c, 0x70, 0xa0, 0x00, 0xd0, 0x92, 0xa0, 
+  0x94, 0x07, 0x10, 0x90, 0x14, 0x04, 0xf1, 0x03, 0x6f, 0x13, 0x00, 0x48, 
+  0x67, 0x13, 0x00, 0xb0, 0x68, 0x13, 0x00, 0xd4, 0x68, 0x13, 0x00, 0xf8, 
+  0x68, 0x13, 0xe8, 0x02, 0x00, 0x10, 0x03, 0x00, 0xf4, 0x01, 0x22, 0x24, 
+  0x70, 0x14, 0x05, 0x62, 0x80, 0x6b, 0x13, 0x00, 0x20, 0x71, 0x24, 0x04, 
+  0x22, 0x9c, 0x6d, 0xb0, 0x07, 0xa2, 0xbc, 0x6e, 0x13, 0x00, 0xfc, 0x70, 
+  0x13, 0x00, 0x90, 0x70, 0xcc, 0x04, 0xe2, 0xe4, 0x6d, 0x13, 0x00, 0x5c, 
+  0x6b, 0x13, 0x00, 0x78, 0x6d, 0x13, 0x00, 0x34, 0x6c, 0xb8, 0x05, 0x00, 
+  0x90, 0x07, 0x00, 0x9a, 0x00, 0x22, 0x7c, 0x77, 0x68, 0x00, 0x22, 0x00, 
+  0x70, 0x88, 0x05, 0x00, 0x00, 0x04, 0x62, 0xc0, 0x6d, 0x13, 0x00, 0x6c, 
+  0x70, 0x2c, 0x05, 0x00, 0xa4, 0x03, 0x00, 0xc8, 0x04, 0x00, 0xb0, 0x02, 
+  0x50, 0xec, 0x6b, 0x13, 0x00, 0xc8, 0x70, 0x00, 0x00, 0x54, 0x00, 0x52, 
+  0x66, 0x13, 0x00, 0x2c, 0x6e, 0x5c, 0x00, 0xf0, 0x02, 0x50, 0x6e, 0x13, 
+  0x00, 0x08, 0x6e, 0x13, 0x00, 0xb4, 0x67, 0x13, 0x00, 0x68, 0x71, 0x13, 
+  0x00, 0x44, 0xb4, 0x00, 0xf2, 0x02, 0x71, 0x13, 0x00, 0xa4, 0x6b, 0x13, 
+  0x00, 0x7c, 0x6c, 0x13, 0x00, 0x74, 0x6e, 0x13, 0x00, 0xac, 0x72, 0x94, 
+  0x00, 0x00, 0xac, 0x00, 0x00, 0xd4, 0x00, 0x62, 0xd8, 0x67, 0x13, 0x00, 
+  0x40, 0x69, 0xdc, 0x00, 0x71, 0x68, 0x68, 0x13, 0x00, 0xac, 0x69, 0x13, 
+  0xa4, 0x03, 0x00, 0x84, 0x03, 0x00, 0xf8, 0x02, 0xf2, 0x13, 0x28, 0x6f, 
+  0x13, 0x00, 0x64, 0x72, 0x13, 0x00, 0x3c, 0x6a, 0x13, 0x00, 0x4c, 0x6f, 
+  0x13, 0x00, 0x88, 0x72, 0x13, 0x00, 0x60, 0x6a, 0x13, 0x00, 0x70, 0x6f, 
+  0x13, 0x00, 0x18, 0x73, 0x13, 0x00, 0xf0, 0x6a, 0xa8, 0x00, 0x00, 0xd4, 
+  0x00, 0x00, 0xf8, 0x00, 0x31, 0x04, 0x63, 0x13, 0x68, 0x07, 0x22, 0x18, 
+  0x63, 0x2c, 0x01, 0xb1, 0xe0, 0x6e, 0x13, 0x00, 0xa8, 0x6a, 0x13, 0x00, 
+  0x8c, 0x61, 0x13, 0x1c, 0x05, 0x00, 0xfc, 0x04, 0xa2, 0x6c, 0x67, 0x13, 
+  0x00, 0x44, 0x71, 0x13, 0x00, 0x1c, 0x69, 0xf0, 0x00, 0x22, 0xdc, 0x6f, 
+  0x68, 0x01, 0x00, 0xbc, 0x00, 0x00, 0xdc, 0x00, 0x71, 0x58, 0x6c, 0x13, 
+  0x00, 0x90, 0x63, 0x13, 0xe0, 0x04, 0x00, 0xc0, 0x04, 0xa2, 0x20, 0x68, 
+  0x13, 0x00, 0xb0, 0x71, 0x13, 0x00, 0x88, 0x69, 0x10, 0x01, 0x22, 0x48, 
+  0x70, 0x78, 0x01, 0x10, 0x64, 0x04, 0x04, 0x21, 0x63, 0x13, 0x0c, 0x04, 
+  0xf3, 0x02, 0x98, 0x6e, 0x13, 0x00, 0xd0, 0x72, 0x13, 0x00, 0x84, 0x6a, 
+  0x13, 0x00, 0xd8, 0x70, 0x13, 0x00, 0xb4, 0x78, 0x01, 0x00, 0x5c, 0x00, 
+  0xa2, 0xfc, 0x67, 0x13, 0x00, 0x8c, 0x71, 0x13, 0x00, 0x64, 0x69, 0x3c, 
+  0x00, 0x10, 0x8c, 0xc8, 0x01, 0x52, 0x71, 0x13, 0x00, 0xd0, 0x69, 0xa4, 
+  0x01, 0x00, 0x40, 0x01, 0x00, 0x3c, 0x01, 0x04, 0x38, 0x00, 0xf2, 0x0f, 
+  0x04, 0x6f, 0x13, 0x00, 0xf4, 0x72, 0x13, 0x00, 0xcc, 0x6a, 0x13, 0x00, 
+  0x0c, 0x6d, 0x13, 0x00, 0xc4, 0x6c, 0x13, 0x00, 0x40, 0x72, 0x13, 0x00, 
+  0x18, 0x6a, 0x13, 0x00, 0x38, 0x6b, 0x50, 0x01, 0x00, 0xc8, 0x01, 0x00, 
+  0xf4, 0x01, 0xf3, 0x0e, 0x30, 0x6d, 0x13, 0x00, 0xa0, 0x6c, 0x13, 0x00, 
+  0x1c, 0x72, 0x13, 0x00, 0xf4, 0x69, 0x13, 0x00, 0x54, 0x6d, 0x13, 0x00, 
+  0x94, 0x6f, 0x13, 0x00, 0x3c, 0x73, 0x13, 0x00, 0x14, 0xcc, 0x00, 0x22, 
+  0x10, 0x6c, 0x80, 0x01, 0x00, 0xf4, 0x01, 0x00, 0x54, 0x02, 0x00, 0x44, 
+  0x00, 0x00, 0xc0, 0x01, 0x00, 0x18, 0x00, 0xf1, 0x0c, 0xe8, 0x6c, 0x13, 
+  0x00, 0xf0, 0x73, 0x13, 0x00, 0x80, 0x74, 0x13, 0x00, 0x38, 0x74, 0x13, 
+  0x00, 0xc8, 0x74, 0x13, 0x00, 0xa8, 0x73, 0x13, 0x00, 0xd4, 0x65, 0x13, 
+  0x94, 0x07, 0x71, 0x60, 0x73, 0x13, 0x00, 0xcc, 0x63, 0x13, 0x34, 0x07, 
+  0x31, 0x1c, 0x66, 0x13, 0x88, 0x06, 0x00, 0xd4, 0x06, 0xe6, 0x2c, 0x62, 
+  0x13, 0x00, 0x8c, 0x65, 0x13, 0x00, 0x74, 0x62, 0x13, 0x00, 0xbc, 0x62, 
+  0xc8, 0x01, 0x08, 0xec, 0x00, 0x04, 0x7c, 0x01, 0x08, 0xd0, 0x00, 0x04, 
+  0xe4, 0x01, 0x08, 0x04, 0x01, 0x08, 0x90, 0x01, 0x08, 0x6c, 0x01, 0x04, 
+  0x48, 0x02, 0x08, 0x5c, 0x01, 0x04, 0x44, 0x02, 0x04, 0x5c, 0x02, 0x08, 
+  0x1c, 0x01, 0x08, 0x08, 0x01, 0x08, 0x04, 0x01, 0x0f, 0x44, 0x02, 0x11, 
+  0xf0, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x43, 0x61, 0x6c, 
+  0x69, 0x62, 0x42, 0x53, 0x58, 0x00, 0x4e, 0x56, 0x69, 0x72, 0x74, 0x00, 
+  0x53, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0xb4, 0x03, 0x00, 0x20, 0x04, 0x00, 
+  0x24, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x54, 0x05, 0xf0, 0x21, 0x07, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x67, 0x17, 0x00, 0x48, 0x6f, 
+  0x73, 0x74, 0x00, 0xa9, 0x1a, 0xa1, 0xab, 0x55, 0x17, 0x48, 0x65, 0x6c, 
+  0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21, 0x00, 0x50, 0x61, 
+  0x72, 0x61, 0x6d, 0x20, 0x25, 0x75, 0x20, 0x6c, 0x65, 0x6e, 0x07, 0x00, 
+  0xf0, 0x17, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x25, 0x6c, 0x6c, 0x75, 0x2e, 
+  0x20, 0x20, 0x00, 0x25, 0x64, 0x2e, 0x20, 0x54, 0x65, 0x73, 0x74, 0x69, 
+  0x6e, 0x67, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x20, 0x62, 0x75, 
+  0x66, 0x66, 0x65, 0x72, 0x11, 0x00, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 
+  0x25, 0x28, 0x00, 0xf1, 0x29, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 
+  0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 
+  0x20, 0x6a, 0x75, 0x6d, 0x70, 0x65, 0x64, 0x20, 0x6f, 0x76, 0x65, 0x72, 
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 
+  0x67, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+  0x61, 0x44, 0x00, 0x33, 0x2c, 0x20, 0x74, 0x10, 0x00, 0x43, 0x6f, 0x6e, 
+  0x6c, 0x79, 0x15, 0x00, 0xf1, 0x13, 0x2e, 0x20, 0x20, 0x45, 0x20, 0x70, 
+  0x6c, 0x75, 0x72, 0x69, 0x62, 0x75, 0x73, 0x20, 0x75, 0x6e, 0x75, 0x6d, 
+  0x2e, 0x20, 0x20, 0x43, 0x6f, 0x67, 0x69, 0x74, 0x6f, 0x20, 0x65, 0x72, 
+  0x67, 0x6f, 0x20, 0x73, 0x12, 0x00, 0x91, 0x56, 0x69, 0x6e, 0x69, 0x2c, 
+  0x20, 0x76, 0x69, 0x64, 0x06, 0x00, 0x80, 0x63, 0x69, 0x2e, 0x00, 0x49, 
+  0x64, 0x6c, 0x65, 0x0c, 0x01, 0x43, 0x65, 0x78, 0x70, 0x66, 0xcb, 0x04, 
+  0xf4, 0x09, 0x3f, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x71, 0x31, 0x3f, 0x80, 
+  0x71, 0x31, 0xbf, 0xd1, 0xf7, 0x17, 0x37, 0xd1, 0xf7, 0x17, 0xb7, 0x6c, 
+  0x6f, 0x67, 0x20, 0x00, 0x01, 0x01, 0x00, 0xf8, 0x21, 0x42, 0xce, 0x02, 
+  0x00, 0xeb, 0x3c, 0xeb, 0xae, 0x1f, 0xa4, 0xe4, 0xa1, 0xaf, 0x7b, 0x98, 
+  0x7f, 0x6b, 0xc8, 0x8e, 0x6d, 0x7b, 0x9d, 0xc1, 0x98, 0x02, 0x32, 0x96, 
+  0x89, 0x48, 0xa4, 0x10, 0xcd, 0x17, 0xce, 0xb8, 0x3c, 0x4d, 0x12, 0x4f, 
+  0x2b, 0x32, 0x11, 0xc0, 0x3a, 0x42, 0x15, 0x29, 0xea, 0x3c, 0x00, 0x0f, 
+  0x01, 0x00, 0x3d, 0x66, 0xd4, 0x79, 0x13, 0x00, 0xd8, 0x79, 0xac, 0x06, 
+  0x0f, 0x01, 0x00, 0x0d, 0x00, 0x2c, 0x00, 0x1f, 0xdc, 0x30, 0x00, 0x08, 
+  0xf0, 0x07, 0xc3, 0x40, 0x12, 0x00, 0x00, 0x40, 0x6b, 0x20, 0x40, 0x09, 
+  0x0a, 0x22, 0x80, 0x8f, 0x10, 0x00, 0x84, 0x2b, 0xe2, 0x20, 0x82, 0x00, 
+  0x0c, 0x00, 0x40, 0x13, 0x00, 0x18, 0x7b, 0x0c, 0x00, 0xe1, 0x56, 0x08, 
+  0x00, 0x00, 0xdb, 0x44, 0xa0, 0x00, 0x20, 0x5c, 0xab, 0x24, 0x09, 0x39, 
+  0x0a, 0x00, 0xf1, 0x1b, 0x6c, 0xab, 0x24, 0x49, 0x39, 0xc6, 0x08, 0x0f, 
+  0xfe, 0x6a, 0x20, 0x80, 0x02, 0x8e, 0xb8, 0x29, 0x20, 0x00, 0x80, 0xdb, 
+  0x42, 0xa0, 0x00, 0x1c, 0x5c, 0x6f, 0x70, 0x22, 0x20, 0x80, 0x0f, 0x13, 
+  0x00, 0xb8, 0x7d, 0xdd, 0x01, 0x8f, 0xe5, 0x9c, 0x84, 0x13, 0x60, 0x00, 
+  0x40, 0x80, 0x4b, 0xd3, 0x70, 0x06, 0x00, 0xf2, 0x39, 0xe0, 0x7c, 0xab, 
+  0x20, 0x8a, 0x04, 0xe0, 0x7e, 0xfa, 0xc3, 0xae, 0xc1, 0xcb, 0x46, 0xf0, 
+  0x00, 0x34, 0x00, 0x0c, 0x70, 0x14, 0xae, 0x16, 0xae, 0x15, 0xae, 0x00, 
+  0x16, 0x0d, 0x70, 0xa0, 0x00, 0xd8, 0x5e, 0x0a, 0xd8, 0x4c, 0x74, 0x40, 
+  0x25, 0x8f, 0x12, 0x7e, 0x0c, 0x2f, 0xeb, 0xe1, 0x41, 0x08, 0x8d, 0x27, 
+  0x8d, 0x08, 0xb8, 0x25, 0x78, 0x10, 0xb8, 0x35, 0xb8, 0x8c, 0x20, 0x8f, 
+  0x83, 0xcc, 0x20, 0x82, 0x8f, 0x00, 0x00, 0xea, 0x05, 0x08, 0x00, 0x22, 
+  0xd5, 0x07, 0x08, 0x00, 0xf0, 0xff, 0xff, 0x35, 0xdd, 0x07, 0x07, 0xf2, 
+  0x01, 0x8e, 0x6c, 0x20, 0x40, 0x01, 0x45, 0x20, 0xc0, 0x00, 0x01, 0xae, 
+  0x66, 0x15, 0x80, 0x10, 0x06, 0xe8, 0x00, 0x1e, 0x02, 0x70, 0xf0, 0x00, 
+  0x06, 0x01, 0x66, 0x0d, 0xef, 0xfe, 0x80, 0xc0, 0x00, 0x17, 0xc0, 0x10, 
+  0x14, 0x70, 0xc2, 0x01, 0x2b, 0x00, 0x54, 0x25, 0xc0, 0x1c, 0xe6, 0x0b, 
+  0x2f, 0xeb, 0x1a, 0xd9, 0x2d, 0x8d, 0x38, 0x20, 0x42, 0x00, 0x30, 0x70, 
+  0x6d, 0xc1, 0x35, 0x1c, 0x82, 0x30, 0xd3, 0xf4, 0x70, 0x15, 0x83, 0x10, 
+  0x74, 0x15, 0x81, 0x10, 0x73, 0x15, 0x8c, 0x10, 0x75, 0x15, 0x82, 0x10, 
+  0x68, 0x15, 0x93, 0x10, 0x72, 0x15, 0x8e, 0x10, 0x67, 0x15, 0x97, 0x10, 
+  0x77, 0x15, 0x90, 0x10, 0x76, 0x15, 0x92, 0x10, 0x78, 0x15, 0x8f, 0x10, 
+  0x7b, 0x15, 0x9e, 0x10, 0x71, 0x15, 0x80, 0x10, 0x7a, 0x15, 0x9f, 0x10, 
+  0x7e, 0x15, 0x89, 0x10, 0x6e, 0x15, 0x84, 0x10, 0x6f, 0x15, 0x96, 0x10, 
+  0x79, 0x15, 0x91, 0x10, 0x7d, 0x15, 0x85, 0x10, 0x7c, 0x15, 0x87, 0x10, 
+  0x40, 0x2b, 0x0b, 0x01, 0x40, 0x29, 0x14, 0x03, 0x40, 0x2c, 0x15, 0x11, 
+  0x40, 0x2a, 0x0d, 0x02, 0x40, 0x2b, 0x03, 0x21, 0x08, 0xbe, 0x40, 0x2f, 
+  0x17, 0x22, 0x40, 0x28, 0x0c, 0x23, 0x40, 0x2a, 0x02, 0x21, 0x08, 0xbf, 
+  0x40, 0x2e, 0x1e, 0x32, 0x05, 0x24, 0x54, 0x25, 0x05, 0x25, 0x55, 0x10, 
+  0x6f, 0x7d, 0x40, 0x28, 0x08, 0x03, 0x40, 0x29, 0x09, 0x12, 0xc5, 0x78, 
+  0x85, 0x7a, 0x05, 0x27, 0x0c, 0x14, 0x05, 0x26, 0xce, 0x37, 0x05, 0x25, 
+  0xcd, 0x15, 0x05, 0x20, 0xc8, 0x12, 0x05, 0x21, 0x4b, 0x11, 0x0e, 0x7f, 
+  0x4e, 0x7a, 0x8e, 0x7c, 0xce, 0x78, 0xae, 0x7d, 0x2f, 0x26, 0xc6, 0x12, 
+  0x42, 0x2a, 0x0b, 0x01, 0x5c, 0x6c, 0x9c, 0x68, 0x1c, 0x6d, 0x48, 0x30, 
+  0x80, 0x00, 0x00, 0x30, 0x80, 0x0f, 0x75, 0x37, 0x8f, 0xc2, 0xdb, 0x41, 
+  0x80, 0x3f, 0x00, 0x00, 0x01, 0x30, 0x40, 0x06, 0x40, 0x2e, 0x16, 0x22, 
+  0x07, 0x31, 0x00, 0x30, 0x40, 0x2f, 0x13, 0x33, 0x40, 0x29, 0x12, 0x21, 
+  0x40, 0x2d, 0x11, 0x03, 0x40, 0x2f, 0x07, 0x01, 0x05, 0x24, 0x84, 0x05, 
+  0x05, 0x22, 0xc1, 0x24, 0x05, 0x27, 0x43, 0x04, 0x2f, 0x27, 0x06, 0x01, 
+  0xc3, 0x46, 0x00, 0xb8, 0x00, 0x00, 0x2f, 0x26, 0x06, 0x32, 0x2f, 0x20, 
+  0x06, 0x15, 0x2f, 0x21, 0x46, 0x15, 0x2e, 0x79, 0x6e, 0x7b, 0x42, 0x2f, 
+  0x07, 0x01, 0x50, 0x26, 0xd8, 0x07, 0x42, 0x2e, 0x1e, 0x31, 0x44, 0xbf, 
+  0x42, 0x28, 0x08, 0x11, 0x42, 0x29, 0x09, 0x11, 0x44, 0xb9, 0x44, 0xbb, 
+  0x44, 0xbe, 0x48, 0x37, 0x9f, 0x00, 0x48, 0x36, 0x91, 0x30, 0x48, 0x37, 
+  0x90, 0x10, 0x48, 0x30, 0x88, 0x10, 0x48, 0x31, 0x8f, 0x10, 0x48, 0x33, 
+  0x9e, 0x10, 0x48, 0x32, 0x85, 0x00, 0x48, 0x31, 0x84, 0x00, 0x48, 0x34, 
+  0x82, 0x10, 0x48, 0x33, 0x81, 0x00, 0x48, 0x36, 0x92, 0x10, 0x00, 0x37, 
+  0x0c, 0x36, 0x00, 0x31, 0x87, 0x21, 0x00, 0x30, 0x89, 0x21, 0x00, 0x30, 
+  0x08, 0x16, 0x00, 0x37, 0x0b, 0x16, 0x00, 0x36, 0x8f, 0x31, 0x00, 0x35, 
+  0x8e, 0x01, 0x00, 0x34, 0x8d, 0x01, 0x00, 0x32, 0x83, 0x01, 0x00, 0x31, 
+  0x02, 0x06, 0x00, 0x32, 0x01, 0x26, 0x42, 0xc4, 0x52, 0x24, 0xcc, 0x17, 
+  0x14, 0x1c, 0xc0, 0x31, 0x0c, 0x1c, 0x40, 0x32, 0x04, 0x1c, 0x00, 0x32, 
+  0x10, 0x1c, 0xc0, 0x32, 0x48, 0xc7, 0x46, 0xc6, 0x4b, 0xc5, 0x49, 0xc3, 
+  0x47, 0xc2, 0x4a, 0xc1, 0x40, 0xc4, 0x4c, 0xc0, 0xc3, 0x40, 0xa1, 0x00, 
+  0xff, 0x7f, 0x0a, 0x0e, 0x0f, 0xf7, 0x41, 0x08, 0x74, 0x02, 0x08, 0x45, 
+  0xf6, 0x0d, 0x0f, 0xf7, 0x68, 0xbd, 0x08, 0x46, 0xda, 0x08, 0x6f, 0xec, 
+  0xaf, 0x7d, 0x23, 0x6e, 0xb8, 0x60, 0x2f, 0x79, 0x2b, 0x09, 0x24, 0x00, 
+  0x2d, 0xd8, 0xc6, 0x08, 0x4f, 0xec, 0xe6, 0x08, 0x6f, 0xec, 0xa1, 0x41, 
+  0x9a, 0x09, 0x6f, 0xec, 0xa1, 0x40, 0x80, 0xc1, 0xc3, 0x40, 0x13, 0x00, 
+  0x34, 0x5e, 0xba, 0x0b, 0xaf, 0xe5, 0x38, 0xda, 0xda, 0xc7, 0x2f, 0xd8, 
+  0x0a, 0x0d, 0x2f, 0xeb, 0x2c, 0x71, 0xf1, 0xc0, 0xcb, 0x44, 0x8a, 0x02, 
+  0xf0, 0x21, 0x22, 0x94, 0xc3, 0x40, 0x00, 0x00, 0x2e, 0x14, 0x10, 0x78, 
+  0x4f, 0x09, 0x21, 0x00, 0x1a, 0xd8, 0xc3, 0x40, 0xa0, 0x00, 0xf8, 0x7f, 
+  0xc3, 0x41, 0xa1, 0x00, 0xfc, 0x11, 0x12, 0x49, 0xc3, 0x43, 0x00, 0x00, 
+  0x4c, 0x09, 0x0d, 0x0a, 0x72, 0x00, 0x63, 0xb4, 0xbe, 0x09, 0xaf, 0xf3, 
+  0x2c, 0x70, 0x4e, 0x00, 0x40, 0x00, 0x87, 0x2a, 0x08, 0x42, 0x03, 0x01, 
+  0x60, 0x05, 0xf2, 0xb8, 0xe8, 0xee, 0x0e, 0x4f, 0xe5, 0x00, 0x1e, 0x01, 
+  0x70, 0xf0, 0x00, 0x44, 0x02, 0x92, 0x0e, 0x00, 0x00, 0xd1, 0xc0, 0xe0, 
+  0x7e, 0xa6, 0x0c, 0x2f, 0xeb, 0x2c, 0x70, 0xe8, 0xc3, 0xa1, 0xc1, 0x08, 
+  0x45, 0x07, 0xe8, 0x86, 0x0c, 0x6f, 0xe5, 0xa1, 0x40, 0x05, 0xe8, 0xc8, 
+  0xc7, 0x0c, 0x70, 0xc8, 0xc7, 0x03, 0x8d, 0x0d, 0x08, 0xf4, 0x00, 0x40, 
+  0x25, 0x0f, 0x12, 0xc1, 0x85, 0x12, 0xf0, 0xe4, 0x6d, 0xcb, 0x46, 0x10, 
+  0x00, 0xcc, 0x2a, 0x0c, 0xf0, 0x04, 0x6f, 0xe4, 0x68, 0x0a, 0xf0, 0x4e, 
+  0x20, 0x02, 0x20, 0x2c, 0x70, 0x52, 0x09, 0xaf, 0xf3, 0x81, 0x40, 0x40, 
+  0x27, 0x0f, 0x12, 0x01, 0x87, 0x80, 0x87, 0x14, 0x70, 0x10, 0x40, 0x0e, 
+  0xf2, 0xf4, 0xf6, 0x18, 0x4f, 0x80, 0xc3, 0x81, 0x42, 0x60, 0x7e, 0x02, 
+  0x41, 0x40, 0x20, 0xc0, 0x20, 0x6c, 0x20, 0x40, 0x00, 0x1f, 0x67, 0x08, 
+  0xe7, 0xf0, 0xf1, 0xe3, 0xec, 0xc3, 0x43, 0xd0, 0xba, 0xad, 0x0b, 0xc3, 
+  0x42, 0xad, 0x0b, 0xd0, 0xba, 0xc3, 0x41, 0x00, 0x00, 0x0b, 0x0a, 0x0c, 
+  0x70, 0x60, 0xa7, 0x41, 0xa7, 0x02, 0x1d, 0x43, 0x13, 0x20, 0xb5, 0xc8, 
+  0xc7, 0xe0, 0x78, 0xe6, 0xc2, 0x0c, 0x71, 0xa6, 0x5a, 0xcb, 0x45, 0xa0, 
+  0x00, 0xb4, 0x7e, 0x02, 0xa5, 0x0c, 0x71, 0xa7, 0x5a, 0x04, 0xa5, 0x0c, 
+  0x71, 0xc3, 0x41, 0x12, 0x00, 0xe4, 0x55, 0xae, 0x5a, 0x08, 0x46, 0x0c, 
+  0x00, 0xe0, 0xd8, 0x56, 0xaf, 0x5a, 0x08, 0x47, 0x0c, 0x73, 0xa6, 0x5a, 
+  0x03, 0xa5, 0x0c, 0x73, 0x12, 0x00, 0xf0, 0x07, 0xbc, 0x55, 0xae, 0x5a, 
+  0x00, 0x41, 0x0c, 0x70, 0x04, 0xee, 0x04, 0xef, 0x79, 0x21, 0x00, 0x00, 
+  0xc6, 0xc6, 0xe0, 0x78, 0xf1, 0xc0, 0xde, 0x03, 0xf0, 0x09, 0x58, 0x57, 
+  0xac, 0x5a, 0xc3, 0x41, 0xa0, 0x00, 0xcc, 0x7e, 0xd1, 0xc0, 0xe0, 0x7f, 
+  0x00, 0xa1, 0xe0, 0x78, 0xe2, 0xc2, 0x42, 0x21, 0x3c, 0x80, 0x34, 0x01, 
+  0xf0, 0x8b, 0xff, 0xff, 0xad, 0x70, 0x15, 0xf2, 0x40, 0x20, 0x0c, 0x07, 
+  0xa8, 0x20, 0x40, 0x04, 0x00, 0x84, 0x1b, 0x08, 0x81, 0x00, 0x2e, 0x8c, 
+  0x06, 0x94, 0xc0, 0xb9, 0x84, 0x20, 0xcf, 0x8f, 0x25, 0x7d, 0x05, 0xf2, 
+  0x70, 0x70, 0xca, 0x23, 0x05, 0x00, 0x55, 0x24, 0x0c, 0x1c, 0x83, 0x82, 
+  0xbb, 0x78, 0x2c, 0x8c, 0xa1, 0xb9, 0x05, 0x79, 0x2c, 0xac, 0x23, 0x82, 
+  0xce, 0x09, 0xef, 0xf1, 0x60, 0x40, 0xc2, 0xc6, 0x08, 0x44, 0x42, 0x22, 
+  0x3c, 0x80, 0x4a, 0x20, 0x00, 0x00, 0xe0, 0x7c, 0x40, 0x21, 0x03, 0x07, 
+  0xa8, 0x20, 0xc0, 0x01, 0xc0, 0x13, 0x01, 0x04, 0x38, 0x21, 0x01, 0x03, 
+  0x25, 0x78, 0xe0, 0x7e, 0xee, 0xc2, 0xcb, 0x47, 0xf0, 0x00, 0x00, 0x01, 
+  0x13, 0x8f, 0xcb, 0x45, 0xf0, 0x00, 0x40, 0x02, 0x80, 0xb8, 0x13, 0xaf, 
+  0x12, 0x8f, 0x80, 0xb8, 0x12, 0xaf, 0x11, 0x8f, 0xa0, 0xb8, 0x11, 0xaf, 
+  0x01, 0x85, 0x21, 0x85, 0x44, 0x20, 0x42, 0x00, 0x50, 0x21, 0x00, 0x00, 
+  0x45, 0x78, 0x01, 0xa5, 0x00, 0x16, 0x01, 0x70, 0xa0, 0x00, 0x80, 0x6e, 
+  0xe0, 0x01, 0xf2, 0x29, 0x20, 0x6c, 0x2e, 0x0e, 0xcf, 0xf6, 0xaa, 0x20, 
+  0x49, 0x09, 0x1a, 0x0e, 0xef, 0xf6, 0xaa, 0x21, 0x09, 0x09, 0xca, 0x0c, 
+  0xcf, 0xfe, 0x82, 0x0f, 0xaf, 0xfd, 0x0c, 0x70, 0x2e, 0x0d, 0xcf, 0xfe, 
+  0x36, 0x0d, 0xcf, 0xfe, 0x72, 0x0d, 0xcf, 0xfe, 0x7e, 0x09, 0x0f, 0xf1, 
+  0x10, 0x40, 0x14, 0x70, 0xd8, 0xf2, 0x4a, 0x0d, 0xcf, 0xfd, 0x03, 0x90, 
+  0xbc, 0x04, 0xf0, 0x0d, 0x04, 0xb6, 0x0e, 0x10, 0x80, 0x20, 0x22, 0x85, 
+  0x22, 0xb8, 0xa0, 0xb9, 0xc0, 0xb8, 0x25, 0x78, 0x02, 0xa5, 0x02, 0x10, 
+  0x81, 0x20, 0x08, 0x8f, 0x0f, 0x09, 0x7f, 0x00, 0x94, 0x01, 0xf0, 0x13, 
+  0x80, 0xb8, 0x02, 0xf0, 0x81, 0xb8, 0x08, 0xaf, 0x42, 0x09, 0x2f, 0xf1, 
+  0x17, 0x1e, 0x83, 0x14, 0x2f, 0x10, 0x81, 0x00, 0x2e, 0x10, 0x82, 0x00, 
+  0x40, 0x29, 0x00, 0x02, 0x45, 0x78, 0x11, 0x08, 0x80, 0x0f, 0x20, 0x01, 
+  0xf1, 0x0b, 0x8c, 0x20, 0x53, 0x8f, 0xc6, 0xf7, 0x08, 0xf0, 0x00, 0x1e, 
+  0x43, 0x70, 0xa0, 0x00, 0x9c, 0x42, 0x8a, 0x20, 0x93, 0x0f, 0xa9, 0x5a, 
+  0x14, 0x70, 0x92, 0xf2, 0xa2, 0x00, 0x10, 0x5c, 0x5a, 0x01, 0xa0, 0x20, 
+  0x6c, 0x42, 0x0c, 0x2f, 0xeb, 0x17, 0x1e, 0xc3, 0x14, 0xb8, 0x01, 0xf0, 
+  0x0b, 0x4c, 0x80, 0x28, 0xd9, 0xc3, 0x42, 0xa0, 0x00, 0x54, 0x40, 0x56, 
+  0x25, 0x00, 0x1c, 0x17, 0x1e, 0x43, 0x15, 0x3a, 0x0a, 0x2f, 0xf7, 0x17, 
+  0x1e, 0x83, 0x15, 0x32, 0x00, 0x20, 0xec, 0x84, 0x1c, 0x00, 0x80, 0x74, 
+  0x40, 0x26, 0x0a, 0x2f, 0xf7, 0x28, 0xd9, 0x12, 0x00, 0x20, 0x0c, 0x88, 
+  0x12, 0x00, 0x72, 0xec, 0x40, 0xe2, 0x08, 0xaf, 0xec, 0x20, 0x12, 0x00, 
+  0x10, 0x8c, 0x12, 0x00, 0x31, 0x08, 0x41, 0xce, 0x12, 0x00, 0xf0, 0x99, 
+  0x10, 0x8f, 0x10, 0xd9, 0x80, 0xb8, 0x10, 0xaf, 0xa1, 0x40, 0x6a, 0x09, 
+  0xef, 0xf4, 0x17, 0x1e, 0xc3, 0x15, 0xd2, 0x08, 0x20, 0x00, 0x02, 0x40, 
+  0xab, 0x08, 0x30, 0x00, 0xad, 0x70, 0x34, 0x58, 0x10, 0x43, 0x2e, 0x58, 
+  0x10, 0x42, 0x3e, 0x58, 0x10, 0x41, 0x2f, 0x58, 0x00, 0x44, 0x02, 0x40, 
+  0x62, 0x41, 0x42, 0x42, 0xda, 0x0a, 0x20, 0x00, 0x22, 0x43, 0x87, 0x08, 
+  0x10, 0x00, 0x22, 0x09, 0xcf, 0xeb, 0x0e, 0xe8, 0x0b, 0x8e, 0x19, 0x08, 
+  0x5f, 0x00, 0x34, 0x58, 0x10, 0x40, 0x2e, 0x58, 0x00, 0x42, 0x30, 0xd8, 
+  0x02, 0x41, 0x33, 0x58, 0x04, 0xe8, 0x96, 0x08, 0xcf, 0xeb, 0x3e, 0x0d, 
+  0x00, 0x00, 0x2f, 0xe8, 0x91, 0xd8, 0xca, 0x09, 0xaf, 0xf6, 0x17, 0xae, 
+  0x14, 0x8e, 0xa9, 0xe8, 0x82, 0x0d, 0xcf, 0xff, 0x8a, 0x20, 0x08, 0x0e, 
+  0xaa, 0xda, 0x2c, 0x70, 0xc1, 0x68, 0xab, 0x22, 0x08, 0x0e, 0x2b, 0x21, 
+  0x80, 0x03, 0x08, 0x8f, 0xc3, 0x43, 0xfa, 0x02, 0x80, 0xf0, 0xc3, 0x41, 
+  0x31, 0x01, 0x00, 0x2d, 0xc1, 0xb8, 0x14, 0x72, 0x55, 0xdc, 0xca, 0x21, 
+  0xc1, 0x00, 0x01, 0x6e, 0xc9, 0x43, 0xab, 0x24, 0x08, 0x1e, 0x2b, 0x21, 
+  0x6a, 0x03, 0xf0, 0x09, 0xa0, 0x00, 0xe0, 0x42, 0x00, 0x88, 0xad, 0x71, 
+  0x09, 0xe8, 0x0c, 0x75, 0x0d, 0xf0, 0x2a, 0xd8, 0xad, 0x70, 0x14, 0xae, 
+  0xa1, 0x40, 0xce, 0xc6, 0x1a, 0x00, 0x81, 0xe1, 0x42, 0x00, 0x88, 0x7b, 
+  0xe8, 0x0c, 0x73, 0x52, 0x00, 0x90, 0x20, 0xc0, 0x02, 0xf5, 0xf1, 0x2e, 
+  0xd8, 0x26, 0x09, 0x80, 0x03, 0x20, 0xe6, 0xc2, 0x1c, 0x02, 0xf0, 0x0b, 
+  0x34, 0x00, 0x17, 0x1d, 0x03, 0x16, 0x2f, 0x88, 0x4d, 0x88, 0xce, 0x88, 
+  0x8c, 0x88, 0x08, 0xb9, 0x08, 0xba, 0x25, 0x7e, 0x85, 0x7a, 0x10, 0xbe, 
+  0xc3, 0x43, 0x38, 0x02, 0xf0, 0x3e, 0x53, 0x22, 0xc1, 0x02, 0x45, 0x7e, 
+  0x3a, 0xb3, 0x2c, 0xbe, 0x95, 0x88, 0x53, 0x26, 0x4b, 0x11, 0xd7, 0x88, 
+  0x34, 0x88, 0x56, 0x88, 0x08, 0xbc, 0x08, 0xbe, 0x25, 0x7c, 0x05, 0x26, 
+  0x81, 0x10, 0x4a, 0x24, 0x40, 0x76, 0x10, 0xb9, 0x85, 0x79, 0x2d, 0x70, 
+  0x0d, 0x71, 0xcd, 0x70, 0x24, 0xa3, 0xa8, 0x20, 0x41, 0x02, 0x71, 0x76, 
+  0x45, 0xf2, 0x0f, 0x0e, 0x14, 0x14, 0x5c, 0x88, 0x3d, 0x88, 0xff, 0x88, 
+  0x9e, 0x88, 0x05, 0xf0, 0x58, 0x88, 0x39, 0x88, 0xfb, 0x88, 0x9a, 0x5e, 
+  0x00, 0xf6, 0x26, 0xbf, 0x45, 0x79, 0x05, 0x27, 0x02, 0x13, 0x10, 0xba, 
+  0x45, 0x79, 0x01, 0x29, 0x41, 0x02, 0xc1, 0xb9, 0x34, 0x71, 0x3e, 0x00, 
+  0x21, 0x00, 0x34, 0x72, 0x0f, 0xf2, 0x34, 0x73, 0x1f, 0xf4, 0x2f, 0x27, 
+  0xbf, 0x00, 0x6f, 0x23, 0x3f, 0x00, 0x25, 0x83, 0x0f, 0x21, 0x81, 0x03, 
+  0x25, 0xa3, 0x2f, 0x26, 0xbf, 0x00, 0x0b, 0xf0, 0x16, 0x00, 0x15, 0x10, 
+  0x16, 0x00, 0xe6, 0x2c, 0x71, 0xd8, 0x79, 0x26, 0xa3, 0x0f, 0xf0, 0x00, 
+  0x28, 0x81, 0x13, 0x28, 0xa3, 0x24, 0x00, 0x11, 0x27, 0x3a, 0x00, 0x11, 
+  0x27, 0x24, 0x00, 0xf0, 0x07, 0x25, 0x72, 0xc5, 0x71, 0x61, 0x40, 0xad, 
+  0x5a, 0xa7, 0x08, 0x30, 0x00, 0x4a, 0x24, 0x40, 0x71, 0x11, 0xd8, 0x4a, 
+  0x21, 0x00, 0x00, 0x2c, 0x03, 0xf2, 0x1b, 0xab, 0x20, 0xd0, 0x02, 0x04, 
+  0x71, 0xab, 0x21, 0x88, 0x01, 0x4a, 0x24, 0x80, 0x71, 0x16, 0xdc, 0x6c, 
+  0x71, 0x23, 0xda, 0x0c, 0x72, 0x24, 0xd9, 0xab, 0x24, 0xd0, 0x12, 0xab, 
+  0x23, 0x88, 0x01, 0xab, 0x22, 0xd0, 0x02, 0xab, 0x20, 0x88, 0x01, 0xab, 
+  0x21, 0x08, 0x00, 0x4c, 0x17, 0xd8, 0x2c, 0x74, 0x38, 0x00, 0xa1, 0xc0, 
+  0x70, 0x1d, 0xdc, 0x1e, 0xdb, 0x4c, 0x73, 0x1f, 0xd8, 0x36, 0x00, 0xa1, 
+  0x21, 0x88, 0x01, 0xab, 0x23, 0xd0, 0x02, 0xab, 0x22, 0x88, 0x26, 0x00, 
+  0x20, 0x15, 0xd8, 0x12, 0x00, 0xe1, 0xa8, 0x20, 0xc0, 0x02, 0x40, 0x20, 
+  0x02, 0x04, 0x42, 0x20, 0x01, 0x04, 0x04, 0x71, 0x56, 0x00, 0x85, 0x21, 
+  0x88, 0x01, 0x28, 0xda, 0x07, 0xd9, 0x0c, 0x0e, 0x00, 0xc0, 0x17, 0x1d, 
+  0x43, 0x16, 0xc6, 0xc6, 0xb0, 0xd9, 0x0c, 0x70, 0x34, 0xad, 0x40, 0x04, 
+  0xf0, 0x17, 0xea, 0xc2, 0x30, 0x41, 0x0e, 0x71, 0x36, 0xe9, 0x40, 0x20, 
+  0x0f, 0x07, 0xad, 0x70, 0x45, 0xde, 0x01, 0x87, 0x1d, 0x08, 0x92, 0x04, 
+  0x29, 0x08, 0x90, 0x04, 0x2f, 0x08, 0x50, 0x08, 0x3b, 0x08, 0x91, 0x08, 
+  0x00, 0x1f, 0x80, 0x1f, 0xaa, 0x02, 0x82, 0x1c, 0xf0, 0x12, 0xe8, 0x2b, 
+  0x08, 0x51, 0x04, 0x10, 0x00, 0x42, 0x54, 0x40, 0x14, 0xf0, 0x0a, 0x00, 
+  0x33, 0x74, 0x40, 0x0e, 0x0a, 0x00, 0xf0, 0x2f, 0xec, 0x40, 0x0a, 0xf0, 
+  0x00, 0x1f, 0x01, 0x10, 0x06, 0xf0, 0x0e, 0x70, 0x00, 0x1e, 0x82, 0x73, 
+  0xf0, 0x00, 0x49, 0x00, 0xfa, 0x0f, 0xef, 0xf6, 0xe1, 0x40, 0xa5, 0x71, 
+  0xa9, 0x0d, 0x64, 0x94, 0x55, 0x27, 0x0f, 0x1c, 0x02, 0x40, 0xca, 0xc6, 
+  0xf1, 0xc0, 0xa8, 0x5a, 0x14, 0x70, 0x0c, 0x71, 0x07, 0xf4, 0x29, 0xda, 
+  0xc3, 0x41, 0xf0, 0x00, 0x48, 0x00, 0x0c, 0x70, 0x40, 0xa9, 0xac, 0x05, 
+  0xa0, 0xe0, 0x78, 0xec, 0xc2, 0x50, 0x42, 0x30, 0x41, 0x10, 0x40, 0x2e, 
+  0x02, 0xf2, 0x09, 0x4b, 0x00, 0x20, 0x40, 0x40, 0x41, 0x60, 0x42, 0x80, 
+  0x43, 0xd2, 0x0f, 0xef, 0xff, 0x00, 0x1d, 0x83, 0x16, 0x14, 0x70, 0x0c, 
+  0x70, 0x4f, 0xf2, 0x7a, 0x03, 0x60, 0x22, 0x40, 0x42, 0x41, 0x1e, 0x0b, 
+  0x18, 0x00, 0x22, 0xc3, 0x16, 0x70, 0x03, 0x80, 0x22, 0x40, 0x0e, 0x0b, 
+  0xef, 0xff, 0x42, 0x41, 0x1c, 0x04, 0x20, 0x40, 0x02, 0x5a, 0x00, 0xf0, 
+  0x1b, 0x77, 0x02, 0xe0, 0x86, 0x2d, 0x10, 0x83, 0x20, 0x00, 0x89, 0x6c, 
+  0x20, 0x42, 0x00, 0x53, 0x23, 0x40, 0x00, 0x45, 0x78, 0x00, 0xa9, 0x02, 
+  0x40, 0x22, 0x41, 0x42, 0x42, 0x02, 0x0a, 0x20, 0x00, 0x00, 0x1d, 0x03, 
+  0x17, 0x28, 0xbf, 0xca, 0xbf, 0x0d, 0xe8, 0x14, 0x00, 0xf0, 0x03, 0xba, 
+  0x09, 0x20, 0x00, 0x42, 0x42, 0x05, 0xe8, 0x85, 0x27, 0x07, 0x10, 0x03, 
+  0xf0, 0x85, 0x27, 0x03, 0x10, 0x28, 0x00, 0x20, 0xf6, 0x09, 0x28, 0x00, 
+  0xf0, 0x19, 0x43, 0x17, 0x60, 0x86, 0x8a, 0x21, 0x18, 0x00, 0x14, 0x70, 
+  0xc5, 0x27, 0x42, 0x10, 0x46, 0x27, 0x02, 0x10, 0x08, 0xba, 0x04, 0x23, 
+  0x81, 0x0f, 0xf8, 0xff, 0xff, 0x00, 0x0c, 0x71, 0x45, 0x79, 0x20, 0xa6, 
+  0x00, 0x1d, 0x83, 0x17, 0xcc, 0xc6, 0x90, 0x05, 0xa0, 0x13, 0x00, 0xf0, 
+  0x8f, 0xea, 0x08, 0xcf, 0xfe, 0x83, 0xe8, 0xd4, 0x00, 0x80, 0x26, 0x0e, 
+  0xef, 0xea, 0x2c, 0x71, 0xe2, 0xc2, 0x46, 0x04, 0x22, 0xe0, 0x42, 0x06, 
+  0x03, 0x03, 0x2c, 0x03, 0x80, 0x19, 0x03, 0x00, 0x17, 0x1d, 0x43, 0x14, 
+  0xce, 0xde, 0x00, 0xf0, 0x50, 0x18, 0x43, 0x00, 0xba, 0x0a, 0xcf, 0xff, 
+  0x05, 0xe8, 0x92, 0xd8, 0x0e, 0x08, 0xaf, 0xfe, 0x17, 0xad, 0x14, 0x8d, 
+  0x83, 0xe8, 0x20, 0xd8, 0x14, 0xad, 0xaf, 0xd8, 0x17, 0xad, 0x40, 0x58, 
+  0xee, 0xc2, 0x70, 0x43, 0x50, 0x41, 0x30, 0x42, 0x83, 0x0b, 0x30, 0x00, 
+  0x10, 0x40, 0xad, 0x70, 0xd7, 0x6d, 0x22, 0x76, 0xc1, 0x40, 0x35, 0x58, 
+  0x0b, 0x08, 0x95, 0x00, 0x3e, 0x1e, 0x83, 0x10, 0x05, 0xf0, 0x0b, 0x08, 
+  0x54, 0x01, 0x3e, 0x1e, 0xc3, 0x1f, 0x19, 0x8e, 0x40, 0x26, 0x0f, 0x17, 
+  0xc1, 0xb8, 0x23, 0x08, 0x71, 0x00, 0xe1, 0x40, 0x01, 0x97, 0x17, 0xe8, 
+  0x48, 0x30, 0x00, 0x00, 0x40, 0x06, 0xf0, 0x03, 0x64, 0x4b, 0xc1, 0x42, 
+  0xb2, 0x5a, 0x23, 0x08, 0x33, 0x00, 0x01, 0xaf, 0x1a, 0xf0, 0x02, 0x41, 
+  0x9e, 0x08, 0xf0, 0x00, 0xf0, 0x09, 0x09, 0xe8, 0x00, 0x41, 0x00, 0x80, 
+  0xfe, 0xe8, 0xc0, 0xa1, 0x03, 0xf0, 0x01, 0x1f, 0xc3, 0x1f, 0x28, 0x86, 
+  0x0c, 0xe9, 0x21, 0x16, 0x80, 0x10, 0x00, 0x04, 0xf0, 0x09, 0x0c, 0x70, 
+  0x05, 0xf4, 0x2f, 0x78, 0x02, 0x41, 0x42, 0x42, 0x33, 0x58, 0x08, 0xa6, 
+  0xa5, 0x71, 0x8d, 0x0d, 0xc4, 0x94, 0x02, 0x40, 0xce, 0x0d, 0x66, 0x01, 
+  0xf2, 0x0f, 0x5b, 0x0b, 0x30, 0x20, 0x10, 0x42, 0xed, 0x70, 0xcd, 0x70, 
+  0x11, 0xf0, 0x35, 0x58, 0x10, 0x40, 0xa1, 0x40, 0x3a, 0x58, 0x35, 0x58, 
+  0x0c, 0x20, 0x00, 0xa0, 0xe1, 0x40, 0x56, 0xf7, 0x0e, 0x00, 0xf0, 0x01, 
+  0x3e, 0x1d, 0x02, 0x10, 0x0c, 0x71, 0x0e, 0xf0, 0x17, 0x6e, 0x00, 0x21, 
+  0x0d, 0xa0, 0x09, 0xf2, 0x16, 0x00, 0xf0, 0x15, 0x07, 0xe8, 0x19, 0x8d, 
+  0xc1, 0xb8, 0xcf, 0x08, 0x71, 0x80, 0xa1, 0x40, 0xe1, 0x40, 0xc5, 0x71, 
+  0x72, 0x76, 0x3c, 0x26, 0xcf, 0x14, 0xca, 0x26, 0x26, 0x10, 0x04, 0x7f, 
+  0xad, 0xf7, 0xeb, 0xe8, 0x42, 0x40, 0xce, 0xc6, 0xc0, 0x06, 0xf2, 0x2d, 
+  0x61, 0x88, 0x08, 0x45, 0x40, 0x2b, 0x80, 0x07, 0x42, 0x28, 0xbe, 0x87, 
+  0x0e, 0x00, 0x24, 0x00, 0x80, 0x8d, 0x81, 0x40, 0x3d, 0x58, 0x07, 0xf0, 
+  0xc1, 0xbb, 0x0b, 0x0b, 0xb1, 0x00, 0x0c, 0x70, 0x81, 0x40, 0x33, 0x58, 
+  0x00, 0xa5, 0xc2, 0xc6, 0xe0, 0x78, 0x8d, 0x70, 0x17, 0xea, 0x2d, 0x10, 
+  0x83, 0x00, 0x27, 0x0b, 0x70, 0x00, 0x0a, 0x24, 0x80, 0x70, 0x3c, 0x49, 
+  0x5c, 0x05, 0x00, 0x10, 0x03, 0xf1, 0x10, 0x20, 0x80, 0x0f, 0x09, 0x81, 
+  0x00, 0x34, 0x88, 0x07, 0x09, 0x9f, 0x00, 0x8d, 0x71, 0x55, 0x20, 0x00, 
+  0x0c, 0xe0, 0x7f, 0x81, 0x40, 0xe0, 0x78, 0x2d, 0x10, 0x80, 0x00, 0x0f, 
+  0x08, 0x51, 0x8a, 0x01, 0x60, 0x54, 0x40, 0x21, 0x01, 0xcf, 0xff, 0x0a, 
+  0x00, 0x33, 0x08, 0x41, 0x15, 0x0a, 0x00, 0xa0, 0x74, 0x40, 0x0d, 0x01, 
+  0xcf, 0xff, 0xe0, 0x78, 0xc3, 0x42, 0x88, 0x02, 0x84, 0x1b, 0xd9, 0x0c, 
+  0x70, 0x00, 0x1a, 0xc3, 0x07, 0xa2, 0x03, 0xf0, 0x13, 0xc3, 0x40, 0xf0, 
+  0x00, 0x20, 0x01, 0x20, 0xd9, 0x26, 0xa0, 0x20, 0xa0, 0x6f, 0x26, 0xff, 
+  0x05, 0x90, 0xd9, 0x0c, 0x71, 0xe0, 0x7f, 0x20, 0xaa, 0x00, 0x00, 0x2b, 
+  0x66, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x09, 0x06, 0x00, 0x0f, 0x01, 0x00, 
+  0x39, 0x31, 0xf0, 0x4f, 0x01, 0x08, 0x00, 0x63, 0xdc, 0x39, 0x01, 0x00, 
+  0x2e, 0x14, 0x14, 0x00, 0x0b, 0x24, 0x00, 0xf0, 0x05, 0x49, 0x4e, 0x49, 
+  0x03, 0x54, 0x3b, 0x11, 0x00, 0xd4, 0x79, 0x13, 0x00, 0x05, 0x00, 0x00, 
+  0x00, 0x01, 0xf8, 0x7e, 0xa0, 0x18, 0x00, 0x14, 0xd8, 0x10, 0x00, 0x12, 
+  0xd8, 0x10, 0x00, 0x60, 0x20, 0x6c, 0xa0, 0x00, 0xb8, 0x08, 0x09, 0x00, 
+  0xf3, 0xff, 0xbc, 0x00, 0xfc, 0x23, 0x10, 0x00, 0xcc, 0x02, 0x04, 0x54, 
+  0x22, 0x10, 0x00, 0xb4, 0xff, 0x11, 0x00, 0xb8, 0xe2, 0x00, 0x00, 0x10, 
+  0x00, 0xac, 0x00, 0x12, 0x00, 0x40, 0x36, 0x11, 0x00, 0x18, 0xa0, 0x11, 
+  0x00, 0x50, 0x39, 0x00, 0x00, 0x11, 0x00, 0x04, 0x3a, 0x11, 0x00, 0x84, 
+  0xa1, 0x11, 0x00, 0xf4, 0xa3, 0x11, 0x00, 0xac, 0x5b, 0x00, 0x00, 0x13, 
+  0x00, 0x04, 0xa4, 0x11, 0x00, 0x00, 0xa2, 0x11, 0x00, 0x80, 0x1d, 0x12, 
+  0x00, 0x28, 0x1e, 0x00, 0x08, 0x12, 0x00, 0x58, 0x1f, 0x12, 0x00, 0x2c, 
+  0x0a, 0x12, 0x00, 0x04, 0x02, 0x04, 0xf4, 0x09, 0x12, 0x00, 0x02, 0x00, 
+  0xdc, 0x02, 0x04, 0x0c, 0x6c, 0x12, 0x00, 0xa4, 0x01, 0x12, 0x00, 0xe8, 
+  0x00, 0x12, 0x00, 0xb8, 0x67, 0x00, 0x00, 0x12, 0x00, 0x68, 0x04, 0x12, 
+  0x00, 0xb4, 0x9f, 0x11, 0x00, 0x10, 0x80, 0x11, 0x00, 0x98, 0x05, 0x00, 
+  0x80, 0x12, 0x00, 0x78, 0x02, 0x12, 0x00, 0xfc, 0x5d, 0x13, 0x00, 0x80, 
+  0x4b, 0x12, 0x00, 0xc0, 0x02, 0x04, 0x0c, 0xa0, 0x00, 0x4c, 0x02, 0x74, 
+  0x02, 0x04, 0x34, 0x27, 0x10, 0x00, 0x00, 0x4d, 0x12, 0x00, 0x20, 0x02, 
+  0x04, 0x40, 0x02, 0x04, 0x2c, 0x08, 0x8c, 0x57, 0x02, 0x24, 0x02, 0x18, 
+  0xc0, 0x02, 0x04, 0x9c, 0x24, 0x10, 0x00, 0x60, 0x02, 0x14, 0x94, 0x39, 
+  0x13, 0x00, 0xa0, 0x20, 0x8c, 0x13, 0x11, 0x00, 0xa0, 0x02, 0x04, 0xb8, 
+  0x02, 0x04, 0x94, 0xae, 0x11, 0x00, 0x3c, 0x02, 0x04, 0xf4, 0x7e, 0x80, 
+  0xb2, 0x11, 0x00, 0x2c, 0x1a, 0x12, 0x00, 0xb0, 0x02, 0x04, 0xbc, 0x02, 
+  0x04, 0x54, 0x1b, 0x02, 0x84, 0x02, 0x04, 0x18, 0x02, 0x0c, 0x04, 0x98, 
+  0x14, 0x6b, 0x02, 0x70, 0x18, 0x12, 0x00, 0xd8, 0x19, 0x12, 0x00, 0x94, 
+  0x03, 0x10, 0x02, 0x0c, 0xf0, 0x17, 0x02, 0x74, 0x41, 0x20, 0x02, 0xf4, 
+  0xfc, 0xfd, 0x12, 0x00, 0x84, 0x02, 0x5c, 0xac, 0x17, 0x13, 0x00, 0xe4, 
+  0x13, 0x02, 0x5c, 0x14, 0x13, 0x14, 0x04, 0x00, 0xc0, 0x02, 0x08, 0x28, 
+  0x02, 0x08, 0x78, 0x93, 0x12, 0x00, 0x6c, 0x02, 0x04, 0xac, 0x2a, 0x13, 
+  0x00, 0xd4, 0x09, 0x00, 0x02, 0x20, 0x34, 0x75, 0x02, 0x64, 0x69, 0x11, 
+  0x00, 0x0c, 0x92, 0x12, 0x00, 0x54, 0x67, 0x10, 0x00, 0xc0, 0x10, 0x14, 
+  0x66, 0x10, 0x00, 0xe0, 0x02, 0x08, 0xfc, 0x68, 0x10, 0x00, 0x0c, 0x02, 
+  0x08, 0x4c, 0x02, 0x08, 0x20, 0x69, 0x10, 0x54, 0x15, 0x00, 0x68, 0x02, 
+  0x08, 0xd8, 0x02, 0x04, 0x2c, 0x02, 0x04, 0x14, 0x02, 0x04, 0x30, 0x02, 
+  0x44, 0x50, 0x02, 0x04, 0x14, 0x97, 0x12, 0x40, 0x10, 0x00, 0x70, 0x55, 
+  0x13, 0x00, 0x88, 0x02, 0x04, 0x48, 0xf5, 0x11, 0x00, 0xc0, 0x12, 0x40, 
+  0x40, 0x24, 0x12, 0x14, 0x04, 0x00, 0x4c, 0x02, 0x04, 0x60, 0x02, 0x04, 
+  0xcc, 0x26, 0x12, 0x00, 0xf0, 0x02, 0x04, 0x30, 0x27, 0x12, 0x00, 0xa8, 
+  0x05, 0x15, 0x02, 0x04, 0xc8, 0x02, 0x04, 0x00, 0x29, 0x12, 0x00, 0x98, 
+  0x02, 0x04, 0xec, 0x02, 0x04, 0xfc, 0x02, 0x04, 0x50, 0x2a, 0x12, 0x94, 
+  0xa0, 0x00, 0x60, 0x02, 0x04, 0xdc, 0x02, 0x04, 0xc4, 0x37, 0x12, 0x2c, 
+  0x5e, 0x12, 0x00, 0xec, 0x68, 0x12, 0x64, 0x38, 0x02, 0x08, 0x41, 0x05, 
+  0x02, 0x04, 0x94, 0x39, 0x12, 0x06, 0x01, 0xf1, 0x2e, 0xc4, 0x02, 0x04, 
+  0x88, 0x3a, 0x12, 0x00, 0xac, 0x41, 0x19, 0x02, 0x04, 0x24, 0x3c, 0x12, 
+  0x00, 0xbc, 0x02, 0x04, 0xa4, 0x02, 0x68, 0xe0, 0x31, 0x02, 0x68, 0x02, 
+  0x04, 0x04, 0x32, 0x12, 0x94, 0x55, 0x00, 0x14, 0x02, 0x04, 0x80, 0x02, 
+  0x04, 0x00, 0x33, 0x12, 0xd0, 0x02, 0x1c, 0x30, 0x02, 0x04, 0x34, 0x02, 
+  0x04, 0x58, 0x02, 0x88, 0xa8, 0x95, 0x59, 0x02, 0x14, 0xd8, 0x6a, 0x00, 
+  0xf1, 0x0c, 0x00, 0x35, 0x12, 0xec, 0x02, 0x04, 0x30, 0x36, 0x12, 0x30, 
+  0x02, 0x04, 0x94, 0x02, 0x04, 0xdc, 0x55, 0xa5, 0x02, 0x04, 0x08, 0x02, 
+  0x84, 0x10, 0x02, 0x04, 0x1c, 0x8a, 0x01, 0xf6, 0x70, 0x90, 0x02, 0x04, 
+  0xd4, 0x77, 0x02, 0x84, 0xf3, 0x12, 0xec, 0x22, 0x10, 0x00, 0x0d, 0x01, 
+  0xc0, 0x6e, 0xa0, 0x04, 0x11, 0x7c, 0x75, 0x13, 0x00, 0x48, 0x76, 0x12, 
+  0x68, 0x77, 0x13, 0x00, 0x00, 0x20, 0x14, 0xa6, 0xa0, 0x00, 0x03, 0x30, 
+  0x00, 0x00, 0x6f, 0x00, 0x40, 0x3e, 0x00, 0x02, 0x01, 0xcc, 0x18, 0x01, 
+  0x02, 0x02, 0x1c, 0x90, 0xa0, 0x00, 0x54, 0xa8, 0xa0, 0x00, 0xc8, 0x06, 
+  0x30, 0x14, 0xa7, 0xa0, 0x00, 0x01, 0x00, 0x04, 0xee, 0x00, 0x50, 0x02, 
+  0x1f, 0x00, 0xff, 0xff, 0x00, 0x00, 0x04, 0x03, 0x09, 0x0a, 0x04, 0x03, 
+  0x14, 0x03, 0x0a, 0x10, 0x03, 0x0b, 0x03, 0x14, 0x0f, 0xfc, 0x02, 0x34, 
+  0x03, 0x0b, 0x08, 0x04, 0x03, 0x14, 0x04, 0x00, 0x40, 0x00, 0x00, 0x80, 
+  0x08, 0x13, 0x0f, 0x50, 0x04, 0x19, 0x05, 0x28, 0x04, 0x0b, 0x0f, 0x05, 
+  0xff, 0xff, 0x0f, 0x10, 0x02, 0x00, 0xf0, 0x11, 0x04, 0x90, 0x0b, 0x15, 
+  0x03, 0x8c, 0x03, 0x10, 0x07, 0x08, 0x03, 0x0c, 0x03, 0x04, 0x0f, 0x10, 
+  0x0b, 0x10, 0x07, 0x0c, 0xff, 0xff, 0x0f, 0x08, 0x03, 0x10, 0x03, 0x04, 
+  0x03, 0x40, 0x03, 0x04, 0x16, 0x00, 0xf8, 0x09, 0x07, 0x0c, 0x03, 0x08, 
+  0x07, 0x04, 0x07, 0x18, 0x03, 0x10, 0x0f, 0x0c, 0x03, 0x14, 0x0b, 0x04, 
+  0x0b, 0x20, 0xff, 0xff, 0x0b, 0x18, 0x0f, 0x0c, 0x48, 0x00, 0x0c, 0x02, 
+  0x00, 0x26, 0x7f, 0xf8, 0x0c, 0x00, 0xf0, 0x2c, 0x07, 0x10, 0x13, 0x60, 
+  0x04, 0x00, 0x00, 0x10, 0x02, 0x02, 0x07, 0x13, 0x24, 0x28, 0x0f, 0x14, 
+  0x05, 0x28, 0xef, 0xef, 0x2f, 0xe0, 0x33, 0x30, 0x0f, 0x14, 0x0f, 0x14, 
+  0x00, 0x06, 0x50, 0x32, 0x19, 0x52, 0x83, 0x07, 0x65, 0x05, 0x50, 0x0f, 
+  0x14, 0x06, 0x3c, 0x08, 0x07, 0x26, 0x07, 0x3c, 0x02, 0x64, 0x7d, 0xde, 
+  0x0f, 0x14, 0x00, 0x0f, 0x14, 0x0f, 0x3c, 0x0d, 0x00, 0xf0, 0x11, 0x0e, 
+  0x3c, 0x05, 0x00, 0x02, 0x14, 0x02, 0x03, 0x07, 0x66, 0x03, 0x8c, 0x05, 
+  0x03, 0x50, 0x0f, 0x14, 0xfb, 0xc0, 0x0f, 0x14, 0x42, 0x20, 0x01, 0x07, 
+  0x35, 0x06, 0x08, 0x03, 0x3c, 0x0f, 0x14, 0xe5, 0x00, 0xe0, 0x00, 0x02, 
+  0x00, 0x08, 0x06, 0x25, 0x02, 0x07, 0xdf, 0xf8, 0x03, 0x14, 0x0f, 0x28, 
+  0x04, 0x00, 0xf0, 0x29, 0x06, 0x14, 0x08, 0x0f, 0x3c, 0x02, 0x28, 0x08, 
+  0x00, 0x20, 0x02, 0x49, 0x06, 0x03, 0x08, 0x28, 0x0f, 0x14, 0x06, 0x20, 
+  0xff, 0xff, 0x07, 0x07, 0x05, 0x28, 0x12, 0x2c, 0x0e, 0xdc, 0x4f, 0xac, 
+  0x05, 0x28, 0x07, 0x36, 0x05, 0x08, 0x05, 0x14, 0x0f, 0x3c, 0x16, 0x68, 
+  0x0f, 0x50, 0x05, 0x33, 0x08, 0x06, 0x0f, 0x3c, 0x03, 0x19, 0x0f, 0xa0, 
+  0x50, 0x00, 0xf0, 0x3e, 0x02, 0x04, 0x14, 0x17, 0xa8, 0x6f, 0xa0, 0x00, 
+  0x18, 0x71, 0xa0, 0x00, 0xb0, 0x02, 0x08, 0xac, 0x02, 0x04, 0x0e, 0x00, 
+  0x54, 0x02, 0x04, 0x02, 0x1c, 0x02, 0xf7, 0x00, 0x00, 0x70, 0xa1, 0xa0, 
+  0x00, 0xec, 0xa0, 0xa0, 0x00, 0x80, 0x70, 0x68, 0x55, 0xa0, 0x00, 0x78, 
+  0x02, 0x04, 0x80, 0x05, 0x1c, 0x04, 0x38, 0xb8, 0x02, 0x0c, 0x20, 0x02, 
+  0x38, 0xc0, 0x02, 0x08, 0xbc, 0x02, 0x04, 0x56, 0xab, 0x5a, 0x02, 0x04, 
+  0x07, 0x38, 0x80, 0x02, 0x38, 0xc8, 0x02, 0x10, 0x5a, 0x1b, 0x02, 0xf2, 
+  0x15, 0x04, 0x4c, 0x02, 0x04, 0x07, 0x1c, 0x90, 0x02, 0x1c, 0xf8, 0x55, 
+  0x55, 0x02, 0x54, 0x90, 0x02, 0x50, 0x88, 0x02, 0x04, 0x84, 0x0a, 0x1c, 
+  0xa0, 0x02, 0x1c, 0x28, 0x02, 0x54, 0xd4, 0x02, 0x14, 0xd0, 0x02, 0x04, 
+  0x5c, 0x35, 0x00, 0xd0, 0xc0, 0x02, 0x1c, 0x40, 0x02, 0x1c, 0xe4, 0x02, 
+  0x14, 0xe0, 0x02, 0x04, 0x5e, 0x35, 0x00, 0x60, 0xe0, 0x02, 0x1c, 0xf0, 
+  0x55, 0x01, 0xdf, 0x02, 0xf0, 0x24, 0x20, 0x58, 0x02, 0x04, 0xf0, 0x05, 
+  0x1c, 0x05, 0x02, 0x20, 0x00, 0x10, 0xa3, 0xa0, 0x00, 0x10, 0xa2, 0xab, 
+  0xaa, 0x02, 0xc4, 0x02, 0x18, 0x78, 0x02, 0x04, 0xfc, 0x0a, 0x1c, 0x24, 
+  0x02, 0x1c, 0x20, 0x02, 0x1c, 0x90, 0x02, 0x18, 0x88, 0x02, 0x04, 0x04, 
+  0x02, 0x90, 0xab, 0x5a, 0x02, 0x34, 0x04, 0x38, 0x38, 0x9d, 0x02, 0xf0, 
+  0x30, 0x1c, 0xa0, 0x02, 0x18, 0x98, 0x02, 0x04, 0x0c, 0x05, 0x1c, 0x14, 
+  0x18, 0x40, 0x02, 0x18, 0x04, 0xd5, 0xaa, 0x02, 0x70, 0xa0, 0x02, 0x14, 
+  0x98, 0x02, 0x04, 0x88, 0x05, 0x54, 0x04, 0x1c, 0x50, 0x02, 0x1c, 0x10, 
+  0x02, 0x1c, 0xb0, 0x02, 0x18, 0xa8, 0x02, 0x04, 0x56, 0xb5, 0x8c, 0x05, 
+  0x1c, 0x04, 0x54, 0x4c, 0x02, 0x54, 0x1c, 0x02, 0x1c, 0xc0, 0x02, 0x18, 
+  0xb8, 0x02, 0x04, 0x90, 0xdd, 0x00, 0xf0, 0x15, 0x60, 0x02, 0x38, 0xaa, 
+  0xab, 0x18, 0x02, 0x14, 0x62, 0x02, 0x14, 0x60, 0x02, 0x04, 0x4d, 0x02, 
+  0x04, 0x02, 0x8c, 0x74, 0x03, 0x28, 0x02, 0x34, 0x1c, 0x02, 0x1c, 0x66, 
+  0x02, 0x14, 0xba, 0xaa, 0x64, 0x02, 0x04, 0x4e, 0x1f, 0x01, 0xf0, 0x26, 
+  0x04, 0x38, 0x70, 0x02, 0x38, 0x28, 0x02, 0x1c, 0x6a, 0x02, 0x14, 0x68, 
+  0x02, 0x04, 0x4f, 0x02, 0x04, 0x55, 0xad, 0x07, 0x1c, 0x80, 0x02, 0x1c, 
+  0x34, 0x02, 0x3c, 0xd0, 0x02, 0x20, 0xc8, 0x02, 0x04, 0x94, 0x05, 0x1c, 
+  0x14, 0xc0, 0x30, 0x02, 0x10, 0x34, 0x02, 0x04, 0x6a, 0x55, 0x6e, 0x02, 
+  0x14, 0x6c, 0x02, 0x04, 0x50, 0xf6, 0x00, 0x20, 0x90, 0x02, 0xac, 0x00, 
+  0x71, 0x72, 0x02, 0x14, 0x70, 0x02, 0x04, 0x51, 0x09, 0x01, 0x00, 0x1c, 
+  0x01, 0xf0, 0x0f, 0x60, 0x02, 0xc8, 0xe0, 0x12, 0xc4, 0xd4, 0x02, 0x04, 
+  0x70, 0x02, 0x28, 0x07, 0x1c, 0xb0, 0x02, 0x1c, 0xa8, 0x55, 0x55, 0x12, 
+  0x2c, 0x44, 0x02, 0x14, 0x40, 0x02, 0x04, 0x74, 0x0a, 0x2b, 0x01, 0xf0, 
+  0x00, 0x4c, 0x02, 0x8c, 0xf0, 0x02, 0x18, 0xe8, 0x02, 0x04, 0x9c, 0x55, 
+  0x55, 0x0a, 0x1c, 0xd0, 0xc8, 0x00, 0x90, 0x38, 0x50, 0x02, 0x18, 0x4c, 
+  0x02, 0x04, 0x76, 0x0a, 0x3a, 0x01, 0xf0, 0x00, 0xb8, 0x02, 0x1c, 0x5c, 
+  0x55, 0x55, 0x02, 0x18, 0x58, 0x02, 0x04, 0x78, 0x0a, 0x1c, 0xf0, 0xd5, 
+  0x00, 0xf0, 0x5a, 0x1c, 0x64, 0x02, 0x18, 0x60, 0x02, 0x04, 0x7a, 0x0a, 
+  0x1c, 0x00, 0x55, 0xe3, 0x02, 0xa4, 0x6c, 0x02, 0x14, 0x7e, 0x02, 0x14, 
+  0x7c, 0x02, 0x04, 0x52, 0x02, 0x04, 0x35, 0x08, 0x01, 0x00, 0xef, 0x42, 
+  0x50, 0x02, 0xb4, 0x04, 0x03, 0xe3, 0xff, 0x14, 0x45, 0x02, 0x0a, 0x3c, 
+  0xe7, 0x11, 0x56, 0x30, 0x0f, 0x20, 0x02, 0x1d, 0x02, 0x03, 0x0f, 0x20, 
+  0x02, 0x13, 0x04, 0x03, 0x07, 0x40, 0x03, 0x0d, 0x0f, 0x60, 0x03, 0x14, 
+  0x9f, 0xf9, 0x07, 0x20, 0x0f, 0x40, 0x03, 0x1c, 0x03, 0x04, 0x0f, 0x20, 
+  0x04, 0x00, 0x0f, 0x80, 0x03, 0x26, 0x00, 0x00, 0x0f, 0x40, 0x05, 0x16, 
+  0x43, 0x14, 0x07, 0x0a, 0x57, 0x78, 0xff, 0xff, 0x0f, 0x40, 0x05, 0x20, 
+  0x10, 0x00, 0xf0, 0x01, 0x09, 0x40, 0x0f, 0x20, 0x0f, 0x20, 0x03, 0x10, 
+  0x0f, 0xe0, 0x03, 0x14, 0x0f, 0xc0, 0x0f, 0xc0, 0x0e, 0x00, 0x60, 0x07, 
+  0x20, 0x03, 0x4c, 0xef, 0xff, 0x46, 0x00, 0xf0, 0x0e, 0x07, 0x20, 0x07, 
+  0xa0, 0x05, 0x1f, 0x20, 0x03, 0x25, 0x06, 0x04, 0x03, 0x40, 0x0f, 0x20, 
+  0x07, 0x40, 0x03, 0x23, 0x03, 0x20, 0x0f, 0x80, 0x07, 0x20, 0x07, 0x60, 
+  0xff, 0xdf, 0x2b, 0x00, 0x02, 0x02, 0x00, 0x40, 0x07, 0x20, 0x0f, 0x80, 
+  0x8f, 0x03, 0xf2, 0x00, 0x07, 0x20, 0x07, 0x80, 0x0f, 0xc0, 0x07, 0x20, 
+  0x10, 0xc2, 0xa8, 0x03, 0xc0, 0xff, 0xff, 0x4a, 0x00, 0x70, 0x0f, 0x20, 
+  0x03, 0x14, 0x0f, 0x20, 0x0f, 0x68, 0x00, 0x10, 0xc0, 0x50, 0x00, 0x04, 
+  0x33, 0x00, 0x61, 0x03, 0x8c, 0xff, 0xff, 0x03, 0xa0, 0x3d, 0x00, 0x30, 
+  0x60, 0x03, 0x30, 0xa8, 0x00, 0x01, 0x24, 0x00, 0x70, 0xe0, 0x07, 0x20, 
+  0x1f, 0x40, 0x03, 0x5c, 0x4d, 0x00, 0x10, 0x03, 0xe8, 0x03, 0x10, 0xa0, 
+  0x86, 0x00, 0x22, 0x0f, 0xa0, 0xca, 0x00, 0x13, 0x0f, 0x3e, 0x00, 0x04, 
+  0x02, 0x00, 0x00, 0x5a, 0x04, 0x61, 0x07, 0x20, 0x03, 0xac, 0x03, 0xe0, 
+  0x10, 0x00, 0x75, 0x60, 0x07, 0x20, 0x1f, 0x00, 0x03, 0x50, 0x4c, 0x00, 
+  0x01, 0x02, 0x00, 0x22, 0xff, 0x2b, 0x7a, 0x00, 0x42, 0x1f, 0xe0, 0x03, 
+  0x9c, 0x56, 0x00, 0xf0, 0x1b, 0x02, 0x04, 0x08, 0x0f, 0xd8, 0x62, 0x10, 
+  0xb0, 0x62, 0x90, 0xd4, 0xa4, 0xa8, 0x57, 0xa0, 0x00, 0x94, 0x02, 0x04, 
+  0x38, 0x62, 0x48, 0x30, 0x02, 0x04, 0x02, 0x24, 0x03, 0x03, 0x08, 0x28, 
+  0xe8, 0x02, 0x28, 0xd0, 0x02, 0x28, 0x54, 0x50, 0xaf, 0xa5, 0xa0, 0x46, 
+  0x05, 0xf0, 0x09, 0x50, 0x02, 0x24, 0x48, 0x02, 0x04, 0x03, 0x25, 0x02, 
+  0x04, 0x08, 0x28, 0xf4, 0x02, 0x28, 0x00, 0x62, 0x90, 0xaa, 0x57, 0xd4, 
+  0x02, 0x24, 0x94, 0xf5, 0x01, 0x24, 0x24, 0x68, 0x35, 0x00, 0xf4, 0x03, 
+  0x98, 0x02, 0x28, 0x40, 0x02, 0x50, 0xa4, 0xd5, 0xab, 0x62, 0xa0, 0x74, 
+  0x02, 0x04, 0xe0, 0x62, 0xa4, 0xd8, 0x34, 0x00, 0xf1, 0x0b, 0xa0, 0x02, 
+  0x28, 0x58, 0x02, 0x28, 0x04, 0x02, 0x9c, 0x6a, 0x55, 0xd4, 0x02, 0x28, 
+  0x00, 0x02, 0x4c, 0xf8, 0x0f, 0x28, 0x02, 0x31, 0xa4, 0x02, 0x28, 0x64, 
+  0x03, 0x00, 0xf4, 0xff, 0x0d, 0x34, 0x02, 0x04, 0x10, 0xbd, 0x3f, 0x02, 
+  0x28, 0x08, 0x02, 0x04, 0x02, 0x1b, 0x0f, 0x03, 0x0c, 0x10, 0xff, 0x02, 
+  0x01, 0x0c, 0x11, 0x0f, 0x0d, 0x0a, 0x10, 0x23, 0x38, 0x0a, 0x0f, 0x08, 
+  0x0b, 0x50, 0xb8, 0x00, 0x06, 0x12, 0x00, 0x9c, 0x82, 0x11, 0x00, 0xd4, 
+  0x4a, 0x12, 0x52, 0x96, 0x08, 0x17, 0x00, 0x50, 0xca, 0x12, 0x00, 0xfc, 
+  0xb1, 0xd4, 0xc9, 0x09, 0x04, 0x03, 0x1a, 0x84, 0x75, 0x03, 0x09, 0x0f, 
+  0x04, 0x06, 0x10, 0x93, 0x21, 0xf4, 0x7e, 0x13, 0x06, 0x0e, 0x0f, 0x07, 
+  0x00, 0xb4, 0x97, 0x48, 0xa3, 0xf8, 0x5c, 0x12, 0xb2, 0xde, 0xf0, 0x00, 
+  0x03, 0x6d, 0xb0, 0x04, 0x51, 0x09, 0x0c, 0xa0, 0x01, 0xf0, 0xb4, 0xa7, 
+  0xa0, 0x07, 0x18, 0xb5, 0xe4, 0xc2, 0x04, 0x80, 0x03, 0x0c, 0x08, 0xc2, 
+  0xfd, 0x12, 0x56, 0xe8, 0x03, 0x0c, 0x00, 0xa0, 0x02, 0x59, 0x04, 0x00, 
+  0x05, 0x3c, 0x02, 0x18, 0x02, 0x56, 0xe3, 0x21, 0x05, 0x18, 0xb3, 0xcd, 
+  0x80, 0x00, 0x48, 0x04, 0x24, 0x02, 0x23, 0x03, 0x03, 0x93, 0x7a, 0x02, 
+  0x00, 0x00, 0x80, 0x0e, 0x04, 0xf0, 0xd5, 0x10, 0x00, 0xa0, 0x00, 0xf0, 
+  0xdf, 0x02, 0x04, 0xe9, 0xa0, 0x00, 0x0b, 0x0b, 0x07, 0x0b, 0x02, 0x06, 
+  0x03, 0x0d, 0x00, 0x00, 0x0d, 0x09, 0x0d, 0x02, 0x08, 0x05, 0x1f, 0x1f, 
+  0x13, 0x1d, 0x06, 0x10, 0x07, 0x25, 0x25, 0x15, 0x00, 0x00, 0x25, 0x06, 
+  0x14, 0x09, 0x79, 0x65, 0x69, 0x5d, 0x14, 0x62, 0x0b, 0x79, 0x77, 0x77, 
+  0x77, 0x14, 0x00, 0x00, 0x76, 0x0d, 0x00, 0x00, 0x0e, 0x0e, 0x09, 0x0e, 
+  0x03, 0x08, 0x04, 0x11, 0x11, 0x0b, 0x11, 0x03, 0x00, 0x00, 0x0a, 0x07, 
+  0x27, 0x27, 0x19, 0x24, 0x09, 0x08, 0x09, 0x2f, 0x2f, 0x1a, 0x2f, 0x08, 
+  0x19, 0x0c, 0x00, 0xc0, 0x98, 0x7f, 0x84, 0x74, 0x1a, 0x7b, 0x0e, 0x98, 
+  0x95, 0x95, 0x95, 0x1a, 0x94, 0x11, 0x03, 0x7d, 0x05, 0x04, 0x00, 0x00, 
+  0x49, 0x16, 0xf1, 0x7c, 0xc2, 0xcb, 0x00, 0x00, 0xc4, 0x77, 0x12, 0x00, 
+  0x01, 0x00, 0xf0, 0x19, 0x2b, 0x66, 0x02, 0x00, 0x02, 0x00, 0x42, 0x26, 
+  0xd0, 0x9e, 0x52, 0x65, 0xc0, 0x19, 0x7d, 0x11, 0x05, 0x1b, 0xb3, 0xf6, 
+  0xa3, 0xd9, 0xc8, 0x8c, 0x07, 0x35, 0x64, 0xe5, 0x02, 0x39, 0x03, 0x54, 
+  0x1a, 0xd5, 0x58, 0xe5, 0x3f, 0x49, 0x1d, 0x90, 0x2c, 0x00, 0xf0, 0x05, 
+  0xca, 0x2e, 0x35, 0x0f, 0x94, 0xd2, 0x00, 0xd6, 0x81, 0xff, 0xed, 0x8e, 
+  0x37, 0xd2, 0x23, 0x92, 0xf9, 0x32, 0xf5, 0x74, 0x18, 0x00, 0xf0, 0x0d, 
+  0xd9, 0x77, 0x5f, 0x1e, 0x10, 0xb1, 0xca, 0xd9, 0xb1, 0xdd, 0xb8, 0x9d, 
+  0x0c, 0x1d, 0x27, 0x5b, 0x94, 0xd3, 0x72, 0x13, 0xc0, 0xf1, 0x00, 0x00, 
+  0x48, 0x1b, 0xa5, 0x22, 0x20, 0x00, 0x22, 0x4c, 0x09, 0x6c, 0x00, 0x15, 
+  0xf0, 0x76, 0x00, 0x77, 0x00, 0x00, 0xf0, 0x9d, 0xaa, 0x1e, 0x04, 0x80, 
+  0x00, 0x07, 0x1b, 0x00, 0x0f, 0x01, 0x00, 0x32, 0x00, 0x80, 0x00, 0x04, 
+  0x01, 0x00, 0x0f, 0x80, 0x00, 0x01, 0x00, 0x01, 0x00, 0xe3, 0x50, 0x52, 
+  0x14, 0x00, 0x70, 0x57, 0x14, 0x00, 0x70, 0x42, 0xa1, 0x00, 0xf0, 0x4c, 
+  0x04, 0x00, 0x12, 0x64, 0x04, 0x00, 0xf5, 0x14, 0x70, 0x65, 0xa1, 0x00, 
+  0x80, 0x52, 0x14, 0x00, 0x00, 0x80, 0x14, 0x00, 0xac, 0x65, 0xa1, 0x00, 
+  0x00, 0x80, 0xa1, 0x00, 0x3c, 0x57, 0x14, 0x00, 0x34, 0x91, 0x13, 0x00, 
+  0x5c, 0x91, 0x13, 0x00, 0x44, 0x91, 0x13, 0x50, 0x01, 0xf7, 0x1a, 0xc3, 
+  0x42, 0xf0, 0x00, 0x4c, 0x00, 0x00, 0x82, 0x21, 0x68, 0x0c, 0x70, 0xe0, 
+  0x7f, 0x20, 0xa2, 0x68, 0x44, 0xc3, 0x43, 0xa1, 0x00, 0x8c, 0x20, 0x56, 
+  0x7b, 0x40, 0x83, 0x61, 0x83, 0x0a, 0x25, 0x00, 0x01, 0x55, 0x03, 0x60, 
+  0x05, 0x81, 0x44, 0x60, 0x18, 0x00, 0xf3, 0x76, 0x35, 0x02, 0x20, 0x05, 
+  0x61, 0x83, 0xe0, 0x78, 0xcb, 0x44, 0xe0, 0xff, 0x00, 0x00, 0x14, 0x24, 
+  0x44, 0x10, 0x14, 0x24, 0xc5, 0x10, 0xb6, 0xbc, 0x0c, 0x24, 0x00, 0x83, 
+  0xcc, 0x25, 0x05, 0x83, 0xc2, 0x00, 0x26, 0x00, 0x96, 0xbc, 0x41, 0x2c, 
+  0x44, 0x05, 0x41, 0x2d, 0x45, 0x05, 0x00, 0x25, 0x05, 0x01, 0x82, 0x25, 
+  0x8f, 0x0f, 0x8c, 0x25, 0xdf, 0x8e, 0xf4, 0x00, 0x26, 0x00, 0x07, 0x21, 
+  0xcc, 0x80, 0x40, 0x25, 0x47, 0x00, 0x94, 0xb9, 0xd4, 0xb9, 0x94, 0xbb, 
+  0xcf, 0x27, 0xe4, 0x02, 0x40, 0x2b, 0xc3, 0x02, 0x41, 0x2a, 0x45, 0x05, 
+  0x40, 0x2a, 0xc2, 0x82, 0x1d, 0x20, 0x84, 0x00, 0x05, 0x23, 0x43, 0x01, 
+  0x1c, 0x20, 0x8c, 0x00, 0x94, 0x70, 0x1d, 0x20, 0xc4, 0x00, 0xcf, 0x27, 
+  0xe2, 0x07, 0x1c, 0x20, 0xc5, 0x00, 0x00, 0x24, 0x0c, 0x91, 0x1d, 0x21, 
+  0x84, 0x00, 0x41, 0x25, 0x00, 0x00, 0x1c, 0x21, 0x85, 0x10, 0x00, 0xe1, 
+  0xc4, 0x00, 0x01, 0x20, 0x40, 0x81, 0x1c, 0x21, 0xc5, 0x00, 0x41, 0x26, 
+  0x01, 0x70, 0x1b, 0x01, 0xf0, 0x0b, 0x20, 0x00, 0x81, 0x01, 0x21, 0x41, 
+  0x01, 0x1b, 0x09, 0x3f, 0x05, 0x00, 0x24, 0x0c, 0x93, 0x42, 0x27, 0x47, 
+  0x00, 0x01, 0x20, 0x00, 0x80, 0x01, 0x21, 0x41, 0x34, 0x00, 0xf4, 0x32, 
+  0x93, 0x40, 0x2f, 0x04, 0x05, 0xe1, 0x20, 0xc6, 0x07, 0x80, 0x71, 0x40, 
+  0x29, 0xc5, 0x07, 0x05, 0x25, 0xc5, 0x81, 0xcf, 0x25, 0xe2, 0x07, 0x41, 
+  0x2d, 0xc5, 0x07, 0x00, 0x20, 0x40, 0x81, 0xe0, 0x7f, 0x41, 0x21, 0x01, 
+  0x00, 0x02, 0x24, 0x04, 0x83, 0xcc, 0x20, 0x21, 0x80, 0xe1, 0x20, 0xc1, 
+  0x07, 0xca, 0x21, 0x21, 0x00, 0x02, 0x25, 0x05, 0x83, 0xcc, 0x22, 0x21, 
+  0x80, 0xca, 0x20, 0x21, 0x00, 0x14, 0x00, 0x04, 0xee, 0x00, 0xf1, 0x16, 
+  0x20, 0x00, 0x25, 0x00, 0x0c, 0x24, 0x40, 0x81, 0xcc, 0x20, 0x81, 0x80, 
+  0xca, 0x20, 0x85, 0x00, 0xca, 0x21, 0xc5, 0x00, 0x07, 0x23, 0x43, 0x80, 
+  0xe0, 0x7f, 0xcf, 0x21, 0xe4, 0x07, 0x2f, 0x25, 0xc0, 0x80, 0x41, 0x26, 
+  0x04, 0x9a, 0x00, 0x00, 0x42, 0x00, 0xc0, 0x60, 0x03, 0x21, 0x00, 0x2f, 
+  0x21, 0x40, 0x90, 0xc7, 0x24, 0x65, 0x00, 0x62, 0x00, 0xf0, 0x3d, 0x2c, 
+  0x03, 0x01, 0x00, 0x41, 0x29, 0x46, 0x95, 0x06, 0x21, 0x81, 0x0f, 0xf0, 
+  0xff, 0x00, 0x00, 0xc5, 0x21, 0x82, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x5a, 
+  0x00, 0x22, 0x00, 0x00, 0x40, 0x34, 0x70, 0x0c, 0x00, 0x01, 0x00, 0x1b, 
+  0x00, 0x20, 0x00, 0x2f, 0x2a, 0x41, 0x10, 0x14, 0x70, 0x4a, 0x22, 0xc0, 
+  0x17, 0x0e, 0x00, 0x04, 0x00, 0x2f, 0x2a, 0x01, 0x10, 0x40, 0x22, 0x0a, 
+  0x18, 0x42, 0x22, 0x8a, 0x12, 0x02, 0x26, 0x86, 0x02, 0xc4, 0x71, 0x02, 
+  0x26, 0x8b, 0xf2, 0xfb, 0x00, 0xf2, 0x1a, 0x01, 0x28, 0xcb, 0x02, 0x12, 
+  0x00, 0x09, 0x00, 0x42, 0x22, 0x0b, 0x18, 0x00, 0x28, 0xc1, 0x02, 0x13, 
+  0x00, 0x20, 0x00, 0x0c, 0x70, 0x00, 0x28, 0x80, 0x02, 0x00, 0x29, 0x8a, 
+  0x02, 0x05, 0x23, 0x81, 0x12, 0x41, 0x2d, 0x47, 0x85, 0x06, 0x23, 0x88, 
+  0x6e, 0x00, 0x30, 0x20, 0x82, 0x1f, 0x6e, 0x00, 0xd1, 0x5c, 0x00, 0x22, 
+  0x00, 0x40, 0x42, 0x15, 0x70, 0x0e, 0x00, 0x01, 0x00, 0x1d, 0x6e, 0x00, 
+  0x31, 0x01, 0x12, 0x54, 0x6e, 0x00, 0x11, 0x0c, 0x6e, 0x00, 0x16, 0x81, 
+  0x6e, 0x00, 0x46, 0x27, 0x87, 0x02, 0xe4, 0x6e, 0x00, 0x44, 0x2a, 0xcb, 
+  0x02, 0x14, 0x6e, 0x00, 0xf0, 0x3e, 0x2a, 0xc8, 0x02, 0x15, 0x00, 0x20, 
+  0x00, 0x4c, 0x70, 0x00, 0x2a, 0x82, 0x02, 0x00, 0x28, 0x8a, 0x12, 0x05, 
+  0x23, 0x88, 0x12, 0x8c, 0x26, 0xdf, 0x8f, 0xf2, 0x01, 0x01, 0x00, 0x8c, 
+  0x27, 0xdf, 0x8f, 0x1c, 0x02, 0x21, 0x00, 0x1d, 0x20, 0x8a, 0x00, 0x00, 
+  0x26, 0xc6, 0x01, 0x1c, 0x20, 0x8b, 0x00, 0x1d, 0x21, 0x87, 0x00, 0x82, 
+  0x26, 0xcf, 0x0f, 0x1c, 0x21, 0x8c, 0x00, 0x00, 0x23, 0xcb, 0x91, 0x41, 
+  0x24, 0x02, 0x10, 0x1d, 0x20, 0x07, 0x02, 0x1c, 0x20, 0x0c, 0x02, 0x10, 
+  0x00, 0xf0, 0x65, 0x01, 0x22, 0x02, 0x03, 0x1d, 0x21, 0x07, 0x02, 0x1c, 
+  0x21, 0x0c, 0x02, 0x00, 0x22, 0xc2, 0x81, 0x41, 0x24, 0x09, 0x10, 0x40, 
+  0x29, 0x01, 0x13, 0x41, 0x2a, 0x03, 0x05, 0x65, 0x79, 0x40, 0x2a, 0x07, 
+  0x03, 0x40, 0x2a, 0x00, 0x03, 0x41, 0x2b, 0x03, 0x15, 0x65, 0x78, 0x40, 
+  0x2b, 0x0c, 0x13, 0x55, 0x70, 0xc5, 0x24, 0xa2, 0x10, 0xd4, 0x70, 0x40, 
+  0x00, 0x0c, 0x00, 0x04, 0x21, 0xbe, 0x8f, 0x20, 0x00, 0x00, 0x00, 0x12, 
+  0x00, 0x01, 0x00, 0xc4, 0x71, 0x2f, 0x21, 0x42, 0x80, 0x2f, 0x20, 0x04, 
+  0x80, 0x2f, 0x24, 0x04, 0x13, 0x95, 0x70, 0x36, 0x00, 0x0a, 0x00, 0x04, 
+  0x24, 0xbe, 0x9f, 0xff, 0x7f, 0xff, 0xff, 0x0c, 0x00, 0x02, 0x00, 0x44, 
+  0x20, 0x7e, 0x80, 0x22, 0x00, 0x01, 0x00, 0x40, 0x20, 0x40, 0x80, 0xfe, 
+  0x01, 0x04, 0x3c, 0x00, 0x00, 0x0e, 0x01, 0x05, 0x3c, 0x00, 0x10, 0x00, 
+  0xca, 0x00, 0xa0, 0x0e, 0x01, 0x0a, 0x00, 0xd4, 0x70, 0x1a, 0x00, 0x0c, 
+  0x00, 0xb0, 0x01, 0x00, 0x3a, 0x01, 0xf0, 0x0b, 0x40, 0x2e, 0x02, 0x05, 
+  0x45, 0x79, 0x2f, 0x22, 0x03, 0x01, 0x45, 0x79, 0xe0, 0x7e, 0x8c, 0x26, 
+  0xff, 0x82, 0xfa, 0x00, 0x0b, 0x00, 0x02, 0x26, 0x8a, 0x71, 0xf2, 0x01, 
+  0xf0, 0x05, 0x42, 0x22, 0x4a, 0x90, 0x4a, 0x26, 0x00, 0x70, 0x88, 0x00, 
+  0x0b, 0x00, 0x8c, 0x00, 0x01, 0x00, 0x4c, 0x22, 0x00, 0x98, 0x10, 0x00, 
+  0xf1, 0x20, 0x2a, 0x00, 0x0b, 0x00, 0x42, 0x22, 0x0a, 0x18, 0x05, 0x24, 
+  0x0c, 0x90, 0x6d, 0x77, 0x10, 0x00, 0x02, 0x00, 0x00, 0x2b, 0x8b, 0x12, 
+  0x87, 0x23, 0xff, 0x1f, 0x04, 0x21, 0xcc, 0x02, 0x01, 0x29, 0x80, 0x02, 
+  0x5d, 0x00, 0x20, 0x00, 0x2c, 0x70, 0x95, 0x70, 0x6d, 0x77, 0x1e, 0x00, 
+  0x02, 0x38, 0x00, 0x76, 0xc2, 0x23, 0xca, 0x12, 0x0a, 0x00, 0x0a, 0x2a, 
+  0x00, 0x34, 0x20, 0xcc, 0x02, 0x88, 0x01, 0x22, 0x00, 0x29, 0x88, 0x01, 
+  0x71, 0x40, 0x22, 0x0b, 0x18, 0x01, 0x29, 0xc0, 0x88, 0x01, 0xf0, 0x0f, 
+  0x2c, 0x70, 0x01, 0x28, 0x80, 0x02, 0x01, 0x29, 0x81, 0x02, 0x05, 0x20, 
+  0xc0, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x2f, 0x20, 0x00, 0x80, 0x2f, 0x21, 
+  0x4b, 0x00, 0x44, 0x20, 0xbe, 0x80, 0x86, 0x00, 0xc0, 0x1c, 0x00, 0x01, 
+  0x00, 0x44, 0x20, 0x4a, 0x01, 0x05, 0x22, 0x3e, 0x93, 0x10, 0x00, 0x00, 
+  0x6c, 0x02, 0x31, 0x40, 0x20, 0x80, 0x04, 0x01, 0x04, 0xf6, 0x00, 0x04, 
+  0x08, 0x00, 0x40, 0x02, 0x26, 0x86, 0x01, 0x18, 0x01, 0x00, 0xf4, 0x00, 
+  0xc0, 0xc0, 0x26, 0x62, 0x00, 0x80, 0xf1, 0x8a, 0x26, 0xdf, 0x0f, 0xc3, 
+  0x41, 0x10, 0x00, 0x60, 0xf5, 0x06, 0xef, 0xff, 0x0c, 0x70, 0x22, 0x00, 
+  0x31, 0x2c, 0x70, 0xe9, 0x0c, 0x00, 0x20, 0xd3, 0x71, 0x18, 0x00, 0x00, 
+  0xe0, 0x02, 0x40, 0x2f, 0x21, 0x03, 0x01, 0xd4, 0x02, 0x80, 0xf8, 0x7f, 
+  0x00, 0x00, 0xc0, 0x78, 0x70, 0xf5, 0x08, 0x02, 0x20, 0x14, 0x00, 0x60, 
+  0x00, 0x30, 0x03, 0x01, 0x05, 0xf4, 0x02, 0xb1, 0x7f, 0x00, 0x00, 0x0c, 
+  0x70, 0x64, 0xf1, 0x0c, 0x20, 0x80, 0x9f, 0x34, 0x00, 0x1a, 0x22, 0x34, 
+  0x00, 0x15, 0xc5, 0x24, 0x00, 0x60, 0x52, 0xf1, 0x0c, 0x25, 0x80, 0x8f, 
+  0x72, 0x04, 0x02, 0x42, 0x01, 0x11, 0x06, 0x08, 0x00, 0x60, 0x0c, 0x70, 
+  0x2c, 0x70, 0x94, 0x70, 0x2e, 0x00, 0x60, 0x00, 0x80, 0x00, 0x00, 0x40, 
+  0xf1, 0x58, 0x03, 0x40, 0x0c, 0x21, 0x80, 0x9f, 0x28, 0x00, 0x20, 0xb2, 
+  0xf7, 0x22, 0x00, 0x20, 0xc3, 0x41, 0x48, 0x00, 0xf0, 0x0d, 0x0c, 0x70, 
+  0x32, 0xf1, 0x2f, 0x24, 0x40, 0x90, 0x02, 0x24, 0x83, 0x1f, 0x00, 0x70, 
+  0x00, 0x00, 0x40, 0x2b, 0xc2, 0x00, 0x2f, 0x22, 0x84, 0x00, 0x02, 0x23, 
+  0x83, 0x0f, 0xec, 0x01, 0xf1, 0x34, 0xd3, 0x73, 0xc0, 0x1f, 0x00, 0x00, 
+  0x40, 0x28, 0x03, 0x01, 0x1a, 0x00, 0x26, 0x00, 0x41, 0x28, 0x40, 0x87, 
+  0x45, 0x78, 0x44, 0x20, 0x41, 0x00, 0x05, 0x21, 0xc1, 0x80, 0xe0, 0x7f, 
+  0xc1, 0x20, 0x22, 0x00, 0x2f, 0x23, 0xc4, 0x00, 0x45, 0x78, 0x41, 0x2c, 
+  0x4c, 0x15, 0x82, 0x24, 0x0d, 0x9a, 0xe1, 0x20, 0xcb, 0x07, 0xca, 0x20, 
+  0x2b, 0x00, 0x42, 0x24, 0x0c, 0x96, 0x53, 0x20, 0x81, 0x05, 0x22, 0x00, 
+  0x2c, 0x60, 0x01, 0x00, 0x30, 0x00, 0xf0, 0x11, 0x2f, 0x20, 0x84, 0x0f, 
+  0x80, 0xff, 0x00, 0x00, 0xd0, 0x20, 0xa1, 0x05, 0x8c, 0x24, 0xd1, 0x9f, 
+  0xe0, 0x7f, 0xd0, 0x20, 0xa2, 0x05, 0x4e, 0x24, 0x02, 0x10, 0x97, 0xb9, 
+  0x01, 0x29, 0x80, 0x00, 0x8a, 0x02, 0x00, 0x82, 0x04, 0x80, 0x4e, 0x22, 
+  0xcc, 0x07, 0x13, 0x21, 0x01, 0x03, 0x34, 0x00, 0xf0, 0x07, 0xd1, 0x20, 
+  0x21, 0x80, 0xe0, 0x7f, 0xc0, 0x20, 0x62, 0x00, 0xe0, 0x78, 0x8d, 0x71, 
+  0x0a, 0x21, 0x00, 0x80, 0xd4, 0x24, 0x04, 0x13, 0xbe, 0x03, 0x60, 0xce, 
+  0x20, 0x24, 0x00, 0xe0, 0x78, 0x12, 0x00, 0x20, 0x8d, 0x71, 0x7c, 0x04, 
+  0xf2, 0x31, 0x40, 0x2c, 0x8c, 0x17, 0x2f, 0x2a, 0x01, 0x80, 0xc2, 0x22, 
+  0x84, 0x00, 0xc0, 0x22, 0x63, 0x00, 0x00, 0x28, 0x83, 0x00, 0x4e, 0x22, 
+  0xc2, 0x07, 0x40, 0x2a, 0x02, 0x05, 0x85, 0x7a, 0x40, 0x2b, 0x40, 0x05, 
+  0x42, 0x2b, 0xc1, 0x02, 0xe0, 0x7f, 0x59, 0x61, 0x70, 0x71, 0x04, 0xf4, 
+  0x50, 0x70, 0x09, 0xf2, 0x7b, 0x7b, 0x3b, 0x79, 0x25, 0x78, 0x45, 0x78, 
+  0xe0, 0x7f, 0x05, 0x20, 0xc0, 0x80, 0xb6, 0x05, 0xf0, 0x2b, 0x7b, 0x7b, 
+  0x70, 0x74, 0x85, 0xf7, 0x04, 0xf7, 0x54, 0x70, 0x03, 0xf4, 0x10, 0x70, 
+  0xe0, 0x7e, 0x53, 0x21, 0xfe, 0x84, 0x44, 0xf4, 0x14, 0x70, 0x42, 0xf4, 
+  0x2f, 0x00, 0x00, 0x00, 0x53, 0x23, 0xfe, 0x84, 0x3e, 0xf4, 0x54, 0x70, 
+  0x3c, 0xf4, 0x29, 0x00, 0x00, 0x00, 0xe1, 0xc0, 0xe1, 0xc1, 0x40, 0x40, 
+  0x60, 0x41, 0xc1, 0xc3, 0xc1, 0xc2, 0xcb, 0x44, 0x8e, 0x01, 0xf4, 0x2d, 
+  0x06, 0x24, 0x7e, 0x90, 0xd0, 0x07, 0xe1, 0xff, 0x06, 0x24, 0xfe, 0x90, 
+  0xd6, 0x07, 0xe1, 0xff, 0x28, 0x44, 0x07, 0x24, 0xfe, 0x90, 0x26, 0x00, 
+  0x04, 0x00, 0x03, 0xf4, 0x50, 0x70, 0xe0, 0x7c, 0x50, 0x70, 0x03, 0x21, 
+  0xcc, 0x00, 0x10, 0x70, 0x07, 0x24, 0xc0, 0x10, 0x45, 0x20, 0x40, 0x80, 
+  0xe0, 0x20, 0xc3, 0x07, 0x0c, 0x71, 0x2f, 0x20, 0x03, 0x80, 0xe0, 0x7e, 
+  0x8e, 0x00, 0x20, 0x10, 0x70, 0x8e, 0x00, 0xc4, 0xe0, 0x7c, 0x45, 0x24, 
+  0x4c, 0x10, 0x95, 0x70, 0x0a, 0x00, 0x03, 0x00, 0x22, 0x00, 0x01, 0x08, 
+  0x00, 0xa1, 0x00, 0xe0, 0x7f, 0x14, 0x71, 0xe0, 0x78, 0x07, 0x21, 0x81, 
+  0xda, 0x01, 0x00, 0xc0, 0x02, 0x31, 0x07, 0x23, 0x83, 0x0c, 0x00, 0x75, 
+  0x00, 0x21, 0x44, 0x00, 0x00, 0x23, 0xc5, 0x76, 0x05, 0xf4, 0x09, 0x10, 
+  0x00, 0x06, 0x00, 0x08, 0x44, 0x40, 0x40, 0x81, 0x42, 0x28, 0x44, 0x60, 
+  0x41, 0x81, 0x43, 0x8a, 0x24, 0xdf, 0x1f, 0x40, 0x2c, 0x4c, 0x15, 0x9a, 
+  0x06, 0x44, 0x40, 0x2c, 0x8c, 0x10, 0xae, 0x05, 0xf3, 0x16, 0xc6, 0x01, 
+  0x06, 0x00, 0x41, 0x29, 0x04, 0x05, 0x41, 0x2b, 0x05, 0x05, 0x02, 0x24, 
+  0x46, 0x01, 0x53, 0x26, 0x86, 0x02, 0x07, 0x21, 0xc7, 0x00, 0x40, 0x29, 
+  0xc1, 0x02, 0x41, 0x28, 0x4c, 0x05, 0x85, 0x79, 0x40, 0x28, 0xc0, 0x92, 
+  0x06, 0xf4, 0x59, 0x4c, 0x05, 0x85, 0x7b, 0x40, 0x2a, 0xc2, 0x02, 0x9f, 
+  0xbb, 0x4e, 0x26, 0x0c, 0x88, 0x1c, 0x00, 0x2d, 0x00, 0x01, 0x2a, 0x85, 
+  0x01, 0x8c, 0x26, 0x01, 0x80, 0x01, 0x2b, 0x85, 0x01, 0xca, 0x25, 0x26, 
+  0x00, 0x17, 0x00, 0x20, 0x00, 0x8d, 0x70, 0xd4, 0x70, 0x00, 0x2b, 0x0c, 
+  0x03, 0xc5, 0x25, 0x02, 0x03, 0x01, 0x2b, 0x8c, 0x01, 0x41, 0x2f, 0xc7, 
+  0x87, 0x62, 0x00, 0x22, 0x00, 0x9f, 0xb9, 0x00, 0x25, 0x05, 0x80, 0x01, 
+  0x24, 0x4c, 0x90, 0x10, 0x00, 0x26, 0x00, 0xc2, 0x24, 0x66, 0x00, 0x2f, 
+  0x24, 0x04, 0x93, 0x2f, 0x25, 0x44, 0x01, 0x41, 0x2d, 0xc0, 0x82, 0x40, 
+  0x2c, 0x41, 0x15, 0x25, 0x78, 0x41, 0x2c, 0xc1, 0x12, 0x40, 0x2c, 0x90, 
+  0x06, 0xf0, 0x09, 0x4c, 0x26, 0x00, 0x88, 0xca, 0x23, 0x85, 0x00, 0xca, 
+  0x22, 0x25, 0x00, 0x13, 0x23, 0x83, 0x01, 0x05, 0x23, 0x83, 0x80, 0xd3, 
+  0x25, 0x61, 0x82, 0x1c, 0x02, 0x73, 0xca, 0x27, 0x62, 0x00, 0x00, 0x20, 
+  0xc0, 0xa0, 0x06, 0xea, 0x0e, 0x25, 0x05, 0x80, 0x03, 0x21, 0x0c, 0x83, 
+  0x52, 0x00, 0x23, 0x00, 0x0c, 0x70, 0x50, 0x00, 0x4f, 0x42, 0x24, 0x44, 
+  0x00, 0x54, 0x00, 0x0b, 0x71, 0xca, 0x27, 0x22, 0x00, 0x04, 0x27, 0x07, 
+  0x5c, 0x00, 0x0a, 0x58, 0x00, 0x22, 0xcc, 0x25, 0xf4, 0x06, 0xf0, 0x21, 
+  0x2c, 0x70, 0x2f, 0x28, 0x01, 0x03, 0x9f, 0xe0, 0x14, 0x00, 0x25, 0x00, 
+  0x04, 0x71, 0x2f, 0x28, 0x41, 0x81, 0xca, 0x20, 0x24, 0x08, 0xc0, 0x20, 
+  0x63, 0x08, 0x4e, 0x20, 0x01, 0x88, 0x18, 0x00, 0x2d, 0x00, 0x00, 0x2c, 
+  0x0c, 0x10, 0xc0, 0xe0, 0x00, 0x2d, 0x0c, 0x00, 0xca, 0x24, 0x26, 0x10, 
+  0x08, 0x01, 0xf1, 0x1c, 0xac, 0x70, 0x14, 0x70, 0x01, 0x2d, 0x41, 0x00, 
+  0xc5, 0x24, 0x42, 0x10, 0x00, 0x2d, 0x05, 0x00, 0x53, 0x24, 0x81, 0x02, 
+  0x0e, 0x20, 0x40, 0x80, 0x04, 0x24, 0x84, 0x0f, 0x00, 0x00, 0x00, 0x08, 
+  0x12, 0x00, 0x22, 0x00, 0xc0, 0x20, 0x61, 0x00, 0x2f, 0x24, 0x02, 0x06, 
+  0x01, 0xc0, 0x4c, 0x07, 0xe6, 0xff, 0xc5, 0x24, 0x06, 0x00, 0x4e, 0x20, 
+  0x40, 0x00, 0x56, 0x00, 0x10, 0x1a, 0x60, 0x01, 0x90, 0x2d, 0x05, 0x00, 
+  0xc0, 0xe0, 0x01, 0x2c, 0x05, 0x10, 0x5e, 0x01, 0x00, 0xc6, 0x04, 0xf4, 
+  0x0b, 0x8d, 0x70, 0x14, 0x70, 0x00, 0x2c, 0x41, 0x10, 0xc5, 0x25, 0x42, 
+  0x00, 0x01, 0x2c, 0x0c, 0x10, 0x15, 0x07, 0xef, 0xff, 0x84, 0x71, 0x2f, 
+  0x22, 0x40, 0x90, 0x56, 0x07, 0xb1, 0x8c, 0x02, 0x01, 0x00, 0x2f, 0x23, 
+  0xc0, 0x90, 0x41, 0x26, 0x05, 0x10, 0x00, 0xff, 0x1b, 0xa6, 0x02, 0x01, 
+  0x00, 0x0c, 0x23, 0x80, 0x92, 0xcc, 0x22, 0x01, 0x80, 0x08, 0x42, 0x14, 
+  0x00, 0x0e, 0x00, 0x40, 0x40, 0x41, 0x42, 0x28, 0x42, 0x60, 0x41, 0x41, 
+  0x43, 0x88, 0x42, 0xa0, 0x44, 0x41, 0x45, 0x2f, 0x26, 0x40, 0x00, 0x41, 
+  0x2e, 0x46, 0x85, 0x74, 0x07, 0x57, 0x6f, 0x2f, 0x27, 0xc0, 0x00, 0x41, 
+  0x2f, 0x78, 0x07, 0x5d, 0x00, 0xfe, 0x04, 0x22, 0xa6, 0x03, 0x7c, 0x07, 
+  0x00, 0x0c, 0x00, 0xf1, 0x08, 0xf4, 0x03, 0x21, 0x00, 0x02, 0x26, 0xcb, 
+  0x01, 0x4c, 0x23, 0x80, 0x9d, 0x02, 0x21, 0x49, 0x12, 0x3a, 0x01, 0x09, 
+  0x00, 0x42, 0x23, 0x8a, 0xa2, 0x06, 0xf3, 0x02, 0x8a, 0x00, 0x01, 0x00, 
+  0x24, 0x00, 0x09, 0x00, 0x2f, 0x22, 0x80, 0x80, 0x2f, 0x20, 0x0b, 0x12, 
+  0x40, 0xba, 0x06, 0x10, 0x72, 0xac, 0x05, 0x40, 0x22, 0x80, 0x80, 0x6b, 
+  0x9e, 0x00, 0x30, 0x20, 0x0b, 0x12, 0x8a, 0x06, 0x51, 0x6d, 0x70, 0x28, 
+  0x00, 0x2b, 0xc0, 0x06, 0xc1, 0x0a, 0x21, 0x80, 0x90, 0x12, 0x00, 0x02, 
+  0x00, 0x02, 0x26, 0x8b, 0x72, 0x88, 0x06, 0xd5, 0x28, 0xc9, 0x12, 0x01, 
+  0x28, 0x82, 0x12, 0x3f, 0x00, 0x20, 0x00, 0x0d, 0x70, 0x16, 0x00, 0x26, 
+  0x2a, 0xc9, 0xaa, 0x06, 0x30, 0x28, 0xcb, 0x12, 0x2c, 0x01, 0x01, 0xaa, 
+  0x06, 0x30, 0x28, 0xc2, 0x12, 0x2c, 0x01, 0xe4, 0x0d, 0x70, 0x01, 0x2a, 
+  0x82, 0x02, 0x01, 0x28, 0x88, 0x12, 0x05, 0x22, 0xc2, 0x02, 0xa6, 0x06, 
+  0x04, 0x08, 0x00, 0x00, 0xe6, 0x03, 0x00, 0x8a, 0x00, 0xc0, 0xe0, 0x01, 
+  0x02, 0x00, 0x00, 0x20, 0x80, 0x80, 0x01, 0x21, 0x01, 0x02, 0x8a, 0x06, 
+  0x00, 0x09, 0x04, 0x00, 0x18, 0x00, 0x00, 0x4e, 0x06, 0x06, 0xe2, 0x07, 
+  0x44, 0xc5, 0x21, 0x65, 0x10, 0xe0, 0x06, 0x91, 0x34, 0x00, 0x21, 0x00, 
+  0x35, 0x70, 0xcb, 0x20, 0x61, 0x40, 0x00, 0x13, 0x28, 0xde, 0x06, 0x31, 
+  0xc0, 0x21, 0x65, 0xe2, 0x07, 0x04, 0x40, 0x00, 0x11, 0x10, 0x8e, 0x06, 
+  0x02, 0xe6, 0x06, 0x06, 0xee, 0x07, 0x04, 0x08, 0x00, 0x20, 0xd4, 0x70, 
+  0x24, 0x00, 0x31, 0x66, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x3f, 
+  0x3e, 0x01, 0x0a, 0xfe, 0x07, 0x04, 0x11, 0x14, 0x2c, 0x00, 0x60, 0x76, 
+  0x05, 0xc2, 0xff, 0xd3, 0x73, 0xa8, 0x04, 0x00, 0x0e, 0x00, 0x20, 0x7c, 
+  0x71, 0x20, 0x01, 0x11, 0x54, 0x1a, 0x00, 0xa2, 0x7c, 0x71, 0xca, 0x21, 
+  0x41, 0x00, 0x40, 0x40, 0xe0, 0x7e, 0x10, 0x00, 0x41, 0x5a, 0x05, 0xc2, 
+  0xff, 0xda, 0x00, 0x10, 0x7e, 0x06, 0x00, 0x40, 0x02, 0x26, 0x8a, 0x71, 
+  0xc0, 0x02, 0x13, 0x42, 0x7a, 0x01, 0x71, 0x88, 0x00, 0x0b, 0x00, 0x8c, 
+  0x00, 0x01, 0xfc, 0x07, 0x02, 0xf2, 0x06, 0x11, 0x0b, 0x74, 0x01, 0xf1, 
+  0x0c, 0x05, 0x21, 0x09, 0x90, 0x6d, 0x77, 0x10, 0x00, 0x02, 0x00, 0x00, 
+  0x2b, 0x8b, 0x12, 0x87, 0x23, 0xff, 0x1f, 0x04, 0x21, 0xc9, 0x02, 0x01, 
+  0x29, 0x80, 0x02, 0x5d, 0xf6, 0x07, 0x71, 0x35, 0x70, 0x6d, 0x77, 0x1e, 
+  0x00, 0x02, 0x38, 0x00, 0x76, 0xc2, 0x23, 0xca, 0x12, 0x0a, 0x00, 0x0a, 
+  0x2a, 0x00, 0x17, 0x20, 0x8a, 0x01, 0x12, 0x29, 0x44, 0x02, 0x01, 0x8a, 
+  0x01, 0x21, 0x29, 0xc0, 0x44, 0x02, 0xe0, 0x2c, 0x70, 0x01, 0x28, 0x80, 
+  0x02, 0x01, 0x29, 0x81, 0x02, 0x05, 0x20, 0xc0, 0x02, 0x74, 0x05, 0x04, 
+  0x86, 0x01, 0x04, 0x54, 0x01, 0xc1, 0x1c, 0x00, 0x01, 0x00, 0x44, 0x20, 
+  0x4a, 0x01, 0x05, 0x22, 0x7e, 0x92, 0x80, 0x07, 0x03, 0x56, 0x01, 0x00, 
+  0x3e, 0x04, 0x0c, 0x3c, 0x01, 0x40, 0x02, 0x26, 0x86, 0x01, 0x6a, 0x01, 
+  0x00, 0x2a, 0x01, 0xc0, 0xc0, 0x26, 0x62, 0x00, 0x65, 0xf1, 0x8a, 0x26, 
+  0xdf, 0x0f, 0xc3, 0x41, 0x10, 0x00, 0x40, 0x0c, 0x70, 0x5f, 0xf1, 0x20, 
+  0x00, 0xd3, 0x2c, 0x70, 0xb7, 0x06, 0xef, 0xff, 0x0c, 0x70, 0x02, 0x20, 
+  0x80, 0x80, 0x03, 0xda, 0x01, 0x13, 0x40, 0x9a, 0x01, 0x35, 0x20, 0x00, 
+  0x02, 0x80, 0x00, 0x31, 0x42, 0x26, 0x46, 0xb6, 0x01, 0x04, 0x1c, 0x00, 
+  0x11, 0x52, 0x88, 0x00, 0x02, 0x94, 0x00, 0x71, 0x46, 0x00, 0x21, 0x00, 
+  0x44, 0x20, 0x7e, 0x0c, 0x00, 0x51, 0x1a, 0x00, 0x02, 0x00, 0x35, 0x5e, 
+  0x01, 0x71, 0x32, 0x00, 0x02, 0x00, 0x44, 0x20, 0x3e, 0xfc, 0x01, 0x17, 
+  0x26, 0xa6, 0x00, 0x04, 0xfc, 0x01, 0x00, 0x92, 0x00, 0x00, 0x78, 0x03, 
+  0x0c, 0xb6, 0x00, 0x04, 0x08, 0x00, 0x20, 0xd3, 0x71, 0xa8, 0x00, 0x00, 
+  0x3e, 0x00, 0x51, 0xfc, 0x05, 0xca, 0xff, 0x34, 0xa4, 0x03, 0xd0, 0x2f, 
+  0x2a, 0x41, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x70, 0x08, 0x00, 0x0c, 
+  0xae, 0x03, 0xfb, 0x02, 0x00, 0xc0, 0x22, 0x29, 0x08, 0x9c, 0xf3, 0xca, 
+  0x22, 0xeb, 0x07, 0x6a, 0xba, 0x02, 0x26, 0x8b, 0xf0, 0x10, 0x04, 0x17, 
+  0x08, 0x10, 0x04, 0xa0, 0x29, 0x81, 0x00, 0x05, 0x21, 0xc1, 0x02, 0x00, 
+  0x28, 0x80, 0x1a, 0x01, 0x01, 0xae, 0x00, 0x82, 0x0e, 0x06, 0xcc, 0xff, 
+  0xb7, 0x05, 0xcf, 0xff, 0x6c, 0x00, 0xa0, 0xcc, 0x20, 0x21, 0x80, 0x2f, 
+  0x21, 0x03, 0x01, 0x02, 0x78, 0x94, 0x02, 0xa4, 0x05, 0x21, 0x81, 0x0f, 
+  0xf8, 0x7f, 0x00, 0x00, 0xe0, 0x7e, 0xc0, 0x03, 0x81, 0x28, 0x00, 0x02, 
+  0x00, 0x0c, 0x20, 0x80, 0x9f, 0x2c, 0x00, 0x21, 0x22, 0x21, 0x42, 0x00, 
+  0x11, 0x0a, 0xc2, 0x00, 0x44, 0x43, 0x01, 0xe9, 0xf1, 0x28, 0x03, 0x20, 
+  0xe5, 0xf5, 0x3a, 0x00, 0x00, 0xa6, 0x07, 0x60, 0x0c, 0x70, 0xe0, 0x7e, 
+  0x60, 0x41, 0x70, 0x02, 0x28, 0xe0, 0x78, 0x20, 0x07, 0xf0, 0x54, 0xcb, 
+  0x44, 0xe0, 0xff, 0x00, 0x00, 0x14, 0x24, 0x46, 0x10, 0x14, 0x24, 0xca, 
+  0x10, 0xb6, 0xbc, 0x0c, 0x26, 0x00, 0x83, 0xcc, 0x22, 0x05, 0x93, 0xde, 
+  0x00, 0x26, 0x00, 0x96, 0xbc, 0x04, 0x26, 0x06, 0x03, 0x04, 0x22, 0x0a, 
+  0x13, 0x02, 0x26, 0x86, 0x82, 0x2f, 0x26, 0x84, 0x01, 0x00, 0x26, 0x86, 
+  0x0f, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0x26, 0x0a, 0x83, 0xcc, 0x26, 0x03, 
+  0x83, 0x50, 0x01, 0x04, 0x00, 0x07, 0x21, 0xca, 0x80, 0xcf, 0x26, 0xe4, 
+  0x07, 0x06, 0x21, 0x04, 0x03, 0x86, 0x7b, 0x4f, 0x24, 0x04, 0x05, 0x94, 
+  0xbb, 0x00, 0x45, 0x0c, 0x24, 0xc0, 0x80, 0xcc, 0x25, 0x81, 0x80, 0x14, 
+  0x00, 0x06, 0xe2, 0x00, 0x01, 0x22, 0x03, 0xf4, 0x03, 0x00, 0x25, 0x45, 
+  0x81, 0x01, 0x24, 0x04, 0x01, 0x4a, 0x24, 0x80, 0x75, 0x2c, 0x70, 0xa8, 
+  0x20, 0xc0, 0x04, 0x26, 0x00, 0xf5, 0x00, 0x12, 0x00, 0x05, 0x00, 0x0f, 
+  0x21, 0x01, 0x0f, 0x02, 0x25, 0x85, 0x80, 0x03, 0x24, 0xc4, 0x2a, 0x00, 
+  0x10, 0x05, 0xc8, 0x00, 0x85, 0x24, 0x00, 0x78, 0x0c, 0x70, 0xe8, 0x20, 
+  0xa2, 0x2e, 0x00, 0x10, 0x10, 0x2e, 0x00, 0x2d, 0x20, 0x00, 0x2e, 0x00, 
+  0x71, 0x2f, 0x20, 0x03, 0x00, 0x41, 0x29, 0x81, 0xfc, 0x03, 0x20, 0xc0, 
+  0x71, 0xf4, 0x06, 0xf2, 0x03, 0x44, 0x20, 0x4c, 0x00, 0x05, 0x24, 0x0c, 
+  0x11, 0x05, 0x24, 0x4c, 0x91, 0xe0, 0x7c, 0x40, 0x20, 0x40, 0x80, 0xdc, 
+  0x06, 0x40, 0x02, 0x22, 0x0a, 0x93, 0x36, 0x01, 0x00, 0x22, 0x02, 0x80, 
+  0x2f, 0x26, 0x40, 0xf0, 0x2f, 0x21, 0x04, 0x03, 0x72, 0x01, 0xb1, 0xcf, 
+  0x21, 0xe1, 0x04, 0xe0, 0x7f, 0x0c, 0x70, 0x0c, 0x22, 0x00, 0x20, 0x00, 
+  0xf0, 0x01, 0xca, 0x20, 0x8d, 0x00, 0xe1, 0x20, 0xcd, 0x07, 0xca, 0x21, 
+  0xcd, 0x00, 0x02, 0x26, 0x06, 0x83, 0x24, 0x00, 0x00, 0x14, 0x07, 0x44, 
+  0xca, 0x21, 0x21, 0x00, 0x2a, 0x01, 0x32, 0x4c, 0x00, 0x05, 0x0c, 0x00, 
+  0x01, 0x1c, 0x00, 0x2f, 0xcd, 0x07, 0x3c, 0x00, 0x01, 0x04, 0x14, 0x00, 
+  0x35, 0xcc, 0x26, 0x01, 0x44, 0x00, 0x00, 0x6c, 0x00, 0x04, 0x38, 0x00, 
+  0xa4, 0xc0, 0x78, 0xe0, 0x7f, 0xc0, 0x79, 0x2f, 0x25, 0xc0, 0x80, 0xca, 
+  0x06, 0x04, 0xd4, 0x01, 0xb1, 0x02, 0x03, 0x21, 0x00, 0x2f, 0x21, 0x40, 
+  0x90, 0xc7, 0x24, 0x65, 0x14, 0x02, 0x01, 0xd8, 0x02, 0x7f, 0x03, 0x01, 
+  0x00, 0x41, 0x29, 0x46, 0x95, 0xb4, 0x06, 0x57, 0x2f, 0x41, 0x2d, 0xb0, 
+  0x06, 0x61, 0x26, 0x62, 0x02, 0xb0, 0x06, 0x20, 0x8a, 0x02, 0xb0, 0x06, 
+  0xf4, 0x19, 0xc6, 0x01, 0x80, 0x26, 0xcf, 0x0f, 0x4a, 0x24, 0xc0, 0x7d, 
+  0x6d, 0x70, 0x4d, 0x70, 0xa8, 0x20, 0x40, 0x05, 0x2f, 0x22, 0x80, 0x92, 
+  0x2f, 0x23, 0xcb, 0x12, 0x11, 0x71, 0xcc, 0x20, 0x81, 0x80, 0xc5, 0x22, 
+  0x66, 0x10, 0x0e, 0x00, 0x05, 0x00, 0x42, 0x04, 0x04, 0x32, 0x04, 0x84, 
+  0x05, 0x21, 0x09, 0x00, 0x61, 0x41, 0x41, 0x40, 0x36, 0x04, 0x57, 0xc2, 
+  0x26, 0x61, 0x00, 0x0e, 0x52, 0x04, 0x02, 0xda, 0x05, 0x35, 0x72, 0x00, 
+  0x0c, 0x48, 0x04, 0x14, 0x34, 0xdc, 0x04, 0x21, 0x21, 0xbe, 0xdc, 0x04, 
+  0x1f, 0x24, 0x36, 0x04, 0x04, 0x00, 0x6c, 0x01, 0x0f, 0x36, 0x04, 0x05, 
+  0x04, 0xc8, 0x00, 0x1f, 0x22, 0x26, 0x06, 0x06, 0x08, 0xaa, 0x06, 0x08, 
+  0x0c, 0x00, 0x40, 0x8c, 0x26, 0xff, 0x82, 0x3a, 0x00, 0x4f, 0xfa, 0x00, 
+  0x0b, 0x00, 0x0c, 0x06, 0xcf, 0x17, 0x72, 0x0c, 0x06, 0x12, 0xd9, 0x02, 
+  0x06, 0x01, 0x0e, 0x06, 0x11, 0xcd, 0x0c, 0x00, 0x04, 0xfa, 0x02, 0x80, 
+  0x70, 0x00, 0x01, 0x00, 0x0c, 0x21, 0x80, 0x9f, 0xb0, 0x04, 0x20, 0xc3, 
+  0x41, 0xd4, 0x04, 0x60, 0x5c, 0x00, 0x0d, 0x00, 0x94, 0x70, 0xfe, 0x02, 
+  0x00, 0x62, 0x07, 0x00, 0xe2, 0x04, 0x40, 0x0c, 0x25, 0x80, 0x8f, 0x20, 
+  0x00, 0x00, 0x82, 0x00, 0x60, 0x40, 0x00, 0x0d, 0x00, 0x2c, 0x70, 0x2c, 
+  0x04, 0x04, 0x4c, 0x03, 0x3b, 0x2c, 0x00, 0x02, 0x30, 0x00, 0x06, 0xd8, 
+  0x05, 0x00, 0x38, 0x01, 0x04, 0x6c, 0x02, 0x00, 0x1a, 0x02, 0x20, 0xc3, 
+  0x41, 0x70, 0x05, 0x00, 0x24, 0x00, 0x00, 0x86, 0x05, 0x08, 0x46, 0x05, 
+  0x08, 0x76, 0x05, 0x40, 0xca, 0x20, 0x21, 0x00, 0x0c, 0x04, 0xf1, 0x0a, 
+  0x08, 0x00, 0x02, 0x00, 0xe0, 0x7e, 0xe6, 0xf1, 0xe0, 0x78, 0x2f, 0x23, 
+  0x40, 0x80, 0x4a, 0x24, 0xc0, 0x02, 0x14, 0x00, 0x26, 0x00, 0x6f, 0x22, 
+  0x0a, 0x04, 0x00, 0xf3, 0x4a, 0x2f, 0x22, 0x82, 0x00, 0x4a, 0x24, 0x80, 
+  0x02, 0x2f, 0x24, 0x40, 0x90, 0xc0, 0x22, 0x65, 0x00, 0x41, 0x2c, 0x43, 
+  0x15, 0x8c, 0x23, 0xdf, 0x8f, 0x48, 0x00, 0x21, 0x00, 0x53, 0x21, 0x01, 
+  0x85, 0x8e, 0x23, 0xd0, 0x84, 0x1a, 0x00, 0x24, 0x00, 0x94, 0xb9, 0x9f, 
+  0xe3, 0x01, 0x29, 0xc0, 0x00, 0xca, 0x20, 0x29, 0x00, 0x51, 0x22, 0x00, 
+  0x80, 0xe0, 0x7f, 0xce, 0x20, 0x21, 0x00, 0x4e, 0x23, 0x03, 0x00, 0x90, 
+  0x73, 0x4e, 0x23, 0x0c, 0x08, 0x01, 0x28, 0x00, 0x03, 0x00, 0x29, 0xc1, 
+  0x00, 0x25, 0x78, 0xca, 0x20, 0x89, 0x00, 0xd1, 0x22, 0x2c, 0x22, 0x00, 
+  0x00, 0x1e, 0x01, 0xf0, 0x2e, 0x40, 0x40, 0xd1, 0x20, 0x22, 0x80, 0xe0, 
+  0x7f, 0xc0, 0x20, 0x62, 0x00, 0xe4, 0xc2, 0x76, 0x08, 0x20, 0x00, 0x08, 
+  0x46, 0x04, 0x77, 0x69, 0x08, 0xb4, 0x00, 0xc9, 0x45, 0x2c, 0x70, 0x3a, 
+  0x09, 0x20, 0x00, 0xc1, 0x40, 0x59, 0xf6, 0x52, 0x26, 0xce, 0x17, 0x66, 
+  0x0a, 0xef, 0xef, 0xc1, 0x40, 0xc1, 0x41, 0x82, 0x09, 0x20, 0x00, 0x08, 
+  0x45, 0x3f, 0xde, 0x18, 0xbe, 0x1a, 0x1e, 0x00, 0xf3, 0x07, 0x41, 0x88, 
+  0xf6, 0x4f, 0x26, 0xc1, 0x15, 0x7e, 0x09, 0x20, 0x00, 0xa1, 0x40, 0x08, 
+  0x45, 0x52, 0x25, 0xcd, 0x17, 0x14, 0xf0, 0x3a, 0x2c, 0x00, 0x15, 0x56, 
+  0x2c, 0x00, 0x26, 0xee, 0x08, 0x2c, 0x00, 0x13, 0x52, 0x2c, 0x00, 0xf0, 
+  0x01, 0xa1, 0x40, 0xc4, 0xc6, 0xe2, 0xc2, 0x08, 0x45, 0x50, 0x20, 0xfe, 
+  0x87, 0x08, 0xf2, 0x32, 0x08, 0x16, 0x00, 0xd4, 0x14, 0x70, 0x0c, 0x71, 
+  0x04, 0xf2, 0xc2, 0xc6, 0x0c, 0x75, 0xc2, 0xc6, 0x2a, 0x12, 0x00, 0x41, 
+  0x72, 0xf9, 0xf5, 0x36, 0x0c, 0x00, 0xf1, 0x02, 0x78, 0x20, 0x00, 0x00, 
+  0x04, 0x73, 0xc2, 0xc6, 0xe0, 0x78, 0xbf, 0xb8, 0x38, 0x20, 0x80, 0x0f, 
+  0x80, 0xdc, 0x06, 0xf3, 0x0a, 0xff, 0xda, 0x17, 0xba, 0x53, 0x20, 0x81, 
+  0x05, 0x44, 0x78, 0x79, 0x21, 0x01, 0x00, 0x38, 0x20, 0x80, 0x00, 0xe0, 
+  0x7f, 0x24, 0x78, 0xe0, 0x78, 0xe4, 0x5c, 0x00, 0xa0, 0xcd, 0x70, 0x16, 
+  0xf2, 0xd6, 0xb8, 0x04, 0x25, 0x81, 0x1f, 0x30, 0x00, 0xf1, 0x06, 0x79, 
+  0x20, 0x02, 0x00, 0x78, 0x21, 0x00, 0x00, 0x4b, 0x78, 0x0a, 0xf4, 0xbe, 
+  0x0f, 0xef, 0xff, 0xa1, 0x40, 0x86, 0xe8, 0xc2, 0x08, 0x00, 0xf0, 0x1f, 
+  0x78, 0x20, 0x0e, 0x00, 0xc1, 0x40, 0xc4, 0xc6, 0x30, 0x70, 0x07, 0xf2, 
+  0x3b, 0x79, 0x1b, 0x78, 0xe0, 0x7f, 0x05, 0x20, 0x7e, 0x80, 0x1b, 0x78, 
+  0xc3, 0x41, 0x00, 0xff, 0x00, 0x00, 0x30, 0x70, 0xe0, 0x7f, 0xcc, 0x20, 
+  0x0e, 0x80, 0x53, 0x20, 0xbe, 0x85, 0x17, 0xf2, 0x0c, 0x71, 0x36, 0x06, 
+  0xf0, 0x09, 0xe0, 0x7f, 0x42, 0x20, 0x40, 0x80, 0x53, 0x21, 0xbe, 0x85, 
+  0x12, 0xf2, 0xf8, 0xf1, 0x08, 0x44, 0x20, 0x40, 0x81, 0x41, 0xe0, 0x78, 
+  0xcb, 0x44, 0x68, 0x00, 0xf1, 0x2e, 0x06, 0x24, 0x3e, 0x90, 0xd6, 0x07, 
+  0xe1, 0xff, 0x06, 0x24, 0x7e, 0x90, 0xe0, 0x07, 0xe1, 0xff, 0x08, 0x44, 
+  0x07, 0x20, 0x7e, 0x80, 0x20, 0x00, 0x04, 0x00, 0x02, 0x20, 0x4c, 0x80, 
+  0xe0, 0x7c, 0x10, 0x70, 0x07, 0x24, 0x40, 0x90, 0xe1, 0x20, 0xc3, 0x07, 
+  0xca, 0x20, 0x61, 0x80, 0x0c, 0x71, 0xe0, 0x7f, 0x2f, 0x20, 0x03, 0x80, 
+  0x1b, 0x78, 0x3b, 0x79, 0x05, 0x20, 0x40, 0xea, 0x05, 0xa4, 0x14, 0x70, 
+  0x40, 0x24, 0x4c, 0x90, 0xe0, 0x20, 0xc3, 0x07, 0x1e, 0x00, 0x51, 0xe0, 
+  0x78, 0x07, 0x20, 0x80, 0x86, 0x02, 0x00, 0x4c, 0x03, 0x31, 0x07, 0x21, 
+  0x81, 0x0c, 0x00, 0xf0, 0x05, 0x1a, 0x60, 0x3b, 0x61, 0x70, 0x72, 0xca, 
+  0x22, 0x05, 0x00, 0xca, 0x20, 0x45, 0x00, 0xca, 0x21, 0x85, 0x00, 0xc3, 
+  0x44, 0xb2, 0x00, 0xf0, 0x15, 0x40, 0x2c, 0x85, 0x00, 0x14, 0x24, 0x02, 
+  0x00, 0x14, 0x24, 0x43, 0x00, 0xb0, 0x72, 0xcc, 0x23, 0x4e, 0x81, 0xca, 
+  0x00, 0x0d, 0x00, 0x41, 0x28, 0xc2, 0x05, 0x41, 0x29, 0xc3, 0x05, 0x74, 
+  0x4a, 0xc7, 0xbc, 0x99, 0xe4, 0x6a, 0x06, 0x00, 0x98, 0x00, 0xf0, 0x1d, 
+  0x40, 0x28, 0x00, 0x02, 0x40, 0x29, 0x01, 0x02, 0x9f, 0xb8, 0x9f, 0xb9, 
+  0x38, 0x00, 0x24, 0x00, 0x01, 0x29, 0x03, 0x03, 0x00, 0x23, 0x03, 0x80, 
+  0xc2, 0x22, 0x66, 0x00, 0xc0, 0x23, 0xc6, 0x80, 0x2f, 0x23, 0xc4, 0x00, 
+  0x41, 0x2b, 0x00, 0x82, 0x40, 0x2a, 0xc2, 0x05, 0x22, 0x07, 0xe2, 0x58, 
+  0x60, 0x51, 0x20, 0x00, 0x80, 0xd3, 0x23, 0xa1, 0x81, 0xd3, 0x21, 0x01, 
+  0x83, 0x40, 0x02, 0xa0, 0x0e, 0x23, 0x03, 0x80, 0x2e, 0x00, 0x23, 0x00, 
+  0x0c, 0x70, 0x2a, 0x00, 0x26, 0x61, 0xba, 0x2c, 0x00, 0xd1, 0x13, 0x21, 
+  0x01, 0x83, 0xc0, 0x79, 0xca, 0x21, 0x61, 0x00, 0x04, 0x21, 0x01, 0x36, 
+  0x00, 0x02, 0x32, 0x00, 0x00, 0xe6, 0x00, 0xf4, 0x29, 0x53, 0x22, 0xc5, 
+  0x01, 0x2f, 0x28, 0xc1, 0x00, 0x04, 0x71, 0x00, 0x2b, 0x03, 0x00, 0x0e, 
+  0x20, 0x40, 0x81, 0x84, 0x22, 0x04, 0x00, 0xc0, 0x20, 0x61, 0x00, 0xc1, 
+  0x2b, 0x61, 0x00, 0xb6, 0x07, 0xe6, 0xff, 0xc5, 0x22, 0x06, 0x00, 0x4e, 
+  0x20, 0x40, 0x00, 0x01, 0x2b, 0x03, 0x00, 0xa7, 0x07, 0xef, 0xff, 0x44, 
+  0x71, 0x2f, 0x22, 0x00, 0x90, 0xf2, 0x06, 0xb1, 0x4e, 0x02, 0x01, 0x00, 
+  0x2f, 0x23, 0x40, 0x90, 0x41, 0x26, 0x05, 0x10, 0x00, 0x02, 0x54, 0x03, 
+  0xf0, 0x16, 0x0c, 0x23, 0x80, 0x92, 0x00, 0x42, 0x10, 0x00, 0x0e, 0x00, 
+  0x20, 0x40, 0x40, 0x41, 0x80, 0x42, 0xa0, 0x44, 0x40, 0x45, 0x2f, 0x26, 
+  0x00, 0x00, 0x41, 0x2e, 0x06, 0x86, 0x53, 0x20, 0x88, 0x05, 0xcf, 0x20, 
+  0xe2, 0x15, 0x14, 0xca, 0x05, 0xf4, 0x0e, 0x2a, 0x01, 0x02, 0x67, 0xba, 
+  0x00, 0x28, 0x88, 0x10, 0x61, 0xba, 0x02, 0x26, 0x86, 0x00, 0x2f, 0x27, 
+  0x40, 0x00, 0x41, 0x2f, 0x07, 0x86, 0x53, 0x21, 0x89, 0x05, 0xcf, 0x21, 
+  0x24, 0x00, 0x10, 0x41, 0x24, 0x00, 0x20, 0x29, 0x89, 0x24, 0x00, 0xf1, 
+  0x01, 0x27, 0x87, 0x00, 0x8c, 0x26, 0xc3, 0x8f, 0xe4, 0x01, 0x21, 0x00, 
+  0x8c, 0x27, 0xc3, 0x8f, 0x16, 0x60, 0x06, 0xf0, 0x0b, 0xcb, 0x01, 0x4c, 
+  0x23, 0x40, 0x96, 0x62, 0x7b, 0x08, 0x00, 0x0c, 0x00, 0xe0, 0x7e, 0x42, 
+  0x23, 0x82, 0x90, 0x2f, 0x20, 0x00, 0x12, 0x28, 0x00, 0x01, 0x00, 0x12, 
+  0x05, 0xf0, 0x15, 0x2f, 0x21, 0x40, 0x12, 0x40, 0x22, 0x42, 0x80, 0x19, 
+  0x00, 0x20, 0x00, 0xc0, 0x21, 0x4b, 0x12, 0x4a, 0x22, 0x00, 0x18, 0x02, 
+  0x22, 0x8a, 0x10, 0x00, 0x29, 0x83, 0x12, 0x01, 0x29, 0x89, 0x10, 0x0c, 
+  0x24, 0x40, 0x81, 0x30, 0x00, 0x10, 0xfa, 0x84, 0x05, 0xb0, 0x20, 0x48, 
+  0x12, 0x04, 0x20, 0xbe, 0x9f, 0x00, 0x04, 0x00, 0x00, 0x22, 0x07, 0x90, 
+  0xc4, 0x71, 0x2f, 0x20, 0x02, 0x92, 0xc5, 0x23, 0x65, 0x32, 0x05, 0xf4, 
+  0x04, 0x90, 0x26, 0x00, 0x21, 0x00, 0x74, 0x70, 0xcb, 0x20, 0x61, 0x91, 
+  0xc0, 0x20, 0xa2, 0x10, 0x16, 0x00, 0x01, 0x00, 0x2c, 0x00, 0x10, 0x0a, 
+  0x50, 0x06, 0x31, 0x20, 0x02, 0x12, 0x30, 0x00, 0x10, 0x12, 0x04, 0x00, 
+  0x51, 0xd4, 0x70, 0x22, 0x00, 0x0c, 0xac, 0x00, 0x80, 0x8e, 0x00, 0x0a, 
+  0x00, 0x06, 0x20, 0x80, 0x1f, 0x7c, 0x06, 0xf3, 0x02, 0x40, 0x2e, 0xc2, 
+  0x05, 0x45, 0x78, 0x94, 0x70, 0xcf, 0x20, 0xe2, 0x07, 0xe0, 0x7e, 0x02, 
+  0x26, 0x82, 0x24, 0x06, 0xf0, 0x06, 0x42, 0x80, 0x36, 0x00, 0x0c, 0x00, 
+  0x74, 0x70, 0x1c, 0x00, 0x02, 0x00, 0x4d, 0x77, 0xa0, 0xe2, 0xc2, 0x22, 
+  0x8a, 0x12, 0x08, 0xea, 0x05, 0x50, 0x2a, 0x8a, 0x10, 0x87, 0x22, 0xea, 
+  0x05, 0x71, 0x83, 0x12, 0xa0, 0xe2, 0xc2, 0x20, 0x0a, 0x00, 0x06, 0x50, 
+  0x01, 0x28, 0x88, 0x10, 0x0b, 0x86, 0x05, 0x30, 0x20, 0x0b, 0x12, 0x98, 
+  0x00, 0x11, 0x14, 0xc6, 0x05, 0xc4, 0x42, 0x11, 0x05, 0x22, 0xfe, 0x80, 
+  0x08, 0x00, 0x01, 0x00, 0x05, 0x72, 0x86, 0x00, 0x01, 0xb4, 0x05, 0x34, 
+  0x20, 0x80, 0x9f, 0xf8, 0x06, 0x80, 0xbc, 0xf1, 0x8a, 0x26, 0xc3, 0x0f, 
+  0xcb, 0x40, 0x10, 0x00, 0xb4, 0xb6, 0xf1, 0x81, 0x07, 0xef, 0xff, 0x02, 
+  0x20, 0x00, 0x12, 0x02, 0xf6, 0x00, 0x10, 0x02, 0x54, 0x00, 0x92, 0x01, 
+  0x12, 0x16, 0x00, 0x02, 0x00, 0x42, 0x26, 0x46, 0xde, 0x00, 0x41, 0x02, 
+  0x00, 0x00, 0x3e, 0x60, 0x00, 0xa0, 0xbe, 0x90, 0x36, 0x00, 0x21, 0x00, 
+  0x44, 0x20, 0x7e, 0x90, 0xfe, 0x00, 0xdf, 0x18, 0x00, 0x02, 0x00, 0x74, 
+  0x70, 0x22, 0x00, 0x02, 0x00, 0x44, 0x20, 0x3e, 0x10, 0x01, 0x10, 0x00, 
+  0x80, 0x05, 0x00, 0x76, 0x00, 0x82, 0xea, 0x06, 0xca, 0xff, 0x15, 0x70, 
+  0xc3, 0xf3, 0xfa, 0x01, 0x40, 0x02, 0x26, 0x86, 0x80, 0xfe, 0x01, 0x80, 
+  0xf6, 0x06, 0xcc, 0xff, 0x6e, 0xf1, 0xd3, 0x71, 0x50, 0x03, 0x50, 0x3c, 
+  0x70, 0xca, 0x20, 0x01, 0x44, 0x02, 0x03, 0x32, 0x00, 0x20, 0x06, 0x00, 
+  0x0e, 0x00, 0x00, 0xee, 0x01, 0x00, 0xdc, 0x00, 0x20, 0xe0, 0x7e, 0x4e, 
+  0x06, 0x00, 0x18, 0x00, 0x23, 0x3c, 0x70, 0x10, 0x00, 0x41, 0x24, 0x40, 
+  0x81, 0x06, 0x76, 0x02, 0x31, 0xc3, 0x40, 0xc0, 0x92, 0x04, 0xf0, 0x66, 
+  0x20, 0x40, 0xe0, 0x7e, 0xe0, 0x78, 0xe6, 0xc0, 0x55, 0x20, 0x03, 0x08, 
+  0x60, 0x10, 0x01, 0x01, 0x7c, 0x10, 0x08, 0x01, 0x9e, 0x80, 0x45, 0x83, 
+  0x00, 0x20, 0x48, 0x10, 0x3c, 0x80, 0x00, 0x24, 0x8b, 0x10, 0x99, 0x80, 
+  0xdd, 0x80, 0x43, 0x83, 0xa0, 0x83, 0xe4, 0x83, 0x59, 0x61, 0xbc, 0x64, 
+  0xfe, 0x66, 0x55, 0x21, 0x02, 0x08, 0x55, 0x24, 0x01, 0x18, 0x55, 0x26, 
+  0x0c, 0x18, 0x28, 0xbc, 0x55, 0x23, 0x0f, 0x18, 0x90, 0x7e, 0x28, 0xbf, 
+  0x28, 0xba, 0x8c, 0x26, 0x82, 0x9c, 0x54, 0x00, 0x2d, 0x00, 0x28, 0xb9, 
+  0xa2, 0x83, 0x9b, 0x80, 0x04, 0x13, 0x0b, 0x00, 0x7a, 0x80, 0xbc, 0x64, 
+  0x55, 0x24, 0x0c, 0x18, 0x84, 0x2c, 0x04, 0x10, 0x61, 0x73, 0x2f, 0x20, 
+  0x08, 0x02, 0x55, 0x23, 0x03, 0x08, 0xfe, 0xe0, 0x62, 0x26, 0x00, 0xf0, 
+  0x1a, 0xbb, 0xf0, 0x7d, 0x97, 0x0d, 0x35, 0x16, 0xbd, 0xe0, 0x0e, 0x01, 
+  0x0d, 0x00, 0x30, 0x79, 0xaa, 0xe1, 0xc0, 0x01, 0x2d, 0x00, 0x9a, 0xe0, 
+  0xaa, 0x02, 0x2d, 0x00, 0x34, 0x74, 0x88, 0x03, 0x26, 0x00, 0x50, 0x78, 
+  0x0c, 0xda, 0x8c, 0xba, 0x64, 0xf0, 0x38, 0x00, 0xd0, 0x8c, 0x20, 0x03, 
+  0x87, 0x60, 0x00, 0x2d, 0x00, 0x8c, 0x20, 0xc2, 0x82, 0x9e, 0x08, 0x00, 
+  0xf0, 0x15, 0x26, 0xc3, 0x9c, 0xfc, 0x00, 0x2d, 0x00, 0x30, 0x78, 0xf0, 
+  0x79, 0xc3, 0x40, 0x00, 0x00, 0xe7, 0x31, 0xc3, 0x42, 0x00, 0x00, 0xfc, 
+  0x25, 0x8c, 0x21, 0xc9, 0x84, 0x48, 0xf0, 0x30, 0x79, 0x8c, 0x21, 0x43, 
+  0x8a, 0x90, 0x28, 0x00, 0xf1, 0x00, 0x21, 0x82, 0x80, 0xf2, 0x00, 0x2d, 
+  0x00, 0x50, 0x7a, 0x8c, 0x22, 0x5f, 0x84, 0x98, 0x01, 0x42, 0x00, 0xf0, 
+  0x00, 0x8b, 0x5c, 0x02, 0x2d, 0x00, 0x8c, 0x22, 0x9f, 0x81, 0x38, 0x03, 
+  0x26, 0x00, 0xd5, 0xe1, 0x3a, 0x00, 0xf0, 0x0e, 0x3b, 0x53, 0x30, 0xf0, 
+  0xe8, 0xda, 0x8e, 0xba, 0x2c, 0xf0, 0x30, 0x7c, 0x8c, 0x24, 0xc8, 0x91, 
+  0xf0, 0x00, 0x2d, 0x00, 0xa5, 0xe5, 0x70, 0x01, 0x2d, 0x00, 0xe3, 0xe0, 
+  0x34, 0x2e, 0x00, 0xf1, 0x05, 0x24, 0xc4, 0x9d, 0x16, 0x03, 0x2d, 0x00, 
+  0x70, 0x78, 0xd3, 0x70, 0x00, 0x00, 0xc0, 0x0a, 0xf6, 0x03, 0x2d, 0x00, 
+  0x50, 0x7a, 0x00, 0x20, 0x6e, 0x48, 0x40, 0x00, 0xb1, 0x2b, 0x28, 0xd3, 
+  0x71, 0x00, 0x00, 0x11, 0x08, 0x0a, 0xf0, 0x30, 0x16, 0x00, 0x20, 0x7f, 
+  0x22, 0x16, 0x00, 0x60, 0x18, 0x32, 0x8c, 0x21, 0xd6, 0x80, 0xee, 0x04, 
+  0xf0, 0x0d, 0x50, 0x78, 0xc6, 0xc4, 0x70, 0x7b, 0xc1, 0x0b, 0x85, 0x0f, 
+  0x00, 0x00, 0x4c, 0x0b, 0x8c, 0x20, 0x84, 0x83, 0x24, 0x01, 0x0d, 0x00, 
+  0xd3, 0x73, 0x00, 0x00, 0x72, 0x0a, 0x30, 0x00, 0x20, 0x85, 0x55, 0x30, 
+  0x00, 0xf0, 0x13, 0xb2, 0x47, 0xea, 0xf1, 0x50, 0x7a, 0xd3, 0x72, 0x00, 
+  0x00, 0x0b, 0x08, 0x18, 0x01, 0x2d, 0x00, 0xdb, 0xe0, 0xd0, 0x01, 0x2d, 
+  0x00, 0x8e, 0x78, 0x8c, 0x20, 0xb4, 0x80, 0xa2, 0x02, 0x2a, 0x00, 0xd5, 
+  0x73, 0x26, 0x00, 0xa4, 0x03, 0x15, 0xda, 0xf1, 0x8c, 0x20, 0x90, 0x8e, 
+  0x14, 0x01, 0x84, 0x00, 0x20, 0xa2, 0x30, 0x18, 0x00, 0x21, 0x97, 0x23, 
+  0x84, 0x00, 0x82, 0x10, 0xc8, 0xf1, 0x8c, 0x22, 0x1f, 0x88, 0x00, 0xec, 
+  0x00, 0x34, 0x8d, 0xa6, 0x01, 0xb6, 0x00, 0x42, 0xe6, 0x0c, 0x80, 0x02, 
+  0x4e, 0x00, 0xa0, 0x49, 0x87, 0x40, 0x03, 0x2a, 0x00, 0x8c, 0x22, 0xdf, 
+  0x81, 0x38, 0x00, 0x80, 0x7c, 0x54, 0xb2, 0xf1, 0x50, 0x79, 0xef, 0x09, 
+  0x9c, 0x00, 0x20, 0x2a, 0x09, 0x44, 0x00, 0x80, 0xad, 0x08, 0x76, 0x01, 
+  0x2d, 0x00, 0xc9, 0xe0, 0x5c, 0x00, 0x20, 0x7b, 0x19, 0x24, 0x00, 0x91, 
+  0x50, 0x59, 0x9e, 0xf1, 0x8c, 0x20, 0x82, 0x86, 0xe8, 0x54, 0x01, 0x61, 
+  0x44, 0x88, 0x50, 0x79, 0x5e, 0xda, 0x1e, 0x00, 0x30, 0x5a, 0x8d, 0xba, 
+  0x32, 0x00, 0x70, 0xa4, 0x0a, 0x8e, 0xf1, 0xf9, 0xe1, 0x52, 0x92, 0x00, 
+  0xb0, 0x7a, 0x8c, 0x22, 0x1f, 0x8e, 0x1c, 0x02, 0x2d, 0x00, 0x70, 0x79, 
+  0x1a, 0x00, 0x30, 0x67, 0x0c, 0xe4, 0x76, 0x00, 0x70, 0x79, 0x8c, 0x22, 
+  0xdf, 0x82, 0xb6, 0x03, 0x3e, 0x00, 0x20, 0xc5, 0x86, 0x3a, 0x00, 0x20, 
+  0x2f, 0x12, 0x58, 0x00, 0x40, 0xdd, 0x44, 0x5b, 0xf0, 0x08, 0x00, 0x90, 
+  0x27, 0x51, 0x70, 0xf1, 0xaa, 0xe0, 0x2a, 0x01, 0x26, 0xd2, 0x00, 0x70, 
+  0x42, 0x00, 0x00, 0xc7, 0x2a, 0x68, 0xf1, 0x1e, 0x01, 0x72, 0x16, 0x0b, 
+  0x30, 0x01, 0x26, 0x00, 0xf0, 0x14, 0x00, 0x30, 0x51, 0x5e, 0xf1, 0xda, 
+  0x01, 0x90, 0x03, 0x81, 0x2c, 0x01, 0x2d, 0x00, 0xcb, 0xe0, 0xc6, 0x1c, 
+  0x01, 0x61, 0xe5, 0x9a, 0x02, 0x26, 0x00, 0xeb, 0xc4, 0x01, 0x40, 0xf7, 
+  0x56, 0x4e, 0xf1, 0x08, 0x00, 0x60, 0x0f, 0x30, 0x4a, 0xf1, 0x94, 0xe6, 
+  0x40, 0x01, 0x31, 0xd5, 0x71, 0xae, 0x06, 0x01, 0x80, 0xc3, 0x85, 0x80, 
+  0x02, 0x26, 0x00, 0x8e, 0x78, 0x1e, 0x00, 0x81, 0xe8, 0x54, 0x3a, 0xf1, 
+  0x8c, 0x26, 0x42, 0x93, 0x20, 0x01, 0x90, 0x24, 0xd0, 0x94, 0x96, 0x01, 
+  0x2d, 0x00, 0x73, 0xda, 0xaa, 0x00, 0x20, 0xa9, 0x0d, 0x98, 0x00, 0xf0, 
+  0x00, 0x04, 0x27, 0x8d, 0xba, 0x28, 0xf1, 0xf2, 0x00, 0x0d, 0x00, 0xf0, 
+  0x78, 0x90, 0xe0, 0x7e, 0x64, 0x00, 0x01, 0x64, 0x01, 0x20, 0x85, 0x43, 
+  0x3e, 0x00, 0xb1, 0x35, 0x55, 0x8c, 0x21, 0x8f, 0x8e, 0x6d, 0x03, 0x00, 
+  0x00, 0x50, 0x54, 0x01, 0x71, 0x4c, 0x08, 0x66, 0x01, 0x26, 0x00, 0x70, 
+  0xa0, 0x00, 0x31, 0xe4, 0x57, 0x0e, 0x80, 0x00, 0x42, 0x63, 0x51, 0x0a, 
+  0xf1, 0x98, 0x01, 0x20, 0xe3, 0x54, 0x10, 0x00, 0x20, 0x73, 0x22, 0x5e, 
+  0x00, 0xf0, 0x05, 0x9e, 0x08, 0xf9, 0x05, 0xcf, 0xff, 0xb5, 0x70, 0xd4, 
+  0xf2, 0x30, 0x78, 0xe7, 0xe0, 0xa8, 0x01, 0x26, 0x00, 0xd5, 0x74, 0x1e, 
+  0x00, 0x31, 0xeb, 0x52, 0xd8, 0x02, 0x01, 0x60, 0x28, 0x52, 0xd4, 0xf0, 
+  0xda, 0xe6, 0x36, 0x00, 0x20, 0x8b, 0x2b, 0x10, 0x00, 0x70, 0x07, 0x35, 
+  0xd4, 0xf0, 0xd5, 0x72, 0x1a, 0xa6, 0x00, 0x31, 0x21, 0x02, 0x88, 0x54, 
+  0x02, 0x10, 0x18, 0x18, 0x00, 0x40, 0xa6, 0x13, 0xc8, 0xf0, 0x50, 0x00, 
+  0x31, 0x0a, 0x08, 0x10, 0x9e, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x43, 0x25, 
+  0x1a, 0x00, 0x40, 0xfa, 0x49, 0xbc, 0xf0, 0x0e, 0x00, 0x20, 0x2b, 0x47, 
+  0x0e, 0x00, 0x71, 0xf4, 0x55, 0x98, 0xe1, 0xb4, 0xf0, 0xe1, 0x20, 0x00, 
+  0x11, 0xfd, 0x3a, 0x00, 0x31, 0x75, 0x58, 0xac, 0x6a, 0x00, 0x80, 0xd0, 
+  0x44, 0xa0, 0xf0, 0x8c, 0x25, 0x46, 0x99, 0x1a, 0x00, 0x20, 0x76, 0x32, 
+  0x12, 0x00, 0xf0, 0x00, 0x12, 0x25, 0x9e, 0xf0, 0xd7, 0x0e, 0xb5, 0x10, 
+  0x8c, 0x20, 0xc6, 0x83, 0x78, 0x01, 0x26, 0xf2, 0x00, 0x70, 0x42, 0x00, 
+  0x00, 0x48, 0x44, 0x8c, 0xf0, 0xe4, 0x00, 0x35, 0x4d, 0x08, 0x76, 0xe4, 
+  0x00, 0x40, 0x1a, 0x12, 0x82, 0xf0, 0x22, 0x00, 0x11, 0x70, 0x4c, 0x01, 
+  0x32, 0x81, 0x52, 0x7a, 0x52, 0x00, 0x45, 0x1a, 0x76, 0xf0, 0x80, 0x68, 
+  0x02, 0x30, 0x95, 0x0c, 0xe8, 0xb6, 0x00, 0x30, 0x22, 0x9f, 0x81, 0x62, 
+  0x00, 0x20, 0xb0, 0x49, 0x22, 0x00, 0x31, 0xbf, 0x17, 0x6e, 0x2a, 0x00, 
+  0xa0, 0x8d, 0x51, 0x62, 0xf0, 0xa9, 0xe0, 0x68, 0x01, 0x06, 0x00, 0x0e, 
+  0x00, 0x80, 0x6d, 0x14, 0x5a, 0xf0, 0xb5, 0x70, 0xc5, 0xf2, 0x0c, 0x00, 
+  0x31, 0xc6, 0x52, 0x54, 0x22, 0x00, 0x31, 0xa4, 0x52, 0x50, 0x08, 0x00, 
+  0x31, 0x15, 0x2c, 0x4c, 0x08, 0x00, 0x31, 0xf6, 0x57, 0x48, 0xd6, 0x00, 
+  0x11, 0x21, 0x22, 0x03, 0x20, 0xc8, 0x14, 0xfc, 0x00, 0x71, 0xb2, 0x0b, 
+  0x46, 0xf0, 0x8c, 0x21, 0x03, 0x16, 0x01, 0x11, 0xf6, 0xfc, 0x00, 0xe0, 
+  0x75, 0x17, 0x3e, 0xf0, 0x8c, 0x24, 0x46, 0x93, 0x20, 0x01, 0x26, 0x00, 
+  0xca, 0xe5, 0x12, 0x00, 0x40, 0x5c, 0x21, 0x2c, 0xf0, 0x42, 0x02, 0x20, 
+  0xb9, 0x0b, 0x44, 0x01, 0x11, 0x50, 0x8c, 0x02, 0x33, 0x8b, 0x08, 0x66, 
+  0x50, 0x03, 0xf0, 0x09, 0xcf, 0x89, 0x94, 0x01, 0x29, 0x00, 0xd6, 0xe0, 
+  0xd0, 0x01, 0x29, 0x00, 0x8c, 0x20, 0x75, 0x81, 0xde, 0x01, 0x2a, 0x00, 
+  0x8c, 0x20, 0x3a, 0x88, 0x3a, 0x00, 0x31, 0x04, 0x43, 0x10, 0x7a, 0x00, 
+  0x31, 0x87, 0x16, 0x0c, 0x7a, 0x00, 0x20, 0xd4, 0x58, 0x0e, 0x00, 0x31, 
+  0x76, 0x56, 0x0c, 0x16, 0x00, 0x61, 0x0f, 0x23, 0x35, 0x04, 0xcf, 0xff, 
+  0x7a, 0x00, 0x10, 0x52, 0x10, 0x00, 0xf0, 0x01, 0x7a, 0x12, 0x21, 0x04, 
+  0xcf, 0xff, 0x8c, 0x21, 0xb4, 0x8a, 0x12, 0x01, 0x2a, 0x00, 0x8d, 0xe0, 
+  0x14, 0x00, 0x41, 0x53, 0x12, 0xee, 0xf1, 0x1e, 0x03, 0x10, 0x50, 0x0e, 
+  0x00, 0xb3, 0x0e, 0x24, 0xf0, 0xf1, 0x8c, 0x20, 0xcf, 0x82, 0x00, 0x01, 
+  0x29, 0x14, 0x03, 0xa0, 0x06, 0x0b, 0x1c, 0x01, 0x26, 0x00, 0x8c, 0x20, 
+  0x3b, 0x8a, 0x20, 0x00, 0x31, 0x2f, 0x51, 0xd8, 0x2e, 0x00, 0x20, 0x3d, 
+  0x45, 0x0e, 0x00, 0x91, 0x52, 0x54, 0x8c, 0x21, 0x3e, 0x88, 0x84, 0xf0, 
+  0xe4, 0x60, 0x03, 0x31, 0x09, 0x58, 0x8c, 0x60, 0x03, 0x60, 0xcb, 0x0b, 
+  0xce, 0xf1, 0xc9, 0x08, 0xa2, 0x03, 0x22, 0xe0, 0x0c, 0x90, 0x02, 0x20, 
+  0x35, 0x51, 0x2e, 0x00, 0x71, 0x22, 0x12, 0x8c, 0x21, 0x07, 0x8d, 0x6e, 
+  0xa8, 0x01, 0x11, 0xe4, 0x4a, 0x04, 0x21, 0x5d, 0x44, 0x54, 0x00, 0x30, 
+  0x5a, 0xb6, 0xf1, 0x48, 0x04, 0x20, 0x10, 0x08, 0x14, 0x00, 0x20, 0xb1, 
+  0x14, 0x14, 0x00, 0x31, 0x8e, 0x58, 0xac, 0x68, 0x00, 0x11, 0x28, 0x60, 
+  0x02, 0x51, 0x20, 0x23, 0xa4, 0xf1, 0x81, 0xf4, 0x03, 0x20, 0x03, 0x08, 
+  0x10, 0x00, 0x31, 0x67, 0x54, 0x94, 0x32, 0x00, 0x11, 0x36, 0x32, 0x00, 
+  0x11, 0x08, 0xf4, 0x00, 0xf1, 0x01, 0x3b, 0x54, 0x92, 0xf1, 0x8c, 0x21, 
+  0x36, 0x88, 0x82, 0x00, 0x29, 0x00, 0x8c, 0x21, 0x34, 0x82, 0x1a, 0x00, 
+  0x10, 0x16, 0x1a, 0x00, 0xf1, 0x00, 0x83, 0x45, 0x34, 0xf0, 0x30, 0x78, 
+  0x8c, 0x20, 0x02, 0x86, 0x6e, 0x00, 0x2d, 0x00, 0xb4, 0x66, 0x02, 0x11, 
+  0xf2, 0x66, 0x02, 0x31, 0x31, 0x49, 0x78, 0x06, 0x03, 0x31, 0x0a, 0x48, 
+  0x6c, 0x6e, 0x00, 0x11, 0x23, 0x7c, 0x00, 0x31, 0x8d, 0x42, 0x6e, 0x16, 
+  0x00, 0x31, 0xde, 0x51, 0x62, 0x08, 0x00, 0xf1, 0x04, 0x7b, 0x50, 0x5e, 
+  0xf1, 0x8e, 0x7a, 0x8c, 0x22, 0x02, 0x84, 0x36, 0x00, 0x2a, 0x00, 0x83, 
+  0xda, 0x07, 0xba, 0x56, 0x18, 0x00, 0x31, 0xcd, 0x57, 0x52, 0x36, 0x00, 
+  0x20, 0x7e, 0x56, 0x0e, 0x00, 0x71, 0x94, 0x45, 0xca, 0x22, 0x0b, 0x00, 
+  0x48, 0x1a, 0x00, 0x31, 0xa6, 0x14, 0x44, 0x08, 0x00, 0x51, 0xab, 0x18, 
+  0x40, 0xf1, 0x25, 0xb8, 0x00, 0x51, 0x31, 0x08, 0x8c, 0x20, 0xc5, 0x64, 
+  0x02, 0x11, 0xa2, 0x3a, 0x01, 0x31, 0x31, 0x51, 0x3c, 0x22, 0x00, 0xa0, 
+  0x6f, 0x42, 0x30, 0xf1, 0x8c, 0x20, 0x45, 0x8f, 0x4c, 0xf7, 0x0e, 0x00, 
+  0x31, 0x1c, 0x42, 0x28, 0x52, 0x00, 0x11, 0x38, 0x8c, 0x03, 0xa0, 0xa3, 
+  0x46, 0xd8, 0xf1, 0xf0, 0x78, 0xd8, 0xe0, 0x0c, 0xf7, 0x1c, 0x02, 0x20, 
+  0xd7, 0x0c, 0x1a, 0x00, 0x11, 0x9f, 0x32, 0x01, 0x60, 0x41, 0x57, 0x59, 
+  0x02, 0xcf, 0xff, 0x0a, 0x00, 0xf0, 0x07, 0xbd, 0x42, 0x55, 0x02, 0xcf, 
+  0xff, 0xe0, 0x78, 0xf1, 0xc0, 0xc3, 0x41, 0x13, 0x00, 0x6c, 0xb5, 0x5a, 
+  0x0e, 0x6f, 0xf2, 0x0f, 0xd8, 0x0c, 0x00, 0x31, 0xc0, 0xb5, 0xe2, 0x0c, 
+  0x00, 0xf0, 0x29, 0xa6, 0x0f, 0xef, 0xfb, 0x9a, 0xd8, 0xd1, 0xc0, 0xe0, 
+  0x7e, 0xf6, 0xc3, 0xa4, 0xc1, 0x55, 0x20, 0x8f, 0x09, 0x60, 0x87, 0x08, 
+  0x46, 0x02, 0x9f, 0x30, 0x42, 0x21, 0x6b, 0x20, 0xa7, 0x2c, 0x71, 0x36, 
+  0x0a, 0x20, 0x04, 0x50, 0x43, 0x02, 0xb7, 0x76, 0x0c, 0xa0, 0x04, 0x62, 
+  0x40, 0x2f, 0x26, 0x06, 0xf0, 0x0e, 0x00, 0x23, 0x00, 0x00, 0xb6, 0x6e, 
+  0x00, 0xf4, 0x3b, 0xff, 0x7f, 0x00, 0xb6, 0xa2, 0x16, 0x00, 0x11, 0x0e, 
+  0x70, 0x5f, 0x20, 0x0d, 0x07, 0x00, 0x25, 0x8d, 0x13, 0xf5, 0x23, 0x01, 
+  0x24, 0x40, 0x17, 0x46, 0x11, 0xda, 0x16, 0x45, 0x11, 0xd2, 0x16, 0x44, 
+  0x11, 0x7e, 0x9f, 0xd6, 0x16, 0x42, 0x11, 0x16, 0x26, 0x00, 0x14, 0xb6, 
+  0x0f, 0x60, 0x04, 0x30, 0xe0, 0x17, 0x08, 0x32, 0x04, 0x8c, 0x20, 0x3f, 
+  0x8c, 0x14, 0x26, 0x00, 0x14, 0xca, 0x10, 0x40, 0x01, 0x31, 0x08, 0x13, 
+  0x00, 0x08, 0xf0, 0x16, 0xf6, 0x10, 0x00, 0xf2, 0x03, 0x21, 0x08, 0x52, 
+  0x00, 0x60, 0x15, 0x40, 0x11, 0xbe, 0x09, 0x20, 0x04, 0x2c, 0x71, 0x60, 
+  0x1d, 0x04, 0x10, 0x1a, 0x00, 0xf0, 0xff, 0x36, 0x01, 0x01, 0x33, 0x79, 
+  0xca, 0x18, 0x44, 0x00, 0x06, 0x71, 0xa1, 0x08, 0xd4, 0xa0, 0x20, 0x9e, 
+  0x2e, 0x70, 0xa2, 0x16, 0x17, 0x11, 0x22, 0x40, 0x8b, 0xb8, 0xee, 0x09, 
+  0x20, 0x04, 0x0b, 0xda, 0x10, 0x44, 0xae, 0x70, 0x40, 0x24, 0x16, 0x32, 
+  0x02, 0x1e, 0x04, 0x10, 0xf5, 0x23, 0x40, 0x25, 0x08, 0xda, 0x2a, 0x0a, 
+  0x20, 0x04, 0x82, 0x41, 0x14, 0x26, 0x50, 0x15, 0x04, 0x18, 0x04, 0x20, 
+  0x08, 0x45, 0x14, 0x96, 0x14, 0x26, 0x41, 0x25, 0xa0, 0xb1, 0x84, 0xe8, 
+  0x2a, 0x18, 0x44, 0x23, 0x40, 0x20, 0x80, 0x2a, 0xc3, 0x41, 0x00, 0x00, 
+  0x71, 0x7d, 0x86, 0x0f, 0x60, 0x04, 0xa1, 0x42, 0x2a, 0x10, 0x40, 0x21, 
+  0xa6, 0x71, 0x0c, 0x7d, 0xc5, 0x0d, 0xf4, 0xa0, 0x00, 0x21, 0x51, 0x23, 
+  0x00, 0x21, 0x8d, 0x2f, 0x00, 0x00, 0x00, 0x40, 0x0e, 0x70, 0x2f, 0xbd, 
+  0x28, 0x1e, 0x45, 0x10, 0x0a, 0x1e, 0x44, 0x13, 0x14, 0x26, 0x01, 0x14, 
+  0x82, 0xc0, 0x35, 0x99, 0xf5, 0x20, 0x11, 0x04, 0xae, 0x78, 0xca, 0x09, 
+  0x20, 0x04, 0x0d, 0xda, 0x00, 0x41, 0x1e, 0x0a, 0x20, 0x04, 0x22, 0x40, 
+  0x80, 0xc1, 0x14, 0x21, 0x01, 0x04, 0x06, 0x71, 0xdd, 0x08, 0xf4, 0xa0, 
+  0x00, 0xb1, 0x5f, 0x27, 0x0d, 0x27, 0x80, 0xc0, 0xdd, 0x65, 0x42, 0x0b, 
+  0xa0, 0x04, 0x64, 0x15, 0x10, 0x10, 0xa2, 0x16, 0x01, 0x11, 0x23, 0xb8, 
+  0x00, 0x20, 0x02, 0x20, 0x5f, 0x21, 0x01, 0x07, 0x2e, 0x70, 0x0a, 0x24, 
+  0xc0, 0x24, 0x59, 0xa5, 0x00, 0x26, 0x4d, 0x10, 0xc6, 0x0a, 0xa0, 0x04, 
+  0x02, 0x14, 0x40, 0x25, 0x3a, 0x85, 0x26, 0x71, 0x38, 0x60, 0xf5, 0x09, 
+  0xf4, 0xa0, 0x1a, 0xa5, 0xa2, 0x16, 0x0b, 0x11, 0x4a, 0x24, 0xc0, 0x70, 
+  0x0e, 0x70, 0xc3, 0x42, 0xa1, 0x00, 0x56, 0x42, 0x62, 0x43, 0x0c, 0x70, 
+  0xa8, 0x20, 0x80, 0x02, 0x02, 0x12, 0x01, 0x05, 0x02, 0x13, 0x4c, 0x05, 
+  0xf5, 0x23, 0x41, 0x20, 0x89, 0x79, 0x38, 0x60, 0x5f, 0x23, 0x0d, 0x17, 
+  0x80, 0x20, 0x10, 0x00, 0x4b, 0xb8, 0xdd, 0x65, 0x3b, 0x85, 0x38, 0x60, 
+  0x6c, 0x1d, 0x00, 0x10, 0x5a, 0x20, 0x80, 0x22, 0x20, 0x9e, 0xd8, 0x60, 
+  0xe2, 0x10, 0x46, 0x01, 0xe4, 0x10, 0x45, 0x01, 0xdc, 0x10, 0x44, 0x01, 
+  0xde, 0x10, 0x43, 0x01, 0xe0, 0x10, 0x42, 0x01, 0x86, 0x01, 0xf0, 0x01, 
+  0x2e, 0x0e, 0x60, 0x04, 0x54, 0x20, 0x00, 0x09, 0x0c, 0x78, 0x15, 0x25, 
+  0x01, 0x14, 0x5c, 0x81, 0x40, 0x00, 0xf0, 0x3b, 0x06, 0x71, 0x2b, 0xb8, 
+  0x58, 0x60, 0xc9, 0x08, 0xf4, 0xa0, 0x1c, 0xa1, 0x3c, 0x97, 0x02, 0x97, 
+  0x5f, 0x08, 0x64, 0x00, 0x2c, 0x71, 0x3e, 0x08, 0x20, 0x04, 0x04, 0x9f, 
+  0x10, 0x79, 0x2f, 0x09, 0xb4, 0x00, 0x04, 0xb7, 0xae, 0x0e, 0xaf, 0xff, 
+  0xc1, 0x40, 0x00, 0x12, 0x01, 0x21, 0x00, 0x42, 0x2c, 0xb8, 0x07, 0xe9, 
+  0x55, 0x26, 0x40, 0x1a, 0x42, 0x0e, 0x20, 0x00, 0x42, 0x41, 0x9e, 0x16, 
+  0x01, 0x11, 0x0b, 0x09, 0x00, 0x00, 0x9e, 0x1e, 0x04, 0x10, 0x0c, 0x02, 
+  0xf0, 0x46, 0x04, 0x71, 0x10, 0x79, 0x34, 0x71, 0xca, 0x20, 0x2d, 0x00, 
+  0x5f, 0x20, 0x01, 0x07, 0xa2, 0x1e, 0x04, 0x10, 0xd9, 0x61, 0x6e, 0x0b, 
+  0x20, 0x00, 0x54, 0x21, 0x00, 0x0c, 0x04, 0x1f, 0x05, 0x10, 0xd6, 0xc7, 
+  0xe2, 0xc2, 0x16, 0x08, 0x20, 0x00, 0x28, 0x45, 0x0a, 0x08, 0x20, 0x00, 
+  0xa1, 0x40, 0xc2, 0xc6, 0xc9, 0x05, 0x00, 0x00, 0xea, 0xc3, 0xa3, 0xc1, 
+  0x10, 0x40, 0x55, 0x20, 0x8d, 0x09, 0x0c, 0x70, 0x2c, 0x18, 0x00, 0x20, 
+  0x28, 0x18, 0x00, 0x20, 0x02, 0xa5, 0x02, 0xb5, 0x00, 0xa5, 0x00, 0x18, 
+  0x04, 0x20, 0x2e, 0x40, 0x00, 0x41, 0x20, 0x00, 0x2c, 0x26, 0x08, 0x00, 
+  0xa0, 0x80, 0x2f, 0xb6, 0x0d, 0x20, 0x00, 0x55, 0x20, 0x40, 0x2a, 0x26, 
+  0x01, 0xf0, 0x0f, 0xff, 0xd9, 0x02, 0x40, 0x80, 0xda, 0x08, 0xb9, 0x80, 
+  0x20, 0x83, 0x02, 0x30, 0x1d, 0x85, 0x12, 0x5c, 0xb5, 0x9e, 0x18, 0x44, 
+  0x20, 0xa8, 0x20, 0x00, 0x01, 0x02, 0x18, 0x55, 0x00, 0xe4, 0x01, 0x71, 
+  0x03, 0x3f, 0xc3, 0x40, 0xfe, 0xc0, 0x00, 0xa6, 0x05, 0xf3, 0x91, 0x05, 
+  0x3e, 0xc3, 0x43, 0x00, 0x08, 0x00, 0x08, 0x37, 0xa5, 0x16, 0xa5, 0xd6, 
+  0x18, 0x44, 0x20, 0x30, 0xb8, 0x8a, 0x21, 0x45, 0x02, 0xcb, 0x40, 0x00, 
+  0x00, 0xa5, 0x67, 0xcb, 0x43, 0x00, 0x00, 0x5c, 0xce, 0x8a, 0x21, 0x9c, 
+  0x1b, 0x2e, 0x70, 0xcb, 0x47, 0xd3, 0xf8, 0xe8, 0x63, 0xcb, 0x46, 0xf5, 
+  0xd6, 0x49, 0x01, 0xcb, 0x44, 0x92, 0x02, 0x49, 0x01, 0x60, 0x1d, 0x84, 
+  0x10, 0xda, 0x18, 0x84, 0x20, 0x42, 0xc3, 0x41, 0xc3, 0x1e, 0xb5, 0x54, 
+  0x20, 0x00, 0x29, 0x40, 0x24, 0x06, 0x32, 0x40, 0x24, 0x07, 0x31, 0x8a, 
+  0x22, 0x8a, 0x04, 0x20, 0x43, 0xc3, 0x44, 0x00, 0x00, 0xe8, 0x63, 0xc3, 
+  0x45, 0xff, 0xff, 0xf5, 0xd6, 0xee, 0x18, 0x04, 0x22, 0x54, 0x1d, 0xc4, 
+  0x12, 0xea, 0x18, 0x44, 0x22, 0x50, 0x1d, 0x44, 0x14, 0xf3, 0xa5, 0xd2, 
+  0xa5, 0x91, 0xa5, 0x40, 0x1d, 0x44, 0x14, 0x22, 0x0c, 0x60, 0x04, 0xd2, 
+  0x18, 0x44, 0x24, 0x54, 0x15, 0x45, 0x11, 0xee, 0x10, 0x44, 0x21, 0xe6, 
+  0x10, 0x43, 0x21, 0x50, 0x15, 0x42, 0x11, 0xea, 0x10, 0x41, 0x21, 0x54, 
+  0x20, 0x00, 0x2a, 0x54, 0x00, 0xf0, 0x12, 0x30, 0xfa, 0x0b, 0x60, 0x04, 
+  0x00, 0x1c, 0x40, 0x34, 0xf6, 0x10, 0x45, 0x21, 0x60, 0x15, 0x44, 0x11, 
+  0x58, 0x15, 0x43, 0x11, 0xf2, 0x10, 0x42, 0x21, 0x5c, 0x15, 0x41, 0x11, 
+  0x54, 0x20, 0x00, 0x2b, 0x28, 0x00, 0x40, 0xd6, 0x0b, 0x60, 0x04, 0x2c, 
+  0x00, 0xf4, 0x07, 0x40, 0x20, 0x0e, 0x2c, 0x40, 0x15, 0x45, 0x11, 0xda, 
+  0x10, 0x44, 0x21, 0xd2, 0x10, 0x43, 0x21, 0x5e, 0x9d, 0xd6, 0x10, 0x41, 
+  0x21, 0x4a, 0x00, 0xf0, 0x8b, 0xb2, 0x0b, 0x60, 0x04, 0xc1, 0x40, 0x26, 
+  0x71, 0xe1, 0x09, 0xf4, 0xa0, 0x08, 0xe6, 0xca, 0xc7, 0xe0, 0x78, 0xe4, 
+  0xc2, 0x48, 0x45, 0x4d, 0x08, 0x71, 0x00, 0xcd, 0x70, 0x49, 0x09, 0x34, 
+  0x03, 0x00, 0x1b, 0x05, 0x03, 0x2c, 0x70, 0x0c, 0xda, 0x26, 0x0a, 0xef, 
+  0xf1, 0xa1, 0x40, 0xc3, 0x41, 0xa1, 0x00, 0x2c, 0x17, 0x00, 0x91, 0xcb, 
+  0xad, 0xca, 0xad, 0x00, 0xad, 0x28, 0xb8, 0x01, 0xad, 0x01, 0x91, 0xcd, 
+  0x71, 0x02, 0xad, 0x28, 0xb8, 0x03, 0xad, 0x02, 0x91, 0x04, 0xad, 0x28, 
+  0xb8, 0x05, 0xad, 0x03, 0x91, 0x06, 0xad, 0x28, 0xb8, 0x07, 0xad, 0x04, 
+  0x91, 0x08, 0xad, 0x28, 0xb8, 0x09, 0xad, 0xc1, 0x40, 0xc4, 0xc6, 0xe6, 
+  0xc0, 0x00, 0x47, 0x4f, 0x08, 0x71, 0x00, 0x20, 0x46, 0x4b, 0x0e, 0x14, 
+  0x03, 0xc1, 0x8a, 0xe3, 0x8a, 0x65, 0x8a, 0x07, 0x8a, 0x09, 0x12, 0x88, 
+  0x00, 0xa0, 0x8a, 0x22, 0x8a, 0x84, 0x8a, 0x06, 0x12, 0x8b, 0x00, 0x08, 
+  0x12, 0x89, 0x00, 0x08, 0xbe, 0x08, 0xbf, 0x08, 0xbb, 0x08, 0xb8, 0x40, 
+  0x28, 0x08, 0x12, 0xde, 0x02, 0xf8, 0x31, 0x2c, 0x17, 0xc5, 0x7d, 0xe5, 
+  0x79, 0x85, 0x7b, 0x05, 0x20, 0xc0, 0x02, 0x05, 0x20, 0x4c, 0x12, 0xa0, 
+  0xb2, 0x21, 0xb2, 0x62, 0xb2, 0x03, 0xb2, 0x84, 0xb2, 0x7d, 0x26, 0x01, 
+  0x03, 0x78, 0x27, 0x40, 0x00, 0x24, 0x78, 0xc6, 0xc4, 0xe0, 0x78, 0x6a, 
+  0x24, 0x80, 0x12, 0x51, 0x24, 0x80, 0x93, 0xe0, 0x20, 0x82, 0x0f, 0x12, 
+  0x00, 0x0c, 0x92, 0xcb, 0x44, 0x00, 0x00, 0x4e, 0x00, 0x3e, 0x79, 0x18, 
+  0x00, 0x40, 0x10, 0x00, 0xc0, 0x66, 0x18, 0x00, 0x1d, 0x50, 0x18, 0x00, 
+  0x20, 0x0c, 0x67, 0x18, 0x00, 0x1b, 0x53, 0x18, 0x00, 0x40, 0x12, 0x00, 
+  0x6c, 0x93, 0x18, 0x00, 0x1d, 0x49, 0x18, 0x00, 0x11, 0x78, 0x18, 0x00, 
+  0x1d, 0x48, 0x18, 0x00, 0x20, 0x14, 0x97, 0x18, 0x00, 0xf0, 0x41, 0x5c, 
+  0x00, 0x3e, 0x79, 0xe1, 0xc5, 0xa2, 0x91, 0x84, 0x80, 0x41, 0x2d, 0x41, 
+  0x12, 0x50, 0x74, 0x6c, 0x21, 0x82, 0x00, 0x0e, 0xf4, 0x24, 0x90, 0x17, 
+  0x0a, 0x65, 0x00, 0x54, 0x49, 0xc3, 0xbd, 0x0f, 0x0d, 0x02, 0x13, 0x26, 
+  0x90, 0x44, 0xb0, 0x64, 0xa0, 0x24, 0x71, 0x26, 0xb0, 0xc2, 0xc4, 0xff, 
+  0xec, 0x84, 0x90, 0x1d, 0x0a, 0x04, 0x03, 0x27, 0x90, 0x07, 0xe9, 0x41, 
+  0x2d, 0x01, 0x12, 0xc3, 0xb9, 0x11, 0x0c, 0x45, 0x10, 0x08, 0x18, 0x05, 
+  0x00, 0x10, 0x18, 0x01, 0x00, 0xc2, 0xc4, 0x2a, 0x00, 0xf0, 0x21, 0xc2, 
+  0xc4, 0xe0, 0x78, 0xe6, 0xc3, 0xa1, 0xc1, 0xbf, 0x80, 0x40, 0x20, 0x0e, 
+  0x07, 0x28, 0x47, 0x40, 0x24, 0xc2, 0x30, 0x2f, 0xd9, 0x6c, 0x71, 0xc1, 
+  0x40, 0xea, 0x0a, 0xe0, 0x04, 0x03, 0x1c, 0xc3, 0x31, 0x80, 0x25, 0xc5, 
+  0x13, 0x52, 0x27, 0x00, 0x10, 0x00, 0xad, 0x03, 0x1c, 0x02, 0x30, 0x20, 
+  0x00, 0xf0, 0x05, 0x3a, 0xd9, 0x6c, 0x71, 0xca, 0x0a, 0xe0, 0x04, 0xc1, 
+  0x40, 0x9a, 0x0e, 0xaf, 0xee, 0x64, 0xd8, 0xc6, 0xc7, 0xe0, 0x78, 0x12, 
+  0x03, 0xc0, 0x2c, 0x70, 0x23, 0xa0, 0x22, 0xa0, 0x21, 0xa0, 0x10, 0x18, 
+  0x15, 0x00, 0x08, 0x03, 0xf0, 0x21, 0x04, 0x18, 0x11, 0x00, 0xe0, 0x7e, 
+  0xe0, 0x78, 0xe4, 0xc3, 0xcb, 0x45, 0xa1, 0x00, 0xd8, 0x1f, 0x28, 0x46, 
+  0x60, 0x81, 0x21, 0x85, 0x3b, 0x09, 0xe0, 0x00, 0xa1, 0xc1, 0x40, 0x85, 
+  0x3d, 0x21, 0xcc, 0x00, 0x30, 0x73, 0x99, 0x62, 0xc6, 0xf7, 0x17, 0x09, 
+  0x84, 0x0f, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x07, 0xf0, 0x0f, 0xff, 0xff, 
+  0xca, 0x21, 0x2d, 0x00, 0x20, 0x42, 0x20, 0xa5, 0x10, 0xba, 0x79, 0x62, 
+  0x40, 0xc1, 0xea, 0x08, 0x60, 0x04, 0x80, 0xc1, 0x00, 0x86, 0x01, 0xa5, 
+  0x0c, 0x70, 0xc4, 0xc7, 0x50, 0x06, 0xf1, 0x96, 0xda, 0x08, 0x60, 0x04, 
+  0x2c, 0x70, 0xd1, 0xc0, 0xe0, 0x7f, 0x0c, 0x70, 0xe0, 0x78, 0xf4, 0xc2, 
+  0x28, 0x46, 0x20, 0x91, 0x70, 0x44, 0x08, 0x45, 0x41, 0x29, 0x83, 0x01, 
+  0x53, 0x21, 0x4b, 0x00, 0x01, 0x96, 0xc1, 0xbb, 0x75, 0x73, 0x30, 0x42, 
+  0xca, 0x23, 0xa1, 0x10, 0xcb, 0x44, 0xa1, 0x00, 0x2c, 0x42, 0x09, 0x0b, 
+  0xb1, 0x00, 0x81, 0x41, 0x9c, 0x4c, 0x74, 0x70, 0x72, 0x68, 0x02, 0xf4, 
+  0xb8, 0x4c, 0xf5, 0x22, 0xc2, 0x02, 0x04, 0x16, 0x10, 0x11, 0x41, 0x28, 
+  0xd5, 0x01, 0x04, 0x23, 0x8f, 0x0f, 0x00, 0x00, 0xfc, 0x0f, 0xfa, 0x0c, 
+  0x20, 0x04, 0x2c, 0x4d, 0x87, 0x95, 0x10, 0x41, 0x04, 0x95, 0x65, 0x95, 
+  0x42, 0x9d, 0x79, 0x24, 0x01, 0x10, 0x40, 0x25, 0x93, 0x12, 0x40, 0x25, 
+  0x16, 0x11, 0x04, 0x71, 0x79, 0x61, 0x04, 0xb5, 0x1d, 0x0a, 0x63, 0x04, 
+  0x25, 0xb5, 0x01, 0x95, 0xf4, 0x78, 0x0e, 0x79, 0x9a, 0x0d, 0x60, 0x04, 
+  0x22, 0x40, 0x4c, 0x72, 0x6c, 0x71, 0x02, 0xb5, 0x11, 0xf0, 0x23, 0x9d, 
+  0x91, 0x09, 0x63, 0x20, 0x41, 0x28, 0x50, 0x22, 0x01, 0x95, 0x17, 0x20, 
+  0xc0, 0x03, 0x0e, 0x79, 0x72, 0x20, 0x00, 0xf1, 0x03, 0x03, 0xb5, 0x4c, 
+  0x71, 0x6c, 0x72, 0xa1, 0x40, 0x4e, 0x0e, 0xef, 0xff, 0xc1, 0x41, 0x0e, 
+  0x70, 0x02, 0x6d, 0xfa, 0x05, 0xf3, 0x1f, 0xfd, 0x22, 0x42, 0x96, 0x0d, 
+  0xe0, 0x03, 0x6c, 0x25, 0x95, 0x20, 0x41, 0x9d, 0xcb, 0x46, 0x00, 0x00, 
+  0xc3, 0xf5, 0xc2, 0x40, 0x82, 0x0d, 0xe0, 0x03, 0xc1, 0x41, 0x21, 0x95, 
+  0x02, 0x9d, 0xf9, 0x61, 0x32, 0x0d, 0x60, 0x04, 0x2e, 0x79, 0x41, 0x9d, 
+  0x02, 0xb5, 0x06, 0x6d, 0x6a, 0x18, 0x00, 0x51, 0x03, 0x9d, 0xe2, 0x79, 
+  0x22, 0x18, 0x00, 0xfa, 0xeb, 0x25, 0x95, 0x0b, 0x08, 0x31, 0x20, 0x03, 
+  0xb5, 0x17, 0x09, 0x44, 0x05, 0x41, 0x2a, 0x92, 0x20, 0x3d, 0x21, 0x42, 
+  0x05, 0x44, 0x22, 0x40, 0x20, 0x49, 0x0a, 0x05, 0x00, 0xad, 0x70, 0xb0, 
+  0x78, 0xd4, 0xc6, 0x10, 0x7a, 0x6c, 0x20, 0x81, 0x20, 0x0b, 0x09, 0x85, 
+  0x00, 0x04, 0x85, 0x33, 0xe8, 0x02, 0x96, 0x24, 0xb8, 0xc3, 0xb8, 0x38, 
+  0x60, 0x85, 0x08, 0xa5, 0x80, 0x0e, 0x70, 0x06, 0x95, 0x2d, 0xe8, 0x20, 
+  0x96, 0x23, 0xb9, 0xc2, 0xb9, 0x13, 0x09, 0x04, 0x00, 0x84, 0xec, 0x00, 
+  0x1b, 0x04, 0x24, 0x01, 0x6c, 0x0e, 0x71, 0x07, 0xb5, 0x08, 0x1d, 0x05, 
+  0x10, 0x24, 0xf0, 0x67, 0x95, 0x29, 0x0b, 0x15, 0x01, 0x21, 0x08, 0xa1, 
+  0x00, 0x49, 0x6b, 0x0c, 0x71, 0x58, 0x78, 0x0b, 0x20, 0x00, 0x85, 0x08, 
+  0x45, 0x08, 0xf2, 0x13, 0x09, 0x65, 0x05, 0x01, 0x2c, 0xfe, 0xa0, 0xd0, 
+  0xf5, 0x05, 0xf0, 0x9b, 0x09, 0x44, 0x85, 0xad, 0x70, 0x2c, 0x70, 0x0a, 
+  0xda, 0x6a, 0x0e, 0xaf, 0xf1, 0x62, 0x40, 0xc6, 0xf1, 0x24, 0xb5, 0x91, 
+  0xf1, 0x04, 0x85, 0x08, 0x1d, 0x04, 0x14, 0x02, 0xe8, 0x24, 0xb5, 0x10, 
+  0x1d, 0x01, 0x10, 0x0c, 0x1d, 0x05, 0x10, 0x88, 0xf1, 0xe0, 0x78, 0xe2, 
+  0xc2, 0x08, 0x45, 0x00, 0x90, 0x85, 0xe8, 0x26, 0x08, 0x20, 0x00, 0x20, 
+  0x40, 0x18, 0x4d, 0x2c, 0x70, 0x14, 0xda, 0x32, 0x0e, 0xaf, 0xf1, 0x02, 
+  0x1d, 0x05, 0x10, 0xc3, 0x40, 0x00, 0xf8, 0x00, 0x08, 0x00, 0x1d, 0xc5, 
+  0x10, 0x01, 0xa5, 0xc2, 0xc6, 0xe0, 0x78, 0x2d, 0xda, 0xc3, 0x43, 0x00, 
+  0x00, 0x64, 0x68, 0x8e, 0xba, 0x76, 0xd9, 0x62, 0xb0, 0x41, 0xb0, 0xe0, 
+  0x7f, 0x20, 0xa8, 0x58, 0x88, 0x88, 0xe2, 0xe0, 0x7d, 0x10, 0x80, 0xe0, 
+  0x7f, 0x00, 0xa1, 0x5c, 0x03, 0x20, 0xb8, 0xe2, 0x14, 0x03, 0x40, 0x04, 
+  0x00, 0x3e, 0x79, 0x60, 0x05, 0xf0, 0x51, 0x66, 0x0a, 0x8a, 0x21, 0x5b, 
+  0x08, 0x06, 0x18, 0x85, 0x02, 0x00, 0x18, 0x45, 0x00, 0x08, 0x18, 0x85, 
+  0x02, 0x42, 0xb0, 0xe0, 0x7f, 0x21, 0xb0, 0x2c, 0x70, 0x24, 0x18, 0x85, 
+  0x02, 0x22, 0xb0, 0x21, 0xb0, 0x06, 0x18, 0x15, 0x00, 0xb9, 0x05, 0xaf, 
+  0xf1, 0x1e, 0xda, 0xe8, 0xc2, 0x61, 0x91, 0x28, 0x47, 0x53, 0x22, 0xc1, 
+  0x02, 0x08, 0x46, 0x0f, 0x0b, 0x65, 0x00, 0x41, 0x2a, 0x10, 0x03, 0x00, 
+  0x96, 0x1b, 0x08, 0x01, 0x20, 0x8c, 0x21, 0x0c, 0x8d, 0x48, 0x00, 0x06, 
+  0x00, 0x04, 0x6e, 0x2c, 0x70, 0x8e, 0x0d, 0xaf, 0xf1, 0x0c, 0xda, 0x1c, 
+  0xf0, 0x02, 0x97, 0x13, 0x08, 0x65, 0x00, 0x84, 0x07, 0xf0, 0x4d, 0x02, 
+  0x96, 0x0e, 0x70, 0x04, 0x71, 0x02, 0xb6, 0x12, 0xf0, 0x02, 0x91, 0x4a, 
+  0x24, 0x40, 0x71, 0x0e, 0x71, 0x04, 0x71, 0x02, 0xb1, 0x44, 0x97, 0x40, 
+  0x26, 0x80, 0x11, 0xa8, 0x20, 0xc0, 0x01, 0x02, 0x10, 0x01, 0x05, 0xc7, 
+  0x09, 0x85, 0x80, 0x06, 0x71, 0x0e, 0x70, 0x24, 0x97, 0x02, 0x96, 0x3d, 
+  0x08, 0x65, 0x00, 0x2f, 0x21, 0x08, 0x84, 0xa0, 0x96, 0x49, 0xf2, 0x01, 
+  0x96, 0x14, 0x26, 0x02, 0x10, 0x10, 0x1a, 0x04, 0x04, 0x04, 0x71, 0x43, 
+  0x97, 0x10, 0x7b, 0x0b, 0x0b, 0xa4, 0x00, 0x01, 0xb6, 0x02, 0x1e, 0x05, 
+  0x10, 0x31, 0x09, 0x61, 0x03, 0x12, 0x96, 0xbe, 0x06, 0xf0, 0x33, 0x09, 
+  0x0a, 0x65, 0x00, 0x12, 0xb6, 0x52, 0xb6, 0x0a, 0x45, 0x31, 0xf0, 0xad, 
+  0x70, 0x06, 0x6e, 0x2c, 0x70, 0x1e, 0xda, 0xa2, 0xb6, 0xa1, 0xb6, 0x02, 
+  0x0d, 0xaf, 0xf1, 0xa0, 0xb6, 0x03, 0x97, 0x12, 0xb6, 0x25, 0xf0, 0x89, 
+  0x68, 0x5d, 0x79, 0x90, 0x78, 0x3f, 0x08, 0x65, 0x00, 0x40, 0x26, 0x09, 
+  0x14, 0x6c, 0x70, 0x42, 0x22, 0x3c, 0x80, 0x0c, 0x70, 0x0d, 0xf2, 0x2f, 
+  0x20, 0xc8, 0x10, 0x21, 0x41, 0xb0, 0x07, 0xf0, 0x19, 0xc0, 0x01, 0x02, 
+  0x11, 0x0b, 0x05, 0x38, 0x23, 0x0f, 0x12, 0xf8, 0x60, 0x90, 0x79, 0x10, 
+  0x78, 0x08, 0x20, 0x4c, 0x80, 0xca, 0x25, 0xc9, 0x10, 0x64, 0x71, 0x70, 
+  0x78, 0xd5, 0x08, 0x94, 0x81, 0x92, 0xb6, 0xa0, 0xb6, 0xb0, 0x78, 0xc8, 
+  0xc6, 0xf8, 0x03, 0xf0, 0xcd, 0xa2, 0xc1, 0xbf, 0x80, 0xcd, 0x70, 0x1c, 
+  0xe0, 0x80, 0xc2, 0x74, 0xd9, 0x6c, 0x75, 0x61, 0xc6, 0x4e, 0x0d, 0x20, 
+  0x04, 0x40, 0xc6, 0x21, 0xc2, 0x0c, 0x70, 0x3b, 0x0a, 0xbe, 0x01, 0x2c, 
+  0x70, 0x01, 0x14, 0x8e, 0x30, 0x03, 0x14, 0x8f, 0x30, 0x02, 0x14, 0x8c, 
+  0x30, 0x44, 0x22, 0x01, 0x0c, 0x44, 0x22, 0x00, 0x03, 0x40, 0x2a, 0x83, 
+  0x03, 0x0a, 0xb9, 0x0c, 0xb8, 0x06, 0xbe, 0x56, 0x6f, 0x06, 0xbc, 0xc5, 
+  0x7b, 0x45, 0x79, 0x85, 0x78, 0x6e, 0x7a, 0x2e, 0x79, 0x0e, 0x78, 0xde, 
+  0x6a, 0x46, 0xb9, 0x46, 0xb8, 0x98, 0x1d, 0x5c, 0x10, 0x97, 0x1d, 0x1c, 
+  0x10, 0x96, 0x1d, 0x9c, 0x13, 0xc6, 0xc7, 0xf0, 0xc2, 0x56, 0x0b, 0x6f, 
+  0xef, 0x08, 0x47, 0xda, 0x0e, 0x2f, 0xef, 0x10, 0x42, 0x10, 0x44, 0x1e, 
+  0x0b, 0x6f, 0xef, 0x9a, 0xd8, 0xcd, 0x70, 0x6e, 0x70, 0x05, 0xe8, 0xea, 
+  0x0b, 0xc0, 0x03, 0x10, 0x43, 0x4a, 0x20, 0x00, 0x26, 0x8a, 0x21, 0x01, 
+  0x20, 0xad, 0x70, 0x2f, 0x0d, 0x05, 0x15, 0x33, 0x22, 0x00, 0x24, 0x1b, 
+  0x08, 0x10, 0x02, 0x17, 0x08, 0x52, 0x00, 0x30, 0x22, 0x41, 0x24, 0x50, 
+  0x21, 0xfe, 0x87, 0x05, 0xf2, 0x36, 0x0d, 0xaf, 0xfb, 0x0f, 0x78, 0x07, 
+  0xe8, 0x55, 0x21, 0x11, 0x28, 0x55, 0x20, 0x10, 0x28, 0xa5, 0x71, 0xea, 
+  0xf1, 0x11, 0x8f, 0x0d, 0xe8, 0x04, 0x33, 0x80, 0xaf, 0xcc, 0x3d, 0xcd, 
+  0xcc, 0xc8, 0xf6, 0x0d, 0x0d, 0x24, 0x15, 0x80, 0xde, 0x18, 0x8f, 0x07, 
+  0x08, 0x50, 0x00, 0xff, 0xde, 0xc1, 0x40, 0xd0, 0xc6, 0x78, 0x04, 0xf1, 
+  0x20, 0xad, 0xc1, 0x28, 0x45, 0x08, 0x46, 0x80, 0xc0, 0x2c, 0x70, 0xbe, 
+  0x0b, 0xaf, 0xf1, 0x34, 0xda, 0x29, 0x0d, 0xb4, 0x10, 0x80, 0xc1, 0x8c, 
+  0x25, 0x02, 0x90, 0xcc, 0x25, 0x82, 0x9f, 0x00, 0x00, 0xff, 0x00, 0x09, 
+  0xf4, 0xc3, 0x40, 0x48, 0x42, 0x00, 0x00, 0x42, 0xc0, 0x80, 0xc1, 0x4a, 
+  0xb2, 0x06, 0xc0, 0xc4, 0xc7, 0xc1, 0x40, 0x42, 0x0b, 0x60, 0x04, 0x08, 
+  0x1c, 0x01, 0x30, 0xb8, 0x04, 0xf2, 0x05, 0xc4, 0x1f, 0x00, 0x8d, 0x09, 
+  0xe8, 0x22, 0x6d, 0x00, 0xa9, 0xc1, 0x40, 0x5e, 0x0c, 0x20, 0x04, 0x01, 
+  0x19, 0x03, 0x00, 0xae, 0x06, 0xf0, 0x53, 0x1c, 0x49, 0xb2, 0x0f, 0xaf, 
+  0xff, 0x01, 0x1d, 0x03, 0x10, 0xc4, 0xc7, 0xe8, 0xc2, 0x00, 0x16, 0x00, 
+  0x70, 0xf0, 0x00, 0x44, 0x02, 0x35, 0x08, 0x1e, 0x00, 0x6e, 0x0f, 0x0f, 
+  0xef, 0xde, 0x0d, 0x2f, 0xef, 0x10, 0x40, 0x08, 0x47, 0xcd, 0x71, 0x4a, 
+  0x25, 0x40, 0x10, 0xa1, 0x40, 0x02, 0x41, 0x4e, 0x0f, 0x2f, 0xef, 0xe1, 
+  0x42, 0x06, 0xe8, 0x08, 0x80, 0x13, 0x08, 0xb0, 0x04, 0x31, 0xd8, 0xa5, 
+  0x71, 0xc0, 0xe5, 0xc5, 0x71, 0xb4, 0xf7, 0xc8, 0xc6, 0x00, 0x1e, 0x84, 
+  0x73, 0xf0, 0x00, 0x4c, 0x00, 0x22, 0x0d, 0xef, 0xff, 0x2c, 0x71, 0x20, 
+  0x45, 0xc3, 0x40, 0xa1, 0x00, 0x0c, 0x4a, 0x1d, 0xd9, 0xaa, 0x06, 0xf2, 
+  0x20, 0x98, 0x16, 0xc3, 0x44, 0x13, 0x00, 0x78, 0xbf, 0xc9, 0x03, 0x20, 
+  0x04, 0x11, 0xdb, 0xea, 0xc2, 0x12, 0x0f, 0x2f, 0xef, 0x08, 0x47, 0x7e, 
+  0x0d, 0x2f, 0xef, 0x08, 0x46, 0x08, 0x45, 0x0b, 0xd8, 0xc1, 0x41, 0xf6, 
+  0x0e, 0x2f, 0xef, 0xa1, 0x42, 0x10, 0x41, 0x0f, 0xd8, 0xc1, 0x41, 0xea, 
+  0x0c, 0x00, 0x61, 0x40, 0x11, 0xd8, 0xc1, 0x41, 0xde, 0x0c, 0x00, 0xf0, 
+  0x0e, 0xb9, 0x17, 0x81, 0x10, 0xc6, 0xb9, 0xb9, 0x1f, 0x42, 0x10, 0x05, 
+  0xe8, 0xb9, 0x10, 0xc0, 0x00, 0x35, 0x08, 0x12, 0x00, 0x0f, 0x08, 0x10, 
+  0x20, 0xb9, 0x10, 0xc0, 0x20, 0x29, 0x0c, 0x00, 0xb0, 0x09, 0x10, 0x20, 
+  0xb9, 0x11, 0xc0, 0x20, 0x1d, 0x08, 0x12, 0x00, 0x78, 0x00, 0xf3, 0x16, 
+  0x98, 0x1e, 0x46, 0x08, 0x60, 0x04, 0x00, 0x10, 0xc0, 0x00, 0x00, 0x1e, 
+  0x01, 0x70, 0xa1, 0x00, 0x94, 0x1e, 0x0c, 0x70, 0xca, 0xc6, 0xf1, 0xc0, 
+  0xb9, 0x10, 0x81, 0x00, 0x87, 0xb9, 0x22, 0x09, 0x20, 0x00, 0xb9, 0x18, 
+  0x42, 0x2a, 0x00, 0x13, 0x32, 0x2a, 0x00, 0x03, 0x8e, 0x05, 0x70, 0x7f, 
+  0xa6, 0x10, 0x00, 0x01, 0xe0, 0x78, 0x1c, 0x00, 0xf0, 0x05, 0xc4, 0x1e, 
+  0xe0, 0x7f, 0x00, 0x80, 0xe0, 0x78, 0xe6, 0xc2, 0x28, 0x46, 0x5e, 0x0e, 
+  0x2f, 0xef, 0x08, 0x45, 0xce, 0x0c, 0xb8, 0x00, 0xf1, 0x36, 0x00, 0x42, 
+  0x11, 0xd8, 0x46, 0x0e, 0x2f, 0xef, 0xe1, 0x41, 0xb9, 0x16, 0xc1, 0x10, 
+  0x09, 0x09, 0x12, 0x00, 0xc6, 0xc6, 0x1f, 0x80, 0x30, 0x88, 0x4f, 0x88, 
+  0x53, 0x21, 0xc3, 0x00, 0x41, 0x29, 0x80, 0x01, 0x01, 0x2e, 0xc1, 0x70, 
+  0x04, 0x00, 0x00, 0x00, 0x55, 0x78, 0x48, 0x31, 0x01, 0x00, 0x14, 0x78, 
+  0x00, 0x31, 0x81, 0x0f, 0x74, 0x49, 0x00, 0x24, 0x96, 0x20, 0x05, 0x00, 
+  0x48, 0x30, 0x00, 0x00, 0x07, 0x31, 0x00, 0x80, 0x01, 0xe0, 0xc0, 0x1e, 
+  0x48, 0x30, 0xc0, 0x02, 0x00, 0xa1, 0x60, 0x7d, 0xc1, 0x40, 0xc6, 0xc6, 
+  0x74, 0x00, 0x13, 0xc8, 0x74, 0x00, 0x60, 0x7f, 0xd8, 0xe0, 0x7f, 0x17, 
+  0xb8, 0x00, 0x02, 0xf1, 0x0a, 0xa1, 0xc1, 0x08, 0x46, 0x09, 0x80, 0x40, 
+  0x26, 0x0d, 0x17, 0x02, 0x1c, 0x03, 0x30, 0x42, 0x20, 0x00, 0x08, 0x1f, 
+  0x08, 0xf5, 0x00, 0x03, 0x1c, 0x03, 0xc8, 0x06, 0xf0, 0x03, 0x73, 0xd9, 
+  0x6c, 0x71, 0x02, 0x0c, 0xa0, 0x04, 0xa1, 0x40, 0x40, 0x24, 0x82, 0x30, 
+  0x50, 0xd9, 0x04, 0xf0, 0x08, 0x00, 0xf0, 0x11, 0xd0, 0xd9, 0x6c, 0x71, 
+  0x46, 0x0a, 0x20, 0x04, 0xa1, 0x40, 0x14, 0x70, 0x22, 0xd8, 0x02, 0xf2, 
+  0xc4, 0xc7, 0x02, 0x14, 0x80, 0x30, 0xe1, 0xe0, 0x21, 0xd8, 0xfb, 0xf5, 
+  0x9a, 0x0c, 0x20, 0x00, 0x22, 0x02, 0x20, 0xe0, 0x78, 0x9a, 0x01, 0x62, 
+  0xc4, 0x1e, 0x31, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x31, 0xc8, 0x1e, 0x51, 
+  0x0c, 0x00, 0x80, 0xee, 0xc2, 0x72, 0x0d, 0x0f, 0xef, 0xe2, 0x0b, 0xec, 
+  0x00, 0xf1, 0x04, 0x08, 0x46, 0x11, 0xd8, 0xe1, 0x41, 0x5a, 0x0d, 0x2f, 
+  0xef, 0xc1, 0x42, 0x10, 0x42, 0x0b, 0xd8, 0xe1, 0x41, 0x4e, 0x0c, 0x00, 
+  0x72, 0x08, 0x45, 0x0f, 0xd8, 0xe1, 0x41, 0x42, 0x18, 0x00, 0x62, 0x40, 
+  0x13, 0xd8, 0xe1, 0x41, 0x36, 0x18, 0x00, 0xf0, 0x04, 0x47, 0x2e, 0x70, 
+  0x19, 0x0a, 0x30, 0x20, 0xcd, 0x70, 0xb9, 0x12, 0xc0, 0x20, 0x11, 0x08, 
+  0x33, 0x00, 0xcd, 0x70, 0xd8, 0x00, 0xf0, 0x11, 0x9c, 0x1e, 0xc0, 0x80, 
+  0x6e, 0x70, 0x0b, 0xed, 0xb9, 0x15, 0xc0, 0x10, 0x0f, 0x08, 0x33, 0x00, 
+  0x6e, 0x70, 0x31, 0x85, 0x60, 0x79, 0xa1, 0x40, 0x10, 0x43, 0x1d, 0x08, 
+  0x30, 0x20, 0x4e, 0x70, 0xca, 0x01, 0x00, 0x2e, 0x00, 0xf2, 0x01, 0x4e, 
+  0x70, 0x44, 0x10, 0x01, 0x20, 0x60, 0x79, 0x02, 0x40, 0x10, 0x42, 0x09, 
+  0xef, 0xb9, 0x17, 0x2e, 0x00, 0xf0, 0x29, 0xe1, 0x40, 0x31, 0x87, 0x40, 
+  0x79, 0x10, 0x41, 0x04, 0x36, 0xc0, 0x94, 0x62, 0x42, 0xca, 0x22, 0x89, 
+  0x03, 0x42, 0x40, 0x04, 0x32, 0x80, 0x84, 0xca, 0x20, 0x89, 0x00, 0x22, 
+  0x41, 0x04, 0x30, 0x40, 0x84, 0x6c, 0x70, 0xca, 0x21, 0x09, 0x00, 0x50, 
+  0x26, 0xfe, 0x97, 0x4c, 0x70, 0x05, 0xf2, 0x07, 0x31, 0x80, 0x03, 0x48, 
+  0x30, 0x42, 0x02, 0xfc, 0x02, 0xa0, 0x94, 0x1e, 0x50, 0x23, 0xfe, 0xa7, 
+  0x0c, 0x70, 0x4e, 0xad, 0x18, 0x00, 0xa0, 0xc0, 0x04, 0x48, 0x30, 0x40, 
+  0x02, 0x06, 0xad, 0x50, 0x22, 0x14, 0x00, 0x10, 0x06, 0x2a, 0x00, 0x01, 
+  0x12, 0x00, 0x60, 0x50, 0x21, 0xfe, 0xa7, 0x05, 0xad, 0x10, 0x00, 0xf0, 
+  0x23, 0x40, 0x04, 0x48, 0x30, 0x43, 0x02, 0x04, 0x85, 0x6d, 0xad, 0x02, 
+  0x30, 0x40, 0x00, 0xbf, 0xb8, 0x04, 0x30, 0x80, 0x8f, 0x83, 0x3a, 0x6f, 
+  0x12, 0xc8, 0xf6, 0x04, 0x15, 0xc0, 0x10, 0x3e, 0x0e, 0x20, 0x04, 0x24, 
+  0xa5, 0x04, 0xad, 0xce, 0xc6, 0xe0, 0x78, 0xee, 0xc3, 0xa1, 0xc1, 0x28, 
+  0x46, 0x46, 0x0c, 0x16, 0x04, 0x21, 0xb2, 0x0a, 0x2e, 0x01, 0x10, 0x45, 
+  0x22, 0x01, 0x24, 0x2a, 0x0c, 0xcc, 0x02, 0x32, 0xe1, 0x41, 0x1e, 0x0c, 
+  0x00, 0x01, 0x22, 0x01, 0x12, 0x12, 0x0c, 0x00, 0x61, 0x43, 0x3c, 0xd8, 
+  0xe1, 0x41, 0x06, 0x0c, 0x00, 0x82, 0x56, 0x70, 0x10, 0x42, 0x03, 0xf2, 
+  0xce, 0xc7, 0xa8, 0x00, 0xf0, 0x73, 0x0d, 0x8d, 0xcb, 0x47, 0xa1, 0x00, 
+  0x9d, 0x16, 0x0d, 0xe8, 0x2b, 0x8f, 0x17, 0x09, 0x5e, 0x01, 0x20, 0x85, 
+  0x09, 0x29, 0x3e, 0x80, 0x07, 0xf4, 0x86, 0x0e, 0x0f, 0xef, 0x5e, 0x0b, 
+  0x20, 0x04, 0x62, 0x42, 0x4e, 0x8d, 0x26, 0x8d, 0x05, 0x8d, 0x05, 0x21, 
+  0x83, 0x00, 0x05, 0x23, 0x3e, 0x80, 0x1d, 0xf2, 0x60, 0x8f, 0x01, 0x8f, 
+  0xe2, 0x8f, 0xcb, 0x44, 0xa1, 0x00, 0x6c, 0x16, 0x0c, 0xbb, 0x04, 0xb8, 
+  0x24, 0xbf, 0x65, 0x78, 0x6e, 0x94, 0xe5, 0x78, 0x23, 0xb8, 0x17, 0x20, 
+  0xc3, 0x00, 0x7c, 0x78, 0x0c, 0x78, 0xe0, 0x9c, 0x02, 0x14, 0xcc, 0x10, 
+  0x4c, 0xb8, 0xec, 0x7b, 0x8c, 0x78, 0x4b, 0xbb, 0x04, 0xb8, 0x4e, 0xb8, 
+  0x78, 0x60, 0x06, 0xa5, 0x0c, 0xea, 0x00, 0x85, 0x09, 0x28, 0xbe, 0x80, 
+  0x08, 0xf4, 0x2a, 0x0e, 0x0f, 0xef, 0x02, 0x0b, 0x20, 0x04, 0xc1, 0x42, 
+  0x26, 0x8d, 0x0a, 0xe9, 0x16, 0x00, 0xf4, 0x03, 0x7e, 0x80, 0x06, 0xf4, 
+  0x16, 0x0e, 0x0f, 0xef, 0xee, 0x0a, 0x20, 0x04, 0x22, 0x42, 0x05, 0x8d, 
+  0x0b, 0xe8, 0x88, 0x00, 0xf0, 0x04, 0xfe, 0x0d, 0x0f, 0xef, 0xd6, 0x0a, 
+  0x20, 0x04, 0x02, 0x42, 0x0f, 0x0b, 0x10, 0x20, 0xb9, 0x13, 0xc0, 0x20, 
+  0x19, 0x7c, 0x03, 0x30, 0x0a, 0x10, 0x20, 0xec, 0x01, 0x31, 0x0d, 0x08, 
+  0x12, 0x96, 0x02, 0xa0, 0x05, 0xf0, 0x30, 0xd8, 0x03, 0x1c, 0x02, 0x30, 
+  0x1c, 0xe6, 0xa0, 0x02, 0xf1, 0x00, 0x71, 0xd9, 0x6c, 0x71, 0x8c, 0x70, 
+  0xac, 0x70, 0x72, 0x09, 0xa0, 0x04, 0xc1, 0x40, 0x55, 0x1a, 0x00, 0x00, 
+  0x18, 0x00, 0x13, 0x74, 0x18, 0x00, 0x11, 0x5a, 0x18, 0x00, 0xe0, 0x00, 
+  0x85, 0x04, 0x71, 0x00, 0xa5, 0xce, 0xc7, 0xe0, 0x78, 0xea, 0xc2, 0xf6, 
+  0x0a, 0x74, 0x04, 0x26, 0x62, 0x09, 0x1c, 0x04, 0x20, 0xda, 0x0a, 0x2c, 
+  0x01, 0x20, 0x08, 0x47, 0x10, 0x04, 0x11, 0xce, 0x0c, 0x00, 0x71, 0x10, 
+  0x41, 0x13, 0xd8, 0xc1, 0x41, 0xc2, 0x0c, 0x00, 0xf4, 0x03, 0xb9, 0x10, 
+  0x81, 0x20, 0xc6, 0xb9, 0xb9, 0x18, 0x42, 0x20, 0x05, 0xef, 0xb9, 0x17, 
+  0xc1, 0x10, 0x33, 0x09, 0x10, 0x04, 0x71, 0xc1, 0x20, 0x27, 0x09, 0x12, 
+  0x00, 0x06, 0x32, 0x04, 0x15, 0x1b, 0x1a, 0x04, 0x3d, 0x2e, 0x0c, 0x20, 
+  0x1a, 0x04, 0x24, 0xe0, 0x78, 0x1c, 0x04, 0x46, 0x06, 0x0d, 0xef, 0xff, 
+  0x1c, 0x04, 0x13, 0x16, 0x2c, 0x00, 0x0e, 0x1c, 0x04, 0x13, 0xb8, 0xa8, 
+  0x03, 0x51, 0xea, 0xc2, 0x30, 0x41, 0x42, 0xb2, 0x00, 0x20, 0xb2, 0x08, 
+  0x22, 0x04, 0x00, 0x1c, 0x04, 0x10, 0x2a, 0x98, 0x00, 0x10, 0x41, 0x80, 
+  0x00, 0x00, 0x1c, 0x04, 0x40, 0xca, 0xc6, 0x00, 0x16, 0x6a, 0x00, 0x20, 
+  0xac, 0x1e, 0xde, 0x01, 0xf1, 0x6a, 0x83, 0x16, 0x9f, 0x80, 0x1a, 0x21, 
+  0x81, 0x0f, 0x00, 0x00, 0xcd, 0x0c, 0x0c, 0x70, 0x0b, 0x17, 0x02, 0x11, 
+  0x97, 0xb8, 0x19, 0x61, 0x41, 0x28, 0x49, 0x02, 0x14, 0x6a, 0x42, 0x29, 
+  0x08, 0x06, 0x00, 0x17, 0xc1, 0x10, 0x01, 0x17, 0xc2, 0x10, 0x0d, 0x17, 
+  0x0e, 0x11, 0x1e, 0x20, 0x43, 0x10, 0x1e, 0x20, 0x8b, 0x10, 0x1e, 0x20, 
+  0x02, 0x12, 0x02, 0x17, 0xc1, 0x10, 0x10, 0x7d, 0x08, 0x8c, 0x4c, 0x79, 
+  0x89, 0x8c, 0xcb, 0xbe, 0x46, 0xb9, 0x61, 0x71, 0x21, 0x71, 0x08, 0xb8, 
+  0x2c, 0x7e, 0x85, 0x78, 0x7c, 0x7a, 0xa2, 0x78, 0x53, 0x48, 0x42, 0x2e, 
+  0x81, 0x12, 0x04, 0x17, 0xc2, 0x10, 0x6c, 0x79, 0x03, 0x8f, 0x1e, 0x20, 
+  0x82, 0x10, 0x42, 0x29, 0x83, 0x03, 0x6c, 0x7b, 0x97, 0x68, 0x98, 0x62, 
+  0x5c, 0x68, 0x42, 0x2b, 0x80, 0x02, 0x4c, 0xe2, 0x03, 0xf1, 0x02, 0xb4, 
+  0x1e, 0x1d, 0x78, 0x38, 0x60, 0x36, 0xb8, 0x00, 0xaa, 0x23, 0x20, 0x00, 
+  0x04, 0x22, 0x40, 0xca, 0x74, 0x04, 0x1f, 0xbc, 0x74, 0x04, 0x20, 0x3f, 
+  0x8e, 0x0f, 0x60, 0x74, 0x04, 0x00, 0x4f, 0xd2, 0x0d, 0xe0, 0x03, 0x74, 
+  0x04, 0x01, 0x28, 0x26, 0x08, 0x74, 0x04, 0x44, 0xb8, 0x1e, 0xbd, 0x02, 
+  0x74, 0x04, 0x31, 0xbc, 0x1e, 0xdd, 0x0c, 0x00, 0x20, 0xf6, 0xc3, 0x1e, 
+  0x01, 0xf4, 0x05, 0x94, 0x1e, 0x0c, 0x8f, 0x14, 0x70, 0x98, 0x02, 0x22, 
+  0x00, 0xa1, 0xc1, 0xb6, 0xd8, 0xd3, 0x41, 0xa1, 0x00, 0xf0, 0x49, 0x32, 
+  0x02, 0xf4, 0x07, 0x40, 0x21, 0x00, 0x27, 0x60, 0xd9, 0x6c, 0x71, 0x16, 
+  0x0f, 0x60, 0x04, 0x10, 0x42, 0xe2, 0x0a, 0x6f, 0xee, 0x0a, 0xd8, 0x54, 
+  0xdd, 0x4c, 0x02, 0xa0, 0x42, 0x40, 0xfe, 0x0e, 0x60, 0x04, 0x03, 0x1c, 
+  0x42, 0x33, 0x12, 0x00, 0x11, 0x72, 0x12, 0x00, 0x11, 0xea, 0x12, 0x00, 
+  0x35, 0x43, 0x30, 0x84, 0x76, 0x02, 0xc0, 0x75, 0xd9, 0x6c, 0x71, 0xd6, 
+  0x0e, 0x60, 0x04, 0x42, 0x40, 0xcb, 0x46, 0x34, 0x03, 0xf0, 0x15, 0x8a, 
+  0xd9, 0x0a, 0xdb, 0x42, 0x40, 0x1a, 0x0d, 0xe0, 0x03, 0xc1, 0x42, 0x94, 
+  0xd9, 0x0d, 0xdb, 0x40, 0x26, 0x82, 0x12, 0x0e, 0x0d, 0xe0, 0x03, 0x42, 
+  0x40, 0xe4, 0xd9, 0x0b, 0xdb, 0x40, 0x26, 0xc2, 0x15, 0xfe, 0x0c, 0x0e, 
+  0x00, 0x91, 0xe1, 0xd9, 0x6c, 0x73, 0x40, 0x26, 0x82, 0x18, 0xf2, 0x0e, 
+  0x00, 0x92, 0x2c, 0x70, 0x6c, 0x71, 0x40, 0x26, 0x42, 0x19, 0xe2, 0x0e, 
+  0x00, 0x10, 0x72, 0x0e, 0x00, 0x32, 0x82, 0x19, 0xd6, 0x0e, 0x00, 0x10, 
+  0x74, 0x0e, 0x00, 0x31, 0xc2, 0x19, 0xc6, 0x0e, 0x00, 0xf0, 0x11, 0x25, 
+  0x16, 0x89, 0x10, 0x22, 0x16, 0x82, 0x10, 0x23, 0x16, 0x8b, 0x10, 0x24, 
+  0x16, 0x87, 0x10, 0x26, 0x16, 0x81, 0x10, 0x92, 0x96, 0x71, 0x96, 0x0f, 
+  0xd8, 0x27, 0x16, 0x88, 0x10, 0x0c, 0xb8, 0xb0, 0x00, 0xf8, 0x23, 0x26, 
+  0x1e, 0x42, 0x12, 0xb4, 0x6a, 0x41, 0x2b, 0x09, 0x11, 0x53, 0x23, 0xcb, 
+  0x10, 0x40, 0x2f, 0x02, 0x01, 0x24, 0xb9, 0x04, 0x7c, 0x04, 0x7b, 0x05, 
+  0x21, 0x40, 0x13, 0x05, 0x22, 0xc2, 0x02, 0xc1, 0xb9, 0x85, 0x78, 0x45, 
+  0x7b, 0x41, 0x28, 0x06, 0x11, 0x27, 0x1e, 0x42, 0x10, 0x12, 0xb6, 0x71, 
+  0xb6, 0x40, 0x03, 0xf0, 0x40, 0x42, 0x40, 0x1a, 0x0e, 0x60, 0x04, 0x28, 
+  0x1e, 0x82, 0x11, 0xc6, 0x0a, 0xaf, 0xfe, 0x20, 0x16, 0xc0, 0x10, 0xc3, 
+  0x43, 0xb0, 0x3f, 0x00, 0x00, 0x4c, 0x70, 0x5e, 0x0d, 0x6f, 0xfe, 0x70, 
+  0x40, 0xc3, 0x43, 0x48, 0x40, 0x00, 0x80, 0xca, 0x0b, 0xaf, 0xfe, 0x4c, 
+  0x70, 0x10, 0x45, 0x0f, 0x9e, 0x9e, 0x0a, 0xaf, 0xfe, 0x30, 0x46, 0x3f, 
+  0xdb, 0x4c, 0x70, 0x3e, 0x0d, 0x6f, 0xfe, 0x18, 0xbb, 0xcb, 0x45, 0x00, 
+  0xe0, 0x00, 0x00, 0xc3, 0x43, 0x40, 0x3f, 0x4d, 0x62, 0xa1, 0x42, 0x2a, 
+  0x34, 0x00, 0xf0, 0x27, 0x43, 0xc3, 0x43, 0x63, 0x3f, 0x4e, 0x40, 0x96, 
+  0x0b, 0xaf, 0xfe, 0x50, 0x25, 0x82, 0x17, 0xc3, 0x43, 0x76, 0x40, 0x00, 
+  0x80, 0x0e, 0x0d, 0x6f, 0xfe, 0x4c, 0x70, 0x4f, 0x20, 0x83, 0x25, 0x4c, 
+  0x70, 0x7a, 0x0b, 0xaf, 0xfe, 0x70, 0x44, 0xa2, 0x42, 0xfa, 0x0c, 0x6f, 
+  0xfe, 0xc2, 0x43, 0x08, 0x45, 0x21, 0x16, 0xc0, 0x10, 0x46, 0x58, 0x00, 
+  0x90, 0x45, 0xc3, 0x43, 0x50, 0x3f, 0x00, 0x00, 0xe2, 0x0c, 0x2c, 0x00, 
+  0x40, 0xc3, 0x43, 0x39, 0x40, 0x88, 0x00, 0x20, 0xd6, 0x0c, 0x88, 0x00, 
+  0xf1, 0x00, 0xa1, 0x42, 0x46, 0x0b, 0xaf, 0xfe, 0xa2, 0x43, 0x10, 0x45, 
+  0x27, 0x16, 0x80, 0x10, 0x2e, 0x86, 0x00, 0x31, 0xcb, 0x45, 0x10, 0x22, 
+  0x00, 0xf1, 0x02, 0x2a, 0x0b, 0xaf, 0xfe, 0xa1, 0x43, 0x4c, 0x70, 0x56, 
+  0x0a, 0xef, 0xfe, 0xa1, 0x43, 0xa2, 0x42, 0xa2, 0x58, 0x00, 0x51, 0x4f, 
+  0x20, 0xc3, 0x27, 0x12, 0xb8, 0x00, 0xf4, 0x2d, 0xc3, 0x43, 0x0b, 0x40, 
+  0x33, 0x33, 0x8e, 0x0c, 0x6f, 0xfe, 0x50, 0x25, 0x02, 0x15, 0x08, 0x45, 
+  0x26, 0x16, 0xc0, 0x10, 0xd6, 0x09, 0xaf, 0xfe, 0x30, 0x40, 0xc3, 0x42, 
+  0xf1, 0xd2, 0xfc, 0xa9, 0x72, 0x0c, 0x6f, 0xfe, 0x4f, 0x23, 0x43, 0x25, 
+  0x4c, 0x70, 0xe2, 0x0a, 0xaf, 0xfe, 0x82, 0x43, 0xa1, 0x42, 0x0e, 0x0a, 
+  0xef, 0xfe, 0x02, 0x43, 0x62, 0x0f, 0xcf, 0xfe, 0xfa, 0x01, 0x13, 0x5a, 
+  0x30, 0x01, 0x20, 0xea, 0x0c, 0xfe, 0x01, 0x15, 0x59, 0x12, 0x02, 0x13, 
+  0x64, 0x18, 0x00, 0x11, 0xd2, 0x18, 0x00, 0xf0, 0x05, 0x04, 0x17, 0xc0, 
+  0x10, 0x19, 0x08, 0x33, 0x00, 0x7f, 0xd8, 0x17, 0xb8, 0xc3, 0x41, 0x13, 
+  0x00, 0x94, 0xbc, 0x26, 0x08, 0x06, 0x05, 0xf0, 0x27, 0x04, 0xaf, 0x0c, 
+  0x1f, 0x43, 0x10, 0x0c, 0x70, 0xd6, 0xc7, 0xe2, 0xc2, 0x48, 0x45, 0x0e, 
+  0xe9, 0x40, 0x85, 0x19, 0x0a, 0x00, 0x00, 0x13, 0x08, 0xb4, 0x00, 0x8c, 
+  0x20, 0xc3, 0x8f, 0xcc, 0x20, 0x82, 0x8f, 0x00, 0x00, 0x80, 0x00, 0x06, 
+  0xf4, 0x00, 0xa5, 0xce, 0x0d, 0xe0, 0x03, 0x0c, 0x70, 0x40, 0x85, 0x40, 
+  0x40, 0xc2, 0xc6, 0x48, 0x03, 0xf7, 0x32, 0x9c, 0x11, 0x03, 0x00, 0x28, 
+  0x46, 0xa0, 0x11, 0x01, 0x00, 0x04, 0x33, 0x00, 0x80, 0xca, 0x20, 0xc5, 
+  0x00, 0x4a, 0x24, 0x40, 0x71, 0x04, 0x30, 0x40, 0x80, 0x48, 0x45, 0xca, 
+  0x20, 0x45, 0x00, 0x0a, 0x21, 0x80, 0x0f, 0xa1, 0x00, 0x18, 0x42, 0xa8, 
+  0x20, 0x00, 0x02, 0x04, 0x11, 0x02, 0x04, 0x04, 0x32, 0x00, 0x80, 0x44, 
+  0xf6, 0xe0, 0x78, 0x83, 0xda, 0x17, 0xba, 0x00, 0x85, 0x02, 0x30, 0x80, 
+  0x82, 0x06, 0x46, 0xc2, 0xf6, 0x40, 0xa5, 0x42, 0x05, 0x00, 0xba, 0x03, 
+  0x22, 0x0c, 0x4a, 0x08, 0x02, 0x90, 0x16, 0x0c, 0x60, 0x04, 0xac, 0x70, 
+  0x0c, 0x70, 0x82, 0xca, 0x02, 0xf4, 0x02, 0x41, 0x00, 0x85, 0xc4, 0xc7, 
+  0xea, 0xc2, 0xae, 0x0d, 0xef, 0xee, 0x10, 0x40, 0x1a, 0x0c, 0xef, 0xee, 
+  0x48, 0x05, 0x40, 0x92, 0x0d, 0xef, 0xee, 0x48, 0x05, 0x51, 0x0f, 0xd8, 
+  0xc1, 0x41, 0x86, 0x0c, 0x00, 0x02, 0x48, 0x05, 0x11, 0x7a, 0x0c, 0x00, 
+  0x0c, 0x48, 0x05, 0x17, 0x2f, 0x48, 0x05, 0x15, 0x23, 0x48, 0x05, 0x42, 
+  0x17, 0x08, 0x12, 0x00, 0xae, 0x06, 0x40, 0xe6, 0x0e, 0xe0, 0x03, 0x12, 
+  0x07, 0x4a, 0x00, 0x1d, 0x01, 0x10, 0x44, 0x05, 0x37, 0xc2, 0x0f, 0xaf, 
+  0x44, 0x05, 0x4f, 0xd2, 0x0e, 0xe0, 0x03, 0x44, 0x05, 0x03, 0x13, 0xb0, 
+  0x78, 0x04, 0xc0, 0xb9, 0x11, 0xc2, 0x00, 0x54, 0x70, 0xe1, 0x20, 0xca, 
+  0x07, 0x00, 0x43, 0x14, 0x04, 0xf2, 0x03, 0x94, 0x1e, 0x06, 0x82, 0x15, 
+  0x78, 0x55, 0x20, 0x00, 0x08, 0x48, 0xb8, 0x05, 0xa2, 0x20, 0x40, 0x00, 
+  0x7b, 0x30, 0x00, 0x13, 0x9c, 0x30, 0x00, 0x90, 0x0f, 0xd8, 0xe0, 0x7f, 
+  0x1a, 0xb8, 0xe0, 0x78, 0xe2, 0xa8, 0x04, 0x41, 0x45, 0xb6, 0xd8, 0x02, 
+  0x12, 0x01, 0x13, 0x82, 0x12, 0x01, 0x60, 0xe0, 0xd9, 0x6c, 0x71, 0xf2, 
+  0x0a, 0xfa, 0x03, 0xc0, 0x03, 0x30, 0xbe, 0x0e, 0x2f, 0xee, 0x0a, 0xd8, 
+  0x09, 0x85, 0x1c, 0xe5, 0xc4, 0x04, 0x40, 0x25, 0x08, 0xf5, 0x00, 0x28, 
+  0x00, 0x00, 0x98, 0x04, 0x40, 0x73, 0xd9, 0xa4, 0xb8, 0x38, 0x00, 0x42, 
+  0x6c, 0x71, 0xc6, 0x0a, 0xca, 0x04, 0x60, 0xc2, 0x30, 0x50, 0xd9, 0x05, 
+  0xf0, 0x08, 0x00, 0x00, 0xca, 0x04, 0x24, 0x06, 0x09, 0xca, 0x04, 0x53, 
+  0x03, 0xf2, 0xc2, 0xc7, 0x03, 0xca, 0x04, 0xa0, 0xfc, 0xf5, 0x5a, 0x0b, 
+  0xcf, 0xff, 0x0c, 0x70, 0xc2, 0xc7, 0xa8, 0x00, 0x62, 0xb0, 0x1e, 0xf5, 
+  0x05, 0xcf, 0xff, 0xc8, 0x04, 0x40, 0x9c, 0x1e, 0x15, 0x06, 0x0c, 0x00, 
+  0xf0, 0x33, 0xe4, 0xc2, 0x3f, 0x80, 0x08, 0x45, 0xb9, 0x10, 0x80, 0x00, 
+  0x41, 0x81, 0xc2, 0x81, 0xc6, 0xb8, 0xb9, 0x1d, 0x02, 0x10, 0x05, 0xea, 
+  0xb9, 0x12, 0xc0, 0x00, 0x25, 0x08, 0x12, 0x00, 0x7a, 0x0b, 0xa0, 0x00, 
+  0xa1, 0x40, 0x07, 0xee, 0x0f, 0x08, 0x91, 0x00, 0xb9, 0x16, 0xc0, 0x10, 
+  0x11, 0x08, 0x12, 0x00, 0x2c, 0x74, 0x4c, 0x70, 0x8a, 0x08, 0xe0, 0x01, 
+  0xa1, 0x40, 0x0c, 0x70, 0xc4, 0xc6, 0xe4, 0xc2, 0x3e, 0x00, 0xf1, 0x08, 
+  0xc0, 0x00, 0x33, 0x08, 0x12, 0x00, 0x1f, 0x85, 0x21, 0x80, 0xc2, 0x80, 
+  0x06, 0xe9, 0xb9, 0x11, 0xc0, 0x00, 0x23, 0x08, 0x12, 0x00, 0x3a, 0x3e, 
+  0x00, 0x33, 0x08, 0xee, 0x0d, 0x3e, 0x00, 0x12, 0x0f, 0x3e, 0x00, 0x21, 
+  0x71, 0x4a, 0x3e, 0x00, 0xf0, 0x1c, 0xb9, 0x15, 0x81, 0x10, 0x0c, 0x70, 
+  0x87, 0xb9, 0xb9, 0x1d, 0x42, 0x10, 0xc4, 0xc6, 0x1f, 0x80, 0x56, 0x20, 
+  0x80, 0x0b, 0xe0, 0x7f, 0x00, 0x88, 0xe0, 0x78, 0xf8, 0x1c, 0xc8, 0xb7, 
+  0x1c, 0xe0, 0x1f, 0x09, 0xb0, 0x00, 0x06, 0x1c, 0x05, 0x30, 0x1f, 0x09, 
+  0x70, 0x06, 0x01, 0x50, 0x31, 0x4c, 0x70, 0x95, 0xe9, 0x08, 0x00, 0x30, 
+  0x71, 0xd9, 0x06, 0xc0, 0x05, 0xf0, 0x20, 0x31, 0x73, 0xd9, 0x02, 0xf0, 
+  0x72, 0xd9, 0x0e, 0x08, 0xe0, 0x03, 0x6c, 0x72, 0x07, 0x14, 0xc0, 0x30, 
+  0x0f, 0x7a, 0x14, 0x70, 0xc5, 0x22, 0x8b, 0x0f, 0x00, 0x00, 0x00, 0xff, 
+  0x08, 0x14, 0x1f, 0x34, 0xe0, 0x7f, 0x40, 0x40, 0xe0, 0x78, 0x1f, 0x80, 
+  0xe0, 0x7f, 0x5e, 0x10, 0x00, 0x06, 0x08, 0x00, 0x13, 0x5a, 0x08, 0x00, 
+  0xf5, 0x40, 0x59, 0x10, 0x00, 0x06, 0xea, 0xc3, 0xa2, 0xc1, 0xbf, 0x83, 
+  0x70, 0x41, 0x50, 0x40, 0x28, 0x47, 0x88, 0xe0, 0xcd, 0x70, 0x92, 0xf2, 
+  0x69, 0x08, 0x50, 0x01, 0x6f, 0x08, 0xf0, 0x01, 0x14, 0x71, 0x91, 0xf4, 
+  0x00, 0x10, 0x00, 0x21, 0x23, 0xde, 0x14, 0x76, 0x1a, 0x01, 0x25, 0x00, 
+  0x2c, 0x70, 0x4c, 0x76, 0xf6, 0x0e, 0x2f, 0xf1, 0xe1, 0x40, 0x2c, 0x70, 
+  0x6a, 0x0f, 0xef, 0xff, 0x22, 0x40, 0x41, 0x28, 0x01, 0x02, 0xbe, 0x1d, 
+  0x1c, 0x10, 0x00, 0xaf, 0x21, 0xaf, 0x2c, 0x71, 0x56, 0x14, 0x00, 0xb5, 
+  0xbf, 0x1d, 0x1c, 0x10, 0x02, 0xaf, 0x23, 0xaf, 0x2c, 0x72, 0x42, 0x14, 
+  0x00, 0xf0, 0x0b, 0xc0, 0x1d, 0x1c, 0x10, 0x04, 0xaf, 0xcd, 0x70, 0x25, 
+  0xaf, 0x00, 0x18, 0x85, 0x21, 0x65, 0xf0, 0x80, 0x25, 0x86, 0x10, 0x00, 
+  0x8d, 0xc1, 0xb8, 0x5c, 0xf0, 0x64, 0x00, 0xc0, 0x61, 0xc6, 0x02, 0x1c, 
+  0x84, 0x33, 0xb3, 0x08, 0xb4, 0x01, 0x23, 0xde, 0x30, 0x06, 0x00, 0xee, 
+  0x01, 0xa0, 0x7c, 0xd9, 0x6c, 0x72, 0x3a, 0x0f, 0xa0, 0x03, 0x10, 0x41, 
+  0xc6, 0x01, 0x40, 0x38, 0x15, 0x06, 0x10, 0xee, 0x00, 0x90, 0x07, 0x1c, 
+  0x02, 0x30, 0xa0, 0xb8, 0x06, 0x1c, 0x02, 0x20, 0x00, 0x01, 0x02, 0x04, 
+  0x80, 0x22, 0x40, 0xf6, 0x08, 0x60, 0x04, 0xcd, 0x70, 0x1e, 0x00, 0xd1, 
+  0x2f, 0xd9, 0x6c, 0x71, 0x22, 0x40, 0xaa, 0x08, 0x60, 0x04, 0x06, 0x1c, 
+  0x43, 0x5c, 0x02, 0xa0, 0x34, 0xd9, 0x6c, 0x73, 0xf2, 0x0e, 0xa0, 0x03, 
+  0x22, 0x40, 0x46, 0x00, 0xf2, 0x1d, 0x21, 0xc1, 0x8c, 0x70, 0x41, 0x28, 
+  0x83, 0x01, 0x53, 0x20, 0x4c, 0x00, 0xc0, 0xb9, 0x41, 0x28, 0x4b, 0x01, 
+  0x41, 0x28, 0xc2, 0x00, 0x22, 0xb8, 0x25, 0xaf, 0x44, 0x23, 0x41, 0x10, 
+  0xc1, 0xba, 0xc0, 0xb8, 0x64, 0xaf, 0x80, 0xaf, 0x23, 0xaf, 0x42, 0xaf, 
+  0x01, 0xaf, 0x72, 0x00, 0x20, 0xc2, 0x31, 0x68, 0x00, 0x00, 0x66, 0x00, 
+  0x40, 0x92, 0x08, 0x60, 0x04, 0xbc, 0x00, 0xf0, 0x15, 0x07, 0xf0, 0xe7, 
+  0x15, 0x80, 0x10, 0x00, 0xaf, 0x00, 0x18, 0x45, 0x20, 0xc1, 0x40, 0xca, 
+  0xc7, 0xe0, 0x78, 0xe6, 0xc2, 0xdf, 0x80, 0x08, 0x45, 0x2c, 0x70, 0xc9, 
+  0x47, 0x80, 0x27, 0xc2, 0x1f, 0x14, 0xda, 0xce, 0x0d, 0x26, 0x01, 0xf2, 
+  0x25, 0x0c, 0x70, 0x7f, 0xd9, 0x23, 0xda, 0x17, 0xb9, 0x5e, 0x1e, 0x18, 
+  0x10, 0x95, 0x1f, 0x02, 0x10, 0x30, 0x1e, 0x02, 0x10, 0x54, 0x1e, 0x18, 
+  0x10, 0xa1, 0x40, 0xa0, 0xa6, 0x4d, 0xa6, 0x5a, 0x09, 0xa0, 0x01, 0x2e, 
+  0xa6, 0xc6, 0xc6, 0x3f, 0x80, 0x0c, 0x71, 0x5e, 0x11, 0x02, 0x06, 0x8c, 
+  0x22, 0xc3, 0x8f, 0xcc, 0x22, 0x90, 0x04, 0xe0, 0xe0, 0x7c, 0x8b, 0xea, 
+  0x54, 0x11, 0x01, 0x06, 0x8c, 0x21, 0x02, 0x80, 0xcc, 0x21, 0x14, 0x00, 
+  0x41, 0xff, 0x00, 0xe0, 0x7c, 0x86, 0x03, 0xf0, 0x0c, 0x78, 0xfa, 0xc2, 
+  0xfc, 0x1c, 0xc8, 0xb6, 0xa7, 0xc1, 0x08, 0x45, 0x7c, 0x10, 0x14, 0x00, 
+  0x5a, 0xd8, 0x08, 0x1c, 0x01, 0x30, 0xab, 0x20, 0x08, 0x0e, 0x9a, 0x0a, 
+  0x64, 0x02, 0xf0, 0xed, 0x7f, 0xdb, 0x40, 0xd9, 0xa7, 0xda, 0x17, 0xbb, 
+  0x0e, 0x0d, 0x20, 0x02, 0xa1, 0x40, 0xff, 0xd9, 0xa1, 0x40, 0xca, 0x08, 
+  0xa0, 0x00, 0x40, 0x25, 0x1b, 0x17, 0x4a, 0x26, 0xc0, 0x12, 0xc5, 0x77, 
+  0x2f, 0x26, 0x87, 0xf3, 0x11, 0xf2, 0xc3, 0x40, 0xb0, 0x41, 0x00, 0x00, 
+  0x22, 0x0b, 0x0f, 0xee, 0x80, 0xc2, 0x2c, 0x73, 0x6c, 0x72, 0xd2, 0x0d, 
+  0xa0, 0x03, 0x63, 0x40, 0x01, 0x14, 0xc0, 0x30, 0xe1, 0x08, 0x13, 0x80, 
+  0xcd, 0x70, 0xed, 0x70, 0x0e, 0x70, 0x4a, 0x22, 0x00, 0x20, 0x8a, 0x23, 
+  0x81, 0x26, 0x80, 0xc2, 0x0c, 0xd9, 0x07, 0xdb, 0x63, 0x40, 0xae, 0x0d, 
+  0xa0, 0x03, 0xab, 0x23, 0x08, 0x2e, 0x01, 0x14, 0x99, 0x30, 0x02, 0x14, 
+  0x97, 0x30, 0x03, 0x14, 0x95, 0x30, 0x04, 0x14, 0x91, 0x30, 0x05, 0x14, 
+  0x96, 0x30, 0x06, 0x14, 0x98, 0x30, 0x0a, 0x0b, 0x2f, 0xee, 0x16, 0xd8, 
+  0x40, 0x28, 0x18, 0x32, 0x40, 0x29, 0x11, 0x22, 0x40, 0x2f, 0x01, 0x22, 
+  0x46, 0x71, 0x05, 0x20, 0x8c, 0x35, 0x05, 0x21, 0x40, 0x25, 0x05, 0x21, 
+  0x43, 0x06, 0x2f, 0x22, 0x87, 0x04, 0x8e, 0x7c, 0x0e, 0x79, 0x6e, 0x78, 
+  0x9e, 0x66, 0x3f, 0x67, 0xad, 0x0a, 0x34, 0x82, 0x00, 0x20, 0x10, 0x20, 
+  0x44, 0x2e, 0x0e, 0x12, 0x80, 0xc2, 0x41, 0xd9, 0x6c, 0x72, 0x63, 0x40, 
+  0x44, 0x2f, 0x0f, 0x12, 0x45, 0xc6, 0x44, 0x28, 0x10, 0x22, 0x44, 0xc7, 
+  0x42, 0x0d, 0xa0, 0x03, 0x0c, 0x1c, 0x00, 0x34, 0x46, 0x8d, 0x01, 0x14, 
+  0x81, 0x30, 0x0c, 0x71, 0x00, 0x28, 0x9e, 0x00, 0x13, 0x69, 0x34, 0x74, 
+  0x01, 0x2e, 0x00, 0x70, 0x08, 0x10, 0x02, 0x04, 0xca, 0x20, 0x26, 0x00, 
+  0x2f, 0x25, 0x07, 0x00, 0x2f, 0x20, 0x40, 0x01, 0x04, 0x2e, 0x1e, 0x30, 
+  0x83, 0xc0, 0x82, 0xc2, 0x9e, 0x00, 0xf4, 0xe6, 0xd6, 0x0a, 0x60, 0x03, 
+  0x2f, 0x21, 0x88, 0x07, 0x14, 0x70, 0xaa, 0xf4, 0x26, 0x8d, 0x0b, 0x14, 
+  0xcb, 0x30, 0x0a, 0x14, 0x83, 0x30, 0x09, 0x14, 0x8c, 0x30, 0x1a, 0x25, 
+  0x89, 0x0f, 0x1e, 0x00, 0x80, 0x84, 0x22, 0xc2, 0xcb, 0x40, 0x00, 0x00, 
+  0x3d, 0x0f, 0x01, 0x29, 0x41, 0x10, 0x1e, 0x23, 0xc9, 0x02, 0x1e, 0x24, 
+  0xc3, 0x12, 0x1e, 0x22, 0xc2, 0x02, 0x1e, 0x21, 0x8b, 0x17, 0x1e, 0x23, 
+  0x8c, 0x07, 0x0f, 0x09, 0x24, 0x02, 0x1e, 0x22, 0x83, 0x07, 0x45, 0x29, 
+  0xc2, 0x09, 0x05, 0xf0, 0x05, 0x2e, 0x42, 0x70, 0x05, 0x00, 0x70, 0xf3, 
+  0x32, 0xe2, 0x85, 0x2a, 0x01, 0x09, 0x02, 0x26, 0xcd, 0x12, 0x94, 0x4f, 
+  0x0e, 0x23, 0x03, 0x04, 0x4f, 0x7e, 0x13, 0x0e, 0x70, 0x10, 0x4a, 0x23, 
+  0x00, 0x10, 0x4d, 0x7a, 0x5c, 0x7a, 0xfd, 0x0a, 0x71, 0x80, 0x65, 0x71, 
+  0x11, 0x71, 0xce, 0x23, 0x26, 0x10, 0xae, 0x7e, 0x8e, 0x7d, 0x6e, 0x7c, 
+  0x2f, 0x20, 0xc5, 0x12, 0xd1, 0x7b, 0xb1, 0x79, 0x15, 0x70, 0x91, 0x7a, 
+  0xd5, 0xf6, 0x42, 0x20, 0x49, 0x10, 0x6d, 0x71, 0x2e, 0x7f, 0x00, 0x2b, 
+  0x41, 0x12, 0x6e, 0x7b, 0x4e, 0x7a, 0x30, 0x79, 0x3b, 0x63, 0x3f, 0x67, 
+  0x3a, 0x62, 0x02, 0x2b, 0x03, 0x02, 0x02, 0x2f, 0x01, 0x12, 0x02, 0x2a, 
+  0x02, 0x02, 0x0d, 0xf0, 0x4d, 0xf6, 0x6e, 0x7b, 0x4e, 0x23, 0x0b, 0x10, 
+  0x2e, 0x79, 0x4e, 0x7a, 0x00, 0x2b, 0xc3, 0x02, 0x00, 0x29, 0xc1, 0x02, 
+  0x00, 0x2a, 0xc2, 0x02, 0x13, 0x0c, 0x32, 0x10, 0x4e, 0x7f, 0x8c, 0x27, 
+  0x02, 0x90, 0x89, 0xf6, 0x7f, 0xda, 0x07, 0xf0, 0x8c, 0x27, 0x42, 0x90, 
+  0x85, 0xf6, 0xc3, 0x42, 0x00, 0x00, 0x80, 0xff, 0x13, 0x0d, 0x32, 0x10, 
+  0x2e, 0x1c, 0x00, 0x15, 0xd9, 0x1c, 0x00, 0x11, 0x41, 0x1c, 0x00, 0x44, 
+  0x0e, 0x32, 0x10, 0x6e, 0x1c, 0x00, 0x15, 0xdb, 0x1c, 0x00, 0x10, 0x43, 
+  0x1c, 0x00, 0xf0, 0x03, 0xc0, 0x1c, 0xdc, 0x20, 0xbf, 0x1c, 0x5c, 0x20, 
+  0x11, 0x0c, 0x33, 0x10, 0xbe, 0x1c, 0x9c, 0x20, 0x53, 0x7a, 0x06, 0x00, 
+  0x60, 0x0b, 0x0d, 0x13, 0x10, 0x33, 0x79, 0x18, 0x00, 0xf0, 0x03, 0xd5, 
+  0x70, 0xce, 0x23, 0x2a, 0x00, 0x33, 0x7c, 0x53, 0x79, 0xbf, 0x1c, 0x1c, 
+  0x23, 0xbe, 0x1c, 0x5c, 0x20, 0x32, 0x00, 0x71, 0xa7, 0xc0, 0x04, 0x14, 
+  0x1b, 0x34, 0xda, 0x20, 0x07, 0xf0, 0x2b, 0x7f, 0x81, 0x4a, 0x24, 0xc0, 
+  0x70, 0xcb, 0x44, 0xa1, 0x00, 0x14, 0x21, 0x28, 0x45, 0x2c, 0x70, 0x0a, 
+  0x22, 0x00, 0x03, 0xa8, 0x20, 0xc0, 0x01, 0x08, 0x12, 0x8e, 0x04, 0x0b, 
+  0x0e, 0x05, 0x10, 0x24, 0x71, 0x2c, 0x73, 0x10, 0xde, 0x36, 0x7c, 0x21, 
+  0x84, 0x01, 0x8c, 0x38, 0x13, 0x06, 0x00, 0x56, 0x23, 0x82, 0x0b, 0xc0, 
+  0xaa, 0x59, 0x1b, 0x58, 0x00, 0x08, 0x07, 0x20, 0x3c, 0x4d, 0xb0, 0x05, 
+  0x11, 0x41, 0xc2, 0x03, 0x31, 0x3a, 0x0d, 0x20, 0x04, 0x07, 0xa0, 0x66, 
+  0x0e, 0xa0, 0x03, 0xa1, 0x41, 0xc1, 0x40, 0xc4, 0xc7, 0x20, 0x06, 0xd1, 
+  0xbf, 0x80, 0x1c, 0xe0, 0x29, 0x09, 0xb0, 0x00, 0x03, 0x1c, 0x82, 0x30, 
+  0x37, 0xfa, 0x04, 0x40, 0xc2, 0x30, 0x8b, 0xe9, 0x06, 0x00, 0x80, 0x71, 
+  0xd9, 0xca, 0x0c, 0x20, 0x04, 0x6c, 0x71, 0xd0, 0x03, 0x60, 0xad, 0x1d, 
+  0x02, 0x10, 0xc2, 0xc7, 0x16, 0x00, 0x35, 0x73, 0xd9, 0xb6, 0x16, 0x00, 
+  0x11, 0xaf, 0x16, 0x00, 0x35, 0x72, 0xd9, 0xa2, 0x12, 0x00, 0x11, 0xae, 
+  0x12, 0x00, 0xf0, 0x59, 0xf8, 0xc3, 0xa4, 0xc1, 0xff, 0x81, 0x28, 0x46, 
+  0x25, 0x08, 0x73, 0x04, 0x08, 0x45, 0x51, 0x0d, 0xb5, 0x10, 0x04, 0x17, 
+  0x11, 0x10, 0x08, 0x17, 0x10, 0x10, 0x22, 0x08, 0xa0, 0x01, 0xc1, 0x40, 
+  0x14, 0x70, 0x0a, 0x03, 0x21, 0x00, 0x80, 0xd9, 0x05, 0x03, 0x00, 0x00, 
+  0x91, 0xe5, 0x2a, 0x02, 0x21, 0x00, 0x3c, 0x4e, 0x8c, 0x25, 0x02, 0x90, 
+  0x0b, 0xf2, 0x8c, 0x25, 0xc3, 0x9f, 0x11, 0xf4, 0x8a, 0x20, 0x86, 0x00, 
+  0x08, 0x67, 0x14, 0x72, 0xf0, 0x03, 0x22, 0x00, 0xff, 0xd9, 0x80, 0xd9, 
+  0x6e, 0x0d, 0x60, 0x00, 0xc1, 0x40, 0xed, 0x03, 0x20, 0x00, 0x80, 0xd8, 
+  0x90, 0xe5, 0xe8, 0x03, 0x22, 0x00, 0x0c, 0x70, 0x83, 0x41, 0x05, 0xb1, 
+  0x9e, 0x04, 0xf1, 0x12, 0x02, 0xb1, 0x40, 0xc0, 0x3c, 0x4e, 0x40, 0x24, 
+  0x82, 0x32, 0x7d, 0xd9, 0x6c, 0x72, 0x72, 0x0a, 0xa0, 0x03, 0x10, 0x42, 
+  0x0b, 0x14, 0x80, 0x30, 0x40, 0x24, 0xc2, 0x32, 0x7d, 0xd9, 0x82, 0xb8, 
+  0x0b, 0xc4, 0x06, 0xf1, 0x18, 0x42, 0x40, 0xfe, 0x0b, 0x20, 0x04, 0x40, 
+  0x24, 0xd8, 0x32, 0x7f, 0xdd, 0x17, 0xbd, 0x8e, 0x0f, 0xef, 0xed, 0xa1, 
+  0x40, 0x41, 0xd9, 0x4c, 0x73, 0xc1, 0x40, 0x4a, 0x09, 0x20, 0x02, 0xa1, 
+  0x43, 0x6d, 0xd9, 0x08, 0xda, 0xc1, 0x40, 0x3e, 0x0c, 0x00, 0x71, 0x40, 
+  0xd9, 0xac, 0xda, 0xc1, 0x40, 0x32, 0x0c, 0x00, 0xa0, 0xc3, 0x40, 0x40, 
+  0x40, 0x00, 0x00, 0x5e, 0x0f, 0xcf, 0xed, 0x62, 0x00, 0xa4, 0x6d, 0xd9, 
+  0x6c, 0x72, 0x0e, 0x0a, 0xa0, 0x03, 0x42, 0x40, 0x62, 0x00, 0x15, 0x6d, 
+  0x62, 0x00, 0x64, 0x9e, 0x0b, 0x20, 0x04, 0x42, 0x40, 0x26, 0x00, 0x2a, 
+  0xea, 0x09, 0x26, 0x00, 0x13, 0x80, 0x26, 0x00, 0x11, 0x7a, 0x26, 0x00, 
+  0x71, 0xcb, 0x45, 0x70, 0x42, 0x00, 0x00, 0x0a, 0x86, 0x00, 0x02, 0xf8, 
+  0x03, 0x11, 0xba, 0x30, 0x00, 0xf0, 0x08, 0x03, 0x14, 0x97, 0x30, 0x04, 
+  0x14, 0x94, 0x30, 0x01, 0x14, 0x96, 0x30, 0x02, 0x14, 0x93, 0x30, 0x05, 
+  0x14, 0x95, 0x30, 0x06, 0x14, 0x90, 0x60, 0x05, 0x01, 0x56, 0x00, 0x1b, 
+  0x92, 0x56, 0x00, 0x13, 0xa2, 0x56, 0x00, 0x19, 0x22, 0x7c, 0x00, 0x1f, 
+  0x6e, 0x7c, 0x00, 0x04, 0x20, 0xfe, 0x0a, 0x26, 0x00, 0x26, 0x92, 0x0e, 
+  0x76, 0x00, 0x11, 0x42, 0x2a, 0x00, 0xf0, 0x4b, 0x02, 0x14, 0x8c, 0x30, 
+  0x01, 0x14, 0x87, 0x30, 0x04, 0x14, 0x86, 0x30, 0x40, 0x28, 0x01, 0x22, 
+  0x03, 0x14, 0x89, 0x30, 0x40, 0x2b, 0x00, 0x22, 0x05, 0x21, 0x42, 0x05, 
+  0x08, 0xbc, 0x40, 0x2c, 0x0b, 0x22, 0x05, 0x20, 0x81, 0x05, 0x2f, 0x24, 
+  0x86, 0x00, 0x05, 0x24, 0xc2, 0x11, 0x05, 0x23, 0xc0, 0x15, 0x2e, 0x79, 
+  0x40, 0x2e, 0x0b, 0x02, 0x4e, 0x7a, 0x06, 0x14, 0x83, 0x30, 0x42, 0x79, 
+  0x05, 0x23, 0x42, 0x12, 0x05, 0x14, 0x8d, 0x30, 0x0e, 0x78, 0x4e, 0x7a, 
+  0x42, 0x78, 0x08, 0xbb, 0x9a, 0x21, 0x0f, 0x0a, 0x9a, 0x20, 0x0f, 0x0a, 
+  0xa5, 0x7b, 0x02, 0x04, 0xf0, 0x01, 0x00, 0x08, 0x6e, 0x7b, 0x04, 0x29, 
+  0x01, 0x02, 0x04, 0x28, 0x02, 0x02, 0x02, 0x24, 0xc0, 0x00, 0x1a, 0x00, 
+  0xf0, 0x3d, 0x2f, 0x27, 0x46, 0x20, 0x04, 0x28, 0x00, 0x02, 0x4e, 0x7b, 
+  0x2f, 0x22, 0xc9, 0x05, 0x71, 0x79, 0x50, 0x7a, 0x30, 0x79, 0xd3, 0x71, 
+  0x00, 0x00, 0x97, 0x3a, 0x3c, 0x22, 0x90, 0x0f, 0x00, 0x00, 0x80, 0x3e, 
+  0x24, 0x01, 0x2d, 0x00, 0x70, 0x46, 0x79, 0x20, 0x01, 0x20, 0x4f, 0x20, 
+  0x50, 0x20, 0x40, 0x21, 0x55, 0x00, 0x8a, 0xf0, 0x5e, 0x17, 0x11, 0x16, 
+  0x40, 0x24, 0x82, 0x33, 0x40, 0xd9, 0x6c, 0x72, 0x0d, 0x1c, 0x03, 0x30, 
+  0x0e, 0x1c, 0x05, 0x30, 0x82, 0x08, 0xf0, 0x01, 0xf0, 0x25, 0x0f, 0x14, 
+  0x8d, 0x30, 0x37, 0x86, 0xc1, 0x40, 0xc3, 0xbd, 0x60, 0x79, 0x0d, 0x1c, 
+  0x42, 0x33, 0x0f, 0x79, 0x15, 0x09, 0x30, 0x02, 0x30, 0x40, 0x56, 0x86, 
+  0x08, 0xd8, 0x60, 0x7a, 0xc1, 0x41, 0x0d, 0x14, 0x8d, 0x30, 0x32, 0x0a, 
+  0xef, 0xff, 0xc1, 0x40, 0xbe, 0x17, 0x02, 0x17, 0x10, 0x43, 0x2c, 0x70, 
+  0x0a, 0x0d, 0x0e, 0x00, 0x80, 0xbf, 0x17, 0x02, 0x17, 0x2c, 0x71, 0xfe, 
+  0x0c, 0x0c, 0x00, 0x10, 0xc0, 0x0c, 0x00, 0x21, 0x72, 0xf2, 0x0c, 0x00, 
+  0x20, 0xf2, 0x0c, 0x70, 0x02, 0x90, 0xc1, 0x40, 0xf6, 0x0a, 0x60, 0x00, 
+  0x22, 0x41, 0x0f, 0x16, 0x07, 0xf0, 0x03, 0x17, 0x06, 0x10, 0xc3, 0xbd, 
+  0x6c, 0x20, 0xc0, 0x00, 0xa5, 0x78, 0x0d, 0x1c, 0x02, 0x30, 0x40, 0x24, 
+  0x42, 0x88, 0x00, 0x01, 0x18, 0x07, 0x20, 0xe2, 0x09, 0x58, 0x01, 0x80, 
+  0x0d, 0x08, 0x30, 0x22, 0x02, 0x40, 0x56, 0x86, 0x70, 0x00, 0xf0, 0x1f, 
+  0x66, 0x0d, 0xef, 0xed, 0x0a, 0xd8, 0xc0, 0x17, 0x44, 0x17, 0xbf, 0x17, 
+  0x43, 0x17, 0xbe, 0x17, 0x42, 0x17, 0xc1, 0x40, 0x1e, 0x08, 0xa0, 0x03, 
+  0x62, 0x41, 0x8c, 0x21, 0xc3, 0xaf, 0x11, 0xdd, 0x98, 0xf2, 0x22, 0x40, 
+  0xc1, 0x41, 0x37, 0xff, 0x94, 0xf0, 0x2c, 0x70, 0x92, 0x0a, 0x6c, 0x00, 
+  0xf4, 0x39, 0x25, 0x09, 0x10, 0x20, 0xb9, 0x11, 0xc0, 0x20, 0x1d, 0x08, 
+  0x12, 0x00, 0x0f, 0x08, 0x10, 0x20, 0xb9, 0x10, 0xc0, 0x20, 0x11, 0x08, 
+  0x12, 0x00, 0x2c, 0x74, 0x4c, 0x70, 0x8e, 0x0f, 0x60, 0x01, 0xc1, 0x40, 
+  0xb9, 0x16, 0x80, 0x10, 0xc6, 0xb8, 0xb9, 0x1e, 0x02, 0x10, 0x5e, 0x1f, 
+  0x58, 0x13, 0x72, 0xf0, 0x0a, 0x25, 0x00, 0x24, 0x2f, 0x23, 0x06, 0x20, 
+  0x2f, 0x20, 0xc9, 0x04, 0xd3, 0x44, 0x00, 0x00, 0x0f, 0x27, 0x10, 0x7d, 
+  0x92, 0x75, 0x04, 0x02, 0xa6, 0x42, 0x40, 0x66, 0x0f, 0x60, 0x03, 0xc0, 
+  0x25, 0x6e, 0x20, 0x08, 0x02, 0x40, 0xa0, 0xb8, 0x00, 0x18, 0x08, 0x02, 
+  0x20, 0xf6, 0x08, 0xb0, 0x00, 0x20, 0xb6, 0xd8, 0x0e, 0x00, 0x00, 0x1a, 
+  0x00, 0x13, 0x7e, 0xc8, 0x00, 0x71, 0xc3, 0x46, 0x80, 0x3f, 0x00, 0x00, 
+  0x12, 0xce, 0x00, 0xf0, 0x35, 0x2f, 0x20, 0x47, 0x05, 0x25, 0x08, 0xb5, 
+  0x00, 0x60, 0xd9, 0x92, 0x75, 0xcf, 0x20, 0xae, 0x20, 0x19, 0x08, 0x3f, 
+  0x20, 0x61, 0xd9, 0x11, 0x08, 0x7f, 0x20, 0x62, 0xd9, 0x51, 0x20, 0x80, 
+  0xa0, 0x64, 0xd9, 0xca, 0x21, 0xa1, 0x00, 0xc1, 0x40, 0xe2, 0x42, 0xc2, 
+  0x43, 0x5e, 0x0f, 0x60, 0x03, 0x0a, 0x24, 0xc0, 0x04, 0x2d, 0x86, 0x23, 
+  0xd8, 0x0d, 0xa7, 0x60, 0x79, 0xc1, 0x40, 0x56, 0x86, 0xa4, 0x16, 0x00, 
+  0x11, 0x0a, 0x01, 0xf0, 0x0f, 0x25, 0x09, 0x30, 0x20, 0x22, 0x40, 0x34, 
+  0x11, 0x01, 0x20, 0x40, 0x79, 0x58, 0x11, 0x02, 0x20, 0xa4, 0x11, 0x00, 
+  0x21, 0x60, 0x7a, 0x22, 0x41, 0x38, 0x11, 0x02, 0x20, 0x0c, 0x71, 0x0a, 
+  0x00, 0xe0, 0x0c, 0x70, 0xbe, 0x09, 0xa0, 0x03, 0xc1, 0x41, 0x10, 0xdd, 
+  0x0e, 0xf0, 0x86, 0x09, 0x0c, 0x01, 0x91, 0xff, 0xd8, 0x5e, 0x1f, 0x18, 
+  0x10, 0x0c, 0x70, 0xa6, 0x18, 0x00, 0xf0, 0x55, 0x5e, 0x17, 0x0d, 0x16, 
+  0xa1, 0x40, 0xd8, 0xc7, 0xf8, 0xc3, 0xa1, 0xc1, 0x7c, 0x11, 0x11, 0x00, 
+  0x10, 0x43, 0xed, 0x70, 0x20, 0x40, 0x30, 0x42, 0xb6, 0x0b, 0x60, 0x01, 
+  0x02, 0x1c, 0xc4, 0x33, 0xcb, 0x45, 0xa1, 0x00, 0x30, 0x1e, 0xd3, 0x40, 
+  0xa1, 0x00, 0x34, 0x21, 0x39, 0xe8, 0x54, 0x20, 0x15, 0x28, 0x8e, 0x70, 
+  0x4a, 0x26, 0x00, 0x10, 0x00, 0x20, 0x80, 0x23, 0x04, 0x15, 0x16, 0x24, 
+  0xc6, 0x09, 0xaf, 0xee, 0x38, 0x10, 0x97, 0x00, 0x32, 0x08, 0xaf, 0xee, 
+  0x18, 0x40, 0x00, 0x42, 0xe2, 0x40, 0xae, 0x09, 0xaf, 0xee, 0x03, 0x41, 
+  0x0e, 0xe8, 0x2f, 0x80, 0x40, 0x79, 0x8c, 0x20, 0xc3, 0x8f, 0xcc, 0x20, 
+  0xfa, 0x07, 0xf0, 0x0f, 0x80, 0x00, 0x06, 0xf4, 0x04, 0x34, 0x80, 0xa5, 
+  0xca, 0x24, 0x85, 0x25, 0xc5, 0x71, 0xc5, 0x0e, 0xd4, 0x91, 0x54, 0x11, 
+  0x00, 0x26, 0x04, 0x34, 0xc0, 0xa4, 0xca, 0x24, 0xc5, 0x24, 0x28, 0x00, 
+  0x44, 0x0c, 0x1d, 0x00, 0x15, 0x2c, 0x00, 0x80, 0x0a, 0xf4, 0x08, 0x15, 
+  0x13, 0x10, 0x07, 0xf0, 0x24, 0x00, 0xf1, 0x0c, 0x08, 0x1d, 0xc0, 0x14, 
+  0x03, 0xf0, 0x6e, 0x70, 0x8c, 0x20, 0x02, 0x80, 0xe4, 0xad, 0xe0, 0xad, 
+  0x15, 0xf4, 0x3a, 0x0b, 0x60, 0x01, 0x42, 0x40, 0x86, 0xe8, 0x12, 0x08, 
+  0x00, 0xf0, 0x47, 0x0d, 0xe8, 0x23, 0x85, 0x02, 0x85, 0x04, 0x30, 0x40, 
+  0x80, 0x47, 0xf7, 0x07, 0x31, 0x00, 0x00, 0x30, 0x43, 0x48, 0x30, 0x40, 
+  0x02, 0x00, 0xad, 0x4a, 0x24, 0x80, 0x71, 0x40, 0x22, 0x14, 0x27, 0xcd, 
+  0x70, 0x02, 0x40, 0xed, 0x70, 0xa8, 0x20, 0x00, 0x02, 0x08, 0x10, 0x01, 
+  0x04, 0x04, 0x33, 0x40, 0xa0, 0xd0, 0xf7, 0xe5, 0x71, 0x2a, 0x45, 0x80, 
+  0x25, 0x86, 0x10, 0x00, 0x8d, 0x15, 0x08, 0xb1, 0x00, 0xed, 0x76, 0xff, 
+  0xd8, 0x42, 0x41, 0xae, 0x0a, 0xef, 0xff, 0xc0, 0xad, 0x00, 0x1d, 0x83, 
+  0x10, 0x5e, 0x11, 0x00, 0x26, 0x6e, 0x00, 0x60, 0x08, 0xf2, 0x20, 0xdd, 
+  0x8c, 0xe8, 0x84, 0x00, 0x01, 0x0e, 0x00, 0xf0, 0x0e, 0xf4, 0xef, 0x78, 
+  0x0f, 0x08, 0x74, 0x01, 0x10, 0xdd, 0xed, 0x75, 0x03, 0xf0, 0x80, 0xde, 
+  0x42, 0x40, 0x0e, 0x0f, 0xaf, 0xff, 0xef, 0x7f, 0x1c, 0xe8, 0x40, 0x24, 
+  0x82, 0x30, 0x36, 0x03, 0xf2, 0x08, 0x52, 0x0d, 0x60, 0x03, 0x82, 0x40, 
+  0x16, 0x20, 0xc0, 0x23, 0x04, 0x88, 0x38, 0x11, 0x06, 0x20, 0xc5, 0x7d, 
+  0xc3, 0xb8, 0xa5, 0x78, 0x01, 0xd0, 0x02, 0x00, 0x22, 0x00, 0x01, 0x08, 
+  0x02, 0x33, 0x12, 0x0f, 0xe0, 0x26, 0x00, 0xe0, 0xa0, 0x80, 0x0c, 0x70, 
+  0x42, 0x41, 0x4e, 0x08, 0xa0, 0x03, 0x5a, 0x19, 0x58, 0x23, 0x86, 0x01, 
+  0xfb, 0x5e, 0xe0, 0x78, 0xea, 0xc3, 0xa2, 0xc1, 0x68, 0x45, 0x97, 0x08, 
+  0x30, 0x02, 0x28, 0x46, 0x81, 0x08, 0x70, 0x01, 0xed, 0x70, 0x95, 0x08, 
+  0xf0, 0x01, 0x2c, 0x70, 0x14, 0x71, 0xa8, 0xf4, 0x54, 0x76, 0x4e, 0x01, 
+  0x25, 0x00, 0x23, 0xdf, 0xff, 0x85, 0x5e, 0x17, 0x10, 0x16, 0x8c, 0x20, 
+  0xc3, 0xaf, 0x06, 0xf2, 0xff, 0xd8, 0xf6, 0x09, 0xef, 0xff, 0xa1, 0x41, 
+  0x41, 0x8e, 0x00, 0x8e, 0x08, 0xba, 0x05, 0x7a, 0x55, 0x22, 0x00, 0x08, 
+  0x10, 0x78, 0x8c, 0x20, 0x04, 0x80, 0x5c, 0xf7, 0xbe, 0x1f, 0x9c, 0x10, 
+  0x03, 0x8e, 0x22, 0x8e, 0x08, 0xb8, 0x25, 0x78, 0x55, 0x20, 0x01, 0x08, 
+  0x30, 0x79, 0x8c, 0x21, 0x04, 0x80, 0x50, 0xf7, 0xbf, 0x1f, 0x1c, 0x10, 
+  0x05, 0x8e, 0x24, 0x18, 0x00, 0x91, 0xf6, 0x00, 0x25, 0x00, 0x2c, 0x70, 
+  0x02, 0x40, 0xa6, 0x50, 0x00, 0xf0, 0x22, 0x24, 0xdf, 0x71, 0xf0, 0x3f, 
+  0x85, 0x00, 0x8e, 0x80, 0x21, 0x86, 0x00, 0xc1, 0xb8, 0x00, 0xa9, 0x69, 
+  0xf0, 0xa6, 0x0a, 0xe0, 0x01, 0xa1, 0x40, 0x08, 0x47, 0x65, 0xf0, 0x7c, 
+  0x15, 0x10, 0x10, 0x23, 0xdf, 0x83, 0x40, 0x21, 0xb0, 0xbf, 0x0a, 0xb4, 
+  0x01, 0x22, 0xb0, 0x3c, 0x4d, 0x81, 0xc2, 0x7c, 0x00, 0x01, 0x60, 0x0c, 
+  0x60, 0x03, 0x10, 0x41, 0x05, 0xd0, 0x03, 0x30, 0x10, 0x06, 0x20, 0x16, 
+  0x01, 0xb4, 0x07, 0x1c, 0x02, 0x30, 0xa0, 0xb8, 0x02, 0x1c, 0x02, 0x30, 
+  0x7c, 0xfe, 0x00, 0x40, 0x0e, 0xe0, 0x03, 0x22, 0x4c, 0x05, 0xf0, 0x30, 
+  0x30, 0x2f, 0xd9, 0x6c, 0x71, 0x22, 0x40, 0xc6, 0x0d, 0xe0, 0x03, 0x02, 
+  0x1c, 0x43, 0x30, 0x05, 0x8e, 0x41, 0x8e, 0x20, 0x8e, 0x62, 0x8e, 0x83, 
+  0x8e, 0x44, 0x20, 0x4b, 0x00, 0x12, 0x6a, 0xa4, 0x8e, 0xc1, 0xb9, 0x53, 
+  0x6b, 0x44, 0x20, 0x00, 0x01, 0x75, 0x6c, 0x44, 0x22, 0x02, 0x06, 0x25, 
+  0x78, 0x44, 0x23, 0x03, 0x08, 0x05, 0x7a, 0x96, 0x6d, 0x05, 0x22, 0xc0, 
+  0x00, 0x05, 0x7c, 0x42, 0x00, 0xb1, 0x34, 0xd9, 0x6c, 0x72, 0x22, 0x40, 
+  0x03, 0x1c, 0xc2, 0x32, 0x82, 0x46, 0x00, 0xe0, 0x02, 0x33, 0x81, 0xc2, 
+  0x21, 0xd9, 0x6c, 0x72, 0xca, 0x0b, 0x60, 0x03, 0x22, 0x40, 0x88, 0x00, 
+  0x80, 0x1f, 0x08, 0x7f, 0x01, 0x40, 0x24, 0xc2, 0x31, 0x90, 0x00, 0x04, 
+  0x82, 0x00, 0x20, 0x92, 0x0d, 0x82, 0x00, 0xf3, 0x00, 0xed, 0x70, 0xe1, 
+  0x40, 0xca, 0xc7, 0xc0, 0x1f, 0x1c, 0x10, 0x5e, 0x08, 0xef, 0xff, 0xa1, 
+  0xac, 0x04, 0x11, 0x52, 0x0c, 0x00, 0x02, 0xac, 0x04, 0x11, 0x46, 0x0c, 
+  0x00, 0x60, 0x46, 0x08, 0x60, 0x00, 0xa1, 0x40, 0x6c, 0x01, 0x50, 0xe8, 
+  0xf3, 0x02, 0x40, 0x8a, 0x14, 0x00, 0xf1, 0x0f, 0x41, 0xe2, 0xf1, 0xe0, 
+  0x78, 0xe6, 0xc3, 0xa2, 0xc1, 0x40, 0x20, 0x0f, 0x07, 0x08, 0x45, 0x40, 
+  0x24, 0x42, 0x31, 0x57, 0xd9, 0x6c, 0x72, 0x56, 0x0b, 0x60, 0x03, 0xe1, 
+  0x40, 0x06, 0x10, 0x04, 0x60, 0x82, 0x31, 0x57, 0xd9, 0xa2, 0xb8, 0x40, 
+  0x07, 0x08, 0xfc, 0x03, 0xf0, 0x05, 0x16, 0x0d, 0xe0, 0x03, 0xe1, 0x40, 
+  0xb9, 0x15, 0x80, 0x10, 0xdf, 0x85, 0x80, 0xc2, 0xc6, 0xb8, 0xb9, 0x1d, 
+  0x02, 0x10, 0x38, 0x01, 0xb0, 0xe1, 0x40, 0x1a, 0x0b, 0x60, 0x03, 0x07, 
+  0x1c, 0x03, 0x30, 0x01, 0x3c, 0x01, 0x30, 0x16, 0x06, 0x10, 0x30, 0x02, 
+  0x71, 0x50, 0x20, 0x01, 0x00, 0x01, 0x1c, 0x42, 0x44, 0x01, 0x04, 0xbc, 
+  0x00, 0x20, 0xd6, 0x0c, 0x42, 0x00, 0x31, 0x40, 0x24, 0xc2, 0x3e, 0x01, 
+  0xf0, 0x03, 0xe1, 0x40, 0x8a, 0x0c, 0xe0, 0x03, 0x03, 0x1c, 0x83, 0x31, 
+  0x80, 0xc2, 0x32, 0xd9, 0x6c, 0x73, 0xd2, 0x0a, 0x82, 0x00, 0x70, 0x02, 
+  0x14, 0x80, 0x30, 0x01, 0x14, 0x81, 0x7c, 0x04, 0xe1, 0x30, 0xa5, 0xb8, 
+  0x03, 0x1c, 0x42, 0x30, 0x61, 0xc0, 0x32, 0xd9, 0x6c, 0x72, 0x5e, 0x3c, 
+  0x00, 0x02, 0x5e, 0x00, 0x24, 0xc2, 0x31, 0x52, 0x00, 0x11, 0x82, 0x16, 
+  0x00, 0xe4, 0x0c, 0x70, 0xc6, 0xc7, 0xe0, 0x78, 0xe8, 0xc3, 0xa2, 0xc1, 
+  0x08, 0x45, 0x1c, 0xe0, 0xd2, 0x00, 0x57, 0x82, 0x0a, 0x60, 0x03, 0x10, 
+  0xd2, 0x00, 0x1d, 0x82, 0xd2, 0x00, 0x53, 0x46, 0x0c, 0xe0, 0x03, 0x02, 
+  0xd2, 0x00, 0x00, 0x92, 0x01, 0x15, 0x87, 0xd4, 0x00, 0x42, 0x02, 0x40, 
+  0x46, 0x0a, 0xd4, 0x00, 0x13, 0x03, 0xd4, 0x00, 0x22, 0x80, 0xc2, 0x0e, 
+  0x02, 0x24, 0x60, 0xc0, 0x7c, 0x00, 0x11, 0x06, 0x3e, 0x00, 0x20, 0x80, 
+  0xc2, 0xcc, 0x00, 0xa0, 0x02, 0x40, 0xbe, 0x0b, 0xe0, 0x03, 0x00, 0x1c, 
+  0x83, 0x31, 0x48, 0x00, 0x00, 0xce, 0x00, 0xf0, 0x03, 0x06, 0x0a, 0x60, 
+  0x03, 0x02, 0x40, 0x21, 0xc0, 0x03, 0x14, 0x81, 0x30, 0x80, 0xc2, 0x85, 
+  0xb8, 0x60, 0xc1, 0x4a, 0x03, 0x00, 0xca, 0x00, 0x20, 0x92, 0x0b, 0x38, 
+  0x00, 0x6c, 0x62, 0x0f, 0xaf, 0xed, 0x32, 0xd8, 0xd0, 0x00, 0x11, 0xb2, 
+  0x1c, 0x00, 0xf0, 0x77, 0x0c, 0x70, 0xc8, 0xc7, 0xe0, 0x78, 0xe0, 0x7f, 
+  0xa6, 0x10, 0x00, 0x01, 0xe0, 0x78, 0x1f, 0x80, 0xe0, 0x7f, 0x75, 0x10, 
+  0x00, 0x06, 0xe0, 0x7f, 0x9c, 0x10, 0x00, 0x00, 0xe0, 0x78, 0x14, 0x70, 
+  0x20, 0x40, 0xe0, 0x7d, 0x3f, 0x80, 0x76, 0x11, 0x01, 0x06, 0x00, 0x79, 
+  0xe0, 0x78, 0xe4, 0xc2, 0xdf, 0x80, 0x08, 0x45, 0x2c, 0x70, 0xc1, 0x40, 
+  0x80, 0x20, 0xc2, 0x0f, 0xda, 0x08, 0xef, 0xf0, 0x14, 0xda, 0x7f, 0xd8, 
+  0x23, 0xd9, 0x17, 0xb8, 0x2d, 0xa6, 0x0e, 0xa6, 0x0c, 0x70, 0xa1, 0x41, 
+  0x75, 0x1e, 0x19, 0x10, 0x0e, 0x08, 0x20, 0x00, 0xa3, 0xa6, 0x0c, 0x70, 
+  0xc4, 0xc6, 0xe6, 0xc2, 0xff, 0x81, 0x28, 0x45, 0x31, 0x08, 0xb4, 0x00, 
+  0x08, 0x46, 0x8c, 0x26, 0x02, 0x90, 0xcc, 0x26, 0x82, 0x9f, 0x00, 0x00, 
+  0xff, 0x00, 0x18, 0xf4, 0x80, 0xd9, 0x22, 0x0c, 0x20, 0x00, 0xa1, 0x40, 
+  0xc3, 0x40, 0x48, 0x42, 0x00, 0x00, 0x52, 0x04, 0xb1, 0xa1, 0x41, 0x75, 
+  0x1f, 0x98, 0x13, 0x0c, 0xf0, 0x2c, 0x70, 0x0a, 0x1a, 0x00, 0x00, 0x4e, 
+  0x00, 0x41, 0x96, 0x0a, 0xef, 0xff, 0x16, 0x00, 0xf1, 0x17, 0x70, 0x22, 
+  0x0c, 0x60, 0x03, 0xa1, 0x41, 0x75, 0x17, 0x00, 0x16, 0xc6, 0xc6, 0xe0, 
+  0x78, 0xe2, 0xc2, 0x0c, 0x70, 0x3e, 0x0c, 0x60, 0x03, 0x28, 0x45, 0x9c, 
+  0x15, 0x00, 0x10, 0xc2, 0xc6, 0xe4, 0xc3, 0xa1, 0xc1, 0x40, 0x20, 0x0e, 
+  0x64, 0x02, 0x20, 0x82, 0x30, 0x92, 0x01, 0x60, 0xf2, 0x08, 0x60, 0x03, 
+  0xc1, 0x40, 0x52, 0x01, 0x00, 0xde, 0x01, 0x7b, 0x57, 0xd9, 0x84, 0x20, 
+  0xc2, 0x0f, 0x03, 0x94, 0x01, 0xfe, 0x07, 0xb2, 0x0a, 0xe0, 0x03, 0xc1, 
+  0x40, 0xb9, 0x15, 0x81, 0x10, 0x0c, 0x70, 0xc6, 0xb9, 0xb9, 0x1d, 0x42, 
+  0x10, 0xc4, 0xc7, 0xe0, 0x78, 0x4c, 0x00, 0x1b, 0xa6, 0x4c, 0x00, 0x2c, 
+  0x86, 0xb8, 0x4a, 0x00, 0x17, 0x66, 0x4a, 0x00, 0x14, 0x87, 0x4a, 0x00, 
+  0x07, 0x54, 0x01, 0xf0, 0x0d, 0x83, 0x10, 0x00, 0x06, 0xe6, 0xc2, 0xbf, 
+  0x81, 0x28, 0x46, 0x66, 0x0e, 0x6f, 0xee, 0x08, 0x47, 0x86, 0x1d, 0x18, 
+  0x10, 0xc1, 0x40, 0x60, 0x7f, 0x87, 0x1d, 0x58, 0x10, 0xd0, 0x00, 0x04, 
+  0x70, 0x01, 0x00, 0x58, 0x02, 0xf1, 0x00, 0x50, 0x40, 0xf1, 0x08, 0x71, 
+  0x00, 0x28, 0x45, 0xdf, 0x83, 0x40, 0x23, 0x0f, 0x07, 0x80, 0x30, 0x04, 
+  0x7f, 0xe1, 0x40, 0x22, 0x08, 0x60, 0x03, 0x06, 0xf8, 0x02, 0x10, 0x22, 
+  0xde, 0x09, 0xf8, 0x02, 0x22, 0x82, 0x31, 0xf8, 0x02, 0xf1, 0x0c, 0x92, 
+  0x09, 0xe0, 0x03, 0x06, 0x1c, 0x43, 0x30, 0x0e, 0x86, 0x5a, 0x0d, 0xaf, 
+  0xed, 0x48, 0x30, 0xc0, 0x02, 0x80, 0xc2, 0x3c, 0xd9, 0x6c, 0x75, 0xd2, 
+  0x0f, 0x20, 0x02, 0x03, 0x40, 0x82, 0x30, 0x21, 0xc4, 0x04, 0x03, 0x31, 
+  0x03, 0x14, 0x83, 0x58, 0x00, 0xf8, 0x21, 0xc2, 0xbc, 0x53, 0x22, 0x0e, 
+  0x01, 0x08, 0xbe, 0x40, 0x2c, 0x00, 0x12, 0xc5, 0x79, 0x65, 0x78, 0xcb, 
+  0x46, 0xa1, 0x00, 0x74, 0x1e, 0x20, 0xb6, 0x01, 0xb6, 0x41, 0x2a, 0x81, 
+  0x01, 0x41, 0x2a, 0x40, 0x01, 0x41, 0x2a, 0xc3, 0x01, 0xc0, 0xb9, 0xc0, 
+  0xb8, 0x64, 0xb6, 0x23, 0xb6, 0x02, 0xb6, 0x52, 0x02, 0x11, 0x62, 0x7c, 
+  0x00, 0xf0, 0x21, 0x00, 0x8e, 0x00, 0xad, 0x06, 0x8e, 0x24, 0x8e, 0x61, 
+  0x8e, 0x56, 0x68, 0x88, 0x8e, 0x15, 0x69, 0xc4, 0xbb, 0x44, 0x20, 0x00, 
+  0x08, 0x84, 0x22, 0x01, 0x00, 0x65, 0x78, 0x37, 0x6c, 0x45, 0x78, 0x25, 
+  0x78, 0x01, 0xad, 0x02, 0x8e, 0x02, 0xad, 0x03, 0x8e, 0x03, 0xad, 0x00, 
+  0x18, 0x05, 0x21, 0x82, 0x02, 0x02, 0x58, 0x02, 0x10, 0xbe, 0x08, 0x03, 
+  0xf0, 0x02, 0xa6, 0x0c, 0x70, 0x12, 0x08, 0x20, 0x00, 0xa1, 0x41, 0x0c, 
+  0x70, 0x83, 0x1e, 0x19, 0x10, 0xc4, 0xc6, 0xe8, 0x05, 0x00, 0x3a, 0x01, 
+  0xe0, 0xc7, 0x08, 0xb4, 0x00, 0x10, 0x40, 0x8c, 0x20, 0x02, 0xa0, 0xcc, 
+  0x20, 0x82, 0xaf, 0x46, 0x02, 0x90, 0xb6, 0xf4, 0x80, 0xd9, 0xde, 0x09, 
+  0x20, 0x00, 0xc1, 0x46, 0x02, 0xd2, 0x41, 0x00, 0x00, 0x6a, 0x08, 0xef, 
+  0xff, 0xc1, 0x41, 0xff, 0x86, 0x3c, 0x4e, 0x36, 0x01, 0x61, 0xee, 0x0e, 
+  0x20, 0x03, 0x10, 0x41, 0x32, 0x01, 0x1f, 0x17, 0x32, 0x01, 0x07, 0x20, 
+  0xaa, 0x08, 0xe6, 0x04, 0x11, 0x81, 0x5c, 0x03, 0x70, 0x22, 0x40, 0x62, 
+  0x08, 0xe0, 0x03, 0x04, 0x30, 0x01, 0x34, 0x87, 0x2a, 0x0c, 0x30, 0x01, 
+  0x95, 0x3e, 0xd9, 0x6c, 0x73, 0xa2, 0x0e, 0x20, 0x03, 0x22, 0x32, 0x04, 
+  0xf1, 0x00, 0x81, 0xc2, 0x87, 0xb8, 0x61, 0xc1, 0x05, 0x1c, 0x02, 0x30, 
+  0x3e, 0xd9, 0x6c, 0x72, 0x2e, 0x42, 0x00, 0x42, 0x0e, 0x87, 0xfa, 0x0b, 
+  0x32, 0x00, 0x02, 0x6e, 0x00, 0x06, 0x18, 0x01, 0x11, 0x4a, 0x20, 0x00, 
+  0xa2, 0x83, 0x1d, 0x18, 0x14, 0x5c, 0xf0, 0x40, 0x26, 0x0f, 0x17, 0x9e, 
+  0x00, 0x20, 0x4e, 0x0e, 0x82, 0x01, 0x01, 0x9e, 0x00, 0x1a, 0x15, 0x9e, 
+  0x00, 0x00, 0x3c, 0x04, 0x04, 0x3c, 0x00, 0x20, 0x0e, 0x08, 0x54, 0x01, 
+  0x02, 0x9e, 0x00, 0x52, 0xe1, 0x40, 0xc2, 0x0f, 0xa0, 0x9e, 0x00, 0x23, 
+  0x85, 0x8e, 0x6c, 0x00, 0x02, 0x9e, 0x00, 0x11, 0x02, 0x4c, 0x00, 0x06, 
+  0x9e, 0x00, 0x17, 0xc6, 0x9e, 0x00, 0x94, 0x8e, 0x0f, 0xa0, 0x03, 0xe1, 
+  0x40, 0x0e, 0x85, 0x5a, 0x9e, 0x00, 0x01, 0x6e, 0x00, 0x15, 0x82, 0x9e, 
+  0x00, 0x11, 0xaa, 0x20, 0x00, 0x40, 0x2c, 0x70, 0x92, 0x08, 0x4a, 0x01, 
+  0xf0, 0x03, 0xb9, 0x16, 0x80, 0x10, 0xc1, 0x41, 0xc6, 0xb8, 0xb9, 0x1e, 
+  0x02, 0x10, 0x0c, 0x70, 0x16, 0x0f, 0xaf, 0xff, 0xb8, 0x00, 0x30, 0x0c, 
+  0x70, 0xa2, 0x04, 0x03, 0x72, 0x41, 0x83, 0x15, 0x00, 0x16, 0xca, 0xc7, 
+  0x80, 0x03, 0x26, 0xbe, 0x08, 0x80, 0x03, 0xf0, 0x0b, 0xe6, 0xc2, 0x43, 
+  0x08, 0x71, 0x00, 0x23, 0xd8, 0x3d, 0x0a, 0x14, 0x01, 0xa1, 0x89, 0x03, 
+  0x89, 0xe0, 0x89, 0xc2, 0x89, 0x08, 0xbd, 0x08, 0xb8, 0xc3, 0x42, 0x3e, 
+  0x02, 0xf0, 0x14, 0xe5, 0x7d, 0xc5, 0x78, 0xa0, 0xb2, 0x01, 0xb2, 0x01, 
+  0x89, 0x25, 0xb8, 0xc0, 0xb8, 0x02, 0xb2, 0x01, 0x89, 0x26, 0xb8, 0xc0, 
+  0xb8, 0x03, 0xb2, 0x01, 0x89, 0x27, 0xb8, 0x04, 0xb2, 0xc6, 0x08, 0x60, 
+  0x03, 0x60, 0x58, 0x05, 0xd0, 0xc6, 0xe0, 0x78, 0x3f, 0x80, 0x80, 0x21, 
+  0x07, 0x09, 0xe0, 0x7f, 0x00, 0x89, 0x0c, 0x03, 0xf0, 0x08, 0xa1, 0xc1, 
+  0xbf, 0x80, 0x08, 0x46, 0x30, 0x40, 0x56, 0x0a, 0x20, 0x01, 0x02, 0x1c, 
+  0x05, 0x30, 0x0a, 0x47, 0x14, 0xe8, 0x5e, 0x15, 0x00, 0xd0, 0x07, 0xf0, 
+  0x1e, 0x8f, 0xcc, 0x20, 0x82, 0x8f, 0x00, 0x00, 0x80, 0x00, 0x05, 0xf4, 
+  0x54, 0x1d, 0x18, 0x10, 0xc8, 0xc7, 0x52, 0x0a, 0x20, 0x01, 0xc1, 0x40, 
+  0x14, 0x70, 0x80, 0xdf, 0xca, 0x27, 0x01, 0x14, 0x54, 0x15, 0x00, 0x16, 
+  0xf1, 0x70, 0xb9, 0xf2, 0x8c, 0x27, 0xc3, 0x9f, 0x1c, 0xe6, 0xc8, 0x03, 
+  0xf3, 0x00, 0x39, 0xf2, 0x8c, 0x27, 0x02, 0x90, 0x83, 0xf4, 0x40, 0xd9, 
+  0x6c, 0x72, 0xd6, 0x0c, 0x20, 0xd0, 0x03, 0x02, 0x0c, 0x01, 0x31, 0xc2, 
+  0x30, 0xc6, 0xd2, 0x03, 0x13, 0x40, 0x12, 0x01, 0x51, 0x9a, 0x0e, 0xa0, 
+  0x03, 0xc1, 0x7a, 0x07, 0x00, 0xa8, 0x01, 0x1d, 0xa6, 0x2e, 0x00, 0x11, 
+  0x80, 0x2e, 0x00, 0x04, 0x40, 0x01, 0x15, 0x6a, 0x2e, 0x00, 0x51, 0x7d, 
+  0xd9, 0x6c, 0x72, 0x7a, 0x2e, 0x00, 0x20, 0x44, 0xf0, 0x68, 0x00, 0x1d, 
+  0x6e, 0x3a, 0x00, 0x19, 0x87, 0x68, 0x00, 0x19, 0x32, 0x68, 0x00, 0x1d, 
+  0x3e, 0x2e, 0x00, 0x19, 0xa0, 0x68, 0x00, 0x19, 0x02, 0x68, 0x00, 0x1d, 
+  0x12, 0x2e, 0x00, 0x11, 0xa2, 0x2e, 0x00, 0x14, 0x7d, 0x00, 0x07, 0x10, 
+  0x0d, 0x2e, 0x00, 0x08, 0x20, 0x00, 0x13, 0x82, 0x20, 0x00, 0x20, 0x27, 
+  0xf0, 0x40, 0x00, 0x2f, 0xd2, 0x0b, 0x40, 0x00, 0x0b, 0x11, 0x96, 0x40, 
+  0x00, 0x04, 0x9c, 0x00, 0x1d, 0xa2, 0x2e, 0x00, 0x46, 0x80, 0xb8, 0x7c, 
+  0xd9, 0x06, 0x05, 0x11, 0x66, 0x2e, 0x00, 0x71, 0x54, 0x1d, 0xd8, 0x13, 
+  0xc8, 0xc7, 0xe2, 0x40, 0x05, 0x20, 0x0d, 0x07, 0x3c, 0x00, 0xa0, 0x70, 
+  0xd9, 0x6c, 0x72, 0xa1, 0x40, 0x66, 0x0b, 0x20, 0x03, 0xc0, 0x01, 0x04, 
+  0x42, 0x05, 0x33, 0x70, 0xd9, 0xa3, 0x42, 0x05, 0xd0, 0xf2, 0x0c, 0xa0, 
+  0x03, 0xa1, 0x40, 0xc2, 0x08, 0xaf, 0xed, 0x0c, 0x71, 0xc2, 0x58, 0x02, 
+  0x0d, 0x3c, 0x00, 0x1d, 0x2a, 0x3c, 0x00, 0x13, 0x83, 0x3c, 0x00, 0x11, 
+  0xb6, 0x3c, 0x00, 0x15, 0x86, 0x3c, 0x00, 0x40, 0xf8, 0x1c, 0xc8, 0xb7, 
+  0x92, 0x07, 0xf1, 0x00, 0xc2, 0x31, 0x70, 0xd9, 0x6c, 0x71, 0x9a, 0x0c, 
+  0xa0, 0x03, 0x07, 0x1c, 0x43, 0x30, 0x66, 0x20, 0x00, 0xf9, 0x44, 0x08, 
+  0x14, 0x1f, 0x34, 0xe0, 0x7e, 0xe0, 0x78, 0xe6, 0xc2, 0x28, 0x46, 0x02, 
+  0xe8, 0xc6, 0xc6, 0xbf, 0x86, 0x55, 0x25, 0x8f, 0x1d, 0x00, 0x8f, 0x1f, 
+  0x08, 0xbe, 0x00, 0xa1, 0x42, 0x80, 0x22, 0x43, 0x06, 0x3c, 0x4e, 0x20, 
+  0xd9, 0x6c, 0x72, 0xc3, 0x44, 0x13, 0x00, 0xb0, 0xd6, 0xce, 0x0a, 0x20, 
+  0x03, 0xc1, 0x45, 0x00, 0x8f, 0x33, 0x08, 0x7e, 0x00, 0x55, 0x26, 0x8e, 
+  0x18, 0x45, 0x85, 0x09, 0xea, 0xb9, 0x12, 0xc0, 0x00, 0x0f, 0x08, 0x13, 
+  0x00, 0x21, 0x86, 0x7e, 0x0d, 0x20, 0x03, 0x00, 0x86, 0x44, 0x14, 0x00, 
+  0x11, 0x6a, 0x14, 0x00, 0xf0, 0x01, 0x00, 0x8f, 0x1b, 0x08, 0x1e, 0x01, 
+  0x46, 0x85, 0x0b, 0xea, 0xb9, 0x12, 0xc1, 0x00, 0x0f, 0x09, 0x1a, 0x00, 
+  0x13, 0x52, 0x1a, 0x00, 0xe0, 0x13, 0x08, 0x5e, 0x01, 0x21, 0x86, 0x00, 
+  0x86, 0x42, 0x0d, 0x20, 0x03, 0x49, 0x85, 0x10, 0x00, 0x20, 0xde, 0x00, 
+  0x10, 0x00, 0xc0, 0x32, 0x0d, 0x20, 0x03, 0x4a, 0x85, 0x00, 0x8f, 0x6f, 
+  0x08, 0x9e, 0x81, 0x10, 0x00, 0x60, 0x22, 0x0d, 0x20, 0x03, 0x47, 0x85, 
+  0x0c, 0x03, 0x02, 0x00, 0x03, 0xf0, 0x03, 0x2f, 0xd9, 0x4c, 0x70, 0x08, 
+  0x47, 0x2e, 0x09, 0xa0, 0x01, 0x6e, 0x85, 0x40, 0x27, 0x10, 0x17, 0xc8, 
+  0xde, 0x1c, 0x01, 0x91, 0x69, 0xd9, 0x6c, 0x72, 0x0e, 0x0a, 0x20, 0x03, 
+  0x02, 0x94, 0x01, 0x00, 0xc6, 0x00, 0xf0, 0x0b, 0x5a, 0xd8, 0xab, 0x20, 
+  0x08, 0x0e, 0xc3, 0x40, 0x20, 0x41, 0x00, 0x00, 0x3a, 0x0f, 0x4f, 0xed, 
+  0xc5, 0x77, 0x2f, 0x26, 0x87, 0xf3, 0xea, 0xf5, 0x6e, 0x85, 0x42, 0x00, 
+  0x41, 0xee, 0x08, 0xa0, 0x01, 0x16, 0x06, 0x20, 0x30, 0x38, 0x00, 0x03, 
+  0x12, 0x09, 0x3a, 0x00, 0x20, 0x8e, 0x30, 0xfc, 0x00, 0x71, 0x46, 0x0b, 
+  0x78, 0xd9, 0x6c, 0x74, 0xc2, 0x14, 0x00, 0xa4, 0xc3, 0x40, 0xa0, 0x40, 
+  0x00, 0x00, 0xfa, 0x0e, 0x4f, 0xed, 0x68, 0x02, 0x13, 0xaa, 0x2c, 0x00, 
+  0xf4, 0x03, 0x82, 0x30, 0x6e, 0x85, 0x7d, 0xd9, 0xa2, 0xba, 0xe1, 0x40, 
+  0xa2, 0x08, 0xa0, 0x01, 0x03, 0x1c, 0x82, 0x30, 0x1c, 0x02, 0x17, 0x86, 
+  0x22, 0x00, 0x73, 0x7c, 0xd9, 0x80, 0xba, 0xe1, 0x40, 0x82, 0x22, 0x00, 
+  0xf0, 0x01, 0x0c, 0x70, 0xae, 0x0e, 0x6f, 0xed, 0x9e, 0xb8, 0x23, 0xbe, 
+  0x53, 0x26, 0x8e, 0x90, 0x18, 0xf2, 0x32, 0x00, 0x53, 0x77, 0xd9, 0x6c, 
+  0x72, 0x56, 0x32, 0x00, 0x0c, 0x80, 0x03, 0x13, 0x77, 0x7c, 0x02, 0xa5, 
+  0x1a, 0x0b, 0xa0, 0x03, 0x02, 0x40, 0xc1, 0x40, 0xc8, 0xc7, 0x04, 0x01, 
+  0x50, 0x71, 0x08, 0x46, 0x2a, 0x08, 0x04, 0x01, 0x20, 0x3c, 0x4e, 0x46, 
+  0x00, 0x10, 0x3b, 0x00, 0x01, 0x41, 0x09, 0x20, 0x03, 0x10, 0x46, 0x00, 
+  0x62, 0x37, 0x08, 0xfe, 0x00, 0x14, 0xdf, 0x02, 0x01, 0x04, 0x1e, 0x00, 
+  0x24, 0xf2, 0x08, 0x64, 0x00, 0xf5, 0x04, 0x17, 0x08, 0xde, 0x00, 0xc3, 
+  0x40, 0xc8, 0x42, 0x00, 0x00, 0x22, 0x0e, 0x4f, 0xed, 0xe5, 0x77, 0x2f, 
+  0x26, 0xc7, 0x18, 0x01, 0x42, 0xd6, 0x0f, 0x60, 0x01, 0xe6, 0x02, 0x00, 
+  0x18, 0x01, 0x13, 0xbe, 0x34, 0x00, 0x11, 0x8f, 0xdc, 0x00, 0x01, 0xfe, 
+  0x00, 0x03, 0x12, 0x00, 0x02, 0xfe, 0x00, 0x79, 0x81, 0xba, 0xc1, 0x40, 
+  0xa6, 0x0f, 0x60, 0xfe, 0x00, 0x17, 0x8a, 0x22, 0x00, 0x00, 0xfe, 0x00, 
+  0x33, 0xc1, 0x40, 0x82, 0x22, 0x00, 0x40, 0x0c, 0x70, 0xb2, 0x0d, 0xfe, 
+  0x00, 0xf3, 0x1a, 0x4b, 0x27, 0x00, 0x9e, 0x60, 0xd8, 0xca, 0x20, 0x21, 
+  0x00, 0xc8, 0xc7, 0xf1, 0xc0, 0x5f, 0x80, 0xb9, 0x10, 0x81, 0x00, 0x60, 
+  0x82, 0x42, 0x82, 0xc6, 0xb9, 0xb9, 0x18, 0x42, 0x00, 0x06, 0xeb, 0xb9, 
+  0x13, 0xc1, 0x00, 0x17, 0x09, 0x12, 0x00, 0x05, 0x36, 0x02, 0xf0, 0x05, 
+  0x12, 0x00, 0x2c, 0x74, 0x22, 0x08, 0x20, 0x01, 0x4c, 0x70, 0xd1, 0xc0, 
+  0xe0, 0x7f, 0x0c, 0x70, 0xea, 0xc3, 0xa1, 0xc1, 0x1e, 0x07, 0x00, 0xdc, 
+  0x02, 0x02, 0x74, 0x00, 0x22, 0x16, 0x08, 0xfa, 0x00, 0xb5, 0x82, 0x30, 
+  0x6e, 0x86, 0x7c, 0xd9, 0xa0, 0xba, 0xa1, 0x40, 0x0e, 0x74, 0x00, 0x11, 
+  0x3e, 0x74, 0x00, 0x04, 0x6a, 0x01, 0x43, 0xea, 0x0f, 0xe0, 0x02, 0x9e, 
+  0x00, 0x96, 0x86, 0x77, 0xd9, 0x87, 0xba, 0xa1, 0x40, 0xe6, 0x0e, 0xc0, 
+  0x00, 0x00, 0xe2, 0x00, 0x17, 0xca, 0x22, 0x00, 0x73, 0x7d, 0xd9, 0x82, 
+  0xba, 0xa1, 0x40, 0xc2, 0x22, 0x00, 0x02, 0x34, 0x01, 0x22, 0xee, 0x0c, 
+  0x0c, 0x02, 0x00, 0x72, 0x02, 0x17, 0x9e, 0x2c, 0x00, 0x11, 0x69, 0x2c, 
+  0x00, 0x13, 0x96, 0x2c, 0x00, 0x20, 0x6e, 0x86, 0xa4, 0x01, 0xd3, 0x8a, 
+  0x0e, 0x60, 0x01, 0xa1, 0x40, 0x6e, 0x86, 0x33, 0xd9, 0x4c, 0x71, 0x7e, 
+  0x0c, 0x00, 0x91, 0x7e, 0xd9, 0x4c, 0x72, 0xa1, 0x40, 0x2e, 0x72, 0x6e, 
+  0x2a, 0x00, 0x44, 0x83, 0x30, 0xc8, 0xdf, 0x4e, 0x00, 0x13, 0x4e, 0x4e, 
+  0x00, 0x60, 0x80, 0x30, 0x25, 0x08, 0xbe, 0x00, 0x16, 0x00, 0x04, 0xc4, 
+  0x02, 0x64, 0x40, 0x40, 0x00, 0x00, 0x76, 0x0c, 0xac, 0x01, 0x31, 0xe8, 
+  0xf5, 0x12, 0xb2, 0x04, 0x19, 0x1e, 0xaa, 0x00, 0x53, 0xa2, 0xba, 0xa1, 
+  0x40, 0x1a, 0x7e, 0x00, 0x52, 0x2e, 0x70, 0x22, 0x40, 0xca, 0x2c, 0x02, 
+  0xf0, 0x00, 0x81, 0x28, 0x47, 0x21, 0x88, 0xa9, 0x46, 0x80, 0x26, 0x86, 
+  0x1b, 0x20, 0xae, 0x22, 0x88, 0x56, 0x00, 0xf2, 0x05, 0x6c, 0x72, 0x21, 
+  0xae, 0x03, 0x88, 0x56, 0x25, 0x81, 0x1d, 0x00, 0xa9, 0x3c, 0x4f, 0x7c, 
+  0xd9, 0xd6, 0x0e, 0xe0, 0x02, 0x38, 0x02, 0x80, 0x21, 0x08, 0x3e, 0x00, 
+  0x50, 0x20, 0x02, 0x00, 0xba, 0x01, 0x42, 0xe1, 0x40, 0xca, 0x0d, 0x4e, 
+  0x00, 0x80, 0x7f, 0xd8, 0xfa, 0x0b, 0x6f, 0xed, 0x17, 0xb8, 0x9c, 0x02, 
+  0x40, 0x78, 0xd9, 0x6c, 0x73, 0x92, 0x02, 0x40, 0xc1, 0x42, 0x86, 0x08, 
+  0x94, 0x02, 0x31, 0x7f, 0xd8, 0xde, 0x1c, 0x00, 0x04, 0x60, 0x01, 0x24, 
+  0x8a, 0x0e, 0xc4, 0x00, 0x0a, 0xe2, 0x05, 0x04, 0xca, 0x02, 0x11, 0x4e, 
+  0x36, 0x00, 0x60, 0x0c, 0x70, 0xc8, 0xc7, 0xe0, 0x78, 0xc8, 0x01, 0xf4, 
+  0x01, 0x48, 0x47, 0x08, 0x46, 0xed, 0x09, 0xb4, 0x01, 0x4a, 0x20, 0xc0, 
+  0x28, 0xbf, 0x87, 0x3c, 0x4f, 0xd2, 0x01, 0x10, 0x42, 0x94, 0x00, 0x14, 
+  0x41, 0x46, 0x02, 0x53, 0xa0, 0xba, 0xe1, 0x40, 0x3e, 0x8e, 0x00, 0x04, 
+  0x6a, 0x00, 0x5f, 0x22, 0x0e, 0xe0, 0x02, 0x22, 0x6a, 0x00, 0x08, 0xf1, 
+  0x14, 0x22, 0x40, 0xe2, 0x0f, 0x60, 0x03, 0x0e, 0x70, 0x01, 0x8e, 0x20, 
+  0x8e, 0x08, 0xb8, 0x05, 0x79, 0xdc, 0x1d, 0x5c, 0x10, 0x03, 0x8e, 0x42, 
+  0x8e, 0x08, 0xb8, 0x45, 0x78, 0xdd, 0x1d, 0x1c, 0x10, 0x05, 0x8e, 0x44, 
+  0x0c, 0x00, 0xf1, 0x06, 0xde, 0x1d, 0x1c, 0x10, 0x2e, 0x7a, 0x2c, 0x70, 
+  0xf2, 0x0d, 0x60, 0x00, 0xe1, 0x40, 0xdd, 0x15, 0x42, 0x17, 0x2c, 0x71, 
+  0xe6, 0x0c, 0x00, 0x10, 0xde, 0x0c, 0x00, 0x21, 0x72, 0xda, 0x0c, 0x00, 
+  0x01, 0x1e, 0x03, 0xf1, 0x01, 0x71, 0xba, 0x0c, 0x60, 0x01, 0xe1, 0x40, 
+  0x45, 0x8e, 0x6e, 0x85, 0x3b, 0xd9, 0x83, 0xba, 0xaa, 0x0e, 0x00, 0x04, 
+  0x38, 0x02, 0x22, 0x92, 0x0d, 0x90, 0x00, 0x02, 0x1a, 0x03, 0x63, 0xa1, 
+  0xba, 0xe1, 0x40, 0x8a, 0x0c, 0x0c, 0x02, 0x61, 0x85, 0x7e, 0xd9, 0x4c, 
+  0x73, 0x7e, 0x2e, 0x00, 0xf1, 0x08, 0x02, 0x40, 0xca, 0xc7, 0xe2, 0xc2, 
+  0xb9, 0x10, 0xc3, 0x00, 0x31, 0x0b, 0x32, 0x00, 0x08, 0x45, 0x1f, 0x85, 
+  0x40, 0x80, 0x22, 0x80, 0x06, 0x3a, 0x05, 0xc0, 0x1d, 0x08, 0x12, 0x00, 
+  0x05, 0xe9, 0xb9, 0x11, 0xc0, 0x00, 0x15, 0x08, 0xf4, 0x02, 0xf0, 0x33, 
+  0x4c, 0x71, 0x2e, 0x0d, 0xe0, 0x00, 0xa1, 0x40, 0xb9, 0x15, 0x83, 0x10, 
+  0x87, 0xbb, 0x0c, 0x70, 0xb9, 0x1d, 0xc2, 0x10, 0xc2, 0xc6, 0xe0, 0x78, 
+  0xfa, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xac, 0xc1, 0xff, 0x80, 0x10, 0x41, 
+  0x61, 0x17, 0x00, 0x16, 0xca, 0x17, 0x18, 0x17, 0x4b, 0xc0, 0x4e, 0x09, 
+  0x60, 0x03, 0x22, 0x40, 0x14, 0x70, 0xfa, 0x02, 0x22, 0x00, 0x8a, 0x23, 
+  0x41, 0x39, 0x40, 0x21, 0x00, 0x27, 0x9c, 0x00, 0xa2, 0x42, 0xd9, 0x6c, 
+  0x72, 0xf6, 0x0c, 0xe0, 0x02, 0x10, 0x47, 0x32, 0x06, 0x00, 0x60, 0x01, 
+  0x92, 0x4a, 0xc0, 0x6c, 0x72, 0xe2, 0x0c, 0xe0, 0x02, 0xe2, 0xb0, 0x00, 
+  0x10, 0x87, 0x62, 0x01, 0x44, 0x22, 0x40, 0xda, 0x0b, 0x34, 0x03, 0x20, 
+  0x0a, 0x0a, 0x34, 0x03, 0xf5, 0x20, 0x2c, 0x70, 0x6a, 0x0f, 0x60, 0x00, 
+  0x22, 0x40, 0xe1, 0x40, 0x80, 0x20, 0x06, 0x0b, 0xa3, 0x10, 0x81, 0x80, 
+  0x00, 0x88, 0x03, 0xe9, 0x8a, 0xe8, 0x04, 0xf0, 0x04, 0xe8, 0x2c, 0x71, 
+  0x03, 0xf0, 0x2c, 0x70, 0x4a, 0x0b, 0xaf, 0xfe, 0x22, 0x40, 0x2c, 0x70, 
+  0xf2, 0x0a, 0xa0, 0x00, 0x22, 0x0a, 0x01, 0x13, 0x86, 0x5a, 0x00, 0x42, 
+  0x80, 0x30, 0x38, 0x17, 0x9a, 0x01, 0x19, 0x81, 0x4a, 0x07, 0xf0, 0x01, 
+  0x4a, 0x0e, 0x60, 0x03, 0xe2, 0x40, 0x0b, 0xdd, 0xa5, 0x77, 0x5a, 0xd8, 
+  0x2f, 0x26, 0x47, 0xf3, 0xe4, 0x02, 0xa2, 0x11, 0xf2, 0xc3, 0x40, 0xb0, 
+  0x41, 0x00, 0x00, 0x8e, 0x09, 0x5e, 0x03, 0x20, 0x2c, 0x73, 0x00, 0x08, 
+  0x04, 0x48, 0x00, 0xf4, 0x2f, 0xd9, 0x08, 0x9e, 0x81, 0xc3, 0x40, 0xa0, 
+  0x42, 0x00, 0x00, 0x6e, 0x09, 0x4f, 0xed, 0x7c, 0x11, 0x10, 0x20, 0xcd, 
+  0x70, 0x42, 0xd9, 0xa7, 0xda, 0x38, 0x10, 0x03, 0x20, 0x22, 0x40, 0x43, 
+  0xc6, 0x42, 0xc6, 0x1e, 0x0b, 0x60, 0x01, 0x41, 0xc6, 0x18, 0x1c, 0x00, 
+  0x34, 0x06, 0xc0, 0x8a, 0x21, 0x06, 0x3b, 0xce, 0x70, 0xae, 0x70, 0x4e, 
+  0x70, 0x80, 0x20, 0x05, 0x03, 0x46, 0xc0, 0x46, 0x03, 0xf0, 0x01, 0xa0, 
+  0x41, 0x00, 0x00, 0x2e, 0x09, 0x4f, 0xed, 0x84, 0xc2, 0x12, 0xd9, 0x07, 
+  0xdb, 0xe2, 0x0b, 0x5e, 0x00, 0x10, 0x16, 0x6e, 0x03, 0xf1, 0x21, 0xc1, 
+  0x12, 0x14, 0x82, 0x30, 0x15, 0x14, 0x8c, 0x30, 0x13, 0x14, 0x83, 0x30, 
+  0x11, 0x14, 0x8d, 0x30, 0x32, 0x20, 0x4b, 0x26, 0x08, 0xb8, 0x08, 0xb9, 
+  0x08, 0xba, 0x05, 0x20, 0x14, 0x03, 0x05, 0x21, 0xd3, 0x00, 0x4b, 0x0b, 
+  0x30, 0x10, 0x45, 0x7d, 0x06, 0xc2, 0x22, 0xd9, 0x6c, 0x73, 0xa6, 0x3a, 
+  0x00, 0xf0, 0x2d, 0x2f, 0x20, 0x06, 0x05, 0x2f, 0x21, 0xc6, 0x04, 0xae, 
+  0x7a, 0x48, 0x30, 0x80, 0x00, 0x48, 0x31, 0x81, 0x00, 0x48, 0x32, 0x82, 
+  0x00, 0x49, 0xc0, 0x48, 0xc1, 0x47, 0xc2, 0x87, 0xc1, 0x81, 0xc2, 0xb2, 
+  0x0a, 0x20, 0x01, 0x22, 0x40, 0x03, 0xc2, 0x02, 0xc1, 0x01, 0xc0, 0x48, 
+  0x32, 0xd4, 0x02, 0x48, 0x31, 0xd3, 0x02, 0x48, 0x30, 0xcd, 0x02, 0xae, 
+  0x78, 0xc5, 0x71, 0x38, 0x00, 0xf0, 0x32, 0x2f, 0x22, 0x06, 0x05, 0x00, 
+  0x22, 0x12, 0x20, 0xcf, 0x78, 0x00, 0x25, 0x55, 0x20, 0x5d, 0x08, 0x34, 
+  0x82, 0x00, 0x26, 0x96, 0x20, 0x32, 0x20, 0x40, 0x26, 0x14, 0x70, 0xc4, 
+  0x2e, 0x21, 0x22, 0xc4, 0x2d, 0x21, 0x22, 0xc4, 0x2a, 0x21, 0x22, 0x1e, 
+  0xf2, 0x1f, 0xdd, 0x48, 0x32, 0x92, 0x20, 0x19, 0xbd, 0xd2, 0x0f, 0xef, 
+  0xfd, 0x00, 0x32, 0x40, 0x23, 0x48, 0x35, 0x95, 0x20, 0x08, 0x46, 0xc6, 
+  0x0e, 0x00, 0xa0, 0x35, 0x40, 0x23, 0x48, 0x36, 0x96, 0x20, 0x10, 0x40, 
+  0xb6, 0x0e, 0x00, 0xf4, 0x52, 0x36, 0x40, 0x23, 0x48, 0x30, 0xd6, 0x02, 
+  0x48, 0x30, 0xd5, 0x22, 0x48, 0x36, 0xd2, 0x12, 0x42, 0x41, 0xa2, 0x40, 
+  0xc2, 0x42, 0x80, 0x21, 0x08, 0x00, 0x80, 0x20, 0x08, 0x00, 0x80, 0x22, 
+  0x08, 0x00, 0x25, 0x78, 0x05, 0x7a, 0x50, 0x78, 0x8c, 0x20, 0xcf, 0x8f, 
+  0xd2, 0x00, 0x2d, 0x00, 0x4e, 0x26, 0x10, 0x20, 0x4e, 0x25, 0x0e, 0x20, 
+  0x4e, 0x22, 0x0d, 0x20, 0x81, 0xc0, 0x22, 0x41, 0x08, 0x1c, 0x04, 0x34, 
+  0x83, 0x42, 0xc3, 0xb2, 0x8a, 0x08, 0x60, 0x01, 0xa2, 0xb2, 0x2c, 0x71, 
+  0x22, 0x40, 0xdb, 0x1f, 0x1c, 0x14, 0xda, 0x1f, 0x9c, 0x13, 0x62, 0x0d, 
+  0x60, 0x00, 0xd9, 0x1f, 0x5c, 0x13, 0x9e, 0x03, 0x28, 0xa6, 0x0a, 0x3c, 
+  0x02, 0x64, 0x80, 0xba, 0x22, 0x40, 0x9e, 0x09, 0x3c, 0x02, 0xe4, 0xce, 
+  0x0f, 0x2f, 0xed, 0x9e, 0xb8, 0x0b, 0xc0, 0x8b, 0x20, 0x83, 0x8f, 0x19, 
+  0xf4, 0x14, 0x02, 0x13, 0x72, 0x32, 0x00, 0x06, 0x14, 0x02, 0x19, 0xa1, 
+  0x14, 0x02, 0x20, 0x36, 0x0c, 0x14, 0x02, 0xf0, 0x01, 0x8c, 0x20, 0x41, 
+  0xbf, 0x0e, 0xf2, 0x8c, 0x20, 0x83, 0xbe, 0x0c, 0xf2, 0x8c, 0x20, 0x07, 
+  0xbd, 0x06, 0x00, 0xf0, 0x07, 0x0f, 0xba, 0x2c, 0x70, 0x09, 0xf4, 0x2c, 
+  0x71, 0x07, 0xf0, 0x2c, 0x74, 0x05, 0xf0, 0x2c, 0x73, 0x03, 0xf0, 0x2c, 
+  0x72, 0x82, 0x08, 0x70, 0x02, 0xf0, 0x1b, 0x6e, 0x87, 0x0a, 0xc2, 0x42, 
+  0xd9, 0x26, 0x09, 0x60, 0x01, 0x22, 0x40, 0x6f, 0x73, 0x63, 0x40, 0xac, 
+  0xc0, 0x04, 0x14, 0x1b, 0x34, 0xda, 0xc6, 0x1f, 0x80, 0xe0, 0x7f, 0xca, 
+  0x10, 0x00, 0x07, 0xe4, 0xc3, 0xa1, 0xc1, 0x08, 0x45, 0x1f, 0x80, 0x28, 
+  0x46, 0xbc, 0x03, 0x40, 0x6e, 0x80, 0xfa, 0x08, 0x82, 0x05, 0xa0, 0x2f, 
+  0x0e, 0xb0, 0x10, 0x1c, 0xe5, 0x41, 0x0e, 0x70, 0x10, 0x9c, 0x00, 0x40, 
+  0x0c, 0x70, 0xaf, 0xee, 0x08, 0x00, 0xd1, 0x36, 0xd9, 0x6c, 0x72, 0xce, 
+  0x09, 0xe0, 0x02, 0xa1, 0x40, 0x03, 0x14, 0x8e, 0x26, 0x03, 0x40, 0x37, 
+  0xd9, 0x18, 0xf0, 0x08, 0x00, 0x59, 0x3a, 0xd9, 0x6c, 0x72, 0xb6, 0x1a, 
+  0x00, 0x40, 0x3b, 0xd9, 0x0c, 0xf0, 0x1e, 0x07, 0x19, 0x9e, 0x16, 0x00, 
+  0x53, 0x39, 0xd9, 0x6c, 0x72, 0x8e, 0x12, 0x00, 0xa0, 0x80, 0x30, 0xc2, 
+  0xb8, 0x08, 0xb8, 0xc5, 0x78, 0xc4, 0xc7, 0x84, 0x00, 0xb1, 0x3d, 0x09, 
+  0xb0, 0x00, 0x40, 0x20, 0x0d, 0x07, 0x5d, 0x09, 0x70, 0xd6, 0x05, 0x60, 
+  0x7f, 0x09, 0x31, 0x00, 0x0c, 0x70, 0x0a, 0x00, 0x59, 0x74, 0xd9, 0x6c, 
+  0x72, 0x5a, 0x46, 0x00, 0x00, 0xda, 0x04, 0x15, 0x46, 0x46, 0x00, 0x11, 
+  0x27, 0x82, 0x00, 0x5d, 0x76, 0xd9, 0x6c, 0x72, 0x32, 0x26, 0x00, 0x15, 
+  0x22, 0x26, 0x00, 0x51, 0x24, 0xb8, 0x13, 0xf0, 0x75, 0x00, 0x08, 0x0c, 
+  0x24, 0x00, 0x24, 0xfe, 0x08, 0x24, 0x00, 0x71, 0x22, 0xb8, 0x0e, 0xb8, 
+  0x0e, 0x78, 0x46, 0x94, 0x00, 0x00, 0x20, 0x01, 0xf0, 0x05, 0x61, 0x10, 
+  0x00, 0x06, 0xec, 0xc3, 0x30, 0x41, 0xb9, 0x11, 0xc1, 0x00, 0x09, 0x09, 
+  0x32, 0x00, 0xa6, 0xc1, 0xcc, 0xc7, 0x58, 0x03, 0xf0, 0x69, 0x8a, 0x21, 
+  0x07, 0x03, 0xcb, 0x45, 0x13, 0x00, 0x34, 0x5e, 0x32, 0x20, 0x41, 0x20, 
+  0xa3, 0x09, 0x30, 0x00, 0x62, 0x18, 0x18, 0x20, 0x88, 0x11, 0x00, 0x20, 
+  0x70, 0x10, 0x02, 0x26, 0x71, 0x10, 0x03, 0x26, 0x70, 0x18, 0x18, 0x20, 
+  0x8c, 0x11, 0x01, 0x20, 0x02, 0x20, 0x80, 0x80, 0x71, 0x18, 0x58, 0x20, 
+  0x5a, 0x08, 0x6f, 0xe2, 0x03, 0x21, 0xc1, 0x80, 0x08, 0x46, 0xb2, 0x0f, 
+  0x60, 0x02, 0x22, 0x40, 0x2c, 0x85, 0x00, 0x30, 0x40, 0x00, 0x07, 0x36, 
+  0x01, 0x70, 0x7a, 0x47, 0x00, 0x00, 0x02, 0x31, 0x80, 0x03, 0x07, 0x30, 
+  0x40, 0x00, 0x50, 0x20, 0xc1, 0x07, 0x04, 0x31, 0x80, 0x8f, 0x4c, 0x3e, 
+  0xcd, 0xcc, 0x4a, 0x00, 0x06, 0x00, 0xc3, 0x42, 0x8f, 0x3d, 0x29, 0x5c, 
+  0x04, 0x30, 0x80, 0x80, 0x0a, 0xf6, 0xc3, 0x41, 0x8f, 0xbd, 0x0c, 0x00, 
+  0xc2, 0x40, 0x80, 0x00, 0x42, 0xca, 0x22, 0x45, 0x00, 0x72, 0x10, 0x01, 
+  0x26, 0x6c, 0x07, 0xf1, 0x29, 0x00, 0x32, 0x03, 0x00, 0x01, 0x32, 0x41, 
+  0x00, 0xb7, 0xb8, 0x00, 0x31, 0x00, 0x00, 0x72, 0x18, 0x58, 0x20, 0x01, 
+  0x33, 0x00, 0x00, 0x48, 0x30, 0xc0, 0x02, 0xe2, 0x0f, 0xa0, 0x02, 0x0d, 
+  0x78, 0xd2, 0x10, 0x80, 0x20, 0xce, 0x10, 0x83, 0x20, 0xd0, 0x10, 0x81, 
+  0x20, 0xd1, 0x10, 0x82, 0x20, 0xcd, 0x10, 0x8b, 0x20, 0xcf, 0x10, 0x8c, 
+  0x20, 0xbc, 0x03, 0xf0, 0x00, 0xbb, 0x45, 0x78, 0x85, 0x79, 0x05, 0x23, 
+  0xc3, 0x02, 0x0e, 0x7a, 0x2e, 0x79, 0x6e, 0x78, 0x9e, 0x03, 0x01, 0xa6, 
+  0x03, 0xf0, 0xba, 0x30, 0x80, 0x00, 0x42, 0xc2, 0x41, 0xc1, 0x40, 0xc0, 
+  0x80, 0xc1, 0x83, 0xc2, 0x22, 0x40, 0x0a, 0x0f, 0xe0, 0x00, 0x40, 0x24, 
+  0x12, 0x30, 0x2b, 0x85, 0x04, 0xc0, 0x03, 0xc2, 0x68, 0x85, 0xea, 0x85, 
+  0xc9, 0x85, 0x1c, 0x15, 0x0b, 0x10, 0xa6, 0x85, 0x00, 0x30, 0x49, 0x00, 
+  0x00, 0x32, 0xc1, 0x00, 0x05, 0xc4, 0x01, 0x30, 0x48, 0x00, 0x00, 0x30, 
+  0x40, 0x03, 0x4a, 0x24, 0xc0, 0x70, 0x01, 0x32, 0x01, 0x00, 0x00, 0x32, 
+  0xc0, 0x03, 0x01, 0x30, 0x43, 0x02, 0x00, 0x34, 0x80, 0x13, 0x01, 0x30, 
+  0x02, 0x10, 0x00, 0x34, 0xc0, 0x12, 0x41, 0xc2, 0x01, 0x31, 0x01, 0x00, 
+  0x01, 0x34, 0xc0, 0x10, 0x8d, 0x70, 0x40, 0xc1, 0x08, 0x1c, 0x00, 0x30, 
+  0xa8, 0x20, 0x80, 0x08, 0x15, 0x20, 0x00, 0x23, 0x15, 0x22, 0x0d, 0x23, 
+  0x55, 0x20, 0x83, 0x0e, 0x00, 0x85, 0x20, 0x83, 0x01, 0x30, 0x42, 0x00, 
+  0xc3, 0x41, 0x00, 0x00, 0xff, 0x7f, 0x48, 0x32, 0xc0, 0x02, 0x48, 0x30, 
+  0x8b, 0x00, 0x40, 0xa5, 0x02, 0x32, 0xc2, 0x02, 0x13, 0x09, 0x22, 0x00, 
+  0x40, 0xa3, 0xc3, 0x41, 0xff, 0xff, 0x00, 0x80, 0x30, 0x70, 0xca, 0x21, 
+  0x0a, 0x00, 0x85, 0x71, 0xb0, 0x1b, 0x40, 0x00, 0xc3, 0x40, 0xa1, 0x00, 
+  0x48, 0x1e, 0x20, 0x88, 0x04, 0xe9, 0x00, 0x18, 0x03, 0x00, 0xcc, 0xc7, 
+  0x62, 0x10, 0x01, 0x26, 0x60, 0x79, 0x22, 0x40, 0xcc, 0xc7, 0xe0, 0x78, 
+  0xc8, 0x01, 0x40, 0x64, 0x10, 0x00, 0x06, 0x08, 0x00, 0x11, 0x63, 0xd0, 
+  0x01, 0xf1, 0x2a, 0xa1, 0xc1, 0x28, 0x47, 0x29, 0x68, 0x70, 0x40, 0x50, 
+  0x41, 0x8d, 0x09, 0x75, 0x02, 0x24, 0xd8, 0x7c, 0x10, 0x0d, 0x20, 0x25, 
+  0x20, 0x40, 0x00, 0x0a, 0xf0, 0x1f, 0xf0, 0x23, 0xf0, 0x26, 0xf0, 0x3d, 
+  0xf0, 0x41, 0xf0, 0x3a, 0xf0, 0x43, 0xf0, 0x4a, 0xf0, 0x2c, 0x70, 0x6a, 
+  0x0d, 0xef, 0xff, 0x02, 0x40, 0xd9, 0x1d, 0x1c, 0x10, 0x2c, 0x71, 0x5e, 
+  0x0c, 0x00, 0x10, 0xda, 0x0c, 0x00, 0x22, 0x72, 0x52, 0x0c, 0x00, 0xf1, 
+  0x53, 0x15, 0x03, 0x17, 0xd9, 0x15, 0x02, 0x17, 0xdb, 0x1d, 0x1c, 0x10, 
+  0x6b, 0xf0, 0x56, 0x25, 0x40, 0x1d, 0x20, 0x88, 0x03, 0xf0, 0xd6, 0x15, 
+  0x81, 0x10, 0x0c, 0x70, 0xc0, 0xb9, 0x26, 0xf0, 0xa9, 0x46, 0x02, 0x40, 
+  0x72, 0x0c, 0xaf, 0xff, 0x80, 0x26, 0x06, 0x1b, 0x79, 0x20, 0x00, 0x00, 
+  0x1b, 0x78, 0x00, 0xae, 0x00, 0xaf, 0x02, 0x8e, 0x01, 0xaf, 0x23, 0x8e, 
+  0x56, 0x25, 0x80, 0x1d, 0x22, 0xaf, 0x20, 0x88, 0x0c, 0x70, 0x23, 0xaf, 
+  0x00, 0x19, 0x05, 0x21, 0xcc, 0xc7, 0x80, 0x25, 0x86, 0x1a, 0x20, 0x8d, 
+  0x0c, 0x70, 0xc1, 0xb9, 0x08, 0xf0, 0x80, 0x25, 0x07, 0x13, 0x20, 0x8d, 
+  0x03, 0xf0, 0xe7, 0x4c, 0x00, 0xf4, 0x05, 0x20, 0xaf, 0x00, 0x19, 0x45, 
+  0x20, 0xcc, 0xc7, 0x02, 0x40, 0x2a, 0x0d, 0xaf, 0xff, 0x40, 0x20, 0x0e, 
+  0x27, 0x10, 0x42, 0xbe, 0x02, 0xa4, 0x3e, 0x0e, 0xa0, 0x02, 0xc1, 0x40, 
+  0x13, 0x0a, 0x30, 0x20, 0xe6, 0x07, 0x40, 0xc6, 0xb8, 0x04, 0xf0, 0x08, 
+  0x00, 0x02, 0xea, 0x07, 0x00, 0x46, 0x04, 0x04, 0xee, 0x07, 0xa0, 0xf6, 
+  0x0f, 0x20, 0x03, 0xc1, 0x40, 0x2c, 0x70, 0x0e, 0x0c, 0xbe, 0x00, 0x11, 
+  0xdc, 0xd6, 0x00, 0x11, 0x02, 0x0c, 0x00, 0x00, 0xec, 0x07, 0x41, 0x2c, 
+  0x72, 0xf6, 0x0b, 0x0c, 0x00, 0x70, 0x15, 0x03, 0x17, 0xdc, 0x15, 0x02, 
+  0x17, 0xf4, 0x07, 0xf0, 0x0b, 0x41, 0x28, 0x01, 0x02, 0x40, 0xaf, 0x62, 
+  0xaf, 0x28, 0xba, 0x28, 0xbb, 0x04, 0xaf, 0x0c, 0x70, 0x25, 0xaf, 0x41, 
+  0xaf, 0x63, 0xaf, 0x00, 0x19, 0x85, 0x21, 0x5c, 0x01, 0xf0, 0x6f, 0xfa, 
+  0xc3, 0x82, 0x24, 0x02, 0x39, 0xbf, 0x80, 0x4c, 0xc0, 0x2c, 0x70, 0xa1, 
+  0x40, 0x80, 0x20, 0xc2, 0x0f, 0xfe, 0x0c, 0x2f, 0xf0, 0x14, 0xda, 0x0c, 
+  0xc0, 0xcd, 0x70, 0x23, 0xd9, 0x01, 0xa5, 0x7f, 0xd8, 0x17, 0xb8, 0x0e, 
+  0xa5, 0x0c, 0xc0, 0x61, 0x1d, 0x98, 0x13, 0x2d, 0xa5, 0x1f, 0x80, 0x71, 
+  0x18, 0x98, 0x03, 0x70, 0x18, 0x98, 0x03, 0x72, 0x18, 0x98, 0x03, 0x80, 
+  0x20, 0x07, 0x03, 0x2a, 0x0d, 0xa0, 0x02, 0xc0, 0xa8, 0x0c, 0xc0, 0x0c, 
+  0xc5, 0x00, 0x24, 0x82, 0x3f, 0x00, 0x00, 0xa3, 0x00, 0x7d, 0xd9, 0x1f, 
+  0x80, 0x1c, 0xe5, 0x6c, 0x71, 0xa1, 0x18, 0x9c, 0x03, 0xa1, 0x40, 0xa3, 
+  0x1c, 0x83, 0x30, 0x06, 0x0f, 0x20, 0x03, 0xa0, 0x1c, 0x84, 0x33, 0x8a, 
+  0x26, 0xbf, 0x1d, 0x0a, 0xe6, 0x8c, 0x26, 0xc3, 0x91, 0x34, 0x03, 0x2d, 
+  0x00, 0x55, 0x24, 0x02, 0x3a, 0xfe, 0x06, 0xf6, 0x07, 0x42, 0x0d, 0xa0, 
+  0x02, 0xa1, 0x40, 0xb6, 0x0a, 0x2f, 0xed, 0x0a, 0xd8, 0xa1, 0x14, 0x80, 
+  0x30, 0xe1, 0x08, 0x9e, 0x81, 0xcd, 0x70, 0x4e, 0x00, 0xf0, 0x2b, 0x6c, 
+  0x71, 0xa1, 0x40, 0xc6, 0x0e, 0x20, 0x03, 0xa3, 0x1c, 0x82, 0x33, 0x0c, 
+  0xc0, 0xbe, 0x0b, 0x6f, 0xfe, 0x2c, 0x71, 0x0c, 0xc0, 0x2c, 0x70, 0x25, 
+  0xda, 0x1f, 0x80, 0x4b, 0xc0, 0x55, 0x20, 0x80, 0x0e, 0x4a, 0xc0, 0x4a, 
+  0x0c, 0x2f, 0xf0, 0x80, 0xc0, 0x0a, 0xc0, 0x80, 0xc2, 0x5e, 0xd9, 0xc2, 
+  0xa0, 0xc1, 0xa0, 0xc0, 0xa0, 0x25, 0xdb, 0xea, 0x0c, 0x58, 0x00, 0xe0, 
+  0x01, 0x14, 0x80, 0x30, 0x18, 0x14, 0x9f, 0x30, 0x22, 0x14, 0x93, 0x30, 
+  0x5d, 0xc0, 0x60, 0x01, 0xf0, 0x30, 0x0d, 0x14, 0x92, 0x30, 0x10, 0x14, 
+  0x90, 0x30, 0x5c, 0xc0, 0x05, 0x14, 0x80, 0x30, 0x13, 0x14, 0x8f, 0x30, 
+  0x17, 0x14, 0x94, 0x30, 0x5b, 0xc0, 0x23, 0xc0, 0x0b, 0x14, 0x91, 0x30, 
+  0x0e, 0x14, 0x8b, 0x30, 0x53, 0xc0, 0x12, 0x14, 0x80, 0x30, 0x11, 0x14, 
+  0x8e, 0x30, 0x1d, 0x14, 0x8c, 0x30, 0x52, 0xc0, 0x40, 0x2f, 0x00, 0x36, 
+  0x98, 0x1c, 0x00, 0x30, 0x40, 0x2b, 0x00, 0x26, 0x94, 0x08, 0x00, 0x40, 
+  0x2a, 0x80, 0x26, 0x8c, 0x08, 0x00, 0x40, 0x28, 0x80, 0x26, 0x88, 0x08, 
+  0x00, 0xf1, 0x17, 0x2f, 0x80, 0x16, 0x84, 0x1c, 0x00, 0x30, 0x44, 0x24, 
+  0x80, 0x20, 0x80, 0x1c, 0x00, 0x30, 0x53, 0x23, 0x40, 0x20, 0x5f, 0xc0, 
+  0x6c, 0x22, 0x40, 0x21, 0x5e, 0xc0, 0x40, 0x29, 0x80, 0x21, 0x54, 0xc0, 
+  0x6c, 0x20, 0x40, 0x21, 0x90, 0x42, 0x00, 0xf0, 0x1a, 0x80, 0x11, 0x55, 
+  0xc0, 0x6c, 0x27, 0x40, 0x11, 0x08, 0x14, 0x85, 0x30, 0x4e, 0xc0, 0x16, 
+  0x6e, 0x21, 0x14, 0x84, 0x30, 0x56, 0xc0, 0x44, 0x27, 0x80, 0x30, 0x0a, 
+  0x14, 0x89, 0x30, 0x4f, 0xc0, 0x40, 0x2c, 0x80, 0x13, 0x09, 0x14, 0x88, 
+  0x30, 0x9c, 0x2e, 0x00, 0x80, 0x2d, 0x80, 0x01, 0x1e, 0x14, 0x81, 0x30, 
+  0x50, 0x16, 0x00, 0x60, 0x03, 0x1f, 0x14, 0x83, 0x30, 0x4d, 0x50, 0x00, 
+  0xf0, 0x1c, 0x11, 0x28, 0xc2, 0x51, 0xc0, 0x40, 0x28, 0x80, 0x11, 0x57, 
+  0xc0, 0x16, 0x69, 0x58, 0xc0, 0x16, 0x6b, 0x02, 0x14, 0x9e, 0x30, 0x59, 
+  0xc0, 0x16, 0x6a, 0x5a, 0xc0, 0x1d, 0xc0, 0x40, 0x2e, 0x1e, 0x32, 0x06, 
+  0x14, 0x96, 0x30, 0x05, 0x26, 0x1e, 0x30, 0x98, 0x14, 0x9c, 0x00, 0xf0, 
+  0x10, 0xce, 0x33, 0x6c, 0x14, 0x1f, 0x30, 0x42, 0x28, 0x97, 0x06, 0x94, 
+  0x14, 0x00, 0x30, 0x07, 0x14, 0x95, 0x30, 0x40, 0x2e, 0x16, 0x22, 0x05, 
+  0x27, 0x9f, 0x35, 0x42, 0x28, 0x96, 0x06, 0x8c, 0x24, 0x00, 0xc0, 0x2d, 
+  0xd5, 0x26, 0x42, 0x2d, 0xd0, 0x26, 0x42, 0x28, 0x95, 0x06, 0x88, 0x10, 
+  0x00, 0xf1, 0x19, 0x2c, 0x18, 0x26, 0x0f, 0x14, 0x8d, 0x30, 0x42, 0x28, 
+  0x94, 0x06, 0x84, 0x14, 0x00, 0x30, 0x23, 0x14, 0x86, 0x30, 0x10, 0xc2, 
+  0x42, 0x28, 0x93, 0x06, 0x0e, 0xc0, 0x40, 0x2d, 0x4b, 0x11, 0x44, 0x26, 
+  0x0d, 0x06, 0x40, 0x28, 0x19, 0x02, 0x9c, 0x3c, 0x00, 0xf0, 0xff, 0x64, 
+  0x81, 0x12, 0x0d, 0xc5, 0x05, 0x7a, 0x11, 0xc0, 0x04, 0x14, 0x87, 0x30, 
+  0x70, 0x14, 0x11, 0x30, 0x05, 0x7d, 0x0a, 0xc0, 0x40, 0x2f, 0x07, 0x02, 
+  0x05, 0x21, 0xd1, 0x21, 0x18, 0x18, 0x84, 0x07, 0x42, 0x28, 0x98, 0x36, 
+  0x0b, 0xc0, 0x6c, 0x24, 0x4f, 0x01, 0x44, 0x24, 0x08, 0x0c, 0x81, 0x18, 
+  0x5c, 0x04, 0x44, 0x24, 0x12, 0x03, 0x0a, 0xc0, 0x80, 0x14, 0x04, 0x30, 
+  0x7c, 0x14, 0x05, 0x30, 0x1c, 0x18, 0xc4, 0x07, 0x1e, 0xc3, 0x0b, 0xc0, 
+  0x44, 0x24, 0x09, 0x13, 0x40, 0x2c, 0x44, 0x02, 0x83, 0x18, 0x1c, 0x04, 
+  0x40, 0x2d, 0x05, 0x02, 0x0a, 0xc0, 0x08, 0xbb, 0x90, 0x14, 0x0c, 0x30, 
+  0x20, 0x18, 0x04, 0x06, 0x05, 0x24, 0x44, 0x01, 0x0b, 0xc0, 0x08, 0xbc, 
+  0x84, 0x26, 0x01, 0x08, 0x85, 0x18, 0xdc, 0x05, 0x40, 0x2e, 0xc7, 0x00, 
+  0x0a, 0xc0, 0x3c, 0x14, 0x06, 0x30, 0x05, 0x26, 0xce, 0x12, 0x24, 0x18, 
+  0x84, 0x05, 0x40, 0x2e, 0x46, 0x02, 0x0b, 0xc0, 0x40, 0x29, 0x09, 0x13, 
+  0x08, 0xbf, 0x87, 0x18, 0x5c, 0x05, 0x40, 0x28, 0x8b, 0x12, 0x0a, 0xc0, 
+  0x40, 0x2a, 0x08, 0x23, 0xae, 0x7d, 0x28, 0x18, 0x04, 0x05, 0x26, 0xbd, 
+  0x0b, 0xc0, 0x89, 0x18, 0xdc, 0x04, 0x14, 0xc0, 0x05, 0x20, 0xc5, 0x00, 
+  0x15, 0xc0, 0x05, 0x26, 0x43, 0x10, 0x4e, 0x7e, 0x05, 0x20, 0x1e, 0x03, 
+  0x16, 0xc0, 0x18, 0xc2, 0x05, 0x27, 0x8c, 0x01, 0x05, 0x21, 0x19, 0x30, 
+  0x17, 0xc0, 0xe5, 0x7a, 0x6e, 0x7f, 0x05, 0x20, 0x46, 0x02, 0x19, 0xc0, 
+  0x12, 0xc3, 0x1a, 0xc1, 0x05, 0x20, 0xc0, 0x02, 0x65, 0x7c, 0x4e, 0x7b, 
+  0x0e, 0x7a, 0x0a, 0xc0, 0x05, 0x21, 0x01, 0x02, 0x2f, 0x20, 0x46, 0x11, 
+  0x26, 0xbe, 0x41, 0x28, 0x88, 0x11, 0xdc, 0xb0, 0xbe, 0xb0, 0x2c, 0x18, 
+  0x04, 0x02, 0x2f, 0x27, 0x86, 0x07, 0x0b, 0xc0, 0x41, 0x2f, 0x87, 0x01, 
+  0x2f, 0x21, 0x46, 0x16, 0x8b, 0x18, 0xdc, 0x01, 0x41, 0x29, 0x89, 0x11, 
+  0x0a, 0xc0, 0x25, 0xbf, 0x2f, 0x26, 0x86, 0x01, 0x30, 0x18, 0x44, 0x02, 
+  0xfa, 0xb0, 0x41, 0x2e, 0x86, 0x01, 0x0b, 0xc0, 0x26, 0xbb, 0x4c, 0x14, 
+  0x0b, 0x30, 0x91, 0x18, 0x9c, 0x01, 0x93, 0x18, 0xdc, 0x00, 0x26, 0xba, 
+  0x0a, 0xc0, 0x05, 0x23, 0x0b, 0x11, 0x2e, 0x79, 0x40, 0x18, 0x84, 0x00, 
+  0x40, 0x2b, 0x4b, 0x15, 0x0b, 0xc0, 0x15, 0xbc, 0x26, 0xb9, 0x42, 0x2b, 
+  0x4b, 0x15, 0x55, 0xbc, 0x95, 0x18, 0x5c, 0x00, 0x8d, 0x18, 0xdc, 0x02, 
+  0x8f, 0x18, 0x1c, 0x03, 0xc6, 0x0c, 0x6f, 0xfe, 0x0c, 0xc0, 0x0c, 0xc1, 
+  0x6a, 0x0d, 0x20, 0x00, 0x0c, 0x70, 0x0c, 0x70, 0xda, 0xc7, 0x00, 0x05, 
+  0xfb, 0x0a, 0xdf, 0x80, 0x10, 0x41, 0x60, 0xdf, 0x5e, 0x16, 0x00, 0x16, 
+  0x8c, 0x20, 0x02, 0x80, 0xcc, 0x20, 0x82, 0x8f, 0x00, 0x00, 0xff, 0x00, 
+  0xb1, 0xf2, 0x61, 0x12, 0x00, 0x60, 0xa7, 0xf2, 0x40, 0x21, 0x00, 0x27, 
+  0x6a, 0x04, 0xf0, 0x17, 0x7c, 0xd9, 0x6c, 0x72, 0xd6, 0x09, 0xa0, 0x02, 
+  0x10, 0x42, 0x03, 0x14, 0x82, 0x30, 0x6e, 0x86, 0x7c, 0xd9, 0xa0, 0xba, 
+  0x22, 0x40, 0xce, 0x08, 0x20, 0x01, 0x03, 0x1c, 0x82, 0x30, 0x0c, 0x70, 
+  0xfe, 0x0e, 0xef, 0xec, 0x9e, 0xb8, 0x2a, 0x00, 0x91, 0x7d, 0xd9, 0x6c, 
+  0x72, 0xaa, 0x09, 0xa0, 0x02, 0x42, 0x52, 0x07, 0x91, 0x6e, 0x86, 0x7d, 
+  0xd9, 0x46, 0x20, 0x80, 0x01, 0x82, 0x8c, 0x04, 0xf3, 0x00, 0x0f, 0x7a, 
+  0x9e, 0x08, 0x20, 0x01, 0x22, 0x40, 0x6e, 0x86, 0x2f, 0xd9, 0x4c, 0x71, 
+  0x92, 0x0c, 0x00, 0x53, 0x33, 0xd9, 0x4c, 0x70, 0x86, 0x0c, 0x00, 0x51, 
+  0x7e, 0xd9, 0x4c, 0x72, 0x7a, 0x0c, 0x00, 0x80, 0x8a, 0x25, 0x03, 0x12, 
+  0x8a, 0x20, 0x81, 0x26, 0x54, 0x00, 0xe0, 0x6e, 0xd9, 0x6c, 0x72, 0x42, 
+  0x40, 0x56, 0x09, 0xa0, 0x02, 0xab, 0x20, 0x08, 0x2e, 0x58, 0x00, 0xf1, 
+  0x07, 0x19, 0x08, 0x1f, 0x00, 0xc3, 0x40, 0x20, 0x41, 0x00, 0x00, 0x82, 
+  0x0e, 0xcf, 0xec, 0xa5, 0x77, 0x2f, 0x26, 0x47, 0xf3, 0xec, 0xf5, 0x58, 
+  0x00, 0x21, 0x70, 0x3a, 0x40, 0x00, 0x00, 0x38, 0x00, 0x55, 0x38, 0xd9, 
+  0x6c, 0x72, 0x1e, 0x8c, 0x00, 0x60, 0x23, 0xb8, 0x53, 0x20, 0x80, 0x80, 
+  0x88, 0x00, 0x24, 0x3b, 0xf4, 0x56, 0x00, 0x13, 0x02, 0x1e, 0x00, 0x24, 
+  0x8d, 0x30, 0xbc, 0x00, 0x2a, 0xee, 0x08, 0xbc, 0x00, 0x80, 0x82, 0x01, 
+  0x22, 0x40, 0xe6, 0x0f, 0xe0, 0x00, 0xe8, 0x00, 0x04, 0x0a, 0x01, 0x13, 
+  0xca, 0x24, 0x00, 0x02, 0x0a, 0x01, 0x53, 0x80, 0xba, 0x22, 0x40, 0xc6, 
+  0x22, 0x00, 0x40, 0x0c, 0x70, 0xf2, 0x0d, 0x0a, 0x01, 0xf1, 0x06, 0x17, 
+  0x0d, 0x7e, 0x10, 0x61, 0xdf, 0x0f, 0x0d, 0xbe, 0x10, 0x62, 0xdf, 0xe3, 
+  0xbd, 0x64, 0xdf, 0xca, 0x27, 0xa2, 0x10, 0xe1, 0x90, 0x06, 0x10, 0xe6, 
+  0x80, 0x01, 0x70, 0x81, 0x4a, 0x24, 0x00, 0x71, 0x00, 0x43, 0xb8, 0x06, 
+  0xf0, 0x23, 0xf0, 0x41, 0x28, 0x45, 0x2c, 0x70, 0x00, 0x42, 0xa8, 0x20, 
+  0xc0, 0x01, 0x08, 0x12, 0x0f, 0x05, 0x0d, 0x0f, 0xc5, 0x10, 0x24, 0x71, 
+  0x2c, 0x74, 0x8a, 0x27, 0x1f, 0x14, 0x36, 0x78, 0x41, 0x80, 0x22, 0x88, 
+  0xa1, 0x40, 0x63, 0x1e, 0x98, 0x10, 0xb2, 0x0e, 0x20, 0x00, 0xca, 0x1e, 
+  0xdc, 0x13, 0x3c, 0x4d, 0x86, 0x00, 0xc0, 0x43, 0xd9, 0x6c, 0x72, 0x46, 
+  0x08, 0xa0, 0x02, 0x02, 0x1c, 0x05, 0x30, 0xac, 0x00, 0xf0, 0x03, 0x80, 
+  0x26, 0x05, 0x11, 0xa1, 0x41, 0x00, 0xae, 0x4a, 0x0b, 0xa0, 0x02, 0x0c, 
+  0x70, 0xe1, 0x40, 0xc6, 0xc7, 0x68, 0x00, 0x84, 0xbf, 0x80, 0x40, 0x20, 
+  0x0e, 0x07, 0x28, 0x47, 0xb8, 0x00, 0x20, 0x12, 0x08, 0x2c, 0x06, 0x04, 
+  0x28, 0x06, 0x84, 0xf5, 0x70, 0xa2, 0xb8, 0xcf, 0x20, 0xa2, 0x00, 0x26, 
+  0x06, 0x13, 0x7c, 0x26, 0x06, 0x20, 0xd2, 0x09, 0x26, 0x06, 0x51, 0xc6, 
+  0xc7, 0xe0, 0x78, 0xe8, 0x2c, 0x02, 0xf0, 0x0b, 0x48, 0x47, 0x30, 0x40, 
+  0x2f, 0xd9, 0x6e, 0x86, 0x4c, 0x71, 0xde, 0x0e, 0xe0, 0x00, 0x08, 0x45, 
+  0x83, 0x08, 0xb0, 0x20, 0x1c, 0xe5, 0xe7, 0x08, 0x70, 0x20, 0x58, 0x00, 
+  0x31, 0x71, 0x08, 0x31, 0x08, 0x00, 0xd0, 0x36, 0xd9, 0x6c, 0x72, 0xb2, 
+  0x0f, 0x60, 0x02, 0xa1, 0x40, 0x40, 0x24, 0x42, 0x0e, 0x00, 0xf0, 0x02, 
+  0x71, 0xa1, 0x40, 0x4a, 0x09, 0x20, 0x03, 0x01, 0x1c, 0xc2, 0x33, 0x16, 
+  0x0d, 0xef, 0xec, 0x0c, 0x71, 0x4e, 0x05, 0x00, 0x2a, 0x00, 0x91, 0x37, 
+  0xd9, 0x72, 0x1e, 0x02, 0x10, 0x6c, 0x72, 0x86, 0x2e, 0x00, 0x00, 0x46, 
+  0x01, 0xd1, 0x28, 0xbf, 0x53, 0x27, 0x81, 0x10, 0x6c, 0x22, 0x80, 0x00, 
+  0x25, 0x78, 0x01, 0x8e, 0x00, 0xe4, 0x42, 0x30, 0x37, 0xd9, 0x6c, 0x71, 
+  0x0a, 0x09, 0x20, 0x03, 0xa1, 0x40, 0xda, 0x0c, 0x3e, 0x00, 0x60, 0x73, 
+  0x1e, 0x02, 0x10, 0xc8, 0xc7, 0x44, 0x00, 0x10, 0x3a, 0x00, 0x01, 0x05, 
+  0x6e, 0x00, 0x11, 0x3a, 0x6e, 0x00, 0x22, 0xde, 0x08, 0x6e, 0x00, 0x15, 
+  0xaa, 0x30, 0x00, 0x00, 0x2a, 0x00, 0x31, 0x3b, 0xd9, 0x76, 0x6e, 0x00, 
+  0x13, 0x16, 0x6e, 0x00, 0xb5, 0x80, 0x30, 0x28, 0xbf, 0xc2, 0xbf, 0x6c, 
+  0x20, 0x80, 0x00, 0xe5, 0x6c, 0x00, 0x60, 0x3b, 0xd9, 0x6c, 0x71, 0x9e, 
+  0x08, 0x6c, 0x00, 0x15, 0x6e, 0x3c, 0x00, 0x11, 0x77, 0x6c, 0x00, 0x00, 
+  0x42, 0x02, 0x24, 0xde, 0x0e, 0x68, 0x00, 0x11, 0x38, 0x68, 0x00, 0x13, 
+  0x76, 0x68, 0x00, 0x19, 0x42, 0x68, 0x00, 0x31, 0x39, 0xd9, 0x74, 0x68, 
+  0x00, 0x11, 0xae, 0x2e, 0x00, 0x0f, 0x68, 0x00, 0x03, 0x51, 0x39, 0xd9, 
+  0x6c, 0x71, 0x36, 0x68, 0x00, 0x15, 0x06, 0x3c, 0x00, 0x11, 0x75, 0x68, 
+  0x00, 0x03, 0x18, 0x02, 0xf0, 0x00, 0x80, 0x48, 0x47, 0x61, 0x09, 0xb0, 
+  0x00, 0x40, 0x20, 0x0d, 0x07, 0xa5, 0x09, 0x70, 0x00, 0x58, 0x00, 0x31, 
+  0x34, 0x70, 0x82, 0xae, 0x02, 0x55, 0x74, 0xd9, 0x6c, 0x72, 0x52, 0x8a, 
+  0x00, 0x11, 0x74, 0x8a, 0x00, 0x40, 0xea, 0x0f, 0xe0, 0x02, 0x8a, 0x00, 
+  0x28, 0xb6, 0x0b, 0x8a, 0x00, 0x31, 0x77, 0xd9, 0xb0, 0x8a, 0x00, 0x17, 
+  0x26, 0x8a, 0x00, 0xa0, 0xc1, 0xbf, 0x6c, 0x20, 0x40, 0x00, 0xe5, 0x78, 
+  0x4c, 0xf0, 0x22, 0x00, 0x55, 0x76, 0xd9, 0x6c, 0x72, 0x06, 0x4c, 0x00, 
+  0x11, 0x76, 0x4c, 0x00, 0x13, 0x9e, 0x4c, 0x00, 0x1b, 0x6a, 0x4c, 0x00, 
+  0x11, 0xb2, 0x4c, 0x00, 0x24, 0xda, 0x0d, 0x4c, 0x00, 0xf1, 0x02, 0x24, 
+  0xbf, 0x44, 0x27, 0x01, 0x1c, 0x46, 0x20, 0x00, 0x0c, 0x25, 0xf0, 0x75, 
+  0xd9, 0x6c, 0x72, 0xbe, 0x1a, 0x00, 0x00, 0x48, 0x00, 0x11, 0x75, 0x48, 
+  0x00, 0x13, 0x56, 0x48, 0x00, 0x1b, 0x22, 0x48, 0x00, 0x11, 0xb1, 0x48, 
+  0x00, 0x15, 0x92, 0x48, 0x00, 0x10, 0x26, 0x48, 0x00, 0x56, 0x13, 0x46, 
+  0x20, 0x00, 0x03, 0xf4, 0x01, 0xc4, 0x77, 0xd9, 0x6c, 0x71, 0x16, 0x0f, 
+  0xe0, 0x02, 0xa1, 0x40, 0xe6, 0x0a, 0x3e, 0x00, 0x40, 0xb3, 0x1e, 0x02, 
+  0x10, 0x8c, 0x02, 0x04, 0xd0, 0x02, 0x42, 0x0f, 0x07, 0x28, 0x46, 0x52, 
+  0x00, 0x40, 0x6c, 0x72, 0xe1, 0x40, 0x00, 0x03, 0xfa, 0x07, 0x3e, 0x0d, 
+  0x60, 0x02, 0x01, 0x1c, 0x03, 0x30, 0x03, 0x14, 0x81, 0x30, 0x16, 0x6e, 
+  0x84, 0x20, 0x01, 0x00, 0x84, 0x21, 0xc2, 0x0f, 0x56, 0x00, 0xfe, 0x01, 
+  0xc2, 0x0e, 0xe0, 0x02, 0xe1, 0x40, 0x0e, 0x85, 0x8e, 0x0a, 0xef, 0xec, 
+  0x48, 0x30, 0xc0, 0x02, 0x20, 0x03, 0x71, 0x6b, 0xd9, 0x6c, 0x72, 0xf2, 
+  0x0c, 0x60, 0x20, 0x03, 0xa0, 0x81, 0x30, 0x79, 0x27, 0x02, 0x10, 0x14, 
+  0x6a, 0xa4, 0xb9, 0x28, 0x03, 0xd1, 0x05, 0x79, 0xa1, 0x40, 0x80, 0x20, 
+  0x46, 0x0a, 0x40, 0xa8, 0x03, 0x1c, 0x42, 0x2a, 0x03, 0x13, 0x6b, 0x2a, 
+  0x03, 0x33, 0xa6, 0x0e, 0xe0, 0x50, 0x03, 0x20, 0xa7, 0x1d, 0xa6, 0x00, 
+  0x10, 0xea, 0x54, 0x00, 0xf1, 0x0d, 0x81, 0x28, 0x46, 0x08, 0x47, 0x89, 
+  0x08, 0x73, 0x04, 0x40, 0x21, 0x11, 0x07, 0xf5, 0x72, 0x38, 0x01, 0x26, 
+  0x00, 0x56, 0x25, 0x40, 0x1d, 0x00, 0x88, 0x14, 0x70, 0x36, 0xca, 0x01, 
+  0x00, 0x66, 0x04, 0x51, 0x8a, 0x0c, 0x60, 0x02, 0x22, 0x3a, 0x00, 0xc0, 
+  0xb1, 0x15, 0x02, 0x16, 0x50, 0x20, 0x41, 0x00, 0x11, 0x0a, 0xb5, 0x00, 
+  0x60, 0x00, 0x40, 0x46, 0x20, 0x81, 0x02, 0x08, 0x00, 0xb1, 0x6e, 0x85, 
+  0x2f, 0x7a, 0x7d, 0xd9, 0x6e, 0x0b, 0xe0, 0x00, 0xc1, 0xcc, 0x04, 0x00, 
+  0xc0, 0x03, 0x13, 0x52, 0x36, 0x00, 0x40, 0x82, 0x30, 0x6e, 0x85, 0x78, 
+  0x04, 0x44, 0xc1, 0x40, 0x4e, 0x0b, 0x78, 0x04, 0x20, 0x7a, 0x09, 0x78, 
+  0x04, 0xf0, 0x0b, 0xb9, 0x16, 0x80, 0x10, 0xc6, 0xb8, 0xb9, 0x1e, 0x02, 
+  0x10, 0x6d, 0x02, 0x00, 0x00, 0x91, 0xe7, 0x9c, 0xf2, 0x8c, 0x27, 0x02, 
+  0x90, 0xcc, 0x27, 0x82, 0x9f, 0xd0, 0x05, 0xa1, 0x64, 0x02, 0x22, 0x00, 
+  0x8a, 0x20, 0x86, 0x0a, 0x09, 0x65, 0x5a, 0x02, 0xb4, 0x71, 0x30, 0x40, 
+  0xb6, 0xf4, 0x42, 0xd9, 0x6c, 0x72, 0xfa, 0x0b, 0x8e, 0x00, 0x00, 0xf0, 
+  0x00, 0x00, 0xe2, 0x00, 0x31, 0x85, 0x20, 0x03, 0x18, 0x04, 0x13, 0x42, 
+  0xea, 0x00, 0x42, 0xbe, 0x0d, 0xe0, 0x02, 0x54, 0x05, 0x00, 0xbe, 0x00, 
+  0x15, 0xca, 0x30, 0x00, 0xc0, 0x90, 0x15, 0x01, 0x17, 0x91, 0x15, 0x03, 
+  0x17, 0x92, 0x15, 0x02, 0x17, 0x3c, 0x00, 0xf4, 0x01, 0x45, 0x20, 0x80, 
+  0x02, 0xa3, 0x1d, 0x5c, 0x10, 0xa4, 0x1d, 0xdc, 0x10, 0xa5, 0x1d, 0x9c, 
+  0x10, 0x5c, 0x04, 0x13, 0x7d, 0x48, 0x00, 0x15, 0x76, 0x48, 0x00, 0x00, 
+  0xd0, 0x00, 0x13, 0x82, 0x48, 0x00, 0x02, 0xd0, 0x00, 0x62, 0xa0, 0xba, 
+  0xc1, 0x40, 0x7e, 0x0a, 0xd0, 0x00, 0xf0, 0x15, 0xd8, 0xf0, 0x90, 0xe7, 
+  0xdc, 0xf4, 0x56, 0x09, 0xef, 0xff, 0xc1, 0x40, 0x61, 0x1d, 0x59, 0x10, 
+  0xb9, 0x16, 0x82, 0x10, 0x6c, 0x70, 0x8c, 0x70, 0xc6, 0xba, 0xb9, 0x1e, 
+  0x82, 0x10, 0x4c, 0x70, 0x00, 0x41, 0xa6, 0x0b, 0xac, 0x01, 0xf0, 0x09, 
+  0xe0, 0x85, 0x0d, 0xef, 0x2d, 0x87, 0x60, 0x79, 0xe1, 0x40, 0x56, 0x87, 
+  0xa4, 0x17, 0x00, 0x11, 0x60, 0x7a, 0xe1, 0x41, 0x4e, 0x87, 0x0c, 0x71, 
+  0x08, 0x00, 0xe0, 0x2d, 0x86, 0x23, 0xd8, 0x0d, 0xa5, 0x60, 0x79, 0xc1, 
+  0x40, 0x56, 0x86, 0xa4, 0x16, 0x1c, 0x00, 0x24, 0xc1, 0x41, 0xc2, 0x00, 
+  0x17, 0x0a, 0x7a, 0x00, 0x73, 0x7d, 0xd9, 0xa1, 0xba, 0xc1, 0x40, 0x02, 
+  0x7a, 0x00, 0xf0, 0x21, 0x10, 0xdd, 0xa2, 0xf0, 0x61, 0x15, 0x0f, 0x16, 
+  0x8c, 0x27, 0xc3, 0x9f, 0x04, 0xf2, 0xff, 0xd8, 0xc1, 0x41, 0x8b, 0xff, 
+  0xc1, 0x40, 0xb6, 0x0d, 0x6f, 0xff, 0x8a, 0x20, 0x06, 0x2b, 0x32, 0x25, 
+  0x01, 0x14, 0x10, 0x40, 0x85, 0xe9, 0x2c, 0x71, 0x72, 0x09, 0x2f, 0xfe, 
+  0xc1, 0x40, 0x66, 0x0d, 0x06, 0x00, 0xf0, 0x05, 0xdb, 0x15, 0x44, 0x17, 
+  0xda, 0x15, 0x43, 0x17, 0xd9, 0x15, 0x42, 0x17, 0xc1, 0x40, 0xf6, 0x0a, 
+  0x60, 0x02, 0x02, 0x41, 0x40, 0x00, 0xc0, 0x11, 0xdd, 0x7c, 0xf2, 0xe1, 
+  0x40, 0xc1, 0x41, 0x7a, 0xff, 0x78, 0xf0, 0xf0, 0x00, 0x20, 0x92, 0x0a, 
+  0x76, 0x00, 0x44, 0x41, 0x08, 0xb1, 0x20, 0x6c, 0x01, 0x11, 0x80, 0x18, 
+  0x07, 0x08, 0x7e, 0x05, 0x24, 0x52, 0x0c, 0x22, 0x01, 0x00, 0x9a, 0x01, 
+  0x11, 0x62, 0x32, 0x00, 0x04, 0x2e, 0x00, 0x40, 0xc5, 0xb8, 0x1d, 0xf0, 
+  0x08, 0x00, 0x1d, 0xa0, 0x36, 0x00, 0x19, 0x1e, 0x36, 0x00, 0x1b, 0x2a, 
+  0x36, 0x00, 0x15, 0x87, 0x30, 0x00, 0x04, 0xd0, 0x01, 0x28, 0xee, 0x0b, 
+  0xd0, 0x01, 0x24, 0xfa, 0x09, 0x30, 0x00, 0x9f, 0x93, 0x15, 0x01, 0x17, 
+  0x94, 0x15, 0x03, 0x17, 0x95, 0xd0, 0x01, 0x14, 0x11, 0xa6, 0x48, 0x00, 
+  0xf1, 0x1c, 0x0c, 0x70, 0xc1, 0x41, 0xb6, 0x0c, 0x60, 0x02, 0x61, 0x1d, 
+  0xd8, 0x13, 0x61, 0x15, 0x0d, 0x16, 0xa1, 0x40, 0xca, 0xc7, 0xf8, 0x1c, 
+  0xc8, 0xb7, 0x5f, 0x80, 0xc2, 0xb9, 0x07, 0x1c, 0x42, 0x30, 0x1c, 0xe0, 
+  0x38, 0x12, 0x06, 0x00, 0x40, 0x24, 0xc2, 0x31, 0x43, 0x38, 0x00, 0xd1, 
+  0x6e, 0x0b, 0xe0, 0x02, 0xac, 0x70, 0x08, 0x14, 0x1f, 0x34, 0xe0, 0x7e, 
+  0xec, 0x34, 0x03, 0xf2, 0x47, 0x4a, 0x24, 0x40, 0x71, 0xcb, 0x46, 0xa1, 
+  0x00, 0xd8, 0x41, 0x30, 0x41, 0x40, 0x21, 0x12, 0x07, 0x2c, 0x70, 0x0a, 
+  0x22, 0x80, 0x03, 0xa8, 0x20, 0x80, 0x02, 0x04, 0x12, 0x03, 0x05, 0x48, 
+  0x33, 0x03, 0x00, 0x04, 0x33, 0x00, 0x80, 0x43, 0xf6, 0x24, 0x71, 0x2c, 
+  0x75, 0x35, 0x7e, 0x0b, 0x69, 0x27, 0x08, 0xf5, 0x00, 0xe2, 0x8e, 0xb1, 
+  0x40, 0x80, 0x20, 0x86, 0x2a, 0x00, 0x10, 0x80, 0x20, 0x17, 0x08, 0xb1, 
+  0x00, 0xff, 0xd8, 0x22, 0x41, 0x82, 0x0c, 0xef, 0xff, 0x00, 0x18, 0x03, 
+  0x20, 0x00, 0x18, 0x83, 0x20, 0x00, 0x96, 0x10, 0x01, 0xd3, 0x48, 0x30, 
+  0x00, 0x00, 0x64, 0x1d, 0x18, 0x10, 0x6c, 0x72, 0x12, 0x09, 0x60, 0xdc, 
+  0x07, 0x00, 0xdc, 0x00, 0x88, 0xc3, 0xbf, 0x6c, 0x20, 0xc0, 0x00, 0xe5, 
+  0x78, 0x1c, 0x01, 0xf4, 0x01, 0xc3, 0x44, 0x14, 0x00, 0x88, 0x43, 0x42, 
+  0x40, 0xce, 0x0a, 0xe0, 0x02, 0x0a, 0x25, 0x40, 0x04, 0x6c, 0x07, 0x22, 
+  0xda, 0x08, 0x3a, 0x00, 0xf0, 0x74, 0x81, 0x30, 0x64, 0x15, 0x00, 0x16, 
+  0x80, 0x25, 0x05, 0x11, 0x20, 0xad, 0xcc, 0xc7, 0xe8, 0xc2, 0x04, 0x77, 
+  0x70, 0x40, 0x28, 0x45, 0x88, 0xe0, 0x04, 0x01, 0x2d, 0x00, 0x24, 0xde, 
+  0x7c, 0x10, 0x0f, 0x20, 0x25, 0x20, 0x00, 0x00, 0x09, 0xf0, 0x3c, 0xf0, 
+  0x50, 0xf0, 0x5a, 0xf0, 0x66, 0xf0, 0x3d, 0xf0, 0x74, 0xf0, 0x41, 0xf0, 
+  0x43, 0xf0, 0x01, 0x8d, 0x60, 0x8d, 0x08, 0xb8, 0x05, 0x7b, 0xd9, 0x1f, 
+  0xdc, 0x10, 0x23, 0x8d, 0x02, 0x8d, 0x6e, 0x7c, 0x08, 0xb9, 0x05, 0x79, 
+  0xda, 0x1f, 0x5c, 0x10, 0x05, 0x8d, 0x44, 0x8d, 0x2e, 0x79, 0x08, 0xb8, 
+  0x45, 0x78, 0xdb, 0x1f, 0x1c, 0x10, 0x0e, 0x7a, 0xb6, 0x0b, 0x60, 0x02, 
+  0x81, 0x40, 0xb5, 0x08, 0x31, 0x00, 0x2c, 0x70, 0x02, 0x40, 0xee, 0x09, 
+  0xef, 0xff, 0x81, 0x42, 0xda, 0x17, 0x42, 0x17, 0x2c, 0x71, 0xe2, 0x09, 
+  0xef, 0xff, 0x02, 0x40, 0xdb, 0x0c, 0x00, 0x21, 0x72, 0xd6, 0x0c, 0x00, 
+  0x40, 0x2c, 0x71, 0xee, 0x0a, 0x08, 0x00, 0xf1, 0x54, 0xde, 0x0a, 0x2f, 
+  0xfe, 0x02, 0x40, 0x20, 0xf0, 0xa1, 0x40, 0x82, 0x08, 0x20, 0x00, 0x02, 
+  0x41, 0x1a, 0xf0, 0x00, 0x8d, 0x80, 0x27, 0x07, 0x13, 0xcd, 0x70, 0xc0, 
+  0xb8, 0x29, 0xf0, 0x4e, 0x0e, 0xa0, 0x00, 0x02, 0x40, 0x06, 0xf0, 0xa1, 
+  0x40, 0x40, 0x41, 0xb6, 0x09, 0x6f, 0xff, 0x02, 0x42, 0x08, 0x46, 0x2a, 
+  0xf0, 0x00, 0x8d, 0x44, 0x20, 0x41, 0x00, 0x02, 0x40, 0xda, 0x0f, 0xaf, 
+  0xff, 0xd6, 0x1f, 0x42, 0x10, 0xcd, 0x70, 0x20, 0xf0, 0x2c, 0x70, 0x9e, 
+  0x0e, 0xef, 0xfd, 0x02, 0x40, 0x00, 0x8d, 0x11, 0xe8, 0x29, 0x08, 0x71, 
+  0x00, 0x23, 0xde, 0xbe, 0x0f, 0x2f, 0xff, 0x02, 0x40, 0x08, 0x46, 0x0e, 
+  0x52, 0x00, 0xf1, 0x08, 0x86, 0x1a, 0xcd, 0x70, 0xc1, 0xb8, 0x00, 0xaf, 
+  0x0a, 0xf0, 0xa1, 0x40, 0x02, 0x41, 0xca, 0x08, 0x6f, 0xff, 0xcd, 0x70, 
+  0x2c, 0x71, 0x6a, 0x34, 0x00, 0x80, 0xc1, 0x40, 0xc8, 0xc6, 0xe4, 0xc2, 
+  0x00, 0x88, 0x00, 0x05, 0x40, 0x44, 0x20, 0x41, 0x80, 0xf4, 0x04, 0xf0, 
+  0x03, 0x20, 0xa8, 0x19, 0xf4, 0x8a, 0x20, 0x46, 0x0a, 0x08, 0x65, 0x1d, 
+  0x08, 0x71, 0x00, 0x2c, 0x70, 0x8e, 0x0a, 0xd0, 0x03, 0xb0, 0xd6, 0x15, 
+  0x80, 0x10, 0x86, 0xe8, 0x2c, 0x70, 0x62, 0x0f, 0xaf, 0xde, 0x03, 0xf0, 
+  0x08, 0x15, 0x00, 0x16, 0x1b, 0xe8, 0x3f, 0x08, 0x71, 0x00, 0x0c, 0x71, 
+  0x18, 0xf0, 0x2c, 0x70, 0x1a, 0x0e, 0xef, 0xfd, 0xc1, 0x40, 0x1f, 0x86, 
+  0x72, 0x05, 0x71, 0x00, 0x88, 0x8a, 0xe8, 0x2c, 0x71, 0x3a, 0x28, 0x00, 
+  0x31, 0x2c, 0x71, 0x52, 0x3e, 0x00, 0x40, 0x2c, 0x71, 0xfa, 0x0d, 0x22, 
+  0x00, 0x50, 0x05, 0xf0, 0x0c, 0x70, 0x92, 0x12, 0x00, 0xf0, 0x14, 0x41, 
+  0x0c, 0x70, 0xc4, 0xc6, 0xe0, 0x78, 0x5f, 0x81, 0x20, 0x45, 0x6c, 0x72, 
+  0x76, 0x1a, 0x18, 0x00, 0x80, 0x22, 0xc3, 0x05, 0x3c, 0x49, 0xc3, 0x44, 
+  0x13, 0x00, 0x80, 0xdd, 0x39, 0x07, 0x20, 0x02, 0x1c, 0xd9, 0x1c, 0x00, 
+  0x31, 0x16, 0xdb, 0x5d, 0x1c, 0x00, 0x20, 0x42, 0x0f, 0x1c, 0x00, 0xf1, 
+  0x80, 0x14, 0x00, 0xf8, 0x08, 0x1d, 0x07, 0x20, 0x02, 0x2c, 0x73, 0xf8, 
+  0xc3, 0xa3, 0xc1, 0x30, 0x41, 0x03, 0xe8, 0xd8, 0xc7, 0x7c, 0x11, 0x10, 
+  0x20, 0xb9, 0x11, 0xc0, 0x20, 0x2c, 0x10, 0x15, 0x20, 0x08, 0x10, 0x18, 
+  0x20, 0x04, 0x10, 0x14, 0x20, 0x14, 0x70, 0x44, 0xf6, 0xbe, 0x10, 0xc0, 
+  0x20, 0x14, 0x70, 0x5c, 0x01, 0x2a, 0x00, 0x55, 0x20, 0x8e, 0x2f, 0xda, 
+  0x0c, 0x4f, 0xed, 0x10, 0x43, 0xd4, 0x16, 0xc0, 0x90, 0x30, 0x42, 0xd0, 
+  0x16, 0xc1, 0x90, 0xcb, 0x10, 0x88, 0x20, 0xc7, 0x10, 0x8b, 0x20, 0xca, 
+  0x10, 0xc3, 0x20, 0x08, 0xb8, 0xc9, 0x10, 0x8c, 0x20, 0xc3, 0x42, 0x13, 
+  0x00, 0x34, 0x5e, 0x08, 0xb9, 0x05, 0x20, 0x00, 0x02, 0x05, 0x21, 0xc1, 
+  0x02, 0x48, 0x30, 0x8b, 0x00, 0x02, 0x82, 0x08, 0xbb, 0x85, 0x7b, 0x48, 
+  0x31, 0x8c, 0x00, 0x25, 0x82, 0x00, 0x30, 0x00, 0x03, 0x48, 0x33, 0x83, 
+  0x00, 0x01, 0x30, 0xc6, 0x00, 0x04, 0x82, 0x00, 0x31, 0xc9, 0x00, 0x20, 
+  0x14, 0x00, 0xf1, 0x6a, 0xcb, 0x45, 0xa1, 0x00, 0x30, 0x1e, 0x00, 0x31, 
+  0xc1, 0x00, 0x01, 0x30, 0x43, 0x02, 0x01, 0x82, 0x01, 0x31, 0x08, 0x03, 
+  0x23, 0x82, 0x00, 0x30, 0xc0, 0x02, 0x10, 0x15, 0x16, 0x10, 0x00, 0x31, 
+  0xc1, 0x02, 0x01, 0x30, 0x00, 0x10, 0x14, 0x15, 0x17, 0x10, 0x01, 0x36, 
+  0x42, 0x00, 0x01, 0x33, 0xc1, 0x02, 0xfc, 0x86, 0x40, 0xc0, 0x02, 0x23, 
+  0x80, 0xa5, 0x42, 0xc1, 0x03, 0x22, 0xc1, 0xa5, 0xf6, 0x0d, 0xaf, 0xe1, 
+  0x41, 0xc2, 0x07, 0x30, 0x80, 0x0f, 0x7a, 0x47, 0x00, 0x00, 0x07, 0x36, 
+  0x02, 0x70, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x37, 0x80, 0x1f, 0x8c, 0x3f, 
+  0xcd, 0xcc, 0x04, 0x32, 0x00, 0x80, 0x90, 0x00, 0x26, 0x00, 0x3d, 0x26, 
+  0xc1, 0x24, 0x3d, 0x27, 0x80, 0x24, 0x0c, 0x22, 0xc0, 0xa5, 0xca, 0x20, 
+  0x41, 0x00, 0x7d, 0x08, 0x11, 0x24, 0x00, 0x40, 0x66, 0x3f, 0x66, 0x66, 
+  0x24, 0x00, 0xf0, 0x4d, 0x6c, 0x00, 0x2c, 0x00, 0x4a, 0x24, 0xc0, 0x70, 
+  0x4a, 0x24, 0x00, 0x10, 0xa8, 0x20, 0x40, 0x08, 0x15, 0x20, 0x00, 0x23, 
+  0x80, 0xc1, 0x55, 0x20, 0x43, 0x0f, 0x95, 0x79, 0x40, 0x83, 0x00, 0x81, 
+  0x01, 0x30, 0x82, 0x00, 0xc3, 0x40, 0x00, 0x00, 0xff, 0x7f, 0x40, 0xa1, 
+  0x48, 0x32, 0xc1, 0x02, 0x48, 0x31, 0x8b, 0x00, 0x02, 0x32, 0xc2, 0x02, 
+  0x13, 0x08, 0x62, 0x00, 0x40, 0xa3, 0xc3, 0x40, 0xff, 0xff, 0x00, 0x80, 
+  0x10, 0x71, 0xca, 0x20, 0x4a, 0x00, 0x85, 0x71, 0x19, 0xa3, 0x20, 0x8d, 
+  0x0b, 0xe9, 0x04, 0x8d, 0x0d, 0x09, 0x01, 0x00, 0x3f, 0x86, 0x60, 0x79, 
+  0x2a, 0x04, 0x62, 0x04, 0x71, 0x04, 0xad, 0x04, 0xf0, 0x0e, 0x00, 0xf1, 
+  0x3a, 0x10, 0x1d, 0xc0, 0x14, 0x14, 0x1d, 0x80, 0x14, 0x53, 0x0c, 0x30, 
+  0x20, 0x55, 0x21, 0x8d, 0x28, 0xb9, 0x14, 0xc0, 0x20, 0x47, 0x08, 0x13, 
+  0x00, 0xbe, 0x10, 0x80, 0x20, 0x3f, 0x08, 0xbe, 0x01, 0x82, 0x42, 0x21, 
+  0x85, 0x46, 0x08, 0x60, 0x02, 0x00, 0x85, 0x33, 0x0d, 0x10, 0x20, 0xb9, 
+  0x15, 0xc0, 0x20, 0x2b, 0x08, 0x13, 0x00, 0xe5, 0x10, 0x81, 0x20, 0x11, 
+  0xe9, 0xe6, 0x10, 0x80, 0x20, 0x15, 0x09, 0x21, 0x00, 0xa2, 0x42, 0x21, 
+  0x85, 0x22, 0x24, 0x00, 0xf0, 0x0b, 0x0c, 0x70, 0xe6, 0x18, 0x03, 0x20, 
+  0x04, 0x71, 0xe6, 0x18, 0x02, 0x20, 0x17, 0x70, 0x18, 0xf3, 0xb9, 0x10, 
+  0xc0, 0x30, 0x14, 0x70, 0x28, 0x06, 0xca, 0xff, 0x50, 0x00, 0xf0, 0x17, 
+  0xe5, 0xb8, 0x10, 0xf3, 0x21, 0x85, 0x00, 0x85, 0xf6, 0x0f, 0x20, 0x02, 
+  0x03, 0x42, 0xd8, 0xc7, 0xe8, 0xc3, 0xa1, 0xc1, 0x08, 0x45, 0xb6, 0xd8, 
+  0x02, 0x1c, 0x04, 0x30, 0xfe, 0x09, 0x2f, 0xff, 0xa1, 0x40, 0x40, 0x25, 
+  0x0f, 0x17, 0xf0, 0x03, 0xf2, 0x02, 0x7e, 0xd9, 0x6c, 0x71, 0x92, 0x0e, 
+  0xa0, 0x02, 0xe1, 0x40, 0x5e, 0x0a, 0xaf, 0xec, 0x0c, 0x72, 0xe2, 0x1e, 
+  0x00, 0xf0, 0x04, 0x24, 0x82, 0x30, 0x2c, 0x70, 0x6c, 0x72, 0xce, 0x0c, 
+  0x20, 0x02, 0xe1, 0x40, 0xe1, 0x08, 0x31, 0x00, 0x22, 0xde, 0x4a, 0x04, 
+  0xe0, 0xd5, 0x08, 0xb1, 0x0a, 0x21, 0xde, 0xd6, 0x08, 0x20, 0x00, 0xa1, 
+  0x40, 0xd3, 0x40, 0x72, 0x01, 0x53, 0x40, 0x24, 0x42, 0x30, 0x53, 0x20, 
+  0x05, 0xf0, 0x01, 0xe1, 0x40, 0x0a, 0x26, 0x00, 0x04, 0x01, 0x1c, 0x83, 
+  0x32, 0x7a, 0x0e, 0xa0, 0x02, 0xcd, 0x70, 0x1c, 0x00, 0x19, 0x55, 0x1c, 
+  0x00, 0x80, 0x62, 0x0e, 0xa0, 0x02, 0x01, 0x1c, 0x82, 0x33, 0x1a, 0x00, 
+  0x19, 0x56, 0x1a, 0x00, 0x17, 0x4a, 0x1a, 0x00, 0x19, 0x54, 0x1a, 0x00, 
+  0x11, 0x2e, 0x1a, 0x00, 0xf0, 0x01, 0x83, 0x32, 0x2c, 0x70, 0x0a, 0x0c, 
+  0x6f, 0xfe, 0xa1, 0x40, 0x10, 0x40, 0x2c, 0x71, 0xfe, 0x0b, 0x0a, 0x00, 
+  0x51, 0x08, 0x47, 0x2c, 0x72, 0xf6, 0x0a, 0x00, 0xf0, 0x21, 0x00, 0x41, 
+  0xff, 0xda, 0x80, 0x21, 0x3e, 0x00, 0x08, 0xba, 0x30, 0x79, 0x29, 0x09, 
+  0xa4, 0x00, 0x8a, 0x21, 0x3e, 0x00, 0x3b, 0x67, 0x70, 0x7b, 0x1d, 0x0b, 
+  0xa4, 0x00, 0x02, 0x71, 0x30, 0x79, 0x15, 0x09, 0xa4, 0x00, 0x05, 0x27, 
+  0x0f, 0x14, 0x05, 0x27, 0x3e, 0x90, 0x04, 0xf2, 0xc2, 0x08, 0xe4, 0x00, 
+  0xd0, 0x4e, 0x85, 0x0c, 0x70, 0x60, 0x7a, 0xa1, 0x41, 0xc1, 0x40, 0xc8, 
+  0xc7, 0xea, 0x20, 0x01, 0x30, 0x46, 0x1f, 0x80, 0x96, 0x02, 0xf4, 0x1f, 
+  0x90, 0x21, 0x6c, 0x70, 0x08, 0xd9, 0x40, 0x25, 0x0c, 0x16, 0x8d, 0xbb, 
+  0x24, 0xda, 0x8c, 0xb9, 0xc2, 0x18, 0x58, 0x03, 0xc1, 0x18, 0x18, 0x03, 
+  0x80, 0x20, 0x8c, 0x0f, 0x40, 0x26, 0x0f, 0x17, 0x60, 0xb0, 0xa2, 0x18, 
+  0x82, 0x80, 0xc0, 0x18, 0xc3, 0x81, 0xbe, 0x18, 0x44, 0x80, 0xde, 0x07, 
+  0x20, 0xa6, 0x0b, 0x2a, 0x01, 0x00, 0x24, 0x01, 0x02, 0xaa, 0x06, 0x02, 
+  0xb6, 0x06, 0x40, 0x6c, 0x71, 0x36, 0x0d, 0x5c, 0x01, 0xc0, 0x10, 0x40, 
+  0x02, 0x09, 0xaf, 0xec, 0x0c, 0x71, 0xab, 0x08, 0x31, 0x20, 0x32, 0x00, 
+  0x59, 0x59, 0xd9, 0x6c, 0x72, 0x72, 0x32, 0x00, 0x15, 0x59, 0x32, 0x00, 
+  0x11, 0x02, 0x32, 0x00, 0xf0, 0x05, 0x83, 0x08, 0x31, 0x00, 0x54, 0x25, 
+  0x10, 0x19, 0xad, 0x70, 0x8a, 0x21, 0x02, 0x20, 0xb0, 0x7a, 0xc1, 0x40, 
+  0xe2, 0x0e, 0x6a, 0x07, 0xf4, 0x0b, 0x1b, 0x09, 0x85, 0x2f, 0x00, 0x00, 
+  0x00, 0x20, 0x55, 0x21, 0x11, 0x28, 0x55, 0x20, 0x10, 0x28, 0x55, 0x25, 
+  0x0d, 0x18, 0x72, 0xe8, 0x29, 0xf0, 0xa9, 0xe8, 0x58, 0x00, 0x1b, 0x1a, 
+  0x58, 0x00, 0x02, 0x76, 0x07, 0x40, 0x6c, 0x71, 0xaa, 0x0c, 0x58, 0x00, 
+  0x20, 0x14, 0xdd, 0x28, 0x00, 0x64, 0x21, 0xd9, 0x6c, 0x72, 0xf2, 0x0a, 
+  0x28, 0x00, 0xf1, 0x2f, 0x17, 0x08, 0x70, 0x00, 0x7f, 0xd8, 0x26, 0x08, 
+  0xaf, 0xec, 0x17, 0xb8, 0xa5, 0x77, 0x2f, 0x26, 0x47, 0xf3, 0xee, 0xf5, 
+  0xca, 0xc7, 0x78, 0x88, 0x0c, 0x70, 0x0a, 0x21, 0x80, 0x0f, 0xa1, 0x00, 
+  0x6c, 0x21, 0x01, 0x11, 0x82, 0x04, 0x0b, 0x0b, 0xa0, 0x00, 0x14, 0x76, 
+  0x04, 0x71, 0xba, 0xf7, 0xe0, 0x7f, 0x38, 0x23, 0x80, 0x00, 0xea, 0xc2, 
+  0x08, 0x45, 0xcd, 0x70, 0xcb, 0x47, 0x20, 0x00, 0xf0, 0x3a, 0x17, 0x90, 
+  0x14, 0x18, 0x8d, 0x33, 0x08, 0x00, 0x04, 0x06, 0x0e, 0x0f, 0xed, 0x76, 
+  0x0c, 0x2f, 0xed, 0x10, 0x41, 0x00, 0x42, 0x02, 0x40, 0xee, 0x0d, 0x2f, 
+  0xed, 0x22, 0x41, 0x0d, 0xe8, 0x2f, 0x80, 0x40, 0x79, 0x00, 0x41, 0x8c, 
+  0x20, 0x02, 0x80, 0x0c, 0x71, 0xcc, 0x21, 0x82, 0x8f, 0x00, 0x00, 0xff, 
+  0x00, 0x05, 0xf2, 0xc5, 0x71, 0xc9, 0x0e, 0xd4, 0x91, 0x0c, 0x70, 0xca, 
+  0xc6, 0xe4, 0xc3, 0xa1, 0xc1, 0x40, 0x20, 0x0e, 0x07, 0x08, 0x45, 0x9e, 
+  0x00, 0x95, 0x57, 0xd9, 0x6c, 0x72, 0x56, 0x0a, 0x20, 0x02, 0xc1, 0xc6, 
+  0x00, 0x33, 0x57, 0xd9, 0xa5, 0xc6, 0x00, 0x00, 0x18, 0x02, 0x20, 0xc3, 
+  0x46, 0x7a, 0x02, 0xfe, 0x05, 0x16, 0x0c, 0xa0, 0x02, 0xc1, 0x40, 0xb9, 
+  0x15, 0x81, 0x10, 0x0c, 0x70, 0xc6, 0xb9, 0xb9, 0x1d, 0x42, 0x10, 0xc4, 
+  0xc7, 0x48, 0x00, 0x1b, 0x0e, 0x48, 0x00, 0x1d, 0x85, 0x48, 0x00, 0x26, 
+  0xce, 0x0b, 0x48, 0x00, 0x13, 0x87, 0x48, 0x00, 0xf0, 0x03, 0xe0, 0x7f, 
+  0xa6, 0x10, 0x00, 0x01, 0xe0, 0x78, 0x1f, 0x80, 0xe0, 0x7f, 0x9f, 0x10, 
+  0x00, 0x06, 0xe6, 0xc2, 0xea, 0x05, 0xf0, 0x6b, 0xce, 0x0f, 0x2f, 0xed, 
+  0x08, 0x47, 0xa1, 0x1d, 0x18, 0x10, 0xc1, 0x40, 0x60, 0x7f, 0xa2, 0x1d, 
+  0x58, 0x10, 0xc6, 0xc6, 0xe0, 0x78, 0xe0, 0x7f, 0x9c, 0x10, 0x00, 0x00, 
+  0xe0, 0x78, 0xe6, 0xc0, 0x3f, 0x08, 0x51, 0x00, 0xc3, 0x43, 0xa1, 0x00, 
+  0x80, 0x1e, 0x00, 0x8b, 0x00, 0xa9, 0x03, 0x8b, 0x82, 0x8b, 0xc1, 0x8b, 
+  0xb6, 0x68, 0xe4, 0x8b, 0x15, 0x6c, 0xc4, 0xbe, 0x44, 0x20, 0x00, 0x08, 
+  0x84, 0x25, 0x01, 0x10, 0xc5, 0x78, 0x97, 0x6f, 0xa5, 0x78, 0x85, 0x78, 
+  0x01, 0xa9, 0x06, 0x8b, 0x02, 0xa9, 0x07, 0x8b, 0xc2, 0xb8, 0x03, 0xa9, 
+  0x00, 0x1a, 0x05, 0x01, 0x0c, 0x70, 0xc6, 0xc4, 0xe0, 0x78, 0xe2, 0xc2, 
+  0xbf, 0x80, 0x00, 0x41, 0x09, 0xa5, 0x12, 0x08, 0x20, 0x00, 0x0c, 0x70, 
+  0x0c, 0x70, 0x9f, 0x1d, 0x19, 0x10, 0xc2, 0xc6, 0xe0, 0x78, 0xa0, 0x02, 
+  0x00, 0x82, 0x00, 0xe0, 0x35, 0x08, 0xb4, 0x00, 0x10, 0x40, 0x8c, 0x20, 
+  0x02, 0xa0, 0xcc, 0x20, 0x82, 0xaf, 0x46, 0x01, 0xf1, 0x16, 0x54, 0xf4, 
+  0x80, 0xd9, 0xfe, 0x0b, 0xef, 0xfe, 0xc1, 0x40, 0x02, 0x0e, 0xa0, 0x01, 
+  0xc1, 0x40, 0xc3, 0x40, 0x48, 0x41, 0x00, 0x00, 0x82, 0x0a, 0xaf, 0xfe, 
+  0xc1, 0x41, 0x9f, 0x1d, 0x18, 0x14, 0x44, 0xf0, 0x2c, 0x70, 0xde, 0x20, 
+  0x00, 0xf0, 0x11, 0xff, 0x86, 0x3c, 0x4e, 0x80, 0xc2, 0x2f, 0xd9, 0x6c, 
+  0x71, 0x00, 0x1c, 0x83, 0x30, 0x9e, 0x0a, 0xa0, 0x02, 0x10, 0x41, 0x0e, 
+  0x87, 0x6a, 0x0e, 0x6f, 0xec, 0x48, 0x30, 0xc0, 0x02, 0xc3, 0x41, 0xb8, 
+  0x00, 0xf0, 0x45, 0x60, 0x91, 0x03, 0x91, 0x82, 0x89, 0x43, 0x89, 0x60, 
+  0xc3, 0x02, 0x1c, 0x02, 0x30, 0x28, 0xb8, 0x24, 0x89, 0x28, 0xbb, 0x05, 
+  0xbc, 0x06, 0xba, 0x44, 0x20, 0xcf, 0x09, 0xc4, 0xbb, 0x44, 0x24, 0x00, 
+  0x18, 0x84, 0x22, 0x01, 0x00, 0x65, 0x78, 0x07, 0xb9, 0x45, 0x78, 0x25, 
+  0x78, 0x01, 0x1c, 0x02, 0x30, 0x80, 0xc2, 0x30, 0xd9, 0x6c, 0x74, 0x22, 
+  0x40, 0x4e, 0x0a, 0xa0, 0x02, 0x03, 0x1c, 0xc2, 0x33, 0xb9, 0x16, 0x80, 
+  0x10, 0xc1, 0x41, 0xc6, 0xb8, 0xb9, 0x1e, 0x02, 0x10, 0x0c, 0x70, 0xfa, 
+  0x09, 0xaf, 0xfe, 0x86, 0x00, 0xe0, 0x0c, 0x70, 0x86, 0x0b, 0x20, 0x02, 
+  0xc1, 0x41, 0x9f, 0x15, 0x00, 0x16, 0xca, 0xc7, 0xe8, 0x00, 0xf0, 0x02, 
+  0x0c, 0x70, 0xa2, 0x0b, 0x20, 0x02, 0x28, 0x45, 0x9c, 0x15, 0x00, 0x10, 
+  0xc2, 0xc6, 0xe6, 0xc2, 0x4f, 0x82, 0x07, 0xf0, 0x10, 0xd8, 0x49, 0x0a, 
+  0x14, 0x01, 0xe1, 0x89, 0x03, 0x89, 0xc0, 0x89, 0xa2, 0x89, 0x08, 0xbf, 
+  0x08, 0xb8, 0x04, 0x27, 0x8c, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x84, 0x20, 
+  0x1c, 0x00, 0xc3, 0x42, 0xa2, 0x00, 0xf0, 0x17, 0xc5, 0x7c, 0xa5, 0x78, 
+  0x80, 0xb2, 0x03, 0xb2, 0x01, 0x89, 0x25, 0xb8, 0xc0, 0xb8, 0x02, 0xaa, 
+  0x01, 0x89, 0x26, 0xb8, 0xc0, 0xb8, 0x03, 0xaa, 0x01, 0x89, 0x27, 0xb8, 
+  0x04, 0xaa, 0xfe, 0x0c, 0xa0, 0x01, 0x60, 0x40, 0x0c, 0x70, 0x98, 0x01, 
+  0x00, 0x0c, 0x02, 0xa0, 0x45, 0x09, 0x31, 0x01, 0x48, 0x46, 0x40, 0x20, 
+  0x0d, 0x07, 0x10, 0x02, 0xf0, 0x0b, 0x58, 0xd9, 0x6c, 0x72, 0xfe, 0x0f, 
+  0xe0, 0x01, 0xa1, 0x40, 0x03, 0x14, 0x82, 0x30, 0x12, 0x6e, 0x44, 0x20, 
+  0x01, 0x01, 0x50, 0x22, 0x80, 0x00, 0x25, 0x78, 0x14, 0x02, 0x00, 0x20, 
+  0x02, 0x13, 0x58, 0x7a, 0x04, 0x02, 0x1a, 0x02, 0x82, 0xb6, 0x09, 0xa0, 
+  0x02, 0xa1, 0x40, 0xc4, 0xc7, 0x4c, 0x00, 0x0a, 0x58, 0x02, 0x48, 0xb6, 
+  0x0f, 0xe0, 0x01, 0x58, 0x02, 0x1d, 0xa1, 0x58, 0x02, 0x2f, 0x76, 0x09, 
+  0xa0, 0x02, 0x11, 0x1b, 0x6e, 0x48, 0x00, 0x1d, 0x81, 0x48, 0x00, 0x17, 
+  0x2e, 0x48, 0x00, 0x0f, 0xa0, 0x02, 0x01, 0x40, 0x96, 0x10, 0x00, 0x06, 
+  0xf4, 0x07, 0x31, 0x6c, 0x73, 0x95, 0xf4, 0x07, 0x22, 0xc3, 0x06, 0xf4, 
+  0x07, 0x84, 0x78, 0x07, 0x29, 0x07, 0xe0, 0x01, 0x1e, 0xd9, 0xa0, 0x02, 
+  0xf0, 0x07, 0xe8, 0xc3, 0xa6, 0xc1, 0x50, 0x40, 0x28, 0x46, 0x14, 0x71, 
+  0x03, 0x1c, 0x03, 0x30, 0x80, 0xf4, 0x40, 0x23, 0x0d, 0x07, 0x81, 0xc2, 
+  0xbc, 0x04, 0x20, 0xea, 0x0e, 0x14, 0x01, 0x11, 0x05, 0x84, 0x00, 0x00, 
+  0xce, 0x04, 0x00, 0x82, 0x00, 0x20, 0xa0, 0xb8, 0x02, 0x02, 0x08, 0x88, 
+  0x00, 0x20, 0xa6, 0x08, 0x0e, 0x01, 0x00, 0x22, 0x00, 0x00, 0x44, 0x02, 
+  0xf1, 0x02, 0xa1, 0x40, 0x5a, 0x08, 0xa0, 0x02, 0x02, 0x1c, 0xc3, 0x30, 
+  0x81, 0xc2, 0x30, 0xd9, 0x11, 0xdb, 0xa6, 0x44, 0x00, 0xb7, 0x40, 0x24, 
+  0x41, 0x31, 0x10, 0xda, 0xa2, 0x0f, 0x6f, 0xe1, 0xc1, 0x2a, 0x00, 0x11, 
+  0x32, 0x2a, 0x00, 0x22, 0x03, 0x31, 0x2a, 0x00, 0x11, 0x7a, 0x2a, 0x00, 
+  0x20, 0x28, 0x4e, 0x2c, 0x00, 0x66, 0x76, 0x0f, 0x6f, 0xe1, 0x10, 0xda, 
+  0x2a, 0x00, 0x11, 0x06, 0x2a, 0x00, 0x13, 0x43, 0x2a, 0x00, 0x11, 0x52, 
+  0x2a, 0x00, 0x11, 0x48, 0x2a, 0x00, 0x1b, 0x4e, 0x2a, 0x00, 0x71, 0xde, 
+  0x0f, 0x60, 0x02, 0x02, 0x1c, 0x83, 0x2a, 0x00, 0x31, 0x07, 0xdb, 0x26, 
+  0x2a, 0x00, 0x11, 0x68, 0x2a, 0x00, 0x62, 0x22, 0x0f, 0x6f, 0xe1, 0x4c, 
+  0x76, 0x86, 0x05, 0x08, 0xc0, 0x00, 0xf1, 0x1e, 0xe6, 0x0f, 0x60, 0x02, 
+  0xa1, 0x40, 0x36, 0xd8, 0x00, 0x18, 0x04, 0x20, 0x0c, 0x70, 0xc8, 0xc7, 
+  0xf1, 0xc0, 0x00, 0x41, 0x1f, 0x80, 0x7f, 0xdb, 0x4c, 0x70, 0x17, 0xbb, 
+  0x96, 0x18, 0x98, 0x00, 0x24, 0xa0, 0xdc, 0x18, 0x84, 0x00, 0xdb, 0x18, 
+  0x82, 0x00, 0x6e, 0xa0, 0x0e, 0x80, 0x03, 0xf0, 0x02, 0xd1, 0xc0, 0xe0, 
+  0x7f, 0x0c, 0x70, 0xec, 0xc3, 0xa2, 0xc1, 0x7c, 0x11, 0x10, 0x00, 0x28, 
+  0x45, 0xd9, 0x7e, 0x03, 0x72, 0x41, 0x8c, 0x21, 0x02, 0xa0, 0xcc, 0x21, 
+  0x7e, 0x03, 0xc2, 0xbd, 0xf4, 0x80, 0xd9, 0x7e, 0x08, 0xef, 0xfe, 0xa1, 
+  0x40, 0xdf, 0x85, 0x52, 0x07, 0x01, 0x76, 0x00, 0xf0, 0x02, 0x72, 0xe1, 
+  0x40, 0x96, 0x0d, 0xe0, 0x01, 0x07, 0x1c, 0x03, 0x30, 0x21, 0xc0, 0x38, 
+  0x16, 0x06, 0x10, 0xd6, 0x06, 0x11, 0x07, 0x56, 0x01, 0x00, 0x34, 0x03, 
+  0x04, 0x98, 0x00, 0x60, 0x56, 0x0f, 0x60, 0x02, 0xe1, 0x40, 0x1c, 0x00, 
+  0x00, 0xd4, 0x00, 0x50, 0xe1, 0x40, 0x0a, 0x0f, 0x60, 0xea, 0x06, 0x10, 
+  0x31, 0x46, 0x00, 0xf0, 0x0f, 0x32, 0xd9, 0x6c, 0x73, 0x52, 0x0d, 0xe0, 
+  0x01, 0xe1, 0x40, 0x21, 0xc2, 0x05, 0x14, 0x81, 0x30, 0x6c, 0x72, 0x80, 
+  0xba, 0x84, 0xb9, 0x01, 0x1c, 0x82, 0x30, 0x02, 0x1c, 0x42, 0x30, 0x34, 
+  0x00, 0x4a, 0x32, 0xd9, 0xda, 0x0e, 0x40, 0x00, 0x20, 0xca, 0x0e, 0x40, 
+  0x00, 0x82, 0x03, 0x30, 0x96, 0x0a, 0x6f, 0xec, 0x32, 0xd8, 0x78, 0x00, 
+  0x24, 0xc2, 0x31, 0x6e, 0x00, 0x11, 0xe6, 0x2e, 0x00, 0xf4, 0x11, 0xc3, 
+  0x40, 0x48, 0x42, 0x00, 0x00, 0x62, 0x0e, 0x6f, 0xfe, 0xa1, 0x41, 0x96, 
+  0x18, 0x58, 0x24, 0x5d, 0xf0, 0x2c, 0x70, 0xbe, 0x0f, 0xaf, 0xfe, 0xa1, 
+  0x40, 0xff, 0x85, 0xcd, 0x70, 0x3c, 0x4d, 0xc2, 0x00, 0xf7, 0x0a, 0x06, 
+  0x1c, 0x82, 0x33, 0xd2, 0x0c, 0xe0, 0x01, 0x10, 0x42, 0x21, 0xc0, 0x38, 
+  0x17, 0x06, 0x10, 0x81, 0xc2, 0x50, 0x20, 0x01, 0x00, 0x61, 0xc1, 0x06, 
+  0xc0, 0x00, 0x55, 0x96, 0x0e, 0x60, 0x02, 0x42, 0x80, 0x00, 0x31, 0x42, 
+  0x40, 0x4a, 0x80, 0x00, 0x06, 0xc0, 0x00, 0x53, 0x92, 0x0c, 0xe0, 0x01, 
+  0x42, 0x58, 0x02, 0x00, 0xb0, 0x00, 0x12, 0xa4, 0x54, 0x02, 0x41, 0x72, 
+  0x42, 0x40, 0x1e, 0x2a, 0x00, 0x02, 0xee, 0x07, 0x02, 0x3c, 0x00, 0x13, 
+  0x0e, 0x12, 0x00, 0x21, 0xda, 0x09, 0xbc, 0x00, 0x10, 0x17, 0xbc, 0x00, 
+  0x15, 0x82, 0xbc, 0x00, 0x11, 0x2a, 0x6a, 0x00, 0x80, 0x0c, 0x70, 0xa1, 
+  0x41, 0xaa, 0x0d, 0x6f, 0xfe, 0xb8, 0x00, 0x30, 0x0c, 0x70, 0x32, 0xca, 
+  0x03, 0x70, 0x41, 0x96, 0x10, 0x00, 0x26, 0xcc, 0xc7, 0x50, 0x04, 0x44, 
+  0x52, 0x0f, 0xe0, 0x01, 0x50, 0x04, 0x00, 0x68, 0x03, 0xf1, 0x06, 0x28, 
+  0x45, 0x2c, 0x70, 0xd3, 0x08, 0x71, 0x00, 0x01, 0x1c, 0x42, 0x30, 0xcb, 
+  0x0a, 0xb4, 0x0d, 0x23, 0xd9, 0x40, 0x23, 0x0e, 0x08, 0x04, 0x00, 0xe0, 
+  0x00, 0x24, 0xf6, 0x0b, 0x78, 0x03, 0x40, 0x80, 0xc2, 0x7c, 0xd9, 0x96, 
+  0x01, 0x49, 0xa0, 0xb8, 0x60, 0xc0, 0xfe, 0x03, 0x52, 0x0d, 0x60, 0x02, 
+  0xc1, 0x40, 0x32, 0x05, 0xf4, 0x07, 0xc1, 0x40, 0x6e, 0x0d, 0x60, 0x02, 
+  0x00, 0x1c, 0xc3, 0x30, 0x30, 0xd9, 0x10, 0xdb, 0xc1, 0x40, 0x5e, 0x0d, 
+  0x60, 0x02, 0xa1, 0x42, 0x1c, 0x00, 0x11, 0x52, 0x1c, 0x00, 0x60, 0x03, 
+  0x31, 0x40, 0x25, 0x02, 0x14, 0x20, 0x00, 0x19, 0x42, 0x3a, 0x00, 0x11, 
+  0x32, 0x1e, 0x00, 0x10, 0x43, 0x1e, 0x00, 0x10, 0x18, 0x1e, 0x00, 0x19, 
+  0x22, 0x1e, 0x00, 0x11, 0x16, 0x1e, 0x00, 0x10, 0x83, 0x1e, 0x00, 0x61, 
+  0x1c, 0x30, 0xd9, 0x6c, 0x76, 0x06, 0x1e, 0x00, 0x00, 0x18, 0x01, 0x0a, 
+  0xbe, 0x02, 0x11, 0x2a, 0x18, 0x00, 0x3f, 0x2c, 0x70, 0x20, 0x90, 0x04, 
+  0x04, 0x15, 0x26, 0xd0, 0x00, 0x0f, 0x90, 0x04, 0x05, 0x20, 0xe6, 0x0c, 
+  0x42, 0x00, 0x0f, 0x90, 0x04, 0x0d, 0x2f, 0xde, 0x0a, 0x90, 0x04, 0x0d, 
+  0x17, 0x9e, 0x48, 0x00, 0x0f, 0x90, 0x04, 0x01, 0xf4, 0x01, 0x8a, 0x10, 
+  0x00, 0x06, 0x7f, 0x81, 0x00, 0x42, 0x94, 0x1b, 0x18, 0x00, 0x20, 0x40, 
+  0x00, 0x7a, 0x80, 0x04, 0xf0, 0x03, 0xf1, 0xc0, 0x5f, 0x80, 0x00, 0x41, 
+  0x7f, 0xd8, 0x17, 0xb8, 0x0e, 0xa2, 0x0c, 0x70, 0x8a, 0x1a, 0x19, 0x00, 
+  0xe6, 0x06, 0x22, 0x25, 0xa2, 0x66, 0x03, 0x00, 0xe4, 0x06, 0x11, 0xa2, 
+  0xe4, 0x06, 0x1d, 0xbb, 0xe4, 0x06, 0x73, 0xa5, 0xf4, 0x80, 0xd9, 0x1a, 
+  0x0d, 0xaf, 0xc4, 0x06, 0x03, 0x1c, 0x01, 0x10, 0x72, 0x5e, 0x03, 0xa2, 
+  0x2e, 0x0a, 0xe0, 0x01, 0x10, 0x41, 0x02, 0x14, 0x80, 0x30, 0xa4, 0x02, 
+  0x02, 0x64, 0x03, 0x24, 0x61, 0xc0, 0x3c, 0x01, 0x71, 0xf2, 0x0b, 0x60, 
+  0x02, 0x22, 0x40, 0x81, 0x6c, 0x01, 0x71, 0x22, 0x40, 0xaa, 0x0b, 0x60, 
+  0x02, 0x04, 0xa0, 0x02, 0x00, 0x8e, 0x02, 0x71, 0x6c, 0x73, 0xf2, 0x09, 
+  0xe0, 0x01, 0x22, 0xec, 0x00, 0xd0, 0x02, 0x14, 0x81, 0x30, 0x81, 0xc2, 
+  0x83, 0xb8, 0x61, 0xc1, 0x05, 0x1c, 0x02, 0x1c, 0x00, 0x21, 0x72, 0x7e, 
+  0x3a, 0x00, 0x35, 0x4a, 0x0f, 0x2f, 0x8e, 0x02, 0x06, 0x4a, 0x03, 0x11, 
+  0x9e, 0x1c, 0x00, 0x02, 0x4a, 0x03, 0xfc, 0x01, 0x1a, 0x0b, 0x6f, 0xfe, 
+  0xc1, 0x41, 0x8a, 0x1d, 0x18, 0x14, 0x51, 0xf0, 0x2c, 0x70, 0x72, 0x0c, 
+  0xa6, 0x00, 0x68, 0x06, 0x1c, 0x03, 0x30, 0x8a, 0x09, 0xa6, 0x00, 0x00, 
+  0x6a, 0x01, 0x00, 0x4c, 0x03, 0x00, 0xc8, 0x03, 0x08, 0x4e, 0x03, 0x19, 
+  0x46, 0xac, 0x00, 0x2a, 0xfe, 0x0a, 0xac, 0x00, 0x1b, 0x46, 0xac, 0x00, 
+  0x17, 0xa3, 0xac, 0x00, 0x20, 0xd2, 0x0a, 0x3a, 0x00, 0x0c, 0x34, 0x03, 
+  0x11, 0xf6, 0x16, 0x00, 0x80, 0x0c, 0x70, 0xc1, 0x41, 0x76, 0x0a, 0x6f, 
+  0xfe, 0xa2, 0x00, 0x30, 0x0c, 0x70, 0xfe, 0x26, 0x02, 0x21, 0x41, 0x8a, 
+  0x86, 0x07, 0x00, 0x34, 0x03, 0x26, 0x1e, 0x0c, 0x34, 0x03, 0xf0, 0x26, 
+  0x14, 0x70, 0x20, 0x40, 0xe0, 0x7d, 0x3f, 0x80, 0x95, 0x11, 0x01, 0x06, 
+  0x00, 0x79, 0xe0, 0x78, 0xe6, 0xc1, 0xa3, 0xc1, 0x9f, 0x80, 0xad, 0x70, 
+  0x42, 0xc5, 0x81, 0x40, 0x80, 0x20, 0x45, 0x03, 0x61, 0x88, 0xc0, 0x88, 
+  0xf7, 0x10, 0x8f, 0x80, 0x08, 0xbb, 0x65, 0x7e, 0xc2, 0xbf, 0x41, 0xc5, 
+  0x40, 0xc5, 0xdb, 0x0e, 0x80, 0x9e, 0x07, 0xf0, 0x92, 0x80, 0xa1, 0x14, 
+  0x00, 0x17, 0xcf, 0x0e, 0x20, 0x10, 0xce, 0x78, 0x83, 0x14, 0x43, 0x17, 
+  0x48, 0x30, 0x8b, 0x00, 0x48, 0x33, 0x80, 0x00, 0x00, 0x30, 0x83, 0x0f, 
+  0x00, 0x43, 0x00, 0x00, 0x00, 0x33, 0x80, 0x1f, 0x00, 0x3f, 0x00, 0x00, 
+  0x4a, 0x24, 0xc0, 0x70, 0x01, 0x30, 0xc0, 0x00, 0xa1, 0x1c, 0x9c, 0x13, 
+  0x41, 0x28, 0x03, 0x04, 0x00, 0x30, 0x88, 0x0f, 0x00, 0x38, 0x00, 0x00, 
+  0xcd, 0x70, 0xc3, 0x47, 0x00, 0x3c, 0x00, 0x00, 0x99, 0x1c, 0x1c, 0x10, 
+  0x9a, 0x1c, 0xdc, 0x10, 0xa8, 0x20, 0x41, 0x00, 0x14, 0x24, 0x80, 0x13, 
+  0x80, 0xc3, 0x8a, 0x10, 0x4b, 0x07, 0x15, 0x23, 0x86, 0x03, 0x87, 0x10, 
+  0x43, 0x07, 0x48, 0x33, 0x84, 0x10, 0x84, 0x10, 0x4b, 0x07, 0x48, 0x33, 
+  0x85, 0x00, 0x8d, 0x10, 0x43, 0x07, 0x80, 0x10, 0x40, 0x07, 0x48, 0x33, 
+  0x8b, 0x10, 0x48, 0x33, 0x83, 0x00, 0x48, 0x30, 0x9e, 0x00, 0x00, 0x33, 
+  0xc0, 0x11, 0x00, 0x33, 0x8b, 0x0f, 0x00, 0x39, 0x00, 0x00, 0x00, 0x30, 
+  0x00, 0x10, 0x00, 0x34, 0x84, 0x0f, 0x00, 0x3a, 0x00, 0x00, 0x01, 0x30, 
+  0x83, 0x0f, 0xb6, 0x02, 0xb0, 0x00, 0x30, 0xc0, 0x12, 0x00, 0x35, 0xc5, 
+  0x01, 0x01, 0x34, 0x0b, 0x92, 0x00, 0xf0, 0x10, 0x07, 0x15, 0x24, 0x89, 
+  0x13, 0x00, 0x30, 0xc0, 0x02, 0x00, 0x30, 0x43, 0x11, 0xc5, 0x71, 0x9b, 
+  0x19, 0x1c, 0x10, 0x30, 0xb8, 0x00, 0x1e, 0xc0, 0x00, 0x9c, 0x19, 0x1c, 
+  0x10, 0x0c, 0x71, 0xac, 0x00, 0xf1, 0x12, 0x00, 0x28, 0xc0, 0x03, 0x48, 
+  0x30, 0x87, 0x00, 0xa8, 0x20, 0x80, 0x0c, 0x14, 0x24, 0x40, 0x13, 0x15, 
+  0x24, 0x4b, 0x13, 0x96, 0x10, 0x43, 0x07, 0x9c, 0x13, 0x0e, 0x17, 0x40, 
+  0x24, 0x09, 0x30, 0xa3, 0x82, 0x00, 0xf1, 0x0a, 0x86, 0x00, 0xf0, 0x21, 
+  0x43, 0x13, 0x40, 0x2e, 0x09, 0x14, 0x9b, 0x13, 0x0e, 0x17, 0x48, 0x30, 
+  0x80, 0x00, 0xf0, 0x21, 0x48, 0x03, 0x01, 0x33, 0x8b, 0x76, 0x00, 0x70, 
+  0x01, 0x30, 0x03, 0x00, 0x05, 0x21, 0x80, 0x6a, 0x00, 0x60, 0x01, 0x01, 
+  0x33, 0x83, 0x01, 0x01, 0x9a, 0x00, 0x30, 0x33, 0xc3, 0x01, 0x7a, 0x00, 
+  0x40, 0x15, 0x22, 0x4f, 0x03, 0x10, 0x01, 0x80, 0xa5, 0x71, 0x00, 0xa7, 
+  0xc6, 0xc5, 0xe0, 0x78, 0xc4, 0x07, 0xfe, 0x05, 0x3c, 0x49, 0x80, 0x22, 
+  0x05, 0x03, 0x22, 0xd9, 0xc3, 0x44, 0x13, 0x00, 0x5c, 0xf9, 0x69, 0x07, 
+  0xa0, 0x01, 0x6c, 0x73, 0xa4, 0x03, 0x39, 0x3a, 0x0f, 0xa0, 0xa4, 0x03, 
+  0x1d, 0xa4, 0xa4, 0x03, 0x2f, 0xfa, 0x08, 0xec, 0x03, 0x11, 0x2a, 0xf2, 
+  0x0e, 0x48, 0x00, 0x1d, 0x84, 0x48, 0x00, 0x17, 0xb2, 0x48, 0x00, 0x0f, 
+  0xec, 0x03, 0x01, 0xf4, 0x1d, 0x77, 0x10, 0x00, 0x06, 0xe4, 0xc2, 0xdf, 
+  0x81, 0x28, 0x45, 0x6c, 0x72, 0x78, 0x1e, 0x18, 0x10, 0x3c, 0x49, 0x55, 
+  0x26, 0x02, 0x1e, 0x20, 0xd9, 0x8c, 0x70, 0xae, 0x0e, 0xa0, 0x01, 0xa1, 
+  0x45, 0x78, 0x16, 0x01, 0x16, 0x60, 0x79, 0xa1, 0x40, 0xc4, 0xc6, 0xe0, 
+  0x78, 0x08, 0x04, 0xf2, 0x67, 0xe6, 0xc0, 0x6b, 0x08, 0xf1, 0x01, 0x40, 
+  0x46, 0xc3, 0x40, 0xa1, 0x00, 0x4c, 0x1e, 0x62, 0x90, 0x84, 0x90, 0xc6, 
+  0x90, 0x60, 0xa9, 0x41, 0x2b, 0x08, 0x02, 0x6e, 0x90, 0x82, 0xa9, 0xe8, 
+  0x90, 0x4a, 0x90, 0xac, 0x90, 0x41, 0x2c, 0x0b, 0x12, 0x41, 0x2b, 0x09, 
+  0x02, 0x6c, 0xa9, 0x70, 0x90, 0x92, 0x90, 0x00, 0x88, 0xc4, 0xa9, 0xe6, 
+  0xa9, 0x48, 0xa9, 0xaa, 0xa9, 0x28, 0xbe, 0x28, 0xbf, 0x28, 0xba, 0x28, 
+  0xbd, 0x6e, 0xa9, 0x90, 0xa9, 0x28, 0xbb, 0x28, 0xbc, 0x12, 0xa9, 0x01, 
+  0x19, 0x02, 0x02, 0x03, 0x19, 0xc2, 0x02, 0xc5, 0xa9, 0xe7, 0xa9, 0x49, 
+  0xa9, 0xab, 0xa9, 0x0d, 0x19, 0x42, 0x02, 0x6f, 0xa9, 0x91, 0xa9, 0x00, 
+  0x1e, 0xc5, 0x04, 0x0c, 0x70, 0xc6, 0xc4, 0xe0, 0x78, 0xe6, 0xc2, 0x3f, 
+  0xda, 0x00, 0x41, 0x6e, 0x00, 0xf4, 0x41, 0x8a, 0x23, 0x1e, 0x01, 0x0a, 
+  0xba, 0x66, 0xb0, 0x48, 0xb0, 0x40, 0x22, 0xc3, 0x0f, 0x5f, 0x81, 0x8a, 
+  0x23, 0x19, 0x10, 0x8a, 0x24, 0x0a, 0x1f, 0xcb, 0x47, 0x00, 0x00, 0x12, 
+  0xf9, 0xcb, 0x46, 0x00, 0x00, 0x51, 0x78, 0xcb, 0x45, 0x00, 0x00, 0x71, 
+  0x7d, 0x04, 0x18, 0xc4, 0x02, 0x84, 0xb0, 0xec, 0xb0, 0xce, 0xb0, 0xb0, 
+  0xb0, 0x24, 0x18, 0x05, 0x04, 0x00, 0x18, 0x03, 0x00, 0x6a, 0xb0, 0x0c, 
+  0x70, 0x77, 0x1a, 0x19, 0x00, 0x0e, 0x08, 0x20, 0x00, 0x26, 0xa2, 0x0c, 
+  0x70, 0xc6, 0xc6, 0xb4, 0x04, 0x1d, 0xcb, 0xb4, 0x04, 0x6f, 0xb0, 0xf4, 
+  0x80, 0xd9, 0x66, 0x08, 0xb4, 0x04, 0x01, 0x3f, 0x7a, 0x0d, 0xa0, 0x0e, 
+  0x04, 0x04, 0x00, 0xbe, 0x04, 0x04, 0xbe, 0x03, 0x37, 0x3a, 0x0f, 0x20, 
+  0x0e, 0x04, 0x71, 0xee, 0x0e, 0x20, 0x02, 0x04, 0x1c, 0xc3, 0x0e, 0x04, 
+  0x71, 0x38, 0xd9, 0x6c, 0x73, 0x36, 0x0d, 0xa0, 0x0e, 0x04, 0x20, 0x81, 
+  0x30, 0x48, 0x00, 0xe0, 0x81, 0xc2, 0x05, 0x1c, 0x42, 0x30, 0x45, 0x20, 
+  0x01, 0x05, 0x45, 0x20, 0x80, 0x05, 0x4a, 0x00, 0x80, 0x61, 0xc0, 0x38, 
+  0xd9, 0x6c, 0x72, 0xba, 0x0e, 0x44, 0x00, 0x2f, 0x86, 0x0a, 0xc4, 0x04, 
+  0x01, 0x11, 0xda, 0x1c, 0x00, 0x02, 0xc4, 0x04, 0xf4, 0x01, 0x56, 0x0e, 
+  0x2f, 0xfe, 0xc1, 0x41, 0x77, 0x1d, 0x18, 0x14, 0x54, 0xf0, 0x40, 0x26, 
+  0x0f, 0x17, 0xae, 0x00, 0x60, 0xe1, 0x40, 0xce, 0x0c, 0xa0, 0x01, 0xc2, 
+  0x04, 0x01, 0xae, 0x00, 0x1f, 0x15, 0xbc, 0x04, 0x07, 0x53, 0x8a, 0x0e, 
+  0x20, 0x02, 0xe1, 0xae, 0x00, 0x3b, 0xe1, 0x40, 0x42, 0xae, 0x00, 0x60, 
+  0x8a, 0x0c, 0xa0, 0x01, 0xe1, 0x40, 0x44, 0x00, 0x00, 0xb2, 0x00, 0x40, 
+  0x81, 0xc2, 0xa1, 0xb8, 0xb0, 0x00, 0x02, 0xa4, 0x00, 0x11, 0x16, 0x3a, 
+  0x00, 0x21, 0xe2, 0x09, 0xa4, 0x00, 0x02, 0x62, 0x00, 0x05, 0xa4, 0x00, 
+  0x11, 0x36, 0x1c, 0x00, 0x71, 0x2c, 0x70, 0x1e, 0x0f, 0x6f, 0xfe, 0xc1, 
+  0xca, 0x04, 0x40, 0xaa, 0x0d, 0x2f, 0xfe, 0xa8, 0x00, 0x30, 0x0c, 0x70, 
+  0x36, 0x04, 0x03, 0x21, 0x41, 0x77, 0xca, 0x04, 0x22, 0xe0, 0x78, 0x00, 
+  0x08, 0x15, 0xa0, 0xcc, 0x04, 0xf0, 0x63, 0xf4, 0xc3, 0xa4, 0xc1, 0x60, 
+  0x46, 0x87, 0xe0, 0xad, 0x70, 0xe6, 0xf4, 0x93, 0xe2, 0xc8, 0x01, 0x25, 
+  0x00, 0x23, 0xdd, 0x00, 0x11, 0x92, 0x00, 0x01, 0x11, 0x90, 0x00, 0x82, 
+  0x89, 0x63, 0x89, 0x04, 0x11, 0x91, 0x00, 0x05, 0x89, 0x46, 0x89, 0xe7, 
+  0x89, 0x08, 0x11, 0x88, 0x00, 0x09, 0x11, 0x8b, 0x00, 0x0a, 0x11, 0x9f, 
+  0x00, 0x0b, 0x11, 0x84, 0x00, 0x12, 0x11, 0x94, 0x00, 0x0c, 0x11, 0x87, 
+  0x00, 0x0d, 0x11, 0x89, 0x00, 0x0e, 0x11, 0x9e, 0x00, 0x0f, 0x11, 0x85, 
+  0x00, 0x10, 0x11, 0x95, 0x00, 0x31, 0x89, 0x40, 0x28, 0x13, 0x22, 0x08, 
+  0xbb, 0x40, 0x28, 0x10, 0x02, 0x08, 0xbf, 0x40, 0x29, 0x09, 0x12, 0x40, 
+  0x2d, 0x05, 0x02, 0x40, 0x29, 0x00, 0x02, 0x7c, 0x16, 0x16, 0x00, 0xcb, 
+  0x46, 0x5e, 0x02, 0xf0, 0x29, 0x40, 0x2b, 0x0b, 0x12, 0x40, 0x2c, 0x04, 
+  0x02, 0x85, 0x7b, 0x45, 0x7f, 0x05, 0x21, 0xc2, 0x11, 0x05, 0x25, 0x81, 
+  0x07, 0x05, 0x20, 0x40, 0x05, 0xad, 0x70, 0x05, 0x22, 0xd2, 0x24, 0x05, 
+  0x20, 0x50, 0x24, 0x05, 0x23, 0x0b, 0x12, 0x05, 0x24, 0xcc, 0x07, 0x64, 
+  0xb6, 0x4e, 0xb6, 0x30, 0xb6, 0x12, 0xb6, 0x40, 0x26, 0x00, 0x07, 0x83, 
+  0xc2, 0x6c, 0x01, 0x40, 0x08, 0x1c, 0x44, 0x33, 0x54, 0x05, 0xf0, 0x18, 
+  0x0e, 0x1c, 0x42, 0x33, 0x0c, 0x1c, 0x44, 0x33, 0x0f, 0x1c, 0x42, 0x33, 
+  0x00, 0x1e, 0x02, 0x15, 0x04, 0x1e, 0x84, 0x14, 0x0c, 0x1e, 0x04, 0x14, 
+  0xe8, 0xb6, 0x14, 0x1e, 0xc4, 0x12, 0x8c, 0xb6, 0x3e, 0x0b, 0xa0, 0x01, 
+  0x10, 0x40, 0x0d, 0x90, 0x01, 0x70, 0x16, 0x06, 0x20, 0x40, 0x24, 0x42, 
+  0x33, 0x90, 0x01, 0x57, 0x0d, 0x1c, 0x42, 0x30, 0x0f, 0x90, 0x01, 0x71, 
+  0xfa, 0x0c, 0x20, 0x02, 0x02, 0x40, 0x80, 0x90, 0x01, 0xf1, 0x07, 0x02, 
+  0x40, 0xb2, 0x0c, 0x20, 0x02, 0x00, 0x1c, 0x83, 0x31, 0x02, 0x96, 0x24, 
+  0x96, 0x46, 0x96, 0x68, 0x96, 0x8a, 0x96, 0x60, 0xc0, 0x26, 0x02, 0xf4, 
+  0x22, 0xc2, 0x06, 0x1c, 0xc2, 0x30, 0x28, 0xb8, 0x28, 0xb9, 0x28, 0xba, 
+  0x28, 0xbb, 0x62, 0xc4, 0x28, 0xbc, 0x01, 0x1c, 0x02, 0x30, 0x03, 0x1c, 
+  0x42, 0x30, 0x05, 0x1c, 0x82, 0x30, 0x07, 0x1c, 0xc2, 0x30, 0x80, 0xc2, 
+  0x36, 0xd9, 0x0a, 0xdb, 0x02, 0x40, 0x6e, 0x0c, 0x20, 0x02, 0x09, 0x1c, 
+  0x02, 0x33, 0x52, 0x00, 0x11, 0x5e, 0x52, 0x00, 0x9f, 0xc3, 0x31, 0x0c, 
+  0x96, 0x2e, 0x96, 0x50, 0x96, 0x72, 0x50, 0x00, 0x02, 0x0c, 0x4c, 0x00, 
+  0x20, 0x83, 0xc2, 0x0c, 0x02, 0x80, 0x7e, 0x0a, 0xa0, 0x01, 0x02, 0x40, 
+  0x20, 0x8e, 0xc2, 0x00, 0xf1, 0x04, 0x0e, 0x14, 0x82, 0x30, 0x0a, 0xdb, 
+  0x25, 0x78, 0x09, 0x1c, 0x82, 0x30, 0x62, 0xc0, 0x80, 0xc2, 0x30, 0xd9, 
+  0x06, 0xb8, 0x00, 0x02, 0xda, 0x00, 0x24, 0xc2, 0x33, 0xce, 0x00, 0x11, 
+  0x2e, 0x16, 0x00, 0xd3, 0xa1, 0x40, 0xd4, 0xc7, 0xe6, 0xc3, 0xa1, 0xc1, 
+  0xdf, 0x81, 0x40, 0x21, 0x0f, 0xc6, 0x04, 0x11, 0x77, 0xa6, 0x02, 0xe0, 
+  0x2a, 0x0a, 0xa0, 0x01, 0x00, 0x1c, 0x01, 0x30, 0x61, 0x95, 0x80, 0x95, 
+  0x42, 0x95, 0xd0, 0x04, 0xf0, 0x15, 0x38, 0x16, 0x06, 0x10, 0x41, 0x2c, 
+  0x0e, 0x12, 0x41, 0x2b, 0x8b, 0x01, 0x41, 0x2a, 0x08, 0x01, 0xc1, 0xbe, 
+  0x44, 0x23, 0x01, 0x13, 0x44, 0x20, 0x0d, 0x1c, 0xc5, 0x79, 0xa5, 0x79, 
+  0x6c, 0x20, 0x40, 0x01, 0x25, 0x78, 0xec, 0x04, 0x51, 0x02, 0x1c, 0x82, 
+  0x30, 0x01, 0xe8, 0x00, 0x40, 0x74, 0xd9, 0x6c, 0x74, 0x6c, 0x00, 0xb0, 
+  0xe1, 0x40, 0xbe, 0x0b, 0x20, 0x02, 0x60, 0xc4, 0xc6, 0xc7, 0xec, 0x6c, 
+  0x00, 0x50, 0x80, 0x08, 0x45, 0xf8, 0x88, 0x6a, 0x00, 0x40, 0xe7, 0x16, 
+  0x80, 0x10, 0xa8, 0x01, 0xc0, 0x0f, 0x20, 0xc0, 0x03, 0xe7, 0x1e, 0x02, 
+  0x10, 0x3c, 0x4d, 0xb2, 0x09, 0xc8, 0x03, 0x00, 0x6e, 0x00, 0xf0, 0x2f, 
+  0x4e, 0x71, 0x44, 0x20, 0x50, 0x80, 0x03, 0x1c, 0x02, 0x34, 0x09, 0xf2, 
+  0x6e, 0x86, 0x7c, 0xd9, 0x4c, 0x70, 0xa1, 0x40, 0xa2, 0x08, 0x20, 0x00, 
+  0x03, 0x1c, 0x03, 0x30, 0x6e, 0x86, 0x2f, 0xd9, 0x4c, 0x71, 0xa1, 0x40, 
+  0x92, 0x08, 0x20, 0x00, 0x00, 0x2a, 0xcf, 0x23, 0x6e, 0x86, 0x35, 0xd9, 
+  0x4c, 0x74, 0x82, 0x08, 0x20, 0x00, 0xa1, 0x40, 0xee, 0x0e, 0xef, 0xeb, 
+  0x28, 0xd8, 0x5e, 0x00, 0x62, 0x6a, 0xd9, 0x6c, 0x72, 0x62, 0x09, 0xd4, 
+  0x03, 0xb1, 0x82, 0x30, 0x6e, 0x86, 0x6a, 0xd9, 0x81, 0xba, 0xa1, 0x40, 
+  0x5e, 0x44, 0x00, 0x00, 0x10, 0x00, 0xf0, 0x03, 0x7e, 0xd9, 0xa0, 0xda, 
+  0x4e, 0x08, 0x20, 0x00, 0x0a, 0x20, 0x40, 0x03, 0xb6, 0x0e, 0xef, 0xeb, 
+  0x0c, 0x75, 0x36, 0x00, 0x53, 0x2c, 0x73, 0x6c, 0x72, 0x2e, 0x36, 0x00, 
+  0x70, 0x80, 0x30, 0x24, 0xb8, 0x44, 0x20, 0x40, 0x86, 0x00, 0xe1, 0x30, 
+  0xf0, 0xf3, 0x11, 0x08, 0x30, 0x20, 0x7c, 0xd9, 0x6e, 0x86, 0x4c, 0x71, 
+  0x1a, 0x6a, 0x00, 0x20, 0xe7, 0x16, 0xc2, 0x05, 0xa1, 0xe6, 0x79, 0xe7, 
+  0x1e, 0x42, 0x10, 0xcc, 0xc7, 0xe0, 0x78, 0x48, 0x01, 0x30, 0x80, 0x68, 
+  0x47, 0x5e, 0x00, 0x20, 0x1c, 0xe0, 0xfe, 0x05, 0xc0, 0x6c, 0x71, 0x8a, 
+  0x0a, 0x20, 0x02, 0x28, 0x45, 0x01, 0x37, 0x80, 0x1f, 0xfa, 0x05, 0x40, 
+  0x1a, 0x0e, 0xcf, 0xeb, 0x56, 0x00, 0xae, 0xdd, 0x65, 0x3c, 0x1d, 0x02, 
+  0x10, 0xc6, 0xc7, 0xe0, 0x78, 0x40, 0x06, 0x2a, 0xb2, 0x08, 0x40, 0x06, 
+  0x1d, 0xa3, 0x40, 0x06, 0x3f, 0x72, 0x0a, 0x20, 0x88, 0x06, 0x10, 0x1b, 
+  0x6a, 0x48, 0x00, 0x1d, 0x83, 0x48, 0x00, 0x17, 0x2a, 0x48, 0x00, 0x0f, 
+  0x88, 0x06, 0x01, 0x60, 0xa8, 0x10, 0x00, 0x06, 0xe6, 0xc2, 0x8a, 0x05, 
+  0xf7, 0x04, 0x2a, 0x0e, 0xaf, 0xec, 0x08, 0x47, 0xaa, 0x1d, 0x18, 0x10, 
+  0xc1, 0x40, 0x60, 0x7f, 0xab, 0x1d, 0x58, 0x10, 0xc6, 0x7c, 0x06, 0xf1, 
+  0x02, 0xea, 0xc3, 0xa4, 0xc1, 0x50, 0x41, 0xf9, 0x08, 0x71, 0x00, 0x28, 
+  0x46, 0xbf, 0x83, 0x3c, 0x4b, 0x80, 0x7c, 0x03, 0xb5, 0x0e, 0x1c, 0x03, 
+  0x30, 0xe6, 0x0f, 0x60, 0x01, 0x10, 0x40, 0x01, 0xe8, 0x04, 0x11, 0x42, 
+  0xe8, 0x04, 0x1b, 0x01, 0x58, 0x03, 0x20, 0xa2, 0x09, 0x8a, 0x02, 0x42, 
+  0x40, 0x24, 0x82, 0x33, 0x08, 0x03, 0xf0, 0x03, 0x56, 0x09, 0x20, 0x02, 
+  0x0e, 0x1c, 0x83, 0x30, 0x0e, 0x85, 0x22, 0x0d, 0xef, 0xeb, 0x48, 0x30, 
+  0xc0, 0x02, 0x32, 0x03, 0x71, 0x0b, 0xdb, 0x96, 0x0f, 0x60, 0x01, 0x02, 
+  0xf2, 0x04, 0x60, 0x21, 0xc7, 0x01, 0x14, 0x83, 0x30, 0xd6, 0x01, 0xf1, 
+  0x08, 0x0a, 0x14, 0x81, 0x30, 0x05, 0x14, 0x8c, 0x30, 0x06, 0x14, 0x88, 
+  0x30, 0x07, 0x14, 0x87, 0x30, 0x08, 0x14, 0x89, 0x30, 0x09, 0x14, 0x8b, 
+  0x70, 0x00, 0xf8, 0x05, 0x08, 0xbf, 0x08, 0xb8, 0xcb, 0x45, 0xa1, 0x00, 
+  0x8a, 0x1e, 0x65, 0x78, 0xe5, 0x7a, 0x29, 0xad, 0x00, 0xb5, 0x41, 0xb5, 
+  0x02, 0x03, 0xf0, 0x3b, 0x02, 0x40, 0x84, 0xad, 0x05, 0x1d, 0x02, 0x12, 
+  0x06, 0x1d, 0xc2, 0x11, 0x07, 0x1d, 0x42, 0x12, 0x1a, 0x09, 0x20, 0x02, 
+  0x08, 0x1d, 0xc2, 0x12, 0x00, 0x8d, 0x00, 0xae, 0x01, 0x8d, 0x01, 0xae, 
+  0x02, 0x8d, 0x02, 0xae, 0x03, 0x8d, 0x03, 0xae, 0x04, 0x8d, 0x04, 0xae, 
+  0x05, 0x8d, 0x05, 0xae, 0x06, 0x8d, 0x06, 0xae, 0x07, 0x8d, 0x07, 0xae, 
+  0x08, 0x8d, 0x08, 0xae, 0x09, 0x8d, 0x09, 0xae, 0x00, 0x19, 0x85, 0x22, 
+  0x0c, 0x70, 0xca, 0xc7, 0xe4, 0xc2, 0xd2, 0x02, 0x90, 0x4a, 0x0b, 0xa0, 
+  0x01, 0x0a, 0xa6, 0x0c, 0x70, 0x12, 0x1c, 0x02, 0xc1, 0x41, 0x0c, 0x70, 
+  0xa8, 0x1e, 0x19, 0x10, 0xc4, 0xc6, 0xea, 0xc3, 0xa3, 0xcc, 0x06, 0x1f, 
+  0xbf, 0xcc, 0x06, 0x02, 0x20, 0x9a, 0x09, 0x84, 0x05, 0x02, 0x30, 0x06, 
+  0x20, 0x26, 0x08, 0x30, 0x06, 0x00, 0xd8, 0x06, 0x11, 0x81, 0x40, 0x01, 
+  0x75, 0xaa, 0x0e, 0x60, 0x01, 0x10, 0x41, 0x05, 0xd2, 0x06, 0x20, 0x42, 
+  0x31, 0x3c, 0x01, 0x00, 0xe4, 0x05, 0x17, 0x0b, 0x3c, 0x01, 0x20, 0x66, 
+  0x08, 0x72, 0x06, 0x02, 0x42, 0x04, 0x41, 0x22, 0x40, 0x1e, 0x08, 0x94, 
+  0x04, 0x52, 0x30, 0x0e, 0x87, 0xe6, 0x0b, 0x3a, 0x01, 0xc0, 0x81, 0xc2, 
+  0x34, 0xd9, 0x6c, 0x73, 0x5e, 0x0e, 0x60, 0x01, 0x22, 0x40, 0x4c, 0x00, 
+  0xf3, 0x04, 0x80, 0xc2, 0x34, 0xd9, 0x84, 0xb8, 0x60, 0xc0, 0x6c, 0x71, 
+  0xf2, 0x0f, 0xe0, 0x01, 0x22, 0x40, 0x0e, 0x87, 0xbe, 0x2a, 0x00, 0x03, 
+  0xcc, 0x06, 0x14, 0x32, 0x5a, 0x00, 0x11, 0x0e, 0x5a, 0x00, 0x53, 0xa8, 
+  0x1d, 0x18, 0x14, 0x5a, 0xc0, 0x06, 0x11, 0x82, 0xc0, 0x06, 0x51, 0x12, 
+  0x0e, 0x60, 0x01, 0xe1, 0x58, 0x02, 0x02, 0xd4, 0x01, 0x11, 0xc2, 0xd4, 
+  0x01, 0x00, 0x94, 0x04, 0x17, 0x0a, 0x98, 0x00, 0x53, 0xce, 0x0f, 0xe0, 
+  0x01, 0xe1, 0x98, 0x00, 0x61, 0xe1, 0x40, 0x86, 0x0f, 0xe0, 0x01, 0x98, 
+  0x00, 0x23, 0x85, 0x4e, 0x6e, 0x00, 0x00, 0x4e, 0x00, 0x64, 0x34, 0xd9, 
+  0x6c, 0x72, 0xc2, 0x0d, 0x4e, 0x00, 0x00, 0x9a, 0x00, 0x11, 0xa4, 0x9a, 
+  0x00, 0x11, 0x56, 0x3c, 0x00, 0x34, 0x0e, 0x85, 0x22, 0x9a, 0x00, 0x02, 
+  0xc2, 0x06, 0x05, 0x9a, 0x00, 0x11, 0x72, 0x20, 0x00, 0x40, 0x2c, 0x70, 
+  0x5a, 0x08, 0x3e, 0x01, 0xf0, 0x03, 0xb9, 0x16, 0x80, 0x10, 0xc1, 0x41, 
+  0xc6, 0xb8, 0xb9, 0x1e, 0x02, 0x10, 0x0c, 0x70, 0xde, 0x0e, 0xef, 0xfd, 
+  0xb4, 0x00, 0x21, 0x0c, 0x70, 0x00, 0x03, 0x27, 0x41, 0xa8, 0xcc, 0x06, 
+  0x26, 0x86, 0x08, 0xcc, 0x06, 0xf0, 0x03, 0xf1, 0xc0, 0x45, 0x08, 0x71, 
+  0x00, 0x23, 0xd8, 0x3f, 0x0a, 0x94, 0x02, 0x01, 0x89, 0x80, 0x89, 0xc3, 
+  0x42, 0x28, 0x02, 0xa0, 0x08, 0xb8, 0x85, 0x78, 0x00, 0xb2, 0x03, 0x89, 
+  0x82, 0x89, 0x0a, 0x00, 0xf2, 0x17, 0x01, 0xb2, 0x04, 0x89, 0x04, 0xaa, 
+  0x05, 0x89, 0x05, 0xaa, 0x06, 0x89, 0x06, 0xaa, 0x07, 0x89, 0x07, 0xaa, 
+  0x08, 0x89, 0x08, 0xaa, 0x09, 0x89, 0x09, 0xaa, 0x5e, 0x09, 0xa0, 0x01, 
+  0x60, 0x40, 0x0c, 0x70, 0xd1, 0xc0, 0xe0, 0x7e, 0xc4, 0x03, 0xf0, 0x09, 
+  0x28, 0x46, 0xc3, 0x41, 0xa1, 0x00, 0x08, 0x1e, 0x20, 0x89, 0x08, 0x45, 
+  0x7a, 0x08, 0xe0, 0x01, 0x0c, 0x76, 0x00, 0x41, 0x27, 0xed, 0x3c, 0x4e, 
+  0xf4, 0x02, 0xe0, 0xde, 0x0c, 0x60, 0x01, 0x6c, 0x73, 0x08, 0x44, 0x2f, 
+  0x26, 0x07, 0xf0, 0x1e, 0xf4, 0xec, 0x00, 0xf0, 0x2f, 0x8d, 0x70, 0x41, 
+  0x28, 0x43, 0x01, 0x44, 0x20, 0x42, 0x00, 0x41, 0x28, 0x01, 0x01, 0x41, 
+  0x28, 0xcb, 0x00, 0x41, 0x28, 0x88, 0x00, 0x1d, 0x78, 0x65, 0xad, 0x40, 
+  0xad, 0x44, 0x21, 0x43, 0x00, 0x44, 0x23, 0x42, 0x10, 0x44, 0x20, 0x41, 
+  0x10, 0xc0, 0xb8, 0x64, 0xad, 0x43, 0xad, 0x22, 0xad, 0x01, 0xad, 0x02, 
+  0xf0, 0xff, 0xdc, 0x8d, 0x78, 0xc4, 0xc7, 0xe8, 0xc3, 0xa3, 0xc1, 0x6a, 
+  0x00, 0xa0, 0x94, 0x12, 0x20, 0x81, 0x08, 0x46, 0x04, 0x1c, 0x05, 0x30, 
+  0xa4, 0x05, 0xf6, 0x07, 0x08, 0xe9, 0xc3, 0x40, 0xa1, 0x00, 0x00, 0x12, 
+  0x40, 0x79, 0x00, 0x41, 0x78, 0xf0, 0x80, 0xc0, 0x72, 0x0f, 0xef, 0xff, 
+  0xc1, 0x41, 0x92, 0x00, 0xd1, 0xea, 0x0f, 0xa0, 0x01, 0x0c, 0x75, 0x08, 
+  0x47, 0xb5, 0x70, 0xad, 0x71, 0x1d, 0x82, 0x00, 0xf2, 0x08, 0x33, 0x08, 
+  0x71, 0x00, 0x40, 0x24, 0x42, 0x32, 0x40, 0x26, 0x0d, 0x17, 0x6c, 0x73, 
+  0xe1, 0x41, 0x3a, 0x0c, 0x60, 0x01, 0xa1, 0x40, 0x0b, 0x2e, 0x04, 0xf1, 
+  0x21, 0x31, 0x6c, 0x71, 0x6c, 0x20, 0xc0, 0x00, 0x07, 0x1c, 0x02, 0x30, 
+  0xa1, 0x40, 0xca, 0x0d, 0xe0, 0x01, 0xe1, 0x41, 0xad, 0x70, 0x3c, 0x4e, 
+  0x82, 0xc2, 0x6c, 0x71, 0xe1, 0x41, 0x08, 0x1c, 0xc3, 0x31, 0xb6, 0x0d, 
+  0xe0, 0x01, 0x10, 0x40, 0x82, 0x09, 0xef, 0xeb, 0x0a, 0xd8, 0x80, 0xc0, 
+  0x02, 0x6e, 0x00, 0x20, 0x91, 0xe8, 0x60, 0x02, 0x40, 0x1b, 0x08, 0xf1, 
+  0x01, 0x28, 0x00, 0xd3, 0x02, 0x40, 0xe1, 0x41, 0x8e, 0x0d, 0xe0, 0x01, 
+  0x08, 0x1c, 0x43, 0x31, 0x5a, 0x28, 0x00, 0x20, 0xda, 0x0e, 0x28, 0x00, 
+  0x31, 0x00, 0x41, 0x87, 0x2a, 0x00, 0xf0, 0x04, 0x0b, 0x08, 0x70, 0x01, 
+  0x2c, 0x70, 0xec, 0xd9, 0x2f, 0x26, 0x47, 0xf0, 0xc5, 0x25, 0x62, 0x10, 
+  0x39, 0x0d, 0x3f, 0xe6, 0x02, 0xba, 0x32, 0x6c, 0x73, 0x02, 0x40, 0xae, 
+  0x0b, 0x60, 0x01, 0xe1, 0x41, 0x8e, 0x00, 0x20, 0x80, 0xb8, 0x90, 0x00, 
+  0x31, 0x02, 0x40, 0x3a, 0x90, 0x00, 0x11, 0x06, 0x54, 0x00, 0xf0, 0x2f, 
+  0x2c, 0x70, 0x2d, 0x78, 0xc8, 0xc7, 0xe2, 0xc2, 0x28, 0x45, 0x4a, 0x68, 
+  0xc3, 0x41, 0xf0, 0x3f, 0x00, 0x00, 0x42, 0x09, 0x60, 0x01, 0x0c, 0x70, 
+  0xc3, 0x43, 0xa3, 0x40, 0x00, 0x88, 0x7e, 0x0c, 0xef, 0xfb, 0x4c, 0x70, 
+  0x2a, 0x09, 0x0f, 0xfc, 0xc3, 0x43, 0x7a, 0x44, 0x00, 0x00, 0x00, 0x30, 
+  0x81, 0x0f, 0x80, 0x40, 0x00, 0x00, 0x07, 0x30, 0xcc, 0x00, 0xc3, 0x42, 
+  0xfa, 0xc4, 0x12, 0x00, 0xf0, 0x33, 0x80, 0x0f, 0x40, 0x40, 0x00, 0x00, 
+  0x01, 0x31, 0x81, 0x00, 0xb7, 0xba, 0x01, 0x30, 0x80, 0x00, 0x07, 0x31, 
+  0xc1, 0x00, 0x07, 0x30, 0xc0, 0x00, 0x80, 0xa5, 0x23, 0xa5, 0x01, 0xa5, 
+  0xc2, 0xc6, 0xea, 0xc3, 0xa1, 0xc1, 0x88, 0x47, 0x51, 0x87, 0x08, 0x45, 
+  0xe1, 0x40, 0x30, 0x40, 0x60, 0x7a, 0x79, 0x23, 0x11, 0x00, 0x4c, 0x70, 
+  0x04, 0x30, 0x80, 0x80, 0xcd, 0x70, 0xc5, 0xf6, 0x07, 0x36, 0x0e, 0x70, 
+  0x5a, 0x00, 0xf1, 0x32, 0x24, 0x10, 0x80, 0x20, 0x39, 0x08, 0xb0, 0x00, 
+  0x40, 0x21, 0x41, 0x21, 0x0d, 0x08, 0x50, 0x00, 0xa8, 0xe8, 0x24, 0x18, 
+  0x43, 0x20, 0x15, 0x8d, 0x29, 0xe8, 0x23, 0x85, 0x04, 0x85, 0x04, 0x30, 
+  0x40, 0x80, 0x70, 0x00, 0x06, 0x00, 0x1a, 0x08, 0xef, 0xeb, 0x00, 0x85, 
+  0x00, 0x85, 0x24, 0x85, 0x01, 0x36, 0x00, 0x10, 0x01, 0x31, 0x00, 0x00, 
+  0x2c, 0xf0, 0x14, 0x8d, 0x30, 0xe8, 0x21, 0x85, 0x02, 0x24, 0x00, 0x71, 
+  0x7e, 0x00, 0x06, 0x00, 0xf6, 0x0f, 0xaf, 0x24, 0x00, 0x15, 0x22, 0x24, 
+  0x00, 0xe2, 0x33, 0xf0, 0x23, 0x18, 0x82, 0x20, 0x24, 0x18, 0x82, 0x20, 
+  0xca, 0xc7, 0x3c, 0x4f, 0x56, 0x06, 0x00, 0x06, 0x03, 0xa0, 0x5a, 0x0c, 
+  0xe0, 0x01, 0x03, 0x1c, 0x43, 0x31, 0xc3, 0x40, 0xc2, 0x00, 0x50, 0x15, 
+  0x1d, 0x43, 0x10, 0xba, 0x3c, 0x00, 0xcb, 0xa5, 0x00, 0x85, 0x04, 0xa5, 
+  0xca, 0xc7, 0x55, 0xad, 0x24, 0x18, 0x83, 0x32, 0x00, 0x11, 0x26, 0x32, 
+  0x00, 0x22, 0x03, 0x32, 0x32, 0x00, 0x53, 0x14, 0x1d, 0x43, 0x10, 0x8a, 
+  0x32, 0x00, 0xa0, 0x02, 0xa5, 0xca, 0xc7, 0x54, 0xad, 0x24, 0x18, 0xc3, 
+  0x20, 0x2c, 0x03, 0x80, 0xf1, 0xc0, 0x0e, 0x0e, 0xa0, 0x01, 0x00, 0x43, 
+  0xca, 0x04, 0xf0, 0x5d, 0x60, 0x40, 0x06, 0x89, 0xd1, 0xc0, 0xe0, 0x7f, 
+  0x07, 0xa9, 0xe0, 0x78, 0xe4, 0xc0, 0x81, 0x80, 0x60, 0x80, 0xa2, 0x80, 
+  0x00, 0x34, 0x02, 0x13, 0x00, 0x33, 0xc0, 0x00, 0x01, 0x30, 0x82, 0x00, 
+  0x00, 0x35, 0x40, 0x13, 0x01, 0x32, 0x00, 0x00, 0x2f, 0x32, 0x00, 0x00, 
+  0x20, 0x11, 0x80, 0x00, 0x40, 0xa1, 0x85, 0xe8, 0x21, 0x11, 0x80, 0x00, 
+  0x06, 0xe8, 0x22, 0x19, 0x43, 0x00, 0x04, 0x19, 0x43, 0x00, 0xc4, 0xc4, 
+  0xbf, 0xbb, 0xc3, 0x40, 0x22, 0x45, 0x00, 0x80, 0xbf, 0xbd, 0x04, 0x33, 
+  0x00, 0x80, 0xbf, 0xbc, 0xc4, 0x34, 0x0b, 0x90, 0xc4, 0x35, 0x0b, 0x90, 
+  0xc4, 0x32, 0x0b, 0x80, 0x46, 0xf6, 0x05, 0x89, 0x86, 0xe8, 0x22, 0x19, 
+  0x03, 0x00, 0x04, 0xf0, 0x32, 0x00, 0xf1, 0x07, 0xc4, 0x89, 0x06, 0xee, 
+  0xc3, 0x40, 0xfa, 0x44, 0x00, 0x00, 0x05, 0xf0, 0xc3, 0x40, 0x16, 0x45, 
+  0x00, 0x00, 0x04, 0x32, 0x00, 0x80, 0x2e, 0x00, 0x30, 0x33, 0x0b, 0x80, 
+  0x3a, 0x00, 0xb1, 0xae, 0x07, 0xca, 0xff, 0x05, 0x89, 0xd5, 0xe8, 0x04, 
+  0xee, 0x23, 0x62, 0x00, 0xf0, 0x1e, 0x03, 0x00, 0xc4, 0xc4, 0xe0, 0x78, 
+  0xee, 0xc3, 0xa4, 0xc1, 0x98, 0x10, 0x80, 0x00, 0xad, 0x70, 0xcb, 0x46, 
+  0xa1, 0x00, 0x90, 0x12, 0x14, 0x71, 0xb6, 0xf4, 0x00, 0x8e, 0x01, 0x1c, 
+  0x42, 0x33, 0x0f, 0x1c, 0x42, 0x33, 0x0e, 0x1c, 0x42, 0x33, 0x90, 0xe0, 
+  0x7c, 0x05, 0x25, 0x20, 0x00, 0x11, 0x47, 0x16, 0x03, 0xd0, 0x8f, 0xd6, 
+  0x0c, 0xa0, 0x01, 0x0c, 0x76, 0xd3, 0x42, 0xa1, 0x00, 0x8c, 0x42, 0xf8, 
+  0x04, 0xf0, 0x08, 0x6c, 0x73, 0x00, 0x41, 0x36, 0x09, 0x60, 0x01, 0x42, 
+  0x40, 0x0d, 0x14, 0x80, 0x30, 0x44, 0x20, 0x13, 0x82, 0x1d, 0xf2, 0x20, 
+  0x8f, 0xae, 0x26, 0x00, 0x10, 0x75, 0x56, 0x07, 0x00, 0x22, 0x00, 0x80, 
+  0x42, 0x40, 0x12, 0x09, 0x60, 0x01, 0xa1, 0x41, 0x22, 0x00, 0x00, 0xb0, 
+  0x06, 0x02, 0x9a, 0x02, 0x10, 0x0e, 0x28, 0x03, 0xf0, 0x04, 0x41, 0xa2, 
+  0x0a, 0xe0, 0x01, 0x42, 0x40, 0x6e, 0x0e, 0xaf, 0xeb, 0x0a, 0xd8, 0x78, 
+  0xd8, 0x01, 0x1c, 0x02, 0x30, 0xfc, 0x03, 0x51, 0x7e, 0xd9, 0x6c, 0x71, 
+  0x86, 0x1a, 0x00, 0x11, 0x56, 0x1a, 0x00, 0x19, 0x60, 0x1a, 0x00, 0x11, 
+  0x6e, 0x1a, 0x00, 0x11, 0x3a, 0x1a, 0x00, 0x19, 0xae, 0x1a, 0x00, 0x11, 
+  0x52, 0x1a, 0x00, 0x11, 0x22, 0x1a, 0x00, 0x00, 0x7c, 0x00, 0x60, 0x7f, 
+  0xd9, 0x6c, 0x73, 0x96, 0x08, 0x9e, 0x00, 0x15, 0x81, 0x28, 0x00, 0x51, 
+  0x7f, 0xd9, 0x6c, 0x71, 0x2a, 0x28, 0x00, 0x00, 0x0e, 0x00, 0xd0, 0x7d, 
+  0xd9, 0x6c, 0x71, 0x42, 0x40, 0x1a, 0x0a, 0xe0, 0x01, 0x01, 0x1c, 0x83, 
+  0x38, 0x03, 0x61, 0x32, 0x21, 0xd9, 0x6c, 0x73, 0x62, 0x34, 0x00, 0x00, 
+  0x7a, 0x04, 0x30, 0x40, 0x02, 0x01, 0xf2, 0x03, 0x61, 0x31, 0x35, 0xd9, 
+  0x6c, 0x73, 0x4e, 0x16, 0x00, 0x20, 0x08, 0x45, 0x18, 0x00, 0xb0, 0x0e, 
+  0x70, 0xcd, 0x70, 0x2e, 0x70, 0x1c, 0xf4, 0x07, 0x14, 0x90, 0xd4, 0x00, 
+  0x61, 0x30, 0x29, 0xd9, 0x6c, 0x73, 0x2e, 0x20, 0x00, 0x71, 0x82, 0xc2, 
+  0x2a, 0xd9, 0x6c, 0x73, 0x22, 0x0c, 0x00, 0x10, 0x0a, 0x76, 0x07, 0xf1, 
+  0x0b, 0xc1, 0x6c, 0x20, 0x51, 0x21, 0x03, 0xb8, 0xc2, 0xb9, 0x44, 0x20, 
+  0x0e, 0x0e, 0x53, 0x20, 0x50, 0x21, 0x25, 0x7e, 0x79, 0x02, 0x00, 0x00, 
+  0x00, 0x8e, 0x02, 0x60, 0x01, 0x64, 0x1c, 0x04, 0x25, 0x00, 0x62, 0xc5, 
+  0x60, 0x01, 0x21, 0x76, 0x0b, 0x60, 0x01, 0x12, 0x40, 0x60, 0x01, 0x20, 
+  0x42, 0x31, 0x60, 0x01, 0x71, 0xd6, 0x0f, 0x20, 0x01, 0x02, 0x40, 0x07, 
+  0x60, 0x01, 0x70, 0x11, 0x82, 0x1b, 0xf2, 0x20, 0x8f, 0x4e, 0x26, 0x00, 
+  0x01, 0x60, 0x01, 0x00, 0x22, 0x00, 0x80, 0x02, 0x40, 0xb2, 0x0f, 0x20, 
+  0x01, 0xa1, 0x41, 0x22, 0x00, 0x00, 0x46, 0x04, 0x00, 0x5e, 0x01, 0xc2, 
+  0x62, 0xc0, 0xa1, 0x41, 0x46, 0x09, 0xe0, 0x01, 0x02, 0x40, 0x12, 0x0d, 
+  0x5c, 0x01, 0x11, 0x02, 0x00, 0x01, 0x11, 0x82, 0x28, 0x01, 0x11, 0x2a, 
+  0x1a, 0x00, 0x22, 0xfa, 0x0c, 0x5c, 0x01, 0x08, 0x1a, 0x00, 0x11, 0x12, 
+  0x1a, 0x00, 0x11, 0xde, 0x1a, 0x00, 0x19, 0xae, 0x1a, 0x00, 0x20, 0xf6, 
+  0x08, 0x1a, 0x00, 0x11, 0xc6, 0x1a, 0x00, 0x00, 0x78, 0x00, 0x00, 0x5c, 
+  0x01, 0x11, 0x3a, 0x9a, 0x00, 0x15, 0x81, 0x28, 0x00, 0x00, 0x5c, 0x01, 
+  0x11, 0xce, 0x28, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x5c, 0x01, 0x30, 0x02, 
+  0x40, 0xbe, 0x10, 0x00, 0x01, 0x5c, 0x01, 0x20, 0x42, 0x31, 0x5c, 0x01, 
+  0x11, 0x06, 0x34, 0x00, 0x02, 0x46, 0x01, 0x80, 0x09, 0xf4, 0x00, 0x8e, 
+  0x0f, 0x08, 0x94, 0x04, 0xba, 0x00, 0xc6, 0xf7, 0xe0, 0x03, 0xf2, 0xea, 
+  0xdd, 0x2f, 0x26, 0x47, 0xf3, 0x46, 0xf4, 0x3e, 0x00, 0x11, 0x82, 0x3e, 
+  0x00, 0x39, 0x03, 0x30, 0x80, 0x64, 0x00, 0x11, 0x6a, 0x64, 0x00, 0xc0, 
+  0x20, 0x8f, 0x0c, 0x75, 0x46, 0x0a, 0xa0, 0x01, 0x02, 0x1c, 0xc3, 0x31, 
+  0x1a, 0x00, 0x51, 0x6c, 0x71, 0x00, 0x41, 0x52, 0x1a, 0x00, 0xa0, 0x1e, 
+  0x0c, 0xaf, 0xeb, 0x0e, 0xd8, 0x20, 0x8f, 0x26, 0x0a, 0x4e, 0x01, 0xa0, 
+  0x6e, 0x0e, 0x20, 0x01, 0xe0, 0xd9, 0x08, 0x45, 0x9a, 0xe8, 0x32, 0x00, 
+  0x11, 0x12, 0x32, 0x00, 0x15, 0x43, 0x32, 0x00, 0x11, 0x1e, 0x32, 0x00, 
+  0xa0, 0xee, 0x0b, 0xaf, 0xeb, 0x12, 0xd8, 0x20, 0x8f, 0xf6, 0x09, 0x32, 
+  0x00, 0xc0, 0x3a, 0x0e, 0x20, 0x01, 0xa0, 0xd9, 0x08, 0x45, 0x36, 0x70, 
+  0x1e, 0xf2, 0x92, 0x00, 0x50, 0x1a, 0xf4, 0x20, 0x8f, 0xda, 0x1a, 0x00, 
+  0x07, 0x74, 0x01, 0x2c, 0x3e, 0x0e, 0x74, 0x01, 0x20, 0x80, 0xb8, 0x76, 
+  0x01, 0xf0, 0x03, 0xce, 0x0f, 0xa0, 0x01, 0x02, 0x40, 0xad, 0x70, 0x45, 
+  0x02, 0x00, 0x00, 0x20, 0x8e, 0x13, 0x09, 0x74, 0x04, 0xf8, 0x02, 0xf5, 
+  0x00, 0xf1, 0xe0, 0xba, 0x05, 0xc2, 0xff, 0x04, 0xf0, 0xe1, 0xe0, 0xb2, 
+  0x05, 0xc2, 0xff, 0x80, 0x8e, 0x02, 0xf4, 0x03, 0x21, 0xd9, 0x6c, 0x71, 
+  0x9e, 0x0f, 0xa0, 0x01, 0x42, 0x40, 0x00, 0x8e, 0x91, 0xe0, 0x96, 0x05, 
+  0xe5, 0xff, 0x4e, 0x02, 0x35, 0xde, 0x0d, 0x20, 0x4e, 0x02, 0x11, 0xd2, 
+  0x0c, 0x00, 0x71, 0x04, 0x14, 0x90, 0x30, 0x0a, 0x14, 0x8e, 0x4a, 0x01, 
+  0x60, 0x53, 0x20, 0x90, 0x20, 0xc2, 0xbe, 0x96, 0x02, 0xf0, 0x01, 0x42, 
+  0x40, 0x04, 0x1c, 0x02, 0x34, 0xb2, 0x0d, 0x20, 0x01, 0x0a, 0x1c, 0x82, 
+  0x33, 0x08, 0x45, 0x92, 0x00, 0x00, 0xb4, 0x00, 0xf0, 0x05, 0x33, 0x6e, 
+  0x6c, 0x20, 0x51, 0x01, 0x53, 0x20, 0x4e, 0x01, 0x05, 0x20, 0x50, 0x20, 
+  0xca, 0x21, 0x22, 0x20, 0xc0, 0x7e, 0x18, 0x00, 0x71, 0xd6, 0xf4, 0x05, 
+  0x21, 0x80, 0x23, 0x0f, 0x80, 0x00, 0x71, 0xc2, 0x33, 0x35, 0xd9, 0x6c, 
+  0x71, 0x1e, 0x80, 0x00, 0x06, 0x0e, 0x03, 0x51, 0x0e, 0x0f, 0xa0, 0x01, 
+  0x01, 0x74, 0x01, 0x08, 0x34, 0x03, 0x20, 0xf6, 0x0e, 0x26, 0x00, 0x00, 
+  0x42, 0x01, 0x20, 0xd2, 0x08, 0x20, 0x00, 0x00, 0x74, 0x01, 0x11, 0x42, 
+  0x42, 0x01, 0x11, 0xde, 0x1a, 0x00, 0x22, 0xaa, 0x0a, 0x74, 0x01, 0x20, 
+  0xb2, 0x08, 0x42, 0x01, 0x22, 0xfa, 0x0c, 0x74, 0x01, 0x40, 0x14, 0x70, 
+  0x9e, 0xf4, 0x34, 0x00, 0x11, 0x9e, 0x34, 0x00, 0x00, 0x76, 0x01, 0x02, 
+  0x34, 0x00, 0x11, 0xaa, 0x34, 0x00, 0x22, 0x76, 0x0a, 0x76, 0x01, 0x11, 
+  0x7e, 0x34, 0x00, 0x22, 0xc6, 0x0c, 0x76, 0x01, 0x4a, 0x14, 0x70, 0x84, 
+  0xf4, 0xb0, 0x03, 0x11, 0x7a, 0x2e, 0x00, 0x06, 0xa2, 0x00, 0x20, 0x6a, 
+  0x0e, 0x4e, 0x00, 0x64, 0x83, 0x30, 0x05, 0x20, 0x50, 0x24, 0xc6, 0x00, 
+  0x00, 0x2c, 0x04, 0xf2, 0x05, 0xa0, 0x01, 0x0f, 0x1c, 0x02, 0x34, 0x41, 
+  0x2e, 0xc0, 0x10, 0x53, 0x26, 0x81, 0x10, 0xc2, 0xb8, 0x05, 0x1c, 0x42, 
+  0x30, 0x38, 0x02, 0x73, 0x42, 0x31, 0x29, 0xd9, 0x6c, 0x71, 0x32, 0x48, 
+  0x00, 0x75, 0x82, 0x30, 0x2a, 0xd9, 0x6c, 0x71, 0x26, 0x56, 0x00, 0x11, 
+  0x75, 0x40, 0x00, 0x11, 0x16, 0x56, 0x00, 0xa6, 0x03, 0x31, 0xe2, 0x09, 
+  0xaf, 0xeb, 0x0c, 0x75, 0xad, 0x70, 0x1a, 0x00, 0x20, 0xfa, 0x0d, 0x1a, 
+  0x00, 0x39, 0x42, 0x33, 0x61, 0xb8, 0x01, 0x2a, 0xe6, 0x0d, 0x96, 0x00, 
+  0x13, 0xd6, 0x26, 0x00, 0x04, 0xb6, 0x00, 0x33, 0x42, 0x40, 0xc2, 0x12, 
+  0x00, 0xe4, 0x39, 0x0b, 0x30, 0x20, 0x0c, 0x75, 0x9a, 0x0f, 0x60, 0x01, 
+  0x20, 0x8f, 0x08, 0x46, 0x16, 0x05, 0x5b, 0xfe, 0x0b, 0x20, 0x01, 0xc1, 
+  0x16, 0x05, 0x20, 0x80, 0xb8, 0x18, 0x05, 0x31, 0xc1, 0x41, 0x8a, 0x5c, 
+  0x00, 0x60, 0xad, 0x78, 0xce, 0xc7, 0xe8, 0xc2, 0x1c, 0x04, 0xf0, 0xdf, 
+  0x9c, 0x12, 0x1f, 0x8f, 0x3c, 0x8f, 0x21, 0x17, 0x83, 0x10, 0x40, 0x28, 
+  0x06, 0x04, 0x20, 0x17, 0x80, 0x10, 0x40, 0x29, 0x07, 0x04, 0x39, 0x8f, 
+  0x22, 0x17, 0x88, 0x10, 0xde, 0x8f, 0x08, 0xbb, 0xbb, 0x8f, 0x1b, 0x63, 
+  0x1d, 0x8f, 0x40, 0x29, 0x0b, 0x04, 0x3a, 0x8f, 0x40, 0x28, 0x08, 0x14, 
+  0x08, 0xbe, 0xc3, 0x45, 0x80, 0x00, 0x00, 0x00, 0x08, 0xbd, 0xd8, 0x60, 
+  0x01, 0x73, 0xcb, 0x41, 0x00, 0xff, 0x00, 0x00, 0x98, 0x8f, 0xb9, 0x61, 
+  0x00, 0x20, 0x8d, 0x01, 0xb0, 0x73, 0x03, 0x87, 0x57, 0x8f, 0xc0, 0x23, 
+  0x46, 0x02, 0x48, 0x33, 0x83, 0x00, 0x08, 0xbc, 0xe0, 0x71, 0x00, 0x30, 
+  0xc8, 0x00, 0x08, 0x17, 0x07, 0x10, 0x01, 0x87, 0x60, 0x87, 0x8c, 0x70, 
+  0x9a, 0x62, 0x04, 0x30, 0x00, 0x91, 0x00, 0x23, 0x8b, 0x10, 0xc5, 0xf6, 
+  0x44, 0x87, 0x02, 0x30, 0x88, 0x10, 0x05, 0xf0, 0x45, 0xf7, 0x44, 0x87, 
+  0x01, 0x30, 0x88, 0x10, 0x0c, 0x23, 0x40, 0x91, 0xcb, 0x44, 0xa1, 0x00, 
+  0x00, 0x12, 0xc0, 0x23, 0x46, 0x12, 0xb0, 0x71, 0x45, 0x84, 0xc0, 0x21, 
+  0x46, 0x02, 0xc3, 0x46, 0x80, 0x3f, 0x00, 0x00, 0x48, 0x31, 0x84, 0x00, 
+  0x27, 0x84, 0x01, 0x32, 0x82, 0x01, 0x00, 0x30, 0x1e, 0x01, 0x01, 0x84, 
+  0x01, 0x31, 0x84, 0x01, 0x00, 0x30, 0x81, 0x10, 0x00, 0x36, 0x02, 0x31, 
+  0x01, 0x30, 0x48, 0x00, 0x23, 0x84, 0x0f, 0x84, 0x48, 0x33, 0x8b, 0x10, 
+  0x01, 0x31, 0x82, 0x00, 0x2a, 0x84, 0x02, 0x30, 0x1e, 0x10, 0x0d, 0x84, 
+  0x00, 0x31, 0x81, 0x07, 0x00, 0x33, 0xc3, 0x02, 0x00, 0x30, 0x80, 0x07, 
+  0x01, 0x32, 0x41, 0x00, 0x01, 0x30, 0x80, 0x01, 0xcb, 0x43, 0xca, 0x06, 
+  0xf0, 0x03, 0x07, 0x31, 0x04, 0x00, 0x06, 0x84, 0x29, 0x84, 0x01, 0x30, 
+  0x82, 0x01, 0x02, 0x84, 0x00, 0x33, 0x82, 0x00, 0x2c, 0x00, 0x00, 0x3e, 
+  0x07, 0x20, 0x0c, 0x84, 0x2a, 0x00, 0x21, 0x70, 0x84, 0x34, 0x00, 0xf0, 
+  0x88, 0x30, 0x80, 0x01, 0x00, 0x33, 0x02, 0x01, 0x07, 0x31, 0x10, 0x00, 
+  0x31, 0x84, 0x00, 0x33, 0x40, 0x00, 0x02, 0x36, 0x1f, 0x00, 0x02, 0x30, 
+  0x80, 0x20, 0x53, 0x84, 0x07, 0x30, 0xc8, 0x07, 0x00, 0x31, 0x00, 0x02, 
+  0x00, 0x31, 0x81, 0x00, 0x02, 0x34, 0x00, 0x00, 0x8c, 0x70, 0x07, 0x30, 
+  0xce, 0x07, 0x12, 0x84, 0x00, 0x33, 0x03, 0x00, 0x02, 0x31, 0x00, 0x00, 
+  0x02, 0x32, 0xc1, 0x00, 0x00, 0x30, 0x03, 0x20, 0x08, 0x84, 0x01, 0x30, 
+  0x90, 0x01, 0x00, 0x31, 0x82, 0x03, 0x2e, 0x84, 0x04, 0x36, 0xc0, 0x92, 
+  0xca, 0x24, 0x69, 0x00, 0xb0, 0x75, 0x00, 0x31, 0x80, 0x07, 0xc0, 0x25, 
+  0x46, 0x12, 0x02, 0x33, 0x82, 0x00, 0x48, 0x35, 0x8d, 0x10, 0x01, 0x30, 
+  0x83, 0x01, 0x00, 0x37, 0x40, 0x03, 0x07, 0x32, 0xdf, 0x07, 0x24, 0x84, 
+  0x4b, 0x84, 0xcc, 0x70, 0xc9, 0x44, 0x00, 0x30, 0x00, 0x04, 0x01, 0x31, 
+  0x01, 0x00, 0x00, 0x32, 0x80, 0x07, 0xc3, 0x42, 0xff, 0x46, 0x00, 0xfe, 
+  0x01, 0x31, 0x00, 0x00, 0x01, 0x41, 0x07, 0x30, 0xe8, 0x07, 0xf0, 0x11, 
+  0xc3, 0x07, 0x4f, 0x23, 0xc0, 0x17, 0x04, 0x33, 0xc0, 0x82, 0xca, 0x26, 
+  0x69, 0x00, 0x04, 0x30, 0x00, 0x90, 0xca, 0x21, 0x05, 0x00, 0x04, 0x36, 
+  0x00, 0x90, 0x68, 0x41, 0xca, 0x24, 0x05, 0x10, 0xd8, 0x07, 0xf2, 0x15, 
+  0xca, 0x21, 0x05, 0x10, 0x04, 0x30, 0xc0, 0x92, 0x40, 0x40, 0x05, 0xf6, 
+  0x07, 0x31, 0x80, 0x0f, 0x7a, 0x3d, 0xf4, 0x01, 0x48, 0x30, 0xc1, 0x02, 
+  0x40, 0x40, 0x0f, 0x0c, 0x31, 0x00, 0x2a, 0xa7, 0x07, 0x34, 0x80, 0x1f, 
+  0x14, 0x00, 0xb2, 0xc0, 0x02, 0x11, 0x0e, 0x31, 0x00, 0x0b, 0xa7, 0x07, 
+  0x31, 0x82, 0x12, 0x00, 0xf2, 0x1f, 0x32, 0xc0, 0x02, 0x6f, 0xa7, 0xce, 
+  0xa7, 0x34, 0x1f, 0x00, 0x12, 0x0c, 0xa7, 0xc8, 0xc6, 0xe2, 0xc3, 0xa1, 
+  0xc1, 0x74, 0x69, 0x44, 0x23, 0x03, 0x0c, 0x34, 0x70, 0x60, 0x41, 0xc0, 
+  0x79, 0x14, 0x72, 0xca, 0x23, 0x41, 0x00, 0xc3, 0xb8, 0x65, 0x78, 0x40, 
+  0x22, 0x0d, 0x07, 0x03, 0xf0, 0x03, 0xd1, 0x30, 0x2c, 0x74, 0x6c, 0x71, 
+  0x2e, 0x0b, 0xa0, 0x01, 0xa1, 0x40, 0xc3, 0x40, 0x72, 0x06, 0xd0, 0x88, 
+  0x0c, 0x75, 0x02, 0x0d, 0x60, 0x01, 0x03, 0x1c, 0x83, 0x30, 0x00, 0x41, 
+  0x22, 0x00, 0x31, 0x6c, 0x71, 0x0e, 0x20, 0x00, 0xf2, 0x01, 0x7f, 0xd8, 
+  0xa2, 0x0e, 0x6f, 0xeb, 0x17, 0xb8, 0xc2, 0xc7, 0xe0, 0x78, 0xec, 0xc3, 
+  0xa2, 0xc1, 0xa2, 0x06, 0xf0, 0x05, 0x30, 0x40, 0x20, 0x8f, 0x10, 0x41, 
+  0xcd, 0x70, 0x0c, 0x75, 0x02, 0x1c, 0x82, 0x33, 0x00, 0x1c, 0x84, 0x33, 
+  0xc2, 0x0c, 0x3e, 0x00, 0xf0, 0x23, 0x82, 0x33, 0x00, 0x41, 0x40, 0x20, 
+  0x00, 0x27, 0x80, 0xc2, 0x6c, 0x73, 0x30, 0x42, 0x22, 0x09, 0x20, 0x01, 
+  0x10, 0x40, 0x02, 0x14, 0x80, 0x30, 0x79, 0x08, 0x55, 0x02, 0x0b, 0x09, 
+  0x31, 0x20, 0xcd, 0x71, 0x36, 0xe8, 0x0b, 0x09, 0x51, 0x20, 0x69, 0x08, 
+  0x50, 0x00, 0x04, 0x77, 0x23, 0x08, 0xb5, 0x00, 0x60, 0x03, 0x00, 0x6e, 
+  0x00, 0xf0, 0x07, 0x42, 0x41, 0x02, 0x40, 0x9a, 0x0a, 0xa0, 0x01, 0x03, 
+  0x1c, 0x42, 0x33, 0xc3, 0x40, 0xc0, 0x40, 0x00, 0x00, 0x2a, 0x0e, 0x4f, 
+  0xeb, 0x34, 0x04, 0xf0, 0x05, 0x07, 0x1c, 0x42, 0x34, 0x06, 0x1c, 0x42, 
+  0x33, 0x62, 0x0c, 0x60, 0x01, 0x04, 0x1c, 0x44, 0x33, 0x40, 0x24, 0xc2, 
+  0x31, 0x3c, 0x04, 0x10, 0x6e, 0xc2, 0x05, 0x90, 0x40, 0x81, 0xc2, 0x2c, 
+  0x74, 0x6c, 0x73, 0xba, 0x08, 0x4e, 0x06, 0x00, 0x5a, 0x00, 0xf0, 0x13, 
+  0xcb, 0x45, 0x18, 0x42, 0x00, 0x00, 0xee, 0x0d, 0x6f, 0xeb, 0xa1, 0x40, 
+  0xc1, 0x40, 0xcc, 0xc7, 0xe4, 0xc3, 0xa1, 0xc1, 0x40, 0x20, 0x0e, 0x07, 
+  0x08, 0x45, 0x80, 0xc2, 0x2e, 0xd9, 0x6c, 0x73, 0xc1, 0x40, 0x48, 0x06, 
+  0x80, 0x8a, 0x08, 0x20, 0x01, 0x00, 0x1c, 0x05, 0x30, 0x9c, 0x00, 0x00, 
+  0x80, 0x00, 0x40, 0x2e, 0xd9, 0xc6, 0xb8, 0x1c, 0x01, 0xff, 0x06, 0x6c, 
+  0x71, 0x16, 0x0a, 0xa0, 0x01, 0xc1, 0x40, 0xb9, 0x15, 0x81, 0x10, 0x0c, 
+  0x70, 0xc6, 0xb9, 0xb9, 0x1d, 0x42, 0x10, 0xc4, 0x44, 0x00, 0x04, 0x1d, 
+  0x46, 0x44, 0x00, 0x13, 0x87, 0x44, 0x00, 0x26, 0xd2, 0x09, 0x44, 0x00, 
+  0x13, 0x87, 0x44, 0x00, 0x80, 0xe0, 0x7f, 0x8a, 0x20, 0x1f, 0x04, 0xe0, 
+  0x78, 0x70, 0x01, 0xe0, 0x10, 0x1e, 0xe0, 0x7f, 0x00, 0x80, 0xe0, 0x78, 
+  0xe4, 0xc2, 0x28, 0x46, 0xc3, 0x41, 0x50, 0x01, 0x20, 0x04, 0xa1, 0x18, 
+  0x00, 0xa0, 0x03, 0x13, 0x05, 0x10, 0x82, 0x04, 0x60, 0x89, 0xcb, 0x45, 
+  0x5a, 0x03, 0xf0, 0x1f, 0x54, 0x70, 0x55, 0x25, 0x01, 0x1e, 0xa1, 0x42, 
+  0xc1, 0x44, 0x04, 0xf2, 0xba, 0x0c, 0x8f, 0xff, 0x04, 0xf0, 0xa2, 0x0d, 
+  0x00, 0x01, 0x3c, 0x4e, 0x55, 0x25, 0x02, 0x1b, 0x30, 0xd9, 0x12, 0xdb, 
+  0xc3, 0x44, 0x14, 0x00, 0xc0, 0x3e, 0xd6, 0x0f, 0xe0, 0x00, 0xc1, 0x45, 
+  0xc4, 0xc6, 0x40, 0x00, 0x13, 0x0c, 0x58, 0x00, 0xf0, 0x01, 0xc3, 0x40, 
+  0x1c, 0x3f, 0x38, 0x41, 0xe0, 0x7e, 0x13, 0x08, 0x50, 0x01, 0x1f, 0x08, 
+  0x51, 0x00, 0x1c, 0x00, 0x60, 0x14, 0x1e, 0x00, 0x88, 0x06, 0xf0, 0x0a, 
+  0x00, 0xf0, 0x15, 0x99, 0x12, 0x00, 0x88, 0xc1, 0xb8, 0x00, 0xa9, 0x00, 
+  0x1a, 0x85, 0x00, 0xe0, 0x7f, 0x0c, 0x70, 0xe0, 0x78, 0xfa, 0xc2, 0xfc, 
+  0x1c, 0xc8, 0xb6, 0xaa, 0xc1, 0x42, 0xc0, 0xb6, 0xd8, 0x26, 0x1c, 0x02, 
+  0x30, 0x02, 0xc0, 0x96, 0x01, 0x40, 0x82, 0x39, 0x1c, 0xe0, 0xf2, 0x07, 
+  0xf0, 0x0b, 0x0e, 0x1c, 0x42, 0x33, 0x0c, 0x1c, 0x44, 0x33, 0x1b, 0x1c, 
+  0x42, 0x33, 0xfa, 0x08, 0xa0, 0x01, 0x40, 0xc0, 0xc6, 0x0c, 0x6f, 0xeb, 
+  0x0a, 0xd8, 0x00, 0xc0, 0x24, 0x00, 0x00, 0x22, 0x00, 0x93, 0xe2, 0x08, 
+  0xa0, 0x01, 0x26, 0x1c, 0x42, 0x33, 0xae, 0x18, 0x00, 0xf2, 0x29, 0x83, 
+  0xc2, 0x2c, 0x70, 0x26, 0x0f, 0xe0, 0x00, 0x6c, 0x73, 0x14, 0x70, 0x22, 
+  0xdd, 0x09, 0xf4, 0x0e, 0x14, 0x81, 0x30, 0x1f, 0x09, 0xf0, 0x0c, 0x8c, 
+  0x21, 0x02, 0x88, 0x21, 0xdd, 0x0a, 0x04, 0x02, 0x00, 0x00, 0x1e, 0x43, 
+  0x70, 0xa1, 0x00, 0x16, 0x1e, 0xc3, 0x40, 0xab, 0x43, 0x7b, 0x14, 0x08, 
+  0xf0, 0xc3, 0x40, 0xcb, 0x41, 0x85, 0xeb, 0x16, 0x00, 0x22, 0x08, 0x1e, 
+  0x00, 0x01, 0xf0, 0x07, 0xed, 0x70, 0x0e, 0x70, 0xcd, 0x70, 0x00, 0x1d, 
+  0x42, 0x10, 0xac, 0x1d, 0x00, 0x10, 0x4f, 0x20, 0x40, 0x21, 0x27, 0x1c, 
+  0x02, 0x30, 0x76, 0x00, 0xf0, 0x13, 0xc2, 0x39, 0x50, 0xd9, 0x4a, 0x23, 
+  0x40, 0x00, 0x06, 0x1c, 0xc2, 0x33, 0x66, 0x08, 0xa0, 0x01, 0x04, 0x1c, 
+  0xc4, 0x33, 0x32, 0x0c, 0x6f, 0xeb, 0x0c, 0x71, 0x00, 0xc0, 0x81, 0xc2, 
+  0x55, 0xd9, 0xaa, 0x0e, 0x7c, 0x00, 0xf1, 0x0a, 0x06, 0x14, 0x80, 0x30, 
+  0x46, 0x20, 0xbe, 0x87, 0x47, 0xc0, 0xf2, 0xf3, 0x07, 0xc0, 0x29, 0x08, 
+  0x35, 0x08, 0x81, 0xc2, 0x00, 0xc0, 0x52, 0xd9, 0x8e, 0x1e, 0x00, 0xb5, 
+  0x00, 0xc0, 0x06, 0x14, 0x8e, 0x30, 0x81, 0xc2, 0x53, 0xd9, 0x7e, 0x2e, 
+  0x00, 0xf0, 0x15, 0x08, 0xbe, 0x05, 0x7e, 0x14, 0x25, 0x00, 0x14, 0x06, 
+  0x71, 0x95, 0x08, 0x34, 0xa8, 0x50, 0x18, 0x84, 0x03, 0x8c, 0x15, 0x0c, 
+  0x11, 0x6c, 0x15, 0x10, 0x11, 0x6a, 0x15, 0x01, 0x11, 0x7a, 0x15, 0x00, 
+  0x11, 0xcb, 0x43, 0x4d, 0x05, 0xf0, 0x89, 0x29, 0xbc, 0x53, 0x20, 0xd1, 
+  0x22, 0x41, 0x29, 0xc4, 0x01, 0x2f, 0x27, 0x47, 0x00, 0x28, 0xb9, 0xc5, 
+  0xbc, 0x0c, 0x21, 0xc0, 0xa2, 0x84, 0x24, 0x04, 0x00, 0x6e, 0x15, 0x0f, 
+  0x11, 0x70, 0x15, 0x03, 0x11, 0x44, 0xc0, 0x7c, 0x15, 0x00, 0x11, 0x80, 
+  0x15, 0x05, 0x11, 0x90, 0x1d, 0x02, 0x13, 0x7c, 0x24, 0x8c, 0x14, 0xc0, 
+  0x21, 0x86, 0x2f, 0xff, 0xff, 0x00, 0xf0, 0x02, 0x21, 0x01, 0x01, 0x0f, 
+  0xda, 0x98, 0x1d, 0x02, 0x13, 0x48, 0x31, 0x8c, 0x20, 0x48, 0x31, 0x81, 
+  0x00, 0x08, 0xba, 0x48, 0xc1, 0x82, 0xa5, 0x40, 0x2b, 0x0c, 0x11, 0x41, 
+  0x28, 0x01, 0x21, 0x72, 0x15, 0x1e, 0x11, 0x45, 0xc0, 0x6f, 0x78, 0x41, 
+  0x2b, 0xd4, 0x01, 0x41, 0x2b, 0x12, 0x02, 0xef, 0x7b, 0x44, 0x79, 0x04, 
+  0x24, 0x4c, 0x11, 0x78, 0x15, 0x08, 0x11, 0x04, 0x27, 0x8e, 0x10, 0x17, 
+  0x25, 0x16, 0x03, 0x3c, 0x63, 0x04, 0xc1, 0x74, 0x15, 0x09, 0x11, 0xd8, 
+  0x60, 0x76, 0x15, 0x06, 0x11, 0x71, 0x70, 0x41, 0x2e, 0xce, 0x31, 0xc0, 
+  0x20, 0x86, 0x0f, 0x60, 0x00, 0xf0, 0xb7, 0x41, 0x2e, 0x13, 0x32, 0x41, 
+  0x28, 0xd5, 0x11, 0x84, 0x24, 0x04, 0x20, 0x84, 0x26, 0x04, 0x10, 0x2f, 
+  0x7b, 0x05, 0xc1, 0x41, 0x28, 0x02, 0x12, 0x02, 0x22, 0x0f, 0x25, 0x41, 
+  0x29, 0xd2, 0x11, 0x41, 0x29, 0x14, 0x12, 0x2f, 0x20, 0x47, 0x22, 0x84, 
+  0x25, 0x04, 0x20, 0x02, 0x23, 0x89, 0x23, 0x48, 0x30, 0x8e, 0x00, 0x08, 
+  0xc0, 0xc3, 0x44, 0x80, 0x3b, 0x00, 0x00, 0x2f, 0x21, 0x87, 0x27, 0x41, 
+  0x2e, 0xd7, 0x01, 0x41, 0x2e, 0x18, 0x02, 0x2f, 0x26, 0x87, 0x31, 0x02, 
+  0x22, 0x46, 0x05, 0x84, 0x22, 0x04, 0x20, 0xdb, 0x43, 0x80, 0x38, 0x00, 
+  0x00, 0x50, 0x24, 0xd9, 0x05, 0x2f, 0x7a, 0x02, 0x24, 0x81, 0x24, 0x48, 
+  0x31, 0x92, 0x10, 0x48, 0x37, 0x89, 0x10, 0x48, 0x36, 0x95, 0x00, 0x84, 
+  0x27, 0x04, 0x20, 0x00, 0x31, 0x06, 0x11, 0x00, 0x30, 0x49, 0x06, 0x00, 
+  0x35, 0xc0, 0x26, 0x2f, 0x25, 0x07, 0x02, 0x02, 0x20, 0xc8, 0x35, 0x8a, 
+  0x27, 0x3c, 0x30, 0x8c, 0x27, 0x02, 0x80, 0x48, 0x30, 0x8f, 0x10, 0x01, 
+  0x30, 0x88, 0x0f, 0xd1, 0xb8, 0x17, 0xb7, 0x04, 0xc0, 0xc0, 0x27, 0xc6, 
+  0x07, 0x71, 0x74, 0x00, 0x37, 0xcb, 0x16, 0x04, 0xc7, 0x27, 0xb8, 0x48, 
+  0x36, 0x96, 0x20, 0x28, 0xbf, 0x84, 0x20, 0x04, 0x00, 0x48, 0x31, 0x94, 
+  0x00, 0x00, 0x36, 0x41, 0x26, 0x10, 0x4f, 0xc4, 0xa5, 0xc0, 0x24, 0x86, 
+  0x1f, 0xca, 0x00, 0xf2, 0x35, 0x8c, 0x21, 0x02, 0xa0, 0xcb, 0x46, 0x48, 
+  0x44, 0x00, 0x00, 0x48, 0x30, 0x80, 0x00, 0x01, 0x31, 0x93, 0x0f, 0xb8, 
+  0x41, 0x00, 0x00, 0x00, 0x34, 0xc1, 0x26, 0xc0, 0x21, 0xc6, 0x27, 0x8c, 
+  0x25, 0x02, 0x80, 0x07, 0x30, 0x94, 0x03, 0x05, 0xc0, 0xc0, 0x25, 0xc6, 
+  0x07, 0x8c, 0x26, 0x02, 0xb0, 0x05, 0xc7, 0xc0, 0x26, 0xc6, 0x37, 0x8c, 
+  0x20, 0x02, 0xa0, 0x27, 0xb8, 0xc0, 0x20, 0xc6, 0x27, 0x8c, 0x23, 0x02, 
+  0x80, 0x5e, 0x00, 0xf1, 0x02, 0xc0, 0x23, 0xc6, 0x07, 0x8c, 0x22, 0x02, 
+  0x80, 0x10, 0x4f, 0xc0, 0x22, 0xc6, 0x07, 0x48, 0x37, 0x87, 0x52, 0x00, 
+  0x00, 0xf6, 0x06, 0xf0, 0x5b, 0x48, 0x32, 0x82, 0x00, 0x07, 0x37, 0x87, 
+  0x0f, 0xa0, 0x40, 0x00, 0x00, 0x2c, 0xa5, 0x3c, 0x1d, 0xc0, 0x14, 0x18, 
+  0x1d, 0x80, 0x11, 0x14, 0x1d, 0x40, 0x12, 0x07, 0x30, 0x8f, 0x03, 0x38, 
+  0x1d, 0x00, 0x12, 0x34, 0x1d, 0xc0, 0x12, 0x44, 0x1d, 0x00, 0x15, 0x07, 
+  0x33, 0x95, 0x03, 0x04, 0x1d, 0xc0, 0x11, 0x07, 0x32, 0x80, 0x03, 0xf3, 
+  0xa5, 0x48, 0x31, 0x91, 0x20, 0x48, 0x35, 0x85, 0x00, 0x00, 0x31, 0x01, 
+  0x21, 0x00, 0x35, 0x82, 0x0f, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x31, 0x81, 
+  0x0f, 0x23, 0x3c, 0x0a, 0xd7, 0x4b, 0xa5, 0x07, 0xc2, 0x48, 0x36, 0x9e, 
+  0x30, 0x48, 0x30, 0x90, 0x20, 0x00, 0x32, 0x12, 0x21, 0x27, 0xa5, 0x00, 
+  0x36, 0x81, 0x3f, 0x22, 0x00, 0x40, 0x00, 0x30, 0x83, 0x2f, 0x08, 0x00, 
+  0xf4, 0x0c, 0x48, 0x34, 0x8c, 0x10, 0x20, 0x1d, 0x80, 0x14, 0x83, 0xa5, 
+  0x2a, 0xa5, 0x69, 0xa5, 0x40, 0x1d, 0x40, 0x15, 0x31, 0x0a, 0x35, 0x08, 
+  0x12, 0xa5, 0x80, 0xd8, 0x1b, 0xe2, 0x02, 0x90, 0x36, 0x50, 0xd9, 0x8e, 
+  0x0d, 0x60, 0x01, 0x6c, 0x71, 0xb2, 0x03, 0xf1, 0x01, 0x94, 0x12, 0x00, 
+  0x18, 0x80, 0x0f, 0x14, 0x00, 0xe0, 0x16, 0x42, 0x0f, 0x6f, 0xff, 0x02, 
+  0xc0, 0x62, 0x03, 0x31, 0x75, 0xc6, 0x0b, 0xc8, 0x02, 0x21, 0x16, 0x80, 
+  0x34, 0x03, 0xc2, 0x06, 0xe8, 0x0e, 0x14, 0x80, 0x30, 0x45, 0x20, 0xc0, 
+  0x01, 0x0b, 0xf0, 0x14, 0x00, 0x31, 0x16, 0x1e, 0x07, 0x14, 0x00, 0x46, 
+  0x85, 0x20, 0x01, 0x0c, 0x58, 0x00, 0x31, 0x2c, 0x75, 0x36, 0x58, 0x00, 
+  0x51, 0x00, 0xc0, 0xad, 0x70, 0x81, 0xce, 0x04, 0x00, 0x5c, 0x05, 0x40, 
+  0x7a, 0x0b, 0xe0, 0x00, 0x5c, 0x05, 0x00, 0x06, 0x03, 0xf1, 0x00, 0x40, 
+  0x24, 0x82, 0x31, 0x2e, 0xd9, 0x6c, 0x20, 0xc0, 0x00, 0x45, 0x20, 0x80, 
+  0x03, 0x06, 0x3a, 0x00, 0x00, 0x1c, 0x06, 0x80, 0x6c, 0x71, 0x02, 0xc0, 
+  0x00, 0x1e, 0x42, 0x73, 0x4c, 0x04, 0xf0, 0x17, 0xb9, 0x10, 0x81, 0x00, 
+  0x4e, 0x80, 0xc6, 0xb9, 0xb9, 0x18, 0x42, 0x00, 0x02, 0xc1, 0x60, 0x7a, 
+  0x0c, 0x70, 0xc3, 0x42, 0x80, 0x3a, 0x5b, 0x9e, 0xc3, 0x41, 0xeb, 0x3b, 
+  0xf6, 0x1b, 0xc3, 0x40, 0xe7, 0x3b, 0x47, 0xab, 0x00, 0x1e, 0x86, 0x00, 
+  0xf3, 0x02, 0xa8, 0x12, 0x00, 0x1e, 0x40, 0x70, 0xa1, 0x00, 0xa4, 0x12, 
+  0x00, 0x1e, 0x00, 0x70, 0xa1, 0x00, 0xa0, 0x08, 0x00, 0xf0, 0x05, 0x9c, 
+  0x12, 0xa1, 0x40, 0xaa, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xda, 0xc6, 0xea, 
+  0xc3, 0xa4, 0xc1, 0x28, 0x45, 0xcb, 0x46, 0xc8, 0x00, 0xf1, 0x4c, 0x1b, 
+  0x08, 0xb4, 0x00, 0x08, 0x47, 0x2f, 0x0f, 0x30, 0x14, 0x0c, 0x70, 0x8c, 
+  0x27, 0x02, 0x90, 0x0a, 0xf2, 0x8c, 0x27, 0xc3, 0x9f, 0x08, 0xf2, 0x0b, 
+  0xf0, 0x0c, 0x70, 0x82, 0x09, 0xef, 0xff, 0xa1, 0x41, 0x07, 0xe8, 0x0c, 
+  0x70, 0xa1, 0x41, 0xc6, 0x0d, 0xe0, 0x00, 0xe2, 0xa6, 0x02, 0x86, 0xca, 
+  0xc7, 0x20, 0x8e, 0x83, 0x42, 0x06, 0xb2, 0x02, 0xb2, 0x40, 0xc0, 0x0e, 
+  0x1c, 0x02, 0x30, 0x3a, 0x0e, 0x20, 0x01, 0x0c, 0x75, 0xd3, 0x40, 0xa1, 
+  0x00, 0x8c, 0x42, 0x83, 0xc2, 0x6c, 0x73, 0x00, 0x41, 0x9e, 0x0a, 0xe0, 
+  0x00, 0x02, 0x40, 0x0c, 0x70, 0x46, 0x3e, 0x00, 0xd1, 0x0c, 0x74, 0x2c, 
+  0x71, 0xde, 0x08, 0xef, 0xff, 0xa1, 0x42, 0x20, 0x8e, 0x0e, 0x2c, 0x00, 
+  0x90, 0x70, 0xda, 0x40, 0x25, 0x0f, 0x17, 0x07, 0x1c, 0x82, 0xc6, 0x05, 
+  0x01, 0x5a, 0x06, 0xf0, 0x01, 0x12, 0x0c, 0x60, 0x01, 0xe1, 0x40, 0xe2, 
+  0x0f, 0x2f, 0xeb, 0x0c, 0x71, 0x20, 0x8e, 0xea, 0x0d, 0x26, 0x00, 0x01, 
+  0x16, 0x07, 0xf4, 0x18, 0x31, 0x6c, 0x71, 0xe1, 0x40, 0x07, 0x1c, 0x43, 
+  0x31, 0xf2, 0x0b, 0x60, 0x01, 0x30, 0x41, 0xbe, 0x0f, 0x2f, 0xeb, 0x1e, 
+  0xd8, 0x80, 0xc0, 0x3e, 0x0d, 0x6f, 0xff, 0xa1, 0x41, 0x92, 0xe8, 0x05, 
+  0x14, 0x80, 0x30, 0x1d, 0x08, 0x71, 0x01, 0x2a, 0x00, 0xb0, 0x22, 0x41, 
+  0xca, 0x0b, 0x60, 0x01, 0x07, 0x1c, 0x03, 0x32, 0x96, 0x4c, 0x00, 0x41, 
+  0x74, 0x80, 0xc0, 0x16, 0x2a, 0x00, 0x11, 0x91, 0x2a, 0x00, 0x37, 0x1f, 
+  0x08, 0xf1, 0x2a, 0x00, 0x12, 0x9e, 0x2a, 0x00, 0xb0, 0x31, 0x6a, 0x0f, 
+  0x2f, 0xeb, 0x10, 0xd8, 0x80, 0xc0, 0xea, 0x0c, 0x2a, 0x00, 0x11, 0x89, 
+  0x2a, 0x00, 0xf1, 0x0a, 0x0b, 0x08, 0x31, 0x01, 0x0c, 0x71, 0x52, 0x0f, 
+  0x0f, 0xeb, 0x0d, 0xd8, 0x8e, 0x0b, 0xe0, 0x00, 0xa1, 0x41, 0x60, 0xdf, 
+  0xb3, 0xe8, 0x0b, 0xd8, 0x82, 0x0c, 0x00, 0x40, 0xaf, 0xe8, 0x15, 0xd8, 
+  0xc0, 0x01, 0x71, 0xa1, 0x41, 0xa9, 0xe8, 0x13, 0xd8, 0x6e, 0x0a, 0x00, 
+  0xf2, 0x08, 0xa5, 0xe8, 0x82, 0xc2, 0x60, 0xd9, 0x6c, 0x73, 0x02, 0x40, 
+  0x0a, 0x1c, 0x03, 0x30, 0x9a, 0x09, 0xe0, 0x00, 0x08, 0x1c, 0x05, 0x30, 
+  0x0a, 0xde, 0x01, 0x81, 0x32, 0x60, 0xd9, 0x6c, 0x20, 0x00, 0x01, 0x0a, 
+  0xac, 0x06, 0x80, 0x26, 0x0b, 0x60, 0x01, 0x02, 0x40, 0xf6, 0x0e, 0xec, 
+  0x00, 0x00, 0x2e, 0x02, 0x90, 0x0f, 0x08, 0x71, 0x00, 0xed, 0x72, 0x0c, 
+  0x71, 0x16, 0x24, 0x01, 0xf2, 0x1a, 0x41, 0x49, 0x86, 0x08, 0x86, 0x8c, 
+  0x70, 0x48, 0x30, 0xc1, 0x02, 0x48, 0x32, 0xc0, 0x02, 0x2e, 0x7a, 0x0e, 
+  0x7b, 0xe1, 0x41, 0xae, 0x09, 0xe0, 0x00, 0xa1, 0x40, 0x4e, 0x85, 0x0c, 
+  0x70, 0x60, 0x7a, 0xa1, 0x41, 0x10, 0xd8, 0xca, 0xc7, 0xea, 0xc2, 0xbc, 
+  0x01, 0xf0, 0x32, 0xe1, 0x86, 0x08, 0x45, 0x0c, 0x70, 0xde, 0x0f, 0xaf, 
+  0xff, 0x30, 0x40, 0x4c, 0x10, 0x01, 0x20, 0x10, 0x41, 0x60, 0x79, 0x02, 
+  0x40, 0x99, 0x09, 0x10, 0x20, 0x9c, 0x10, 0x01, 0x20, 0xa0, 0x10, 0x00, 
+  0x20, 0xc3, 0x42, 0xc8, 0x43, 0x00, 0x00, 0x04, 0x31, 0x40, 0x83, 0xca, 
+  0x25, 0x45, 0x10, 0x04, 0x35, 0x00, 0x90, 0xca, 0x25, 0x05, 0x10, 0x04, 
+  0x35, 0x80, 0x90, 0x4f, 0xf6, 0xc3, 0x40, 0x48, 0x1c, 0x00, 0x70, 0x35, 
+  0x00, 0x90, 0x6a, 0x00, 0x2b, 0x00, 0x14, 0x00, 0xe4, 0x62, 0x00, 0x06, 
+  0x00, 0x01, 0xa6, 0xad, 0x73, 0x03, 0xf0, 0x41, 0xa6, 0xad, 0x72, 0xbc, 
+  0x06, 0xf5, 0x16, 0x02, 0x42, 0x78, 0x20, 0x01, 0x00, 0x1a, 0x0f, 0xaf, 
+  0xff, 0xa1, 0x40, 0x02, 0x86, 0x8c, 0x20, 0xc3, 0x8f, 0xcc, 0x20, 0x82, 
+  0x8f, 0x00, 0x00, 0x80, 0x00, 0x0c, 0xf4, 0x0c, 0x71, 0x5e, 0x0f, 0xaf, 
+  0xff, 0x02, 0x41, 0x48, 0x7e, 0x00, 0x41, 0x1b, 0x09, 0x10, 0x20, 0x64, 
+  0x07, 0x20, 0x13, 0x1a, 0x7c, 0x01, 0xf0, 0x04, 0x40, 0x0c, 0x70, 0xbe, 
+  0x0b, 0xe0, 0x00, 0x02, 0x41, 0xe1, 0x86, 0xe1, 0x40, 0xca, 0xc6, 0xc3, 
+  0x41, 0xc8, 0x42, 0x74, 0x00, 0x40, 0x40, 0x90, 0x87, 0xf6, 0x7a, 0x00, 
+  0xb1, 0x45, 0xf7, 0x21, 0xa6, 0xad, 0x74, 0xcb, 0xf1, 0xc3, 0x40, 0x48, 
+  0x18, 0x00, 0x11, 0x00, 0x18, 0x00, 0xed, 0x40, 0x90, 0x45, 0xf7, 0x01, 
+  0xa6, 0xad, 0x75, 0xbf, 0xf1, 0xc3, 0x41, 0xc8, 0x41, 0x30, 0x00, 0x20, 
+  0x76, 0xb3, 0x30, 0x00, 0x01, 0x18, 0x00, 0x08, 0x30, 0x00, 0x30, 0x07, 
+  0xdd, 0xa7, 0x30, 0x00, 0x1c, 0x40, 0x30, 0x00, 0x30, 0x08, 0xdd, 0x9b, 
+  0x30, 0x00, 0x01, 0x18, 0x00, 0x08, 0x30, 0x00, 0xf0, 0x07, 0x09, 0xdd, 
+  0x8f, 0xf1, 0xc3, 0x40, 0xc8, 0x3f, 0x00, 0x00, 0x0a, 0xdd, 0x01, 0xa6, 
+  0x89, 0xf1, 0xe0, 0x78, 0xe4, 0xc3, 0xcb, 0x44, 0xf4, 0x00, 0xf0, 0x09, 
+  0x57, 0x08, 0xb0, 0x02, 0xa1, 0xc1, 0x63, 0x08, 0x50, 0x01, 0x9b, 0x08, 
+  0x71, 0x00, 0x23, 0xd8, 0x5f, 0x0a, 0xb4, 0x00, 0xcd, 0x70, 0x00, 0x89, 
+  0x28, 0x07, 0xf1, 0x22, 0x14, 0x1e, 0x03, 0x1c, 0x82, 0x33, 0x02, 0x1c, 
+  0x82, 0x33, 0x00, 0x1c, 0x84, 0x33, 0x40, 0x23, 0x0e, 0x07, 0x00, 0xad, 
+  0x80, 0xc2, 0x2c, 0x74, 0x6c, 0x73, 0xa6, 0x0f, 0xa0, 0x00, 0xc1, 0x40, 
+  0x00, 0x8d, 0x35, 0x08, 0xd0, 0x00, 0x3b, 0x08, 0x50, 0x00, 0x43, 0x08, 
+  0x90, 0x00, 0xa6, 0xe8, 0x02, 0x16, 0x07, 0xf0, 0x0f, 0x00, 0x0c, 0x1e, 
+  0xf0, 0x00, 0x89, 0x2d, 0x83, 0x79, 0x20, 0x00, 0x00, 0x01, 0xac, 0x60, 
+  0x79, 0x60, 0x40, 0x1f, 0xf0, 0x20, 0x89, 0x0c, 0x70, 0xc1, 0xb9, 0x20, 
+  0xac, 0xc4, 0xc7, 0x24, 0x00, 0x64, 0x45, 0x20, 0x00, 0x0c, 0x0c, 0xf0, 
+  0x2e, 0x00, 0x35, 0x84, 0xb8, 0x06, 0x0c, 0x00, 0x50, 0x85, 0xb8, 0x03, 
+  0x1c, 0x02, 0x2c, 0x03, 0xf1, 0x25, 0x30, 0x2c, 0x74, 0x6c, 0x71, 0xe6, 
+  0x08, 0x60, 0x01, 0xc1, 0x40, 0x0c, 0x70, 0xc4, 0xc7, 0xe0, 0x78, 0xea, 
+  0xc2, 0x30, 0x40, 0x96, 0x0a, 0xef, 0xeb, 0x10, 0x41, 0x06, 0x09, 0xef, 
+  0xeb, 0x08, 0x46, 0x08, 0x45, 0x3b, 0xd8, 0xc1, 0x41, 0x7e, 0x0a, 0xef, 
+  0xeb, 0xa1, 0x42, 0x08, 0x47, 0x0b, 0xd8, 0xc1, 0x41, 0x72, 0x0c, 0x00, 
+  0x80, 0x09, 0x09, 0x30, 0x20, 0x08, 0x46, 0xca, 0xc6, 0xd2, 0x01, 0xf0, 
+  0x3f, 0xac, 0x16, 0x2a, 0x88, 0xf7, 0x09, 0x1e, 0x80, 0x62, 0x88, 0x81, 
+  0x88, 0x25, 0x88, 0x44, 0x88, 0x03, 0x10, 0x8b, 0x00, 0x00, 0x88, 0x10, 
+  0xbb, 0x08, 0xbc, 0x09, 0x16, 0x88, 0x10, 0x10, 0xb9, 0x08, 0xba, 0x85, 
+  0x7b, 0xbf, 0x86, 0x45, 0x79, 0x65, 0x78, 0x05, 0x21, 0xc1, 0x02, 0x08, 
+  0xb8, 0x3b, 0x79, 0x48, 0xb8, 0x22, 0xa5, 0x25, 0x08, 0x30, 0x10, 0x03, 
+  0xa5, 0x1e, 0x8d, 0x5c, 0x8d, 0x04, 0x71, 0x0f, 0x79, 0x15, 0x09, 0xa1, 
+  0x00, 0x1e, 0xad, 0xc2, 0x0c, 0xcf, 0xeb, 0xea, 0x02, 0xf1, 0x00, 0xc1, 
+  0x42, 0x1e, 0x1d, 0x03, 0x10, 0x11, 0xef, 0x09, 0x8f, 0x0f, 0xe8, 0x1f, 
+  0x8d, 0x5d, 0x22, 0x00, 0xf1, 0x26, 0x17, 0x09, 0xa1, 0x00, 0x1f, 0xad, 
+  0x9e, 0x0c, 0xcf, 0xeb, 0x76, 0x09, 0xe0, 0x00, 0xe1, 0x42, 0x1f, 0x1d, 
+  0x03, 0x10, 0xc3, 0x42, 0xa1, 0x00, 0x4e, 0x1f, 0x40, 0x20, 0x00, 0x27, 
+  0x37, 0xd9, 0x6c, 0x71, 0x8c, 0x70, 0xac, 0x70, 0x42, 0x08, 0x60, 0x01, 
+  0x00, 0x1a, 0x83, 0x00, 0xca, 0xc6, 0xe0, 0x78, 0xe4, 0xc2, 0xce, 0xc4, 
+  0x00, 0xf0, 0x0b, 0x3a, 0x08, 0xef, 0xeb, 0x08, 0x45, 0x00, 0x42, 0x3b, 
+  0xd8, 0xb6, 0x09, 0xef, 0xeb, 0xa1, 0x41, 0x0c, 0xe8, 0xb9, 0x10, 0xc0, 
+  0x00, 0x15, 0x08, 0x12, 0x00, 0xbe, 0x00, 0xf2, 0x0f, 0x4c, 0x1f, 0x3e, 
+  0x0b, 0xe0, 0x00, 0x00, 0x10, 0xc0, 0x00, 0xb9, 0x16, 0x81, 0x10, 0x0c, 
+  0x70, 0xc6, 0xb9, 0xb9, 0x1e, 0x42, 0x10, 0xc4, 0xc6, 0xe0, 0x78, 0xe2, 
+  0xc2, 0x08, 0x45, 0x22, 0x00, 0x14, 0x32, 0x22, 0x00, 0x10, 0x15, 0x22, 
+  0x00, 0xf2, 0x0f, 0x87, 0xb9, 0xb9, 0x1d, 0x42, 0x10, 0xc2, 0xc6, 0xe0, 
+  0x7f, 0xa6, 0x10, 0x00, 0x01, 0xe0, 0x78, 0x1f, 0x80, 0xe0, 0x7f, 0x08, 
+  0x80, 0xe0, 0x78, 0x00, 0x42, 0x20, 0x40, 0x00, 0x7a, 0x10, 0x00, 0xf0, 
+  0x35, 0x05, 0x80, 0xe0, 0x78, 0x0f, 0xd8, 0xe0, 0x7f, 0x1a, 0xb8, 0xe0, 
+  0x78, 0xe8, 0xc3, 0xa2, 0xc1, 0xdf, 0x83, 0x50, 0x40, 0x28, 0x45, 0x2c, 
+  0x70, 0x14, 0x71, 0x24, 0xd8, 0x41, 0xc1, 0x40, 0xc1, 0x29, 0xf4, 0x3c, 
+  0x4b, 0x80, 0xc2, 0x30, 0xd9, 0xc2, 0x0d, 0xa0, 0x00, 0x07, 0xdb, 0x20, 
+  0xc0, 0x01, 0x14, 0x81, 0x30, 0x05, 0xae, 0x41, 0x29, 0xc0, 0x00, 0x53, 
+  0x21, 0x82, 0x00, 0xc2, 0xb8, 0x44, 0xae, 0x03, 0xae, 0xca, 0x05, 0xa0, 
+  0xc2, 0xb8, 0x02, 0xae, 0x06, 0x14, 0x81, 0x30, 0x53, 0x68, 0x1c, 0x00, 
+  0xf0, 0x1b, 0xc2, 0xb8, 0x01, 0xae, 0x45, 0x78, 0x00, 0xad, 0x04, 0x8e, 
+  0x23, 0x8e, 0x03, 0xb8, 0x25, 0x78, 0x01, 0xad, 0x25, 0x8e, 0x0c, 0x70, 
+  0x22, 0xad, 0x00, 0x18, 0xc5, 0x20, 0xc8, 0xc7, 0xea, 0xc3, 0x10, 0x40, 
+  0xff, 0x80, 0xb6, 0xd8, 0xfc, 0x1c, 0x0c, 0xb0, 0x14, 0x01, 0xf0, 0x1d, 
+  0x80, 0xc2, 0x7e, 0xd9, 0x6c, 0x71, 0x02, 0x1c, 0x05, 0x30, 0x06, 0x0f, 
+  0x20, 0x01, 0x10, 0x41, 0x0c, 0x70, 0x9a, 0x0a, 0x2f, 0xeb, 0x9e, 0xb8, 
+  0x40, 0x24, 0x82, 0x30, 0x2c, 0x71, 0x6c, 0x71, 0x46, 0x0d, 0xa0, 0x00, 
+  0x22, 0x40, 0xf3, 0x08, 0x31, 0x00, 0x22, 0xdd, 0x1a, 0x02, 0x60, 0x21, 
+  0xdd, 0xd0, 0xe0, 0x71, 0xf4, 0x1e, 0x00, 0x51, 0x36, 0xd9, 0x6c, 0x72, 
+  0x2a, 0x1e, 0x00, 0x11, 0x03, 0x70, 0x04, 0xb1, 0x42, 0x30, 0x37, 0xd9, 
+  0x84, 0x20, 0x01, 0x0f, 0x87, 0xb8, 0x01, 0x72, 0x04, 0x60, 0xb6, 0x0e, 
+  0x20, 0x01, 0x22, 0x40, 0x34, 0x00, 0xf0, 0x09, 0x03, 0x14, 0x81, 0x30, 
+  0x80, 0xc2, 0x84, 0x20, 0x02, 0x00, 0x86, 0xb8, 0x60, 0xc0, 0x00, 0x8f, 
+  0x84, 0x21, 0xc2, 0x00, 0x6c, 0x72, 0x02, 0xb8, 0x2e, 0x00, 0x20, 0x25, 
+  0x78, 0x2e, 0x00, 0x31, 0x36, 0xd9, 0x86, 0x2e, 0x00, 0x00, 0x58, 0x00, 
+  0x60, 0x30, 0xd9, 0x6c, 0x72, 0xd2, 0x0c, 0x58, 0x00, 0x00, 0x3c, 0x00, 
+  0x00, 0x00, 0x01, 0xf0, 0x0f, 0x45, 0x20, 0x00, 0x0b, 0x60, 0xc0, 0x6c, 
+  0x72, 0x22, 0x40, 0x62, 0x0e, 0x20, 0x01, 0x01, 0x1c, 0x43, 0x32, 0x20, 
+  0xc0, 0x8a, 0x21, 0x04, 0x00, 0xad, 0x70, 0x21, 0xb7, 0x05, 0xaf, 0x34, 
+  0x00, 0xf2, 0x05, 0x15, 0xd9, 0x6c, 0x71, 0x22, 0x40, 0x04, 0x1f, 0x43, 
+  0x10, 0xa8, 0xa7, 0xa1, 0xaf, 0x92, 0x0c, 0xa0, 0x00, 0xa5, 0xa7, 0x3e, 
+  0x00, 0x91, 0x15, 0xd9, 0x80, 0xb8, 0x60, 0xc0, 0x6c, 0x71, 0x26, 0x60, 
+  0x00, 0x00, 0xc0, 0x04, 0xe2, 0x4c, 0x1f, 0x00, 0x16, 0xc0, 0x10, 0x14, 
+  0x77, 0x04, 0xf2, 0xa6, 0x09, 0xc0, 0x00, 0x8a, 0x03, 0xf0, 0x05, 0xc3, 
+  0x41, 0x14, 0x00, 0x88, 0x2e, 0x02, 0x42, 0x82, 0x09, 0xe0, 0x00, 0x06, 
+  0xa7, 0x00, 0xae, 0xa1, 0x40, 0xca, 0xc7, 0x94, 0x01, 0xf0, 0x03, 0xa3, 
+  0xc1, 0xbf, 0x81, 0x28, 0x46, 0xaa, 0x0f, 0xaf, 0xeb, 0x08, 0x47, 0x1a, 
+  0x0e, 0xaf, 0xeb, 0x10, 0x40, 0x22, 0x02, 0xa0, 0x92, 0x0f, 0xaf, 0xeb, 
+  0x02, 0x41, 0xe3, 0x0f, 0xb4, 0x10, 0xb4, 0x06, 0x40, 0xcc, 0x27, 0x82, 
+  0x9f, 0x96, 0x04, 0xc0, 0x77, 0xf2, 0x90, 0xe7, 0x92, 0xf4, 0x40, 0x26, 
+  0x0f, 0x17, 0x80, 0xc2, 0x6a, 0x02, 0x70, 0x0e, 0x0c, 0xa0, 0x00, 0xe1, 
+  0x40, 0x20, 0x8e, 0x07, 0xa1, 0x32, 0x37, 0xd9, 0x6c, 0x20, 0x40, 0x00, 
+  0x81, 0xb8, 0x0b, 0x1a, 0x01, 0xe0, 0x9a, 0x0d, 0x20, 0x01, 0xe1, 0x40, 
+  0x80, 0xc2, 0x1d, 0xd9, 0x6c, 0x76, 0xe6, 0x0b, 0x26, 0x00, 0xf0, 0x4f, 
+  0x05, 0x14, 0xc0, 0x30, 0x21, 0xc2, 0x02, 0x14, 0xc1, 0x30, 0x01, 0x14, 
+  0x83, 0x30, 0x03, 0x14, 0x8c, 0x30, 0x20, 0xc7, 0x10, 0xb8, 0x08, 0xba, 
+  0x10, 0xb9, 0x08, 0xbb, 0x45, 0x78, 0x65, 0x79, 0x85, 0x78, 0xe5, 0x79, 
+  0x48, 0x30, 0x82, 0x00, 0x48, 0x31, 0x80, 0x00, 0x00, 0x32, 0x81, 0x0f, 
+  0x80, 0x3c, 0x00, 0x00, 0x8a, 0x26, 0x01, 0x08, 0x00, 0x30, 0x80, 0x0f, 
+  0x80, 0x37, 0x00, 0x00, 0xc8, 0x41, 0x04, 0x31, 0x80, 0x8f, 0xea, 0x46, 
+  0x00, 0x60, 0xc8, 0x40, 0xca, 0x21, 0xaa, 0x10, 0x04, 0x30, 0x80, 0x8f, 
+  0xaa, 0x42, 0x00, 0x00, 0xc8, 0x43, 0xca, 0x20, 0x4e, 0x12, 0x0e, 0x00, 
+  0x80, 0x20, 0xc2, 0x00, 0x00, 0xca, 0x23, 0x0a, 0x12, 0x28, 0x00, 0xf0, 
+  0x03, 0xf4, 0x47, 0x00, 0x24, 0xca, 0x26, 0xce, 0x02, 0x4c, 0x70, 0x6c, 
+  0x70, 0x8c, 0x70, 0xc0, 0x41, 0xc2, 0x0b, 0x42, 0x04, 0xf1, 0x02, 0x0c, 
+  0x70, 0xc1, 0x41, 0x5a, 0x0e, 0xa0, 0x00, 0x20, 0x1d, 0x01, 0x10, 0x10, 
+  0xd8, 0xc8, 0xc7, 0x0d, 0x02, 0x03, 0x16, 0x13, 0x02, 0x03, 0x12, 0x08, 
+  0xe0, 0x02, 0x60, 0xe8, 0xa5, 0x1a, 0xf0, 0xff, 0xd8, 0xe8, 0x00, 0x20, 
+  0x08, 0xa5, 0x66, 0x06, 0x00, 0xec, 0x00, 0x11, 0x22, 0xc6, 0x00, 0x02, 
+  0x78, 0x06, 0x15, 0x42, 0xee, 0x00, 0x11, 0x09, 0xee, 0x00, 0x20, 0xae, 
+  0x0c, 0xee, 0x00, 0xf1, 0x26, 0x0c, 0x70, 0xfe, 0x0d, 0xa0, 0x00, 0xc1, 
+  0x41, 0x08, 0x85, 0xc8, 0xc7, 0xe6, 0xc2, 0x9c, 0x11, 0x02, 0x00, 0x28, 
+  0x46, 0xa0, 0x11, 0x01, 0x00, 0x04, 0x32, 0x00, 0x80, 0xca, 0x20, 0x85, 
+  0x00, 0x7c, 0x16, 0x0d, 0x10, 0x04, 0x30, 0x40, 0x80, 0xca, 0x20, 0x45, 
+  0x00, 0x48, 0x47, 0x00, 0x32, 0x82, 0x0f, 0x00, 0x3f, 0x00, 0x1e, 0x00, 
+  0xa2, 0x7a, 0xf6, 0x06, 0x85, 0x04, 0x30, 0xc0, 0x83, 0x58, 0xf7, 0x88, 
+  0x00, 0x00, 0x84, 0x00, 0xe0, 0x02, 0x08, 0xe0, 0x00, 0xe1, 0x41, 0x04, 
+  0x71, 0x0d, 0xe8, 0x04, 0x85, 0xe6, 0xa5, 0xe6, 0x03, 0xf0, 0x07, 0x07, 
+  0x37, 0x01, 0x10, 0xe1, 0x40, 0x48, 0x31, 0x41, 0x02, 0x3d, 0xad, 0x02, 
+  0xf0, 0x06, 0x85, 0x07, 0x30, 0xc0, 0x03, 0xc1, 0x41, 0x22, 0x04, 0xf1, 
+  0x04, 0xe5, 0xa5, 0x48, 0x30, 0x40, 0x02, 0x1c, 0xad, 0xae, 0x0d, 0xa0, 
+  0x00, 0x0c, 0x70, 0x05, 0x85, 0xc6, 0xc6, 0xe6, 0x6c, 0x03, 0x00, 0x66, 
+  0x03, 0xf0, 0x09, 0x04, 0x1c, 0x01, 0x30, 0x00, 0x1c, 0x01, 0x30, 0x46, 
+  0xf4, 0x89, 0x0a, 0xf4, 0x00, 0x23, 0xd8, 0x00, 0x89, 0x40, 0x23, 0x0d, 
+  0x07, 0x80, 0xc2, 0x44, 0x03, 0x60, 0x00, 0x89, 0x07, 0xdb, 0x23, 0xb8, 
+  0x5c, 0x03, 0x80, 0x01, 0x89, 0xc2, 0xb8, 0x03, 0xae, 0x01, 0x89, 0x0e, 
+  0x00, 0xf0, 0x07, 0x04, 0xae, 0x02, 0x89, 0x30, 0xd9, 0x05, 0xae, 0x2e, 
+  0x0a, 0xa0, 0x00, 0xa1, 0x40, 0x01, 0x14, 0x80, 0x30, 0x64, 0x8e, 0xe3, 
+  0x8e, 0x7e, 0x03, 0xf0, 0x11, 0x82, 0x8e, 0x6c, 0x20, 0x40, 0x01, 0xc2, 
+  0xbb, 0x03, 0xbf, 0x6c, 0x21, 0x81, 0x00, 0xc2, 0xbc, 0x05, 0x7b, 0x44, 
+  0x27, 0x00, 0x1e, 0x85, 0x79, 0x65, 0x78, 0x45, 0x8e, 0x06, 0x1c, 0x42, 
+  0x30, 0xe8, 0x02, 0xf1, 0x04, 0x01, 0x8e, 0x84, 0x21, 0xc3, 0x01, 0x60, 
+  0xc2, 0x03, 0xb8, 0x44, 0x20, 0x00, 0x0e, 0x25, 0x78, 0x06, 0x1c, 0x02, 
+  0xe2, 0x02, 0x60, 0x07, 0xdb, 0x86, 0x0b, 0x20, 0x01, 0xb6, 0x06, 0xa0, 
+  0xc6, 0xc7, 0xe0, 0x78, 0x20, 0x45, 0x3c, 0x49, 0x1d, 0xd9, 0xb8, 0x04, 
+  0xfa, 0x17, 0xac, 0x16, 0xc3, 0x44, 0x14, 0x00, 0x28, 0x29, 0xd9, 0x01, 
+  0xa0, 0x00, 0x0b, 0xdb, 0x6a, 0x24, 0x80, 0x12, 0x51, 0x24, 0x80, 0x93, 
+  0xe0, 0x20, 0x82, 0x0f, 0x13, 0x00, 0xc0, 0x13, 0xcb, 0x44, 0x00, 0x00, 
+  0x46, 0x00, 0x3e, 0x79, 0x18, 0x00, 0x20, 0x28, 0x14, 0x18, 0x00, 0x1d, 
+  0x47, 0x18, 0x00, 0x11, 0xe4, 0x30, 0x00, 0x1d, 0x44, 0x18, 0x00, 0x11, 
+  0x8c, 0x30, 0x00, 0xf0, 0x86, 0x45, 0x00, 0x3e, 0x79, 0xf2, 0xc3, 0x94, 
+  0x24, 0x2f, 0x3a, 0xc3, 0x40, 0xa0, 0x00, 0x30, 0x7e, 0x2e, 0x0c, 0x20, 
+  0x00, 0x10, 0x42, 0xcb, 0x47, 0xf0, 0x00, 0x34, 0x00, 0x03, 0xe8, 0x50, 
+  0xd9, 0x2d, 0xf0, 0xcb, 0x46, 0x14, 0x00, 0x10, 0x57, 0x00, 0x8e, 0x1e, 
+  0xe8, 0xad, 0x70, 0xd3, 0x41, 0x14, 0x00, 0x14, 0x57, 0x0a, 0x20, 0x80, 
+  0x2f, 0x14, 0x00, 0x28, 0x57, 0x04, 0x11, 0x02, 0x24, 0x04, 0x10, 0x01, 
+  0x24, 0x00, 0x24, 0x83, 0x3f, 0x00, 0x00, 0x30, 0x06, 0x8a, 0x24, 0x08, 
+  0x00, 0x06, 0x0c, 0x20, 0x00, 0x42, 0x40, 0x27, 0x08, 0x32, 0x00, 0x58, 
+  0xd9, 0x00, 0x8e, 0xa5, 0x71, 0xdd, 0x0d, 0x04, 0x90, 0x4f, 0xd8, 0x40, 
+  0xc0, 0x81, 0xc1, 0x80, 0xc2, 0x42, 0x40, 0xba, 0x0b, 0x20, 0x00, 0x40, 
+  0x24, 0x14, 0x31, 0x06, 0xe8, 0x57, 0xd9, 0x34, 0xaf, 0x15, 0xaf, 0xd2, 
+  0xc7, 0x4a, 0x22, 0x00, 0x20, 0x00, 0xc0, 0x93, 0x0a, 0x05, 0x20, 0x5a, 
+  0x22, 0x0e, 0x25, 0x30, 0x24, 0x80, 0x23, 0x1d, 0x78, 0xfe, 0x72, 0x03, 
+  0xf0, 0x18, 0x43, 0x08, 0x45, 0x3b, 0xe8, 0x07, 0x85, 0xb9, 0xe8, 0x81, 
+  0xc0, 0x1e, 0x66, 0x02, 0x86, 0x34, 0x15, 0x11, 0x10, 0x0e, 0x09, 0x20, 
+  0x00, 0x30, 0x15, 0x10, 0x10, 0x10, 0x45, 0x06, 0x09, 0x20, 0x00, 0x03, 
+  0x86, 0x04, 0x30, 0x40, 0xa5, 0xcc, 0x02, 0xf0, 0x1f, 0xca, 0x23, 0x69, 
+  0x00, 0x04, 0x30, 0x80, 0xa0, 0xa2, 0x41, 0xc5, 0xf7, 0x74, 0x70, 0x02, 
+  0x41, 0xbe, 0x71, 0x04, 0x31, 0x00, 0xa0, 0xca, 0x20, 0x49, 0x04, 0x04, 
+  0x35, 0x80, 0xa0, 0xd1, 0xf7, 0x04, 0x30, 0x40, 0xa0, 0x05, 0xf2, 0x50, 
+  0x21, 0xfe, 0x87, 0x03, 0xf2, 0x2c, 0xa5, 0x1c, 0x00, 0xf0, 0x11, 0x0f, 
+  0xf2, 0x50, 0x20, 0xfe, 0x87, 0x0b, 0xf2, 0x0d, 0xa5, 0x09, 0xf0, 0x59, 
+  0xd8, 0x14, 0xaf, 0x16, 0x1f, 0xc2, 0x14, 0x55, 0xaf, 0x19, 0x8d, 0x87, 
+  0xb8, 0x19, 0xad, 0x46, 0x71, 0xb8, 0xf1, 0x72, 0x02, 0xaa, 0xf0, 0x50, 
+  0x0a, 0x0e, 0x0f, 0xfc, 0xd2, 0xc7, 0xe0, 0x78, 0x38, 0x01, 0x20, 0xac, 
+  0x17, 0x38, 0x01, 0xa2, 0x43, 0x00, 0x3e, 0x79, 0xec, 0xc3, 0x82, 0x24, 
+  0x18, 0x3c, 0xde, 0x00, 0x02, 0x3e, 0x01, 0xfc, 0x59, 0xda, 0x0a, 0x20, 
+  0x00, 0x80, 0xc2, 0x02, 0xe8, 0xcc, 0xc7, 0x6e, 0x0b, 0x8f, 0xeb, 0xde, 
+  0x09, 0xaf, 0xeb, 0x10, 0x42, 0x10, 0x41, 0x4a, 0x27, 0x00, 0x10, 0x00, 
+  0xc0, 0xef, 0x0f, 0x25, 0x90, 0x81, 0xc0, 0x5a, 0x27, 0x0d, 0x15, 0xa0, 
+  0x60, 0x1e, 0x0e, 0xaf, 0xeb, 0x1d, 0x78, 0x08, 0x46, 0x1b, 0xe8, 0x07, 
+  0x86, 0x99, 0xe8, 0x81, 0xc0, 0xb8, 0x60, 0x10, 0x10, 0x10, 0x01, 0x4a, 
+  0x25, 0x00, 0x10, 0x15, 0x08, 0x6e, 0x23, 0xa1, 0x40, 0x42, 0x41, 0x26, 
+  0x0b, 0xaf, 0xeb, 0x22, 0x42, 0x08, 0xe8, 0x07, 0x88, 0x86, 0xe8, 0xa5, 
+  0x71, 0xed, 0x0d, 0x14, 0x98, 0x05, 0xf0, 0x19, 0x8e, 0x87, 0xb8, 0x19, 
+  0xae, 0xe5, 0x71, 0xda, 0xf1, 0x94, 0x00, 0x11, 0xd4, 0x94, 0x00, 0xf0, 
+  0x15, 0x4b, 0x00, 0x3e, 0x79, 0xe6, 0xc2, 0x28, 0x46, 0xca, 0x0d, 0x2f, 
+  0xfc, 0x08, 0x45, 0x18, 0x8d, 0x63, 0x08, 0x73, 0x08, 0x42, 0x20, 0x03, 
+  0x02, 0x97, 0x0b, 0x35, 0x05, 0x14, 0x72, 0xc3, 0x41, 0xa1, 0x00, 0x34, 
+  0x18, 0x5e, 0x02, 0xf0, 0x3d, 0xc4, 0x18, 0x25, 0x20, 0xc0, 0x00, 0x15, 
+  0xf0, 0x51, 0xf0, 0xe4, 0xf0, 0x5d, 0xf0, 0xe2, 0xf0, 0xe0, 0xf0, 0xe0, 
+  0xf0, 0xde, 0xf0, 0xde, 0xf0, 0x65, 0xf0, 0x77, 0xf0, 0xda, 0xf0, 0x83, 
+  0xf0, 0xd8, 0xf0, 0xd8, 0xf0, 0xd6, 0xf0, 0xd6, 0xf0, 0xd4, 0xf0, 0x8b, 
+  0xf0, 0x97, 0xf0, 0x42, 0x86, 0x8b, 0x85, 0x6a, 0x85, 0x00, 0x82, 0x0c, 
+  0xa1, 0x01, 0x82, 0x0d, 0xa1, 0x02, 0x82, 0x0e, 0xa1, 0x03, 0x82, 0x91, 
+  0xa1, 0x70, 0xa1, 0x0f, 0xa1, 0xc4, 0xf0, 0xa1, 0xe0, 0x50, 0x00, 0x60, 
+  0x44, 0x19, 0x93, 0xf2, 0xa4, 0xe0, 0x60, 0x00, 0xd2, 0x0c, 0x19, 0x9b, 
+  0xf2, 0xa7, 0xe0, 0xa9, 0xf2, 0xad, 0xe0, 0xb6, 0xf4, 0x22, 0x38, 0x00, 
+  0xf0, 0x12, 0x81, 0x00, 0xa2, 0x01, 0x81, 0x01, 0xa2, 0x02, 0x81, 0x02, 
+  0xa2, 0x03, 0x81, 0x03, 0xa2, 0x04, 0x81, 0x86, 0xa2, 0x65, 0xa2, 0x04, 
+  0xa2, 0xa6, 0xf0, 0xa6, 0xf4, 0x22, 0x86, 0xcb, 0x85, 0xea, 0x85, 0x6c, 
+  0x01, 0xf5, 0x08, 0x34, 0x18, 0x41, 0x81, 0x62, 0x81, 0x83, 0x81, 0x20, 
+  0x81, 0xc5, 0xa0, 0xe4, 0xa0, 0x20, 0xa0, 0x83, 0xa0, 0x62, 0xa0, 0x41, 
+  0xa0, 0x94, 0x7c, 0x00, 0xf5, 0x04, 0x06, 0xa1, 0x01, 0x82, 0x07, 0xa1, 
+  0x02, 0x82, 0x08, 0xa1, 0x03, 0x82, 0x8b, 0xa1, 0x6a, 0xa1, 0x09, 0xa1, 
+  0x86, 0x1c, 0x00, 0xf5, 0x04, 0x12, 0xa1, 0x01, 0x82, 0x13, 0xa1, 0x02, 
+  0x82, 0x14, 0xa1, 0x03, 0x82, 0x97, 0xa1, 0x76, 0xa1, 0x15, 0xa1, 0x78, 
+  0x1c, 0x00, 0xf5, 0x0c, 0x1e, 0xa1, 0x01, 0x82, 0x1f, 0xa1, 0x02, 0x82, 
+  0x80, 0x19, 0x00, 0x00, 0x03, 0x82, 0x8c, 0x19, 0x00, 0x03, 0x88, 0x19, 
+  0xc0, 0x00, 0x84, 0x19, 0x00, 0x00, 0x66, 0x24, 0x00, 0xff, 0x05, 0x18, 
+  0xa1, 0x01, 0x82, 0x19, 0xa1, 0x02, 0x82, 0x1a, 0xa1, 0x03, 0x82, 0x9d, 
+  0xa1, 0x7c, 0xa1, 0x1b, 0xa1, 0x58, 0xf0, 0xbc, 0x00, 0x01, 0x75, 0x85, 
+  0xa2, 0x64, 0xa2, 0x03, 0xa2, 0x4a, 0x1c, 0x00, 0xf5, 0x04, 0x0c, 0xa2, 
+  0x01, 0x81, 0x0d, 0xa2, 0x02, 0x81, 0x0e, 0xa2, 0x03, 0x81, 0x91, 0xa2, 
+  0x70, 0xa2, 0x0f, 0xa2, 0x3c, 0x1c, 0x00, 0xf5, 0x04, 0x06, 0xa2, 0x01, 
+  0x81, 0x07, 0xa2, 0x02, 0x81, 0x08, 0xa2, 0x03, 0x81, 0x8b, 0xa2, 0x6a, 
+  0xa2, 0x09, 0xa2, 0x2e, 0x1c, 0x00, 0xf5, 0x04, 0x07, 0xa2, 0x01, 0x81, 
+  0x08, 0xa2, 0x02, 0x81, 0x09, 0xa2, 0x03, 0x81, 0x8c, 0xa2, 0x6b, 0xa2, 
+  0x0a, 0xa2, 0x20, 0x8c, 0x00, 0xf5, 0x08, 0x07, 0xa1, 0x01, 0x82, 0x08, 
+  0xa1, 0x02, 0x82, 0x09, 0xa1, 0x03, 0x82, 0x0a, 0xa1, 0x04, 0x82, 0x8d, 
+  0xa1, 0x6c, 0xa1, 0x0b, 0xa1, 0x10, 0x20, 0x00, 0xf0, 0x07, 0x00, 0xa1, 
+  0x01, 0x82, 0x01, 0xa1, 0x02, 0x82, 0x02, 0xa1, 0x03, 0x82, 0x03, 0xa1, 
+  0x04, 0x82, 0x86, 0xa1, 0x65, 0xa1, 0x04, 0xa1, 0x60, 0x02, 0xf0, 0x19, 
+  0x5b, 0x0f, 0xf5, 0x13, 0x0c, 0x70, 0x5a, 0x27, 0x0e, 0x1e, 0x32, 0x26, 
+  0x80, 0x1f, 0xa1, 0x00, 0xac, 0x19, 0x23, 0xe8, 0xbe, 0x0c, 0x20, 0x00, 
+  0xe1, 0x40, 0xb2, 0x0b, 0x8f, 0xeb, 0x1d, 0xe8, 0x55, 0x80, 0x1b, 0xea, 
+  0x29, 0x88, 0x19, 0xe9, 0xa6, 0x01, 0xf2, 0x0b, 0xad, 0x19, 0x78, 0x8d, 
+  0x2c, 0x66, 0x27, 0x0b, 0x21, 0x03, 0x3e, 0x66, 0x22, 0x8e, 0x8d, 0xe9, 
+  0x2a, 0x85, 0x61, 0x8e, 0x2a, 0xa0, 0x2b, 0x85, 0x2b, 0xa0, 0x24, 0x02, 
+  0xf8, 0x01, 0x60, 0x7a, 0x62, 0xae, 0x22, 0x8e, 0x09, 0x69, 0x02, 0xae, 
+  0xe5, 0x71, 0xd4, 0xf1, 0xc6, 0xc6, 0x6c, 0x02, 0x40, 0x11, 0x00, 0x2c, 
+  0x69, 0x6c, 0x02, 0x1d, 0x4d, 0x50, 0x04, 0x20, 0xac, 0x2a, 0x18, 0x00, 
+  0x1b, 0x4a, 0x18, 0x00, 0x40, 0x11, 0x00, 0x34, 0x75, 0x18, 0x00, 0xfa, 
+  0x29, 0x4c, 0x00, 0x3e, 0x79, 0x78, 0x88, 0x60, 0x42, 0x80, 0x22, 0xbd, 
+  0x03, 0x27, 0x0a, 0x74, 0x03, 0x4a, 0x6b, 0x0f, 0x0a, 0x15, 0x08, 0x1f, 
+  0x0e, 0x8f, 0x70, 0x05, 0x83, 0xc1, 0x82, 0x42, 0x23, 0x02, 0x09, 0x89, 
+  0xe2, 0xe0, 0x20, 0xcd, 0x07, 0x8a, 0x23, 0x48, 0x02, 0x11, 0x23, 0x80, 
+  0x80, 0xe0, 0x7c, 0x10, 0x80, 0xe0, 0x7f, 0x00, 0xa1, 0x4c, 0x00, 0x20, 
+  0xf4, 0x7e, 0x4c, 0x00, 0x1d, 0x33, 0x64, 0x00, 0x20, 0x10, 0x80, 0x18, 
+  0x00, 0xf0, 0x25, 0x1c, 0x00, 0x3e, 0x79, 0x07, 0x21, 0x3e, 0x80, 0x26, 
+  0x00, 0x24, 0x00, 0x1a, 0x61, 0x07, 0x22, 0x01, 0x00, 0x2f, 0x26, 0x46, 
+  0xf0, 0x1a, 0x00, 0x23, 0x00, 0xbf, 0x20, 0xff, 0x0f, 0xc3, 0x41, 0x00, 
+  0x00, 0xff, 0x7f, 0xc3, 0x42, 0xff, 0xff, 0x00, 0x80, 0x14, 0x70, 0x3c, 
+  0x72, 0xe0, 0x7f, 0x4e, 0x78, 0xe0, 0x78, 0x30, 0x00, 0x60, 0x1e, 0x00, 
+  0x24, 0x00, 0x19, 0x61, 0x0a, 0x00, 0x15, 0x16, 0x2c, 0x00, 0xf2, 0x0b, 
+  0xff, 0x7f, 0xff, 0xff, 0x14, 0x70, 0xc0, 0x21, 0x61, 0x00, 0xe0, 0x7f, 
+  0x20, 0x40, 0xe0, 0x78, 0xf1, 0xc0, 0x05, 0xe9, 0x16, 0x08, 0x20, 0x00, 
+  0x58, 0x78, 0x48, 0x00, 0xf2, 0x21, 0xa2, 0x09, 0x80, 0x00, 0xd1, 0xc0, 
+  0xe0, 0x7e, 0xe1, 0xc5, 0x00, 0x43, 0x17, 0xe9, 0x31, 0x7c, 0x71, 0x7a, 
+  0x05, 0x2a, 0x00, 0x03, 0x1a, 0x20, 0x0d, 0x03, 0xa2, 0x7a, 0x5b, 0x7a, 
+  0x15, 0x0a, 0x24, 0x03, 0x07, 0x21, 0xfe, 0x80, 0x0a, 0x00, 0x03, 0x00, 
+  0x17, 0x0c, 0x85, 0x10, 0x04, 0x71, 0x0e, 0x00, 0xf0, 0x0f, 0x04, 0x00, 
+  0xc2, 0xc4, 0x60, 0x40, 0xc2, 0xc4, 0x13, 0x78, 0xc2, 0xc4, 0xe0, 0x78, 
+  0xe8, 0xc2, 0x50, 0x40, 0x28, 0x46, 0x42, 0x09, 0xa0, 0x00, 0x08, 0x45, 
+  0x08, 0x47, 0x3a, 0x09, 0x8e, 0x07, 0xe0, 0xec, 0x78, 0x42, 0x20, 0x41, 
+  0x20, 0x16, 0x70, 0x01, 0x28, 0x42, 0x00, 0xc3, 0x43, 0x6a, 0x00, 0xf0, 
+  0x2d, 0x01, 0x28, 0x01, 0x04, 0xc0, 0xba, 0xca, 0x22, 0x21, 0x00, 0x11, 
+  0x09, 0xe1, 0x00, 0xc7, 0x7d, 0x09, 0x0d, 0x12, 0x10, 0x4c, 0x70, 0x60, 
+  0x41, 0x09, 0xf0, 0x01, 0x6b, 0x0f, 0x09, 0x24, 0x00, 0xa4, 0x78, 0x2f, 
+  0xb8, 0x4c, 0x70, 0x79, 0x60, 0x59, 0x61, 0xb5, 0x70, 0xce, 0x21, 0x2b, 
+  0x00, 0x2e, 0x78, 0xc8, 0xc6, 0xe0, 0x78, 0x32, 0x48, 0x07, 0x21, 0x03, 
+  0x00, 0x04, 0x01, 0x20, 0x64, 0x79, 0x06, 0x01, 0x1f, 0x18, 0x06, 0x01, 
+  0x08, 0xf1, 0x29, 0xea, 0xc2, 0x05, 0x90, 0x70, 0x41, 0x50, 0x40, 0x41, 
+  0x28, 0x0d, 0x02, 0x0f, 0x7e, 0xb0, 0x4e, 0xae, 0x08, 0xa0, 0x00, 0x28, 
+  0x47, 0x89, 0xe0, 0x0c, 0x70, 0x0e, 0xf7, 0x09, 0x26, 0x40, 0x13, 0x65, 
+  0xb8, 0x00, 0xb7, 0x10, 0x4d, 0x00, 0x18, 0x04, 0x20, 0x20, 0x97, 0x0c, 
+  0x71, 0x31, 0x4e, 0x00, 0x19, 0x44, 0x20, 0xca, 0xc6, 0xe0, 0x78, 0x50, 
+  0x07, 0xf0, 0x3e, 0x80, 0x40, 0x20, 0x0d, 0x07, 0x40, 0x24, 0x82, 0x31, 
+  0x7c, 0xd9, 0x6c, 0x72, 0x12, 0x0b, 0x60, 0x00, 0xa1, 0x40, 0x07, 0x14, 
+  0x80, 0x30, 0x38, 0x16, 0x06, 0x10, 0x40, 0x24, 0xc2, 0x31, 0xa0, 0xb8, 
+  0x07, 0x1c, 0x02, 0x30, 0x7c, 0xd9, 0x6c, 0x71, 0x8c, 0x70, 0xac, 0x70, 
+  0xd6, 0x0c, 0xe0, 0x00, 0xa1, 0x40, 0x80, 0xc2, 0x2f, 0xd9, 0x6c, 0x71, 
+  0xa1, 0x40, 0x8a, 0x0c, 0xe0, 0x00, 0x00, 0x1c, 0x83, 0x30, 0x0e, 0x86, 
+  0x56, 0x08, 0xef, 0xea, 0x48, 0x30, 0xc0, 0x02, 0x80, 0x02, 0xf1, 0x28, 
+  0x80, 0x1e, 0x00, 0x91, 0xe2, 0x89, 0x43, 0x89, 0x63, 0x91, 0x60, 0xc0, 
+  0x24, 0x89, 0x28, 0xb8, 0x95, 0x6f, 0x06, 0xba, 0x53, 0x20, 0x0f, 0x01, 
+  0x44, 0x24, 0x00, 0x18, 0x02, 0x1c, 0xc2, 0x30, 0x28, 0xbb, 0x84, 0x22, 
+  0x01, 0x00, 0xe5, 0x78, 0x07, 0xb9, 0xc2, 0xbb, 0x45, 0x78, 0x85, 0x23, 
+  0x02, 0x0c, 0x25, 0x78, 0x03, 0x1c, 0xc2, 0x68, 0x07, 0x00, 0x54, 0x07, 
+  0x31, 0x6c, 0x74, 0x32, 0x66, 0x00, 0x04, 0x94, 0x00, 0x2c, 0x7e, 0x0a, 
+  0x94, 0x00, 0x19, 0x80, 0x94, 0x00, 0x11, 0x42, 0x2e, 0x00, 0x00, 0x80, 
+  0x07, 0xf0, 0x09, 0xe1, 0xc5, 0x80, 0x98, 0x6c, 0x70, 0x90, 0xbb, 0x35, 
+  0x4b, 0x2c, 0x7c, 0x4c, 0x7d, 0x7d, 0x7b, 0x99, 0x65, 0x3b, 0x63, 0x30, 
+  0xbb, 0x60, 0xb0, 0xac, 0x01, 0xf0, 0x07, 0xe1, 0xc5, 0x61, 0x80, 0x48, 
+  0x31, 0x0c, 0x00, 0x48, 0x33, 0x81, 0x00, 0x07, 0x31, 0x04, 0x03, 0x20, 
+  0x80, 0x02, 0x80, 0x48, 0x31, 0x0c, 0x00, 0xf0, 0x1d, 0x07, 0x03, 0x48, 
+  0x30, 0x80, 0x00, 0x07, 0x30, 0x06, 0x03, 0x00, 0x34, 0x01, 0x01, 0x00, 
+  0x37, 0xc0, 0x01, 0x01, 0x30, 0x41, 0x00, 0x00, 0x36, 0x80, 0x01, 0x01, 
+  0x31, 0x01, 0x00, 0x04, 0x31, 0x80, 0x8f, 0x10, 0x40, 0x00, 0x00, 0xb4, 
+  0x00, 0x26, 0x00, 0x65, 0xd8, 0x0e, 0x00, 0xf1, 0x0f, 0x80, 0x3e, 0x00, 
+  0x00, 0xa8, 0x00, 0x2c, 0x00, 0x6c, 0x70, 0x04, 0x37, 0xc0, 0x80, 0xe8, 
+  0x44, 0xd2, 0x24, 0xec, 0x17, 0x04, 0x34, 0xc0, 0x80, 0x0a, 0x23, 0x00, 
+  0x11, 0xd2, 0x23, 0x0c, 0x00, 0xf0, 0x36, 0x92, 0x2c, 0x70, 0x89, 0x41, 
+  0xca, 0x21, 0x65, 0x00, 0xca, 0x21, 0xc5, 0x12, 0x04, 0x36, 0xc0, 0x80, 
+  0x0a, 0x20, 0x80, 0x11, 0xd2, 0x20, 0xec, 0x17, 0x04, 0x31, 0x00, 0x92, 
+  0xca, 0x21, 0xa5, 0x00, 0xcb, 0x45, 0x66, 0x3f, 0x66, 0x66, 0x29, 0x09, 
+  0x70, 0x00, 0x04, 0x33, 0x40, 0x93, 0x9b, 0xe9, 0x04, 0x34, 0x40, 0x93, 
+  0x54, 0x00, 0x05, 0x00, 0x04, 0x34, 0x80, 0x9f, 0x8c, 0x3f, 0xcd, 0xcc, 
+  0x48, 0x00, 0x29, 0x00, 0x5e, 0x00, 0xa2, 0x00, 0x1a, 0x43, 0x00, 0x19, 
+  0xf0, 0x9c, 0xf7, 0x04, 0x33, 0x18, 0x00, 0x60, 0x18, 0xf6, 0x01, 0x1a, 
+  0x43, 0x00, 0x6e, 0x00, 0xa2, 0x0d, 0xf0, 0x04, 0x30, 0x40, 0x93, 0x90, 
+  0xf7, 0x04, 0x30, 0x1a, 0x00, 0x20, 0x0a, 0xf6, 0x68, 0x00, 0xe0, 0x02, 
+  0x1a, 0x43, 0x00, 0x2c, 0x77, 0x0c, 0x70, 0xca, 0x21, 0x66, 0x00, 0x23, 
+  0xaa, 0xf8, 0x00, 0x0a, 0x68, 0x03, 0x20, 0xb4, 0x9f, 0x68, 0x03, 0x40, 
+  0x1b, 0x00, 0x3e, 0x79, 0xb6, 0x05, 0x80, 0x88, 0x1f, 0xe0, 0x7f, 0x00, 
+  0x18, 0x43, 0x00, 0x0c, 0x00, 0x13, 0x98, 0x0c, 0x00, 0x0a, 0x30, 0x00, 
+  0x20, 0x84, 0xa1, 0x30, 0x00, 0x1d, 0x0a, 0xb0, 0x03, 0x20, 0xf4, 0xa3, 
+  0x18, 0x00, 0x1d, 0x0b, 0x18, 0x00, 0x20, 0x04, 0xa4, 0x18, 0x00, 0xf2, 
+  0x31, 0x0d, 0x00, 0x3e, 0x79, 0x0f, 0x08, 0xd5, 0x03, 0x32, 0x20, 0x80, 
+  0x0f, 0xa1, 0x00, 0x5c, 0x42, 0xe0, 0x7e, 0xe0, 0x7f, 0xff, 0xd8, 0xe0, 
+  0x78, 0xe2, 0xc2, 0x08, 0x44, 0x66, 0x09, 0x20, 0x00, 0x0c, 0x74, 0x20, 
+  0x84, 0xa1, 0x84, 0x48, 0x31, 0x41, 0x02, 0x30, 0x79, 0x48, 0x31, 0x0b, 
+  0x00, 0x04, 0x35, 0xc0, 0x92, 0x89, 0xf6, 0x4e, 0x09, 0x20, 0x00, 0x12, 
+  0xd8, 0x48, 0x35, 0x41, 0x12, 0x16, 0x00, 0x22, 0xa2, 0x84, 0x18, 0x00, 
+  0x57, 0x36, 0x09, 0x20, 0x00, 0x10, 0x18, 0x00, 0x13, 0xa6, 0x18, 0x00, 
+  0x57, 0x1e, 0x09, 0x20, 0x00, 0x28, 0x18, 0x00, 0x13, 0xa7, 0x18, 0x00, 
+  0x57, 0x06, 0x09, 0x20, 0x00, 0x36, 0x18, 0x00, 0x13, 0xa8, 0x18, 0x00, 
+  0x57, 0xee, 0x08, 0x20, 0x00, 0x34, 0x18, 0x00, 0x13, 0xa9, 0x18, 0x00, 
+  0x57, 0xd6, 0x08, 0x20, 0x00, 0x48, 0x18, 0x00, 0x13, 0xa3, 0x18, 0x00, 
+  0x57, 0xbe, 0x08, 0x20, 0x00, 0x16, 0x18, 0x00, 0x13, 0xa4, 0x18, 0x00, 
+  0x57, 0xa6, 0x08, 0x20, 0x00, 0x24, 0x18, 0x00, 0x13, 0xa5, 0x18, 0x00, 
+  0x57, 0x8e, 0x08, 0x20, 0x00, 0x22, 0x18, 0x00, 0x13, 0xaa, 0x18, 0x00, 
+  0x57, 0x76, 0x08, 0x20, 0x00, 0x4e, 0x18, 0x00, 0x13, 0xac, 0x18, 0x00, 
+  0x57, 0x5e, 0x08, 0x20, 0x00, 0x42, 0x18, 0x00, 0xf0, 0x09, 0x2b, 0x84, 
+  0x04, 0x31, 0xc0, 0x82, 0x84, 0xf6, 0x46, 0x08, 0x20, 0x00, 0x5a, 0xd8, 
+  0xc2, 0xc6, 0xe0, 0x78, 0x4a, 0x24, 0x40, 0x73, 0x0a, 0x22, 0x44, 0x01, 
+  0xf0, 0x03, 0xec, 0x1f, 0xa8, 0x20, 0x80, 0x01, 0x29, 0x8a, 0x0d, 0x09, 
+  0x00, 0x00, 0x0a, 0xe2, 0xe0, 0x7f, 0x0c, 0x70, 0xb4, 0x01, 0xf2, 0x07, 
+  0x70, 0x20, 0x00, 0x80, 0x04, 0xe8, 0x01, 0x92, 0x20, 0x92, 0x04, 0xf0, 
+  0x03, 0x92, 0x22, 0x92, 0x10, 0xb8, 0xe0, 0x7f, 0x25, 0x78, 0x38, 0x00, 
+  0x00, 0x8a, 0x03, 0x80, 0xf4, 0x1f, 0x1d, 0x7b, 0x0a, 0x22, 0x40, 0x00, 
+  0x3c, 0x00, 0x44, 0x01, 0x8a, 0x0d, 0x0b, 0x3c, 0x00, 0xf0, 0xb9, 0x3f, 
+  0x81, 0x34, 0x70, 0xe0, 0x7c, 0xe0, 0x7f, 0x00, 0x8a, 0xe0, 0x78, 0xea, 
+  0xc3, 0xa5, 0xc1, 0x28, 0x46, 0x08, 0x45, 0xc7, 0x08, 0x30, 0x00, 0x23, 
+  0xdf, 0xc3, 0x0e, 0x30, 0x10, 0xa1, 0x40, 0xfe, 0x0d, 0xef, 0xff, 0x68, 
+  0x15, 0x10, 0x10, 0x38, 0x8d, 0x10, 0x41, 0xed, 0x70, 0x10, 0x1c, 0xc4, 
+  0x33, 0x39, 0x09, 0x75, 0x06, 0x43, 0xc7, 0x31, 0x0e, 0x4e, 0x70, 0x40, 
+  0x01, 0x70, 0xa0, 0x02, 0x86, 0x4e, 0x15, 0x83, 0x10, 0x03, 0x80, 0x48, 
+  0x30, 0x40, 0x02, 0x0f, 0x7a, 0x1d, 0x0b, 0xa0, 0x00, 0xac, 0x70, 0x2c, 
+  0x15, 0x04, 0x10, 0x6a, 0x85, 0x4e, 0x1d, 0x02, 0x10, 0x2c, 0x76, 0x42, 
+  0x0f, 0x20, 0x00, 0xa1, 0x40, 0x38, 0x8d, 0x0b, 0x69, 0x73, 0x08, 0x95, 
+  0x07, 0x6f, 0x0e, 0x0e, 0x70, 0x6c, 0x36, 0x1f, 0x36, 0xc3, 0x42, 0xff, 
+  0x46, 0x00, 0xfe, 0x00, 0x30, 0x81, 0x20, 0x48, 0x31, 0x00, 0x20, 0x07, 
+  0x31, 0x09, 0x00, 0x02, 0x86, 0x80, 0xc3, 0xcb, 0x44, 0x00, 0xc7, 0x00, 
+  0x00, 0x40, 0x24, 0x08, 0x33, 0x20, 0x80, 0xc1, 0x80, 0x02, 0x80, 0x6d, 
+  0x70, 0x40, 0xc1, 0x41, 0xc6, 0x42, 0xc0, 0x31, 0x0b, 0xf5, 0x10, 0x83, 
+  0xc1, 0x00, 0x83, 0x00, 0x31, 0x01, 0x10, 0x40, 0x40, 0x04, 0x31, 0x80, 
+  0x80, 0x20, 0xa3, 0x06, 0xf6, 0x04, 0x31, 0x00, 0x83, 0x81, 0x40, 0xca, 
+  0x20, 0x46, 0x00, 0x04, 0x1b, 0x10, 0x00, 0x72, 0x04, 0xa0, 0x65, 0x71, 
+  0x02, 0x18, 0x14, 0x10, 0xea, 0xf1, 0x86, 0x0e, 0x74, 0x00, 0xf0, 0x1d, 
+  0xe1, 0x40, 0xca, 0xc7, 0xe0, 0x78, 0xe8, 0xc3, 0xa2, 0xc1, 0x6d, 0x81, 
+  0x10, 0x40, 0xc3, 0x40, 0x50, 0x43, 0x0b, 0xd7, 0x4c, 0x81, 0x2e, 0x81, 
+  0x00, 0x33, 0x03, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x31, 0x00, 0x00, 
+  0x48, 0x33, 0xc1, 0x02, 0x8b, 0x44, 0x21, 0xb4, 0x22, 0x01, 0x60, 0x2c, 
+  0x17, 0x48, 0x32, 0xc2, 0x02, 0x48, 0x00, 0xf0, 0x13, 0x40, 0x21, 0x0d, 
+  0x03, 0x40, 0xb4, 0x02, 0xb4, 0x80, 0xc2, 0x3a, 0x0f, 0xaf, 0xfb, 0xa1, 
+  0x40, 0x9e, 0x15, 0x01, 0x11, 0xad, 0x70, 0xc2, 0xb9, 0x09, 0x69, 0x15, 
+  0x08, 0x75, 0x01, 0x4c, 0x70, 0x00, 0x21, 0x88, 0x01, 0xf0, 0x0e, 0x50, 
+  0x42, 0xff, 0x10, 0x82, 0x80, 0xcb, 0x46, 0xa1, 0x00, 0xc4, 0x1f, 0x01, 
+  0x8e, 0x2b, 0x08, 0xa0, 0x00, 0x40, 0xae, 0x09, 0xe8, 0x22, 0x6e, 0x00, 
+  0xa9, 0x02, 0x40, 0x06, 0x82, 0x00, 0xf0, 0x0e, 0xa9, 0x40, 0x8e, 0x0a, 
+  0xea, 0x22, 0x6e, 0x02, 0x40, 0x41, 0xa9, 0xf6, 0x0d, 0x20, 0x00, 0xa0, 
+  0xa9, 0x40, 0x8e, 0x03, 0xf0, 0x4c, 0x70, 0x0c, 0x70, 0x41, 0xae, 0xc8, 
+  0xc7, 0x98, 0x00, 0x00, 0x6c, 0x01, 0xe2, 0x14, 0x70, 0x23, 0xd8, 0x5d, 
+  0xf2, 0xbb, 0x0e, 0x10, 0x10, 0x1a, 0x85, 0xcb, 0x47, 0x16, 0x01, 0xf0, 
+  0x0b, 0xd0, 0x03, 0x8a, 0x0c, 0xef, 0xff, 0xa1, 0x40, 0x48, 0x30, 0x00, 
+  0x00, 0x07, 0x30, 0x08, 0x20, 0x82, 0x86, 0x4a, 0x24, 0xc0, 0x70, 0x80, 
+  0xc1, 0xc3, 0x43, 0x20, 0x01, 0xf0, 0x0a, 0x81, 0x42, 0xa8, 0x20, 0xc0, 
+  0x05, 0x04, 0x12, 0x00, 0x04, 0x28, 0x46, 0xe1, 0x41, 0x00, 0x30, 0x00, 
+  0x10, 0x04, 0x30, 0xc0, 0x80, 0x6f, 0x23, 0x0b, 0x08, 0x00, 0xf2, 0x0a, 
+  0x83, 0x05, 0xf6, 0x51, 0x23, 0x00, 0x90, 0x7c, 0x70, 0x00, 0x41, 0x48, 
+  0x31, 0xc0, 0x02, 0x22, 0x6e, 0x00, 0xb6, 0x03, 0x84, 0x4e, 0x15, 0x81, 
+  0x10, 0xa0, 0x01, 0x66, 0x1b, 0x09, 0xa0, 0x00, 0x2c, 0x76, 0xa0, 0x01, 
+  0x40, 0xac, 0x70, 0xa2, 0x0d, 0x2c, 0x01, 0x02, 0x02, 0x04, 0xf1, 0x1c, 
+  0x20, 0x88, 0x80, 0x96, 0x83, 0x42, 0x61, 0x92, 0x40, 0x92, 0x8b, 0xe9, 
+  0x22, 0x90, 0x13, 0x0a, 0x41, 0x00, 0x24, 0x90, 0x0b, 0x0b, 0x41, 0x00, 
+  0x26, 0x90, 0x19, 0x0c, 0x40, 0x10, 0x42, 0xb0, 0x00, 0x18, 0x03, 0x00, 
+  0x64, 0xb0, 0x86, 0xb0, 0x80, 0xc1, 0x26, 0x36, 0x00, 0x2f, 0x0c, 0x70, 
+  0xc8, 0x00, 0x0d, 0x2f, 0xc2, 0x0b, 0xc8, 0x00, 0x55, 0x24, 0xda, 0x0c, 
+  0xc8, 0x00, 0x1f, 0x98, 0xc8, 0x00, 0x18, 0x11, 0x5e, 0x36, 0x00, 0x00, 
+  0xc8, 0x00, 0x17, 0xe4, 0xc8, 0x00, 0x51, 0x31, 0xf2, 0x31, 0xee, 0x22, 
+  0xd8, 0x02, 0x2f, 0x04, 0x81, 0xd8, 0x02, 0x05, 0x11, 0x6a, 0x3a, 0x00, 
+  0xe1, 0x22, 0x86, 0x42, 0x81, 0x61, 0x81, 0x23, 0x81, 0xc3, 0x40, 0xa2, 
+  0x45, 0x3d, 0xf8, 0x56, 0x02, 0x00, 0x5e, 0x02, 0x03, 0x5a, 0x02, 0x00, 
+  0x4c, 0x02, 0x00, 0x54, 0x02, 0xfa, 0x05, 0x83, 0x43, 0x21, 0xb3, 0x00, 
+  0xb3, 0x80, 0xc1, 0xa1, 0x40, 0xee, 0x0b, 0x20, 0x00, 0x42, 0xb3, 0x0c, 
+  0x70, 0xc4, 0xc7, 0x2c, 0x05, 0x20, 0x3c, 0xae, 0x2c, 0x05, 0x1d, 0x32, 
+  0x44, 0x05, 0x11, 0x94, 0x18, 0x00, 0x10, 0x31, 0xa4, 0x05, 0xf2, 0x18, 
+  0x42, 0xf0, 0x00, 0x40, 0x02, 0x80, 0xd8, 0x08, 0xa2, 0x0c, 0x82, 0x2f, 
+  0x26, 0x05, 0xf0, 0xe0, 0x20, 0xc4, 0x07, 0x2f, 0x27, 0x7f, 0x00, 0x6f, 
+  0x23, 0x3f, 0x00, 0x04, 0x82, 0xa7, 0xb8, 0x04, 0xa2, 0x2f, 0x26, 0x7f, 
+  0x00, 0xe0, 0x7e, 0x90, 0x01, 0xf0, 0xa3, 0x50, 0x40, 0x08, 0x45, 0x40, 
+  0x24, 0x81, 0x31, 0x81, 0xc2, 0x40, 0x24, 0x83, 0x30, 0xee, 0x0f, 0xaf, 
+  0xff, 0xc1, 0x40, 0x9b, 0x08, 0x30, 0x00, 0x0c, 0x70, 0x04, 0x14, 0x07, 
+  0x31, 0x62, 0x9e, 0x06, 0x14, 0x40, 0x31, 0x41, 0x9e, 0x24, 0x9e, 0xe0, 
+  0x9e, 0x06, 0x16, 0x49, 0x11, 0xac, 0x71, 0x42, 0x27, 0x4b, 0x00, 0x1e, 
+  0x23, 0x0e, 0x04, 0x69, 0x68, 0x2f, 0x24, 0x08, 0x80, 0x00, 0x2d, 0xc0, 
+  0x02, 0x04, 0x15, 0x06, 0x10, 0x0e, 0x78, 0x00, 0x2d, 0xc3, 0x00, 0x1e, 
+  0x66, 0xca, 0x23, 0x21, 0x00, 0x02, 0x2e, 0xce, 0x11, 0x02, 0x14, 0x08, 
+  0x31, 0x6e, 0x7b, 0xc0, 0x76, 0xdb, 0x63, 0x1e, 0x22, 0x02, 0x04, 0x02, 
+  0x2b, 0x03, 0x01, 0x42, 0x20, 0x5e, 0x10, 0x1e, 0x27, 0x0b, 0x14, 0x6c, 
+  0x79, 0x1a, 0x23, 0x49, 0x02, 0x80, 0x85, 0x00, 0x2d, 0x8f, 0x07, 0xee, 
+  0x7f, 0x1a, 0x62, 0x61, 0x70, 0x02, 0x2a, 0xc2, 0x01, 0xf9, 0x61, 0x21, 
+  0x77, 0x02, 0x28, 0xc0, 0x01, 0x9a, 0x62, 0x02, 0x29, 0x0c, 0x02, 0x02, 
+  0x2f, 0x01, 0x12, 0x38, 0x60, 0x9a, 0x62, 0x00, 0xa5, 0xc3, 0x41, 0x00, 
+  0x00, 0xff, 0x7f, 0x60, 0x40, 0x2a, 0x08, 0x60, 0x00, 0x41, 0xa5, 0xc8, 
+  0xc7, 0xf1, 0xc0, 0x40, 0x89, 0x82, 0x03, 0xc0, 0xe0, 0x1f, 0xc2, 0xba, 
+  0xca, 0x0a, 0x20, 0x00, 0x40, 0xa9, 0xd1, 0xc0, 0x9c, 0x04, 0x22, 0xf1, 
+  0xc0, 0x16, 0x00, 0x42, 0xb6, 0x0a, 0x00, 0x00, 0x12, 0x00, 0xf0, 0x01, 
+  0xe0, 0x78, 0xe4, 0xc2, 0xcd, 0x70, 0x41, 0x0e, 0x55, 0x13, 0x5a, 0x26, 
+  0x80, 0x12, 0xcb, 0x45, 0x0e, 0x05, 0xf0, 0x03, 0x1d, 0x65, 0x9a, 0x08, 
+  0x6f, 0xeb, 0x08, 0x8d, 0x41, 0x28, 0x01, 0x04, 0x00, 0xb5, 0x21, 0xb5, 
+  0x0a, 0xe8, 0x36, 0x00, 0xf1, 0x38, 0x70, 0x20, 0x00, 0x81, 0x0f, 0x20, 
+  0x80, 0x03, 0x00, 0xa1, 0x08, 0xf0, 0x7a, 0x08, 0x6f, 0xeb, 0x09, 0x8d, 
+  0x02, 0xb5, 0x30, 0xb8, 0x03, 0xb5, 0xc5, 0x71, 0xe2, 0xf1, 0xc4, 0xc6, 
+  0xe0, 0x78, 0xe8, 0xc2, 0x08, 0x47, 0x50, 0x21, 0xc0, 0x07, 0x28, 0x45, 
+  0x0e, 0x70, 0x05, 0x20, 0xfe, 0x83, 0xcd, 0x70, 0x40, 0xf2, 0x41, 0x2d, 
+  0x01, 0x15, 0x8a, 0x20, 0xdf, 0x0f, 0x24, 0x78, 0x58, 0x60, 0x80, 0x20, 
+  0xb0, 0x00, 0x8c, 0x20, 0xb0, 0xe0, 0x03, 0xff, 0x16, 0x0c, 0x21, 0x0f, 
+  0xf6, 0x72, 0x08, 0xcf, 0xfa, 0x00, 0x44, 0x20, 0x45, 0x2c, 0x72, 0xc1, 
+  0x40, 0xe1, 0x42, 0x69, 0x20, 0x40, 0x00, 0xa1, 0x43, 0x10, 0x40, 0x28, 
+  0x46, 0x24, 0xf0, 0x8c, 0x20, 0x50, 0x80, 0x97, 0xf6, 0x52, 0x20, 0x00, 
+  0x04, 0xf0, 0x29, 0x4c, 0x70, 0x6c, 0x70, 0xe1, 0x40, 0xd2, 0x08, 0xef, 
+  0xfa, 0xa1, 0x41, 0xd2, 0x26, 0xe5, 0x17, 0x0c, 0xf0, 0xc3, 0x40, 0x0f, 
+  0x80, 0xff, 0xff, 0x59, 0x61, 0x04, 0x7d, 0x14, 0xb9, 0x12, 0x78, 0x24, 
+  0x78, 0xf1, 0x40, 0x05, 0x20, 0x4e, 0x03, 0x02, 0x40, 0xc1, 0x41, 0xc8, 
+  0xc6, 0xe0, 0x78, 0xe6, 0xc2, 0x28, 0x47, 0x02, 0xe8, 0xc6, 0xc6, 0x78, 
+  0x00, 0xc0, 0xb2, 0x12, 0x00, 0x8e, 0xf7, 0x08, 0x9e, 0x80, 0xb2, 0x0d, 
+  0xcf, 0xfe, 0xec, 0x00, 0xf1, 0x02, 0xe4, 0x12, 0x1f, 0x8d, 0x85, 0xe8, 
+  0x3e, 0x4e, 0x4a, 0x0f, 0xaf, 0xfe, 0xde, 0x4e, 0x00, 0x8d, 0x14, 0xfa, 
+  0x05, 0xf0, 0x0f, 0x08, 0x1e, 0x04, 0xf2, 0x0d, 0x18, 0x43, 0x00, 0x08, 
+  0xf0, 0x2d, 0x88, 0x06, 0xe9, 0x0d, 0x18, 0x03, 0x00, 0x1f, 0x1d, 0x43, 
+  0x10, 0x24, 0x80, 0x60, 0x79, 0xe1, 0x40, 0xc6, 0xc6, 0x44, 0x01, 0xa0, 
+  0x14, 0x00, 0x30, 0x3f, 0xaa, 0x08, 0x2f, 0xee, 0x0d, 0xd8, 0x0c, 0x00, 
+  0x40, 0x88, 0x3f, 0x32, 0x09, 0x0c, 0x00, 0xf0, 0x0f, 0xd1, 0xc0, 0xe0, 
+  0x7e, 0xe0, 0x78, 0xf1, 0xc0, 0x48, 0x44, 0x00, 0x42, 0x14, 0x72, 0x0c, 
+  0x70, 0x12, 0xf2, 0x49, 0x0a, 0x51, 0x00, 0x45, 0x09, 0x34, 0x01, 0x00, 
+  0x1b, 0x05, 0x01, 0x44, 0x01, 0xf2, 0x11, 0xae, 0x1f, 0x20, 0x89, 0x03, 
+  0xac, 0x02, 0xac, 0x01, 0xac, 0x0c, 0x71, 0x20, 0xac, 0x16, 0xf0, 0x29, 
+  0x09, 0x34, 0x02, 0x00, 0x1b, 0x05, 0x02, 0x07, 0xac, 0x06, 0xac, 0x05, 
+  0xac, 0x04, 0xac, 0x1c, 0x00, 0x20, 0x00, 0xac, 0x2c, 0x00, 0xc0, 0xa8, 
+  0x1f, 0x4c, 0x76, 0xe6, 0x09, 0xaf, 0xdf, 0x81, 0x40, 0x0c, 0x71, 0x5a, 
+  0x00, 0x00, 0x58, 0x00, 0xf2, 0x01, 0x1d, 0x08, 0xb0, 0x00, 0x6c, 0x70, 
+  0x2d, 0x08, 0x51, 0x00, 0x29, 0x09, 0x14, 0x01, 0x40, 0x8c, 0x54, 0x00, 
+  0xc0, 0x6c, 0x71, 0x40, 0xb1, 0x0c, 0xf0, 0x15, 0x09, 0x34, 0x02, 0x4c, 
+  0x76, 0xc0, 0x00, 0x30, 0xa8, 0x1f, 0xae, 0x38, 0x00, 0x20, 0x41, 0x6c, 
+  0x38, 0x00, 0xfa, 0x30, 0x7f, 0x60, 0x40, 0xe0, 0x78, 0xe4, 0xc3, 0xad, 
+  0xc1, 0x28, 0x45, 0x08, 0x46, 0x80, 0xc0, 0x2c, 0x70, 0xd6, 0x0f, 0x6f, 
+  0xed, 0x34, 0xda, 0x1f, 0x0d, 0xb4, 0x10, 0x8c, 0x25, 0x02, 0x90, 0xcc, 
+  0x25, 0x82, 0x9f, 0x00, 0x00, 0xff, 0x00, 0x0d, 0xf4, 0xc3, 0x40, 0x48, 
+  0x43, 0x00, 0x00, 0x42, 0xc0, 0x03, 0xf0, 0x08, 0x1c, 0x01, 0x30, 0x80, 
+  0xc1, 0x5e, 0x0f, 0x20, 0x00, 0xc1, 0x40, 0x58, 0x03, 0x40, 0x13, 0x00, 
+  0x70, 0x55, 0x40, 0x03, 0x1b, 0x5d, 0x58, 0x03, 0x31, 0x13, 0x00, 0x88, 
+  0x18, 0x00, 0xf0, 0x01, 0x5e, 0x00, 0x3e, 0x79, 0xe2, 0xc3, 0xa1, 0xc1, 
+  0x28, 0x45, 0x00, 0x41, 0x40, 0x24, 0x42, 0x30, 0x8e, 0x00, 0xfb, 0x08, 
+  0x8c, 0x42, 0x1a, 0x08, 0x20, 0x00, 0x6c, 0x73, 0x03, 0x14, 0x81, 0x30, 
+  0x8a, 0x20, 0x7f, 0x0a, 0xb1, 0x71, 0xca, 0x20, 0x21, 0x00, 0xc2, 0x58, 
+  0x00, 0x20, 0x8c, 0x57, 0x40, 0x00, 0x1b, 0x28, 0x58, 0x00, 0x40, 0x12, 
+  0x00, 0x80, 0x4c, 0x18, 0x00, 0x1d, 0x29, 0x18, 0x00, 0x20, 0xe8, 0x00, 
+  0x18, 0x00, 0x1d, 0x18, 0x18, 0x00, 0x20, 0xa4, 0x01, 0x18, 0x00, 0x1d, 
+  0x17, 0x18, 0x00, 0x20, 0x0c, 0x6c, 0x18, 0x00, 0x1d, 0x16, 0x18, 0x00, 
+  0x20, 0x98, 0x05, 0x18, 0x00, 0x42, 0x1d, 0x00, 0x3e, 0x79, 0x1c, 0x03, 
+  0xf5, 0x02, 0xc4, 0x1f, 0x40, 0x89, 0x08, 0xea, 0x24, 0x72, 0x41, 0xa9, 
+  0x92, 0x0f, 0xef, 0xff, 0x00, 0x19, 0x03, 0x28, 0x03, 0xf6, 0x55, 0xfa, 
+  0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xa3, 0xc1, 0x0a, 0x26, 0xc0, 0x21, 0x0a, 
+  0x27, 0x80, 0x21, 0x0a, 0x20, 0x40, 0x31, 0x0a, 0x21, 0x00, 0x31, 0x78, 
+  0x43, 0x10, 0x40, 0xae, 0x71, 0x2e, 0x70, 0x40, 0x24, 0x12, 0x31, 0xed, 
+  0x70, 0xcd, 0x70, 0x00, 0x1c, 0x80, 0x30, 0xb6, 0x70, 0xca, 0x45, 0x00, 
+  0xc0, 0xca, 0x25, 0xc1, 0x15, 0x0a, 0x24, 0x00, 0x26, 0x20, 0x9d, 0x0a, 
+  0x23, 0x40, 0x26, 0xca, 0x24, 0xc1, 0x26, 0xca, 0x23, 0x01, 0x20, 0x81, 
+  0xc0, 0x8c, 0x70, 0xac, 0x70, 0xcc, 0x70, 0x82, 0x42, 0x62, 0x43, 0x00, 
+  0x1a, 0x40, 0x24, 0x36, 0x08, 0x20, 0x00, 0x08, 0x1c, 0x40, 0x34, 0x21, 
+  0x9d, 0x1e, 0x66, 0x1c, 0x00, 0xf1, 0x25, 0x22, 0x08, 0x20, 0x00, 0x62, 
+  0x43, 0x1f, 0x67, 0xb6, 0x70, 0xae, 0x70, 0xda, 0xf5, 0x04, 0x18, 0xc0, 
+  0x23, 0x00, 0x18, 0x80, 0x23, 0xa3, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xda, 
+  0xc6, 0xee, 0xc2, 0x08, 0x46, 0x1e, 0x22, 0x40, 0x00, 0xad, 0x70, 0x30, 
+  0x42, 0x8d, 0xbd, 0x21, 0x86, 0xb8, 0x60, 0x4e, 0xb8, 0x0a, 0x21, 0x94, 
+  0x00, 0xf1, 0x13, 0x21, 0x0a, 0x23, 0x00, 0x21, 0x4a, 0x0a, 0xaf, 0xff, 
+  0x68, 0x47, 0x1e, 0x27, 0x81, 0x14, 0x08, 0x47, 0x00, 0x86, 0xb9, 0x61, 
+  0x3a, 0x0a, 0xaf, 0xff, 0x4e, 0xb9, 0x1a, 0x27, 0x01, 0x14, 0xb9, 0x61, 
+  0x2e, 0x0c, 0x00, 0xf1, 0x02, 0x1e, 0x23, 0x81, 0x24, 0x01, 0xa6, 0xb8, 
+  0x61, 0x1a, 0x27, 0x41, 0x14, 0x4e, 0xb8, 0xb9, 0x61, 0x1a, 0x16, 0x00, 
+  0x22, 0x00, 0xa6, 0x4a, 0x04, 0xf0, 0x43, 0xe2, 0x0b, 0x20, 0x00, 0xe1, 
+  0x40, 0xce, 0xc6, 0xe1, 0xc5, 0x80, 0x98, 0x6c, 0x70, 0x8f, 0xbb, 0x35, 
+  0x4b, 0x2c, 0x7c, 0x4c, 0x7d, 0x7d, 0x7b, 0x99, 0x65, 0x3b, 0x63, 0x2f, 
+  0xbb, 0x60, 0xb0, 0xc2, 0xc4, 0xe0, 0x78, 0xe6, 0xc3, 0xa6, 0xc1, 0x16, 
+  0x1c, 0x02, 0x30, 0x0c, 0x70, 0x40, 0x21, 0x0f, 0x07, 0x28, 0x46, 0x14, 
+  0x1c, 0x04, 0x30, 0x44, 0xc0, 0x40, 0x24, 0x82, 0x35, 0x60, 0xd9, 0x6c, 
+  0x71, 0xe1, 0x40, 0xca, 0x0f, 0x60, 0x00, 0x17, 0x1c, 0x03, 0x31, 0x96, 
+  0x0b, 0x6f, 0xea, 0x0c, 0x71, 0x6e, 0x03, 0xf0, 0x0a, 0x08, 0x1e, 0x20, 
+  0x8d, 0x9a, 0x09, 0x60, 0x00, 0x0c, 0x75, 0x40, 0x24, 0xc2, 0x35, 0x6c, 
+  0x71, 0x00, 0x41, 0xa6, 0x0f, 0x60, 0x00, 0xe1, 0x40, 0x76, 0x22, 0x00, 
+  0xf9, 0xc9, 0x76, 0x84, 0xc0, 0xf6, 0x08, 0xaf, 0xfe, 0xc1, 0x41, 0xcd, 
+  0x08, 0x31, 0x00, 0x08, 0x46, 0x15, 0x14, 0x80, 0x30, 0xc5, 0x08, 0x31, 
+  0x01, 0xcd, 0x70, 0xcd, 0x70, 0x80, 0xc2, 0x31, 0xd9, 0x0e, 0xdb, 0xe1, 
+  0x40, 0x0c, 0x1c, 0x84, 0x33, 0x42, 0xc6, 0x41, 0xc6, 0xca, 0x0d, 0xef, 
+  0xff, 0x40, 0xc6, 0x06, 0x14, 0x82, 0x30, 0x16, 0x14, 0x80, 0x30, 0x05, 
+  0x14, 0x81, 0x30, 0x07, 0x14, 0x8c, 0x30, 0x03, 0x14, 0x83, 0x30, 0x02, 
+  0x14, 0x8b, 0x30, 0x21, 0xc7, 0x08, 0xba, 0x6b, 0xb8, 0x10, 0xbc, 0x08, 
+  0xbb, 0x59, 0x61, 0x57, 0x68, 0x84, 0x20, 0x83, 0x0f, 0xcb, 0x40, 0x00, 
+  0xff, 0x00, 0x00, 0xcb, 0x41, 0x80, 0x00, 0x00, 0x00, 0x10, 0xbf, 0x61, 
+  0x73, 0x99, 0x61, 0x1d, 0x78, 0x0a, 0x26, 0x00, 0x02, 0xfb, 0x63, 0x31, 
+  0x71, 0x45, 0x78, 0xc3, 0x42, 0xa1, 0x00, 0x9c, 0x12, 0xca, 0x26, 0x25, 
+  0x00, 0x31, 0x73, 0x80, 0x82, 0xc0, 0x23, 0x06, 0x02, 0x48, 0x33, 0x83, 
+  0x00, 0x2f, 0x23, 0x07, 0x90, 0x00, 0x34, 0xcc, 0x10, 0x13, 0xf2, 0x41, 
+  0x82, 0x00, 0x26, 0x40, 0x00, 0x48, 0x30, 0x80, 0x00, 0x1f, 0x0b, 0x70, 
+  0x11, 0x00, 0x32, 0x03, 0x00, 0x1b, 0x0b, 0x10, 0x11, 0x29, 0x0b, 0x71, 
+  0x10, 0xf8, 0xde, 0x85, 0xa5, 0xcd, 0x70, 0x0e, 0xf0, 0x86, 0xa5, 0x0c, 
+  0xf0, 0x67, 0xa5, 0x0a, 0xf0, 0x26, 0x85, 0x05, 0x85, 0x47, 0x85, 0x02, 
+  0x30, 0x41, 0x00, 0x02, 0x32, 0xc0, 0x00, 0x28, 0xa5, 0x09, 0xa5, 0xcd, 
+  0x78, 0xc6, 0xe8, 0x02, 0x40, 0x12, 0x00, 0xdc, 0x09, 0x70, 0x02, 0x1d, 
+  0x15, 0x88, 0x02, 0x11, 0xf4, 0x18, 0x00, 0x1d, 0x14, 0x18, 0x00, 0x20, 
+  0x04, 0x0a, 0x18, 0x00, 0x1d, 0x13, 0x18, 0x00, 0x11, 0x2c, 0x18, 0x00, 
+  0xf1, 0x0d, 0x12, 0x00, 0x3e, 0x79, 0x00, 0x43, 0x8c, 0x20, 0xc7, 0x8f, 
+  0x24, 0xd8, 0xe0, 0x20, 0xc9, 0x07, 0x8c, 0x23, 0x38, 0x80, 0xe0, 0x20, 
+  0xcb, 0x07, 0x8c, 0x21, 0xc7, 0x8f, 0x10, 0x00, 0x13, 0x21, 0x10, 0x00, 
+  0x13, 0x22, 0x10, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0xd2, 0x02, 0xf0, 
+  0x1d, 0xe6, 0xc3, 0xa3, 0xc1, 0xbf, 0x80, 0x40, 0x20, 0x0e, 0x07, 0x81, 
+  0xc2, 0x7c, 0xd9, 0x6c, 0x72, 0x72, 0x0c, 0xef, 0xff, 0xc1, 0x40, 0x05, 
+  0x14, 0x80, 0x30, 0x38, 0x15, 0x06, 0x10, 0x80, 0xc2, 0x0b, 0x1c, 0x02, 
+  0x30, 0xa0, 0xb8, 0x60, 0xc0, 0x7c, 0xd9, 0x6c, 0x71, 0x96, 0x02, 0xf0, 
+  0x0d, 0x36, 0x0e, 0x60, 0x00, 0xc1, 0x40, 0x80, 0xc2, 0x2f, 0xd9, 0x6c, 
+  0x71, 0xc1, 0x40, 0xee, 0x0d, 0x60, 0x00, 0x00, 0x1c, 0x43, 0x30, 0x0e, 
+  0x85, 0xb6, 0x09, 0x6f, 0xea, 0x98, 0x07, 0x71, 0x81, 0xc2, 0x3c, 0xd9, 
+  0x6c, 0x75, 0x2e, 0x46, 0x00, 0xf0, 0x38, 0xcb, 0x44, 0xa1, 0x00, 0x74, 
+  0x1e, 0xe0, 0x94, 0x22, 0x94, 0x61, 0x94, 0x03, 0x94, 0x22, 0xc2, 0x60, 
+  0xc7, 0x84, 0x94, 0x28, 0xbf, 0x05, 0xb9, 0x02, 0x1c, 0xc2, 0x30, 0x28, 
+  0xbb, 0x06, 0xb8, 0xc4, 0xbf, 0x44, 0x21, 0x01, 0x08, 0x84, 0x22, 0x02, 
+  0x00, 0xc2, 0xbb, 0x84, 0x20, 0x01, 0x00, 0xe5, 0x79, 0x07, 0xbc, 0x65, 
+  0x7a, 0x25, 0x78, 0x45, 0x22, 0x02, 0x0e, 0x85, 0x78, 0x03, 0x1c, 0x82, 
+  0x30, 0x01, 0x1c, 0x02, 0x30, 0x80, 0x52, 0x00, 0x30, 0x74, 0x82, 0x0d, 
+  0x78, 0x00, 0x33, 0x0e, 0x85, 0x4e, 0x68, 0x00, 0x00, 0x9e, 0x00, 0x44, 
+  0x40, 0x24, 0xc2, 0x32, 0x98, 0x00, 0x11, 0x9e, 0x20, 0x00, 0x53, 0xc6, 
+  0xc7, 0xe4, 0xc3, 0xa4, 0xd0, 0x00, 0x40, 0x40, 0x24, 0x42, 0x33, 0xd2, 
+  0x00, 0x20, 0xa2, 0x0b, 0x8c, 0x00, 0x15, 0x0e, 0xd2, 0x00, 0x1b, 0x0f, 
+  0xd2, 0x00, 0x11, 0x66, 0x3a, 0x00, 0x04, 0xd2, 0x00, 0x11, 0x1a, 0xd2, 
+  0x00, 0x62, 0x83, 0x30, 0x0e, 0x85, 0xe6, 0x08, 0x6a, 0x00, 0x00, 0xbe, 
+  0x04, 0xf0, 0x13, 0x8a, 0x1e, 0x20, 0x90, 0x41, 0x90, 0x82, 0x90, 0x63, 
+  0x90, 0x04, 0x90, 0x60, 0xc1, 0x02, 0x1c, 0x82, 0x30, 0x28, 0xb9, 0x28, 
+  0xba, 0x06, 0x1c, 0xc4, 0x30, 0x08, 0x1c, 0x04, 0x30, 0x01, 0x1c, 0x42, 
+  0x30, 0xae, 0x00, 0xf3, 0x04, 0x80, 0xc2, 0x36, 0xd9, 0x0a, 0xdb, 0xc1, 
+  0x40, 0xd6, 0x0c, 0x60, 0x00, 0x04, 0x1c, 0x04, 0x33, 0x0e, 0x85, 0xa2, 
+  0x44, 0x00, 0x03, 0xae, 0x00, 0x00, 0x90, 0x00, 0x01, 0x74, 0x00, 0x20, 
+  0xf2, 0x0c, 0x74, 0x00, 0x4a, 0xc4, 0xc7, 0xe0, 0x78, 0xd0, 0x01, 0x4c, 
+  0xfc, 0x18, 0x3b, 0xdc, 0xe4, 0x01, 0x3d, 0x14, 0x6b, 0x3a, 0x14, 0x00, 
+  0x3d, 0xb0, 0x1a, 0x35, 0x14, 0x00, 0x3d, 0x54, 0x1b, 0x37, 0x14, 0x00, 
+  0xf0, 0x05, 0xa4, 0x1b, 0x38, 0xdc, 0x3e, 0x79, 0x11, 0x78, 0xe0, 0x7f, 
+  0x10, 0x78, 0xe0, 0x78, 0xe0, 0x7f, 0x08, 0x20, 0x40, 0x00, 0x08, 0x00, 
+  0x11, 0x09, 0x08, 0x00, 0xf0, 0xa5, 0x00, 0x42, 0x10, 0x71, 0xca, 0x22, 
+  0x4b, 0x00, 0x85, 0xf6, 0x32, 0x78, 0x50, 0x70, 0xca, 0x22, 0x09, 0x00, 
+  0xe0, 0x7f, 0x4e, 0x78, 0xe0, 0x78, 0x2c, 0x70, 0x9e, 0xb9, 0x20, 0x42, 
+  0x10, 0x71, 0x22, 0xb9, 0x3e, 0xf7, 0x2c, 0x70, 0x0c, 0xea, 0x5b, 0x61, 
+  0x70, 0x70, 0xd4, 0x21, 0x86, 0x00, 0xc2, 0x20, 0xc6, 0x00, 0x41, 0x2a, 
+  0x82, 0x80, 0x3d, 0x79, 0xf8, 0xf5, 0xe0, 0x7f, 0x30, 0x78, 0x80, 0x98, 
+  0x61, 0x98, 0x42, 0x98, 0x89, 0x7c, 0x69, 0x7b, 0x49, 0x7a, 0x98, 0x63, 
+  0xcd, 0x07, 0xef, 0xff, 0x58, 0x60, 0xf0, 0xc3, 0xa1, 0xc1, 0x44, 0x14, 
+  0x0c, 0x00, 0x08, 0x47, 0x80, 0x40, 0x0a, 0x20, 0x00, 0x21, 0x70, 0x44, 
+  0x50, 0x43, 0x28, 0x46, 0x60, 0x7c, 0x03, 0x1c, 0xc3, 0x31, 0xad, 0x70, 
+  0x04, 0x30, 0x40, 0x83, 0x4e, 0x70, 0xc5, 0xf6, 0x07, 0x36, 0x12, 0x70, 
+  0x7a, 0x44, 0x00, 0x00, 0x22, 0x16, 0x80, 0x10, 0x40, 0x26, 0x91, 0x11, 
+  0xa6, 0xae, 0x10, 0xe8, 0x05, 0x8e, 0x21, 0x68, 0x55, 0x08, 0x75, 0x01, 
+  0x25, 0xae, 0x25, 0x20, 0x00, 0x00, 0x05, 0xf0, 0x18, 0xf0, 0x19, 0xf0, 
+  0x1c, 0xf0, 0x1d, 0xf0, 0x00, 0x19, 0x43, 0x23, 0x20, 0xf0, 0x07, 0x8e, 
+  0x2a, 0xe8, 0x40, 0x20, 0x00, 0x27, 0x56, 0x04, 0x00, 0x42, 0x01, 0xf0, 
+  0x06, 0x9a, 0x0b, 0x60, 0x00, 0x22, 0x42, 0x42, 0x0f, 0x2f, 0xea, 0x0c, 
+  0x71, 0xa5, 0xae, 0x1c, 0xf0, 0x00, 0x19, 0xc3, 0x22, 0x0c, 0x2c, 0x00, 
+  0x20, 0x25, 0x0a, 0x0c, 0x00, 0xd8, 0x24, 0x06, 0xf0, 0x98, 0x13, 0x80, 
+  0x20, 0x12, 0xe8, 0xa6, 0xae, 0xa5, 0xae, 0x38, 0x00, 0x11, 0x62, 0x38, 
+  0x00, 0x11, 0x0a, 0x38, 0x00, 0xf0, 0x27, 0x0c, 0x70, 0xd0, 0xc7, 0x14, 
+  0x8f, 0x16, 0xe8, 0x21, 0x87, 0x02, 0x87, 0x04, 0x30, 0x40, 0x80, 0x58, 
+  0x00, 0x06, 0x00, 0xb6, 0x0e, 0x2f, 0xea, 0x00, 0x87, 0x00, 0x87, 0x42, 
+  0x87, 0x25, 0x8e, 0x01, 0x32, 0x00, 0x20, 0x01, 0x32, 0x00, 0x00, 0x24, 
+  0x77, 0x25, 0xae, 0x02, 0xa7, 0xde, 0xf1, 0x79, 0x24, 0x00, 0x20, 0x25, 
+  0x68, 0x4e, 0x00, 0x42, 0x40, 0x24, 0xc2, 0x30, 0x50, 0x00, 0x40, 0x12, 
+  0x0b, 0x60, 0x00, 0xdc, 0x00, 0xb0, 0xc3, 0x40, 0x40, 0x40, 0x00, 0x00, 
+  0x14, 0x1f, 0x43, 0x10, 0x76, 0x42, 0x00, 0xfa, 0x02, 0xa7, 0x05, 0x8e, 
+  0x20, 0x87, 0x04, 0x77, 0x22, 0xa7, 0x05, 0xae, 0xc2, 0xf1, 0xb4, 0xaf, 
+  0xc0, 0xf1, 0xe8, 0x06, 0x62, 0xac, 0x5b, 0x0c, 0xdc, 0x3e, 0x79, 0x4c, 
+  0x06, 0xf1, 0xac, 0xad, 0xc1, 0x08, 0x44, 0x0c, 0x72, 0x7a, 0x09, 0xaf, 
+  0xff, 0x20, 0x43, 0x4c, 0xc0, 0x72, 0x09, 0xaf, 0xff, 0x09, 0xd8, 0x40, 
+  0xc0, 0x6a, 0x09, 0xaf, 0xff, 0x08, 0xd8, 0x41, 0xc0, 0x62, 0x09, 0xaf, 
+  0xff, 0x0b, 0xd8, 0x42, 0xc0, 0x5a, 0x09, 0xaf, 0xff, 0x12, 0xd8, 0x43, 
+  0xc0, 0x52, 0x09, 0xaf, 0xff, 0x11, 0xd8, 0x44, 0xc0, 0x4a, 0x09, 0xaf, 
+  0xff, 0x14, 0xd8, 0x45, 0xc0, 0x42, 0x09, 0xaf, 0xff, 0x1b, 0xd8, 0x46, 
+  0xc0, 0x3a, 0x09, 0xaf, 0xff, 0x1a, 0xd8, 0x47, 0xc0, 0x32, 0x09, 0xaf, 
+  0xff, 0x24, 0xd8, 0x48, 0xc0, 0x2a, 0x09, 0xaf, 0xff, 0x27, 0xd8, 0x49, 
+  0xc0, 0x22, 0x09, 0xaf, 0xff, 0x21, 0xd8, 0x4a, 0xc0, 0x1a, 0x09, 0xaf, 
+  0xff, 0x2d, 0xd8, 0x58, 0x8c, 0x40, 0x41, 0x80, 0x21, 0x3e, 0x04, 0x11, 
+  0x09, 0x75, 0x03, 0x4b, 0xc0, 0x21, 0x0e, 0x4f, 0x70, 0x00, 0x00, 0x07, 
+  0x1f, 0x40, 0x40, 0x80, 0x20, 0xfd, 0x09, 0x8b, 0xe0, 0xf6, 0x03, 0x0d, 
+  0x00, 0x11, 0x26, 0x00, 0xf0, 0x00, 0x00, 0xa7, 0x0a, 0xea, 0x03, 0x01, 
+  0x00, 0x2b, 0x09, 0x75, 0x03, 0x80, 0x22, 0xfd, 0x09, 0x25, 0x20, 0x40, 
+  0x00, 0x0d, 0xf0, 0x22, 0xf0, 0x22, 0xf0, 0x2e, 0xf0, 0x2c, 0xf0, 0x2c, 
+  0xf0, 0x2a, 0xf0, 0x2a, 0xf0, 0x1e, 0xf0, 0x20, 0xf0, 0x20, 0x14, 0x00, 
+  0xf0, 0x91, 0x0c, 0xdd, 0x2d, 0xf0, 0x45, 0x0a, 0x35, 0x03, 0xad, 0x70, 
+  0x25, 0x20, 0x80, 0x00, 0x27, 0xf0, 0x0c, 0xf0, 0x1c, 0xf0, 0x1a, 0xf0, 
+  0x18, 0xf0, 0x1c, 0xf0, 0x16, 0xf0, 0x1c, 0xf0, 0x14, 0xf0, 0x1c, 0xf0, 
+  0x12, 0xf0, 0x1c, 0xf0, 0xad, 0x71, 0x1b, 0xf0, 0x07, 0xdd, 0x19, 0xf0, 
+  0x0d, 0xdd, 0x17, 0xf0, 0xad, 0x74, 0x15, 0xf0, 0xad, 0x75, 0x13, 0xf0, 
+  0xad, 0x76, 0x11, 0xf0, 0x0a, 0xdd, 0x0f, 0xf0, 0x0b, 0xdd, 0x0d, 0xf0, 
+  0xad, 0x77, 0x0b, 0xf0, 0xad, 0x72, 0x09, 0xf0, 0xad, 0x73, 0x07, 0xf0, 
+  0x08, 0xdd, 0x05, 0xf0, 0x09, 0xdd, 0x03, 0xf0, 0x0e, 0xdd, 0x00, 0x83, 
+  0x0c, 0x13, 0x07, 0x00, 0x08, 0x13, 0x04, 0x00, 0x04, 0x13, 0x05, 0x00, 
+  0x50, 0x20, 0xfe, 0x87, 0x0a, 0x26, 0x00, 0x30, 0x32, 0xf4, 0x50, 0x25, 
+  0xfe, 0x87, 0x30, 0xf4, 0x50, 0x24, 0xfe, 0x87, 0x2c, 0xf4, 0x50, 0x27, 
+  0xfe, 0x87, 0x2a, 0xf4, 0xe4, 0x83, 0x50, 0x27, 0xfe, 0x97, 0x26, 0xf4, 
+  0xc5, 0x83, 0x50, 0x26, 0xfe, 0x97, 0x22, 0xf4, 0x2c, 0x83, 0x50, 0x21, 
+  0xfe, 0x87, 0x1e, 0xf4, 0x0a, 0x83, 0x36, 0x00, 0xf0, 0x10, 0x1a, 0xf4, 
+  0x4b, 0x83, 0x50, 0x22, 0xfe, 0x87, 0x16, 0xf4, 0x86, 0x83, 0x50, 0x24, 
+  0xfe, 0x97, 0x12, 0xf4, 0x1c, 0x13, 0x0b, 0x00, 0x50, 0x23, 0xfe, 0x97, 
+  0x0c, 0xf4, 0x20, 0x13, 0x08, 0x5a, 0x00, 0xf0, 0x00, 0x97, 0x08, 0xf4, 
+  0x24, 0x13, 0x06, 0x00, 0xef, 0x70, 0x50, 0x26, 0xfe, 0x87, 0x0f, 0xf2, 
+  0x0c, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x28, 0x00, 0xf0, 0x03, 0x86, 0x83, 
+  0x4b, 0x83, 0x2c, 0x83, 0x0a, 0x83, 0xc5, 0x83, 0xe4, 0x83, 0xef, 0x71, 
+  0x5e, 0x25, 0x09, 0x1e, 0xc8, 0x06, 0xf0, 0xb4, 0x78, 0x19, 0x00, 0x21, 
+  0x49, 0x13, 0x24, 0x19, 0x00, 0x10, 0x60, 0x40, 0x30, 0x19, 0x40, 0x10, 
+  0x20, 0x19, 0x80, 0x13, 0x1c, 0x19, 0xc0, 0x13, 0x18, 0x19, 0xc0, 0x11, 
+  0x08, 0x19, 0x00, 0x11, 0x04, 0x19, 0x40, 0x11, 0x00, 0x19, 0x80, 0x17, 
+  0x34, 0x19, 0xc2, 0x17, 0x2c, 0x19, 0x80, 0x10, 0x28, 0x19, 0x80, 0x11, 
+  0x14, 0x19, 0x00, 0x12, 0x10, 0x19, 0xc0, 0x12, 0x5e, 0x0e, 0x6f, 0xff, 
+  0x0c, 0x19, 0x00, 0x13, 0x4a, 0x24, 0xc0, 0x73, 0x2c, 0x70, 0x0e, 0x70, 
+  0x2e, 0x70, 0x4e, 0x70, 0x6e, 0x70, 0x8e, 0x70, 0xae, 0x70, 0xce, 0x70, 
+  0xee, 0x70, 0x0f, 0x70, 0x2f, 0x70, 0x6f, 0x70, 0xcd, 0x70, 0x0d, 0x70, 
+  0x6d, 0x70, 0x35, 0x19, 0x02, 0x10, 0xa8, 0x20, 0x41, 0x02, 0x5a, 0x23, 
+  0x02, 0x1e, 0x65, 0x71, 0x58, 0x65, 0xa2, 0x62, 0x8c, 0x80, 0x6b, 0x80, 
+  0x04, 0x32, 0x00, 0x82, 0xca, 0x21, 0x89, 0x00, 0xca, 0x20, 0x89, 0x10, 
+  0x49, 0x80, 0x04, 0x34, 0x80, 0x93, 0xca, 0x26, 0x09, 0x13, 0x04, 0x33, 
+  0xc0, 0x86, 0xca, 0x23, 0xc9, 0x30, 0x68, 0x80, 0x04, 0x32, 0x40, 0x86, 
+  0xca, 0x21, 0x89, 0x30, 0x47, 0x80, 0x04, 0x33, 0x00, 0x85, 0xca, 0x24, 
+  0xc9, 0x20, 0x66, 0x80, 0x04, 0x32, 0xc0, 0x84, 0xca, 0x23, 0x89, 0x20, 
+  0x4a, 0x80, 0x04, 0x33, 0x80, 0x84, 0xca, 0x22, 0xc9, 0x20, 0x65, 0x48, 
+  0x00, 0xf0, 0x26, 0x86, 0xca, 0x20, 0x89, 0x30, 0x44, 0x80, 0x04, 0x33, 
+  0xc0, 0x85, 0xca, 0x27, 0xc9, 0x20, 0x63, 0x80, 0x04, 0x32, 0x80, 0x85, 
+  0xca, 0x26, 0x89, 0x20, 0x42, 0x80, 0x01, 0x80, 0x04, 0x33, 0x40, 0x85, 
+  0xca, 0x25, 0xc9, 0x20, 0x04, 0x32, 0x40, 0x84, 0xca, 0x21, 0x89, 0x20, 
+  0x04, 0x30, 0x00, 0x84, 0xca, 0x20, 0x09, 0x20, 0xb8, 0x00, 0xf1, 0x14, 
+  0x6d, 0x70, 0xa8, 0x20, 0x02, 0x05, 0x5a, 0x23, 0x03, 0x1e, 0x6c, 0x4d, 
+  0x68, 0x60, 0x14, 0x70, 0x8d, 0xf2, 0x6d, 0x4d, 0x68, 0x60, 0x3b, 0x08, 
+  0xf3, 0x09, 0x42, 0x20, 0x02, 0x02, 0x65, 0x0a, 0x15, 0x05, 0x0c, 0x12, 
+  0x02, 0xf0, 0x23, 0x62, 0xf0, 0x5b, 0xf0, 0x74, 0xf0, 0x4f, 0xf0, 0x72, 
+  0xf0, 0x70, 0xf0, 0x70, 0xf0, 0x6e, 0xf0, 0x6e, 0xf0, 0x4e, 0xf0, 0x44, 
+  0xf0, 0x6a, 0xf0, 0x38, 0xf0, 0x68, 0xf0, 0x68, 0xf0, 0x66, 0xf0, 0x66, 
+  0xf0, 0x64, 0xf0, 0x37, 0xf0, 0x15, 0xf0, 0x00, 0x42, 0x80, 0x22, 0xbd, 
+  0x03, 0x45, 0x0a, 0x55, 0x03, 0x36, 0x00, 0xf0, 0x58, 0x4f, 0xf0, 0x23, 
+  0xf0, 0x52, 0xf0, 0x17, 0xf0, 0x09, 0xf0, 0x24, 0xf0, 0x27, 0xf0, 0x2c, 
+  0xf0, 0x2f, 0xf0, 0x34, 0xf0, 0x37, 0xf0, 0x41, 0xf0, 0x3a, 0xf0, 0x78, 
+  0x65, 0x04, 0x80, 0x07, 0x36, 0x00, 0x20, 0x48, 0xf0, 0x73, 0x08, 0x90, 
+  0x00, 0x77, 0x08, 0x70, 0x08, 0xa4, 0xe0, 0x0c, 0x70, 0x42, 0xf4, 0x78, 
+  0x65, 0x0a, 0x80, 0x07, 0x30, 0x00, 0x30, 0x3c, 0xf0, 0x6d, 0x08, 0xf0, 
+  0x09, 0xad, 0xe0, 0x0c, 0x70, 0x38, 0xf4, 0x78, 0x65, 0x0b, 0x80, 0x07, 
+  0x33, 0x00, 0x30, 0x32, 0xf0, 0x78, 0x65, 0x03, 0x80, 0x07, 0x35, 0x00, 
+  0x20, 0x2c, 0xf0, 0x78, 0x65, 0x05, 0x80, 0x07, 0x37, 0x00, 0x20, 0x28, 
+  0xf0, 0x78, 0x65, 0x07, 0x1e, 0x00, 0xf0, 0x0b, 0x20, 0x22, 0xf0, 0x78, 
+  0x65, 0x06, 0x80, 0x07, 0x32, 0x00, 0x20, 0x1e, 0xf0, 0x78, 0x65, 0x08, 
+  0x80, 0x07, 0x34, 0x00, 0x20, 0x18, 0xf0, 0x78, 0x65, 0x01, 0x50, 0x00, 
+  0xf0, 0x09, 0x20, 0x14, 0xf0, 0x78, 0x65, 0x02, 0x80, 0x07, 0x31, 0x00, 
+  0x20, 0x0e, 0xf0, 0xa0, 0x63, 0x07, 0x31, 0x00, 0x00, 0x0a, 0xf0, 0x78, 
+  0x65, 0x0c, 0x84, 0x00, 0x60, 0x10, 0x06, 0xf0, 0x78, 0x65, 0x09, 0x1c, 
+  0x00, 0xf0, 0x31, 0x30, 0x48, 0x30, 0x40, 0x02, 0x40, 0x25, 0x82, 0x1d, 
+  0x6c, 0x62, 0x0f, 0x7a, 0x0f, 0x0c, 0xa0, 0x10, 0x7a, 0x65, 0x36, 0x1a, 
+  0x02, 0x00, 0x37, 0x1a, 0x03, 0x00, 0x65, 0x71, 0x0c, 0xc0, 0x05, 0xe8, 
+  0x02, 0x0c, 0xef, 0xff, 0x0c, 0xc0, 0x00, 0xc0, 0x05, 0xe8, 0x00, 0xc0, 
+  0xf6, 0x0b, 0xef, 0xff, 0x02, 0x41, 0x01, 0xc0, 0x05, 0xe8, 0x01, 0xc0, 
+  0xea, 0x0b, 0xef, 0xff, 0x22, 0x41, 0x02, 0x22, 0x00, 0xf0, 0x2e, 0xc0, 
+  0xde, 0x0b, 0xef, 0xff, 0x42, 0x41, 0x03, 0xc0, 0x05, 0xe8, 0x03, 0xc0, 
+  0xd2, 0x0b, 0xef, 0xff, 0x62, 0x41, 0x04, 0xc0, 0x05, 0xe8, 0x04, 0xc0, 
+  0xc6, 0x0b, 0xef, 0xff, 0x82, 0x41, 0x05, 0xc0, 0x05, 0xe8, 0x05, 0xc0, 
+  0xba, 0x0b, 0xef, 0xff, 0xa2, 0x41, 0x06, 0xc0, 0x05, 0xe8, 0x06, 0xc0, 
+  0xae, 0x0b, 0xef, 0xff, 0xc2, 0x41, 0x07, 0xc0, 0x05, 0xe8, 0x07, 0xc0, 
+  0xe6, 0x06, 0xf0, 0x1e, 0xe2, 0x41, 0x08, 0xc0, 0x05, 0xe8, 0x08, 0xc0, 
+  0x96, 0x0b, 0xef, 0xff, 0x03, 0x41, 0x09, 0xc0, 0x05, 0xe8, 0x09, 0xc0, 
+  0x8a, 0x0b, 0xef, 0xff, 0x23, 0x41, 0x0b, 0xc0, 0x05, 0xe8, 0x0b, 0xc0, 
+  0x7e, 0x0b, 0xef, 0xff, 0x63, 0x41, 0x0a, 0xc0, 0x05, 0xe8, 0x0a, 0xc0, 
+  0x72, 0x16, 0x07, 0xd0, 0x41, 0x4a, 0x0b, 0x4f, 0xff, 0xad, 0xc0, 0x04, 
+  0x14, 0x1b, 0x34, 0xda, 0xc6, 0x10, 0x06, 0xff, 0x86, 0x65, 0xb8, 0x0b, 
+  0x08, 0x75, 0x01, 0x34, 0x70, 0xc0, 0x22, 0x62, 0x00, 0xe0, 0x7f, 0x4f, 
+  0x78, 0xe0, 0x78, 0xe4, 0xc3, 0xa1, 0xc1, 0x28, 0x46, 0x15, 0xe9, 0x40, 
+  0x20, 0x0d, 0x07, 0x5d, 0x78, 0x41, 0x2a, 0x41, 0x01, 0xc3, 0xb8, 0x03, 
+  0x1c, 0x42, 0x30, 0x02, 0x1c, 0x02, 0x30, 0x40, 0x24, 0x82, 0x30, 0x5b, 
+  0xd9, 0x6c, 0x72, 0xe6, 0x0d, 0x20, 0x00, 0xa1, 0x40, 0x05, 0xe8, 0xc4, 
+  0xc7, 0x0c, 0x77, 0xc4, 0xc7, 0x5e, 0xd9, 0x80, 0xdb, 0xa1, 0x40, 0xd2, 
+  0x0d, 0x20, 0x00, 0xc1, 0x42, 0xc4, 0xc7, 0x47, 0x89, 0x6b, 0xba, 0x2f, 
+  0x22, 0x83, 0x80, 0x0a, 0xf2, 0x31, 0x0a, 0x50, 0x01, 0x33, 0x0a, 0x30, 
+  0x01, 0x54, 0x71, 0xe0, 0x7d, 0x00, 0x80, 0xe0, 0x7f, 0x02, 0xa1, 0x40, 
+  0x80, 0x02, 0x81, 0x43, 0xa1, 0x02, 0x30, 0x80, 0x00, 0x04, 0x30, 0x80, 
+  0x8f, 0x96, 0x43, 0x00, 0x00, 0x6f, 0x20, 0x0b, 0x00, 0xe0, 0x7f, 0x20, 
+  0x19, 0x02, 0x00, 0x01, 0x80, 0xe0, 0x7f, 0x04, 0xa1, 0x41, 0x80, 0x04, 
+  0x81, 0x45, 0x22, 0x00, 0x00, 0xf0, 0x0c, 0x21, 0x19, 0x02, 0x00, 0xe0, 
+  0x78, 0xee, 0xc3, 0xa3, 0xc1, 0xff, 0x80, 0x1c, 0xe0, 0x82, 0xc2, 0x7d, 
+  0xd9, 0x6c, 0x72, 0xba, 0x0b, 0xaf, 0xff, 0x10, 0x42, 0x09, 0xe8, 0x07, 
+  0x10, 0x17, 0x6e, 0x07, 0x93, 0x42, 0x32, 0x82, 0xb8, 0x09, 0x1c, 0x02, 
+  0x30, 0x7d, 0xfa, 0x05, 0xf1, 0x66, 0x42, 0x40, 0x7a, 0x0d, 0x20, 0x00, 
+  0x2e, 0x70, 0x8a, 0x23, 0x81, 0x26, 0x0e, 0x70, 0xcd, 0x70, 0xad, 0x70, 
+  0xc3, 0x40, 0xc8, 0x42, 0x00, 0x00, 0xc6, 0x08, 0x2f, 0xea, 0xab, 0x23, 
+  0x08, 0x2e, 0x80, 0xc2, 0x0c, 0xd9, 0x07, 0xdb, 0x72, 0x0b, 0xaf, 0xff, 
+  0x42, 0x40, 0x06, 0x14, 0x81, 0x30, 0x21, 0xc3, 0x02, 0x14, 0x8b, 0x30, 
+  0x05, 0x14, 0x82, 0x30, 0x03, 0x14, 0x8c, 0x30, 0x01, 0x14, 0x88, 0x30, 
+  0x26, 0x71, 0x08, 0xb9, 0x08, 0xbb, 0x40, 0x2b, 0x0b, 0x12, 0x2f, 0x20, 
+  0x47, 0x04, 0x45, 0x79, 0x65, 0x7c, 0x05, 0x23, 0x03, 0x12, 0x14, 0x74, 
+  0x2e, 0x78, 0x8e, 0x79, 0x6e, 0x7a, 0x00, 0x20, 0x10, 0x20, 0x3e, 0x66, 
+  0xac, 0x07, 0xe5, 0xff, 0x5d, 0x65, 0x40, 0x24, 0x82, 0x32, 0x41, 0xd9, 
+  0x6c, 0x72, 0x26, 0x4e, 0x00, 0xf2, 0x31, 0x44, 0x2d, 0x0d, 0x11, 0x0b, 
+  0x14, 0x82, 0x30, 0x44, 0x2e, 0x0e, 0x11, 0xac, 0x7d, 0x44, 0x28, 0x10, 
+  0x21, 0xcc, 0x7e, 0xb9, 0x66, 0x1a, 0x20, 0x00, 0x24, 0xad, 0x70, 0x38, 
+  0x60, 0x48, 0x30, 0x80, 0x00, 0x2f, 0x30, 0x00, 0x00, 0x48, 0x30, 0xc1, 
+  0x02, 0x8a, 0xea, 0x00, 0x21, 0x80, 0x0f, 0xff, 0xff, 0x47, 0xc1, 0x8c, 
+  0x20, 0xca, 0x83, 0x3c, 0x00, 0x05, 0x00, 0x13, 0x0a, 0x51, 0x00, 0x14, 
+  0x00, 0xb3, 0xa3, 0xe0, 0x8c, 0x20, 0xc5, 0x81, 0x94, 0xf7, 0x15, 0x0a, 
+  0x91, 0x12, 0x00, 0xf8, 0x1f, 0x51, 0xf0, 0x8c, 0x20, 0xc2, 0x88, 0x8c, 
+  0xf7, 0x80, 0x21, 0x20, 0x0a, 0x65, 0xd8, 0xd1, 0xe1, 0x65, 0xdd, 0xca, 
+  0x20, 0x25, 0x00, 0x54, 0x73, 0xca, 0x25, 0x01, 0x10, 0x54, 0x17, 0x00, 
+  0x16, 0x8c, 0x20, 0x02, 0x80, 0xcc, 0x20, 0x82, 0x8f, 0x00, 0x00, 0xff, 
+  0x00, 0x11, 0xf2, 0x1a, 0x01, 0x19, 0xa2, 0x1a, 0x01, 0xf0, 0x65, 0x62, 
+  0x0c, 0x20, 0x00, 0x42, 0x40, 0xa1, 0x40, 0xce, 0xc7, 0xe0, 0x78, 0xf1, 
+  0xc0, 0xc3, 0x41, 0xa1, 0x00, 0x2c, 0x17, 0xfe, 0x0d, 0x2f, 0xfb, 0x1c, 
+  0x49, 0xd1, 0xc0, 0xe0, 0x7f, 0x0c, 0x70, 0xe2, 0xc2, 0x08, 0x45, 0x07, 
+  0x80, 0x0c, 0xe8, 0x2c, 0x70, 0x86, 0x0a, 0xaf, 0xff, 0xa1, 0x40, 0x2c, 
+  0x70, 0x36, 0x09, 0xef, 0xff, 0xa1, 0x40, 0x0c, 0x70, 0xc2, 0xc6, 0x22, 
+  0xd8, 0xc2, 0xc6, 0xf1, 0xc0, 0x27, 0x80, 0x06, 0xe9, 0x6a, 0x0a, 0xaf, 
+  0xff, 0x2c, 0x70, 0x0c, 0x70, 0x03, 0xf0, 0x22, 0xd8, 0xd1, 0xc0, 0xe0, 
+  0x7e, 0xe0, 0x78, 0xf8, 0x1c, 0xc8, 0xb7, 0x47, 0x80, 0x09, 0xea, 0x20, 
+  0x81, 0x41, 0xc1, 0x4a, 0x0a, 0xaf, 0xff, 0x81, 0xc1, 0x0c, 0x70, 0x02, 
+  0xf0, 0x24, 0xd8, 0x08, 0x14, 0x1f, 0x34, 0x20, 0x00, 0x60, 0xe2, 0xc2, 
+  0x27, 0x80, 0x0e, 0xe9, 0x70, 0x00, 0xf0, 0x21, 0xec, 0x16, 0x61, 0x81, 
+  0x08, 0x11, 0x02, 0x04, 0xad, 0x70, 0x05, 0x22, 0xfe, 0x80, 0x05, 0xf2, 
+  0x1e, 0x0a, 0x8f, 0xff, 0x03, 0xf0, 0x24, 0xdd, 0xa1, 0x40, 0xc2, 0xc6, 
+  0xe0, 0x78, 0xe4, 0xc2, 0x47, 0x80, 0x28, 0x46, 0x16, 0xea, 0x40, 0x8e, 
+  0xad, 0x70, 0xe4, 0xe2, 0x13, 0xf7, 0xc3, 0x43, 0x32, 0x00, 0xf2, 0x09, 
+  0x98, 0x4b, 0x80, 0x89, 0x1b, 0x0c, 0x80, 0x10, 0x8b, 0x80, 0x4a, 0x80, 
+  0x81, 0xa3, 0x40, 0xa3, 0x40, 0x8e, 0xe6, 0x09, 0xaf, 0xff, 0x48, 0xab, 
+  0x38, 0x00, 0x20, 0xc4, 0xc6, 0xcc, 0x00, 0x86, 0x47, 0x80, 0x54, 0x70, 
+  0x20, 0x42, 0x13, 0xf2, 0x64, 0x00, 0xe0, 0x0c, 0x04, 0x05, 0x24, 0xfe, 
+  0x90, 0x0b, 0xf2, 0x8c, 0x22, 0xc3, 0x8f, 0xcc, 0x22, 0x1c, 0x01, 0x82, 
+  0x80, 0x00, 0x03, 0xf4, 0xae, 0x09, 0x8f, 0xff, 0xb4, 0x00, 0xf0, 0x07, 
+  0xe4, 0xc3, 0xa2, 0xc1, 0x6d, 0x81, 0x4c, 0x81, 0x2e, 0x81, 0x08, 0x46, 
+  0xc3, 0x40, 0x50, 0x43, 0x7f, 0xd6, 0x00, 0x33, 0x03, 0x00, 0xf0, 0x05, 
+  0xf0, 0x29, 0xa8, 0x1f, 0x00, 0x32, 0x02, 0x00, 0x00, 0x31, 0x00, 0x00, 
+  0x48, 0x33, 0xc1, 0x02, 0x63, 0x95, 0x48, 0x32, 0xc2, 0x02, 0x48, 0x30, 
+  0xc0, 0x02, 0x8b, 0x44, 0x40, 0xb4, 0x21, 0xb4, 0x02, 0xb4, 0x80, 0xc2, 
+  0xc3, 0x40, 0xa1, 0x00, 0x10, 0x17, 0x9a, 0x08, 0x6f, 0xfb, 0xa1, 0x41, 
+  0x98, 0x4d, 0x2f, 0x26, 0x07, 0xf0, 0x00, 0xa9, 0x04, 0xf2, 0xb2, 0x07, 
+  0x82, 0xc1, 0x40, 0x0c, 0x70, 0xc4, 0xc7, 0xf1, 0xc0, 0x22, 0x00, 0x00, 
+  0x8e, 0x00, 0xa2, 0xa8, 0x1f, 0x12, 0x0a, 0x6f, 0xfb, 0x00, 0x18, 0x05, 
+  0x00, 0x64, 0x01, 0x02, 0x78, 0x01, 0x32, 0xb0, 0x1f, 0x22, 0x8a, 0x00, 
+  0x34, 0x7f, 0x0c, 0x70, 0x40, 0x01, 0xf0, 0x0b, 0x10, 0xea, 0x20, 0x81, 
+  0x61, 0xc1, 0x41, 0x29, 0x02, 0x04, 0x28, 0xb9, 0x05, 0x1c, 0x42, 0x30, 
+  0x81, 0xc1, 0xfe, 0x08, 0xaf, 0xff, 0x06, 0x1c, 0x82, 0x30, 0x6c, 0x01, 
+  0x04, 0x4e, 0x01, 0x06, 0x4c, 0x01, 0x1b, 0xe0, 0x4c, 0x01, 0x2c, 0xd2, 
+  0x08, 0x4c, 0x01, 0x40, 0x13, 0xea, 0xcb, 0x44, 0x28, 0x00, 0xf3, 0x0e, 
+  0xc0, 0x81, 0x98, 0x4c, 0x60, 0x91, 0xd0, 0x7a, 0x19, 0x0b, 0xa0, 0x00, 
+  0xad, 0x70, 0x6b, 0x80, 0x4a, 0x80, 0xc4, 0xb4, 0x61, 0xa4, 0xa2, 0x08, 
+  0xaf, 0xff, 0x40, 0xa4, 0x02, 0x46, 0x01, 0x0a, 0x44, 0x01, 0x02, 0x5c, 
+  0x00, 0x0f, 0x44, 0x01, 0x03, 0x24, 0x6a, 0x08, 0x44, 0x01, 0x08, 0xf8, 
+  0x01, 0x2f, 0x52, 0x08, 0xf8, 0x01, 0x09, 0x2a, 0x04, 0x17, 0xac, 0x00, 
+  0x1d, 0x26, 0xac, 0x00, 0x0c, 0xf8, 0x01, 0x2e, 0x04, 0x17, 0xf8, 0x01, 
+  0x3f, 0xee, 0x0f, 0x6f, 0xf8, 0x01, 0x08, 0x02, 0x64, 0x00, 0x0f, 0xb4, 
+  0x00, 0x03, 0x39, 0xb6, 0x0f, 0x4f, 0xb4, 0x00, 0x0e, 0x6c, 0x01, 0x3f, 
+  0x92, 0x0f, 0x6f, 0x6c, 0x01, 0x08, 0x1b, 0xf8, 0x6c, 0x01, 0x3f, 0x66, 
+  0x0f, 0x4f, 0x6c, 0x01, 0x02, 0x1f, 0xf8, 0x6c, 0x01, 0x04, 0x3f, 0x36, 
+  0x0f, 0x6f, 0x6c, 0x01, 0x06, 0x02, 0x5c, 0x00, 0x0f, 0xb8, 0x00, 0x03, 
+  0x24, 0xfe, 0x0e, 0xb8, 0x00, 0x02, 0x7c, 0x03, 0x3b, 0xee, 0x0e, 0x6f, 
+  0x7c, 0x03, 0x02, 0x18, 0x00, 0x1f, 0xd6, 0x18, 0x00, 0x04, 0x1d, 0xbe, 
+  0x18, 0x00, 0x06, 0xe4, 0x03, 0x31, 0xa2, 0x0e, 0x6f, 0xe4, 0x03, 0x20, 
+  0x52, 0x0d, 0xec, 0x03, 0x04, 0xe4, 0x03, 0xf8, 0x05, 0x6a, 0x24, 0x80, 
+  0x12, 0x51, 0x24, 0x80, 0x93, 0xe0, 0x20, 0x82, 0x0f, 0x13, 0x00, 0xfc, 
+  0x5d, 0x1f, 0xdc, 0x3e, 0x79, 0x14, 0x00, 0x5d, 0x12, 0x00, 0xc0, 0x4b, 
+  0x21, 0x14, 0x00, 0x3d, 0x80, 0x4b, 0x20, 0x14, 0x00, 0xf1, 0x06, 0x40, 
+  0x4c, 0x23, 0xdc, 0x3e, 0x79, 0x9b, 0xc9, 0x00, 0x00, 0x0e, 0x31, 0x00, 
+  0x00, 0x4c, 0x09, 0x05, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x82, 0x02, 
+  0x00, 0x4e, 0x05, 0x00, 0xaa, 0xaa, 0x0a, 0x0e, 0x00, 0x07, 0x01, 0x00, 
+  0xf0, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x54, 0x00, 0x04, 0x00, 0x10, 0x00, 
+  0x40, 0x02, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x03, 
+  0x40, 0x08, 0x3f, 0x00, 0x04, 0x00, 0x01, 0x03, 0x3f, 0x00, 0x82, 0x05, 
+  0x00, 0x56, 0x00, 0x00, 0x27, 0x00, 0xcb, 0x28, 0x00, 0x45, 0x18, 0x00, 
+  0x40, 0x03, 0x28, 0x00, 0x93, 0x17, 0x7a, 0x08, 0x41, 0x00, 0x0a, 0x00, 
+  0x00, 0x18, 0x08, 0x00, 0x10, 0xfe, 0x08, 0x00, 0x82, 0x07, 0x00, 0x8d, 
+  0x00, 0x00, 0x39, 0x00, 0xf9, 0x30, 0x00, 0x45, 0x28, 0x00, 0x40, 0x04, 
+  0x30, 0x00, 0xf0, 0x02, 0x0d, 0xfa, 0x10, 0x44, 0x00, 0x05, 0x00, 0x00, 
+  0xfa, 0xfa, 0x00, 0x44, 0x00, 0x44, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x31, 
+  0x0e, 0x00, 0x01, 0x08, 0x00, 0xf2, 0x01, 0x11, 0x00, 0x00, 0x0d, 0xa0, 
+  0x08, 0x42, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x23, 0x00, 0x57, 0x40, 
+  0x00, 0x19, 0x30, 0x98, 0x00, 0x57, 0x80, 0x28, 0x3f, 0x00, 0x02, 0xbe, 
+  0x00, 0x39, 0x80, 0x00, 0x3f, 0xce, 0x00, 0x02, 0x10, 0x00, 0x02, 0xb8, 
+  0x00, 0x82, 0x06, 0x00, 0xbf, 0x00, 0x00, 0x25, 0x00, 0x87, 0x48, 0x00, 
+  0x72, 0x98, 0x00, 0x40, 0x0f, 0x00, 0x6f, 0x03, 0x48, 0x00, 0x10, 0x01, 
+  0x20, 0x00, 0x00, 0xfa, 0x00, 0x03, 0x08, 0x00, 0x12, 0x02, 0x08, 0x00, 
+  0x23, 0x01, 0x06, 0x10, 0x00, 0x01, 0x08, 0x00, 0x43, 0x02, 0x00, 0x01, 
+  0x07, 0x10, 0x00, 0x01, 0x08, 0x00, 0x43, 0x02, 0x00, 0x01, 0x09, 0x10, 
+  0x00, 0x01, 0x08, 0x00, 0x42, 0x02, 0x00, 0x12, 0x2a, 0x10, 0x00, 0x41, 
+  0x40, 0xfe, 0x80, 0x18, 0x08, 0x00, 0x43, 0x40, 0x00, 0x40, 0x10, 0x73, 
+  0x01, 0xf0, 0x11, 0x80, 0x80, 0x08, 0x00, 0xff, 0xfe, 0x7f, 0x18, 0x7f, 
+  0xff, 0x02, 0x00, 0xff, 0x00, 0x7f, 0x00, 0x7f, 0xff, 0x4f, 0xff, 0xff, 
+  0x7f, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x01, 0x40, 0xfe, 0x40, 0x88, 0x7d, 
+  0x00, 0x42, 0x40, 0x40, 0x80, 0x40, 0x2c, 0x00, 0x20, 0x80, 0x80, 0x08, 
+  0x00, 0x31, 0x40, 0x40, 0x40, 0x10, 0x00, 0x06, 0x08, 0x00, 0x14, 0x00, 
+  0x20, 0x00, 0x0a, 0xe6, 0x00, 0x2f, 0x80, 0x40, 0x30, 0x00, 0x04, 0x0f, 
+  0x08, 0x00, 0x53, 0x71, 0x00, 0x40, 0x00, 0x40, 0x80, 0x80, 0x00, 0x84, 
+  0x00, 0x04, 0xbc, 0x00, 0x0f, 0x08, 0x00, 0x05, 0x15, 0x00, 0x07, 0x00, 
+  0x05, 0xc4, 0x00, 0x0f, 0x38, 0x00, 0x12, 0x0f, 0x08, 0x00, 0x4d, 0xf4, 
+  0x0c, 0x00, 0x00, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x88, 0x00, 0x00, 0x04, 
+  0x00, 0x12, 0x00, 0x20, 0x00, 0x3c, 0xac, 0x00, 0xac, 0x12, 0x20, 0x20, 
+  0x12, 0x3c, 0xac, 0x3c, 0xa8, 0x00, 0xf4, 0x11, 0xcc, 0xcd, 0xcc, 0xcc, 
+  0xcd, 0x3d, 0xcc, 0x3d, 0xcc, 0x00, 0xcc, 0x00, 0xcd, 0x00, 0x00, 0x3d, 
+  0x00, 0x58, 0x00, 0x8b, 0x00, 0x3a, 0xa0, 0x00, 0xa0, 0x58, 0x8b, 0x8b, 
+  0x58, 0x3a, 0xa0, 0x3a, 0x30, 0x00, 0x8c, 0xac, 0x58, 0x20, 0x8b, 0x12, 
+  0x3a, 0xa0, 0x3c, 0x18, 0x00, 0x05, 0x40, 0x00, 0x04, 0x08, 0x00, 0xfd, 
+  0x00, 0x58, 0xcc, 0x8b, 0xcd, 0x3a, 0xa0, 0x3d, 0xa0, 0x00, 0x8b, 0x00, 
+  0x58, 0x00, 0x00, 0x3a, 0x8c, 0x03, 0x0b, 0x01, 0x00, 0xf4, 0x01, 0xe8, 
+  0x0a, 0x1c, 0x1c, 0x0a, 0x41, 0xe8, 0x41, 0xe8, 0x12, 0x1c, 0x20, 0x0a, 
+  0x3c, 0xac, 0x41, 0x58, 0x00, 0x21, 0x01, 0x01, 0xad, 0x02, 0x00, 0x89, 
+  0x02, 0x01, 0x04, 0x00, 0x0f, 0x01, 0x00, 0xae, 0x20, 0x01, 0xfe, 0x34, 
+  0x03, 0x30, 0x0a, 0x00, 0x41, 0xd0, 0x00, 0x10, 0x95, 0x21, 0x04, 0x61, 
+  0x00, 0xb0, 0x03, 0x00, 0x00, 0x30, 0x6a, 0x02, 0x50, 0x00, 0x00, 0x48, 
+  0x00, 0x00, 0x13, 0x04, 0xf3, 0x0b, 0x00, 0x60, 0x53, 0x14, 0x00, 0xa8, 
+  0x52, 0x14, 0x00, 0xd8, 0x52, 0x14, 0x00, 0x18, 0x53, 0x14, 0x00, 0x80, 
+  0x52, 0x14, 0x00, 0xf1, 0xc0, 0x0e, 0x08, 0x00, 0xe8, 0x07, 0xf0, 0x26, 
+  0xe4, 0xc2, 0xad, 0x70, 0x0a, 0x26, 0x80, 0x1f, 0xa1, 0x00, 0x8c, 0x20, 
+  0x00, 0x86, 0x21, 0x86, 0x02, 0x79, 0x0d, 0x09, 0x72, 0x01, 0x22, 0xb9, 
+  0x62, 0x0d, 0x0f, 0xff, 0xa5, 0x71, 0xf1, 0x0d, 0x34, 0x94, 0x08, 0xe6, 
+  0xc4, 0xc6, 0x00, 0x00, 0x49, 0x4e, 0x49, 0x03, 0x54, 0x3b, 0x11, 0x00, 
+  0x08, 0x1e, 0xa1, 0x00, 0x61, 0x41, 0x01, 0xf0, 0x14, 0xf2, 0x3d, 0x00, 
+  0x04, 0x01, 0xc8, 0x42, 0x04, 0x07, 0x0f, 0x05, 0x0f, 0x10, 0x0f, 0x10, 
+  0x02, 0x10, 0x01, 0x02, 0x04, 0x0f, 0x03, 0x0f, 0x10, 0x07, 0x10, 0x05, 
+  0x00, 0x08, 0x20, 0xaa, 0x00, 0x01, 0x04, 0x02, 0x07, 0x05, 0xf0, 0x0c, 
+  0x01, 0x01, 0x01, 0x00, 0x90, 0x02, 0x1b, 0xee, 0x06, 0x00, 0x79, 0xf2, 
+  0x05, 0x80, 0x80, 0x16, 0xf1, 0x02, 0x02, 0x02, 0x0d, 0x00, 0xff, 0x03, 
+  0x05, 0x0f, 0x04, 0x37, 0x00, 0xf1, 0x44, 0x00, 0x88, 0x0c, 0x80, 0x3f, 
+  0x00, 0x0e, 0x04, 0xa4, 0x70, 0x7d, 0x04, 0x14, 0xb6, 0xf3, 0x05, 0x08, 
+  0x03, 0x20, 0xee, 0x7c, 0x7f, 0x3f, 0x38, 0x20, 0x52, 0xb8, 0x7e, 0x04, 
+  0x18, 0x07, 0x20, 0x03, 0x18, 0x00, 0x24, 0xf4, 0x4a, 0x00, 0x24, 0x74, 
+  0x02, 0x04, 0xf4, 0x49, 0x01, 0x04, 0x02, 0x08, 0x49, 0x90, 0xe5, 0xf3, 
+  0x48, 0x8b, 0x71, 0x72, 0x48, 0x02, 0x18, 0x47, 0x08, 0x1c, 0x76, 0x47, 
+  0x30, 0x33, 0x90, 0x62, 0xf4, 0x46, 0x02, 0x18, 0x02, 0x04, 0xf4, 0x45, 
+  0x02, 0x08, 0x02, 0x04, 0xf4, 0x44, 0x06, 0x00, 0xf0, 0x64, 0x43, 0x15, 
+  0x51, 0x02, 0x08, 0x43, 0x03, 0xb4, 0x05, 0x02, 0x94, 0xa0, 0x2e, 0x14, 
+  0x02, 0xd8, 0x00, 0x00, 0xd0, 0x06, 0x08, 0xb8, 0x06, 0x08, 0xe8, 0x25, 
+  0xe2, 0x02, 0x08, 0x06, 0x02, 0x20, 0x00, 0x2f, 0x05, 0x20, 0x20, 0x30, 
+  0x14, 0x12, 0x06, 0x00, 0x00, 0x38, 0x02, 0x08, 0x03, 0x17, 0x0f, 0x04, 
+  0x31, 0x11, 0x0f, 0x10, 0x00, 0x00, 0x07, 0x04, 0x13, 0x04, 0x64, 0xb9, 
+  0x13, 0x04, 0x64, 0x10, 0x3f, 0x14, 0x08, 0x14, 0x60, 0xb1, 0x13, 0xc4, 
+  0x99, 0x00, 0x0a, 0x02, 0x0e, 0x60, 0xbb, 0x13, 0x02, 0x06, 0x09, 0x03, 
+  0x03, 0x30, 0xd8, 0x3c, 0x05, 0x28, 0x03, 0x16, 0xbe, 0x08, 0x03, 0x06, 
+  0xcd, 0xcc, 0x03, 0x04, 0xbd, 0x14, 0x6c, 0x03, 0x0a, 0xbc, 0x09, 0x03, 
+  0x06, 0x03, 0x04, 0xbb, 0x11, 0x06, 0x00, 0x20, 0xba, 0x0b, 0x06, 0x00, 
+  0x40, 0xcc, 0x32, 0xb9, 0x12, 0x08, 0x00, 0x20, 0xb8, 0x1a, 0x06, 0x00, 
+  0xd0, 0xb7, 0x08, 0x51, 0xb6, 0x1b, 0x03, 0x10, 0x03, 0x04, 0xb5, 0x24, 
+  0x33, 0x33, 0x11, 0x00, 0x20, 0xb4, 0x27, 0x06, 0x00, 0x20, 0xb3, 0x2d, 
+  0x06, 0x00, 0x60, 0xb2, 0x21, 0x03, 0x06, 0x13, 0xf4, 0x50, 0x03, 0x71, 
+  0x68, 0x33, 0x05, 0xfc, 0xe0, 0x3d, 0x14, 0xc9, 0x01, 0x30, 0x48, 0xbc, 
+  0x13, 0xe3, 0x01, 0x60, 0x8c, 0x20, 0xa1, 0x00, 0xea, 0x1c, 0xd9, 0x01, 
+  0xf0, 0x19, 0xda, 0xac, 0x65, 0xa1, 0x00, 0x0f, 0x04, 0x0b, 0x10, 0x70, 
+  0x02, 0x20, 0x74, 0x06, 0x04, 0x7c, 0x02, 0x08, 0x03, 0x04, 0x80, 0x02, 
+  0x08, 0x0b, 0x04, 0x6e, 0x0f, 0x84, 0x02, 0x10, 0x0f, 0x04, 0x03, 0x10, 
+  0x8c, 0x02, 0x18, 0x03, 0x04, 0xa4, 0x18, 0x00, 0xb0, 0x0b, 0x58, 0x07, 
+  0x0c, 0x6c, 0x64, 0x65, 0x78, 0x20, 0x00, 0x70, 0xc4, 0x06, 0xf0, 0x66, 
+  0x02, 0x04, 0x14, 0x05, 0x7a, 0x3d, 0x04, 0x01, 0x00, 0x00, 0xd6, 0xff, 
+  0x08, 0x04, 0xf9, 0x3d, 0x08, 0x02, 0x11, 0xd6, 0xff, 0x79, 0x3e, 0x10, 
+  0x03, 0x04, 0x10, 0x3e, 0x00, 0x00, 0x48, 0x41, 0x82, 0x88, 0x05, 0x02, 
+  0x24, 0x00, 0x00, 0xc8, 0x41, 0x06, 0x04, 0x08, 0x48, 0x42, 0x07, 0x04, 
+  0x08, 0xc8, 0x42, 0x08, 0x04, 0x08, 0x88, 0x08, 0x48, 0x43, 0x09, 0x04, 
+  0x08, 0xc8, 0x43, 0x0a, 0x04, 0x08, 0x48, 0x44, 0x0b, 0x02, 0x08, 0x34, 
+  0x23, 0x37, 0x20, 0xc8, 0x07, 0x21, 0x38, 0x39, 0x02, 0x0a, 0x48, 0x42, 
+  0x03, 0x44, 0x06, 0x04, 0x03, 0x0c, 0x08, 0x04, 0x02, 0x48, 0x08, 0x00, 
+  0x04, 0x13, 0x00, 0x00, 0x20, 0x06, 0x09, 0x00, 0x08, 0x28, 0x00, 0x0c, 
+  0x26, 0x00, 0x0e, 0x27, 0x00, 0x0e, 0x02, 0x32, 0x23, 0x1f, 0x06, 0xf0, 
+  0x18, 0x29, 0x01, 0x03, 0x2a, 0x01, 0x03, 0x25, 0x01, 0x04, 0x21, 0x01, 
+  0x05, 0x2b, 0x01, 0x05, 0x00, 0x00, 0x09, 0x01, 0x06, 0x04, 0x01, 0x0c, 
+  0x05, 0x02, 0x00, 0x03, 0x02, 0x04, 0x1c, 0x03, 0x00, 0x06, 0x00, 0x00, 
+  0x06, 0x02, 0x07, 0x06, 0x8f, 0x01, 0xf0, 0x2c, 0x13, 0x06, 0x06, 0x14, 
+  0x07, 0x00, 0xc8, 0x2e, 0x40, 0x00, 0x00, 0x2e, 0x80, 0x2e, 0x65, 0xb1, 
+  0x05, 0x08, 0xdb, 0x00, 0x80, 0x2e, 0xb4, 0x02, 0x80, 0x2e, 0xe3, 0x02, 
+  0x08, 0x01, 0x05, 0x10, 0x12, 0x02, 0x50, 0x30, 0x21, 0x2e, 0x59, 0xf5, 
+  0x10, 0x02, 0x06, 0x6a, 0xf5, 0x80, 0x2e, 0x02, 0x00, 0xd7, 0x02, 0x62, 
+  0x00, 0x00, 0x01, 0x4d, 0x01, 0x00, 0x22, 0x19, 0x05, 0xd2, 0x10, 0x00, 
+  0x10, 0x00, 0xff, 0x79, 0x00, 0xa9, 0xf7, 0x80, 0x2e, 0x00, 0xc1, 0x58, 
+  0x02, 0x07, 0x02, 0x00, 0x12, 0x03, 0x08, 0x00, 0xf0, 0x19, 0x07, 0x10, 
+  0xfd, 0x2d, 0xd8, 0xb9, 0x04, 0xd5, 0x06, 0x05, 0x33, 0x01, 0x01, 0x00, 
+  0x03, 0x00, 0x94, 0xfd, 0x18, 0x01, 0x06, 0x0f, 0x00, 0x02, 0x09, 0x01, 
+  0x04, 0x07, 0x0d, 0x06, 0x08, 0x12, 0x02, 0x24, 0x02, 0x18, 0x06, 0x0e, 
+  0x0f, 0x07, 0x2c, 0x00, 0x22, 0x4f, 0x00, 0x34, 0x00, 0xf0, 0x60, 0x0b, 
+  0x10, 0x1a, 0x24, 0x12, 0x78, 0x2e, 0x00, 0xb0, 0x20, 0x50, 0xe7, 0x7f, 
+  0xf6, 0x7f, 0x00, 0x00, 0x06, 0x32, 0x0f, 0x2e, 0x61, 0xf5, 0xfe, 0x09, 
+  0xc0, 0xb3, 0x04, 0x2f, 0x17, 0x30, 0x2f, 0x2e, 0x08, 0x00, 0xa1, 0x00, 
+  0x2d, 0x02, 0x10, 0xf6, 0x6f, 0xe7, 0x6f, 0xe0, 0x5f, 0xc8, 0x2e, 0x0f, 
+  0x80, 0x0a, 0x82, 0x00, 0x00, 0x02, 0x30, 0x12, 0x42, 0x41, 0x0e, 0xfc, 
+  0x2f, 0xb8, 0x2e, 0xd1, 0x52, 0x00, 0x2e, 0x60, 0x40, 0x00, 0x90, 0x41, 
+  0x40, 0x0d, 0xbc, 0x98, 0xbc, 0xc0, 0x2e, 0x01, 0x0a, 0x0f, 0xb8, 0x13, 
+  0x02, 0xfd, 0x2d, 0x0b, 0x5e, 0xc1, 0x00, 0x03, 0x0c, 0x01, 0x4d, 0x00, 
+  0x00, 0x88, 0x03, 0x09, 0x02, 0x04, 0x05, 0xe0, 0xaa, 0x38, 0x05, 0xe0, 
+  0x90, 0x30, 0x07, 0x02, 0x24, 0xee, 0x06, 0x27, 0x03, 0xf3, 0xff, 0x41, 
+  0x2d, 0x01, 0xd4, 0x7b, 0x00, 0x00, 0x3b, 0x01, 0xdb, 0x7a, 0x04, 0x00, 
+  0x3f, 0x7b, 0xcd, 0x6c, 0xc3, 0x04, 0x85, 0x09, 0xc3, 0x04, 0x00, 0x20, 
+  0xec, 0xe6, 0x0c, 0x46, 0x01, 0x00, 0x27, 0x00, 0x19, 0x00, 0x96, 0x00, 
+  0xa0, 0x12, 0x32, 0x0c, 0x00, 0x68, 0x00, 0xf0, 0x3c, 0x00, 0x12, 0x24, 
+  0x03, 0x02, 0x0c, 0x23, 0x94, 0x32, 0x00, 0x40, 0x06, 0xbc, 0x02, 0x84, 
+  0x07, 0x00, 0x00, 0x70, 0xfc, 0x3f, 0xfc, 0x12, 0xf9, 0x51, 0x78, 0x71, 
+  0x7d, 0x10, 0x00, 0x14, 0x02, 0x1c, 0x02, 0x63, 0x0f, 0x03, 0x00, 0x00, 
+  0x00, 0x9d, 0x00, 0x00, 0x0c, 0xff, 0x0f, 0x00, 0x04, 0xc0, 0x00, 0x5b, 
+  0xf5, 0x98, 0xf1, 0xd4, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x1e, 0xf2, 0x19, 
+  0xf4, 0x66, 0xf5, 0xff, 0x00, 0x64, 0xf5, 0xa2, 0x00, 0xe0, 0x00, 0x00, 
+  0x00, 0xa5, 0x00, 0xff, 0x7f, 0xb4, 0x16, 0x4d, 0xe9, 0xb5, 0x44, 0x69, 
+  0xed, 0xcf, 0x00, 0x8a, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x8c, 0x00, 0x8e, 
+  0x00, 0xff, 0x3f, 0xff, 0xfb, 0x31, 0x01, 0x00, 0x38, 0x00, 0x30, 0x20, 
+  0x00, 0xfd, 0xf5, 0xd7, 0x00, 0x80, 0x02, 0x86, 0x5f, 0xff, 0x00, 0x40, 
+  0x4d, 0x0f, 0xeb, 0x00, 0x7f, 0xff, 0x00, 0x00, 0xc2, 0xf5, 0x68, 0xf7, 
+  0x47, 0x0f, 0x3b, 0x0f, 0x41, 0x0f, 0x60, 0x0f, 0x58, 0xf7, 0x5b, 0xf7, 
+  0x00, 0x00, 0x63, 0x0f, 0x00, 0x80, 0x86, 0x00, 0x52, 0x0f, 0x65, 0x0f, 
+  0xb3, 0xf1, 0x5f, 0x0f, 0x6c, 0xf7, 0x10, 0x00, 0xb9, 0xf1, 0xc6, 0xf1, 
+  0x02, 0x59, 0xff, 0xd1, 0xf5, 0x67, 0x0f, 0x6a, 0x0f, 0xff, 0x03, 0x00, 
+  0xfc, 0x00, 0x00, 0xf0, 0x3f, 0x0b, 0x01, 0x0e, 0x01, 0x10, 0x01, 0xb9, 
+  0x00, 0x2d, 0xf5, 0xca, 0xf5, 0xd5, 0x00, 0x00, 0x00, 0x20, 0xf2, 0xb8, 
+  0x01, 0xff, 0x1f, 0x80, 0x2e, 0xc0, 0x08, 0x1d, 0x6c, 0xad, 0x00, 0x59, 
+  0x01, 0x00, 0x00, 0x31, 0xd1, 0x00, 0x08, 0xee, 0x7a, 0xe4, 0x0c, 0x12, 
+  0x02, 0xb3, 0x00, 0xb4, 0x04, 0x62, 0x03, 0x00, 0x00, 0xc0, 0x02, 0x1f, 
+  0xf8, 0xe1, 0x07, 0xd3, 0x07, 0xdd, 0x01, 0xd9, 0x01, 0xbf, 0x01, 0xc9, 
+  0x01, 0x00, 0x00, 0xcb, 0x01, 0xc3, 0x01, 0xc2, 0x01, 0xc5, 0x01, 0xe3, 
+  0x01, 0xa0, 0x00, 0xc8, 0x01, 0xdc, 0x01, 0x00, 0xf0, 0xf0, 0x00, 0x4c, 
+  0xf7, 0x03, 0x02, 0x12, 0x02, 0x00, 0x02, 0x6f, 0xf7, 0x0f, 0xf1, 0x06, 
+  0x02, 0xf6, 0xff, 0xff, 0xaa, 0x00, 0x0f, 0x10, 0x05, 0x10, 0x25, 0x10, 
+  0x46, 0x30, 0x0f, 0x2e, 0xa4, 0xf1, 0xbe, 0x09, 0x80, 0xb3, 0x06, 0x2f, 
+  0x0d, 0x00, 0x40, 0x2e, 0x92, 0x00, 0x84, 0xaf, 0x02, 0x2f, 0x16, 0x30, 
+  0x2d, 0x2e, 0x85, 0x00, 0x86, 0x02, 0x06, 0x60, 0x06, 0x0e, 0xf5, 0x27, 
+  0x1a, 0x35, 0xd2, 0xc0, 0x2e, 0x21, 0x2e, 0x4a, 0xf1, 0x05, 0x40, 0x0f, 
+  0x06, 0x0d, 0x10, 0x90, 0x50, 0xf7, 0x7f, 0x00, 0x00, 0xe6, 0x7f, 0xd5, 
+  0x7f, 0xc4, 0x7f, 0xb3, 0x7f, 0xa1, 0x7f, 0x90, 0x7f, 0x82, 0x7f, 0x7b, 
+  0x7f, 0x00, 0x00, 0x98, 0x2e, 0xf4, 0x00, 0x00, 0xb2, 0x6e, 0x2f, 0x01, 
+  0x2e, 0x11, 0x01, 0x07, 0x2e, 0x0f, 0x01, 0x00, 0x00, 0x05, 0x2e, 0x31, 
+  0x01, 0x0f, 0xba, 0xbf, 0xb9, 0xa3, 0xbc, 0xdc, 0x0a, 0x1f, 0xba, 0x24, 
+  0xbc, 0x00, 0x00, 0x1c, 0x0b, 0x0f, 0xb8, 0x22, 0xbd, 0x03, 0x2e, 0x3c, 
+  0x01, 0x2f, 0xb9, 0x20, 0x0a, 0x9e, 0xbc, 0x00, 0x00, 0x07, 0x2e, 0x12, 
+  0x01, 0x82, 0x0a, 0x9f, 0xb8, 0xbb, 0xbd, 0x91, 0x0a, 0x3f, 0xb8, 0x90, 
+  0x0a, 0x00, 0x08, 0x25, 0x2e, 0x18, 0x00, 0x05, 0x2e, 0xc1, 0xf5, 0x2e, 
+  0xbc, 0x05, 0x03, 0xaa, 0xa2, 0x0e, 0xb8, 0x31, 0x10, 0x14, 0x30, 0x88, 
+  0x04, 0x07, 0x02, 0x50, 0x18, 0x00, 0x00, 0x90, 0x03, 0x02, 0x08, 0x83, 
+  0x02, 0x60, 0x19, 0x2f, 0xa5, 0x00, 0x40, 0x50, 0x91, 0x52, 0x98, 0x2e, 
+  0x3d, 0x03, 0x05, 0x2e, 0x82, 0x00, 0x25, 0x2e, 0xa0, 0x02, 0x34, 0x82, 
+  0x00, 0x89, 0x00, 0x80, 0x90, 0x02, 0x2f, 0x12, 0x30, 0x25, 0x02, 0x12, 
+  0x01, 0x2e, 0x03, 0x26, 0x10, 0x30, 0x05, 0x02, 0x4e, 0x68, 0x04, 0x01, 
+  0x2f, 0x21, 0x02, 0x06, 0x25, 0x02, 0x12, 0x03, 0x0e, 0x80, 0xb2, 0x20, 
+  0x02, 0x44, 0xc0, 0xf5, 0xf2, 0x30, 0x02, 0x00, 0x00, 0x08, 0x07, 0xaa, 
+  0x73, 0x30, 0x03, 0x2e, 0x84, 0x00, 0x18, 0x22, 0x41, 0x1a, 0x05, 0x2f, 
+  0x03, 0x00, 0x00, 0x2e, 0x66, 0xf5, 0x9f, 0xbc, 0x9f, 0xb8, 0x40, 0x90, 
+  0x0c, 0x2f, 0xa7, 0x52, 0x03, 0x30, 0x53, 0x00, 0x01, 0x42, 0x2b, 0x30, 
+  0x90, 0x04, 0x5b, 0x42, 0x21, 0x02, 0x22, 0x24, 0xbd, 0x7e, 0x80, 0x81, 
+  0x84, 0x43, 0x00, 0x00, 0x42, 0x02, 0x42, 0x02, 0x32, 0x25, 0x2e, 0x62, 
+  0xf5, 0x05, 0x2e, 0x94, 0x00, 0x81, 0x82, 0x05, 0x10, 0x00, 0x2e, 0x0a, 
+  0x01, 0x23, 0x02, 0x0a, 0x97, 0x50, 0x90, 0x08, 0x01, 0x31, 0x23, 0x2e, 
+  0x60, 0xf5, 0x80, 0x00, 0x50, 0xb2, 0x0b, 0x2f, 0xf2, 0x3e, 0x01, 0x2e, 
+  0xca, 0xf5, 0x82, 0x08, 0x25, 0x02, 0x06, 0x05, 0x52, 0x24, 0xe0, 0x04, 
+  0x00, 0x3f, 0x90, 0x02, 0x0c, 0x59, 0xf5, 0x90, 0x6f, 0xb3, 0x6f, 0xc4, 
+  0x6f, 0xd5, 0x6f, 0xe6, 0x6f, 0xf7, 0x00, 0x41, 0x6f, 0x7b, 0x6f, 0x82, 
+  0x6f, 0xa1, 0x6f, 0x70, 0x32, 0x8e, 0xa0, 0x50, 0x80, 0x7f, 0xe7, 0x16, 
+  0x44, 0xa2, 0x04, 0x05, 0x7f, 0x91, 0x32, 0xbe, 0x7b, 0x7f, 0x00, 0x2e, 
+  0x01, 0x02, 0x4c, 0x60, 0x14, 0x4c, 0x62, 0x6f, 0x01, 0x32, 0x91, 0x00, 
+  0x02, 0x08, 0x80, 0xb2, 0x0d, 0x2f, 0x00, 0xb2, 0x03, 0x2f, 0x04, 0xc2, 
+  0x90, 0x05, 0x2f, 0xab, 0x56, 0x02, 0x00, 0x82, 0x30, 0xc1, 0x42, 0xc2, 
+  0x86, 0x00, 0x2e, 0xc2, 0x42, 0x03, 0x78, 0x00, 0x90, 0x00, 0x30, 0x06, 
+  0x02, 0xe8, 0x00, 0x00, 0x82, 0x00, 0xa9, 0x50, 0x21, 0x2e, 0x5a, 0xf2, 
+  0x98, 0x2e, 0xff, 0xb3, 0xf6, 0x6f, 0x80, 0x6f, 0xa8, 0x01, 0x91, 0x6f, 
+  0xa2, 0x06, 0x76, 0xe7, 0x02, 0x74, 0x60, 0x02, 0x70, 0x13, 0x7a, 0x20, 
+  0x30, 0x13, 0x30, 0xc2, 0x33, 0x08, 0x00, 0x10, 0x08, 0x8b, 0x09, 0x8a, 
+  0x08, 0x30, 0x50, 0xa2, 0xb8, 0x00, 0xb2, 0xf1, 0x12, 0xc8, 0xdb, 0x7f, 
+  0x31, 0x01, 0x01, 0x12, 0x04, 0x89, 0x00, 0x41, 0x90, 0x07, 0x2f, 0x00, 
+  0x52, 0xd8, 0x89, 0x00, 0x03, 0x2e, 0x88, 0x00, 0xb1, 0x80, 0x81, 0x50, 
+  0x98, 0x2e, 0xd6, 0x03, 0x80, 0xb3, 0x13, 0x20, 0x32, 0x84, 0x30, 0x41, 
+  0x04, 0x23, 0x2e, 0x9d, 0x12, 0x6e, 0x20, 0x80, 0x88, 0x00, 0x91, 0x56, 
+  0xb1, 0x12, 0x82, 0xe0, 0xb1, 0x10, 0x25, 0xe0, 0x6f, 0x00, 0xb2, 0x05, 
+  0x12, 0x56, 0x80, 0x08, 0x9d, 0x00, 0x02, 0x30, 0x10, 0x04, 0x21, 0x02, 
+  0x20, 0x40, 0xb2, 0x06, 0x02, 0x10, 0xd2, 0x00, 0x82, 0x3f, 0x00, 0x00, 
+  0x02, 0x08, 0x01, 0x0a, 0x21, 0x2e, 0xd2, 0x00, 0xdb, 0x6f, 0xf0, 0x6f, 
+  0xd0, 0x5f, 0x80, 0x2e, 0x80, 0x42, 0x95, 0xcf, 0xf0, 0x6f, 0x01, 0x30, 
+  0x98, 0x02, 0x08, 0x03, 0x02, 0x16, 0x80, 0x3f, 0x48, 0x08, 0x63, 0x44, 
+  0x89, 0x14, 0x00, 0x00, 0x23, 0x02, 0x0e, 0xdb, 0x02, 0x22, 0xb8, 0x2e, 
+  0x43, 0x86, 0x25, 0x40, 0x04, 0x40, 0xd8, 0xbe, 0x2c, 0x00, 0x3c, 0x0b, 
+  0x22, 0x11, 0x54, 0x42, 0x03, 0x80, 0x4b, 0x0e, 0xf6, 0x42, 0xa8, 0x43, 
+  0x96, 0x0b, 0x04, 0x5b, 0x68, 0x9a, 0x01, 0xfe, 0x01, 0x34, 0x72, 0x5a, 
+  0x2d, 0x9c, 0x0f, 0x0e, 0xd0, 0x04, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x26, 0x00, 0x00, 0x60, 0x50, 0xd1, 0x7f, 0xf3, 0x00, 0x00, 0x7f, 0xe2, 
+  0x7f, 0xc0, 0x7f, 0xbb, 0x7f, 0x13, 0x25, 0x98, 0x2e, 0x74, 0xc0, 0xc1, 
+  0x6f, 0x00, 0x00, 0x90, 0xa0, 0xb3, 0x54, 0x10, 0x22, 0xe3, 0x6f, 0x42, 
+  0x40, 0xc3, 0x88, 0xa0, 0x32, 0x18, 0x02, 0x0f, 0x22, 0xb2, 0x00, 0x00, 
+  0x30, 0xc0, 0x6f, 0x2a, 0x2c, 0x01, 0x42, 0x40, 0x42, 0xc4, 0x80, 0xd1, 
+  0x6f, 0x48, 0x84, 0xc1, 0x20, 0x00, 0x40, 0x83, 0x40, 0x03, 0x42, 0x03, 
+  0x30, 0xa1, 0x6f, 0xc1, 0x0f, 0x02, 0x2f, 0xe0, 0x6f, 0xf1, 0x6f, 0x20, 
+  0x00, 0x01, 0x42, 0x00, 0x2e, 0xc1, 0x12, 0x22, 0x00, 0xac, 0x43, 0x40, 
+  0xe2, 0x6f, 0x10, 0x30, 0x01, 0x30, 0x00, 0x00, 0x08, 0x2f, 0xc2, 0x90, 
+  0x82, 0x84, 0x01, 0x22, 0x81, 0x40, 0x08, 0x00, 0x90, 0x42, 0x20, 0x30, 
+  0x00, 0x50, 0x09, 0x2c, 0x80, 0x42, 0x81, 0x84, 0x82, 0x88, 0xc1, 0x90, 
+  0x00, 0x43, 0x05, 0x16, 0x80, 0x02, 0x34, 0xbb, 0x00, 0x00, 0x6f, 0xa0, 
+  0x5f, 0xb8, 0x2e, 0x07, 0x8a, 0x43, 0x81, 0x7a, 0x85, 0x03, 0x30, 0x14, 
+  0x30, 0x43, 0x00, 0x00, 0x43, 0x43, 0x8b, 0x93, 0x42, 0x43, 0x43, 0x7e, 
+  0x8b, 0x68, 0x0e, 0x93, 0x42, 0xf7, 0x2f, 0x86, 0x04, 0x00, 0x80, 0x52, 
+  0x52, 0xdc, 0x12, 0x42, 0x01, 0x42, 0x32, 0x80, 0x00, 0x2e, 0x04, 0x42, 
+  0x80, 0x2e, 0xed, 0x01, 0x00, 0x12, 0xd6, 0x91, 0x00, 0x16, 0xb8, 0x02, 
+  0x34, 0x4a, 0x0c, 0x21, 0x2e, 0x2d, 0xf5, 0xc0, 0x2e, 0x23, 0x8c, 0x00, 
+  0x2e, 0x91, 0x72, 0xde, 0x7d, 0xaa, 0xfd, 0x2d, 0x30, 0x12, 0xf8, 0xbd, 
+  0x0e, 0x50, 0x32, 0x98, 0x2e, 0xfa, 0x01, 0x80, 0x08, 0x00, 0x30, 0xf0, 
+  0x7f, 0x10, 0x30, 0x00, 0x82, 0x12, 0xd0, 0x2e, 0x02, 0x02, 0x9c, 0x00, 
+  0x2e, 0x41, 0x82, 0x08, 0x08, 0x48, 0xa2, 0xfb, 0x22, 0x2e, 0xa0, 0x00, 
+  0x40, 0x90, 0x04, 0x2f, 0x25, 0x12, 0xbc, 0x21, 0x2e, 0x19, 0x00, 0x8c, 
+  0x80, 0x19, 0x2d, 0x33, 0x12, 0x33, 0x98, 0xc7, 0xc1, 0x05, 0x32, 0x74, 
+  0xf0, 0x7f, 0x80, 0xb2, 0x0e, 0x2f, 0x91, 0x02, 0x4a, 0x04, 0x00, 0x4d, 
+  0xc3, 0x03, 0x06, 0x5a, 0xc7, 0x98, 0x2e, 0x49, 0xb4, 0x98, 0x2e, 0xec, 
+  0x02, 0x98, 0x2e, 0xfd, 0x22, 0x40, 0xb2, 0x13, 0xf8, 0x19, 0x00, 0x01, 
+  0x62, 0x9e, 0x00, 0xb2, 0x04, 0x2f, 0x98, 0x2e, 0xe2, 0xb3, 0x23, 0x76, 
+  0xa1, 0x41, 0x20, 0x02, 0x12, 0x92, 0x00, 0x04, 0xae, 0x0b, 0x22, 0x40, 
+  0xa0, 0x00, 0x00, 0xb2, 0x07, 0x2f, 0x03, 0x50, 0x74, 0x0e, 0x50, 0x01, 
+  0x00, 0xb2, 0x02, 0x2f, 0x03, 0x32, 0x87, 0x02, 0x20, 0x87, 0x42, 0x0a, 
+  0x90, 0x2e, 0x1b, 0xb1, 0x01, 0x2e, 0x95, 0x53, 0x55, 0x02, 0x22, 0x03, 
+  0x3c, 0x15, 0x0e, 0x03, 0x3c, 0x85, 0x02, 0x1c, 0x85, 0x02, 0x12, 0x12, 
+  0x02, 0x3c, 0x92, 0x02, 0x24, 0x02, 0x02, 0x56, 0x05, 0x00, 0x2d, 0x0e, 
+  0x09, 0x2d, 0x98, 0x2e, 0x5d, 0x0d, 0x01, 0x42, 0x4e, 0x04, 0x42, 0x20, 
+  0x07, 0xd2, 0x21, 0x42, 0xfe, 0x01, 0x2e, 0x22, 0x90, 0x86, 0x02, 0x2e, 
+  0x90, 0x2e, 0x33, 0x02, 0x4a, 0x86, 0x00, 0x02, 0x31, 0x02, 0x08, 0x05, 
+  0x8a, 0x47, 0xcb, 0x03, 0x6a, 0xb0, 0x04, 0x19, 0x00, 0x82, 0x30, 0x03, 
+  0x22, 0x03, 0x16, 0x61, 0x32, 0x7a, 0x09, 0x01, 0x03, 0x44, 0x28, 0xbd, 
+  0x28, 0xb9, 0x05, 0x00, 0x00, 0xb2, 0x9b, 0x58, 0x23, 0x2f, 0x07, 0x90, 
+  0x95, 0x52, 0x00, 0x30, 0x37, 0x2f, 0x15, 0x41, 0x04, 0x00, 0x00, 0x41, 
+  0xdc, 0xbe, 0x44, 0xbe, 0xdc, 0xba, 0x2c, 0x01, 0xa2, 0x00, 0x9b, 0x56, 
+  0x51, 0x0f, 0x0c, 0x00, 0x11, 0x2f, 0xd2, 0x42, 0x24, 0xb9, 0xc2, 0x42, 
+  0x12, 0x42, 0x5e, 0x6a, 0xf7, 0x9c, 0x43, 0x54, 0xb2, 0x10, 0x22, 0x80, 
+  0x0c, 0x98, 0x2e, 0x2a, 0xb4, 0x21, 0x2d, 0x62, 0x42, 0xa0, 0x92, 0x00, 
+  0x03, 0x0c, 0x03, 0xb2, 0x5a, 0xf5, 0x18, 0x2d, 0x08, 0x00, 0xe2, 0x7f, 
+  0x50, 0x32, 0x10, 0xfa, 0x01, 0x9b, 0x54, 0x93, 0x50, 0x90, 0x42, 0x70, 
+  0x30, 0x99, 0x52, 0x00, 0xa0, 0x81, 0x42, 0xbe, 0x84, 0xe1, 0x6f, 0x40, 
+  0xb2, 0x81, 0x42, 0x05, 0x2f, 0x21, 0x02, 0xb8, 0x10, 0x02, 0x20, 0x20, 
+  0x11, 0x2a, 0xb4, 0x03, 0x2d, 0x60, 0x32, 0x96, 0x92, 0x00, 0x03, 0x86, 
+  0x06, 0x90, 0x18, 0x02, 0xe4, 0x81, 0x00, 0x97, 0x90, 0x2c, 0x54, 0x93, 
+  0x52, 0xe0, 0x42, 0x28, 0x7a, 0xc1, 0x22, 0x36, 0x1a, 0x40, 0x22, 0x36, 
+  0x03, 0x30, 0x20, 0x02, 0x30, 0x16, 0xb4, 0x15, 0x15, 0x05, 0xea, 0x05, 
+  0x02, 0xfe, 0x1e, 0x14, 0x1e, 0x92, 0x00, 0x42, 0x08, 0xd0, 0x26, 0x02, 
+  0x3e, 0x98, 0x02, 0xfc, 0x0d, 0x2f, 0x01, 0x14, 0x28, 0x90, 0x1d, 0x02, 
+  0xdc, 0x3f, 0x52, 0xac, 0x99, 0x00, 0xa1, 0x32, 0x9f, 0x58, 0x12, 0x88, 
+  0xb6, 0x03, 0x9a, 0x98, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x9d, 0x58, 0xa3, 
+  0x32, 0x10, 0x41, 0x11, 0x41, 0x18, 0xb9, 0x04, 0x41, 0x98, 0xbc, 0x00, 
+  0x82, 0x41, 0x0a, 0x94, 0x0a, 0x98, 0x2e, 0xd4, 0xb6, 0x12, 0x02, 0x86, 
+  0x99, 0x00, 0x21, 0x2e, 0xd4, 0x52, 0x78, 0x0c, 0x01, 0x98, 0x00, 0x15, 
+  0x2a, 0x03, 0x32, 0x86, 0x00, 0x18, 0x2d, 0x03, 0x9c, 0x03, 0xaa, 0x01, 
+  0x2f, 0x98, 0x2e, 0x2b, 0x02, 0x88, 0x0e, 0x03, 0x0c, 0x3f, 0x80, 0x03, 
+  0xa2, 0x01, 0x2f, 0x00, 0x2e, 0x02, 0x02, 0x86, 0x41, 0x0e, 0x30, 0x02, 
+  0x98, 0xa4, 0x08, 0x35, 0xb4, 0x03, 0x2c, 0x87, 0x00, 0x05, 0x9e, 0x01, 
+  0x22, 0x36, 0x00, 0xb2, 0x24, 0x02, 0x30, 0xf5, 0xcb, 0x05, 0x2e, 0x00, 
+  0x00, 0x93, 0x00, 0xa1, 0x52, 0x02, 0x0a, 0x7c, 0x82, 0x43, 0x86, 0x21, 
+  0x2e, 0xd3, 0x00, 0xe0, 0x40, 0x08, 0x00, 0xa3, 0x54, 0xc4, 0x22, 0xbe, 
+  0x98, 0xb9, 0x91, 0x42, 0x43, 0xbe, 0x93, 0x42, 0x04, 0x0a, 0x90, 0x42, 
+  0x00, 0x28, 0xe2, 0x7f, 0xf0, 0x31, 0x82, 0x40, 0xf1, 0x6f, 0x95, 0xbc, 
+  0x10, 0x42, 0x58, 0xd0, 0x02, 0xfa, 0xa8, 0xcf, 0x00, 0xaa, 0x06, 0xbc, 
+  0xd2, 0x6f, 0xe1, 0x6f, 0x10, 0x0a, 0x40, 0x32, 0x54, 0xc0, 0x24, 0x44, 
+  0x19, 0x02, 0x9e, 0xa0, 0x12, 0x64, 0x80, 0xa2, 0x42, 0xb7, 0x80, 0x2e, 
+  0x08, 0xb0, 0xc0, 0x94, 0x14, 0x26, 0x72, 0x04, 0x61, 0xf5, 0x2f, 0x12, 
+  0xf2, 0x0f, 0x02, 0x04, 0x04, 0x05, 0xbe, 0x09, 0x53, 0x6c, 0x80, 0x7f, 
+  0x80, 0xb3, 0xd5, 0x32, 0xa6, 0xb3, 0x62, 0xb8, 0x11, 0x2f, 0xad, 0x50, 
+  0x1a, 0x00, 0x28, 0x25, 0x12, 0x40, 0x42, 0x7f, 0x74, 0x82, 0x12, 0x40, 
+  0x52, 0x7f, 0x22, 0xee, 0x40, 0x53, 0x82, 0x6a, 0xd6, 0x40, 0x44, 0x01, 
+  0x2e, 0x61, 0xf7, 0x01, 0x31, 0x43, 0xc6, 0x61, 0xf7, 0x80, 0x12, 0xd2, 
+  0x86, 0x00, 0x08, 0x22, 0x28, 0x40, 0x01, 0x22, 0x22, 0xfe, 0x09, 0x01, 
+  0x17, 0xbc, 0x96, 0xbc, 0x0f, 0xb8, 0x63, 0x34, 0x21, 0x2e, 0x96, 0x12, 
+  0x0c, 0x01, 0x30, 0x02, 0x80, 0x2a, 0x02, 0x18, 0x92, 0x00, 0x44, 0xb2, 
+  0x05, 0x2f, 0x47, 0xb2, 0x00, 0x30, 0x2d, 0x2f, 0x21, 0x02, 0x6e, 0x80, 
+  0x44, 0x2b, 0x2d, 0x03, 0x2e, 0xfd, 0xf5, 0x9e, 0x23, 0x08, 0x90, 0x14, 
+  0x02, 0x20, 0xfc, 0xf5, 0x99, 0x04, 0x0c, 0x0e, 0x01, 0x0c, 0x02, 0x0c, 
+  0x49, 0xf1, 0xaf, 0x54, 0x4a, 0x08, 0x40, 0x90, 0x08, 0x12, 0x04, 0x73, 
+  0x3a, 0x10, 0x30, 0x03, 0x2f, 0x51, 0x04, 0xb3, 0x5c, 0x92, 0x00, 0x10, 
+  0x12, 0x34, 0x16, 0x14, 0x2e, 0x86, 0x00, 0x0a, 0x32, 0x5a, 0x69, 0xf7, 
+  0x2d, 0xbd, 0x2f, 0x50, 0x90, 0xb9, 0x80, 0xb2, 0x01, 0x02, 0x54, 0x87, 
+  0x52, 0x30, 0x86, 0x00, 0xe0, 0x31, 0x21, 0x96, 0xd8, 0x80, 0x6f, 0x57, 
+  0xe8, 0x20, 0x00, 0x7b, 0x6f, 0x91, 0x6f, 0x40, 0x52, 0xe8, 0x10, 0x51, 
+  0x4f, 0x80, 0xe0, 0x7f, 0x04, 0x80, 0xd1, 0x7f, 0x08, 0x00, 0x54, 0x88, 
+  0x92, 0x42, 0xa4, 0xb4, 0x7f, 0xa3, 0x7f, 0x8b, 0x7f, 0x12, 0x30, 0x01, 
+  0x40, 0x98, 0x2e, 0x00, 0x80, 0xfe, 0xc9, 0xc2, 0x6f, 0xb1, 0x6f, 0x80, 
+  0x42, 0x85, 0x80, 0x44, 0x84, 0x62, 0x7f, 0x70, 0x08, 0x16, 0x02, 0x00, 
+  0x71, 0x02, 0x46, 0x40, 0x42, 0x83, 0x80, 0x4a, 0x25, 0x6f, 0x82, 0x50, 
+  0x7f, 0x2f, 0x8f, 0x71, 0x7f, 0x00, 0x00, 0x7a, 0x82, 0x47, 0x7f, 0x04, 
+  0x30, 0xbb, 0x50, 0xb7, 0x5a, 0xb9, 0x5c, 0xb5, 0x56, 0x82, 0x40, 0x20, 
+  0x00, 0x37, 0x7f, 0x21, 0x7f, 0xf0, 0x12, 0x76, 0x67, 0xcc, 0xd2, 0x6f, 
+  0x31, 0x6f, 0x82, 0x40, 0x40, 0x42, 0x00, 0x00, 0x81, 0x90, 0x06, 0x2f, 
+  0xa4, 0x6f, 0x70, 0x6f, 0x0b, 0x41, 0x03, 0x84, 0x44, 0x40, 0x0b, 0x42, 
+  0x00, 0x00, 0x84, 0x42, 0x41, 0x8e, 0x70, 0x6f, 0x01, 0x80, 0xa2, 0x6f, 
+  0x70, 0x7f, 0x81, 0x84, 0x50, 0x6f, 0x80, 0x00, 0x24, 0x6f, 0x02, 0x83, 
+  0x50, 0x0e, 0xa2, 0x08, 0x46, 0xdb, 0x2f, 0x01, 0x25, 0xd5, 0x6f, 0x96, 
+  0x6f, 0x00, 0x00, 0x39, 0x82, 0x87, 0x8d, 0x44, 0x42, 0x47, 0x8b, 0xa5, 
+  0x7f, 0x76, 0x7f, 0x30, 0x7f, 0xbd, 0x88, 0x80, 0x08, 0x71, 0x6f, 0x12, 
+  0x41, 0x41, 0x40, 0x24, 0x02, 0x5c, 0x16, 0xb7, 0x30, 0x02, 0x40, 0x24, 
+  0x6f, 0x51, 0x6f, 0x00, 0x00, 0x61, 0x0e, 0x30, 0x7f, 0xf2, 0x2f, 0x91, 
+  0x6f, 0x43, 0x8a, 0x3d, 0x88, 0x42, 0x41, 0x43, 0x8b, 0x00, 0x00, 0x04, 
+  0x41, 0x0b, 0x30, 0xa2, 0x0e, 0x95, 0x7f, 0x5b, 0x7f, 0x16, 0x2f, 0x42, 
+  0x84, 0x0b, 0x30, 0x00, 0x00, 0x82, 0x40, 0xa2, 0x0f, 0x5b, 0x7f, 0x10, 
+  0x2f, 0xa2, 0x6f, 0x44, 0x8a, 0x81, 0x88, 0x45, 0x41, 0x24, 0x00, 0xf0, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xa5, 
+  0x0e, 0x04, 0x30, 0x07, 0x2f, 0x45, 0x82, 0x82, 0x84, 0x41, 0x40, 0x82, 
+  0x40, 0x02, 0x80, 0x91, 0x02, 0x0e, 0x00, 0x2f, 0x14, 0x30, 0x54, 0x7f, 
+  0x1a, 0x25, 0x72, 0x82, 0x44, 0x6f, 0xa1, 0x12, 0xd6, 0x9d, 0x28, 0x05, 
+  0x68, 0x44, 0x08, 0x68, 0x02, 0x16, 0x06, 0x68, 0x3e, 0x84, 0x72, 0x2e, 
+  0x7f, 0x7a, 0x88, 0x03, 0x3a, 0x74, 0x04, 0x20, 0x71, 0x6f, 0x20, 0x00, 
+  0xa0, 0x6f, 0x32, 0x6f, 0x00, 0x22, 0x84, 0x01, 0x28, 0x84, 0x40, 0x20, 
+  0x1e, 0xa0, 0x42, 0xa2, 0x7f, 0x20, 0x01, 0x82, 0x80, 0x91, 0x6f, 0x7b, 
+  0x04, 0x24, 0x90, 0x7f, 0x07, 0x26, 0xa4, 0x6f, 0x90, 0x6f, 0x62, 0x40, 
+  0x04, 0x00, 0x20, 0x41, 0x05, 0x40, 0xa2, 0x28, 0xaa, 0x1e, 0x22, 0x42, 
+  0x02, 0x84, 0x03, 0x6f, 0x23, 0x60, 0x98, 0x2e, 0x00, 0x1a, 0x91, 0x03, 
+  0xa0, 0x6f, 0x3f, 0x80, 0x06, 0x84, 0x13, 0x12, 0x96, 0xa2, 0x02, 0x54, 
+  0x05, 0x10, 0xe4, 0x6f, 0x01, 0x00, 0x48, 0x40, 0x02, 0x81, 0x01, 0x8b, 
+  0x40, 0xb2, 0x04, 0x2f, 0x61, 0x6f, 0x52, 0x4e, 0x40, 0x40, 0x22, 0x18, 
+  0x00, 0x80, 0x21, 0x40, 0x00, 0x90, 0xd0, 0x6f, 0x02, 0x2f, 0x12, 0x07, 
+  0x82, 0x46, 0xb1, 0x6f, 0x42, 0x82, 0x05, 0x1a, 0x07, 0x2f, 0x18, 0x31, 
+  0xb1, 0x6f, 0x41, 0x06, 0x0c, 0x33, 0x5a, 0xed, 0x00, 0x50, 0x72, 0x70, 
+  0x27, 0x2f, 0xc0, 0x02, 0x3a, 0x03, 0x34, 0x20, 0x2f, 0x00, 0x20, 0x51, 
+  0x41, 0x42, 0x41, 0x8a, 0x01, 0x6f, 0x81, 0x84, 0xaf, 0x15, 0x2f, 0xb5, 
+  0x02, 0x16, 0x45, 0x41, 0x00, 0x08, 0x40, 0xb3, 0x0e, 0x2f, 0x04, 0x41, 
+  0x00, 0xa5, 0x01, 0x2f, 0x41, 0x52, 0x42, 0x00, 0xad, 0x04, 0x30, 0x08, 
+  0x00, 0x09, 0x2f, 0x81, 0x73, 0xd8, 0x2e, 0x06, 0x2c, 0x54, 0x30, 0x04, 
+  0x2c, 0x44, 0x30, 0x02, 0x2c, 0x04, 0x04, 0x00, 0x30, 0x34, 0x32, 0x90, 
+  0xed, 0x00, 0x04, 0x2c, 0x04, 0x25, 0x02, 0x2c, 0x00, 0x30, 0x00, 0x30, 
+  0x8b, 0x00, 0x00, 0x6f, 0xf0, 0x5e, 0xb8, 0x2e, 0xcb, 0x50, 0xf0, 0x50, 
+  0x12, 0x40, 0x06, 0x40, 0x1a, 0x25, 0x6c, 0x00, 0x00, 0xbe, 0x76, 0x8a, 
+  0x74, 0x80, 0xfb, 0x7f, 0x68, 0xbf, 0xcd, 0x56, 0x0b, 0x30, 0xd3, 0x08, 
+  0x4c, 0x00, 0x00, 0xba, 0x6c, 0xbb, 0x5b, 0x7f, 0x4b, 0x43, 0x0b, 0x42, 
+  0xc0, 0xb2, 0xc6, 0x7f, 0xb4, 0x7f, 0xd0, 0x04, 0x04, 0x7f, 0xe5, 0x22, 
+  0x56, 0x90, 0x2e, 0xac, 0xb3, 0x01, 0x2e, 0x90, 0x42, 0x4e, 0x0b, 0x2f, 
+  0xc1, 0x52, 0x01, 0x10, 0x04, 0x2e, 0x8b, 0x00, 0x92, 0x02, 0xea, 0xbb, 
+  0xcc, 0x01, 0x30, 0x23, 0x02, 0x16, 0x92, 0x6f, 0xa3, 0x6f, 0x1a, 0x00, 
+  0x00, 0x25, 0x26, 0xbc, 0x86, 0xba, 0x25, 0xbc, 0x0f, 0xb8, 0x54, 0xb1, 
+  0x00, 0xb2, 0x96, 0x7f, 0x0c, 0x00, 0x01, 0x2f, 0xc3, 0x50, 0xc5, 0x54, 
+  0x0b, 0x30, 0x0b, 0xa2, 0x1c, 0xc9, 0x58, 0x1b, 0x42, 0x9b, 0x42, 0x6c, 
+  0x10, 0x00, 0x09, 0x0b, 0x42, 0x2b, 0x02, 0x0e, 0x8b, 0x42, 0x71, 0x84, 
+  0xcf, 0x50, 0x58, 0x09, 0xc7, 0x52, 0x91, 0x10, 0x41, 0x50, 0x82, 0x7f, 
+  0x75, 0x02, 0x48, 0xc2, 0xc0, 0x01, 0x02, 0x52, 0xe5, 0x6f, 0xd4, 0x6f, 
+  0x73, 0x92, 0x34, 0xc1, 0x00, 0x00, 0x52, 0xbf, 0x5c, 0x98, 0x2e, 0x06, 
+  0xcd, 0x65, 0x6f, 0xa0, 0x6f, 0xc3, 0x52, 0x40, 0xb3, 0x04, 0x00, 0x44, 
+  0xbd, 0x53, 0x40, 0xaf, 0xba, 0x44, 0x40, 0xe1, 0x7f, 0x02, 0x92, 0x00, 
+  0x40, 0xb3, 0x02, 0x32, 0x3e, 0xc5, 0x00, 0x00, 0x5c, 0x12, 0x30, 0x93, 
+  0x43, 0x84, 0x43, 0x03, 0xbf, 0x6f, 0xbb, 0x80, 0xb3, 0x20, 0x2f, 0x46, 
+  0x00, 0x00, 0x6f, 0xde, 0x00, 0x56, 0x6f, 0x26, 0x03, 0x44, 0x42, 0x40, 
+  0x91, 0x27, 0x2e, 0x8c, 0x00, 0xc5, 0x00, 0x00, 0x52, 0x14, 0x2f, 0xc5, 
+  0x5c, 0x00, 0x2e, 0x95, 0x41, 0x86, 0x41, 0x5d, 0x05, 0xa6, 0x07, 0x80, 
+  0x00, 0x80, 0xab, 0x04, 0x2f, 0x80, 0x91, 0x0a, 0x2f, 0x96, 0x6f, 0x75, 
+  0x0f, 0x07, 0x2f, 0x95, 0x6f, 0x02, 0x56, 0x10, 0x09, 0x2f, 0x53, 0x42, 
+  0x44, 0x52, 0xbe, 0x04, 0x2c, 0x11, 0x12, 0x28, 0x11, 0x30, 0x02, 0x06, 
+  0xbc, 0x0f, 0xb8, 0xd2, 0x14, 0x40, 0x7f, 0x00, 0x22, 0xec, 0x31, 0x02, 
+  0xd6, 0xd1, 0x00, 0x23, 0x2e, 0x8a, 0x00, 0x0b, 0x2c, 0x01, 0x52, 0x50, 
+  0x8a, 0x41, 0x30, 0x92, 0x0c, 0xd1, 0x00, 0x10, 0x1a, 0x02, 0x32, 0x96, 
+  0xd1, 0x00, 0x01, 0x2d, 0x01, 0x72, 0xee, 0x83, 0xde, 0xd1, 0x6f, 0x44, 
+  0x00, 0xb0, 0x6f, 0x03, 0x08, 0xe2, 0x6f, 0xbd, 0x12, 0x14, 0x8c, 0x00, 
+  0x82, 0x40, 0x50, 0x42, 0x11, 0x2c, 0x42, 0xd0, 0x14, 0x42, 0x10, 0x30, 
+  0x31, 0x52, 0x40, 0x90, 0x02, 0x42, 0x05, 0x46, 0xc0, 0x6f, 0x95, 0x0e, 
+  0xb0, 0x06, 0x08, 0x00, 0x2e, 0xfb, 0x04, 0x14, 0x6f, 0x10, 0x72, 0xd4, 
+  0xbd, 0x50, 0x10, 0x50, 0xd3, 0x52, 0x05, 0x72, 0x9c, 0xfb, 0x22, 0xb6, 
+  0x13, 0x40, 0x93, 0x05, 0x90, 0xd2, 0xb0, 0xfb, 0x42, 0x24, 0xed, 0x03, 
+  0x98, 0x2e, 0x87, 0xcf, 0x01, 0x2e, 0x97, 0x12, 0x70, 0xfb, 0x6f, 0x73, 
+  0x26, 0x00, 0x88, 0x69, 0xf7, 0xb1, 0x3f, 0x01, 0x08, 0x01, 0x30, 0xf0, 
+  0x5f, 0x23, 0x02, 0x16, 0x21, 0x2e, 0x69, 0xf2, 0x78, 0x08, 0x00, 0xe2, 
+  0xb3, 0xf0, 0x02, 0x44, 0x03, 0x2e, 0xfc, 0xf5, 0x01, 0x2e, 0xc0, 0xf8, 
+  0xd5, 0x54, 0xd7, 0x56, 0x08, 0x00, 0x82, 0x08, 0x0b, 0x02, 0x1a, 0xcb, 
+  0x0a, 0xd9, 0x58, 0x80, 0x90, 0xdd, 0xbe, 0x4c, 0x08, 0x5f, 0xb9, 0x08, 
+  0x00, 0x59, 0x22, 0x80, 0x22, 0x12, 0x03, 0x34, 0xc3, 0x08, 0xf2, 0x3a, 
+  0x0a, 0x08, 0x02, 0x35, 0xc0, 0x90, 0x20, 0x28, 0x4a, 0x0a, 0x48, 0x22, 
+  0xc0, 0x82, 0x10, 0xfc, 0xf5, 0x10, 0x50, 0xfb, 0x12, 0x7c, 0x56, 0x73, 
+  0xb0, 0xc3, 0x11, 0xa0, 0x88, 0x30, 0x30, 0x30, 0xfb, 0x6f, 0x03, 0x5e, 
+  0x9b, 0x02, 0xb6, 0x89, 0x00, 0x21, 0x02, 0xfc, 0x23, 0x2e, 0x19, 0x02, 
+  0x0c, 0x02, 0x8a, 0x90, 0x02, 0x0c, 0xd1, 0x00, 0xb8, 0x2e, 0x03, 0xbc, 
+  0x21, 0x52, 0xbc, 0x03, 0x02, 0x04, 0x40, 0xb2, 0x10, 0x02, 0xde, 0x01, 
+  0x80, 0x72, 0xd6, 0x30, 0x05, 0x2f, 0x05, 0x2e, 0x96, 0x00, 0x80, 0x90, 
+  0x01, 0x2f, 0x23, 0x2e, 0x6f, 0x82, 0x66, 0x02, 0x00, 0x21, 0x02, 0x9c, 
+  0x11, 0x30, 0x81, 0x08, 0x01, 0x2e, 0x6a, 0xf7, 0x71, 0x3f, 0x23, 0xbd, 
+  0x01, 0x08, 0x84, 0x3a, 0x02, 0x0a, 0xc3, 0x6a, 0x6a, 0xf7, 0x30, 0x25, 
+  0x63, 0x12, 0x5a, 0x02, 0x74, 0x21, 0x72, 0x94, 0x53, 0x30, 0x03, 0x7c, 
+  0x2a, 0xb4, 0x12, 0x10, 0x40, 0x02, 0x4a, 0x92, 0x00, 0x03, 0x7a, 0x03, 
+  0x25, 0x80, 0x2e, 0x16, 0xb4, 0x03, 0xc2, 0x2a, 0x00, 0x31, 0x08, 0x00, 
+  0x00, 0x08, 0xf2, 0x30, 0x20, 0x50, 0x4a, 0x08, 0xe1, 0x7f, 0x00, 0xb2, 
+  0xfb, 0x7f, 0x01, 0x30, 0x15, 0x41, 0x01, 0x62, 0xca, 0x9b, 0x00, 0x01, 
+  0x90, 0x03, 0x02, 0x68, 0x9b, 0x52, 0xf4, 0xca, 0xb6, 0x98, 0x2e, 0xa8, 
+  0xcf, 0x11, 0x80, 0x00, 0x30, 0x41, 0x08, 0x23, 0x2e, 0xdb, 0x01, 0x92, 
+  0x66, 0xb4, 0x10, 0x25, 0xfb, 0x6f, 0xe0, 0x6f, 0xe0, 0x55, 0x01, 0xa4, 
+  0x7c, 0xe0, 0x14, 0x94, 0x11, 0x12, 0xc4, 0x9b, 0x02, 0x5a, 0xe0, 0x12, 
+  0x24, 0x50, 0x51, 0x91, 0x54, 0xeb, 0x7f, 0x11, 0x00, 0x00, 0x30, 0x0a, 
+  0x25, 0x4d, 0x57, 0x5f, 0x5d, 0x95, 0x40, 0xc4, 0x40, 0x25, 0x01, 0xd4, 
+  0x42, 0x4d, 0x00, 0x00, 0x17, 0xc4, 0x40, 0x65, 0x03, 0xd5, 0x42, 0x56, 
+  0x0e, 0xf5, 0x2f, 0x63, 0x57, 0x02, 0x30, 0xc6, 0x00, 0x00, 0x40, 0xb1, 
+  0x29, 0xe6, 0x42, 0x00, 0x2e, 0xc3, 0x40, 0xc0, 0xb2, 0x0a, 0x23, 0x4c, 
+  0x14, 0x71, 0x00, 0x00, 0x0e, 0xd4, 0x7f, 0x90, 0x2e, 0xc6, 0xb6, 0x03, 
+  0x31, 0x31, 0x53, 0x33, 0x55, 0x5c, 0x05, 0x8a, 0x00, 0x00, 0x28, 0x2b, 
+  0x82, 0x51, 0x57, 0x2d, 0x5f, 0x2e, 0x80, 0xde, 0x8c, 0x30, 0x89, 0xff, 
+  0x29, 0x96, 0x50, 0x04, 0x7f, 0x60, 0x7f, 0xc5, 0xd2, 0x16, 0xa4, 0xd2, 
+  0x14, 0x77, 0x7f, 0x51, 0x12, 0xc2, 0x90, 0x41, 0x92, 0x41, 0xd3, 0x00, 
+  0x00, 0x6f, 0xc0, 0xb2, 0x46, 0x7f, 0x31, 0x7f, 0x08, 0x2f, 0xd0, 0xa0, 
+  0x02, 0x2f, 0xa0, 0x6f, 0x05, 0x00, 0x00, 0x2c, 0x10, 0x10, 0xc6, 0x6f, 
+  0x96, 0x14, 0x03, 0x12, 0x02, 0x0a, 0x05, 0x2e, 0xd9, 0x01, 0x80, 0x00, 
+  0x01, 0x90, 0x29, 0x55, 0x40, 0x42, 0x4a, 0x2f, 0x41, 0x52, 0xa4, 0xd9, 
+  0xc0, 0x2b, 0x55, 0xdb, 0x52, 0x20, 0x81, 0x10, 0x12, 0x86, 0xfe, 0xc9, 
+  0x72, 0x6f, 0x10, 0x25, 0x53, 0xb6, 0x22, 0x6f, 0xe3, 0x30, 0x03, 0x0a, 
+  0x0f, 0xca, 0x91, 0x00, 0x2c, 0x6f, 0x76, 0x86, 0xdb, 0x52, 0x2d, 0x55, 
+  0xd0, 0x42, 0x93, 0x04, 0x22, 0x0b, 0x1a, 0x2f, 0x02, 0x44, 0x79, 0x80, 
+  0x28, 0xc4, 0xdb, 0x52, 0x90, 0x04, 0x1a, 0x82, 0x0f, 0x3c, 0xca, 0x93, 
+  0x6f, 0x31, 0x02, 0x5a, 0xd0, 0x42, 0x13, 0x04, 0x20, 0x09, 0x3a, 0x80, 
+  0x02, 0x13, 0x6f, 0x35, 0x5f, 0xc0, 0x42, 0xf7, 0x02, 0xac, 0x22, 0x42, 
+  0xae, 0x31, 0x5b, 0x33, 0x59, 0x2f, 0x5d, 0x00, 0x10, 0x31, 0x57, 0x98, 
+  0x2e, 0x67, 0xcc, 0xb1, 0x6f, 0x02, 0x2c, 0x40, 0x42, 0x42, 0x86, 0x80, 
+  0x32, 0x6f, 0x00, 0x00, 0x81, 0x82, 0x62, 0x6f, 0x46, 0x6f, 0x96, 0x7f, 
+  0x4a, 0x0e, 0xb0, 0x7f, 0x94, 0x2f, 0xf1, 0x3d, 0x80, 0x00, 0x4f, 0x55, 
+  0x10, 0x30, 0x53, 0x6f, 0x91, 0x22, 0x0a, 0xd9, 0x01, 0x66, 0x6f, 0xd1, 
+  0x40, 0x80, 0x40, 0x00, 0x00, 0x01, 0x00, 0x90, 0x42, 0x09, 0x16, 0x85, 
+  0x40, 0x28, 0x02, 0x80, 0x42, 0x9a, 0x80, 0x29, 0x55, 0x20, 0x00, 0xd6, 
+  0x7f, 0xc3, 0x7f, 0xb0, 0x02, 0x6c, 0xd9, 0xc0, 0x05, 0x30, 0xf5, 0x7f, 
+  0x20, 0x25, 0xb1, 0x6f, 0x20, 0x00, 0x2d, 0x59, 0x2b, 0x5d, 0x2d, 0x04, 
+  0x5a, 0xd6, 0x6f, 0xc3, 0x6f, 0xb2, 0x6f, 0x61, 0x6f, 0xa7, 0x84, 0x00, 
+  0x00, 0x90, 0x43, 0x59, 0x0e, 0xdf, 0x2f, 0x10, 0x30, 0x81, 0x40, 0x08, 
+  0x28, 0x90, 0x42, 0xd2, 0x7f, 0x00, 0x08, 0x02, 0xa0, 0x27, 0x2f, 0x27, 
+  0x55, 0x51, 0x53, 0x03, 0x30, 0x96, 0x02, 0x54, 0x08, 0x17, 0x15, 0x30, 
+  0x00, 0x00, 0x65, 0x09, 0xb5, 0x01, 0xc3, 0x02, 0x61, 0xb8, 0x94, 0x8c, 
+  0xb6, 0x7f, 0xbf, 0xbd, 0x29, 0x55, 0x08, 0x06, 0xc1, 0x7f, 0x43, 0x82, 
+  0x90, 0xd9, 0xc0, 0x35, 0x55, 0xf2, 0x04, 0x56, 0x0b, 0xb2, 0xb2, 0x6f, 
+  0x03, 0x30, 0xc1, 0x00, 0x44, 0x6f, 0xab, 0x84, 0x59, 0x5d, 0x93, 0x42, 
+  0x50, 0x42, 0x4e, 0xb2, 0x0c, 0xdb, 0x2f, 0x83, 0x12, 0xc0, 0xd1, 0x41, 
+  0x48, 0x22, 0x00, 0xb3, 0xc0, 0x61, 0x6f, 0xc0, 0x02, 0x90, 0xb3, 0xc0, 
+  0x51, 0x6f, 0x03, 0x98, 0xb3, 0xc0, 0xb2, 0xb6, 0x52, 0x00, 0x22, 0x08, 
+  0x22, 0xb2, 0x6f, 0xc1, 0x6f, 0xa0, 0x7f, 0xb3, 0x52, 0x14, 0x0f, 0xca, 
+  0xb2, 0x02, 0x1a, 0xb3, 0x30, 0x00, 0x00, 0x37, 0x53, 0x98, 0x2e, 0x5a, 
+  0xca, 0xd6, 0x6f, 0x02, 0x30, 0x61, 0x6f, 0xd2, 0x7f, 0x90, 0x7f, 0x26, 
+  0x00, 0x81, 0x02, 0x1e, 0x42, 0x45, 0x41, 0x76, 0x02, 0x3e, 0x0f, 0xca, 
+  0xd2, 0x6f, 0x81, 0x6f, 0x10, 0x28, 0x41, 0x40, 0x08, 0x00, 0x92, 0x6f, 
+  0xd0, 0x02, 0x18, 0x98, 0x2e, 0x0f, 0xca, 0x81, 0x6f, 0x76, 0x6f, 0x59, 
+  0x55, 0x50, 0x42, 0x80, 0x80, 0x72, 0x0e, 0xe9, 0x2f, 0xc2, 0x6f, 0xa1, 
+  0x02, 0x6c, 0xfe, 0xc9, 0x10, 0x25, 0xb3, 0x30, 0x21, 0x12, 0xbe, 0x80, 
+  0x00, 0x0f, 0xca, 0x20, 0x25, 0x61, 0x51, 0x39, 0x02, 0x52, 0x16, 0xb7, 
+  0xc5, 0x6f, 0x61, 0x51, 0x3b, 0x5d, 0x00, 0x00, 0x12, 0x40, 0x75, 0x05, 
+  0x31, 0x30, 0x11, 0x86, 0x53, 0x5d, 0xc1, 0x7f, 0x15, 0x0f, 0x00, 0x40, 
+  0x00, 0x00, 0x08, 0x2f, 0x3f, 0x80, 0x00, 0xa8, 0x21, 0x2e, 0xc9, 0x01, 
+  0x00, 0x30, 0x0a, 0x2f, 0x90, 0x43, 0xc1, 0x00, 0xb2, 0xf2, 0x43, 0x01, 
+  0x80, 0x03, 0xa0, 0x03, 0x12, 0xc2, 0x12, 0x2f, 0x91, 0x43, 0x80, 0x43, 
+  0x00, 0x2e, 0x3d, 0x10, 0x00, 0x55, 0x00, 0x6f, 0x82, 0xc2, 0x56, 0xf0, 
+  0x6e, 0x3f, 0x55, 0x02, 0x0f, 0x14, 0x2f, 0xe1, 0x6e, 0xc3, 0x01, 0x00, 
+  0x02, 0x8e, 0x74, 0xc0, 0xc3, 0x6f, 0x41, 0x55, 0x01, 0x30, 0xc1, 0x7f, 
+  0xc2, 0x0f, 0x0a, 0x2f, 0xf0, 0x00, 0x00, 0x6e, 0x43, 0x53, 0x81, 0x0e, 
+  0x11, 0x30, 0x04, 0x2f, 0x00, 0x6f, 0x00, 0xa4, 0x11, 0x30, 0x00, 0x84, 
+  0x20, 0x2f, 0x21, 0x02, 0x1a, 0xf1, 0x80, 0xc2, 0x40, 0x33, 0xf2, 0x55, 
+  0x55, 0xb8, 0x86, 0x12, 0xe2, 0x3e, 0xd7, 0x86, 0x00, 0x00, 0x23, 0x2e, 
+  0xcb, 0x01, 0xc2, 0x42, 0x38, 0x8a, 0x02, 0x40, 0x0a, 0x1a, 0x55, 0x55, 
+  0x00, 0x30, 0x20, 0x80, 0x02, 0x2f, 0x91, 0x42, 0x0e, 0xc2, 0x68, 0x03, 
+  0x2e, 0xcc, 0x01, 0x12, 0x30, 0x4a, 0x28, 0x23, 0x02, 0x08, 0x00, 0x20, 
+  0x50, 0xa0, 0x04, 0x2f, 0x57, 0x55, 0x89, 0x82, 0xc3, 0x6f, 0x83, 0x42, 
+  0x40, 0x12, 0x42, 0x05, 0x2e, 0x00, 0x00, 0x9a, 0x00, 0x84, 0x8c, 0x47, 
+  0x41, 0xa1, 0x41, 0xa9, 0x56, 0xc0, 0xb3, 0x0b, 0x09, 0xc4, 0x05, 0x00, 
+  0x00, 0x44, 0x89, 0x85, 0x41, 0xf3, 0xbf, 0x82, 0x8d, 0xa7, 0x7f, 0x94, 
+  0x7f, 0x0a, 0x2f, 0x09, 0x2e, 0x00, 0x00, 0xca, 0x01, 0x00, 0x91, 0x06, 
+  0x2f, 0x81, 0x80, 0x47, 0x59, 0x0b, 0x40, 0x49, 0x5b, 0x84, 0x7f, 0x00, 
+  0x00, 0x0c, 0x2c, 0x49, 0x51, 0x2b, 0x09, 0x98, 0xb9, 0x44, 0x04, 0xd8, 
+  0xba, 0x82, 0x84, 0x53, 0xbc, 0x00, 0x02, 0x45, 0x5f, 0xb3, 0xbe, 0x8b, 
+  0x40, 0x13, 0xbe, 0x87, 0x12, 0x36, 0x86, 0x41, 0x4b, 0x53, 0xb2, 0x6f, 
+  0x82, 0x80, 0x76, 0x32, 0x2e, 0x55, 0x7f, 0x4b, 0x7f, 0x34, 0x02, 0xca, 
+  0x0f, 0xca, 0xd1, 0x6f, 0x88, 0x0e, 0x03, 0x32, 0xd6, 0x28, 0x10, 0xc2, 
+  0x01, 0x00, 0xe2, 0xf2, 0x00, 0x42, 0x06, 0xc4, 0x01, 0x10, 0x2d, 0x03, 
+  0x2e, 0x02, 0x06, 0x30, 0x48, 0x28, 0x20, 0x02, 0x72, 0x6f, 0xa8, 0xb9, 
+  0x23, 0x02, 0x0c, 0x0b, 0x0e, 0xc1, 0x12, 0x6c, 0x03, 0x2f, 0x90, 0x42, 
+  0x91, 0x42, 0x00, 0x96, 0x00, 0x30, 0x80, 0x42, 0xb3, 0x30, 0xb2, 0x6f, 
+  0x41, 0x12, 0x72, 0x03, 0x40, 0x08, 0x12, 0x20, 0x01, 0x2e, 0x02, 0x40, 
+  0x03, 0x00, 0x42, 0x16, 0x03, 0x40, 0xc6, 0x01, 0x12, 0x2d, 0x01, 0x2e, 
+  0xc6, 0x01, 0x71, 0x6f, 0xa9, 0x54, 0x01, 0x80, 0x08, 0x80, 0x4a, 0x08, 
+  0x21, 0x02, 0x0c, 0x01, 0x0e, 0x07, 0x2f, 0x5b, 0x51, 0x02, 0x80, 0x01, 
+  0x30, 0x21, 0x52, 0xea, 0x00, 0x08, 0x01, 0x42, 0x25, 0x2e, 0xc5, 0x01, 
+  0x91, 0x6f, 0x7e, 0x84, 0x43, 0x82, 0x38, 0x7c, 0x80, 0x9a, 0x29, 0x00, 
+  0xd8, 0x03, 0x40, 0x46, 0x42, 0xc3, 0xb2, 0x06, 0x30, 0x00, 0x30, 0x2b, 
+  0x73, 0x6a, 0x92, 0xcc, 0x27, 0x02, 0x94, 0x02, 0xdc, 0x55, 0x11, 0xf2, 
+  0x6a, 0x05, 0xd2, 0x9c, 0x03, 0x02, 0x16, 0x03, 0x02, 0x0c, 0x1c, 0x12, 
+  0x64, 0x83, 0x6f, 0x83, 0xb2, 0x62, 0x17, 0x2f, 0xf3, 0x00, 0x05, 0x6e, 
+  0x50, 0x6f, 0x98, 0x0f, 0x00, 0x30, 0x12, 0x32, 0xdc, 0x98, 0x02, 0x12, 
+  0x0e, 0x2f, 0xe3, 0x6e, 0x60, 0x21, 0x22, 0x04, 0x12, 0x09, 0x2f, 0x30, 
+  0x6f, 0x03, 0x12, 0x05, 0x2f, 0x80, 0x02, 0x4a, 0x02, 0x2f, 0x2d, 0x02, 
+  0x9e, 0x10, 0x30, 0x00, 0x41, 0x42, 0x40, 0x82, 0xac, 0x56, 0x82, 0x01, 
+  0x2f, 0xf3, 0x3e, 0x5b, 0x55, 0x82, 0x84, 0x2d, 0x02, 0x84, 0x86, 0x01, 
+  0x04, 0x12, 0x64, 0x5d, 0x55, 0x56, 0x42, 0x56, 0x42, 0x4a, 0x0e, 0xfb, 
+  0x02, 0x28, 0xdc, 0x01, 0x01, 0x2d, 0x00, 0x00, 0x00, 0x30, 0xeb, 0x6f, 
+  0xb0, 0x5e, 0xb8, 0x2e, 0x27, 0x51, 0x01, 0x30, 0x5d, 0x55, 0x11, 0x42, 
+  0x42, 0x0c, 0x28, 0x0e, 0xfc, 0x32, 0x2a, 0x53, 0x3e, 0xc2, 0x01, 0x40, 
+  0x50, 0x0a, 0x25, 0x3c, 0x72, 0xa4, 0x01, 0x32, 0x34, 0xe3, 0x7f, 0x82, 
+  0x02, 0x32, 0x44, 0x20, 0x7a, 0xc1, 0xfb, 0x6f, 0xc0, 0x42, 0xdc, 0x70, 
+  0x02, 0x1c, 0x39, 0x80, 0xf3, 0x7f, 0x03, 0x42, 0x00, 0x28, 0xa1, 0x7f, 
+  0xc2, 0x7f, 0xd1, 0x7f, 0x03, 0x30, 0x03, 0x43, 0xe4, 0xe2, 0xae, 0x22, 
+  0x06, 0x26, 0xd2, 0x6f, 0x00, 0x00, 0x02, 0x17, 0x04, 0x08, 0xc1, 0x6f, 
+  0x0c, 0x09, 0x04, 0x1a, 0x10, 0x30, 0x04, 0x30, 0x20, 0x22, 0x00, 0x00, 
+  0x01, 0xb2, 0x14, 0x2f, 0x65, 0x59, 0x14, 0x09, 0xf3, 0x30, 0x93, 0x08, 
+  0x24, 0xbd, 0x44, 0xba, 0x00, 0x00, 0x94, 0x0a, 0x02, 0x17, 0xf3, 0x6f, 
+  0x4c, 0x08, 0x9a, 0x08, 0x8a, 0x0a, 0x09, 0x53, 0x51, 0x08, 0x00, 0x20, 
+  0xa9, 0x58, 0x94, 0x08, 0x28, 0xbd, 0x98, 0xb8, 0xe4, 0x6f, 0x51, 0x0a, 
+  0x01, 0x22, 0x8e, 0xbb, 0x6f, 0x02, 0x00, 0x90, 0x02, 0x68, 0xf5, 0x56, 
+  0x05, 0x40, 0x69, 0x18, 0x0d, 0x17, 0xe1, 0x18, 0x19, 0x05, 0x16, 0x25, 
+  0x00, 0x00, 0x37, 0x25, 0x4a, 0x17, 0x54, 0x18, 0xec, 0x18, 0x04, 0x30, 
+  0x64, 0x07, 0xea, 0x18, 0x8e, 0x00, 0x00, 0x00, 0x5f, 0x02, 0xdb, 0x56, 
+  0x93, 0x00, 0x4c, 0x02, 0x2f, 0xb9, 0x91, 0xbc, 0x91, 0x0a, 0x02, 0x42, 
+  0x00, 0x00, 0xb8, 0x2e, 0x67, 0x53, 0x69, 0x51, 0x43, 0x40, 0x05, 0x2e, 
+  0x25, 0xf3, 0xb8, 0xbd, 0x9a, 0x0a, 0x00, 0x00, 0x12, 0x42, 0x42, 0x82, 
+  0x6b, 0x55, 0x64, 0x40, 0x43, 0x40, 0x48, 0xbe, 0xe3, 0x0a, 0x13, 0x42, 
+  0x00, 0x00, 0x43, 0x82, 0x42, 0x0e, 0xf7, 0x2f, 0x80, 0x2e, 0x78, 0xb7, 
+  0x01, 0x2e, 0x3d, 0x01, 0x0f, 0xbc, 0x00, 0x82, 0x8f, 0xb8, 0x10, 0x50, 
+  0x01, 0x2e, 0x9c, 0x00, 0x41, 0x92, 0x16, 0x01, 0x90, 0x0e, 0x2f, 0x70, 
+  0x22, 0x12, 0x88, 0x00, 0x68, 0xf7, 0xfb, 0x22, 0x2c, 0x64, 0xb7, 0x98, 
+  0x02, 0x26, 0x06, 0x2c, 0xfb, 0x6f, 0x00, 0x90, 0x00, 0x30, 0x40, 0x10, 
+  0x01, 0x2f, 0x21, 0x2e, 0x68, 0xf7, 0x05, 0x34, 0x0f, 0xb8, 0xf0, 0x5f, 
+  0x21, 0x02, 0x34, 0xb8, 0x2e, 0x6f, 0x00, 0x40, 0x55, 0x6d, 0x51, 0xa1, 
+  0x40, 0x83, 0x8a, 0x83, 0x40, 0x18, 0xbe, 0x62, 0x41, 0x41, 0xa2, 0x46, 
+  0x23, 0x00, 0x00, 0x0b, 0x28, 0xbd, 0x63, 0x41, 0x51, 0x0a, 0x14, 0x42, 
+  0xb8, 0xbd, 0x42, 0x41, 0x11, 0x42, 0x5a, 0x04, 0x00, 0x0a, 0x01, 0x02, 
+  0x94, 0x9b, 0x50, 0x01, 0x3f, 0x02, 0x40, 0x51, 0x08, 0x11, 0x42, 0x01, 
+  0x32, 0x01, 0x80, 0xf0, 0x42, 0x3e, 0x80, 0x21, 0x31, 0xc0, 0x2e, 0xf3, 
+  0x96, 0x80, 0x2e, 0x00, 0xc1, 0x0f, 0x04, 0x0f, 0x10, 0x02, 0x00, 0x22, 
+  0xff, 0x0f, 0x08, 0x00, 0x0c, 0x02, 0x00, 0xf0, 0x09, 0x03, 0x10, 0x01, 
+  0x2e, 0x5d, 0xf7, 0x00, 0x00, 0x08, 0xbc, 0x80, 0xac, 0x0e, 0xbb, 0x02, 
+  0x2f, 0x00, 0x30, 0x41, 0x04, 0x82, 0x06, 0xc0, 0xa4, 0xc3, 0x01, 0xf0, 
+  0xff, 0xff, 0xff, 0xe8, 0x11, 0x2f, 0x40, 0xa9, 0x03, 0x2f, 0x40, 0x91, 
+  0x0d, 0x2f, 0x00, 0xa7, 0x0b, 0x2f, 0x00, 0x40, 0x80, 0xb3, 0xdb, 0x58, 
+  0x02, 0x2f, 0x90, 0xa1, 0x26, 0x13, 0x20, 0x23, 0x80, 0x90, 0x43, 0xa4, 
+  0xcc, 0x04, 0x04, 0x0e, 0x00, 0x02, 0x2e, 0xb8, 0x2e, 0xe3, 0x56, 0xdd, 
+  0x54, 0xd0, 0x72, 0x4c, 0x0b, 0x2e, 0xfd, 0xf3, 0xe3, 0x00, 0x40, 0x52, 
+  0x90, 0x42, 0x94, 0x42, 0x95, 0x42, 0x05, 0x30, 0xe5, 0x50, 0x0f, 0x88, 
+  0x06, 0xb2, 0x28, 0x96, 0x00, 0x01, 0x42, 0xc5, 0x42, 0x48, 0xbe, 0x73, 
+  0x30, 0x0d, 0x82, 0x22, 0x4f, 0xba, 0x84, 0x42, 0x03, 0x42, 0x81, 0x50, 
+  0x00, 0xb3, 0x02, 0x2f, 0x2b, 0x82, 0x28, 0x06, 0xc2, 0xe8, 0x77, 0xf7, 
+  0xe1, 0x56, 0x93, 0x08, 0x25, 0x2e, 0x77, 0x00, 0x01, 0xf7, 0xdf, 0x54, 
+  0x25, 0x2e, 0xc2, 0xf5, 0x07, 0x02, 0x44, 0x42, 0x30, 0xb4, 0x33, 0xda, 
+  0x0a, 0x4c, 0x04, 0x04, 0x00, 0x27, 0x02, 0x0c, 0x43, 0x40, 0xd4, 0x3f, 
+  0xdc, 0x08, 0x43, 0x32, 0x28, 0x00, 0x2e, 0x43, 0x40, 0x24, 0x00, 0x91, 
+  0x30, 0xdc, 0x0a, 0x43, 0x42, 0x04, 0x80, 0x03, 0x02, 0x1a, 0x4a, 0x0a, 
+  0x23, 0x02, 0x06, 0x61, 0x34, 0x15, 0xba, 0x44, 0x40, 0xd0, 0x51, 0x23, 
+  0x24, 0xcf, 0x0d, 0x5a, 0x52, 0x7e, 0xf6, 0x0d, 0x6b, 0x87, 0xed, 0x54, 
+  0xe1, 0xa2, 0xae, 0xb3, 0x00, 0x40, 0x7f, 0xb2, 0x88, 0xe7, 0x52, 0xc2, 
+  0x7f, 0x65, 0x8b, 0xe9, 0x56, 0x84, 0x7f, 0x61, 0xa2, 0x64, 0xd0, 0x00, 
+  0x00, 0x7f, 0x95, 0x7f, 0x53, 0x7f, 0x14, 0x30, 0xeb, 0x54, 0x81, 0x6f, 
+  0x42, 0x7f, 0x00, 0x2e, 0x53, 0x00, 0x00, 0x40, 0x45, 0x8c, 0x42, 0x40, 
+  0x90, 0x41, 0xbb, 0x83, 0x86, 0x41, 0xd8, 0x04, 0x16, 0x06, 0x00, 0x00, 
+  0x20, 0xac, 0x81, 0x7f, 0x02, 0x2f, 0x02, 0x30, 0xd3, 0x04, 0x10, 0x06, 
+  0xc1, 0x84, 0x52, 0x64, 0x02, 0x0b, 0x00, 0x00, 0x16, 0x04, 0x09, 0x14, 
+  0x01, 0x99, 0x02, 0xc1, 0xb9, 0xaf, 0xbc, 0x59, 0x0a, 0x64, 0x6f, 0x51, 
+  0x40, 0x20, 0x43, 0xa1, 0xb4, 0x12, 0x41, 0x13, 0x22, 0x5d, 0x35, 0x7f, 
+  0x64, 0x7f, 0x26, 0x31, 0xa3, 0xae, 0x98, 0x2e, 0x00, 0x00, 0x37, 0xca, 
+  0x32, 0x6f, 0x75, 0x6f, 0x83, 0x40, 0x42, 0x41, 0x23, 0x7f, 0x12, 0x7f, 
+  0xf6, 0x30, 0x10, 0x00, 0x40, 0x25, 0x51, 0x25, 0x03, 0x16, 0x14, 0x6f, 
+  0x20, 0x05, 0x70, 0x6f, 0x25, 0x6f, 0x69, 0x07, 0xa2, 0x01, 0x00, 0xd2, 
+  0x44, 0x0b, 0x30, 0x04, 0x42, 0x9b, 0x42, 0x8b, 0x42, 0x55, 0x42, 0x32, 
+  0x7f, 0x40, 0xa9, 0xc3, 0x84, 0x02, 0x6f, 0x71, 0xa2, 0xca, 0xd0, 0x40, 
+  0xc3, 0x7f, 0x13, 0x66, 0x15, 0x12, 0x66, 0x13, 0x2f, 0x00, 0xa4, 0x11, 
+  0x2f, 0x00, 0x08, 0x84, 0xbd, 0x98, 0x2e, 0x79, 0xca, 0x55, 0x6f, 0xf5, 
+  0x54, 0x54, 0xc2, 0x0b, 0xf3, 0x3f, 0x45, 0x41, 0x08, 0x00, 0xcb, 0x02, 
+  0xf6, 0x62, 0xaa, 0x37, 0xca, 0x33, 0x6f, 0xa4, 0x6f, 0xc1, 0x42, 0x03, 
+  0x2c, 0x00, 0x43, 0x00, 0x00, 0xa4, 0x6f, 0x33, 0x6f, 0x00, 0x2e, 0x42, 
+  0x6f, 0x55, 0x6f, 0x91, 0x40, 0x42, 0x8b, 0x00, 0x41, 0x20, 0x00, 0x41, 
+  0x00, 0x01, 0x43, 0x55, 0x02, 0xd8, 0xc1, 0x40, 0x95, 0x40, 0x4d, 0x02, 
+  0xc5, 0x6f, 0xf3, 0x50, 0x00, 0x02, 0x68, 0x0e, 0x75, 0x6f, 0xd1, 0x42, 
+  0xa3, 0x7f, 0x8a, 0x52, 0xa6, 0x96, 0x00, 0x01, 0xb3, 0x22, 0x2f, 0x00, 
+  0x08, 0xed, 0x58, 0x90, 0x6f, 0x17, 0x30, 0x13, 0x41, 0xb6, 0x6f, 0xe4, 
+  0x02, 0xfa, 0x91, 0x41, 0x14, 0x40, 0xa0, 0x02, 0x92, 0x41, 0x15, 0x40, 
+  0x17, 0x12, 0x8a, 0xb6, 0xb2, 0xde, 0xcb, 0x32, 0x64, 0x00, 0x0c, 0x07, 
+  0x15, 0xc2, 0x6f, 0x08, 0x00, 0x14, 0x0b, 0x29, 0x02, 0x14, 0xc3, 0xa3, 
+  0xc1, 0x8f, 0xe4, 0x6f, 0xd0, 0x6f, 0xe6, 0x2f, 0x14, 0x30, 0x06, 0x00, 
+  0x05, 0x02, 0x10, 0x05, 0x16, 0x44, 0x2d, 0xef, 0x54, 0x01, 0x32, 0xf5, 
+  0x58, 0x05, 0x30, 0xa9, 0x50, 0x83, 0x00, 0x00, 0x40, 0xd8, 0x08, 0x91, 
+  0x01, 0xb8, 0xbd, 0x38, 0xb5, 0xe6, 0x7f, 0x0a, 0x16, 0xb1, 0x6f, 0x2a, 
+  0x00, 0x00, 0xbb, 0xa6, 0xbd, 0x1c, 0x01, 0x06, 0xbc, 0x52, 0x40, 0x06, 
+  0x0a, 0x53, 0x40, 0x45, 0x03, 0xb1, 0x05, 0x00, 0x12, 0x08, 0x98, 0x12, 
+  0x1a, 0x1a, 0xbd, 0x16, 0xb6, 0x86, 0xba, 0x00, 0xa9, 0xaa, 0x0a, 0xb3, 
+  0x52, 0x0f, 0x00, 0x20, 0x2f, 0x00, 0x91, 0xb3, 0x52, 0x03, 0x2f, 0xb3, 
+  0x5a, 0x55, 0x0f, 0xb3, 0x52, 0x72, 0x06, 0xa1, 0x04, 0x00, 0x00, 0x2f, 
+  0x3f, 0x91, 0x03, 0x2f, 0xf5, 0x58, 0xd4, 0x0f, 0x00, 0x2f, 0xf5, 0x54, 
+  0x12, 0x25, 0xf2, 0x00, 0x00, 0x33, 0x98, 0x2e, 0xd9, 0xc0, 0xe4, 0x6f, 
+  0xf5, 0x37, 0x45, 0x09, 0x21, 0x85, 0x05, 0x43, 0x05, 0x20, 0x28, 0x30, 
+  0xf1, 0x52, 0x51, 0x0e, 0x03, 0x74, 0xc5, 0x2f, 0xd5, 0x54, 0x09, 0x22, 
+  0x2a, 0x22, 0x02, 0xa0, 0x77, 0xf7, 0x58, 0x00, 0xfb, 0x6f, 0x30, 0x52, 
+  0x26, 0x43, 0x2e, 0x92, 0xb3, 0x1e, 0x7f, 0x5d, 0x2f, 0x01, 0xb2, 0x54, 
+  0x2f, 0x02, 0xb2, 0x00, 0x00, 0x4e, 0x2f, 0x03, 0x90, 0x63, 0x2f, 0xfb, 
+  0x50, 0x39, 0x82, 0x02, 0x40, 0x81, 0x88, 0xfd, 0x54, 0x00, 0x02, 0x41, 
+  0x40, 0x03, 0x57, 0x04, 0x42, 0x00, 0x2e, 0x94, 0x12, 0x1a, 0xd8, 0xbe, 
+  0x2c, 0x0b, 0x45, 0x40, 0x00, 0x00, 0x6c, 0x01, 0x55, 0x42, 0x0c, 0x17, 
+  0x45, 0x40, 0x2c, 0x03, 0x54, 0x42, 0x53, 0x0e, 0xf2, 0x2f, 0x00, 0x00, 
+  0x05, 0x57, 0x3e, 0x82, 0xe2, 0x40, 0xc3, 0x40, 0x28, 0xbd, 0x93, 0x0a, 
+  0x43, 0x40, 0xda, 0x00, 0x00, 0x02, 0x53, 0x42, 0x8a, 0x16, 0x43, 0x40, 
+  0x9a, 0x02, 0x52, 0x02, 0x36, 0x41, 0x40, 0xd5, 0x54, 0x4a, 0x0e, 0x00, 
+  0x80, 0x3b, 0x2f, 0x3a, 0x82, 0x00, 0x30, 0x41, 0x40, 0x21, 0x2e, 0x65, 
+  0x0f, 0x40, 0xb2, 0x0a, 0xb2, 0x9a, 0x00, 0x18, 0x61, 0x0c, 0x98, 0x2e, 
+  0x2b, 0x0e, 0x98, 0x2e, 0x41, 0x0e, 0xfb, 0xb2, 0x2e, 0x62, 0x94, 0x2e, 
+  0x35, 0xb4, 0x00, 0x40, 0x01, 0x55, 0xf7, 0x56, 0x83, 0x42, 0x8f, 0x86, 
+  0x74, 0x30, 0xff, 0x54, 0xc4, 0x42, 0xa3, 0x78, 0x92, 0x00, 0x00, 0x00, 
+  0xa1, 0x42, 0x23, 0x30, 0x27, 0x2e, 0x95, 0x00, 0x21, 0x2e, 0x94, 0x00, 
+  0xba, 0x82, 0x18, 0x10, 0x44, 0x2c, 0x81, 0x42, 0x30, 0x42, 0xd2, 0x92, 
+  0x00, 0x13, 0x2d, 0x21, 0x62, 0x6e, 0x23, 0x2e, 0x92, 0x02, 0x1a, 0x7b, 
+  0x10, 0x00, 0xf7, 0x0c, 0x2d, 0x77, 0x12, 0xe0, 0x1f, 0x0c, 0xf9, 0x50, 
+  0x0c, 0x82, 0x12, 0x30, 0x40, 0x42, 0x25, 0x71, 0x20, 0x02, 0x18, 0x2f, 
+  0x2e, 0x7b, 0x02, 0xe4, 0xb3, 0xda, 0x54, 0xda, 0x86, 0xfb, 0x7f, 0xe1, 
+  0x32, 0x62, 0x02, 0x26, 0xc2, 0xc4, 0x00, 0x00, 0xa9, 0x56, 0xa5, 0x6f, 
+  0xab, 0x08, 0x91, 0x6f, 0x4b, 0x08, 0x07, 0x57, 0xc4, 0x6f, 0x23, 0x09, 
+  0x00, 0x00, 0x4d, 0xba, 0x93, 0xbc, 0x8c, 0x0b, 0xd1, 0x6f, 0x0b, 0x09, 
+  0xed, 0x52, 0x09, 0x5f, 0x56, 0x42, 0x02, 0x00, 0xaf, 0x02, 0x12, 0x23, 
+  0xbd, 0x94, 0x0a, 0xe5, 0x6f, 0x68, 0xbb, 0xeb, 0x08, 0xbd, 0xb9, 0x63, 
+  0xbe, 0x20, 0x00, 0xfb, 0x6f, 0x52, 0x42, 0xe3, 0xb2, 0x82, 0x43, 0x42, 
+  0x90, 0x5f, 0xf3, 0x50, 0x03, 0x2e, 0x25, 0xf3, 0xe3, 0x07, 0xf0, 0xff, 
+  0xff, 0xa4, 0x00, 0x40, 0x28, 0xba, 0x9b, 0xbc, 0x88, 0xbd, 0x93, 0xb4, 
+  0xe3, 0x0a, 0x89, 0x16, 0x00, 0x11, 0x08, 0xb6, 0xc0, 0x2e, 0x19, 0x00, 
+  0x62, 0x02, 0xc5, 0x0c, 0x5d, 0x0d, 0x01, 0x02, 0x82, 0x31, 0x30, 0x08, 
+  0xa0, 0x2a, 0x04, 0xfb, 0x6f, 0x01, 0x30, 0xc3, 0x0e, 0x94, 0x02, 0xa8, 
+  0x95, 0xb2, 0xfe, 0x01, 0x02, 0xcc, 0x03, 0x02, 0xcc, 0x48, 0x0e, 0x02, 
+  0x00, 0x01, 0x52, 0xb6, 0x05, 0x0e, 0xb8, 0x2e, 0x0b, 0x51, 0x21, 0x34, 
+  0x01, 0x42, 0x82, 0x30, 0xc1, 0x32, 0x00, 0x10, 0x25, 0x2e, 0x62, 0xf5, 
+  0x01, 0x00, 0x22, 0x30, 0x01, 0x40, 0x4a, 0x0a, 0x53, 0x66, 0x0b, 0x55, 
+  0xf0, 0x22, 0x00, 0x3b, 0x23, 0x24, 0x0d, 0x53, 0x83, 0x72, 0xb6, 0x83, 
+  0x30, 0x50, 0x42, 0xc4, 0x32, 0x27, 0x2e, 0x64, 0xf5, 0x08, 0x80, 0x94, 
+  0x00, 0x50, 0x82, 0x5e, 0xd3, 0x3f, 0x84, 0x40, 0x7d, 0x82, 0xe3, 0x08, 
+  0x40, 0x42, 0x83, 0x52, 0x92, 0x08, 0x20, 0x01, 0x53, 0x00, 0x02, 0xf8, 
+  0x7c, 0x86, 0xdd, 0x52, 0x09, 0x2e, 0x50, 0x0f, 0xe3, 0x12, 0x40, 0xd3, 
+  0x86, 0x00, 0x22, 0x54, 0x40, 0x55, 0x40, 0x94, 0x42, 0x85, 0x42, 0x21, 
+  0x02, 0x74, 0x42, 0x40, 0x25, 0x32, 0xee, 0xc0, 0x42, 0x80, 0x00, 0x7e, 
+  0x82, 0x05, 0x2e, 0x87, 0x00, 0x80, 0x62, 0xba, 0x05, 0x2e, 0x09, 0x01, 
+  0x27, 0xbd, 0x2f, 0xb9, 0x04, 0x00, 0x80, 0x90, 0xd3, 0x8e, 0x6f, 0xf5, 
+  0x0c, 0x2d, 0x07, 0x2e, 0x51, 0x0f, 0x14, 0x30, 0x1c, 0x09, 0x05, 0x01, 
+  0x04, 0x22, 0x24, 0xe1, 0x56, 0x47, 0xbe, 0x93, 0x08, 0x94, 0x0a, 0x25, 
+  0x02, 0x0c, 0x0f, 0x55, 0x50, 0x42, 0x4a, 0x01, 0x04, 0x72, 0x46, 0xb8, 
+  0x2e, 0x50, 0x50, 0x02, 0x30, 0x43, 0x86, 0x0d, 0x42, 0x2c, 0xe3, 0x7f, 
+  0xd2, 0x7f, 0xc0, 0x14, 0x00, 0x7f, 0xb1, 0x32, 0x08, 0x41, 0x12, 0x0a, 
+  0x48, 0x04, 0x98, 0x2e, 0x74, 0xc0, 0x1e, 0xaa, 0xd3, 0x6f, 0x14, 0x00, 
+  0x00, 0x30, 0xb1, 0x6f, 0xe3, 0x22, 0xc0, 0x6f, 0x52, 0x40, 0xe4, 0x6f, 
+  0x4c, 0x0e, 0x12, 0x42, 0xd3, 0x00, 0x40, 0x7f, 0xeb, 0x2f, 0x03, 0x2e, 
+  0x66, 0x0f, 0x40, 0x90, 0x11, 0x30, 0x03, 0x2f, 0x23, 0x02, 0x0a, 0x02, 
+  0x01, 0x00, 0xf2, 0x3e, 0xd0, 0x6f, 0xfb, 0x6f, 0xb0, 0x5f, 0xb8, 0x2e, 
+  0x40, 0x50, 0xf1, 0x7f, 0x0a, 0x25, 0x3c, 0x40, 0x00, 0x86, 0xeb, 0x7f, 
+  0x41, 0x33, 0x22, 0x14, 0x9c, 0xd3, 0x6f, 0xf4, 0x30, 0xdc, 0x09, 0x13, 
+  0x59, 0xc2, 0x00, 0x00, 0x6f, 0x94, 0x09, 0x15, 0x59, 0x6a, 0xbb, 0xdc, 
+  0x08, 0xb4, 0xb9, 0xb1, 0xbd, 0x11, 0x5b, 0x95, 0x00, 0x00, 0x08, 0x21, 
+  0xbd, 0xf6, 0xbf, 0x77, 0x0b, 0x51, 0xbe, 0xf1, 0x6f, 0xeb, 0x6f, 0x52, 
+  0x42, 0x54, 0x00, 0x00, 0x42, 0xc0, 0x2e, 0x43, 0x42, 0xc0, 0x5f, 0x50, 
+  0x50, 0x1f, 0x51, 0x51, 0x30, 0x11, 0x42, 0xfb, 0x10, 0x00, 0x7f, 0x7b, 
+  0x30, 0x0b, 0x22, 0x34, 0x02, 0x80, 0x23, 0x33, 0x01, 0x42, 0x03, 0x00, 
+  0x07, 0x2e, 0x80, 0x82, 0x00, 0x03, 0xe3, 0x10, 0xad, 0x52, 0xe2, 0x7f, 
+  0xd3, 0x02, 0xaa, 0x98, 0x2e, 0x9c, 0x0e, 0xd1, 0x6f, 0x08, 0x0a, 0x00, 
+  0x06, 0x1a, 0x25, 0x7b, 0x86, 0xd0, 0x7f, 0x01, 0x33, 0x12, 0x04, 0x6e, 
+  0x03, 0x12, 0x00, 0xb2, 0x0d, 0x2f, 0xe3, 0x44, 0x00, 0x6f, 0x01, 0x02, 
+  0x30, 0x51, 0x30, 0xc7, 0x92, 0xe6, 0x21, 0xf2, 0x08, 0xbc, 0xc0, 0x42, 
+  0x98, 0x2e, 0xed, 0x00, 0x00, 0x03, 0x00, 0x2e, 0x00, 0x2e, 0xd0, 0x2e, 
+  0xb0, 0x6f, 0x0b, 0xb8, 0x03, 0x2e, 0x1b, 0x00, 0x08, 0x10, 0x02, 0x1a, 
+  0xb0, 0x7f, 0x70, 0xa2, 0x26, 0x21, 0x2e, 0x21, 0xf2, 0x05, 0x1a, 0x98, 
+  0x2e, 0x6d, 0xc0, 0x98, 0x2e, 0x00, 0x22, 0x5d, 0xc0, 0x17, 0x51, 0x98, 
+  0x2e, 0x44, 0xcb, 0x19, 0x02, 0x06, 0x46, 0xc3, 0x1b, 0x02, 0x06, 0x53, 
+  0xc7, 0x00, 0x02, 0x20, 0x26, 0xc0, 0x6f, 0x01, 0x31, 0x11, 0x42, 0xe1, 
+  0x02, 0x8c, 0x98, 0x2e, 0x2e, 0xb7, 0x21, 0x53, 0x00, 0x00, 0x00, 0x31, 
+  0x43, 0x40, 0x18, 0x0a, 0x40, 0x42, 0xf2, 0x37, 0x09, 0x2e, 0x5e, 0xf7, 
+  0x23, 0x57, 0x00, 0x00, 0xa2, 0x08, 0x25, 0x51, 0xc2, 0x42, 0x85, 0x31, 
+  0x15, 0x42, 0x22, 0x33, 0x4a, 0x00, 0xfc, 0x86, 0x00, 0x02, 0x0b, 0x40, 
+  0x32, 0x30, 0xc2, 0x42, 0x0b, 0x42, 0xe0, 0x82, 0x7a, 0x98, 0x2e, 0xc0, 
+  0xb3, 0xd1, 0x6f, 0x02, 0x04, 0x80, 0x12, 0xd0, 0x03, 0x30, 0xe0, 0x6f, 
+  0x1d, 0x55, 0x04, 0x30, 0x03, 0x70, 0x01, 0x89, 0x62, 0x0e, 0xfa, 0x1c, 
+  0x00, 0x2f, 0x43, 0x02, 0xe4, 0x82, 0xb0, 0x72, 0x6e, 0xb0, 0x5f, 0xb4, 
+  0x48, 0x00, 0x00, 0xa2, 0x55, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x6f, 0x00, 
+  0x00, 0xa8, 0xff, 0xff, 0xff, 0x4e, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 
+  0x00, 0x6e, 0x00, 0xf8, 0xe7, 0xff, 0xff, 0x76, 0xf3, 0xff, 0xff, 0x7c, 
+  0xf4, 0xff, 0xff, 0x02, 0x0f, 0x0f, 0x03, 0xc9, 0x06, 0x8f, 0x06, 0x10, 
+  0xfc, 0xff, 0x80, 0x2e, 0x7f, 0xcc, 0xe7, 0x06, 0x03, 0x00, 0x02, 0x00, 
+  0x24, 0x1f, 0x00, 0x0a, 0x00, 0xf0, 0xa6, 0x09, 0x10, 0x19, 0x00, 0x06, 
+  0x00, 0x32, 0x00, 0x07, 0x00, 0x64, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc8, 
+  0x00, 0x09, 0x00, 0x90, 0x01, 0x0a, 0x00, 0x20, 0x03, 0x0b, 0x00, 0x7d, 
+  0x00, 0x04, 0x41, 0x10, 0x12, 0x4e, 0x80, 0x3d, 0xfa, 0x00, 0x03, 0x02, 
+  0x08, 0x00, 0x3e, 0xf4, 0x01, 0x02, 0x02, 0x08, 0x80, 0x3e, 0xe8, 0x82, 
+  0x90, 0x03, 0x12, 0xab, 0x00, 0x00, 0x3f, 0xd0, 0x07, 0x02, 0x0f, 0x00, 
+  0x80, 0x3f, 0x00, 0x04, 0x04, 0x00, 0x40, 0x02, 0x08, 0x09, 0x00, 0x02, 
+  0x04, 0x00, 0x41, 0x02, 0x08, 0x41, 0x52, 0x20, 0x5d, 0xbf, 0x52, 0x20, 
+  0x95, 0xee, 0xdc, 0x2f, 0x0e, 0x00, 0x00, 0x0e, 0xbf, 0x12, 0x83, 0xda, 
+  0xbf, 0x12, 0x06, 0xf5, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x40, 0x01, 0x06, 
+  0x08, 0x80, 0x03, 0x2a, 0x03, 0x0c, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 
+  0x01, 0x00, 0x03, 0x56, 0x99, 0x9a, 0x9b, 0x9e, 0x00, 0x00, 0x78, 0x79, 
+  0x7a, 0x71, 0xa0, 0xa2, 0x7b, 0x7c, 0x70, 0x72, 0xa4, 0x00, 0x00, 0x70, 
+  0x42, 0xa1, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x62, 0x2a, 0x00, 0x02, 
+  0x01, 0x10, 0x06, 0x0f, 0x02, 0x06, 0x0d, 0x03, 0x05, 0x0a, 0x05, 0x10, 
+  0x11, 0x02, 0x07, 0xf0, 0x02, 0x04, 0xe8, 0x03, 0xfd, 0x00, 0x20, 0x10, 
+  0x27, 0xbb, 0x01, 0xf0, 0xff, 0x3a, 0x34, 0x00, 0xe0, 0x20, 0x14, 0x00, 
+  0x60, 0x25, 0x08, 0x0a, 0x14, 0x00, 0x4c, 0x02, 0x08, 0x20, 0x27, 0x14, 
+  0x00, 0xa4, 0x02, 0x08, 0x00, 0x02, 0x04, 0xbc, 0x1f, 0x14, 0x00, 0x9a, 
+  0xe0, 0xb0, 0x02, 0x08, 0x58, 0x02, 0x04, 0x02, 0x33, 0x00, 0x44, 0x02, 
+  0x08, 0x78, 0x28, 0x14, 0x00, 0xb8, 0x02, 0x08, 0x03, 0x10, 0x0b, 0x04, 
+  0x98, 0x00, 0xc4, 0x12, 0xa1, 0x0b, 0x0f, 0x0a, 0x0c, 0x80, 0x3e, 0x09, 
+  0x0d, 0xc8, 0x43, 0x00, 0x00, 0xc8, 0x3f, 0x00, 0x00, 0x54, 0x43, 0xd0, 
+  0x07, 0x07, 0x14, 0x01, 0x02, 0x09, 0xff, 0x03, 0x04, 0x03, 0x02, 0x05, 
+  0x06, 0x03, 0x1a, 0x01, 0x10, 0x00, 0x0f, 0x01, 0x01, 0x2d, 0x00, 0x06, 
+  0xc0, 0x21, 0x02, 0x19, 0x05, 0xc0, 0x00, 0x02, 0xc0, 0x19, 0x00, 0x03, 
+  0x78, 0x02, 0x00, 0xc8, 0xc9, 0x13, 0x00, 0x00, 0x20, 0x70, 0xcd, 0x13, 
+  0x00, 0x6c, 0xc8, 0x13, 0x00, 0xc4, 0xd1, 0x13, 0x00, 0x74, 0x02, 0x08, 
+  0xcc, 0xc7, 0x28, 0x80, 0x13, 0x00, 0x8c, 0x02, 0x04, 0x7c, 0x02, 0x0c, 
+  0x40, 0xf9, 0x13, 0x00, 0xb8, 0xcc, 0x13, 0x00, 0x14, 0x02, 0x0c, 0xe0, 
+  0x40, 0x4c, 0xd3, 0x13, 0x00, 0x84, 0x02, 0x08, 0x02, 0x47, 0x0c, 0x03, 
+  0x78, 0x14, 0xa1, 0x00, 0x20, 0x13, 0x0f, 0xc4, 0x00, 0x10, 0xc8, 0x00, 
+  0xb8, 0x1e, 0x05, 0x0a, 0xc0, 0x48, 0x44, 0x00, 0x00, 0x48, 0x41, 0x02, 
+  0x7a, 0x00, 0x08, 0x06, 0x3e, 0x03, 0xc0, 0xf3, 0x04, 0x04, 0x04, 0x0a, 
+  0xc0, 0x19, 0x01, 0x0f, 0xc0, 0x12, 0x68, 0x0f, 0xc0, 0x02, 0x30, 0x10, 
+  0x27, 0x03, 0xc0, 0x80, 0x00, 0x98, 0xea, 0x13, 0x08, 0x00, 0x00, 0xa8, 
+  0xf3, 0x02, 0xb8, 0xe7, 0x13, 0x00, 0xdc, 0xf6, 0x13, 0x00, 0x3c, 0xe9, 
+  0x13, 0x00, 0xf4, 0x00, 0x05, 0xe2, 0x13, 0x00, 0x00, 0xe0, 0x13, 0x00, 
+  0x44, 0x02, 0x0c, 0x7c, 0x02, 0x18, 0xcc, 0xef, 0x13, 0x00, 0x54, 0x00, 
+  0x35, 0xe6, 0x13, 0x00, 0x98, 0xf7, 0x13, 0x00, 0x4c, 0x02, 0x14, 0x00, 
+  0x0e, 0x01, 0xb8, 0x0f, 0xc0, 0x06, 0x20, 0x66, 0x66, 0x56, 0xee, 0x66, 
+  0x12, 0x70, 0x06, 0x0d, 0x00, 0x03, 0xc0, 0xc8, 0x02, 0xc0, 0xd0, 0x07, 
+  0x17, 0x82, 0x04, 0xbc, 0x02, 0x1f, 0x01, 0x02, 0x90, 0x02, 0x07, 0x04, 
+  0x03, 0xc4, 0x01, 0x1b, 0x01, 0x0f, 0xc0, 0x00, 0x00, 0x34, 0x6f, 0x00, 
+  0xf1, 0x4a, 0x05, 0xc0, 0x23, 0x00, 0xc0, 0xd6, 0x13, 0x00, 0xf0, 0x65, 
+  0x0a, 0x02, 0x04, 0xa0, 0x02, 0x04, 0x48, 0xd7, 0x02, 0xcc, 0x02, 0x08, 
+  0xc8, 0xd5, 0x02, 0xc4, 0xd4, 0x02, 0xc4, 0x00, 0x00, 0x00, 0x24, 0xf3, 
+  0x0e, 0x12, 0x80, 0x02, 0x07, 0x00, 0x98, 0x02, 0x18, 0x03, 0x08, 0x0f, 
+  0x04, 0x03, 0x10, 0xfa, 0x12, 0x7c, 0x1f, 0x80, 0x03, 0x18, 0x8f, 0xc2, 
+  0x75, 0x3d, 0x0b, 0x3f, 0x03, 0x08, 0x05, 0x04, 0x80, 0x02, 0xcc, 0x48, 
+  0x42, 0x00, 0x00, 0x03, 0xb6, 0x05, 0x12, 0x03, 0x0a, 0x04, 0x04, 0x03, 
+  0x05, 0x05, 0x13, 0x00, 0x2e, 0x62, 0x40, 0x63, 0x00, 0xf0, 0x32, 0x21, 
+  0x0f, 0xc0, 0x08, 0xc0, 0x80, 0x00, 0xd8, 0x05, 0x14, 0x00, 0xf8, 0x02, 
+  0x04, 0xbc, 0x41, 0x55, 0x02, 0x04, 0x68, 0x07, 0x14, 0x00, 0xd0, 0x02, 
+  0x08, 0x6c, 0x02, 0x04, 0x24, 0x02, 0x04, 0x00, 0x02, 0x01, 0xc4, 0x06, 
+  0x08, 0xb4, 0xff, 0x4b, 0x06, 0x08, 0x02, 0x13, 0x0f, 0x03, 0x04, 0x10, 
+  0x0f, 0xc0, 0x03, 0x15, 0x0f, 0xc0, 0x22, 0x40, 0x0f, 0xc0, 0x04, 0xce, 
+  0x01, 0x0a, 0xc0, 0x2f, 0x46, 0x00, 0xf1, 0x12, 0x0c, 0x02, 0x00, 0x20, 
+  0x0f, 0xc0, 0x0a, 0xc0, 0x68, 0x02, 0x14, 0x00, 0x90, 0x02, 0x04, 0x2c, 
+  0x01, 0x14, 0x00, 0x34, 0x04, 0x08, 0x6a, 0x14, 0x00, 0x50, 0x02, 0x08, 
+  0xdc, 0x00, 0x14, 0x00, 0x94, 0x48, 0x00, 0xf2, 0x00, 0x34, 0x02, 0x10, 
+  0x02, 0x07, 0x00, 0xea, 0xfe, 0x24, 0x02, 0x08, 0x44, 0x02, 0x20, 0x58, 
+  0xf4, 0x01, 0xb0, 0xfc, 0x1f, 0x80, 0x06, 0x1d, 0x0f, 0xc0, 0x0f, 0xc0, 
+  0x03, 0xb7, 0x9a, 0x00, 0x51, 0x89, 0x41, 0x06, 0x34, 0x30, 0x99, 0x00, 
+  0x10, 0x38, 0x51, 0x00, 0xf1, 0x02, 0x50, 0x0a, 0x14, 0x00, 0xac, 0x02, 
+  0x04, 0xa8, 0x42, 0x55, 0x09, 0x02, 0xc0, 0x0c, 0x14, 0x00, 0xd8, 0x39, 
+  0x02, 0x11, 0x10, 0x4f, 0x00, 0x61, 0xb0, 0x06, 0x08, 0xa0, 0x75, 0xff, 
+  0x4c, 0x00, 0xc6, 0xe0, 0x02, 0x08, 0x02, 0x17, 0x0c, 0x03, 0x01, 0x3f, 
+  0x00, 0x06, 0x1e, 0x4c, 0x00, 0x51, 0x06, 0x34, 0xc4, 0xa0, 0x2b, 0x4c, 
+  0x00, 0x10, 0x23, 0x4c, 0x00, 0xf1, 0x09, 0x18, 0xd9, 0x13, 0x00, 0x34, 
+  0x02, 0x04, 0xf4, 0x22, 0xfc, 0x00, 0xaa, 0xc8, 0xda, 0x13, 0x00, 0x18, 
+  0xd8, 0x13, 0x00, 0xa4, 0x02, 0x0c, 0x58, 0x4d, 0x00, 0xf6, 0x07, 0xfc, 
+  0x06, 0x08, 0xea, 0xff, 0xec, 0x02, 0x08, 0xd8, 0x02, 0x20, 0x20, 0x02, 
+  0x20, 0x02, 0x17, 0x0f, 0x03, 0x4f, 0x80, 0x04, 0x20, 0x4c, 0x00, 0x71, 
+  0x04, 0x32, 0x10, 0x43, 0x00, 0x00, 0x2c, 0x4e, 0x00, 0x10, 0x37, 0x33, 
+  0x01, 0xf1, 0x1c, 0xa0, 0x00, 0xfc, 0xfe, 0x52, 0x1c, 0xff, 0xab, 0x54, 
+  0x52, 0x30, 0x02, 0x08, 0xe4, 0x02, 0x08, 0xb0, 0x02, 0x08, 0x3c, 0x02, 
+  0x04, 0xf4, 0xfd, 0x35, 0xc0, 0x94, 0x02, 0x0c, 0x00, 0x02, 0x01, 0x84, 
+  0xf5, 0x7f, 0x02, 0x08, 0xf4, 0x02, 0x20, 0xb8, 0x02, 0x08, 0x00, 0x04, 
+  0x1a, 0xc0, 0x4e, 0x00, 0x51, 0x00, 0x88, 0x01, 0x00, 0x31, 0x4e, 0x00, 
+  0x12, 0x39, 0x81, 0x01, 0xf1, 0x0c, 0x5c, 0x11, 0x14, 0x00, 0x78, 0x01, 
+  0x04, 0x02, 0x04, 0x30, 0x10, 0x14, 0x00, 0x00, 0x13, 0x14, 0x00, 0x54, 
+  0x02, 0x08, 0xe0, 0x0f, 0x14, 0x00, 0x98, 0x35, 0xf5, 0xa1, 0x00, 0x11, 
+  0x38, 0x3d, 0x01, 0x70, 0x28, 0x02, 0x08, 0x10, 0x02, 0x20, 0x5c, 0x3b, 
+  0x01, 0x77, 0x0f, 0x04, 0x3f, 0xc0, 0xff, 0x66, 0x03, 0x56, 0x00, 0xf1, 
+  0x1d, 0x03, 0x31, 0x02, 0x04, 0x1c, 0x3f, 0x60, 0x02, 0x14, 0x11, 0x02, 
+  0x02, 0x05, 0x02, 0x03, 0x12, 0x63, 0x40, 0x02, 0x04, 0x03, 0xde, 0x90, 
+  0x01, 0xee, 0x02, 0x0a, 0x03, 0x03, 0xa0, 0x00, 0xf8, 0xc6, 0x13, 0x00, 
+  0x74, 0x62, 0xac, 0xb4, 0x55, 0xb5, 0x02, 0x08, 0x80, 0xb4, 0x00, 0xf0, 
+  0x37, 0x88, 0x02, 0x04, 0x14, 0x02, 0x04, 0xf0, 0x02, 0x04, 0xc0, 0x02, 
+  0x04, 0x03, 0x2a, 0xac, 0x06, 0x08, 0x03, 0x41, 0x03, 0x0c, 0x0f, 0x04, 
+  0xa8, 0x1e, 0xa1, 0x00, 0x98, 0x16, 0x6f, 0xc0, 0x00, 0x00, 0x33, 0x33, 
+  0xb3, 0x6a, 0xc0, 0x80, 0x1b, 0x95, 0x52, 0xfc, 0x53, 0x44, 0x55, 0x0f, 
+  0x3f, 0x5b, 0x53, 0x00, 0x1e, 0x01, 0x03, 0xa2, 0x00, 0x0c, 0x01, 0x0f, 
+  0x0e, 0xc0, 0xe8, 0x03, 0x09, 0xc0, 0x20, 0x2b, 0x50, 0xc2, 0x13, 0xa1, 
+  0x01, 0x41, 0x70, 0xc1, 0x72, 0x68, 0x01, 0x01, 0xa0, 0x44, 0x02, 0x0c, 
+  0xcc, 0xc0, 0x68, 0x77, 0x13, 0x00, 0x48, 0x00, 0x03, 0x60, 0x0c, 0x03, 
+  0x4d, 0x68, 0x06, 0x08, 0x54, 0x00, 0xf0, 0x0e, 0xb4, 0x02, 0xc0, 0x0f, 
+  0x14, 0x03, 0x10, 0x66, 0xec, 0x3c, 0x66, 0xe6, 0x0f, 0xc0, 0x62, 0x04, 
+  0x64, 0x03, 0x1b, 0x0d, 0x04, 0x1a, 0x80, 0x23, 0x01, 0x0f, 0xc0, 0x22, 
+  0x17, 0x9e, 0x01, 0xa0, 0xdc, 0xbd, 0xb0, 0x0a, 0x13, 0x00, 0x38, 0xbe, 
+  0x72, 0x60, 0xd2, 0x01, 0xf1, 0x02, 0x08, 0xc8, 0x02, 0x08, 0x28, 0x02, 
+  0x04, 0xb0, 0xbc, 0x13, 0x00, 0xaa, 0xf3, 0xd4, 0x02, 0x08, 0x60, 0x04, 
+  0x01, 0xf0, 0x38, 0x4c, 0x06, 0x08, 0x02, 0x0b, 0x0f, 0x03, 0x00, 0xc0, 
+  0x0f, 0xc0, 0x08, 0x22, 0x13, 0x74, 0x07, 0x0d, 0xf0, 0x4d, 0x80, 0x40, 
+  0x00, 0x00, 0x13, 0x80, 0x83, 0xf2, 0x07, 0x14, 0x06, 0x08, 0x0a, 0xc0, 
+  0x40, 0x0a, 0x0c, 0x06, 0x1e, 0x00, 0x0b, 0x0e, 0xc0, 0x64, 0x04, 0x40, 
+  0x00, 0x8c, 0x06, 0x1b, 0x25, 0x00, 0xe4, 0x2a, 0x14, 0x00, 0x10, 0x2c, 
+  0x14, 0x00, 0x5c, 0x02, 0x08, 0x68, 0x50, 0xd0, 0x2d, 0x14, 0x00, 0x6c, 
+  0x02, 0x08, 0x05, 0x02, 0x20, 0x29, 0x14, 0x1d, 0x04, 0xe2, 0x64, 0x02, 
+  0x04, 0x03, 0x2d, 0xea, 0x3a, 0x54, 0x02, 0x08, 0xe8, 0x02, 0x20, 0x7c, 
+  0x91, 0x02, 0xf2, 0x0d, 0xc0, 0x22, 0x3c, 0xb8, 0x02, 0x04, 0x0b, 0x14, 
+  0x03, 0x0c, 0x9a, 0x99, 0x76, 0x00, 0x99, 0x1a, 0x80, 0x83, 0x3c, 0xc8, 
+  0x12, 0x80, 0x03, 0x1a, 0x0e, 0x04, 0x01, 0x00, 0x01, 0x00, 0xf0, 0x70, 
+  0xf0, 0x4c, 0xa1, 0x00, 0x63, 0x06, 0x00, 0x00, 0x00, 0x32, 0x30, 0x00, 
+  0x02, 0x01, 0xd9, 0x03, 0x02, 0x05, 0x0e, 0x03, 0x80, 0x30, 0x00, 0x00, 
+  0x11, 0x02, 0x05, 0x04, 0x0d, 0x1b, 0x80, 0x41, 0xd0, 0x41, 0x00, 0x00, 
+  0x80, 0x3f, 0x05, 0x14, 0x06, 0x02, 0x22, 0x05, 0x0a, 0x0b, 0x06, 0xc8, 
+  0x4f, 0x14, 0x00, 0xa0, 0x02, 0x04, 0xf8, 0x6f, 0xfd, 0x02, 0x04, 0x0b, 
+  0x18, 0x0f, 0x0c, 0x07, 0x10, 0xb8, 0x0f, 0x80, 0x02, 0x19, 0x81, 0x02, 
+  0x04, 0x0b, 0x02, 0x5e, 0x03, 0x04, 0x02, 0x0b, 0x0e, 0x03, 0x08, 0x80, 
+  0x0f, 0x3a, 0xbd, 0xf5, 0x04, 0x28, 0x74, 0x0f, 0x78, 0x04, 0x16, 0x0f, 
+  0x05, 0x09, 0x10, 0xdb, 0x0f, 0x46, 0x02, 0x1b, 0x82, 0x12, 0x00, 0x0f, 
+  0x02, 0x80, 0x03, 0x04, 0x02, 0x0f, 0x0a, 0x03, 0x0d, 0x7a, 0x1c, 0x00, 
+  0x01, 0x0a, 0x19, 0x08, 0x0b, 0x7c, 0x4e, 0x1b, 0x02, 0xf1, 0x06, 0x04, 
+  0xb4, 0x02, 0x04, 0x08, 0x15, 0x0f, 0x09, 0x0a, 0x10, 0xd8, 0xeb, 0xdb, 
+  0x0f, 0x80, 0x02, 0x1c, 0x83, 0x02, 0x04, 0x13, 0x2c, 0x00, 0x60, 0x0b, 
+  0x0a, 0x03, 0x0c, 0x80, 0x04, 0x2a, 0x00, 0xf1, 0x06, 0x34, 0x0f, 0x78, 
+  0x08, 0x1a, 0x9b, 0x7f, 0x0f, 0x09, 0x05, 0x10, 0xb7, 0x0f, 0x80, 0x02, 
+  0x17, 0x84, 0x34, 0x15, 0xfc, 0x23, 0x4d, 0x00, 0xf0, 0x17, 0x0c, 0x80, 
+  0x02, 0xa2, 0x0a, 0x1b, 0x06, 0x0b, 0x34, 0xd0, 0xdb, 0x51, 0x14, 0x00, 
+  0x0c, 0x02, 0x04, 0x64, 0x02, 0x04, 0x06, 0x13, 0x0f, 0x07, 0x0c, 0x10, 
+  0xda, 0x0f, 0x80, 0x02, 0x1e, 0x85, 0x02, 0xda, 0x13, 0xfc, 0x1f, 0xb7, 
+  0x79, 0x00, 0xf2, 0x0c, 0x0e, 0x03, 0x2f, 0x00, 0x0d, 0x1f, 0xe0, 0x50, 
+  0x14, 0x0d, 0x11, 0x0f, 0x0e, 0x0e, 0x10, 0xb9, 0x0f, 0x80, 0x02, 0x20, 
+  0x86, 0x12, 0x00, 0x7f, 0xf5, 0x13, 0xfc, 0x98, 0x00, 0xf0, 0x09, 0x1c, 
+  0x00, 0x2f, 0x00, 0x04, 0x28, 0x74, 0x02, 0x80, 0x4c, 0x02, 0x04, 0xac, 
+  0x02, 0x04, 0x04, 0x11, 0x0f, 0x05, 0x0e, 0x10, 0xf6, 0xdf, 0xba, 0x29, 
+  0x00, 0x34, 0x87, 0x12, 0x00, 0x27, 0x00, 0x40, 0x0c, 0x80, 0x02, 0x26, 
+  0x72, 0x00, 0xf0, 0x23, 0x2c, 0x0f, 0x78, 0x06, 0x18, 0xdb, 0x79, 0x0f, 
+  0x07, 0x07, 0x10, 0xf0, 0x0f, 0xc6, 0x02, 0x19, 0xc0, 0x02, 0x04, 0x0f, 
+  0x03, 0x05, 0x10, 0x48, 0x44, 0x05, 0x08, 0x03, 0x06, 0x0f, 0xb9, 0x42, 
+  0x1a, 0xb6, 0xf8, 0x2e, 0x13, 0x00, 0x68, 0x02, 0x04, 0x03, 0x1e, 0x0f, 
+  0x04, 0x0f, 0x10, 0x07, 0x10, 0xf1, 0x2b, 0x01, 0x90, 0x07, 0xd9, 0x01, 
+  0x2f, 0x62, 0x00, 0xc8, 0x90, 0x11, 0x13, 0x06, 0xf0, 0x0b, 0x46, 0x80, 
+  0x02, 0x06, 0x02, 0x2b, 0x0f, 0x03, 0x00, 0x3c, 0x39, 0x2f, 0x00, 0x00, 
+  0x00, 0x7f, 0xd8, 0xfc, 0xd6, 0xd0, 0x3d, 0x0f, 0x29, 0x07, 0x10, 0xd1, 
+  0x2b, 0x00, 0x20, 0x05, 0x20, 0xfb, 0x02, 0xf4, 0x01, 0x0f, 0x80, 0x02, 
+  0x7c, 0x02, 0x80, 0x02, 0x19, 0xff, 0xfe, 0x04, 0x03, 0x0f, 0x80, 0x04, 
+  0x15, 0x04, 0x00, 0xf0, 0x2d, 0x06, 0x05, 0xcd, 0x0f, 0x80, 0x02, 0x18, 
+  0x07, 0x13, 0x0f, 0x80, 0x05, 0x80, 0x1f, 0x00, 0x02, 0x31, 0xbd, 0xff, 
+  0x0a, 0x03, 0x38, 0x1f, 0x80, 0x0a, 0x1c, 0x0f, 0x0b, 0x03, 0x10, 0xcb, 
+  0x07, 0x6d, 0x03, 0x0d, 0x06, 0x04, 0x17, 0xda, 0x0f, 0x80, 0x0f, 0x80, 
+  0x06, 0x2f, 0x0c, 0x07, 0x1f, 0x80, 0x6f, 0x6f, 0x03, 0x1d, 0x1f, 0x00, 
+  0x03, 0x14, 0x07, 0x04, 0xfc, 0x5e, 0x00, 0x12, 0x25, 0xaf, 0x00, 0xf1, 
+  0x18, 0x2c, 0x00, 0x0a, 0x05, 0x14, 0x0d, 0x06, 0x50, 0x67, 0x7b, 0x1f, 
+  0x00, 0x0d, 0x1f, 0x0f, 0x0e, 0x00, 0xfd, 0x0f, 0x80, 0x02, 0x22, 0x28, 
+  0x02, 0x04, 0x03, 0x03, 0x05, 0x2f, 0x80, 0x2d, 0x80, 0x0f, 0x80, 0x03, 
+  0x33, 0x00, 0x6f, 0xff, 0x76, 0x00, 0x40, 0x05, 0x0a, 0x10, 0xf7, 0xa1, 
+  0x01, 0x10, 0x1c, 0x1e, 0x00, 0xf0, 0x01, 0x1f, 0x80, 0x1f, 0x80, 0x03, 
+  0x24, 0x0f, 0x04, 0x1f, 0x80, 0x03, 0x20, 0xb7, 0xff, 0x1f, 0x80, 0x59, 
+  0x00, 0x10, 0xf6, 0x59, 0x00, 0x10, 0x1f, 0x1e, 0x00, 0x00, 0x77, 0x00, 
+  0x00, 0x1e, 0x00, 0x80, 0x0f, 0x80, 0x03, 0x20, 0x0f, 0x80, 0xdb, 0x7e, 
+  0x1e, 0x00, 0x10, 0xf3, 0x1e, 0x00, 0x10, 0x0d, 0x1e, 0x00, 0xf1, 0x2c, 
+  0x03, 0x1f, 0x80, 0x1d, 0x80, 0x4f, 0x00, 0x03, 0x33, 0x3f, 0x80, 0x04, 
+  0x14, 0xe1, 0xb8, 0xfd, 0x2e, 0x65, 0x42, 0x04, 0x09, 0x0f, 0x05, 0x02, 
+  0x10, 0xd0, 0x0f, 0x80, 0x02, 0x14, 0x0e, 0x46, 0x00, 0x0f, 0x80, 0x15, 
+  0x00, 0x02, 0x21, 0x04, 0x03, 0x4f, 0x00, 0x91, 0xef, 0x04, 0x15, 0x00, 
+  0xa8, 0x3a, 0x45, 0x80, 0x34, 0x37, 0x05, 0x08, 0x03, 0x16, 0x0f, 0x68, 
+  0x00, 0x10, 0xcf, 0x4a, 0x00, 0x40, 0x27, 0x59, 0xff, 0xed, 0xfc, 0x00, 
+  0xf2, 0x05, 0x4f, 0x00, 0x02, 0x31, 0x0a, 0x03, 0x4f, 0x00, 0x0a, 0x1b, 
+  0x0f, 0x0b, 0x04, 0x10, 0xf4, 0x0f, 0x80, 0x02, 0x16, 0x0c, 0x83, 0x00, 
+  0x22, 0xff, 0xf6, 0x85, 0x00, 0x42, 0x2f, 0x00, 0x03, 0x20, 0xfa, 0x00, 
+  0x10, 0xf2, 0x39, 0x00, 0x10, 0x16, 0x1e, 0x00, 0x62, 0x3f, 0x80, 0x0f, 
+  0x80, 0x7f, 0xfb, 0xa3, 0x00, 0xf0, 0x1d, 0x05, 0x20, 0x87, 0x34, 0x05, 
+  0x0e, 0x0b, 0x06, 0xd2, 0x0f, 0x80, 0x02, 0x1d, 0x17, 0x26, 0x00, 0x0f, 
+  0x80, 0x02, 0x1b, 0x0a, 0x03, 0x2f, 0x00, 0xe9, 0xdb, 0x05, 0x1b, 0x70, 
+  0x3b, 0x15, 0xf8, 0x40, 0x2a, 0x00, 0x72, 0x1a, 0x66, 0xb4, 0x05, 0x24, 
+  0x0b, 0x06, 0xce, 0x23, 0x00, 0x10, 0x13, 0x41, 0x00, 0x62, 0x7f, 0xfb, 
+  0x0f, 0x80, 0x1f, 0x00, 0x5f, 0x00, 0xa6, 0x0f, 0x20, 0x0f, 0x10, 0xf5, 
+  0x0f, 0x80, 0x02, 0x21, 0x15, 0xfc, 0x00, 0x20, 0xbf, 0xfd, 0x1c, 0x01, 
+  0xe2, 0x05, 0x20, 0x1f, 0x80, 0x05, 0x16, 0x03, 0x06, 0xfe, 0x0f, 0x80, 
+  0x02, 0x15, 0x2b, 0x73, 0x01, 0xf0, 0x06, 0x6c, 0x00, 0x4f, 0x00, 0x04, 
+  0x23, 0x7c, 0xfb, 0x38, 0x3c, 0x15, 0x80, 0x04, 0x0d, 0x0f, 0x05, 0x0f, 
+  0x10, 0x02, 0x10, 0xfb, 0xf9, 0x00, 0x12, 0x22, 0x20, 0x00, 0xf0, 0x0f, 
+  0x0c, 0x80, 0x37, 0xa7, 0xbf, 0xfd, 0x05, 0x1b, 0x06, 0x06, 0x6f, 0x00, 
+  0x06, 0x17, 0x0f, 0x07, 0x08, 0x10, 0xc0, 0x0f, 0x80, 0x02, 0x1a, 0x06, 
+  0x96, 0x01, 0x5f, 0x80, 0x1f, 0x80, 0x30, 0x02, 0x71, 0x5f, 0x00, 0x6f, 
+  0xff, 0x04, 0x20, 0x5f, 0x06, 0x02, 0x11, 0xcc, 0x06, 0x02, 0x00, 0x3f, 
+  0x00, 0xe2, 0x05, 0x03, 0x1c, 0x00, 0x1f, 0x80, 0x04, 0x23, 0x2f, 0x00, 
+  0x03, 0x15, 0xb7, 0xff, 0x2a, 0x01, 0x10, 0xc8, 0xf1, 0x00, 0x30, 0x26, 
+  0x06, 0x80, 0x9a, 0x03, 0x71, 0x0c, 0x80, 0x1f, 0x80, 0x04, 0x2c, 0x1f, 
+  0xca, 0x01, 0x50, 0xed, 0x7b, 0x0a, 0x10, 0xc9, 0xcc, 0x01, 0xf0, 0x08, 
+  0x29, 0x06, 0x80, 0x3f, 0x00, 0x1e, 0x80, 0x0f, 0x80, 0x02, 0x3a, 0x00, 
+  0x8f, 0x00, 0x04, 0x14, 0x0f, 0x05, 0x0b, 0x10, 0xc6, 0xfb, 0xbe, 0xe7, 
+  0x00, 0x60, 0x1d, 0x06, 0x80, 0x2f, 0x00, 0x0e, 0x73, 0x00, 0x10, 0x3a, 
+  0x1a, 0x03, 0x10, 0x14, 0x3a, 0x00, 0xd0, 0x06, 0x05, 0xc2, 0x0f, 0x80, 
+  0xfd, 0x6f, 0x02, 0x18, 0x0f, 0x06, 0x80, 0x6f, 0x29, 0x01, 0x20, 0x2b, 
+  0x0f, 0x96, 0x02, 0x30, 0x20, 0x6f, 0x00, 0x1c, 0x00, 0x10, 0xc3, 0x8c, 
+  0x00, 0x20, 0x10, 0xff, 0xa3, 0x03, 0xd2, 0x14, 0x05, 0x03, 0x2c, 0x00, 
+  0x1f, 0x00, 0x04, 0x23, 0x2f, 0x80, 0x03, 0x15, 0x8c, 0x00, 0x10, 0xc5, 
+  0x8c, 0x00, 0x60, 0x20, 0x06, 0x80, 0xff, 0xed, 0x1f, 0xb1, 0x02, 0x72, 
+  0x2b, 0x0f, 0x03, 0x1f, 0x00, 0x04, 0x20, 0x56, 0x00, 0x10, 0xc1, 0x3a, 
+  0x00, 0x41, 0x18, 0x06, 0x80, 0x2f, 0x97, 0x01, 0x02, 0x56, 0x00, 0x90, 
+  0x06, 0x20, 0x5f, 0x80, 0x06, 0x17, 0x02, 0x07, 0xc4, 0x4f, 0x00, 0x12, 
+  0x19, 0x54, 0x00, 0x00, 0x4e, 0x01, 0x91, 0xbf, 0xfd, 0x0b, 0x06, 0x1f, 
+  0x80, 0x05, 0x1c, 0x0f, 0x5a, 0x01, 0x10, 0xca, 0x5a, 0x01, 0x12, 0x2c, 
+  0xe2, 0x00, 0xa0, 0x0f, 0x80, 0x0e, 0x1f, 0x02, 0x0f, 0x6f, 0xff, 0x6f, 
+  0x00, 0xe0, 0x07, 0x30, 0x0c, 0x10, 0xc7, 0x03, 0x04, 0x12, 0x23, 0x3a, 
+  0x00, 0x20, 0x0c, 0x80, 0x76, 0x01, 0x60, 0x4f, 0x80, 0x04, 0x15, 0x1b, 
+  0x9f, 0xca, 0x02, 0x10, 0x83, 0xfe, 0x00, 0xf0, 0x10, 0x08, 0x80, 0x00, 
+  0x04, 0x01, 0x2f, 0x80, 0x2f, 0x00, 0x04, 0x25, 0x0e, 0x05, 0xcc, 0x30, 
+  0x7f, 0x00, 0xdb, 0x2f, 0xff, 0x00, 0x0d, 0x31, 0xb6, 0x0f, 0x80, 0x02, 
+  0x1f, 0x99, 0x96, 0x00, 0x54, 0x00, 0xf1, 0x4e, 0x13, 0xc8, 0x03, 0x04, 
+  0x03, 0x17, 0x06, 0x0f, 0x3a, 0x00, 0x44, 0x00, 0x39, 0x4f, 0x14, 0x00, 
+  0xe8, 0x4e, 0x14, 0x00, 0x60, 0x02, 0x08, 0xc4, 0x3f, 0x0f, 0x88, 0x03, 
+  0x34, 0x0f, 0x04, 0x00, 0x00, 0xe6, 0x17, 0xed, 0x0f, 0x46, 0x02, 0x23, 
+  0x9a, 0x34, 0x02, 0x05, 0x0f, 0x03, 0x04, 0x10, 0x03, 0x7c, 0x03, 0x04, 
+  0x03, 0x0d, 0x02, 0xcf, 0x1e, 0x00, 0xe8, 0x4d, 0x08, 0xbc, 0x14, 0x00, 
+  0x10, 0xb2, 0x80, 0xe8, 0x40, 0x14, 0x00, 0xdc, 0xbb, 0x97, 0x46, 0x03, 
+  0x2c, 0x0f, 0x04, 0x09, 0x10, 0xf8, 0x0f, 0x80, 0xc1, 0x3f, 0x02, 0x1b, 
+  0x89, 0x30, 0x00, 0x00, 0x21, 0x35, 0x05, 0xf4, 0x13, 0x0f, 0x0f, 0x03, 
+  0x06, 0x10, 0x02, 0x21, 0x06, 0x0a, 0x0b, 0x07, 0xb0, 0xb7, 0xc7, 0xfa, 
+  0x0f, 0x78, 0x0b, 0x1e, 0x0f, 0x0c, 0x00, 0x00, 0xf9, 0x0f, 0x80, 0x02, 
+  0x23, 0x88, 0x02, 0x80, 0x20, 0x02, 0x5f, 0x25, 0x00, 0xa2, 0xf6, 0xd6, 
+  0x02, 0x2f, 0xa6, 0x04, 0x18, 0x64, 0x0f, 0x80, 0x5b, 0x05, 0x10, 0xe4, 
+  0xaa, 0x02, 0x40, 0x9c, 0x12, 0x80, 0x38, 0x2f, 0x05, 0x23, 0x37, 0xf8, 
+  0x4a, 0x00, 0xb4, 0x0f, 0x3a, 0x04, 0x18, 0xb4, 0x3d, 0x14, 0x00, 0xcc, 
+  0x02, 0x04, 0x5f, 0x02, 0xb2, 0xd6, 0x5f, 0xbf, 0x0f, 0x46, 0x02, 0x14, 
+  0x8f, 0x02, 0x80, 0x23, 0x86, 0x05, 0x00, 0x29, 0x00, 0xf0, 0x06, 0x5f, 
+  0xff, 0x05, 0x17, 0xfc, 0x22, 0x04, 0x1c, 0x8f, 0xf5, 0x22, 0x84, 0x05, 
+  0x0e, 0x0f, 0x06, 0x0f, 0x10, 0x00, 0x00, 0xb2, 0x75, 0x00, 0x44, 0x9e, 
+  0x02, 0x80, 0x39, 0x27, 0x00, 0xf4, 0x00, 0x07, 0x8f, 0x06, 0x10, 0x0f, 
+  0x80, 0x05, 0x17, 0x98, 0x51, 0x14, 0x00, 0xb0, 0x02, 0x04, 0x28, 0x00, 
+  0xb6, 0xb5, 0x0f, 0x80, 0xf5, 0xd7, 0x02, 0x23, 0x9f, 0x02, 0x80, 0x37, 
+  0x51, 0x00, 0x00, 0x28, 0x00, 0x40, 0xe0, 0x02, 0x7c, 0xc8, 0x27, 0x00, 
+  0x30, 0x01, 0x00, 0x0f, 0x57, 0x06, 0x08, 0x01, 0x00, 0x50, 0xf0, 0x64, 
+  0xa1, 0x00, 0x36, 0x09, 0x00, 0x70, 0x32, 0xdd, 0x00, 0x02, 0x01, 0xe0, 
+  0x01, 0x6c, 0x06, 0xfb, 0x0a, 0xd0, 0x41, 0x03, 0x11, 0x19, 0x03, 0x05, 
+  0x0f, 0x04, 0x0a, 0x10, 0x03, 0x0a, 0x0c, 0x09, 0x0b, 0x18, 0x00, 0xb4, 
+  0x33, 0x14, 0x09, 0x0d, 0x0f, 0x0a, 0x3c, 0x00, 0x00, 0x01, 0x00, 0xc0, 
+  0x70, 0x65, 0xa1, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x58, 0x1f, 0xa1, 
+  0x10, 0x00, 0x50, 0x74, 0x65, 0xa1, 0x00, 0x09, 0x10, 0x00, 0x61, 0xb4, 
+  0x1f, 0xa1, 0x00, 0x74, 0x20, 0x14, 0x00, 0x14, 0x7c, 0x24, 0x00, 0x12, 
+  0x60, 0x24, 0x00, 0x14, 0x80, 0x10, 0x00, 0x12, 0x68, 0x10, 0x00, 0x14, 
+  0x84, 0x34, 0x00, 0x52, 0x50, 0x1f, 0xa1, 0x00, 0xd0, 0x14, 0x00, 0x50, 
+  0x8c, 0x65, 0xa1, 0x00, 0x19, 0x14, 0x00, 0xf2, 0x06, 0x70, 0x1f, 0xa1, 
+  0x00, 0x78, 0x1f, 0xa1, 0x00, 0xbc, 0x1f, 0xa1, 0x00, 0xc8, 0x1f, 0xa1, 
+  0x00, 0xe4, 0x1f, 0xa1, 0x00, 0x84, 0x58, 0x00, 0x14, 0xa4, 0x38, 0x00, 
+  0x52, 0x80, 0x1f, 0xa1, 0x00, 0x7c, 0x14, 0x00, 0x84, 0x00, 0x12, 0xa1, 
+  0x00, 0xfc, 0xf3, 0xff, 0xff, 0xa0, 0x00, 0x00, 
+};
+
+/* Name used by the examples */
+#define bhi360_firmware_image bhi360_fw_bosch_shuttle3_bhi360_bmm350c_bmp580_bme688_lz
+#undef BHI360_FIRMWARE_IMAGE_LEN
+#define BHI360_FIRMWARE_IMAGE_LEN BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_LEN
+
+#endif /* BHI360_FW_BOSCH_SHUTTLE3_BHI360_BMM350C_BMP580_BME688_LZ_H_ */